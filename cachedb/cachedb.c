@@ -44,18 +44,25 @@
 #ifdef USE_CACHEDB
 #include "cachedb/cachedb.h"
 #include "cachedb/redis.h"
+#include "cachedb/mmapdb.h"
 #include "util/regional.h"
 #include "util/net_help.h"
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgencode.h"
 #include "services/cache/dns.h"
+#include "services/mesh.h"
+#include "util/netevent.h"
+#include "util/rbtree.h"
+#include "util/alloc.h"
 #include "validator/val_neg.h"
 #include "validator/val_secalgo.h"
 #include "iterator/iter_utils.h"
 #include "sldns/parseutil.h"
 #include "sldns/wire2str.h"
 #include "sldns/sbuffer.h"
+#include "libunbound/unbound.h"
+#include <sys/time.h>
 
 /* header file for htobe64 */
 #ifdef HAVE_ENDIAN_H
@@ -194,9 +201,100 @@ testframe_store(struct module_env* env, struct cachedb_env* cachedb_env,
 	/* (key,data) successfully stored */
 }
 
+/** an asynchronous lookup of the testframe, answered from a timer */
+struct testframe_req {
+	/** the query */
+	struct module_qstate* qstate;
+	/** module id */
+	int id;
+	/** the backend */
+	struct cachedb_env* cachedb_env;
+	/** the timer that answers the lookup */
+	struct comm_timer* timer;
+	/** the key to lookup */
+	char key[(CACHEDB_HASHSIZE/8)*2+1];
+};
+
+void
+testframe_async_timer_cb(void* arg)
+{
+	struct testframe_req* req = (struct testframe_req*)arg;
+	struct module_qstate* qstate = req->qstate;
+	struct module_env* env = qstate->env;
+	int id = req->id, found;
+	verbose(VERB_ALGO, "testframe_async lookup of %s done", req->key);
+	found = testframe_lookup(env, req->cachedb_env, req->key,
+		env->scratch_buffer);
+	comm_timer_delete(req->timer);
+	free(req);
+	cachedb_lookup_done(qstate, id, found?env->scratch_buffer:NULL);
+}
+
+static int
+testframe_lookup_start(struct module_env* env,
+	struct cachedb_env* cachedb_env, char* key,
+	struct module_qstate* qstate, int id, void** r)
+{
+	struct timeval tv;
+	struct testframe_req* req = (struct testframe_req*)calloc(1,
+		sizeof(*req));
+	if(!req) {
+		log_err("out of memory");
+		return 0;
+	}
+	verbose(VERB_ALGO, "testframe_lookup_start of %s", key);
+	req->qstate = qstate;
+	req->id = id;
+	req->cachedb_env = cachedb_env;
+	(void)strlcpy(req->key, key, sizeof(req->key));
+	req->timer = comm_timer_create(env->worker_base,
+		testframe_async_timer_cb, req);
+	if(!req->timer) {
+		log_err("out of memory");
+		free(req);
+		return 0;
+	}
+	memset(&tv, 0, sizeof(tv));
+	comm_timer_set(req->timer, &tv);
+	*r = req;
+	return 1;
+}
+
+static void
+testframe_lookup_cancel(struct module_env* ATTR_UNUSED(env),
+	struct cachedb_env* ATTR_UNUSED(cachedb_env), void* r)
+{
+	struct testframe_req* req = (struct testframe_req*)r;
+	verbose(VERB_ALGO, "testframe_lookup_cancel of %s", req->key);
+	comm_timer_delete(req->timer);
+	free(req);
+}
+
 /** The testframe backend is for unit tests */
 static struct cachedb_backend testframe_backend = { "testframe",
-	testframe_init, testframe_deinit, testframe_lookup, testframe_store
+	testframe_init, testframe_deinit, testframe_lookup, testframe_store,
+	NULL, NULL, NULL, NULL
+};
+
+static void
+testframe_store_batch(struct module_env* env,
+	struct cachedb_env* cachedb_env, struct cachedb_store_item* items,
+	size_t num)
+{
+	size_t i;
+	verbose(VERB_ALGO, "testframe_store_batch of %d items", (int)num);
+	for(i=0; i<num; i++)
+		testframe_store(env, cachedb_env, items[i].key, items[i].data,
+			items[i].data_len, items[i].ttl);
+}
+
+/** The testframe-async backend is for unit tests of the asynchronous
+ * lookups, it answers the lookups from a timer on the event base, and
+ * of the batch stores */
+static struct cachedb_backend testframe_async_backend = { "testframe-async",
+	testframe_init, testframe_deinit, testframe_lookup, testframe_store,
+	testframe_lookup_start, testframe_lookup_cancel, NULL,
+	testframe_store_batch
 };
 
 /** find a particular backend from possible backends */
@@ -206,13 +304,303 @@ cachedb_find_backend(const char* str)
 #ifdef USE_REDIS
 	if(strcmp(str, redis_backend.name) == 0)
 		return &redis_backend;
+#endif
+#ifdef HAVE_SYS_MMAN_H
+	if(strcmp(str, mmapdb_backend.name) == 0)
+		return &mmapdb_backend;
 #endif
 	if(strcmp(str, testframe_backend.name) == 0)
 		return &testframe_backend;
+	if(strcmp(str, testframe_async_backend.name) == 0)
+		return &testframe_async_backend;
 	/* TODO add more backends here */
 	return NULL;
 }
 
+/** a store that waits in the write-behind queue */
+struct cachedb_wb_item {
+	/** node in the tree, key is the key string */
+	rbnode_type node;
+	/** next in the queue, in order of arrival */
+	struct cachedb_wb_item* next;
+	/** the key */
+	char key[(CACHEDB_HASHSIZE/8)*2+1];
+	/** the data to store, malloced */
+	uint8_t* data;
+	/** length of the data */
+	size_t data_len;
+	/** ttl of the data */
+	time_t ttl;
+	/** time when the store was queued */
+	struct timeval queued;
+};
+
+/** the write-behind queue of stores of one thread */
+struct cachedb_wb {
+	/** module env of the thread */
+	struct module_env* env;
+	/** the cachedb env */
+	struct cachedb_env* ie;
+	/** the queued stores, by key, to merge stores of the same key */
+	rbtree_type tree;
+	/** first in the queue, the oldest */
+	struct cachedb_wb_item* first;
+	/** last in the queue */
+	struct cachedb_wb_item* last;
+	/** timer that flushes the queue */
+	struct comm_timer* timer;
+	/** if the timer is set */
+	int timer_set;
+	/** number of stores merged into a queued store with the same key */
+	size_t num_merged;
+	/** number of stores dropped because the queue was full */
+	size_t num_dropped;
+	/** number of flushes */
+	size_t num_flush;
+	/** number of stores written to the backend by the flushes */
+	size_t num_stored;
+	/** total time the flushed stores waited in the queue */
+	struct timeval sum_wait;
+	/** total time the flushes took, writing to the backend */
+	struct timeval sum_flush;
+};
+
+int
+cachedb_wb_cmp(const void* k1, const void* k2)
+{
+	return strcmp((const char*)k1, (const char*)k2);
+}
+
+/** delete the write-behind queue of a thread, the queued stores are lost */
+static void
+cachedb_wb_delete(struct cachedb_wb* wb)
+{
+	struct cachedb_wb_item* p, *np;
+	if(!wb)
+		return;
+	p = wb->first;
+	while(p) {
+		np = p->next;
+		free(p->data);
+		free(p);
+		p = np;
+	}
+	comm_timer_delete(wb->timer);
+	free(wb);
+}
+
+/** get the write-behind queue of the thread, create it if needed */
+static struct cachedb_wb*
+cachedb_wb_get(struct module_env* env, struct cachedb_env* ie)
+{
+	struct cachedb_wb* wb;
+	int i = env->alloc->thread_num;
+	if(i < 0 || i >= ie->num_wb)
+		return NULL;
+	if(ie->wb[i])
+		return ie->wb[i];
+	wb = (struct cachedb_wb*)calloc(1, sizeof(*wb));
+	if(!wb) {
+		log_err("out of memory");
+		return NULL;
+	}
+	wb->env = env;
+	wb->ie = ie;
+	rbtree_init(&wb->tree, &cachedb_wb_cmp);
+	wb->timer = comm_timer_create(env->worker_base, cachedb_wb_timer_cb,
+		wb);
+	if(!wb->timer) {
+		log_err("out of memory");
+		free(wb);
+		return NULL;
+	}
+	ie->wb[i] = wb;
+	return wb;
+}
+
+/** add timeval to the sum */
+static void
+cachedb_timeval_add(struct timeval* d, const struct timeval* start,
+	const struct timeval* end)
+{
+#ifndef S_SPLINT_S
+	time_t end_usec = end->tv_usec;
+	time_t sec = end->tv_sec - start->tv_sec;
+	if(end_usec < start->tv_usec) {
+		end_usec += 1000000;
+		sec--;
+	}
+	if(sec < 0)
+		return;
+	d->tv_sec += sec;
+	d->tv_usec += end_usec - start->tv_usec;
+	if(d->tv_usec >= 1000000) {
+		d->tv_usec -= 1000000;
+		d->tv_sec++;
+	}
+#endif
+}
+
+/** write the queued stores to the backend, in order of arrival.  The
+ * store of the backend is done when it returns.  If the backend can
+ * store a batch, the queue is written with one call. */
+static void
+cachedb_wb_flush(struct cachedb_wb* wb)
+{
+	struct cachedb_wb_item* p, *np;
+	struct cachedb_store_item* items = NULL;
+	struct timeval start, end;
+	size_t i, num = wb->tree.count;
+	if(!wb->first)
+		return;
+	wb->num_flush++;
+	if(wb->ie->backend->store_batch) {
+		items = (struct cachedb_store_item*)reallocarray(NULL, num,
+			sizeof(*items));
+		if(!items)
+			log_err("out of memory, stores are not batched");
+	}
+	/* the event loop time does not move during the flush */
+	if(gettimeofday(&start, NULL) < 0)
+		start = *wb->env->now_tv;
+	i = 0;
+	for(p = wb->first; p; p = p->next) {
+		cachedb_timeval_add(&wb->sum_wait, &p->queued,
+			wb->env->now_tv);
+		if(items) {
+			items[i].key = p->key;
+			items[i].data = p->data;
+			items[i].data_len = p->data_len;
+			items[i].ttl = p->ttl;
+			i++;
+		} else {
+			(*wb->ie->backend->store)(wb->env, wb->ie, p->key,
+				p->data, p->data_len, p->ttl);
+		}
+		wb->num_stored++;
+	}
+	if(items) {
+		(*wb->ie->backend->store_batch)(wb->env, wb->ie, items, i);
+		free(items);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		end = start;
+	cachedb_timeval_add(&wb->sum_flush, &start, &end);
+	for(p = wb->first; p; p = np) {
+		np = p->next;
+		free(p->data);
+		free(p);
+	}
+	rbtree_init(&wb->tree, &cachedb_wb_cmp);
+	wb->first = NULL;
+	wb->last = NULL;
+}
+
+void
+cachedb_wb_timer_cb(void* arg)
+{
+	struct cachedb_wb* wb = (struct cachedb_wb*)arg;
+	wb->timer_set = 0;
+	verbose(VERB_ALGO, "cachedb write-behind flush of %d stores",
+		(int)wb->tree.count);
+	cachedb_wb_flush(wb);
+}
+
+/**
+ * Queue a store in the write-behind queue of the thread.  A queued store
+ * for the same key is replaced.  If the queue is full, the store is
+ * dropped.
+ * @return false if the store could not be queued, it has to be stored
+ * 	directly.
+ */
+static int
+cachedb_wb_add(struct module_env* env, struct cachedb_env* ie, char* key,
+	uint8_t* data, size_t data_len, time_t ttl)
+{
+	struct cachedb_wb* wb = cachedb_wb_get(env, ie);
+	struct cachedb_wb_item* p;
+	uint8_t* d;
+	if(!wb)
+		return 0;
+	p = (struct cachedb_wb_item*)rbtree_search(&wb->tree, key);
+	if(p) {
+		/* the newer data replaces the queued data */
+		if(!(d = memdup(data, data_len))) {
+			log_err("out of memory");
+			return 1;
+		}
+		free(p->data);
+		p->data = d;
+		p->data_len = data_len;
+		p->ttl = ttl;
+		wb->num_merged++;
+		return 1;
+	}
+	if(wb->tree.count >= ie->wb_size) {
+		/* the backend does not keep up, keep the thread going */
+		wb->num_dropped++;
+		return 1;
+	}
+	p = (struct cachedb_wb_item*)calloc(1, sizeof(*p));
+	if(!p || !(p->data = memdup(data, data_len))) {
+		log_err("out of memory");
+		free(p);
+		wb->num_dropped++;
+		return 1;
+	}
+	strlcpy(p->key, key, sizeof(p->key));
+	p->node.key = p->key;
+	p->data_len = data_len;
+	p->ttl = ttl;
+	p->queued = *env->now_tv;
+	(void)rbtree_insert(&wb->tree, &p->node);
+	if(wb->last)
+		wb->last->next = p;
+	else	wb->first = p;
+	wb->last = p;
+	if(!wb->timer_set) {
+		struct timeval tv;
+#ifndef S_SPLINT_S
+		tv.tv_sec = ie->wb_interval / 1000;
+		tv.tv_usec = (ie->wb_interval % 1000) * 1000;
+#endif
+		comm_timer_set(wb->timer, &tv);
+		wb->timer_set = 1;
+	}
+	return 1;
+}
+
+void
+cachedb_wb_get_stats(struct module_env* env, int id,
+	struct ub_server_stats* svr, int reset)
+{
+	struct cachedb_env* ie = (struct cachedb_env*)env->modinfo[id];
+	struct cachedb_wb* wb;
+	int i = env->alloc->thread_num;
+	if(!ie || !ie->wb || i < 0 || i >= ie->num_wb || !ie->wb[i])
+		return;
+	wb = ie->wb[i];
+	svr->cachedb_wb_queue = (long long)wb->tree.count;
+	svr->cachedb_wb_merged = (long long)wb->num_merged;
+	svr->cachedb_wb_dropped = (long long)wb->num_dropped;
+	svr->cachedb_wb_flush = (long long)wb->num_flush;
+	svr->cachedb_wb_stored = (long long)wb->num_stored;
+	svr->cachedb_wb_wait_sec = (long long)wb->sum_wait.tv_sec;
+	svr->cachedb_wb_wait_usec = (long long)wb->sum_wait.tv_usec;
+	svr->cachedb_wb_flush_sec = (long long)wb->sum_flush.tv_sec;
+	svr->cachedb_wb_flush_usec = (long long)wb->sum_flush.tv_usec;
+	if(reset && !env->cfg->stat_cumulative) {
+		wb->num_merged = 0;
+		wb->num_dropped = 0;
+		wb->num_flush = 0;
+		wb->num_stored = 0;
+		wb->sum_wait.tv_sec = 0;
+		wb->sum_wait.tv_usec = 0;
+		wb->sum_flush.tv_sec = 0;
+		wb->sum_flush.tv_usec = 0;
+	}
+}
+
 /** apply configuration to cachedb module 'global' state */
 static int
 cachedb_apply_cfg(struct cachedb_env* cachedb_env, struct config_file* cfg)
@@ -224,7 +612,17 @@ cachedb_apply_cfg(struct cachedb_env* cachedb_env, struct config_file* cfg)
 		return 0;
 	}
 
-	/* TODO see if more configuration needs to be applied or not */
+	if(cfg->cachedb_write_behind_size > 0) {
+		cachedb_env->wb_size = (size_t)cfg->cachedb_write_behind_size;
+		cachedb_env->wb_interval = cfg->cachedb_write_behind_interval;
+		cachedb_env->num_wb = cfg->num_threads;
+		cachedb_env->wb = (struct cachedb_wb**)calloc(
+			(size_t)cachedb_env->num_wb, sizeof(struct cachedb_wb*));
+		if(!cachedb_env->wb) {
+			log_err("out of memory");
+			return 0;
+		}
+	}
 	return 1;
 }
 
@@ -240,6 +638,7 @@ cachedb_init(struct module_env* env, int id)
 	env->modinfo[id] = (void*)cachedb_env;
 	if(!cachedb_apply_cfg(cachedb_env, env->cfg)) {
 		log_err("cachedb: could not apply configuration settings.");
+		free(cachedb_env->wb);
 		free(cachedb_env);
 		env->modinfo[id] = NULL;
 		return 0;
@@ -250,6 +649,7 @@ cachedb_init(struct module_env* env, int id)
 	if(!(*cachedb_env->backend->init)(env, cachedb_env)) {
 		log_err("cachedb: could not init %s backend",
 			cachedb_env->backend->name);
+		free(cachedb_env->wb);
 		free(cachedb_env);
 		env->modinfo[id] = NULL;
 		return 0;
@@ -276,6 +676,12 @@ cachedb_deinit(struct module_env* env, int id)
 	cachedb_env = (struct cachedb_env*)env->modinfo[id];
 	/* free contents */
 	/* TODO */
+	if(cachedb_env->wb) {
+		int i;
+		for(i=0; i<cachedb_env->num_wb; i++)
+			cachedb_wb_delete(cachedb_env->wb[i]);
+		free(cachedb_env->wb);
+	}
 	if(cachedb_env->enabled) {
 		(*cachedb_env->backend->deinit)(env, cachedb_env);
 	}
@@ -563,6 +969,25 @@ parse_data(struct module_qstate* qstate, struct sldns_buffer* buf)
 	return 1;
 }
 
+/**
+ * Check the data that is fetched from the extcache, store in
+ * qstate.return_msg.  return true if the data can be used.
+ */
+static int
+cachedb_extcache_use(struct module_qstate* qstate, struct sldns_buffer* buf)
+{
+	/* check expiry date and check if query-data matches */
+	if( !good_expiry_and_qinfo(qstate, buf) ) {
+		return 0;
+	}
+
+	/* parse dns message into return_msg */
+	if( !parse_data(qstate, buf) ) {
+		return 0;
+	}
+	return 1;
+}
+
 /**
  * Lookup the qstate.qinfo in extcache, store in qstate.return_msg.
  * return true if lookup was successful.
@@ -578,17 +1003,22 @@ cachedb_extcache_lookup(struct module_qstate* qstate, struct cachedb_env* ie)
 		qstate->env->scratch_buffer)) {
 		return 0;
 	}
+	return cachedb_extcache_use(qstate, qstate->env->scratch_buffer);
+}
 
-	/* check expiry date and check if query-data matches */
-	if( !good_expiry_and_qinfo(qstate, qstate->env->scratch_buffer) ) {
-		return 0;
-	}
-
-	/* parse dns message into return_msg */
-	if( !parse_data(qstate, qstate->env->scratch_buffer) ) {
-		return 0;
-	}
-	return 1;
+/**
+ * Start an asynchronous lookup of qstate.qinfo in extcache.
+ * return true if the query waits for the lookup.
+ */
+static int
+cachedb_extcache_lookup_start(struct module_qstate* qstate,
+	struct cachedb_qstate* iq, struct cachedb_env* ie, int id)
+{
+	char key[(CACHEDB_HASHSIZE/8)*2+1];
+	calc_hash(qstate, key, sizeof(key));
+	iq->async_found = 0;
+	return (*ie->backend->lookup_start)(qstate->env, ie, key, qstate, id,
+		&iq->async_req);
 }
 
 /**
@@ -603,6 +1033,13 @@ cachedb_extcache_store(struct module_qstate* qstate, struct cachedb_env* ie)
 	/* prepare data in scratch buffer */
 	if(!prep_data(qstate, qstate->env->scratch_buffer))
 		return;
+
+	/* queue it, the timer writes it to the backend later */
+	if(ie->wb && qstate->env->worker_base && cachedb_wb_add(qstate->env,
+		ie, key, sldns_buffer_begin(qstate->env->scratch_buffer),
+		sldns_buffer_limit(qstate->env->scratch_buffer),
+		qstate->return_msg->rep->ttl))
+		return;
 	
 	/* call backend */
 	(*ie->backend->store)(qstate->env, ie, key,
@@ -659,6 +1096,39 @@ cachedb_intcache_store(struct module_qstate* qstate)
 		qstate->region, store_flags);
 }
 
+/**
+ * The extcache has data for the query, in qstate.return_msg.
+ * @param qstate: query state.
+ * @param ie: environment specific for this module.  global.
+ * @param id: module id.
+ */
+static void
+cachedb_extcache_found(struct module_qstate* qstate, struct cachedb_env* ie,
+	int id)
+{
+	if(verbosity >= VERB_ALGO)
+		log_dns_msg(ie->backend->name,
+			&qstate->return_msg->qinfo,
+			qstate->return_msg->rep);
+	/* store this result in internal cache */
+	cachedb_intcache_store(qstate);
+	/* In case we have expired data but there is a client timer for expired
+	 * answers, pass execution to next module in order to try updating the
+	 * data first.
+	 * TODO: this needs revisit. The expired data stored from cachedb has
+	 * 0 TTL which is picked up by iterator later when looking in the cache.
+	 * Document that ext cachedb does not work properly with
+	 * serve_stale_reply_ttl yet. */
+	if(qstate->need_refetch && qstate->serve_expired_data &&
+		qstate->serve_expired_data->timer) {
+			qstate->return_msg = NULL;
+			qstate->ext_state[id] = module_wait_module;
+			return;
+	}
+	/* we are done with the query */
+	qstate->ext_state[id] = module_finished;
+}
+
 /**
  * Handle a cachedb module event with a query
  * @param qstate: query state (from the mesh), passed between modules.
@@ -669,8 +1139,7 @@ cachedb_intcache_store(struct module_qstate* qstate)
  */
 static void
 cachedb_handle_query(struct module_qstate* qstate,
-	struct cachedb_qstate* ATTR_UNUSED(iq),
-	struct cachedb_env* ie, int id)
+	struct cachedb_qstate* iq, struct cachedb_env* ie, int id)
 {
 	/* check if we are enabled, and skip if so */
 	if(!ie->enabled) {
@@ -704,29 +1173,21 @@ cachedb_handle_query(struct module_qstate* qstate,
 		return;
 	}
 
+	/* ask the backend on the event base, the worker continues with
+	 * other queries until the lookup is done */
+	if(ie->backend->lookup_start && qstate->env->worker_base) {
+		if(cachedb_extcache_lookup_start(qstate, iq, ie, id)) {
+			qstate->ext_state[id] = module_wait_reply;
+			return;
+		}
+		/* no lookup possible now, pass request to next module */
+		qstate->ext_state[id] = module_wait_module;
+		return;
+	}
+
 	/* ask backend cache to see if we have data */
 	if(cachedb_extcache_lookup(qstate, ie)) {
-		if(verbosity >= VERB_ALGO)
-			log_dns_msg(ie->backend->name,
-				&qstate->return_msg->qinfo,
-				qstate->return_msg->rep);
-		/* store this result in internal cache */
-		cachedb_intcache_store(qstate);
-		/* In case we have expired data but there is a client timer for expired
-		 * answers, pass execution to next module in order to try updating the
-		 * data first.
-		 * TODO: this needs revisit. The expired data stored from cachedb has
-		 * 0 TTL which is picked up by iterator later when looking in the cache.
-		 * Document that ext cachedb does not work properly with
-		 * serve_stale_reply_ttl yet. */
-		if(qstate->need_refetch && qstate->serve_expired_data &&
-			qstate->serve_expired_data->timer) {
-				qstate->return_msg = NULL;
-				qstate->ext_state[id] = module_wait_module;
-				return;
-		}
-		/* we are done with the query */
-		qstate->ext_state[id] = module_finished;
+		cachedb_extcache_found(qstate, ie, id);
 		return;
 	}
 
@@ -735,6 +1196,38 @@ cachedb_handle_query(struct module_qstate* qstate,
 	qstate->ext_state[id] = module_wait_module;
 }
 
+/**
+ * Handle the result of the asynchronous extcache lookup.
+ * @param qstate: query state (from the mesh), passed between modules.
+ * @param iq: query state specific for this module.  per-query.
+ * @param ie: environment specific for this module.  global.
+ * @param id: module id.
+ */
+static void
+cachedb_handle_lookup_done(struct module_qstate* qstate,
+	struct cachedb_qstate* iq, struct cachedb_env* ie, int id)
+{
+	if(iq->async_found) {
+		cachedb_extcache_found(qstate, ie, id);
+		return;
+	}
+	/* no cache fetches */
+	/* pass request to next module */
+	qstate->ext_state[id] = module_wait_module;
+}
+
+void
+cachedb_lookup_done(struct module_qstate* qstate, int id,
+	struct sldns_buffer* buf)
+{
+	struct cachedb_qstate* iq = (struct cachedb_qstate*)qstate->minfo[id];
+	log_assert(iq && iq->async_req);
+	iq->async_req = NULL;
+	iq->async_found = (buf && cachedb_extcache_use(qstate, buf));
+	mesh_run(qstate->env->mesh, qstate->mesh_info, module_event_reply,
+		NULL);
+}
+
 /**
  * Handle a cachedb module event with a response from the iterator.
  * @param qstate: query state (from the mesh), passed between modules.
@@ -789,6 +1282,10 @@ cachedb_operate(struct module_qstate* qstate, enum module_ev event, int id,
 		cachedb_handle_response(qstate, iq, ie, id);
 		return;
 	}
+	if(iq && event == module_event_reply && !outbound) {
+		cachedb_handle_lookup_done(qstate, iq, ie, id);
+		return;
+	}
 	if(iq && outbound) {
 		/* cachedb does not need to process responses at this time
 		 * ignore it.
@@ -828,11 +1325,38 @@ cachedb_clear(struct module_qstate* qstate, int id)
 	iq = (struct cachedb_qstate*)qstate->minfo[id];
 	if(iq) {
 		/* free contents of iq */
-		/* TODO */
+		if(iq->async_req) {
+			struct cachedb_env* ie = (struct cachedb_env*)
+				qstate->env->modinfo[id];
+			(*ie->backend->lookup_cancel)(qstate->env, ie,
+				iq->async_req);
+			iq->async_req = NULL;
+		}
 	}
 	qstate->minfo[id] = NULL;
 }
 
+void
+cachedb_thread_stop(struct module_env* env, int id)
+{
+	struct cachedb_env* ie;
+	int i;
+	if(!env || id < 0 || !env->modinfo[id])
+		return;
+	ie = (struct cachedb_env*)env->modinfo[id];
+	i = env->alloc->thread_num;
+	if(ie->wb && i >= 0 && i < ie->num_wb && ie->wb[i]) {
+		/* write the queued stores, the backend stores them before
+		 * it returns, so they are done before it stops and is
+		 * deinited */
+		cachedb_wb_flush(ie->wb[i]);
+		cachedb_wb_delete(ie->wb[i]);
+		ie->wb[i] = NULL;
+	}
+	if(ie->enabled && ie->backend->thread_stop)
+		(*ie->backend->thread_stop)(env, ie);
+}
+
 size_t 
 cachedb_get_mem(struct module_env* env, int id)
 {
@@ -41,6 +41,9 @@
  */
 #include "util/module.h"
 struct cachedb_backend;
+struct cachedb_store_item;
+struct cachedb_wb;
+struct ub_server_stats;
 
 /**
  * The global variable environment contents for the cachedb
@@ -56,6 +59,16 @@ struct cachedb_env {
 
 	/** backend specific data here */
 	void* backend_data;
+
+	/** write-behind queues of stores, one per thread, indexed by
+	 * thread number.  NULL if the stores go to the backend directly. */
+	struct cachedb_wb** wb;
+	/** number of entries in the wb array */
+	int num_wb;
+	/** max number of stores in the queue of a thread */
+	size_t wb_size;
+	/** interval, in msec, after which the queued stores are flushed */
+	int wb_interval;
 };
 
 /**
@@ -63,6 +76,11 @@ struct cachedb_env {
  */
 struct cachedb_qstate {
 	int todo;
+	/** the backend request of the asynchronous lookup that the query
+	 * waits for, or NULL */
+	void* async_req;
+	/** if the asynchronous lookup found usable data, in return_msg */
+	int async_found;
 };
 
 /**
@@ -82,9 +100,47 @@ struct cachedb_backend {
 	int (*lookup)(struct module_env*, struct cachedb_env*, char*,
 		struct sldns_buffer*);
 	
-	/** Store (env, cachedb_env, key, data, data_len) */
+	/** Store (env, cachedb_env, key, data, data_len, ttl).  The store is
+	 * done, or dropped, when it returns, the write-behind queue and the
+	 * thread stop rely on that. */
 	void (*store)(struct module_env*, struct cachedb_env*, char*,
 		uint8_t*, size_t, time_t);
+
+	/** Lookup_start (env, cachedb_env, key, qstate, id, req): start an
+	 * asynchronous lookup on the event base of the thread.  Returns true
+	 * and sets the request handle in req if started; the backend calls
+	 * cachedb_lookup_done from the event loop with the result.  Returns
+	 * false if the lookup can not be done now, the query is a miss.
+	 * NULL if the backend only has the blocking lookup. */
+	int (*lookup_start)(struct module_env*, struct cachedb_env*, char*,
+		struct module_qstate*, int, void**);
+
+	/** Lookup_cancel (env, cachedb_env, req): the query is deleted,
+	 * the request must not call cachedb_lookup_done. */
+	void (*lookup_cancel)(struct module_env*, struct cachedb_env*, void*);
+
+	/** Thread_stop (env, cachedb_env): the event base of the thread is
+	 * going to be deleted, release what the backend has on it. */
+	void (*thread_stop)(struct module_env*, struct cachedb_env*);
+
+	/** Store_batch (env, cachedb_env, items, num): store the items
+	 * together, in order, like store does one at a time.  The stores
+	 * are done, or dropped, when it returns.  NULL if the backend only
+	 * has the store of one item. */
+	void (*store_batch)(struct module_env*, struct cachedb_env*,
+		struct cachedb_store_item*, size_t);
+};
+
+/** a store in a batch for the store_batch of the backend */
+struct cachedb_store_item {
+	/** the key */
+	char* key;
+	/** the data */
+	uint8_t* data;
+	/** length of the data */
+	size_t data_len;
+	/** ttl of the data */
+	time_t ttl;
 };
 
 #define CACHEDB_HASHSIZE 256 /* bit hash */
@@ -104,6 +160,43 @@ void cachedb_clear(struct module_qstate* qstate, int id);
 /** return memory estimate for cachedb module */
 size_t cachedb_get_mem(struct module_env* env, int id);
 
+/**
+ * The asynchronous lookup of the backend for the query is done, and the
+ * query continues.  Called by the backend from the event loop.
+ * @param qstate: the query that waits for the lookup.
+ * @param id: module id of cachedb.
+ * @param buf: the data that is found, or NULL if not found.
+ */
+void cachedb_lookup_done(struct module_qstate* qstate, int id,
+	struct sldns_buffer* buf);
+
+/**
+ * Stop the cachedb work of the thread, the event base of the thread is
+ * deleted after this.  Call after the mesh of the thread is deleted.
+ * @param env: module environment of the thread.
+ * @param id: module id of cachedb.
+ */
+void cachedb_thread_stop(struct module_env* env, int id);
+
+/**
+ * Get the write-behind statistics of the thread.
+ * @param env: module environment of the thread.
+ * @param id: module id of cachedb.
+ * @param svr: the write-behind numbers are set in here.
+ * @param reset: if the counters are reset after they are read.
+ */
+void cachedb_wb_get_stats(struct module_env* env, int id,
+	struct ub_server_stats* svr, int reset);
+
+/** timer callback that answers a testframe-async lookup */
+void testframe_async_timer_cb(void* arg);
+
+/** timer callback that flushes the write-behind queue of the thread */
+void cachedb_wb_timer_cb(void* arg);
+
+/** compare two write-behind stores by key, for the rbtree */
+int cachedb_wb_cmp(const void* k1, const void* k2);
+
 /**
  * Get the function block with pointers to the cachedb functions
  * @return the function block for "cachedb".
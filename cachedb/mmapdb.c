@@ -0,0 +1,901 @@
+/*
+ * cachedb/mmapdb.c - cachedb backend in a local memory mapped file
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a cachedb backend that keeps the data in a local
+ * memory mapped file, that persists across restarts.
+ *
+ * The file has a header page, an index of slots and a data log.  The
+ * index is a hash table with open addressing, on the binary form of the
+ * key, that points to the latest record of the key in the data log.
+ * Records are appended at the tail of the log.  The threads look up
+ * at the same time, under a read lock.  There is one writer at a time:
+ * the thread that stores when no other thread is writing becomes the
+ * writer, and it also writes the stores that the other threads queue
+ * in the meantime, for a few batches.  The records of a batch are
+ * written past the tail, and the index and tail are updated for the
+ * batch at once with the write lock held.  When the file is full, the writer
+ * hands the writer role to a compaction thread, and the worker returns.
+ * That thread copies the records that are not expired to a new file,
+ * oldest first dropped if they do not fit in half the file, and swaps it
+ * in.  Lookups continue on the old map meanwhile, and stores queue up.
+ * Then it writes the queued stores and stops being the writer.
+ */
+
+#include "config.h"
+#ifdef USE_CACHEDB
+#include "cachedb/mmapdb.h"
+#include "cachedb/cachedb.h"
+#include "util/config_file.h"
+#include "util/locks.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "sldns/parseutil.h"
+#include "sldns/sbuffer.h"
+
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <ctype.h>
+
+/** magic string at the start of the file */
+#define MMAPDB_MAGIC "ubcachdb"
+/** version of the file layout */
+#define MMAPDB_VERSION 1
+/** size of the header page */
+#define MMAPDB_PAGE 4096
+/** bytes of file per index slot */
+#define MMAPDB_BYTES_PER_SLOT 512
+/** length of the binary key, the hash of the query */
+#define MMAPDB_KEYLEN (CACHEDB_HASHSIZE/8)
+/** max number of stores that wait for the writer, more are dropped */
+#define MMAPDB_MAX_PENDING 65536
+/** max number of batches the writer writes before it returns, the stores
+ * that are queued after that are written by the next store */
+#define MMAPDB_MAX_BATCHES 4
+/** round up to multiple of 8 */
+#define MMAPDB_ALIGN(x) (((x)+7)&~((size_t)7))
+
+/** header at the start of the file */
+struct mmapdb_hdr {
+	/** the magic string */
+	uint8_t magic[8];
+	/** layout version */
+	uint32_t version;
+	/** size of an index slot, to detect a different layout */
+	uint32_t slot_size;
+	/** size of the file */
+	uint64_t size;
+	/** number of index slots, a power of two */
+	uint64_t num_slots;
+	/** offset where the data log starts */
+	uint64_t data_start;
+	/** offset of the end of the data log */
+	uint64_t tail;
+	/** number of index slots in use */
+	uint64_t count;
+};
+
+/** index slot, the latest record of the key */
+struct mmapdb_slot {
+	/** the key */
+	uint8_t key[MMAPDB_KEYLEN];
+	/** offset of the record in the file, 0 if the slot is free */
+	uint64_t off;
+	/** absolute time when the data expires */
+	int64_t expire;
+	/** length of the data */
+	uint32_t len;
+	/** unused */
+	uint32_t reserved;
+};
+
+/** record in the data log, followed by the data */
+struct mmapdb_rec {
+	/** the key */
+	uint8_t key[MMAPDB_KEYLEN];
+	/** absolute time when the data expires */
+	int64_t expire;
+	/** length of the data */
+	uint32_t len;
+	/** unused */
+	uint32_t reserved;
+};
+
+/** a store that waits for the writer, followed by the data */
+struct mmapdb_store {
+	/** next in the list */
+	struct mmapdb_store* next;
+	/** the key */
+	uint8_t key[MMAPDB_KEYLEN];
+	/** absolute time when the data expires */
+	int64_t expire;
+	/** length of the data */
+	size_t len;
+	/** where the writer put the record */
+	uint64_t off;
+};
+
+/** the mmap backend data */
+struct mmapdb_moddata {
+	/** lock on the map and its index and tail.  Lookups hold it for
+	 * reading, the writer holds it for writing when it updates the
+	 * index and when it swaps the map. */
+	lock_rw_type lock;
+	/** lock on the list of stores and the writer flag */
+	lock_basic_type qlock;
+	/** stores that wait for the writer, in order of arrival */
+	struct mmapdb_store* first;
+	/** last of the stores that wait */
+	struct mmapdb_store* last;
+	/** number of stores that wait */
+	size_t num_pending;
+	/** if a thread is the writer, the compaction thread is also the
+	 * writer while it runs */
+	int writer;
+	/** if the compaction thread has been started, and has to be
+	 * joined.  Only the writer changes this. */
+	int compact_started;
+	/** the compaction thread */
+	ub_thread_type compact_tid;
+	/** the time for the compaction thread, set by the writer that
+	 * starts it */
+	time_t compact_now;
+	/** the file name, malloced */
+	char* fname;
+	/** the file descriptor */
+	int fd;
+	/** the mapped file */
+	uint8_t* map;
+	/** size of the file */
+	size_t size;
+	/** seconds after expiry that the data is kept, for serve-expired,
+	 * or -1 to keep it until there is no space left */
+	time_t grace;
+};
+
+/** convert the hex key to binary */
+static int
+mmapdb_key(const char* key, uint8_t* bin)
+{
+	size_t i;
+	if(strlen(key) != MMAPDB_KEYLEN*2)
+		return 0;
+	for(i=0; i<MMAPDB_KEYLEN; i++) {
+		if(!isxdigit((unsigned char)key[i*2]) ||
+			!isxdigit((unsigned char)key[i*2+1]))
+			return 0;
+		bin[i] = (uint8_t)(sldns_hexdigit_to_int(key[i*2])*16 +
+			sldns_hexdigit_to_int(key[i*2+1]));
+	}
+	return 1;
+}
+
+/** number of index slots for a file of the size */
+static uint64_t
+mmapdb_num_slots(size_t size)
+{
+	uint64_t n = 64;
+	while(n*2 <= (uint64_t)size/MMAPDB_BYTES_PER_SLOT)
+		n *= 2;
+	return n;
+}
+
+/** offset of the data log for the number of slots */
+static uint64_t
+mmapdb_data_start(uint64_t num_slots)
+{
+	uint64_t idx = num_slots*sizeof(struct mmapdb_slot);
+	return MMAPDB_PAGE + (idx + MMAPDB_PAGE-1)/MMAPDB_PAGE*MMAPDB_PAGE;
+}
+
+/** max number of index slots in use, before the file has to be compacted */
+static uint64_t
+mmapdb_max_count(struct mmapdb_hdr* hdr)
+{
+	return hdr->num_slots/4*3;
+}
+
+/**
+ * Find the index slot for the key.
+ * @param map: the mapped file.
+ * @param key: binary key.
+ * @param found: set true if the slot has the key, false if the slot
+ * 	is free and can be used for the key.
+ * @return the slot, or NULL if the index is full.
+ */
+static struct mmapdb_slot*
+mmapdb_find(uint8_t* map, const uint8_t* key, int* found)
+{
+	struct mmapdb_hdr* hdr = (struct mmapdb_hdr*)map;
+	struct mmapdb_slot* slots = (struct mmapdb_slot*)(map+MMAPDB_PAGE);
+	uint64_t mask = hdr->num_slots-1, h, j;
+	/* the key is a cryptographic hash, its bits are spread evenly */
+	memmove(&h, key, sizeof(h));
+	for(j=0; j<hdr->num_slots; j++) {
+		struct mmapdb_slot* s = &slots[(h+j)&mask];
+		if(s->off == 0) {
+			*found = 0;
+			return s;
+		}
+		if(memcmp(s->key, key, MMAPDB_KEYLEN) == 0) {
+			*found = 1;
+			return s;
+		}
+	}
+	*found = 0;
+	return NULL;
+}
+
+/** check the header of the file, false if it has to be made again */
+static int
+mmapdb_check_hdr(uint8_t* map, size_t size)
+{
+	struct mmapdb_hdr* hdr = (struct mmapdb_hdr*)map;
+	if(memcmp(hdr->magic, MMAPDB_MAGIC, sizeof(hdr->magic)) != 0)
+		return 0;
+	if(hdr->version != MMAPDB_VERSION ||
+		hdr->slot_size != sizeof(struct mmapdb_slot) ||
+		hdr->size != (uint64_t)size ||
+		hdr->num_slots != mmapdb_num_slots(size) ||
+		hdr->data_start != mmapdb_data_start(hdr->num_slots) ||
+		hdr->tail < hdr->data_start || hdr->tail > hdr->size ||
+		hdr->count > hdr->num_slots)
+		return 0;
+	return 1;
+}
+
+/** set up the header of an empty file, the file has just been
+ * truncated so the index is zero without touching the pages */
+static void
+mmapdb_init_hdr(uint8_t* map, size_t size)
+{
+	struct mmapdb_hdr* hdr = (struct mmapdb_hdr*)map;
+	memmove(hdr->magic, MMAPDB_MAGIC, sizeof(hdr->magic));
+	hdr->version = MMAPDB_VERSION;
+	hdr->slot_size = sizeof(struct mmapdb_slot);
+	hdr->size = size;
+	hdr->num_slots = mmapdb_num_slots(size);
+	hdr->data_start = mmapdb_data_start(hdr->num_slots);
+	hdr->tail = hdr->data_start;
+	hdr->count = 0;
+}
+
+/**
+ * Open and map the file.
+ * @param fname: file name.
+ * @param size: size of the file.
+ * @param create: if true, the file is made empty.
+ * @param fd: the file descriptor is returned.
+ * @return the map or NULL on failure, logged.
+ */
+static uint8_t*
+mmapdb_open(const char* fname, size_t size, int create, int* fd)
+{
+	struct stat st;
+	struct flock fl;
+	void* map;
+	*fd = open(fname, O_RDWR|O_CREAT|(create?O_TRUNC:0), 0600);
+	if(*fd == -1) {
+		log_err("cachedb mmap: could not open %s: %s", fname,
+			strerror(errno));
+		return NULL;
+	}
+	/* one unbound process at a time can use the file */
+	memset(&fl, 0, sizeof(fl));
+	fl.l_type = F_WRLCK;
+	fl.l_whence = SEEK_SET;
+	if(fcntl(*fd, F_SETLK, &fl) == -1) {
+		log_err("cachedb mmap: could not lock %s, is it in use by "
+			"another process? %s", fname, strerror(errno));
+		close(*fd);
+		return NULL;
+	}
+	if(fstat(*fd, &st) == -1 || (size_t)st.st_size != size) {
+		/* the file is sparse, the blocks are allocated when the
+		 * data is written */
+		if(ftruncate(*fd, (off_t)size) == -1) {
+			log_err("cachedb mmap: could not size %s: %s", fname,
+				strerror(errno));
+			close(*fd);
+			return NULL;
+		}
+	}
+	map = mmap(NULL, size, PROT_READ|PROT_WRITE, MAP_SHARED, *fd, 0);
+	if(map == MAP_FAILED) {
+		log_err("cachedb mmap: could not mmap %s: %s", fname,
+			strerror(errno));
+		close(*fd);
+		return NULL;
+	}
+	return (uint8_t*)map;
+}
+
+/** close the map */
+static void
+mmapdb_close(uint8_t* map, size_t size, int fd)
+{
+	if(msync(map, size, MS_SYNC) == -1)
+		log_err("cachedb mmap: msync: %s", strerror(errno));
+	munmap(map, size);
+	close(fd);
+}
+
+static int
+mmapdb_init(struct module_env* env, struct cachedb_env* cachedb_env)
+{
+	struct mmapdb_moddata* d;
+	struct config_file* cfg = env->cfg;
+	char* fname = cfg->cachedb_mmap_file;
+
+	verbose(VERB_ALGO, "mmapdb_init");
+	if(cfg->cachedb_mmap_size < mmapdb_data_start(64) + MMAPDB_PAGE) {
+		log_err("cachedb mmap: mmap-size is too small");
+		return 0;
+	}
+	d = (struct mmapdb_moddata*)calloc(1, sizeof(*d));
+	if(!d) {
+		log_err("out of memory");
+		return 0;
+	}
+	if(cfg->chrootdir && cfg->chrootdir[0] && strncmp(fname,
+		cfg->chrootdir, strlen(cfg->chrootdir)) == 0)
+		fname += strlen(cfg->chrootdir);
+	d->fname = strdup(fname);
+	if(!d->fname) {
+		log_err("out of memory");
+		free(d);
+		return 0;
+	}
+	d->size = cfg->cachedb_mmap_size;
+	if(!cfg->serve_expired)
+		d->grace = 0;
+	else if(cfg->serve_expired_ttl)
+		d->grace = (time_t)cfg->serve_expired_ttl;
+	else	d->grace = -1;
+	d->map = mmapdb_open(d->fname, d->size, 0, &d->fd);
+	if(d->map && !mmapdb_check_hdr(d->map, d->size)) {
+		verbose(VERB_OPS, "cachedb mmap: %s has no usable contents, "
+			"it is made empty", d->fname);
+		munmap(d->map, d->size);
+		close(d->fd);
+		d->map = mmapdb_open(d->fname, d->size, 1, &d->fd);
+		if(d->map)
+			mmapdb_init_hdr(d->map, d->size);
+	}
+	if(!d->map) {
+		free(d->fname);
+		free(d);
+		return 0;
+	}
+	verbose(VERB_OPS, "cachedb mmap: %s has %d entries",
+		d->fname, (int)((struct mmapdb_hdr*)d->map)->count);
+	lock_rw_init(&d->lock);
+	lock_basic_init(&d->qlock);
+	lock_protect(&d->qlock, &d->first, sizeof(d->first));
+	lock_protect(&d->qlock, &d->last, sizeof(d->last));
+	lock_protect(&d->qlock, &d->num_pending, sizeof(d->num_pending));
+	lock_protect(&d->qlock, &d->writer, sizeof(d->writer));
+	lock_protect(&d->qlock, &d->compact_now, sizeof(d->compact_now));
+	cachedb_env->backend_data = d;
+	return 1;
+}
+
+/** free a list of stores */
+static void
+mmapdb_store_free(struct mmapdb_store* p)
+{
+	struct mmapdb_store* np;
+	while(p) {
+		np = p->next;
+		free(p);
+		p = np;
+	}
+}
+
+static void
+mmapdb_deinit(struct module_env* env, struct cachedb_env* cachedb_env)
+{
+	struct mmapdb_moddata* d = (struct mmapdb_moddata*)
+		cachedb_env->backend_data;
+	(void)env;
+	verbose(VERB_ALGO, "mmapdb_deinit");
+	if(!d)
+		return;
+#ifndef THREADS_DISABLED
+	if(d->compact_started)
+		ub_thread_join(d->compact_tid);
+#endif
+	lock_basic_destroy(&d->qlock);
+	lock_rw_destroy(&d->lock);
+	mmapdb_store_free(d->first);
+	mmapdb_close(d->map, d->size, d->fd);
+	free(d->fname);
+	free(d);
+}
+
+static int
+mmapdb_lookup(struct module_env* env, struct cachedb_env* cachedb_env,
+	char* key, struct sldns_buffer* result_buffer)
+{
+	struct mmapdb_moddata* d = (struct mmapdb_moddata*)
+		cachedb_env->backend_data;
+	uint8_t bin[MMAPDB_KEYLEN];
+	struct mmapdb_slot* s;
+	struct mmapdb_rec* rec;
+	struct mmapdb_hdr* hdr;
+	int found;
+	if(!mmapdb_key(key, bin))
+		return 0;
+	lock_rw_rdlock(&d->lock);
+	hdr = (struct mmapdb_hdr*)d->map;
+	s = mmapdb_find(d->map, bin, &found);
+	if(!s || !found || (d->grace != -1 &&
+		(time_t)s->expire + d->grace < *env->now) ||
+		s->off < hdr->data_start || s->off > hdr->tail ||
+		s->off + sizeof(*rec) > hdr->tail ||
+		s->len > hdr->tail - s->off - sizeof(*rec) ||
+		s->len > sldns_buffer_capacity(result_buffer)) {
+		lock_rw_unlock(&d->lock);
+		return 0;
+	}
+	rec = (struct mmapdb_rec*)(d->map + s->off);
+	if(rec->len != s->len || memcmp(rec->key, bin, MMAPDB_KEYLEN) != 0) {
+		lock_rw_unlock(&d->lock);
+		return 0;
+	}
+	sldns_buffer_clear(result_buffer);
+	sldns_buffer_write(result_buffer, (uint8_t*)rec + sizeof(*rec),
+		rec->len);
+	sldns_buffer_flip(result_buffer);
+	lock_rw_unlock(&d->lock);
+	verbose(VERB_ALGO, "mmapdb_lookup found %d bytes", (int)s->len);
+	return 1;
+}
+
+/** if the record in the log is the latest of its key and is not expired,
+ * and the index agrees with the record */
+static int
+mmapdb_live(struct mmapdb_moddata* d, struct mmapdb_rec* rec, uint64_t off,
+	time_t now)
+{
+	int found;
+	struct mmapdb_slot* s = mmapdb_find(d->map, rec->key, &found);
+	if(!s || !found || s->off != off || s->len != rec->len ||
+		s->expire != rec->expire)
+		return 0;
+	if(d->grace != -1 && (time_t)rec->expire + d->grace < now)
+		return 0;
+	return 1;
+}
+
+/**
+ * Size of the record in the log, checked against the tail, the length is
+ * read from the file.
+ * @param hdr: header of the file.
+ * @param map: the mapped file.
+ * @param off: offset of the record, with room for the record before the
+ * 	tail.
+ * @return the size of the record, aligned, or 0 if the record does not
+ * 	fit in the log, the log is corrupt from there on.
+ */
+static size_t
+mmapdb_rec_size(struct mmapdb_hdr* hdr, uint8_t* map, uint64_t off)
+{
+	struct mmapdb_rec* rec = (struct mmapdb_rec*)(map + off);
+	if(rec->len > hdr->tail - off - sizeof(*rec))
+		return 0;
+	return MMAPDB_ALIGN(sizeof(*rec) + rec->len);
+}
+
+/**
+ * Compact the file.  The latest records that are not expired are copied
+ * to a new file, that replaces the file.  If they take more than half of
+ * the space, the oldest are dropped.  If the log is corrupt, the records
+ * from there on are dropped.  Called by the compaction thread, that is
+ * the writer, so the map does not change under it and it reads it
+ * without the lock.
+ * @return false on failure, the file is not changed.
+ */
+static int
+mmapdb_compact(struct mmapdb_moddata* d, time_t now)
+{
+	struct mmapdb_hdr* hdr = (struct mmapdb_hdr*)d->map, *nhdr;
+	uint64_t off, live = 0, live_count = 0, skip = 0, skip_count = 0;
+	uint64_t budget, budget_count;
+	struct mmapdb_rec* rec;
+	struct mmapdb_slot* s;
+	char tmpname[1024];
+	uint8_t* nmap, *omap;
+	int nfd, ofd, found;
+	size_t need;
+
+	snprintf(tmpname, sizeof(tmpname), "%s.new", d->fname);
+	nmap = mmapdb_open(tmpname, d->size, 1, &nfd);
+	if(!nmap)
+		return 0;
+	mmapdb_init_hdr(nmap, d->size);
+	nhdr = (struct mmapdb_hdr*)nmap;
+
+	/* the log is in order of arrival, see how many of the oldest
+	 * records have to go */
+	for(off = hdr->data_start; off + sizeof(*rec) <= hdr->tail;
+		off += need) {
+		rec = (struct mmapdb_rec*)(d->map + off);
+		if((need = mmapdb_rec_size(hdr, d->map, off)) == 0) {
+			verbose(VERB_OPS, "cachedb mmap: %s is corrupt at "
+				"offset %llu, the records from there are "
+				"dropped", d->fname, (unsigned long long)off);
+			break;
+		}
+		if(mmapdb_live(d, rec, off, now)) {
+			live += need;
+			live_count++;
+		}
+	}
+	budget = (nhdr->size - nhdr->data_start)/2;
+	budget_count = mmapdb_max_count(nhdr)/2;
+	if(live > budget)
+		skip = live - budget;
+	if(live_count > budget_count)
+		skip_count = live_count - budget_count;
+
+	for(off = hdr->data_start; off + sizeof(*rec) <= hdr->tail;
+		off += need) {
+		rec = (struct mmapdb_rec*)(d->map + off);
+		if((need = mmapdb_rec_size(hdr, d->map, off)) == 0)
+			break;
+		if(!mmapdb_live(d, rec, off, now))
+			continue;
+		if(skip > 0 || skip_count > 0) {
+			skip = (skip > need)?skip - need:0;
+			if(skip_count > 0)
+				skip_count--;
+			continue;
+		}
+		s = mmapdb_find(nmap, rec->key, &found);
+		if(!s || nhdr->tail + need > nhdr->size)
+			break;
+		memmove(nmap + nhdr->tail, rec, sizeof(*rec) + rec->len);
+		memmove(s->key, rec->key, MMAPDB_KEYLEN);
+		s->off = nhdr->tail;
+		s->expire = rec->expire;
+		s->len = rec->len;
+		nhdr->tail += need;
+		nhdr->count++;
+	}
+	/* the writer does not wait for the disk, the records are checked
+	 * when they are read, and if the system stops before the pages are
+	 * written the next start finds a file that it makes empty, or
+	 * with records that fail the checks */
+	if(msync(nmap, d->size, MS_ASYNC) == -1 ||
+		rename(tmpname, d->fname) == -1) {
+		log_err("cachedb mmap: could not replace %s: %s", d->fname,
+			strerror(errno));
+		munmap(nmap, d->size);
+		close(nfd);
+		unlink(tmpname);
+		return 0;
+	}
+	verbose(VERB_ALGO, "cachedb mmap: compacted %d entries to %d",
+		(int)hdr->count, (int)nhdr->count);
+
+	lock_rw_wrlock(&d->lock);
+	omap = d->map;
+	ofd = d->fd;
+	d->map = nmap;
+	d->fd = nfd;
+	lock_rw_unlock(&d->lock);
+	munmap(omap, d->size);
+	close(ofd);
+	return 1;
+}
+
+/** make the records from first up to last visible in the index */
+static void
+mmapdb_publish(struct mmapdb_moddata* d, struct mmapdb_store* first,
+	struct mmapdb_store* last, uint64_t tail)
+{
+	struct mmapdb_hdr* hdr = (struct mmapdb_hdr*)d->map;
+	struct mmapdb_store* p;
+	struct mmapdb_slot* s;
+	int found;
+	lock_rw_wrlock(&d->lock);
+	for(p = first; p != last; p = p->next) {
+		s = mmapdb_find(d->map, p->key, &found);
+		if(!s)
+			continue;
+		if(!found) {
+			memmove(s->key, p->key, MMAPDB_KEYLEN);
+			hdr->count++;
+		}
+		s->expire = p->expire;
+		s->len = (uint32_t)p->len;
+		s->off = p->off;
+	}
+	hdr->tail = tail;
+	lock_rw_unlock(&d->lock);
+}
+
+/**
+ * Write a batch of stores, this is the group commit of the writer.  The
+ * records are appended to the log and made visible together.
+ * @param d: backend data.
+ * @param list: the stores, the ones that are written or dropped are freed
+ * 	by the function.
+ * @param compacted: true if the file has just been compacted, a store
+ * 	that does not fit then is dropped.  Set to false when records are
+ * 	written.
+ * @return the stores that do not fit until the file is compacted, or NULL
+ * 	if all are done.
+ */
+static struct mmapdb_store*
+mmapdb_commit(struct mmapdb_moddata* d, struct mmapdb_store* list,
+	int* compacted)
+{
+	struct mmapdb_store* p = list, *start, *np;
+	struct mmapdb_hdr* hdr;
+	struct mmapdb_rec* rec;
+	uint64_t tail, added;
+	size_t need;
+	while(p) {
+		/* the writer is the only one that changes the map pointer */
+		hdr = (struct mmapdb_hdr*)d->map;
+		start = p;
+		tail = hdr->tail;
+		added = 0;
+		while(p) {
+			need = MMAPDB_ALIGN(sizeof(*rec) + p->len);
+			if(tail + need > hdr->size ||
+				hdr->count + added >= mmapdb_max_count(hdr))
+				break;
+			/* past the tail, lookups do not look here */
+			rec = (struct mmapdb_rec*)(d->map + tail);
+			memmove(rec->key, p->key, MMAPDB_KEYLEN);
+			rec->expire = p->expire;
+			rec->len = (uint32_t)p->len;
+			rec->reserved = 0;
+			memmove((uint8_t*)rec + sizeof(*rec), (uint8_t*)p +
+				sizeof(*p), p->len);
+			p->off = tail;
+			tail += need;
+			added++;
+			p = p->next;
+		}
+		if(start != p) {
+			mmapdb_publish(d, start, p, tail);
+			*compacted = 0;
+		}
+		if(!p || !*compacted)
+			break;
+		/* no space for it, right after the compaction */
+		verbose(VERB_ALGO, "cachedb mmap: no space, store dropped");
+		p = p->next;
+		*compacted = 0;
+	}
+	if(msync(d->map, d->size, MS_ASYNC) == -1)
+		log_err("cachedb mmap: msync: %s", strerror(errno));
+	/* free the stores before p, the rest waits for the compaction */
+	for(np = list; np != p; np = start) {
+		start = np->next;
+		free(np);
+	}
+	return p;
+}
+
+/**
+ * The compaction thread.  It is the writer while it runs.  It compacts
+ * the file, and then writes the stores that wait, compacting again if
+ * they fill the file.  It stops when no stores wait.
+ * @param arg: the backend data.
+ */
+static void*
+mmapdb_compact_thread(void* arg)
+{
+	struct mmapdb_moddata* d = (struct mmapdb_moddata*)arg;
+	struct mmapdb_store* list, *rest = NULL;
+	int compacted;
+	time_t now;
+	lock_basic_lock(&d->qlock);
+	now = d->compact_now;
+	lock_basic_unlock(&d->qlock);
+	verbose(VERB_ALGO, "cachedb mmap: compaction started");
+	while(1) {
+		compacted = mmapdb_compact(d, now);
+		lock_basic_lock(&d->qlock);
+		if(!compacted) {
+			/* drop the stores that wait, there is no space */
+			verbose(VERB_ALGO, "cachedb mmap: no space, %d stores "
+				"dropped", (int)d->num_pending);
+			rest = d->first;
+			d->first = NULL;
+			d->last = NULL;
+			d->num_pending = 0;
+		}
+		while(d->first) {
+			list = d->first;
+			d->first = NULL;
+			d->last = NULL;
+			d->num_pending = 0;
+			lock_basic_unlock(&d->qlock);
+			list = mmapdb_commit(d, list, &compacted);
+			lock_basic_lock(&d->qlock);
+			if(list) {
+				/* put them back in front, and compact */
+				struct mmapdb_store* p = list;
+				size_t n = 1;
+				while(p->next) {
+					p = p->next;
+					n++;
+				}
+				p->next = d->first;
+				if(!d->first)
+					d->last = p;
+				d->first = list;
+				d->num_pending += n;
+				break;
+			}
+		}
+		if(!d->first)
+			break;
+		lock_basic_unlock(&d->qlock);
+	}
+	d->writer = 0;
+	lock_basic_unlock(&d->qlock);
+	mmapdb_store_free(rest);
+	verbose(VERB_ALGO, "cachedb mmap: compaction done");
+	return NULL;
+}
+
+/**
+ * Start the compaction thread, it takes over the writer role from the
+ * caller.  Without threads the compaction is done here.
+ * @param d: backend data.
+ * @param now: the time.
+ */
+static void
+mmapdb_compact_start(struct mmapdb_moddata* d, time_t now)
+{
+#ifndef THREADS_DISABLED
+	/* the previous compaction thread has stopped being the writer,
+	 * it is finished or about to return */
+	if(d->compact_started)
+		ub_thread_join(d->compact_tid);
+	lock_basic_lock(&d->qlock);
+	d->compact_now = now;
+	d->compact_started = 1;
+	lock_basic_unlock(&d->qlock);
+	ub_thread_create(&d->compact_tid, mmapdb_compact_thread, d);
+#else
+	d->compact_now = now;
+	(void)mmapdb_compact_thread(d);
+#endif
+}
+
+void
+mmapdb_compact_wait(struct cachedb_env* cachedb_env)
+{
+	struct mmapdb_moddata* d = (struct mmapdb_moddata*)
+		cachedb_env->backend_data;
+#ifndef THREADS_DISABLED
+	if(d->compact_started) {
+		ub_thread_join(d->compact_tid);
+		d->compact_started = 0;
+	}
+#else
+	(void)d;
+#endif
+}
+
+static void
+mmapdb_store(struct module_env* env, struct cachedb_env* cachedb_env,
+	char* key, uint8_t* data, size_t data_len, time_t ttl)
+{
+	struct mmapdb_moddata* d = (struct mmapdb_moddata*)
+		cachedb_env->backend_data;
+	struct mmapdb_store* p, *list;
+	int i, compacted = 0;
+	if(data_len > 0xffffffff)
+		return;
+	p = (struct mmapdb_store*)malloc(sizeof(*p) + data_len);
+	if(!p) {
+		log_err("out of memory");
+		return;
+	}
+	if(!mmapdb_key(key, p->key)) {
+		free(p);
+		return;
+	}
+	p->next = NULL;
+	p->expire = (int64_t)(*env->now + ttl);
+	p->len = data_len;
+	p->off = 0;
+	memmove((uint8_t*)p + sizeof(*p), data, data_len);
+
+	lock_basic_lock(&d->qlock);
+	if(d->num_pending >= MMAPDB_MAX_PENDING) {
+		lock_basic_unlock(&d->qlock);
+		verbose(VERB_ALGO, "cachedb mmap: writer busy, store dropped");
+		free(p);
+		return;
+	}
+	if(d->last)
+		d->last->next = p;
+	else	d->first = p;
+	d->last = p;
+	d->num_pending++;
+	if(d->writer) {
+		/* the writer picks it up with its next batch */
+		lock_basic_unlock(&d->qlock);
+		return;
+	}
+	d->writer = 1;
+	for(i=0; d->first && i<MMAPDB_MAX_BATCHES; i++) {
+		list = d->first;
+		d->first = NULL;
+		d->last = NULL;
+		d->num_pending = 0;
+		lock_basic_unlock(&d->qlock);
+		list = mmapdb_commit(d, list, &compacted);
+		lock_basic_lock(&d->qlock);
+		if(list) {
+			/* the file is full, the stores that did not fit
+			 * wait in front for the compaction thread, that
+			 * stays the writer until it is done */
+			for(p = list; p->next; p = p->next)
+				d->num_pending++;
+			d->num_pending++;
+			p->next = d->first;
+			if(!d->first)
+				d->last = p;
+			d->first = list;
+			lock_basic_unlock(&d->qlock);
+			mmapdb_compact_start(d, *env->now);
+			return;
+		}
+	}
+	d->writer = 0;
+	lock_basic_unlock(&d->qlock);
+}
+
+struct cachedb_backend mmapdb_backend = { "mmap",
+	mmapdb_init, mmapdb_deinit, mmapdb_lookup, mmapdb_store,
+	NULL, NULL, NULL, NULL
+};
+#endif /* HAVE_SYS_MMAN_H */
+#endif /* USE_CACHEDB */
@@ -46,10 +46,23 @@
 #include "cachedb/cachedb.h"
 #include "util/alloc.h"
 #include "util/config_file.h"
+#include "util/netevent.h"
+#include "util/ub_event.h"
+#include "util/net_help.h"
 #include "sldns/sbuffer.h"
 
 #ifdef USE_REDIS
 #include "hiredis/hiredis.h"
+#include "hiredis/async.h"
+
+/** seconds to wait before a new connection attempt for the asynchronous
+ * connection, after it failed or timed out */
+#define REDIS_ASYNC_RETRY 1
+/** max number of lookups pending on the asynchronous connection of a
+ * thread, more lookups are a cache miss */
+#define REDIS_ASYNC_MAX_PENDING 1024
+
+struct redis_async;
 
 struct redis_moddata {
 	redisContext** ctxs;	/* thread-specific redis contexts */
@@ -57,6 +70,55 @@ struct redis_moddata {
 	const char* server_host; /* server's IP address or host name */
 	int server_port;	 /* server's TCP port */
 	struct timeval timeout;	 /* timeout for connection setup and commands */
+	struct redis_async** actxs; /* thread-specific async connections */
+};
+
+/**
+ * A lookup on the asynchronous connection.  The replies of redis come in
+ * order, so the lookups are kept in a list in the order they are sent.
+ */
+struct redis_async_req {
+	/** next in list */
+	struct redis_async_req* next;
+	/** prev in list */
+	struct redis_async_req* prev;
+	/** the query, or NULL if it is cancelled */
+	struct module_qstate* qstate;
+	/** module id */
+	int id;
+	/** time at which the lookup times out */
+	struct timeval deadline;
+};
+
+/**
+ * The asynchronous redis connection of a thread.  It uses the event base
+ * of the worker, and the GET and SET commands are pipelined on it.
+ */
+struct redis_async {
+	/** the module environment of the thread */
+	struct module_env* env;
+	/** the backend data */
+	struct redis_moddata* d;
+	/** the hiredis context, or NULL if not connected */
+	redisAsyncContext* ac;
+	/** the event for the socket of the context */
+	struct ub_event* ev;
+	/** if hiredis wants to read, and to write */
+	int reading, writing;
+	/** timer for the timeout of the oldest lookup */
+	struct comm_timer* timer;
+	/** the lookups that wait for a reply, oldest first */
+	struct redis_async_req* first, *last;
+	/** number of lookups in the list */
+	size_t num_pending;
+	/** number of stores that wait for a reply */
+	size_t num_stores;
+	/** if the event is added */
+	int ev_added;
+	/** if the thread stops, the lookups are not continued */
+	int stopping;
+	/** no new connection attempt before this time */
+	time_t retry_time;
 };
 
 static redisReply* redis_command(struct module_env*, struct cachedb_env*,
@@ -91,7 +153,6 @@ redis_connect(const struct redis_moddata* moddata)
 static int
 redis_init(struct module_env* env, struct cachedb_env* cachedb_env)
 {
-	int i;
 	struct redis_moddata* moddata = NULL;
 
 	verbose(VERB_ALGO, "redis_init");
@@ -108,14 +169,23 @@ redis_init(struct module_env* env, struct cachedb_env* cachedb_env)
 		free(moddata);
 		return 0;
 	}
+	moddata->actxs = calloc(env->cfg->num_threads,
+		sizeof(struct redis_async*));
+	if(!moddata->actxs) {
+		log_err("out of memory");
+		free(moddata->ctxs);
+		free(moddata);
+		return 0;
+	}
 	/* note: server_host is a shallow reference to configured string.
 	 * we don't have to free it in this module. */
 	moddata->server_host = env->cfg->redis_server_host;
 	moddata->server_port = env->cfg->redis_server_port;
 	moddata->timeout.tv_sec = env->cfg->redis_timeout / 1000;
 	moddata->timeout.tv_usec = (env->cfg->redis_timeout % 1000) * 1000;
-	for(i = 0; i < moddata->numctxs; i++)
-		moddata->ctxs[i] = redis_connect(moddata);
+	/* the worker threads use the asynchronous connections, made on
+	 * the first lookup; the blocking connections, for use without an
+	 * event base, are made when they are needed. */
 	cachedb_env->backend_data = moddata;
 	if(env->cfg->redis_expire_records) {
 		redisReply* rep = NULL;
@@ -166,6 +236,8 @@ redis_deinit(struct module_env* env, struct cachedb_env* cachedb_env)
 		}
 		free(moddata->ctxs);
 	}
+	/* the asynchronous connections are closed by thread_stop */
+	free(moddata->actxs);
 	free(moddata);
 }
 
@@ -181,14 +253,16 @@ redis_deinit(struct module_env* env, struct cachedb_env* cachedb_env)
  * level error happens.  The caller is responsible to check the return value,
  * if it's non-NULL, it has to free it with freeReplyObject().
  */
-static redisReply*
-redis_command(struct module_env* env, struct cachedb_env* cachedb_env,
-	const char* command, const uint8_t* data, size_t data_len)
+/*
+ * Get the redis context of the thread.  If we've not established a
+ * connection to the server or we've closed it on a failure, try to
+ * re-establish a new one.  Returns NULL if there is no connection,
+ * failures are logged in redis_connect().
+ */
+static redisContext*
+redis_get_ctx(struct module_env* env, struct redis_moddata* d)
 {
 	redisContext* ctx;
-	redisReply* rep;
-	struct redis_moddata* d = (struct redis_moddata*)
-		cachedb_env->backend_data;
 
 	/* We assume env->alloc->thread_num is a unique ID for each thread
 	 * in [0, num-of-threads).  We could treat it as an error condition
@@ -197,14 +271,23 @@ redis_command(struct module_env* env, struct cachedb_env* cachedb_env,
 	 * it. */
 	log_assert(env->alloc->thread_num < d->numctxs);
 	ctx = d->ctxs[env->alloc->thread_num];
-
-	/* If we've not established a connection to the server or we've closed
-	 * it on a failure, try to re-establish a new one.   Failures will be
-	 * logged in redis_connect(). */
 	if(!ctx) {
 		ctx = redis_connect(d);
 		d->ctxs[env->alloc->thread_num] = ctx;
 	}
+	return ctx;
+}
+
+static redisReply*
+redis_command(struct module_env* env, struct cachedb_env* cachedb_env,
+	const char* command, const uint8_t* data, size_t data_len)
+{
+	redisContext* ctx;
+	redisReply* rep;
+	struct redis_moddata* d = (struct redis_moddata*)
+		cachedb_env->backend_data;
+
+	ctx = redis_get_ctx(env, d);
 	if(!ctx)
 		return NULL;
 
@@ -229,6 +312,426 @@ redis_command(struct module_env* env, struct cachedb_env* cachedb_env,
 	return rep;
 }
 
+/** set the event bits on the event that hiredis wants */
+static void
+redis_async_update_event(struct redis_async* ra)
+{
+	if(!ra->ev)
+		return;
+	if(ra->ev_added) {
+		if(ub_event_del(ra->ev) != 0)
+			log_err("redis: could not event_del");
+		ra->ev_added = 0;
+	}
+	ub_event_del_bits(ra->ev, UB_EV_READ|UB_EV_WRITE);
+	if(ra->reading)
+		ub_event_add_bits(ra->ev, UB_EV_READ);
+	if(ra->writing)
+		ub_event_add_bits(ra->ev, UB_EV_WRITE);
+	if(ra->reading || ra->writing) {
+		if(ub_event_add(ra->ev, NULL) != 0)
+			log_err("redis: could not event_add");
+		else	ra->ev_added = 1;
+	}
+}
+
+/** hiredis event hook to read */
+static void
+redis_async_add_read(void* privdata)
+{
+	struct redis_async* ra = (struct redis_async*)privdata;
+	ra->reading = 1;
+	redis_async_update_event(ra);
+}
+
+/** hiredis event hook to stop read */
+static void
+redis_async_del_read(void* privdata)
+{
+	struct redis_async* ra = (struct redis_async*)privdata;
+	ra->reading = 0;
+	redis_async_update_event(ra);
+}
+
+/** hiredis event hook to write */
+static void
+redis_async_add_write(void* privdata)
+{
+	struct redis_async* ra = (struct redis_async*)privdata;
+	ra->writing = 1;
+	redis_async_update_event(ra);
+}
+
+/** hiredis event hook to stop write */
+static void
+redis_async_del_write(void* privdata)
+{
+	struct redis_async* ra = (struct redis_async*)privdata;
+	ra->writing = 0;
+	redis_async_update_event(ra);
+}
+
+/** hiredis event hook when the context is freed */
+static void
+redis_async_cleanup(void* privdata)
+{
+	struct redis_async* ra = (struct redis_async*)privdata;
+	if(!ra->ev)
+		return;
+	if(ra->ev_added)
+		(void)ub_event_del(ra->ev);
+	ub_event_free(ra->ev);
+	ra->ev = NULL;
+	ra->ev_added = 0;
+	ra->reading = 0;
+	ra->writing = 0;
+}
+
+void
+redis_async_event_cb(int ATTR_UNUSED(fd), short bits, void* arg)
+{
+	struct redis_async* ra = (struct redis_async*)arg;
+	ub_comm_base_now(ra->env->worker_base);
+	/* the callbacks set ra->ac to NULL if the context is freed */
+	if((bits&UB_EV_READ) && ra->ac)
+		redisAsyncHandleRead(ra->ac);
+	if((bits&UB_EV_WRITE) && ra->ac)
+		redisAsyncHandleWrite(ra->ac);
+}
+
+/** the context is gone, wait a while before connecting again */
+static void
+redis_async_lost(struct redis_async* ra, const redisAsyncContext* ac)
+{
+	if(ra->ac != ac)
+		return;
+	ra->ac = NULL;
+	ra->retry_time = *ra->env->now + REDIS_ASYNC_RETRY;
+}
+
+/** hiredis callback when the connection is made, or failed */
+static void
+redis_async_connect_cb(const redisAsyncContext* ac, int status)
+{
+	struct redis_async* ra = (struct redis_async*)ac->data;
+	if(status != REDIS_OK) {
+		log_err("failed to connect to redis server: %s", ac->errstr);
+		/* hiredis frees the context */
+		redis_async_lost(ra, ac);
+		return;
+	}
+	verbose(VERB_ALGO, "redis: connected to server");
+}
+
+/** hiredis callback when the connection is closed */
+static void
+redis_async_disconnect_cb(const redisAsyncContext* ac, int status)
+{
+	struct redis_async* ra = (struct redis_async*)ac->data;
+	if(status != REDIS_OK)
+		log_err("redis: connection lost: %s", ac->errstr);
+	redis_async_lost(ra, ac);
+}
+
+/** set the timer for the timeout of the oldest lookup */
+static void
+redis_async_set_timer(struct redis_async* ra)
+{
+	struct timeval tv;
+	long long usec;
+	if(!ra->first) {
+		comm_timer_disable(ra->timer);
+		return;
+	}
+	usec = ((long long)ra->first->deadline.tv_sec -
+		(long long)ra->env->now_tv->tv_sec)*1000000 +
+		((long long)ra->first->deadline.tv_usec -
+		(long long)ra->env->now_tv->tv_usec);
+	if(usec < 0)
+		usec = 0;
+	tv.tv_sec = (time_t)(usec/1000000);
+	tv.tv_usec = (suseconds_t)(usec%1000000);
+	comm_timer_set(ra->timer, &tv);
+}
+
+/** close the asynchronous connection, the lookups on it are a miss */
+static void
+redis_async_close(struct redis_async* ra)
+{
+	redisAsyncContext* ac = ra->ac;
+	redis_async_lost(ra, ac);
+	/* calls the callbacks of the pending commands */
+	if(ac)
+		redisAsyncFree(ac);
+}
+
+void
+redis_async_timeout_cb(void* arg)
+{
+	struct redis_async* ra = (struct redis_async*)arg;
+	struct redis_async_req* req = ra->first;
+	if(!req)
+		return;
+	if(req->deadline.tv_sec > ra->env->now_tv->tv_sec ||
+		(req->deadline.tv_sec == ra->env->now_tv->tv_sec &&
+		req->deadline.tv_usec > ra->env->now_tv->tv_usec)) {
+		redis_async_set_timer(ra);
+		return;
+	}
+	verbose(VERB_OPS, "redis: lookup timed out, closing connection "
+		"with %d pending lookups", (int)ra->num_pending);
+	redis_async_close(ra);
+}
+
+/** get the asynchronous connection state of the thread */
+static struct redis_async*
+redis_async_get(struct module_env* env, struct redis_moddata* d)
+{
+	struct redis_async* ra;
+	log_assert(env->alloc->thread_num < d->numctxs);
+	ra = d->actxs[env->alloc->thread_num];
+	if(ra)
+		return ra;
+	ra = (struct redis_async*)calloc(1, sizeof(*ra));
+	if(!ra) {
+		log_err("out of memory");
+		return NULL;
+	}
+	ra->env = env;
+	ra->d = d;
+	ra->timer = comm_timer_create(env->worker_base,
+		redis_async_timeout_cb, ra);
+	if(!ra->timer) {
+		log_err("out of memory");
+		free(ra);
+		return NULL;
+	}
+	d->actxs[env->alloc->thread_num] = ra;
+	return ra;
+}
+
+/** connect the asynchronous connection if it is not connected,
+ * returns false if there is no connection */
+static int
+redis_async_connect(struct redis_async* ra)
+{
+	redisAsyncContext* ac;
+	if(ra->ac)
+		return 1;
+	if(*ra->env->now < ra->retry_time)
+		return 0;
+	ac = redisAsyncConnect(ra->d->server_host, ra->d->server_port);
+	if(!ac || ac->err) {
+		log_err("failed to connect to redis server: %s",
+			ac?ac->errstr:"out of memory");
+		if(ac)
+			redisAsyncFree(ac);
+		ra->retry_time = *ra->env->now + REDIS_ASYNC_RETRY;
+		return 0;
+	}
+	ra->ev = ub_event_new(comm_base_internal(ra->env->worker_base),
+		ac->c.fd, UB_EV_PERSIST, redis_async_event_cb, ra);
+	if(!ra->ev) {
+		log_err("redis: could not create event");
+		redisAsyncFree(ac);
+		ra->retry_time = *ra->env->now + REDIS_ASYNC_RETRY;
+		return 0;
+	}
+	ra->ev_added = 0;
+	ra->reading = 0;
+	ra->writing = 0;
+	ac->data = ra;
+	ac->ev.data = ra;
+	ac->ev.addRead = redis_async_add_read;
+	ac->ev.delRead = redis_async_del_read;
+	ac->ev.addWrite = redis_async_add_write;
+	ac->ev.delWrite = redis_async_del_write;
+	ac->ev.cleanup = redis_async_cleanup;
+	/* set after the event hooks, it waits for the socket to write */
+	redisAsyncSetConnectCallback(ac, redis_async_connect_cb);
+	redisAsyncSetDisconnectCallback(ac, redis_async_disconnect_cb);
+	ra->ac = ac;
+	return 1;
+}
+
+/** hiredis callback with the reply to a GET */
+static void
+redis_async_lookup_cb(redisAsyncContext* ac, void* r, void* privdata)
+{
+	struct redis_async_req* req = (struct redis_async_req*)privdata;
+	struct redis_async* ra = (struct redis_async*)ac->data;
+	redisReply* rep = (redisReply*)r;
+	struct module_qstate* qstate = req->qstate;
+	struct sldns_buffer* buf = NULL;
+	int id = req->id, was_first = (ra->first == req);
+
+	if(req->prev)
+		req->prev->next = req->next;
+	else	ra->first = req->next;
+	if(req->next)
+		req->next->prev = req->prev;
+	else	ra->last = req->prev;
+	ra->num_pending--;
+	free(req);
+	if(!rep)
+		redis_async_lost(ra, ac);
+	if(was_first)
+		redis_async_set_timer(ra);
+	if(!qstate || ra->stopping)
+		return;
+
+	if(!rep) {
+		verbose(VERB_ALGO, "redis_lookup: no reply, connection closed");
+	} else if(rep->type == REDIS_REPLY_STRING) {
+		verbose(VERB_ALGO, "redis_lookup found %d bytes",
+			(int)rep->len);
+		buf = qstate->env->scratch_buffer;
+		if((size_t)rep->len > sldns_buffer_capacity(buf)) {
+			log_err("redis_lookup: replied data too long: %lu",
+				(size_t)rep->len);
+			buf = NULL;
+		} else {
+			sldns_buffer_clear(buf);
+			sldns_buffer_write(buf, rep->str, rep->len);
+			sldns_buffer_flip(buf);
+		}
+	} else if(rep->type == REDIS_REPLY_NIL) {
+		verbose(VERB_ALGO, "redis_lookup: no data cached");
+	} else if(rep->type == REDIS_REPLY_ERROR) {
+		log_err("redis: get resulted in an error: %s", rep->str);
+	} else {
+		log_err("redis_lookup: unexpected type of reply for (%d)",
+			rep->type);
+	}
+	/* hiredis frees the reply after the callback */
+	cachedb_lookup_done(qstate, id, buf);
+}
+
+/** hiredis callback with the reply to a SET */
+static void
+redis_async_store_cb(redisAsyncContext* ac, void* r, void* ATTR_UNUSED(privdata))
+{
+	struct redis_async* ra = (struct redis_async*)ac->data;
+	redisReply* rep = (redisReply*)r;
+	ra->num_stores--;
+	if(!rep) {
+		redis_async_lost(ra, ac);
+		return;
+	}
+	verbose(VERB_ALGO, "redis_store set completed");
+	if(rep->type == REDIS_REPLY_ERROR)
+		log_err("redis: set resulted in an error: %s", rep->str);
+	else if(rep->type != REDIS_REPLY_STATUS)
+		log_err("redis_store: unexpected type of reply (%d)",
+			rep->type);
+}
+
+static int
+redis_lookup_start(struct module_env* env, struct cachedb_env* cachedb_env,
+	char* key, struct module_qstate* qstate, int id, void** r)
+{
+	struct redis_moddata* d = (struct redis_moddata*)
+		cachedb_env->backend_data;
+	struct redis_async* ra = redis_async_get(env, d);
+	struct redis_async_req* req;
+
+	verbose(VERB_ALGO, "redis_lookup_start of %s", key);
+	if(!ra)
+		return 0;
+	if(ra->num_pending >= REDIS_ASYNC_MAX_PENDING) {
+		verbose(VERB_ALGO, "redis_lookup_start: too many lookups "
+			"pending, skipped");
+		return 0;
+	}
+	if(!redis_async_connect(ra))
+		return 0;
+	req = (struct redis_async_req*)calloc(1, sizeof(*req));
+	if(!req) {
+		log_err("out of memory");
+		return 0;
+	}
+	if(redisAsyncCommand(ra->ac, redis_async_lookup_cb, req, "GET %s",
+		key) != REDIS_OK) {
+		verbose(VERB_ALGO, "redis_lookup_start: could not send "
+			"command");
+		free(req);
+		return 0;
+	}
+	req->qstate = qstate;
+	req->id = id;
+	req->deadline = *env->now_tv;
+	req->deadline.tv_sec += d->timeout.tv_sec;
+	req->deadline.tv_usec += d->timeout.tv_usec;
+	if(req->deadline.tv_usec >= 1000000) {
+		req->deadline.tv_sec++;
+		req->deadline.tv_usec -= 1000000;
+	}
+	req->prev = ra->last;
+	if(ra->last)
+		ra->last->next = req;
+	else	ra->first = req;
+	ra->last = req;
+	ra->num_pending++;
+	if(ra->first == req)
+		redis_async_set_timer(ra);
+	*r = req;
+	return 1;
+}
+
+static void
+redis_lookup_cancel(struct module_env* ATTR_UNUSED(env),
+	struct cachedb_env* ATTR_UNUSED(cachedb_env), void* r)
+{
+	struct redis_async_req* req = (struct redis_async_req*)r;
+	/* the request is freed when its reply, or the close, arrives */
+	req->qstate = NULL;
+}
+
+static void
+redis_thread_stop(struct module_env* env, struct cachedb_env* cachedb_env)
+{
+	struct redis_moddata* d = (struct redis_moddata*)
+		cachedb_env->backend_data;
+	struct redis_async* ra;
+	if(!d || !d->actxs)
+		return;
+	log_assert(env->alloc->thread_num < d->numctxs);
+	ra = d->actxs[env->alloc->thread_num];
+	if(!ra)
+		return;
+	ra->stopping = 1;
+	redis_async_close(ra);
+	comm_timer_delete(ra->timer);
+	free(ra);
+	d->actxs[env->alloc->thread_num] = NULL;
+}
+
+/** send the SET on the asynchronous connection, pipelined with the
+ * other commands; the store is dropped if redis is not keeping up */
+static void
+redis_async_store(struct module_env* env, struct redis_moddata* d,
+	const char* cmdbuf, uint8_t* data, size_t data_len)
+{
+	struct redis_async* ra = redis_async_get(env, d);
+	if(!ra)
+		return;
+	if(ra->num_stores >= REDIS_ASYNC_MAX_PENDING) {
+		verbose(VERB_ALGO, "redis_store: too many stores pending, "
+			"dropped");
+		return;
+	}
+	if(!redis_async_connect(ra)) {
+		verbose(VERB_ALGO, "redis_store: no connection, dropped");
+		return;
+	}
+	if(redisAsyncCommand(ra->ac, redis_async_store_cb, NULL, cmdbuf,
+		data, data_len) != REDIS_OK) {
+		verbose(VERB_ALGO, "redis_store: could not send command");
+		return;
+	}
+	ra->num_stores++;
+}
+
 static int
 redis_lookup(struct module_env* env, struct cachedb_env* cachedb_env,
 	char* key, struct sldns_buffer* result_buffer)
@@ -277,54 +780,142 @@ redis_lookup(struct module_env* env, struct cachedb_env* cachedb_env,
 	return ret;
 }
 
-static void
-redis_store(struct module_env* env, struct cachedb_env* cachedb_env,
-	char* key, uint8_t* data, size_t data_len, time_t ttl)
+/*
+ * Build the command that stores the data for the key, in cmdbuf of
+ * REDIS_STORE_CMDLEN bytes.  Supported commands:
+ * - "SET " + key + " %b"
+ * - "SETEX " + key + " " + ttl + " %b"
+ * Returns false on failure, logged.
+ */
+#define REDIS_STORE_CMDLEN (6+(CACHEDB_HASHSIZE/8)*2+11+3+1)
+static int
+redis_store_cmd(struct module_env* env, char* cmdbuf, char* key,
+	size_t data_len, time_t ttl)
 {
-	redisReply* rep;
 	int n;
 	int set_ttl = (env->cfg->redis_expire_records &&
 		(!env->cfg->serve_expired || env->cfg->serve_expired_ttl > 0));
-	/* Supported commands:
-	 * - "SET " + key + " %b"
-	 * - "SETEX " + key + " " + ttl + " %b"
-	 */
-	char cmdbuf[6+(CACHEDB_HASHSIZE/8)*2+11+3+1];
 
 	if (!set_ttl) {
 		verbose(VERB_ALGO, "redis_store %s (%d bytes)", key, (int)data_len);
 		/* build command to set to a binary safe string */
-		n = snprintf(cmdbuf, sizeof(cmdbuf), "SET %s %%b", key);
+		n = snprintf(cmdbuf, REDIS_STORE_CMDLEN, "SET %s %%b", key);
 	} else {
 		/* add expired ttl time to redis ttl to avoid premature eviction of key */
 		ttl += env->cfg->serve_expired_ttl;
 		verbose(VERB_ALGO, "redis_store %s (%d bytes) with ttl %u",
 			key, (int)data_len, (uint32_t)ttl);
 		/* build command to set to a binary safe string */
-		n = snprintf(cmdbuf, sizeof(cmdbuf), "SETEX %s %u %%b", key,
+		n = snprintf(cmdbuf, REDIS_STORE_CMDLEN, "SETEX %s %u %%b", key,
 			(uint32_t)ttl);
 	}
 
-
-	if(n < 0 || n >= (int)sizeof(cmdbuf)) {
+	if(n < 0 || n >= REDIS_STORE_CMDLEN) {
 		log_err("redis_store: unexpected failure to build command");
-		return;
+		return 0;
 	}
+	return 1;
+}
 
+/* Check the reply of a store, and free it. */
+static void
+redis_store_reply(redisReply* rep)
+{
+	if(rep->type != REDIS_REPLY_STATUS &&
+		rep->type != REDIS_REPLY_ERROR) {
+		log_err("redis_store: unexpected type of reply (%d)",
+			rep->type);
+	}
+	freeReplyObject(rep);
+}
+
+static void
+redis_store(struct module_env* env, struct cachedb_env* cachedb_env,
+	char* key, uint8_t* data, size_t data_len, time_t ttl)
+{
+	redisReply* rep;
+	char cmdbuf[REDIS_STORE_CMDLEN];
+
+	if(!redis_store_cmd(env, cmdbuf, key, data_len, ttl))
+		return;
+	if(env->worker_base) {
+		redis_async_store(env, (struct redis_moddata*)
+			cachedb_env->backend_data, cmdbuf, data, data_len);
+		return;
+	}
 	rep = redis_command(env, cachedb_env, cmdbuf, data, data_len);
 	if(rep) {
 		verbose(VERB_ALGO, "redis_store set completed");
-		if(rep->type != REDIS_REPLY_STATUS &&
-			rep->type != REDIS_REPLY_ERROR) {
-			log_err("redis_store: unexpected type of reply (%d)",
-				rep->type);
+		redis_store_reply(rep);
+	}
+}
+
+/*
+ * Store a batch with one round trip.  In a worker the commands go on the
+ * asynchronous connection, hiredis writes them together when the socket
+ * is writable and the replies are handled by the event loop.  Otherwise
+ * the commands are appended to the output buffer of the context with
+ * redisAppendCommand(), and the first redisGetReply() writes them all,
+ * then the replies are read in order.
+ */
+static void
+redis_store_batch(struct module_env* env, struct cachedb_env* cachedb_env,
+	struct cachedb_store_item* items, size_t num)
+{
+	struct redis_moddata* d = (struct redis_moddata*)
+		cachedb_env->backend_data;
+	redisContext* ctx;
+	redisReply* rep;
+	char cmdbuf[REDIS_STORE_CMDLEN];
+	size_t i, sent = 0;
+
+	verbose(VERB_ALGO, "redis_store_batch of %d items", (int)num);
+	if(env->worker_base) {
+		for(i = 0; i < num; i++) {
+			if(!redis_store_cmd(env, cmdbuf, items[i].key,
+				items[i].data_len, items[i].ttl))
+				continue;
+			redis_async_store(env, d, cmdbuf, items[i].data,
+				items[i].data_len);
 		}
-		freeReplyObject(rep);
+		return;
+	}
+	ctx = redis_get_ctx(env, d);
+	if(!ctx)
+		return;
+	for(i = 0; i < num; i++) {
+		if(!redis_store_cmd(env, cmdbuf, items[i].key,
+			items[i].data_len, items[i].ttl))
+			continue;
+		if(redisAppendCommand(ctx, cmdbuf, items[i].data,
+			items[i].data_len) != REDIS_OK) {
+			log_err("redis_store_batch: out of memory, %d stores "
+				"dropped", (int)(num - i));
+			break;
+		}
+		sent++;
+	}
+	for(i = 0; i < sent; i++) {
+		if(redisGetReply(ctx, (void**)&rep) != REDIS_OK || !rep) {
+			/* The context cannot be reused after an error. */
+			log_err("redis_store_batch: failed to receive a reply, "
+				"closing connection: %s", ctx->errstr);
+			redisFree(ctx);
+			d->ctxs[env->alloc->thread_num] = NULL;
+			return;
+		}
+		if(rep->type == REDIS_REPLY_ERROR)
+			log_err("redis: set resulted in an error: %s",
+				rep->str);
+		redis_store_reply(rep);
 	}
+	verbose(VERB_ALGO, "redis_store_batch set completed");
 }
 
 struct cachedb_backend redis_backend = { "redis",
-	redis_init, redis_deinit, redis_lookup, redis_store
+	redis_init, redis_deinit, redis_lookup, redis_store,
+	redis_lookup_start, redis_lookup_cancel, redis_thread_stop,
+	redis_store_batch
 };
 #endif	/* USE_REDIS */
 #endif /* USE_CACHEDB */
@@ -43,3 +43,13 @@
 /** the redis backend definition, contains callable functions
  * and name string */
 extern struct cachedb_backend redis_backend;
+
+#ifdef USE_REDIS
+/** event callback for the asynchronous redis connection, the arg is
+ * the per thread redis state. Published for the fptr whitelist. */
+void redis_async_event_cb(int fd, short bits, void* arg);
+
+/** timer callback for the request timeout on the asynchronous redis
+ * connection. Published for the fptr whitelist. */
+void redis_async_timeout_cb(void* arg);
+#endif
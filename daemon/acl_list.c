@@ -55,6 +55,7 @@ acl_list_create(void)
 		sizeof(struct acl_list));
 	if(!acl)
 		return NULL;
+	addr_radix_init(&acl->radix, &acl->tree);
 	acl->region = regional_create();
 	if(!acl->region) {
 		acl_list_delete(acl);
@@ -68,6 +69,7 @@ acl_list_delete(struct acl_list* acl)
 {
 	if(!acl) 
 		return;
+	addr_radix_clear(&acl->radix);
 	regional_destroy(acl->region);
 	free(acl);
 }
@@ -229,7 +231,7 @@ acl_list_tag_action_cfg(struct acl_list* acl, struct config_file* cfg,
 
 /** check wire data parse */
 static int
-check_data(const char* data, const struct config_strlist* head)
+check_data(const char* data, const struct local_rrset* head)
 {
 	char buf[65536];
 	uint8_t rr[LDNS_RR_BUF_SIZE];
@@ -244,29 +246,12 @@ check_data(const char* data, const struct config_strlist* head)
 	/* Reject it if we would end up having CNAME and other data (including
 	 * another CNAME) for the same tag. */
 	if(res == 0 && head) {
-		const char* err_data = NULL;
-
-		if(sldns_wirerr_get_type(rr, len, 1) == LDNS_RR_TYPE_CNAME) {
-			/* adding CNAME while other data already exists. */
-			err_data = data;
-		} else {
-			snprintf(buf, sizeof(buf), "%s %s", ".", head->str);
-			len = sizeof(rr);
-			res = sldns_str2wire_rr_buf(buf, rr, &len, NULL, 3600,
-				NULL, 0, NULL, 0);
-			if(res != 0) {
-				/* This should be impossible here as head->str
-				 * has been validated, but we check it just in
-				 * case. */
-				return 0;
-			}
-			if(sldns_wirerr_get_type(rr, len, 1) ==
-				LDNS_RR_TYPE_CNAME) /* already have CNAME */
-				err_data = head->str;
-		}
-		if(err_data) {
+		/* adding CNAME while other data already exists, or there is
+		 * a CNAME already */
+		if(sldns_wirerr_get_type(rr, len, 1) == LDNS_RR_TYPE_CNAME ||
+			head->rrset->rk.type == htons(LDNS_RR_TYPE_CNAME)) {
 			log_err("redirect tag data '%s' must not coexist with "
-				"other data.", err_data);
+				"other data.", data);
 			return 0;
 		}
 	}
@@ -285,12 +270,11 @@ acl_list_tag_data_cfg(struct acl_list* acl, struct config_file* cfg,
 {
 	struct acl_addr* node;
 	int tagid;
-	char* dupdata;
 	if(!(node=acl_find_or_create(acl, str)))
 		return 0;
 	/* allocate array if not yet */
 	if(!node->tag_datas) {
-		node->tag_datas = (struct config_strlist**)regional_alloc_zero(
+		node->tag_datas = (struct local_rrset**)regional_alloc_zero(
 			acl->region, sizeof(*node->tag_datas)*cfg->num_tags);
 		if(!node->tag_datas) {
 			log_err("out of memory");
@@ -315,14 +299,10 @@ acl_list_tag_data_cfg(struct acl_list* acl, struct config_file* cfg,
 		return 0;
 	}
 
-	dupdata = regional_strdup(acl->region, data);
-	if(!dupdata) {
-		log_err("out of memory");
-		return 0;
-	}
-	if(!cfg_region_strlist_insert(acl->region,
-		&(node->tag_datas[tagid]), dupdata)) {
-		log_err("out of memory");
+	if(!local_data_add_tag_data(acl->region, &node->tag_datas[tagid],
+		data)) {
+		log_err("cannot add access-control-tag data: %s %s '%s'",
+			str, tag, data);
 		return 0;
 	}
 	return 1;
@@ -437,6 +417,7 @@ int
 acl_list_apply_cfg(struct acl_list* acl, struct config_file* cfg,
 	struct views* v)
 {
+	addr_radix_clear(&acl->radix);
 	regional_free_all(acl->region);
 	addr_tree_init(&acl->tree);
 	if(!read_acl_list(acl, cfg))
@@ -463,6 +444,7 @@ acl_list_apply_cfg(struct acl_list* acl, struct config_file* cfg,
 			return 0;
 	}
 	addr_tree_init_parents(&acl->tree);
+	(void)addr_radix_build(&acl->radix);
 	return 1;
 }
 
@@ -477,7 +459,7 @@ struct acl_addr*
 acl_addr_lookup(struct acl_list* acl, struct sockaddr_storage* addr,
         socklen_t addrlen)
 {
-	return (struct acl_addr*)addr_tree_lookup(&acl->tree,
+	return (struct acl_addr*)addr_radix_lookup(&acl->radix,
 		addr, addrlen);
 }
 
@@ -485,5 +467,6 @@ size_t
 acl_list_get_mem(struct acl_list* acl)
 {
 	if(!acl) return 0;
-	return sizeof(*acl) + regional_get_mem(acl->region);
+	return sizeof(*acl) + regional_get_mem(acl->region) +
+		addr_radix_get_mem(&acl->radix);
 }
@@ -43,8 +43,10 @@
 #ifndef DAEMON_ACL_LIST_H
 #define DAEMON_ACL_LIST_H
 #include "util/storage/dnstree.h"
+#include "util/storage/addrradix.h"
 #include "services/view.h"
 struct config_file;
+struct local_rrset;
 struct regional;
 
 /**
@@ -79,6 +81,8 @@ struct acl_list {
 	 * contents of type acl_addr.
 	 */
 	rbtree_type tree;
+	/** lookup index on the tree */
+	struct addr_radix radix;
 };
 
 /**
@@ -98,9 +102,10 @@ struct acl_addr {
 	uint8_t* tag_actions;
 	/** size of the tag_actions_array */
 	size_t tag_actions_size;
-	/** array per tagnumber, with per tag a list of rdata strings.
-	 * NULL if none.  strings are like 'A 127.0.0.1' 'AAAA ::1' */
-	struct config_strlist** tag_datas;
+	/** array per tagnumber, with per tag a list of rrsets, one per type,
+	 * built from the rdata strings like 'A 127.0.0.1' 'AAAA ::1'.
+	 * NULL if none. */
+	struct local_rrset** tag_datas;
 	/** size of the tag_datas array */
 	size_t tag_datas_size;
 	/* view element, NULL if none */
@@ -253,6 +253,8 @@ daemon_init(void)
 #endif
 	daemon->need_to_exit = 0;
 	modstack_init(&daemon->mods);
+	/* shared counters of the listening structs of the threads */
+	listen_setup_locks();
 	if(!(daemon->env = (struct module_env*)calloc(1, 
 		sizeof(*daemon->env)))) {
 		free(daemon);
@@ -590,10 +592,6 @@ void
 daemon_fork(struct daemon* daemon)
 {
 	int have_view_respip_cfg = 0;
-#ifdef HAVE_SYSTEMD
-	int ret;
-#endif
-
 	log_assert(daemon);
 	if(!(daemon->views = views_create()))
 		fatal_exit("Could not create views: out of memory");
@@ -688,16 +686,13 @@ daemon_fork(struct daemon* daemon)
 		log_warn("SHM has failed");
 
 	/* Start resolver service on main thread. */
-#ifdef HAVE_SYSTEMD
-	ret = sd_notify(0, "READY=1");
-	if(ret <= 0 && getenv("NOTIFY_SOCKET"))
-		fatal_exit("sd_notify failed %s: %s. Make sure that unbound has "
-				"access/permission to use the socket presented by systemd.",
-				getenv("NOTIFY_SOCKET"),
-				(ret==0?"no $NOTIFY_SOCKET": strerror(-ret)));
-#endif
+	if(daemon->cfg->trust_anchor_prime_on_start)
+		worker_prime_anchors(daemon->workers[0]);
+	else	daemon_notify_ready();
 	log_info("start of service (%s).", PACKAGE_STRING);
 	worker_work(daemon->workers[0]);
+	/* primes that finish during shutdown do not signal readiness */
+	daemon->workers[0]->anchor_prime_count = 0;
 #ifdef HAVE_SYSTEMD
 	if (daemon->workers[0]->need_to_exit)
 		sd_notify(0, "STOPPING=1");
@@ -715,6 +710,19 @@ daemon_fork(struct daemon* daemon)
 	daemon->need_to_exit = daemon->workers[0]->need_to_exit;
 }
 
+void
+daemon_notify_ready(void)
+{
+#ifdef HAVE_SYSTEMD
+	int ret = sd_notify(0, "READY=1");
+	if(ret <= 0 && getenv("NOTIFY_SOCKET"))
+		fatal_exit("sd_notify failed %s: %s. Make sure that unbound has "
+				"access/permission to use the socket presented by systemd.",
+				getenv("NOTIFY_SOCKET"),
+				(ret==0?"no $NOTIFY_SOCKET": strerror(-ret)));
+#endif
+}
+
 void 
 daemon_cleanup(struct daemon* daemon)
 {
@@ -780,6 +788,7 @@ daemon_delete(struct daemon* daemon)
 	alloc_clear(&daemon->superalloc);
 	acl_list_delete(daemon->acl);
 	tcl_list_delete(daemon->tcl);
+	listen_desetup_locks();
 	free(daemon->chroot);
 	free(daemon->pidfile);
 	free(daemon->env);
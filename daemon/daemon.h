@@ -181,4 +181,9 @@ void daemon_delete(struct daemon* daemon);
  */
 void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg);
 
+/**
+ * Signal that the daemon is ready to serve, to the service manager.
+ */
+void daemon_notify_ready(void);
+
 #endif /* DAEMON_H */
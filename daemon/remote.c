@@ -846,6 +846,9 @@ print_mem(RES* ssl, struct worker* worker, struct daemon* daemon,
 	if(!print_longnum(ssl, "mem.mod.dynlibmod"SQ, dynlib))
 		return 0;
 #endif /* WITH_DYNLIBMODULE */
+	if(!print_longnum(ssl, "mem.authzone"SQ,
+		(size_t)s->svr.mem_authzone))
+		return 0;
 	if(!print_longnum(ssl, "mem.streamwait"SQ,
 		(size_t)s->svr.mem_stream_wait))
 		return 0;
@@ -877,6 +880,46 @@ print_uptime(RES* ssl, struct worker* worker, int reset)
 	return 1;
 }
 
+/** print the policy load statistics of the RPZ zones */
+static int
+print_rpz(RES* ssl, struct worker* worker)
+{
+	struct auth_zones* az = worker->env.auth_zones;
+	struct auth_zone* a;
+	char nm[LDNS_MAX_DOMAINLEN+1];
+	size_t len;
+	if(!az)
+		return 1;
+	lock_rw_rdlock(&az->rpz_lock);
+	for(a = az->rpz_first; a; a = a->rpz_az_next) {
+		struct rpz* r = a->rpz;
+		struct timeval apply, swap;
+		size_t count;
+		if(!r)
+			continue;
+		lock_rw_rdlock(&r->lock);
+		count = r->apply_count;
+		apply = r->apply_time;
+		swap = r->swap_time;
+		lock_rw_unlock(&r->lock);
+		dname_str(a->name, nm);
+		len = strlen(nm);
+		if(len > 1 && nm[len-1] == '.')
+			nm[len-1] = 0;
+		if(!ssl_printf(ssl, "rpz.apply.count.%s"SQ"%lu\n", nm,
+			(unsigned long)count) ||
+		   !ssl_printf(ssl, "rpz.apply.time.%s"SQ ARG_LL "d.%6.6d\n",
+			nm, (long long)apply.tv_sec, (unsigned)apply.tv_usec) ||
+		   !ssl_printf(ssl, "rpz.swap.time.%s"SQ ARG_LL "d.%6.6d\n",
+			nm, (long long)swap.tv_sec, (unsigned)swap.tv_usec)) {
+			lock_rw_unlock(&az->rpz_lock);
+			return 0;
+		}
+	}
+	lock_rw_unlock(&az->rpz_lock);
+	return 1;
+}
+
 /** print extended histogram */
 static int
 print_hist(RES* ssl, struct ub_stats_info* s)
@@ -913,6 +956,9 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 	char nm[32];
 	const sldns_rr_descriptor* desc;
 	const sldns_lookup_table* lt;
+#ifdef USE_CACHEDB
+	struct timeval sumwait, avg;
+#endif
 	/* TYPE */
 	for(i=0; i<UB_STATS_QTYPE_NUM; i++) {
 		if(inhibit_zero && s->svr.qtype[i] == 0)
@@ -979,6 +1025,16 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 		(unsigned long)s->svr.qtls)) return 0;
 	if(!ssl_printf(ssl, "num.query.tls.resume"SQ"%lu\n", 
 		(unsigned long)s->svr.qtls_resume)) return 0;
+	if(!ssl_printf(ssl, "num.tls.handshake"SQ"%lu\n",
+		(unsigned long)s->svr.tls_handshake)) return 0;
+	if(!ssl_printf(ssl, "num.tls.handshake.resumed"SQ"%lu\n",
+		(unsigned long)s->svr.tls_handshake_resumed)) return 0;
+	if(!ssl_printf(ssl, "num.tls.ktls"SQ"%lu\n",
+		(unsigned long)s->svr.tls_ktls)) return 0;
+	if(!ssl_printf(ssl, "num.event.wakeup"SQ"%lu\n",
+		(unsigned long)s->svr.event_wakeup)) return 0;
+	if(!ssl_printf(ssl, "num.event.handled"SQ"%lu\n",
+		(unsigned long)s->svr.event_handled)) return 0;
 	if(!ssl_printf(ssl, "num.query.ipv6"SQ"%lu\n", 
 		(unsigned long)s->svr.qipv6)) return 0;
 	if(!ssl_printf(ssl, "num.query.https"SQ"%lu\n",
@@ -1075,12 +1131,52 @@ print_ext(RES* ssl, struct ub_stats_info* s)
 		(unsigned long)s->svr.num_query_authzone_up)) return 0;
 	if(!ssl_printf(ssl, "num.query.authzone.down"SQ"%lu\n",
 		(unsigned long)s->svr.num_query_authzone_down)) return 0;
+	if(!ssl_printf(ssl, "auth.xfr.swap"SQ"%lu\n",
+		(unsigned long)s->svr.auth_xfr_swap)) return 0;
+	if(!ssl_printf(ssl, "auth.xfr.lock_usec"SQ"%lu\n",
+		(unsigned long)s->svr.auth_xfr_lock_usec)) return 0;
+	if(!ssl_printf(ssl, "auth.xfr.lock_usec.max"SQ"%lu\n",
+		(unsigned long)s->svr.auth_xfr_lock_usec_max)) return 0;
 #ifdef CLIENT_SUBNET
 	if(!ssl_printf(ssl, "num.query.subnet"SQ"%lu\n",
 		(unsigned long)s->svr.num_query_subnet)) return 0;
 	if(!ssl_printf(ssl, "num.query.subnet_cache"SQ"%lu\n",
 		(unsigned long)s->svr.num_query_subnet_cache)) return 0;
 #endif /* CLIENT_SUBNET */
+#ifdef USE_CACHEDB
+	if(!ssl_printf(ssl, "num.cachedb.write_behind.queue"SQ"%lu\n",
+		(unsigned long)s->svr.cachedb_wb_queue)) return 0;
+	if(!ssl_printf(ssl, "num.cachedb.write_behind.merged"SQ"%lu\n",
+		(unsigned long)s->svr.cachedb_wb_merged)) return 0;
+	if(!ssl_printf(ssl, "num.cachedb.write_behind.dropped"SQ"%lu\n",
+		(unsigned long)s->svr.cachedb_wb_dropped)) return 0;
+	if(!ssl_printf(ssl, "num.cachedb.write_behind.flush"SQ"%lu\n",
+		(unsigned long)s->svr.cachedb_wb_flush)) return 0;
+	if(!ssl_printf(ssl, "num.cachedb.write_behind.stored"SQ"%lu\n",
+		(unsigned long)s->svr.cachedb_wb_stored)) return 0;
+#ifndef S_SPLINT_S
+	sumwait.tv_sec = s->svr.cachedb_wb_wait_sec;
+	sumwait.tv_usec = s->svr.cachedb_wb_wait_usec;
+#endif
+	timeval_divide(&avg, &sumwait, s->svr.cachedb_wb_stored);
+	if(!ssl_printf(ssl, "cachedb.write_behind.wait.avg"SQ ARG_LL
+		"d.%6.6d\n", (long long)avg.tv_sec, (int)avg.tv_usec))
+		return 0;
+#ifndef S_SPLINT_S
+	sumwait.tv_sec = s->svr.cachedb_wb_flush_sec;
+	sumwait.tv_usec = s->svr.cachedb_wb_flush_usec;
+#endif
+	timeval_divide(&avg, &sumwait, s->svr.cachedb_wb_flush);
+	if(!ssl_printf(ssl, "cachedb.write_behind.flush.avg"SQ ARG_LL
+		"d.%6.6d\n", (long long)avg.tv_sec, (int)avg.tv_usec))
+		return 0;
+#endif /* USE_CACHEDB */
+#ifdef USE_DNSTAP
+	if(!ssl_printf(ssl, "num.dnstap.queue"SQ"%lu\n",
+		(unsigned long)s->svr.dnstap_queue)) return 0;
+	if(!ssl_printf(ssl, "num.dnstap.dropped"SQ"%lu\n",
+		(unsigned long)s->svr.dnstap_dropped)) return 0;
+#endif /* USE_DNSTAP */
 	return 1;
 }
 
@@ -1116,6 +1212,8 @@ do_stats(RES* ssl, struct worker* worker, int reset)
 			return;
 		if(!print_ext(ssl, &total))
 			return;
+		if(!print_rpz(ssl, worker))
+			return;
 	}
 }
 
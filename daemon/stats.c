@@ -53,6 +53,7 @@
 #include "services/listen_dnsport.h"
 #include "util/config_file.h"
 #include "util/tube.h"
+#include "util/ub_event.h"
 #include "util/timehist.h"
 #include "util/net_help.h"
 #include "validator/validator.h"
@@ -66,6 +67,12 @@
 #ifdef CLIENT_SUBNET
 #include "edns-subnet/subnetmod.h"
 #endif
+#ifdef USE_CACHEDB
+#include "cachedb/cachedb.h"
+#endif
+#ifdef USE_DNSTAP
+#include "dnstap/dtstream.h"
+#endif
 #ifdef HAVE_SSL
 #include <openssl/ssl.h>
 #endif
@@ -142,21 +149,44 @@ set_subnet_stats(struct worker* worker, struct ub_server_stats* svr,
 	if(m == -1)
 		return;
 	sne = (struct subnet_env*)worker->env.modinfo[m];
-	if(reset && !worker->env.cfg->stat_cumulative) {
-		lock_rw_wrlock(&sne->biglock);
-	} else {
-		lock_rw_rdlock(&sne->biglock);
-	}
+	lock_quick_lock(&sne->stats_lock);
 	svr->num_query_subnet = (long long)(sne->num_msg_nocache + sne->num_msg_cache);
 	svr->num_query_subnet_cache = (long long)sne->num_msg_cache;
 	if(reset && !worker->env.cfg->stat_cumulative) {
 		sne->num_msg_cache = 0;
 		sne->num_msg_nocache = 0;
 	}
-	lock_rw_unlock(&sne->biglock);
+	lock_quick_unlock(&sne->stats_lock);
 }
 #endif /* CLIENT_SUBNET */
 
+#ifdef USE_CACHEDB
+/** Set the cachedb write-behind stats. */
+static void
+set_cachedb_stats(struct worker* worker, struct ub_server_stats* svr,
+	int reset)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "cachedb");
+	if(m == -1)
+		return;
+	cachedb_wb_get_stats(&worker->env, m, svr, reset);
+}
+#endif /* USE_CACHEDB */
+
+#ifdef USE_DNSTAP
+/** Set the dnstap message queue stats. */
+static void
+set_dnstap_stats(struct worker* worker, struct ub_server_stats* svr,
+	int reset)
+{
+	size_t queued = 0, dropped = 0;
+	dt_msg_queue_get_stats(worker->dtenv.msgqueue, &queued, &dropped,
+		reset && !worker->env.cfg->stat_cumulative);
+	svr->dnstap_queue = (long long)queued;
+	svr->dnstap_dropped = (long long)dropped;
+}
+#endif /* USE_DNSTAP */
+
 /** Set the neg cache stats. */
 static void
 set_neg_cache_stats(struct worker* worker, struct ub_server_stats* svr,
@@ -255,6 +285,7 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 {
 	int i;
 	struct listen_list* lp;
+	size_t wakeup, handled;
 
 	s->svr = worker->stats;
 	s->mesh_num_states = (long long)worker->env.mesh->all.count;
@@ -333,7 +364,22 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 			worker->env.auth_zones->num_query_down = 0;
 		}
 		lock_rw_unlock(&worker->env.auth_zones->lock);
+		lock_basic_lock(&worker->env.auth_zones->xfr_stats_lock);
+		s->svr.auth_xfr_swap = (long long)worker->env.
+			auth_zones->num_xfr_swap;
+		s->svr.auth_xfr_lock_usec = worker->env.
+			auth_zones->xfr_lock_usec;
+		s->svr.auth_xfr_lock_usec_max = worker->env.
+			auth_zones->xfr_lock_usec_max;
+		if(reset && !worker->env.cfg->stat_cumulative) {
+			worker->env.auth_zones->num_xfr_swap = 0;
+			worker->env.auth_zones->xfr_lock_usec = 0;
+			worker->env.auth_zones->xfr_lock_usec_max = 0;
+		}
+		lock_basic_unlock(&worker->env.auth_zones->xfr_stats_lock);
 	}
+	s->svr.mem_authzone = (long long)auth_zones_get_mem(
+		worker->env.auth_zones);
 	s->svr.mem_stream_wait =
 		(long long)tcp_req_info_get_stream_buffer_size();
 	s->svr.mem_http2_query_buffer =
@@ -350,14 +396,36 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	s->svr.num_query_subnet = 0;
 	s->svr.num_query_subnet_cache = 0;
 #endif
+#ifdef USE_CACHEDB
+	/* cachedb write-behind numbers */
+	set_cachedb_stats(worker, &s->svr, reset);
+#endif
+#ifdef USE_DNSTAP
+	/* dnstap message queue numbers */
+	set_dnstap_stats(worker, &s->svr, reset);
+#endif
 
-	/* get tcp accept usage */
+	/* get tcp accept usage, and TLS handshakes */
 	s->svr.tcp_accept_usage = 0;
+	s->svr.tls_handshake = 0;
+	s->svr.tls_handshake_resumed = 0;
+	s->svr.tls_ktls = 0;
 	for(lp = worker->front->cps; lp; lp = lp->next) {
-		if(lp->com->type == comm_tcp_accept)
+		if(lp->com->type == comm_tcp_accept) {
 			s->svr.tcp_accept_usage += (long long)lp->com->cur_tcp_count;
+			s->svr.tls_handshake += (long long)lp->com->tls_handshake;
+			s->svr.tls_handshake_resumed +=
+				(long long)lp->com->tls_handshake_resumed;
+			s->svr.tls_ktls += (long long)lp->com->tls_ktls;
+		}
 	}
 
+	/* get the event loop wakeups */
+	ub_event_base_get_counts(comm_base_internal(worker->base), &wakeup,
+		&handled, 0);
+	s->svr.event_wakeup = (long long)wakeup;
+	s->svr.event_handled = (long long)handled;
+
 	if(reset && !worker->env.cfg->stat_cumulative) {
 		worker_stats_clear(worker);
 	}
@@ -426,6 +494,26 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 		total->svr.qtcp_outgoing += a->svr.qtcp_outgoing;
 		total->svr.qtls += a->svr.qtls;
 		total->svr.qtls_resume += a->svr.qtls_resume;
+		total->svr.tls_handshake += a->svr.tls_handshake;
+		total->svr.tls_handshake_resumed +=
+			a->svr.tls_handshake_resumed;
+		total->svr.tls_ktls += a->svr.tls_ktls;
+		total->svr.cachedb_wb_queue += a->svr.cachedb_wb_queue;
+		total->svr.cachedb_wb_merged += a->svr.cachedb_wb_merged;
+		total->svr.cachedb_wb_dropped += a->svr.cachedb_wb_dropped;
+		total->svr.cachedb_wb_flush += a->svr.cachedb_wb_flush;
+		total->svr.cachedb_wb_stored += a->svr.cachedb_wb_stored;
+		stats_timeval_add(&total->svr.cachedb_wb_wait_sec,
+			&total->svr.cachedb_wb_wait_usec,
+			a->svr.cachedb_wb_wait_sec, a->svr.cachedb_wb_wait_usec);
+		stats_timeval_add(&total->svr.cachedb_wb_flush_sec,
+			&total->svr.cachedb_wb_flush_usec,
+			a->svr.cachedb_wb_flush_sec,
+			a->svr.cachedb_wb_flush_usec);
+		total->svr.dnstap_queue += a->svr.dnstap_queue;
+		total->svr.dnstap_dropped += a->svr.dnstap_dropped;
+		total->svr.event_wakeup += a->svr.event_wakeup;
+		total->svr.event_handled += a->svr.event_handled;
 		total->svr.qhttps += a->svr.qhttps;
 		total->svr.qipv6 += a->svr.qipv6;
 		total->svr.qbit_QR += a->svr.qbit_QR;
@@ -198,6 +198,9 @@ checkrlimits(struct config_file* cfg)
 	size_t avail;
 	struct rlimit rlim;
 
+#ifndef USE_EPOLL_EVENT
+	/* the select based mini-event has a fixed maximum, with epoll
+	 * the mini-event fd arrays grow */
 	if(total > 1024 && 
 		strncmp(ub_event_get_version(), "mini-event", 10) == 0) {
 		log_warn("too many file descriptors requested. The builtin"
@@ -212,6 +215,7 @@ checkrlimits(struct config_file* cfg)
 			cfg->outgoing_num_ports);
 		total = 1024;
 	}
+#endif /* USE_EPOLL_EVENT */
 	if(perthread > 64 && 
 		strncmp(ub_event_get_version(), "winsock-event", 13) == 0) {
 		log_err("too many file descriptors requested. The winsock"
@@ -483,6 +487,15 @@ perform_setup(struct daemon* daemon, struct config_file* cfg, int debug_mode,
 				fatal_exit("could not set session ticket SSL_CTX");
 			}
 		}
+		if(!listen_sslctx_setup_session_cache(daemon->listen_sslctx,
+			cfg->tls_session_cache_size,
+			cfg->tls_session_ticket_keys.first &&
+			cfg->tls_session_ticket_keys.first->str[0] != 0))
+			fatal_exit("could not set session cache SSL_CTX");
+		if(cfg->tls_use_ktls &&
+			!listen_sslctx_setup_ktls(daemon->listen_sslctx))
+			log_warn("tls-use-ktls: not supported by the TLS "
+				"library, continuing without it");
 	}
 	if(!(daemon->connect_sslctx = connect_sslctx_create(NULL, NULL,
 		cfg->tls_cert_bundle, cfg->tls_win_cert)))
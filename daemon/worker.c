@@ -48,6 +48,7 @@
 #include "daemon/remote.h"
 #include "daemon/acl_list.h"
 #include "util/netevent.h"
+#include "util/ub_event.h"
 #include "util/config_file.h"
 #include "util/module.h"
 #include "util/regional.h"
@@ -80,6 +81,9 @@
 #include "util/shm_side/shm_main.h"
 #include "dnscrypt/dnscrypt.h"
 #include "dnstap/dtstream.h"
+#ifdef USE_CACHEDB
+#include "cachedb/cachedb.h"
+#endif
 
 #ifdef HAVE_SYS_TYPES_H
 #  include <sys/types.h>
@@ -704,16 +708,11 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 			"validation");
 		goto bail_out; /* need to validate cache entry first */
 	} else if(rep->security == sec_status_secure) {
-		if(reply_all_rrsets_secure(rep)) {
-			*is_secure_answer = 1;
-		} else {
-			if(must_validate) {
-				verbose(VERB_ALGO, "Cache reply: secure entry"
-					" changed status");
-				goto bail_out; /* rrset changed, re-verify */
-			}
-			*is_secure_answer = 0;
-		}
+		/* The rrsets are checked by ID when they are locked, and an
+		 * rrset that is no longer secure in the cache gets a new ID,
+		 * so the secure status of the message holds for all of them
+		 * and there is no need to check every rrset. */
+		*is_secure_answer = 1;
 	} else *is_secure_answer = 0;
 
 	edns_bak = *edns;
@@ -1106,6 +1105,9 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	int need_drop = 0;
 	int is_expired_answer = 0;
 	int is_secure_answer = 0;
+#ifdef USE_DNSTAP
+	int is_local_answer = 0;
+#endif
 	/* We might have to chase a CNAME chain internally, in which case
 	 * we'll have up to two replies and combine them to build a complete
 	 * answer.  These variables control this case. */
@@ -1378,6 +1380,9 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 			comm_point_drop_reply(repinfo);
 			return 0;
 		}
+#ifdef USE_DNSTAP
+		is_local_answer = 1;
+#endif
 		goto send_reply;
 	}
 	if(worker->env.auth_zones &&
@@ -1389,6 +1394,9 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 			comm_point_drop_reply(repinfo);
 			return 0;
 		}
+#ifdef USE_DNSTAP
+		is_local_answer = 1;
+#endif
 		goto send_reply;
 	}
 	if(worker->env.auth_zones &&
@@ -1594,7 +1602,7 @@ send_reply_rc:
 #ifdef USE_DNSTAP
 	if(worker->dtenv.log_client_response_messages)
 		dt_msg_send_client_response(&worker->dtenv, &repinfo->addr,
-			c->type, c->buffer);
+			c->type, c->buffer, is_local_answer);
 #endif
 	if(worker->env.cfg->log_replies)
 	{
@@ -1695,6 +1703,81 @@ void worker_probe_timer_cb(void* arg)
 		comm_timer_set(worker->env.probe_timer, &tv);
 }
 
+void worker_anchor_prime_cb(void* arg, int rcode,
+	struct sldns_buffer* ATTR_UNUSED(buf), enum sec_status s,
+	char* why_bogus, int ATTR_UNUSED(was_ratelimited))
+{
+	struct worker* worker = (struct worker*)arg;
+	if(rcode != LDNS_RCODE_NOERROR || s != sec_status_secure)
+		verbose(VERB_ALGO, "trust anchor prime at start: rcode %d, "
+			"%s %s", rcode, sec_status_to_string(s),
+			why_bogus?why_bogus:"");
+	if(worker->anchor_prime_count == 0)
+		return; /* stopped already */
+	if(--worker->anchor_prime_count == 0) {
+		verbose(VERB_OPS, "trust anchors primed");
+		daemon_notify_ready();
+	}
+}
+
+void worker_prime_anchors(struct worker* worker)
+{
+	struct val_anchors* anchors = worker->env.anchors;
+	struct trust_anchor* ta;
+	struct query_info* list = NULL;
+	struct edns_data edns;
+	size_t i, num = 0;
+	if(anchors) {
+		/* copy the anchor names, the locks cannot be held while the
+		 * lookups run on the mesh */
+		lock_basic_lock(&anchors->lock);
+		list = (struct query_info*)calloc(anchors->tree->count+1,
+			sizeof(*list));
+		if(!list) {
+			lock_basic_unlock(&anchors->lock);
+			log_err("out of memory priming trust anchors");
+			daemon_notify_ready();
+			return;
+		}
+		RBTREE_FOR(ta, struct trust_anchor*, anchors->tree) {
+			lock_basic_lock(&ta->lock);
+			if(ta->numDS != 0 || ta->numDNSKEY != 0) {
+				list[num].qname = memdup(ta->name, ta->namelen);
+				list[num].qname_len = ta->namelen;
+				list[num].qtype = LDNS_RR_TYPE_DNSKEY;
+				list[num].qclass = ta->dclass;
+				list[num].local_alias = NULL;
+				if(list[num].qname)
+					num++;
+			}
+			lock_basic_unlock(&ta->lock);
+		}
+		lock_basic_unlock(&anchors->lock);
+	}
+	memset(&edns, 0, sizeof(edns));
+	edns.edns_present = 1;
+	edns.bits = EDNS_DO;
+	edns.udp_size = EDNS_ADVERTISED_SIZE;
+
+	/* one more, so that primes that finish right away, from the cache,
+	 * do not signal readiness before all of them are started */
+	worker->anchor_prime_count = num+1;
+	for(i=0; i<num; i++) {
+		log_query_info(VERB_ALGO, "prime trust anchor at start",
+			&list[i]);
+		if(!mesh_new_callback(worker->env.mesh, &list[i], BIT_RD,
+			&edns, worker->env.scratch_buffer, 0,
+			&worker_anchor_prime_cb, worker)) {
+			log_err("out of memory priming trust anchors");
+			worker->anchor_prime_count--;
+		}
+		free(list[i].qname);
+	}
+	free(list);
+	if(--worker->anchor_prime_count == 0)
+		daemon_notify_ready();
+}
+
 struct worker* 
 worker_create(struct daemon* daemon, int id, int* ports, int n)
 {
@@ -1746,6 +1829,12 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	}
 	comm_base_set_slow_accept_handlers(worker->base, &worker_stop_accept,
 		&worker_start_accept, worker);
+	if(cfg->busy_poll > 0)
+		ub_event_base_set_busy_poll(comm_base_internal(worker->base),
+			cfg->busy_poll);
+	if(cfg->use_io_uring && !comm_base_setup_uring(worker->base))
+		log_warn("use-io-uring: could not setup io_uring, the "
+			"ports use the event loop");
 	if(do_sigs) {
 #ifdef SIGHUP
 		ub_thread_sig_unblock(SIGHUP);
@@ -1821,6 +1910,11 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	/* the UDP answers are received in buffers of a fixed size, larger
+	 * EDNS sizes receive with the events */
+	if(cfg->use_io_uring)
+		outside_network_use_uring(worker->back,
+			cfg->edns_buffer_size <= COMM_URING_UDP_SIZE);
 	/* start listening to commands */
 	if(!tube_setup_bg_listen(worker->cmd, worker->base,
 		&worker_handle_control_cmd, worker)) {
@@ -1961,6 +2055,10 @@ worker_delete(struct worker* worker)
 	}
 	outside_network_quit_prepare(worker->back);
 	mesh_delete(worker->env.mesh);
+#ifdef USE_CACHEDB
+	cachedb_thread_stop(&worker->env, modstack_find(&worker->daemon->mods,
+		"cachedb"));
+#endif
 	sldns_buffer_free(worker->env.scratch_buffer);
 	forwards_delete(worker->env.fwds);
 	hints_delete(worker->env.hints);
@@ -2026,10 +2124,19 @@ worker_alloc_cleanup(void* arg)
 
 void worker_stats_clear(struct worker* worker)
 {
+	struct listen_list* lp;
+	size_t wakeup, handled;
 	server_stats_init(&worker->stats, worker->env.cfg);
 	mesh_stats_clear(worker->env.mesh);
 	worker->back->unwanted_replies = 0;
 	worker->back->num_tcp_outgoing = 0;
+	for(lp = worker->front->cps; lp; lp = lp->next) {
+		lp->com->tls_handshake = 0;
+		lp->com->tls_handshake_resumed = 0;
+		lp->com->tls_ktls = 0;
+	}
+	ub_event_base_get_counts(comm_base_internal(worker->base), &wakeup,
+		&handled, 1);
 }
 
 void worker_start_accept(void* arg)
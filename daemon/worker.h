@@ -108,6 +108,9 @@ struct worker {
 	time_t err_limit_time;
 	/** ratelimit for errors, packet count */
 	unsigned int err_limit_count;
+	/** number of trust anchor primes at startup that have not finished,
+	 * the daemon signals readiness when it drops to zero */
+	size_t anchor_prime_count;
 
 	/** random() table for this worker. */
 	struct ub_randstate* rndstate;
@@ -175,4 +178,12 @@ void worker_send_cmd(struct worker* worker, enum worker_commands cmd);
  */
 void worker_stats_clear(struct worker* worker);
 
+/**
+ * Prime the configured trust anchors with DNSKEY lookups that run at the
+ * same time, and signal that the daemon is ready when they are done.
+ * The readiness is signalled immediately if there is nothing to prime.
+ * @param worker: the main thread worker, the lookups run on its mesh.
+ */
+void worker_prime_anchors(struct worker* worker);
+
 #endif /* DAEMON_WORKER_H */
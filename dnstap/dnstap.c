@@ -38,81 +38,261 @@
 
 #include "config.h"
 #include <string.h>
+#include <ctype.h>
 #include <sys/time.h>
 #ifdef HAVE_SYS_STAT_H
 #include <sys/stat.h>
 #endif
 #include <errno.h>
 #include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+#include "sldns/rrdef.h"
+#include "sldns/parseutil.h"
+#include "sldns/wire2str.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
 #include "util/netevent.h"
 #include "util/log.h"
-
-#include <protobuf-c/protobuf-c.h>
+#include "util/data/dname.h"
+#include "util/storage/lookup3.h"
 
 #include "dnstap/dnstap.h"
 #include "dnstap/dtstream.h"
-#include "dnstap/dnstap.pb-c.h"
 
-#define DNSTAP_INITIAL_BUF_SIZE		256
+/* protobuf wire types */
+#define DT_WIRE_VARINT		0
+#define DT_WIRE_BYTES		2
+#define DT_WIRE_FIXED32		5
+
+/* Dnstap field numbers, from dnstap.proto */
+#define DT_DNSTAP_IDENTITY	1
+#define DT_DNSTAP_VERSION	2
+#define DT_DNSTAP_MESSAGE	14
+#define DT_DNSTAP_TYPE		15
+/* Dnstap.Type value */
+#define DT_DNSTAP_TYPE_MESSAGE	1
+
+/* Message field numbers, from dnstap.proto */
+#define DT_MSG_TYPE		1
+#define DT_MSG_SOCKET_FAMILY	2
+#define DT_MSG_SOCKET_PROTOCOL	3
+#define DT_MSG_QUERY_ADDRESS	4
+#define DT_MSG_RESPONSE_ADDRESS	5
+#define DT_MSG_QUERY_PORT	6
+#define DT_MSG_RESPONSE_PORT	7
+#define DT_MSG_QUERY_TIME_SEC	8
+#define DT_MSG_QUERY_TIME_NSEC	9
+#define DT_MSG_QUERY_MESSAGE	10
+#define DT_MSG_QUERY_ZONE	11
+#define DT_MSG_RESPONSE_TIME_SEC	12
+#define DT_MSG_RESPONSE_TIME_NSEC	13
+#define DT_MSG_RESPONSE_MESSAGE	14
+
+/* SocketFamily and SocketProtocol values */
+#define DT_SOCKET_FAMILY_INET	1
+#define DT_SOCKET_FAMILY_INET6	2
+#define DT_SOCKET_PROTOCOL_UDP	1
+#define DT_SOCKET_PROTOCOL_TCP	2
+
+/* the key of a field, it fits in one byte for the field numbers used */
+#define DT_KEY(field, wire)	((uint8_t)(((field)<<3) | (wire)))
+
+static size_t
+dt_varint_len(uint64_t v)
+{
+	size_t n = 1;
+	while (v >= 0x80) {
+		v >>= 7;
+		n++;
+	}
+	return n;
+}
 
-struct dt_msg {
-	void		*buf;
-	size_t		len_buf;
-	Dnstap__Dnstap	d;
-	Dnstap__Message	m;
-};
+static uint8_t *
+dt_put_varint(uint8_t *p, uint64_t v)
+{
+	while (v >= 0x80) {
+		*p++ = (uint8_t)(v | 0x80);
+		v >>= 7;
+	}
+	*p++ = (uint8_t)v;
+	return p;
+}
 
+static uint8_t *
+dt_put_bytes(uint8_t *p, int field, const uint8_t *data, size_t len)
+{
+	*p++ = DT_KEY(field, DT_WIRE_BYTES);
+	p = dt_put_varint(p, len);
+	memcpy(p, data, len);
+	return p + len;
+}
+
+static uint8_t *
+dt_put_fixed32(uint8_t *p, int field, uint32_t v)
+{
+	*p++ = DT_KEY(field, DT_WIRE_FIXED32);
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+	p[2] = (uint8_t)(v >> 16);
+	p[3] = (uint8_t)(v >> 24);
+	return p + 4;
+}
+
+/* length of a bytes field, with key and length */
+#define DT_BYTES_LEN(len)	(1 + dt_varint_len(len) + (len))
+
+/* get the address and port from the socket address, false if none */
 static int
-dt_pack(const Dnstap__Dnstap *d, void **buf, size_t *sz)
+dt_msg_addr(const struct dt_msg *dm, uint8_t **addr, size_t *addrlen,
+	    uint32_t *port, uint32_t *family)
 {
-	ProtobufCBufferSimple sbuf;
-
-	memset(&sbuf, 0, sizeof(sbuf));
-	sbuf.base.append = protobuf_c_buffer_simple_append;
-	sbuf.len = 0;
-	sbuf.alloced = DNSTAP_INITIAL_BUF_SIZE;
-	sbuf.data = malloc(sbuf.alloced);
-	if (sbuf.data == NULL)
+	if (!dm->ss)
 		return 0;
-	sbuf.must_free_data = 1;
+	if (dm->ss->ss_family == AF_INET6) {
+		struct sockaddr_in6 *s = (struct sockaddr_in6 *) dm->ss;
+		*addr = s->sin6_addr.s6_addr;
+		*addrlen = 16; /* IPv6 */
+		*port = ntohs(s->sin6_port);
+		*family = DT_SOCKET_FAMILY_INET6;
+		return 1;
+	} else if (dm->ss->ss_family == AF_INET) {
+		struct sockaddr_in *s = (struct sockaddr_in *) dm->ss;
+		*addr = (uint8_t *) &s->sin_addr.s_addr;
+		*addrlen = 4; /* IPv4 */
+		*port = ntohs(s->sin_port);
+		*family = DT_SOCKET_FAMILY_INET;
+		return 1;
+	}
+	return 0;
+}
 
-	*sz = dnstap__dnstap__pack_to_buffer(d, (ProtobufCBuffer *) &sbuf);
-	if (sbuf.data == NULL)
-		return 0;
-	*buf = sbuf.data;
+/* length of the encoded Message, without its key and length */
+static size_t
+dt_msg_inner_len(const struct dt_msg *dm)
+{
+	uint8_t *addr;
+	size_t len, addrlen;
+	uint32_t port, family;
 
-	return 1;
+	/* type */
+	len = 1 + dt_varint_len((uint64_t)dm->type);
+	/* socket_family, address and port */
+	if (dt_msg_addr(dm, &addr, &addrlen, &port, &family))
+		len += 2 + DT_BYTES_LEN(addrlen) + 1 + dt_varint_len(port);
+	/* socket_protocol */
+	if (dm->cptype == comm_udp || dm->cptype == comm_tcp)
+		len += 2;
+	if (dm->qtime)
+		len += 1 + dt_varint_len((uint64_t)dm->qtime->tv_sec) + 5;
+	if (dm->qmsg)
+		len += DT_BYTES_LEN(sldns_buffer_limit(dm->qmsg));
+	if (dm->zone)
+		len += DT_BYTES_LEN(dm->zone_len);
+	if (dm->rtime)
+		len += 1 + dt_varint_len((uint64_t)dm->rtime->tv_sec) + 5;
+	if (dm->rmsg)
+		len += DT_BYTES_LEN(sldns_buffer_limit(dm->rmsg));
+	return len;
 }
 
-static void
-dt_send(const struct dt_env *env, void *buf, size_t len_buf)
+size_t
+dt_msg_encode_len(const struct dt_env *env, const struct dt_msg *dm)
 {
-	dt_msg_queue_submit(env->msgqueue, buf, len_buf);
+	size_t len = 0;
+	if (env->identity != NULL)
+		len += DT_BYTES_LEN(env->len_identity);
+	if (env->version != NULL)
+		len += DT_BYTES_LEN(env->len_version);
+	len += DT_BYTES_LEN(dt_msg_inner_len(dm));
+	/* type */
+	len += 2;
+	return len;
 }
 
-static void
-dt_msg_init(const struct dt_env *env,
-	    struct dt_msg *dm,
-	    Dnstap__Message__Type mtype)
+size_t
+dt_msg_encode(const struct dt_env *env, const struct dt_msg *dm,
+	      uint8_t *buf)
 {
-	memset(dm, 0, sizeof(*dm));
-	dm->d.base.descriptor = &dnstap__dnstap__descriptor;
-	dm->m.base.descriptor = &dnstap__message__descriptor;
-	dm->d.type = DNSTAP__DNSTAP__TYPE__MESSAGE;
-	dm->d.message = &dm->m;
-	dm->m.type = mtype;
-	if (env->identity != NULL) {
-		dm->d.identity.data = (uint8_t *) env->identity;
-		dm->d.identity.len = (size_t) env->len_identity;
-		dm->d.has_identity = 1;
-	}
-	if (env->version != NULL) {
-		dm->d.version.data = (uint8_t *) env->version;
-		dm->d.version.len = (size_t) env->len_version;
-		dm->d.has_version = 1;
+	uint8_t *p = buf, *addr = NULL;
+	size_t addrlen = 0;
+	uint32_t port = 0, family = 0;
+	int has_addr;
+
+	/* the fields are written in field number order, like
+	 * protobuf-c does */
+	if (env->identity != NULL)
+		p = dt_put_bytes(p, DT_DNSTAP_IDENTITY,
+			(uint8_t *) env->identity, env->len_identity);
+	if (env->version != NULL)
+		p = dt_put_bytes(p, DT_DNSTAP_VERSION,
+			(uint8_t *) env->version, env->len_version);
+
+	/* message */
+	*p++ = DT_KEY(DT_DNSTAP_MESSAGE, DT_WIRE_BYTES);
+	p = dt_put_varint(p, dt_msg_inner_len(dm));
+	*p++ = DT_KEY(DT_MSG_TYPE, DT_WIRE_VARINT);
+	p = dt_put_varint(p, (uint64_t)dm->type);
+	has_addr = dt_msg_addr(dm, &addr, &addrlen, &port, &family);
+	if (has_addr) {
+		*p++ = DT_KEY(DT_MSG_SOCKET_FAMILY, DT_WIRE_VARINT);
+		*p++ = (uint8_t)family;
+	}
+	if (dm->cptype == comm_udp) {
+		*p++ = DT_KEY(DT_MSG_SOCKET_PROTOCOL, DT_WIRE_VARINT);
+		*p++ = DT_SOCKET_PROTOCOL_UDP;
+	} else if (dm->cptype == comm_tcp) {
+		*p++ = DT_KEY(DT_MSG_SOCKET_PROTOCOL, DT_WIRE_VARINT);
+		*p++ = DT_SOCKET_PROTOCOL_TCP;
+	}
+	if (has_addr && !dm->addr_is_response)
+		p = dt_put_bytes(p, DT_MSG_QUERY_ADDRESS, addr, addrlen);
+	if (has_addr && dm->addr_is_response)
+		p = dt_put_bytes(p, DT_MSG_RESPONSE_ADDRESS, addr, addrlen);
+	if (has_addr) {
+		*p++ = DT_KEY(dm->addr_is_response?DT_MSG_RESPONSE_PORT:
+			DT_MSG_QUERY_PORT, DT_WIRE_VARINT);
+		p = dt_put_varint(p, port);
 	}
+	if (dm->qtime) {
+		*p++ = DT_KEY(DT_MSG_QUERY_TIME_SEC, DT_WIRE_VARINT);
+		p = dt_put_varint(p, (uint64_t)dm->qtime->tv_sec);
+		p = dt_put_fixed32(p, DT_MSG_QUERY_TIME_NSEC,
+			(uint32_t)dm->qtime->tv_usec * 1000);
+	}
+	/* the DNS message is copied from the buffer into the log */
+	if (dm->qmsg)
+		p = dt_put_bytes(p, DT_MSG_QUERY_MESSAGE,
+			sldns_buffer_begin(dm->qmsg),
+			sldns_buffer_limit(dm->qmsg));
+	if (dm->zone)
+		p = dt_put_bytes(p, DT_MSG_QUERY_ZONE, dm->zone, dm->zone_len);
+	if (dm->rtime) {
+		*p++ = DT_KEY(DT_MSG_RESPONSE_TIME_SEC, DT_WIRE_VARINT);
+		p = dt_put_varint(p, (uint64_t)dm->rtime->tv_sec);
+		p = dt_put_fixed32(p, DT_MSG_RESPONSE_TIME_NSEC,
+			(uint32_t)dm->rtime->tv_usec * 1000);
+	}
+	if (dm->rmsg)
+		p = dt_put_bytes(p, DT_MSG_RESPONSE_MESSAGE,
+			sldns_buffer_begin(dm->rmsg),
+			sldns_buffer_limit(dm->rmsg));
+
+	/* type */
+	*p++ = DT_KEY(DT_DNSTAP_TYPE, DT_WIRE_VARINT);
+	*p++ = DT_DNSTAP_TYPE_MESSAGE;
+	return (size_t)(p - buf);
+}
+
+/* encode the message straight into the queue of the worker */
+static void
+dt_send(const struct dt_env *env, const struct dt_msg *dm)
+{
+	size_t len = dt_msg_encode_len(env, dm);
+	uint8_t *buf = dt_msg_queue_reserve(env->msgqueue, len);
+	if (!buf)
+		return; /* the queue is full, it is counted as dropped */
+	dt_msg_queue_commit(env->msgqueue, dt_msg_encode(env, dm, buf));
 }
 
 /* check that the socket file can be opened and exists, print error if not */
@@ -203,6 +383,77 @@ dt_apply_version(struct dt_env *env, struct config_file *cfg)
 		env->version);
 }
 
+static void
+dt_apply_filter_qtype(struct dt_env *env, struct config_file *cfg)
+{
+	char *list, *tok, *next;
+	size_t num = 0;
+
+	free(env->filter_qtype);
+	env->filter_qtype = NULL;
+	env->filter_qtype_num = 0;
+	if (cfg->dnstap_filter_qtype == NULL || cfg->dnstap_filter_qtype[0] == 0)
+		return;
+	if (!(list = strdup(cfg->dnstap_filter_qtype)))
+		fatal_exit("dt_apply_filter_qtype: strdup() failed");
+	/* one entry per word is enough */
+	env->filter_qtype = (uint16_t *) calloc(strlen(list)/2 + 1,
+		sizeof(uint16_t));
+	if (!env->filter_qtype)
+		fatal_exit("dt_apply_filter_qtype: calloc() failed");
+	for (tok = strtok_r(list, " \t,", &next); tok;
+	     tok = strtok_r(NULL, " \t,", &next)) {
+		uint16_t t = (uint16_t)sldns_get_rr_type_by_name(tok);
+		if (t == 0) {
+			log_err("dnstap-filter-qtype: unknown type %s", tok);
+			continue;
+		}
+		env->filter_qtype[num++] = t;
+	}
+	free(list);
+	env->filter_qtype_num = num;
+	if (num == 0) {
+		/* nothing valid was given, log all */
+		free(env->filter_qtype);
+		env->filter_qtype = NULL;
+		return;
+	}
+	verbose(VERB_OPS, "dnstap filter on qtype \"%s\"",
+		cfg->dnstap_filter_qtype);
+}
+
+static void
+dt_apply_filter_rcode(struct dt_env *env, struct config_file *cfg)
+{
+	char *list, *tok, *next;
+
+	env->filter_rcode = 0;
+	if (cfg->dnstap_filter_rcode == NULL || cfg->dnstap_filter_rcode[0] == 0)
+		return;
+	if (!(list = strdup(cfg->dnstap_filter_rcode)))
+		fatal_exit("dt_apply_filter_rcode: strdup() failed");
+	for (tok = strtok_r(list, " \t,", &next); tok;
+	     tok = strtok_r(NULL, " \t,", &next)) {
+		sldns_lookup_table *lt = sldns_lookup_by_name(sldns_rcodes,
+			tok);
+		int r = -1;
+		if (lt)
+			r = lt->id;
+		else if (isdigit((unsigned char)tok[0]))
+			r = atoi(tok);
+		if (r < 0 || r > 15) {
+			/* extended rcodes are not in the header */
+			log_err("dnstap-filter-rcode: unknown rcode %s", tok);
+			continue;
+		}
+		env->filter_rcode |= (uint16_t)(1 << r);
+	}
+	free(list);
+	if (env->filter_rcode)
+		verbose(VERB_OPS, "dnstap filter on rcode \"%s\"",
+			cfg->dnstap_filter_rcode);
+}
+
 void
 dt_apply_cfg(struct dt_env *env, struct config_file *cfg)
 {
@@ -211,6 +462,23 @@ dt_apply_cfg(struct dt_env *env, struct config_file *cfg)
 
 	dt_apply_identity(env, cfg);
 	dt_apply_version(env, cfg);
+	dt_apply_filter_qtype(env, cfg);
+	dt_apply_filter_rcode(env, cfg);
+	if ((env->sample_rate = (unsigned int)cfg->dnstap_sample_rate) > 1)
+		verbose(VERB_OPS, "dnstap sample rate 1 in %u",
+			env->sample_rate);
+	if ((env->filter_local_zone = (unsigned int)
+	     cfg->dnstap_filter_local_zone))
+	{
+		verbose(VERB_OPS, "dnstap client responses for local-zone "
+			"and RPZ answers only");
+	}
+	if ((env->filter_response_time = (unsigned int)
+	     cfg->dnstap_filter_response_time))
+	{
+		verbose(VERB_OPS, "dnstap responses slower than %u msec only",
+			env->filter_response_time);
+	}
 	if ((env->log_resolver_query_messages = (unsigned int)
 	     cfg->dnstap_log_resolver_query_messages))
 	{
@@ -275,81 +543,111 @@ dt_delete(struct dt_env *env)
 	dt_io_thread_delete(env->dtio);
 	free(env->identity);
 	free(env->version);
+	free(env->filter_qtype);
 	free(env);
 }
 
-static void
-dt_fill_timeval(const struct timeval *tv,
-		uint64_t *time_sec, protobuf_c_boolean *has_time_sec,
-		uint32_t *time_nsec, protobuf_c_boolean *has_time_nsec)
+/* find the question of a DNS message, without compression pointers,
+ * returns the qname or NULL if there is no question that can be parsed */
+static uint8_t *
+dt_msg_question(struct sldns_buffer *msg, uint16_t *qtype)
 {
-#ifndef S_SPLINT_S
-	*time_sec = tv->tv_sec;
-	*time_nsec = tv->tv_usec * 1000;
-#endif
-	*has_time_sec = 1;
-	*has_time_nsec = 1;
-}
+	uint8_t *p;
+	size_t len, pos = LDNS_HEADER_SIZE;
 
-static void
-dt_fill_buffer(sldns_buffer *b, ProtobufCBinaryData *p, protobuf_c_boolean *has)
-{
-	log_assert(b != NULL);
-	p->len = sldns_buffer_limit(b);
-	p->data = sldns_buffer_begin(b);
-	*has = 1;
+	if (!msg)
+		return NULL;
+	p = sldns_buffer_begin(msg);
+	len = sldns_buffer_limit(msg);
+	if (len < LDNS_HEADER_SIZE || LDNS_QDCOUNT(p) == 0)
+		return NULL;
+	while (pos < len) {
+		uint8_t lablen = p[pos];
+		if (lablen == 0) {
+			pos++;
+			if (pos + 2 > len)
+				return NULL;
+			*qtype = sldns_read_uint16(p+pos);
+			return p+LDNS_HEADER_SIZE;
+		}
+		if ((lablen & 0xc0))
+			return NULL;
+		pos += (size_t)lablen + 1;
+		if (pos - LDNS_HEADER_SIZE > LDNS_MAX_DOMAINLEN)
+			return NULL;
+	}
+	return NULL;
 }
 
-static void
-dt_msg_fill_net(struct dt_msg *dm,
-		struct sockaddr_storage *ss,
-		enum comm_point_type cptype,
-		ProtobufCBinaryData *addr, protobuf_c_boolean *has_addr,
-		uint32_t *port, protobuf_c_boolean *has_port)
+/* hash of the client subnet, /24 for IPv4 and /56 for IPv6, so that
+ * the sampling keeps all the messages of a client network */
+static uint32_t
+dt_subnet_hash(struct sockaddr_storage *ss)
 {
-	log_assert(ss->ss_family == AF_INET6 || ss->ss_family == AF_INET);
 	if (ss->ss_family == AF_INET6) {
-		struct sockaddr_in6 *s = (struct sockaddr_in6 *) ss;
-
-		/* socket_family */
-		dm->m.socket_family = DNSTAP__SOCKET_FAMILY__INET6;
-		dm->m.has_socket_family = 1;
-
-		/* addr: query_address or response_address */
-		addr->data = s->sin6_addr.s6_addr;
-		addr->len = 16; /* IPv6 */
-		*has_addr = 1;
-
-		/* port: query_port or response_port */
-		*port = ntohs(s->sin6_port);
-		*has_port = 1;
-	} else if (ss->ss_family == AF_INET) {
-		struct sockaddr_in *s = (struct sockaddr_in *) ss;
-
-		/* socket_family */
-		dm->m.socket_family = DNSTAP__SOCKET_FAMILY__INET;
-		dm->m.has_socket_family = 1;
-
-		/* addr: query_address or response_address */
-		addr->data = (uint8_t *) &s->sin_addr.s_addr;
-		addr->len = 4; /* IPv4 */
-		*has_addr = 1;
-
-		/* port: query_port or response_port */
-		*port = ntohs(s->sin_port);
-		*has_port = 1;
+		struct sockaddr_in6 *s6 = (struct sockaddr_in6 *) ss;
+		return hashlittle(&s6->sin6_addr, 7, 0);
 	}
+	return hashlittle(&((struct sockaddr_in *) ss)->sin_addr, 3, 0);
+}
 
-	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	if (cptype == comm_udp) {
-		/* socket_protocol */
-		dm->m.socket_protocol = DNSTAP__SOCKET_PROTOCOL__UDP;
-		dm->m.has_socket_protocol = 1;
-	} else if (cptype == comm_tcp) {
-		/* socket_protocol */
-		dm->m.socket_protocol = DNSTAP__SOCKET_PROTOCOL__TCP;
-		dm->m.has_socket_protocol = 1;
+int
+dt_msg_filter(const struct dt_env *env, const struct dt_msg *dm,
+	      int local_answer)
+{
+	int is_response = (dm->type == DT_MSG_TYPE_CLIENT_RESPONSE ||
+		dm->type == DT_MSG_TYPE_RESOLVER_RESPONSE ||
+		dm->type == DT_MSG_TYPE_FORWARDER_RESPONSE);
+	int is_client = (dm->type == DT_MSG_TYPE_CLIENT_QUERY ||
+		dm->type == DT_MSG_TYPE_CLIENT_RESPONSE);
+	struct sldns_buffer *msg = is_response ? dm->rmsg : dm->qmsg;
+	uint8_t *qname = NULL;
+	uint16_t qtype = 0;
+
+	if (is_response && env->filter_rcode) {
+		if (!msg || sldns_buffer_limit(msg) < LDNS_HEADER_SIZE ||
+		    !(env->filter_rcode & (1 << LDNS_RCODE_WIRE(
+		    sldns_buffer_begin(msg)))))
+			return 0;
+	}
+	if (dm->type == DT_MSG_TYPE_CLIENT_RESPONSE &&
+	    env->filter_local_zone && !local_answer)
+		return 0;
+	if (is_response && !is_client && env->filter_response_time &&
+	    dm->qtime && dm->rtime) {
+		long long msec = ((long long)dm->rtime->tv_sec -
+			(long long)dm->qtime->tv_sec)*1000 +
+			((long long)dm->rtime->tv_usec -
+			(long long)dm->qtime->tv_usec)/1000;
+		if (msec < (long long)env->filter_response_time)
+			return 0;
+	}
+	if (env->filter_qtype || (env->sample_rate > 1 && !is_client))
+		qname = dt_msg_question(msg, &qtype);
+	if (env->filter_qtype) {
+		size_t i;
+		if (!qname)
+			return 0;
+		for (i = 0; i < env->filter_qtype_num; i++)
+			if (env->filter_qtype[i] == qtype)
+				break;
+		if (i == env->filter_qtype_num)
+			return 0;
+	}
+	if (env->sample_rate > 1) {
+		uint32_t h;
+		if (is_client)
+			h = dt_subnet_hash(dm->ss);
+		else if (qname)
+			/* the query and its response have the same
+			 * query name, and are sampled together */
+			h = (uint32_t)dname_query_hash(qname, 0);
+		else
+			return 0;
+		if (h % env->sample_rate != 0)
+			return 0;
 	}
+	return 1;
 }
 
 void
@@ -361,59 +659,52 @@ dt_msg_send_client_query(struct dt_env *env,
 	struct dt_msg dm;
 	struct timeval qtime;
 
-	gettimeofday(&qtime, NULL);
-
-	/* type */
-	dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__CLIENT_QUERY);
-
-	/* query_time */
-	dt_fill_timeval(&qtime,
-			&dm.m.query_time_sec, &dm.m.has_query_time_sec,
-			&dm.m.query_time_nsec, &dm.m.has_query_time_nsec);
-
+	memset(&dm, 0, sizeof(dm));
+	dm.type = DT_MSG_TYPE_CLIENT_QUERY;
 	/* query_message */
-	dt_fill_buffer(qmsg, &dm.m.query_message, &dm.m.has_query_message);
-
+	dm.qmsg = qmsg;
 	/* socket_family, socket_protocol, query_address, query_port */
 	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	dt_msg_fill_net(&dm, qsock, cptype,
-			&dm.m.query_address, &dm.m.has_query_address,
-			&dm.m.query_port, &dm.m.has_query_port);
+	log_assert(qsock->ss_family == AF_INET6 || qsock->ss_family == AF_INET);
+	dm.ss = qsock;
+	dm.cptype = cptype;
+	if (!dt_msg_filter(env, &dm, 0))
+		return;
+
+	/* query_time */
+	gettimeofday(&qtime, NULL);
+	dm.qtime = &qtime;
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	dt_send(env, &dm);
 }
 
 void
 dt_msg_send_client_response(struct dt_env *env,
 			    struct sockaddr_storage *qsock,
 			    enum comm_point_type cptype,
-			    sldns_buffer *rmsg)
+			    sldns_buffer *rmsg,
+			    int local_answer)
 {
 	struct dt_msg dm;
 	struct timeval rtime;
 
-	gettimeofday(&rtime, NULL);
-
-	/* type */
-	dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__CLIENT_RESPONSE);
-
-	/* response_time */
-	dt_fill_timeval(&rtime,
-			&dm.m.response_time_sec, &dm.m.has_response_time_sec,
-			&dm.m.response_time_nsec, &dm.m.has_response_time_nsec);
-
+	memset(&dm, 0, sizeof(dm));
+	dm.type = DT_MSG_TYPE_CLIENT_RESPONSE;
 	/* response_message */
-	dt_fill_buffer(rmsg, &dm.m.response_message, &dm.m.has_response_message);
-
+	dm.rmsg = rmsg;
 	/* socket_family, socket_protocol, query_address, query_port */
 	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	dt_msg_fill_net(&dm, qsock, cptype,
-			&dm.m.query_address, &dm.m.has_query_address,
-			&dm.m.query_port, &dm.m.has_query_port);
+	log_assert(qsock->ss_family == AF_INET6 || qsock->ss_family == AF_INET);
+	dm.ss = qsock;
+	dm.cptype = cptype;
+	if (!dt_msg_filter(env, &dm, local_answer))
+		return;
+
+	/* response_time */
+	gettimeofday(&rtime, NULL);
+	dm.rtime = &rtime;
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	dt_send(env, &dm);
 }
 
 void
@@ -427,41 +718,39 @@ dt_msg_send_outside_query(struct dt_env *env,
 	struct timeval qtime;
 	uint16_t qflags;
 
-	gettimeofday(&qtime, NULL);
 	qflags = sldns_buffer_read_u16_at(qmsg, 2);
 
+	memset(&dm, 0, sizeof(dm));
 	/* type */
 	if (qflags & BIT_RD) {
 		if (!env->log_forwarder_query_messages)
 			return;
-		dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__FORWARDER_QUERY);
+		dm.type = DT_MSG_TYPE_FORWARDER_QUERY;
 	} else {
 		if (!env->log_resolver_query_messages)
 			return;
-		dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__RESOLVER_QUERY);
+		dm.type = DT_MSG_TYPE_RESOLVER_QUERY;
 	}
 
 	/* query_zone */
-	dm.m.query_zone.data = zone;
-	dm.m.query_zone.len = zone_len;
-	dm.m.has_query_zone = 1;
-
-	/* query_time_sec, query_time_nsec */
-	dt_fill_timeval(&qtime,
-			&dm.m.query_time_sec, &dm.m.has_query_time_sec,
-			&dm.m.query_time_nsec, &dm.m.has_query_time_nsec);
-
+	dm.zone = zone;
+	dm.zone_len = zone_len;
 	/* query_message */
-	dt_fill_buffer(qmsg, &dm.m.query_message, &dm.m.has_query_message);
-
+	dm.qmsg = qmsg;
 	/* socket_family, socket_protocol, response_address, response_port */
 	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	dt_msg_fill_net(&dm, rsock, cptype,
-			&dm.m.response_address, &dm.m.has_response_address,
-			&dm.m.response_port, &dm.m.has_response_port);
+	log_assert(rsock->ss_family == AF_INET6 || rsock->ss_family == AF_INET);
+	dm.ss = rsock;
+	dm.addr_is_response = 1;
+	dm.cptype = cptype;
+	if (!dt_msg_filter(env, &dm, 0))
+		return;
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	/* query_time_sec, query_time_nsec */
+	gettimeofday(&qtime, NULL);
+	dm.qtime = &qtime;
+
+	dt_send(env, &dm);
 }
 
 void
@@ -481,43 +770,37 @@ dt_msg_send_outside_response(struct dt_env *env,
 	memcpy(&qflags, qbuf, sizeof(qflags));
 	qflags = ntohs(qflags);
 
+	memset(&dm, 0, sizeof(dm));
 	/* type */
 	if (qflags & BIT_RD) {
 		if (!env->log_forwarder_response_messages)
 			return;
-		dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__FORWARDER_RESPONSE);
+		dm.type = DT_MSG_TYPE_FORWARDER_RESPONSE;
 	} else {
 		if (!env->log_resolver_response_messages)
 			return;
-		dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__RESOLVER_RESPONSE);
+		dm.type = DT_MSG_TYPE_RESOLVER_RESPONSE;
 	}
 
 	/* query_zone */
-	dm.m.query_zone.data = zone;
-	dm.m.query_zone.len = zone_len;
-	dm.m.has_query_zone = 1;
-
+	dm.zone = zone;
+	dm.zone_len = zone_len;
 	/* query_time_sec, query_time_nsec */
-	dt_fill_timeval(qtime,
-			&dm.m.query_time_sec, &dm.m.has_query_time_sec,
-			&dm.m.query_time_nsec, &dm.m.has_query_time_nsec);
-
+	dm.qtime = qtime;
 	/* response_time_sec, response_time_nsec */
-	dt_fill_timeval(rtime,
-			&dm.m.response_time_sec, &dm.m.has_response_time_sec,
-			&dm.m.response_time_nsec, &dm.m.has_response_time_nsec);
-
+	dm.rtime = rtime;
 	/* response_message */
-	dt_fill_buffer(rmsg, &dm.m.response_message, &dm.m.has_response_message);
-
+	dm.rmsg = rmsg;
 	/* socket_family, socket_protocol, response_address, response_port */
 	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	dt_msg_fill_net(&dm, rsock, cptype,
-			&dm.m.response_address, &dm.m.has_response_address,
-			&dm.m.response_port, &dm.m.has_response_port);
+	log_assert(rsock->ss_family == AF_INET6 || rsock->ss_family == AF_INET);
+	dm.ss = rsock;
+	dm.addr_is_response = 1;
+	dm.cptype = cptype;
+	if (!dt_msg_filter(env, &dm, 0))
+		return;
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	dt_send(env, &dm);
 }
 
 #endif /* USE_DNSTAP */
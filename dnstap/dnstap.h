@@ -75,6 +75,63 @@ struct dt_env {
 	unsigned log_forwarder_query_messages : 1;
 	/** whether to log Message/FORWARDER_RESPONSE */
 	unsigned log_forwarder_response_messages : 1;
+	/** whether to log client responses only for local-zone and RPZ
+	 * answers */
+	unsigned filter_local_zone : 1;
+
+	/** log 1 in sample_rate client subnets (client messages) or query
+	 * names (resolver and forwarder messages), 0 logs all */
+	unsigned sample_rate;
+	/** bitmask of header rcodes of responses to log, 0 logs all */
+	uint16_t filter_rcode;
+	/** the qtypes to log, NULL logs all.  The array is shared with the
+	 * copies of the environment for the workers. */
+	uint16_t *filter_qtype;
+	/** number of entries in filter_qtype */
+	size_t filter_qtype_num;
+	/** log resolver and forwarder responses that took at least this
+	 * many msec, 0 logs all */
+	unsigned filter_response_time;
+};
+
+/** dnstap Message types, the Message.Type values from dnstap.proto */
+enum dt_msg_type {
+	DT_MSG_TYPE_RESOLVER_QUERY = 3,
+	DT_MSG_TYPE_RESOLVER_RESPONSE = 4,
+	DT_MSG_TYPE_CLIENT_QUERY = 5,
+	DT_MSG_TYPE_CLIENT_RESPONSE = 6,
+	DT_MSG_TYPE_FORWARDER_QUERY = 7,
+	DT_MSG_TYPE_FORWARDER_RESPONSE = 8
+};
+
+/**
+ * The contents of a dnstap "Message" event, that is encoded in the
+ * protobuf wire format with dt_msg_encode.  The fields point to the data,
+ * such as the DNS message in the buffer, that is not copied until it
+ * is encoded.  Fields that are NULL are left out.
+ */
+struct dt_msg {
+	/** the message type */
+	enum dt_msg_type type;
+	/** the address and port of the client or of the server */
+	struct sockaddr_storage *ss;
+	/** if true, ss is the response_address and port, otherwise
+	 * the query_address and port */
+	int addr_is_response;
+	/** comm_udp or comm_tcp, for the socket_protocol */
+	enum comm_point_type cptype;
+	/** the query zone */
+	uint8_t *zone;
+	/** length of zone */
+	size_t zone_len;
+	/** the query time */
+	const struct timeval *qtime;
+	/** the response time */
+	const struct timeval *rtime;
+	/** the query message */
+	struct sldns_buffer *qmsg;
+	/** the response message */
+	struct sldns_buffer *rmsg;
 };
 
 /**
@@ -119,6 +176,42 @@ void dt_deinit(struct dt_env *env);
 void
 dt_delete(struct dt_env *env);
 
+/**
+ * Get the length of the encoded dnstap message.
+ * @param env: dnstap environment object, with identity and version.
+ * @param dm: the message contents.
+ * @return the length in bytes of the Dnstap protobuf.
+ */
+size_t
+dt_msg_encode_len(const struct dt_env *env, const struct dt_msg *dm);
+
+/**
+ * Encode the dnstap message in the protobuf wire format, without
+ * allocations.  The output is the same as that of protobuf-c.
+ * @param env: dnstap environment object, with identity and version.
+ * @param dm: the message contents.
+ * @param buf: destination, it must have space for dt_msg_encode_len bytes.
+ * @return the number of bytes written.
+ */
+size_t
+dt_msg_encode(const struct dt_env *env, const struct dt_msg *dm,
+	      uint8_t *buf);
+
+/**
+ * Check the message against the sampling and the filters of the dnstap
+ * environment.  This is done before the message is timestamped and
+ * encoded, so that messages that are skipped cost little.
+ * @param env: dnstap environment object.
+ * @param dm: the message contents, the time fields are only used for
+ *	resolver and forwarder responses.
+ * @param local_answer: true for a client response answered from
+ *	local-zone or RPZ data.
+ * @return true if the message is to be logged.
+ */
+int
+dt_msg_filter(const struct dt_env *env, const struct dt_msg *dm,
+	      int local_answer);
+
 /**
  * Create and send a new dnstap "Message" event of type CLIENT_QUERY.
  * @param env: dnstap environment object.
@@ -138,12 +231,14 @@ dt_msg_send_client_query(struct dt_env *env,
  * @param qsock: address/port of client.
  * @param cptype: comm_udp or comm_tcp.
  * @param rmsg: response message.
+ * @param local_answer: true if answered from local-zone or RPZ data.
  */
 void
 dt_msg_send_client_response(struct dt_env *env,
 			    struct sockaddr_storage *qsock,
 			    enum comm_point_type cptype,
-			    struct sldns_buffer *rmsg);
+			    struct sldns_buffer *rmsg,
+			    int local_answer);
 
 /**
  * Create and send a new dnstap "Message" event of type RESOLVER_QUERY or
@@ -60,7 +60,7 @@
 #include <openssl/err.h>
 #endif
 
-/** number of messages to process in one output callback */
+/** number of message batches to process in one output callback */
 #define DTIO_MESSAGES_PER_CALLBACK 100
 /** the msec to wait for reconnect (if not immediate, the first attempt) */
 #define DTIO_RECONNECT_TIMEOUT_MIN 10
@@ -74,6 +74,38 @@
 /** maximum length of received frame */
 #define DTIO_RECV_FRAME_MAX_LEN 1000
 
+#ifdef __ATOMIC_SEQ_CST
+/* The head and tail of the ring are shared by the worker and the io
+ * thread.  Sequentially consistent, so that the worker that publishes
+ * and then reads the tail, and the io thread that releases and then
+ * reads the head, do not both miss the change of the other, and leave
+ * a message without a wakeup. */
+/** read a position of the ring, that the other thread changes */
+#define dt_mq_get(mq, p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+/** change a position of the ring, that the other thread reads */
+#define dt_mq_set(mq, p, v) __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#else
+/** read a position of the ring, that the other thread changes */
+static size_t
+dt_mq_get(struct dt_msg_queue* mq, size_t* p)
+{
+	size_t v;
+	lock_basic_lock(&mq->lock);
+	v = *p;
+	lock_basic_unlock(&mq->lock);
+	return v;
+}
+
+/** change a position of the ring, that the other thread reads */
+static void
+dt_mq_set(struct dt_msg_queue* mq, size_t* p, size_t v)
+{
+	lock_basic_lock(&mq->lock);
+	*p = v;
+	lock_basic_unlock(&mq->lock);
+}
+#endif /* __ATOMIC_SEQ_CST */
+
 struct stop_flush_info;
 /** DTIO command channel commands */
 enum {
@@ -108,41 +140,50 @@ dt_msg_queue_create(struct comm_base* base)
 	mq->maxsize = 1*1024*1024; /* set max size of buffer, per worker,
 		about 1 M should contain 64K messages with some overhead,
 		or a whole bunch smaller ones */
+	mq->ring = malloc(mq->maxsize);
+	if(!mq->ring) {
+		free(mq);
+		return NULL;
+	}
 	mq->wakeup_timer = comm_timer_create(base, mq_wakeup_cb, mq);
 	if(!mq->wakeup_timer) {
+		free(mq->ring);
 		free(mq);
 		return NULL;
 	}
 	lock_basic_init(&mq->lock);
-	lock_protect(&mq->lock, mq, sizeof(*mq));
+	lock_protect(&mq->lock, &mq->io_busy, sizeof(mq->io_busy));
+	lock_protect(&mq->lock, &mq->io_orphan, sizeof(mq->io_orphan));
 	return mq;
 }
 
-/** clear the message list, caller must hold the lock */
+/** free the message queue */
 static void
-dt_msg_queue_clear(struct dt_msg_queue* mq)
+dt_msg_queue_free(struct dt_msg_queue* mq)
 {
-	struct dt_msg_entry* e = mq->first, *next=NULL;
-	while(e) {
-		next = e->next;
-		free(e->buf);
-		free(e);
-		e = next;
-	}
-	mq->first = NULL;
-	mq->last = NULL;
-	mq->cursize = 0;
-	mq->msgcount = 0;
+	lock_basic_destroy(&mq->lock);
+	free(mq->ring);
+	free(mq);
 }
 
 void
 dt_msg_queue_delete(struct dt_msg_queue* mq)
 {
+	int busy;
 	if(!mq) return;
-	lock_basic_destroy(&mq->lock);
-	dt_msg_queue_clear(mq);
 	comm_timer_delete(mq->wakeup_timer);
-	free(mq);
+	mq->wakeup_timer = NULL;
+	lock_basic_lock(&mq->lock);
+	busy = mq->io_busy;
+	if(busy)
+		mq->io_orphan = 1;
+	lock_basic_unlock(&mq->lock);
+	if(busy) {
+		/* the io thread is writing a frame out of the ring, it
+		 * deletes the queue when it is done */
+		return;
+	}
+	dt_msg_queue_free(mq);
 }
 
 /** make the dtio wake up by sending a wakeup command */
@@ -219,11 +260,95 @@ dt_msg_queue_start_timer(struct dt_msg_queue* mq)
 	comm_timer_set(mq->wakeup_timer, &tv);
 }
 
+/** the position in the ring of the byte count */
+#define DT_MQ_POS(mq, c) ((c) & ((mq)->maxsize - 1))
+
+uint8_t*
+dt_msg_queue_reserve(struct dt_msg_queue* mq, size_t len)
+{
+	size_t total = len + 4, pos;
+	if(!mq || len == 0)
+		return NULL;
+	log_assert(mq->resv_len == 0);
+	if(total > mq->maxsize) {
+		mq->num_dropped++;
+		return NULL;
+	}
+	pos = mq->head;
+	if(DT_MQ_POS(mq, pos) + total > mq->maxsize) {
+		/* continue at the start, the end of the ring is skipped */
+		pos += mq->maxsize - DT_MQ_POS(mq, pos);
+	}
+	if(pos + total - mq->p_tail > mq->maxsize) {
+		/* get the progress of the io thread and look again */
+		mq->p_tail = dt_mq_get(mq, &mq->tail);
+		if(pos + total - mq->p_tail > mq->maxsize) {
+			/* buffer full, or congested. */
+			/* drop */
+			mq->num_dropped++;
+			return NULL;
+		}
+	}
+	mq->resv_pos = pos;
+	mq->resv_len = total;
+	return mq->ring + DT_MQ_POS(mq, pos) + 4;
+}
+
 void
-dt_msg_queue_submit(struct dt_msg_queue* mq, void* buf, size_t len)
+dt_msg_queue_commit(struct dt_msg_queue* mq, size_t len)
 {
 	int wakeupnow = 0, wakeupstarttimer = 0;
-	struct dt_msg_entry* entry;
+	size_t total = len + 4, old, used, msgcount;
+	if(!mq || mq->resv_len == 0)
+		return;
+	if(len == 0) {
+		/* cancelled, nothing to log */
+		mq->resv_len = 0;
+		return;
+	}
+	log_assert(total <= mq->resv_len);
+	/* the frame length, that precedes the data frame */
+	sldns_write_uint32(mq->ring + DT_MQ_POS(mq, mq->resv_pos),
+		(uint32_t)len);
+	old = mq->head;
+	if(mq->resv_pos != old) {
+		/* the frame is at the start of the ring, the data in the
+		 * top part stops at the old head */
+		mq->end = DT_MQ_POS(mq, old);
+	} else if(DT_MQ_POS(mq, old) + total == mq->maxsize) {
+		/* the frame fills the ring up to the end */
+		mq->end = mq->maxsize;
+	}
+	msgcount = mq->num_put - dt_mq_get(mq, &mq->num_done);
+	mq->num_put++;
+	/* publish the frame */
+	dt_mq_set(mq, &mq->head, mq->resv_pos + total);
+	mq->resv_len = 0;
+
+	/* take along the progress of the io thread */
+	mq->p_tail = dt_mq_get(mq, &mq->tail);
+	used = mq->head - mq->p_tail;
+	/* if the ring was empty, start timer for (eventual) wakeup */
+	if(old == mq->p_tail)
+		wakeupstarttimer = 1;
+	/* if the ring contains more than wakeupnum messages, wakeup now,
+	 * or if the ring is (going to be) almost full */
+	if(msgcount == DTIO_MSG_FOR_WAKEUP ||
+		(old - mq->p_tail < mq->maxsize * 9 / 10 &&
+		used >= mq->maxsize * 9 / 10))
+		wakeupnow = 1;
+
+	if(wakeupnow) {
+		dtio_wakeup(mq->dtio);
+	} else if(wakeupstarttimer) {
+		dt_msg_queue_start_timer(mq);
+	}
+}
+
+void
+dt_msg_queue_submit(struct dt_msg_queue* mq, void* buf, size_t len)
+{
+	uint8_t* dest;
 
 	/* check conditions */
 	if(!buf) return;
@@ -240,54 +365,27 @@ dt_msg_queue_submit(struct dt_msg_queue* mq, void* buf, size_t len)
 		return;
 	}
 
-	/* allocate memory for queue entry */
-	entry = malloc(sizeof(*entry));
-	if(!entry) {
-		log_err("out of memory logging dnstap");
-		free(buf);
-		return;
+	/* copy into the ring, if it is going to fit */
+	dest = dt_msg_queue_reserve(mq, len);
+	if(dest) {
+		memcpy(dest, buf, len);
+		dt_msg_queue_commit(mq, len);
 	}
-	entry->next = NULL;
-	entry->buf = buf;
-	entry->len = len;
-
-	/* aqcuire lock */
-	lock_basic_lock(&mq->lock);
-	/* if list was empty, start timer for (eventual) wakeup */
-	if(mq->first == NULL)
-		wakeupstarttimer = 1;
-	/* if list contains more than wakeupnum elements, wakeup now,
-	 * or if list is (going to be) almost full */
-	if(mq->msgcount == DTIO_MSG_FOR_WAKEUP ||
-		(mq->cursize < mq->maxsize * 9 / 10 &&
-		mq->cursize+len >= mq->maxsize * 9 / 10))
-		wakeupnow = 1;
-	/* see if it is going to fit */
-	if(mq->cursize + len > mq->maxsize) {
-		/* buffer full, or congested. */
-		/* drop */
-		lock_basic_unlock(&mq->lock);
-		free(buf);
-		free(entry);
-		return;
-	}
-	mq->cursize += len;
-	mq->msgcount ++;
-	/* append to list */
-	if(mq->last) {
-		mq->last->next = entry;
-	} else {
-		mq->first = entry;
-	}
-	mq->last = entry;
-	/* release lock */
-	lock_basic_unlock(&mq->lock);
+	free(buf);
+}
 
-	if(wakeupnow) {
-		dtio_wakeup(mq->dtio);
-	} else if(wakeupstarttimer) {
-		dt_msg_queue_start_timer(mq);
-	}
+void
+dt_msg_queue_get_stats(struct dt_msg_queue* mq, size_t* queued,
+	size_t* dropped, int reset)
+{
+	*queued = 0;
+	*dropped = 0;
+	if(!mq) return;
+	/* called by the worker, that owns the producer side */
+	*queued = mq->num_put - dt_mq_get(mq, &mq->num_done);
+	*dropped = mq->num_dropped;
+	if(reset)
+		mq->num_dropped = 0;
 }
 
 struct dt_io_thread* dt_io_thread_create(void)
@@ -479,43 +577,18 @@ void dt_io_thread_unregister_queue(struct dt_io_thread* dtio,
 	}
 }
 
-/** pick a message from the queue, the routine locks and unlocks,
- * returns true if there is a message */
-static int dt_msg_queue_pop(struct dt_msg_queue* mq, void** buf,
-	size_t* len)
-{
-	lock_basic_lock(&mq->lock);
-	if(mq->first) {
-		struct dt_msg_entry* entry = mq->first;
-		mq->first = entry->next;
-		if(!entry->next) mq->last = NULL;
-		mq->cursize -= entry->len;
-		mq->msgcount --;
-		lock_basic_unlock(&mq->lock);
-
-		*buf = entry->buf;
-		*len = entry->len;
-		free(entry);
-		return 1;
-	}
-	lock_basic_unlock(&mq->lock);
-	return 0;
-}
-
-/** find message in queue, false if no message, true if message to send */
+/** see if there are messages in the queue, and if so, set it as the
+ * queue that is written by the io thread.  false if no message */
 static int dtio_find_in_queue(struct dt_io_thread* dtio,
 	struct dt_msg_queue* mq)
 {
-	void* buf=NULL;
-	size_t len=0;
-	if(dt_msg_queue_pop(mq, &buf, &len)) {
-		dtio->cur_msg = buf;
-		dtio->cur_msg_len = len;
-		dtio->cur_msg_done = 0;
-		dtio->cur_msg_len_done = 0;
-		return 1;
-	}
-	return 0;
+	if(dt_mq_get(mq, &mq->head) == mq->tail)
+		return 0;
+	lock_basic_lock(&mq->lock);
+	mq->io_busy = 1;
+	lock_basic_unlock(&mq->lock);
+	dtio->cur_mq = mq;
+	return 1;
 }
 
 /** find a new message to write, search message queues, false if none */
@@ -523,6 +596,10 @@ static int dtio_find_msg(struct dt_io_thread* dtio)
 {
 	struct dt_io_list_item *spot, *item;
 
+	/* continue with the queue that a frame is partially written from */
+	if(dtio->cur_mq)
+		return 1;
+
 	spot = dtio->io_list_iter;
 	/* use the next queue for the next message lookup,
 	 * if we hit the end(NULL) the NULL restarts the iter at start. */
@@ -635,6 +712,67 @@ static void dtio_cur_msg_free(struct dt_io_thread* dtio)
 	dtio->cur_msg_len_done = 0;
 }
 
+/** see if the data in the ring stops at the tail, in the top part of the
+ * ring, and the frames continue at the start of the ring.
+ * @param mq: the queue.
+ * @param head: the head, read by the io thread.
+ * @param tail: the tail.
+ * @return the number of bytes to skip at the end of the ring, or 0. */
+static size_t dt_msg_queue_skip(struct dt_msg_queue* mq, size_t head,
+	size_t tail)
+{
+	size_t pos = DT_MQ_POS(mq, tail);
+	/* the end is only set if the head is in the next pass */
+	if(pos != 0 && head - tail >= mq->maxsize - pos && pos == mq->end)
+		return mq->maxsize - pos;
+	return 0;
+}
+
+/** release bytes from the ring that have been written, and the number
+ * of frames that are done */
+static void dt_msg_queue_advance(struct dt_msg_queue* mq, size_t len,
+	size_t frames)
+{
+	size_t pos = DT_MQ_POS(mq, mq->tail);
+	size_t head = dt_mq_get(mq, &mq->head);
+	if(pos != 0 && head - mq->tail >= mq->maxsize - pos &&
+		len >= mq->end - pos) {
+		/* the bytes continue at the start of the ring, the end of
+		 * the ring is skipped */
+		len += mq->maxsize - mq->end;
+	}
+	dt_mq_set(mq, &mq->num_done, mq->num_done + frames);
+	dt_mq_set(mq, &mq->tail, mq->tail + len);
+}
+
+/** release the queue that the io thread has been writing from */
+static void dtio_cur_mq_release(struct dt_io_thread* dtio)
+{
+	struct dt_msg_queue* mq = dtio->cur_mq;
+	int orphan;
+	if(!mq) return;
+	dtio->cur_mq = NULL;
+	lock_basic_lock(&mq->lock);
+	mq->io_busy = 0;
+	orphan = mq->io_orphan;
+	lock_basic_unlock(&mq->lock);
+	if(orphan)
+		dt_msg_queue_free(mq);
+}
+
+/** drop the remainder of the partially written frame, because a new
+ * connection has to start with a new frame, and release the queue */
+static void dtio_cur_mq_discard(struct dt_io_thread* dtio)
+{
+	struct dt_msg_queue* mq = dtio->cur_mq;
+	if(!mq) return;
+	if(mq->partial != 0) {
+		dt_msg_queue_advance(mq, mq->partial, 1);
+		mq->partial = 0;
+	}
+	dtio_cur_mq_release(dtio);
+}
+
 /** delete the buffer and counters used to read frame */
 static void dtio_read_frame_free(struct dt_frame_read_buf* rb)
 {
@@ -688,6 +826,7 @@ static void dtio_close_output(struct dt_io_thread* dtio)
 	if(dtio->cur_msg) {
 		dtio_cur_msg_free(dtio);
 	}
+	dtio_cur_mq_discard(dtio);
 
 	dtio->ready_frame_sent = 0;
 	dtio->accept_frame_received = 0;
@@ -945,6 +1084,140 @@ static int dtio_write_more(struct dt_io_thread* dtio)
 	return 1;
 }
 
+/** write the two parts of the data, in one write, if possible.
+ * returns number of bytes written, 0 if nothing happened,
+ * try again later, or -1 if the channel is to be closed. */
+static ssize_t dtio_write_iov(struct dt_io_thread* dtio, uint8_t* b1,
+	size_t l1, uint8_t* b2, size_t l2)
+{
+#ifdef HAVE_WRITEV
+	struct iovec iov[2];
+	ssize_t r;
+	if(dtio->ssl || l2 == 0)
+		return dtio_write_buf(dtio, b1, l1);
+	if(dtio->fd == -1)
+		return -1;
+	iov[0].iov_base = b1;
+	iov[0].iov_len = l1;
+	iov[1].iov_base = b2;
+	iov[1].iov_len = l2;
+	r = writev(dtio->fd, iov, 2);
+	if(r == -1) {
+#ifndef USE_WINSOCK
+		if(errno == EINTR || errno == EAGAIN)
+			return 0;
+#else
+		if(WSAGetLastError() == WSAEINPROGRESS)
+			return 0;
+		if(WSAGetLastError() == WSAEWOULDBLOCK) {
+			ub_winsock_tcp_wouldblock((dtio->stop_flush_event?
+				dtio->stop_flush_event:dtio->event),
+				UB_EV_WRITE);
+			return 0;
+		}
+#endif
+		log_err("dnstap io: failed writev: %s", sock_strerror(errno));
+		return -1;
+	}
+	return r;
+#else
+	(void)b2; (void)l2;
+	return dtio_write_buf(dtio, b1, l1);
+#endif /* HAVE_WRITEV */
+}
+
+/** the io thread has written len bytes from the ring, starting at the
+ * read position, b1 and b2 are the two parts of the ring data that
+ * were written.  Count the frames that are done, and release the bytes. */
+static void dtio_cur_mq_written(struct dt_msg_queue* mq, uint8_t* b1,
+	size_t l1, uint8_t* b2, size_t len)
+{
+	size_t off = 0, frames = 0;
+	/* the rest of the frame that was partially written */
+	if(mq->partial != 0) {
+		if(len < mq->partial) {
+			mq->partial -= len;
+			off = len;
+		} else {
+			off = mq->partial;
+			mq->partial = 0;
+			frames++;
+		}
+	}
+	/* frames do not cross from the first to the second part */
+	while(off < len) {
+		uint8_t* f = (off < l1)? b1+off : b2+(off-l1);
+		size_t flen = 4 + (size_t)sldns_read_uint32(f);
+		if(off + flen > len) {
+			mq->partial = off + flen - len;
+			break;
+		}
+		off += flen;
+		frames++;
+	}
+	dt_msg_queue_advance(mq, len, frames);
+}
+
+/** write a batch of frames from the ring of the current queue, all the
+ * frames that are in the ring, with one write, if possible.
+ * If partial_only, only the remainder of the partially written frame
+ * is written.
+ * return true if the batch is done, false if incomplete */
+static int dtio_write_batch(struct dt_io_thread* dtio, int partial_only)
+{
+	struct dt_msg_queue* mq = dtio->cur_mq;
+	uint8_t* b1, *b2 = NULL;
+	size_t l1, l2 = 0, head, skip, pos;
+	ssize_t r;
+
+	head = dt_mq_get(mq, &mq->head);
+	if((skip = dt_msg_queue_skip(mq, head, mq->tail)) != 0)
+		dt_mq_set(mq, &mq->tail, mq->tail + skip);
+	pos = DT_MQ_POS(mq, mq->tail);
+	b1 = mq->ring + pos;
+	if(pos != 0 && head - mq->tail >= mq->maxsize - pos) {
+		/* the head is in the next pass, the data continues at
+		 * the start of the ring */
+		l1 = mq->end - pos;
+		b2 = mq->ring;
+		l2 = head - mq->tail - (mq->maxsize - pos);
+	} else {
+		l1 = head - mq->tail;
+	}
+
+	if(partial_only) {
+		if(l1 >= mq->partial) {
+			l1 = mq->partial;
+			l2 = 0;
+		} else if(l1 + l2 > mq->partial) {
+			l2 = mq->partial - l1;
+		}
+	}
+#ifdef HAVE_WRITEV
+	if(dtio->ssl)
+		l2 = 0; /* the second part is written after this one */
+#else
+	l2 = 0; /* the second part is written after this one */
+#endif
+	if(l1 == 0)
+		return 1;
+
+	r = dtio_write_iov(dtio, b1, l1, b2, l2);
+	if(r == -1) {
+		/* close the channel */
+		dtio_del_output_event(dtio);
+		dtio_close_output(dtio);
+		return 0;
+	} else if(r == 0) {
+		/* try again later */
+		return 0;
+	}
+	dtio_cur_mq_written(mq, b1, l1, b2, (size_t)r);
+	if((size_t)r < l1 + l2)
+		return 0;
+	return 1;
+}
+
 /** Receive bytes from dtio->fd, store in buffer. Returns 0: closed,
  * -1: continue, >0: number of bytes read into buffer */
 static ssize_t receive_bytes(struct dt_io_thread* dtio, void* buf, size_t len) {
@@ -1501,35 +1774,44 @@ void dtio_output_cb(int ATTR_UNUSED(fd), short bits, void* arg)
 	 * If there are no (more) messages, or if the output buffers get
 	 * full, it returns out of the loop. */
 	for(i=0; i<DTIO_MESSAGES_PER_CALLBACK; i++) {
-		/* see if there are messages that need writing */
-		if(!dtio->cur_msg) {
-			if(!dtio_find_msg(dtio)) {
-				if(i == 0) {
-					/* no messages on the first iteration,
-					 * the queues are all empty */
-					dtio_sleep(dtio);
-				}
-				return; /* nothing to do */
+		/* a control frame is written first */
+		if(dtio->cur_msg) {
+			if(dtio->cur_msg_done < dtio->cur_msg_len) {
+				if(!dtio_write_more(dtio))
+					return;
+			}
+
+			/* done with the current message */
+			dtio_cur_msg_free(dtio);
+
+			/* If this is a bidirectional stream the first message
+			 * will be the READY control frame. We can only
+			 * continue writing after receiving an ACCEPT control
+			 * frame. */
+			if(dtio->is_bidirectional && !dtio->ready_frame_sent) {
+				dtio->ready_frame_sent = 1;
+				(void)dtio_add_output_event_read(dtio);
+				break;
 			}
+			continue;
 		}
 
-		/* write it */
-		if(dtio->cur_msg_done < dtio->cur_msg_len) {
-			if(!dtio_write_more(dtio))
-				return;
+		/* see if there are messages that need writing */
+		if(!dtio_find_msg(dtio)) {
+			if(i == 0) {
+				/* no messages on the first iteration,
+				 * the queues are all empty */
+				dtio_sleep(dtio);
+			}
+			return; /* nothing to do */
 		}
 
-		/* done with the current message */
-		dtio_cur_msg_free(dtio);
+		/* write the frames in the queue */
+		if(!dtio_write_batch(dtio, 0))
+			return;
 
-		/* If this is a bidirectional stream the first message will be
-		 * the READY control frame. We can only continue writing after
-		 * receiving an ACCEPT control frame. */
-		if(dtio->is_bidirectional && !dtio->ready_frame_sent) {
-			dtio->ready_frame_sent = 1;
-			(void)dtio_add_output_event_read(dtio);
-			break;
-		}
+		/* done with the frames of this queue */
+		dtio_cur_mq_release(dtio);
 	}
 }
 
@@ -1745,6 +2027,22 @@ void dtio_stop_ev_cb(int ATTR_UNUSED(fd), short bits, void* arg)
 			"last frame");
 		dtio_cur_msg_free(dtio);
 	}
+	/* write remainder of last frame from the queue */
+	if(dtio->cur_mq) {
+		if(dtio->cur_mq->partial != 0) {
+			if(!dtio_write_batch(dtio, 1)) {
+				if(dtio->fd == -1) {
+					verbose(VERB_ALGO, "dnstap io: "
+						"stop flush: output closed");
+					dtio_stop_flush_exit(info);
+				}
+				return;
+			}
+			verbose(VERB_ALGO, "dnstap io: stop flush completed "
+				"last frame");
+		}
+		dtio_cur_mq_release(dtio);
+	}
 	/* write stop frame */
 	if(info->stop_frame_done < info->stop_frame_len) {
 		if(!dtio_control_stop_send(info))
@@ -1864,6 +2162,7 @@ static void dtio_desetup(struct dt_io_thread* dtio)
 	dtio_reconnect_del(dtio);
 	ub_event_free(dtio->reconnect_timer);
 	dtio_cur_msg_free(dtio);
+	dtio_cur_mq_discard(dtio);
 #ifndef THREADS_DISABLED
 	ub_event_base_free(dtio->event_base);
 #endif
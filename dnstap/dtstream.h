@@ -45,7 +45,6 @@
 #define DTSTREAM_H
 
 #include "util/locks.h"
-struct dt_msg_entry;
 struct dt_io_list_item;
 struct dt_io_thread;
 struct config_file;
@@ -53,46 +52,77 @@ struct comm_base;
 
 /**
  * A message buffer with dnstap messages queued up.  It is per-worker.
- * It has locks to synchronize.  If the buffer is full, a new message
- * cannot be added and is discarded.  A thread reads the messages and sends
- * them.
+ * It is a preallocated ring of bytes, that contains the messages as
+ * Frame Streams data frames, the 4 byte length followed by the data.
+ * A frame is never split over the end of the ring, if it does not fit
+ * at the end, the producer continues at the start, and the end marks
+ * where the data stops in the top part of the ring.
+ *
+ * The worker is the only producer and the io thread is the only
+ * consumer.  The positions in the ring are counts of bytes since the
+ * start, the position in the ring is the count modulo the size.  The
+ * worker writes a frame past the head and publishes it by moving the
+ * head, the io thread writes out the frames up to the head and
+ * releases them by moving the tail.  The head and tail are read and
+ * written with atomic operations, no lock is taken for a message.
+ * If the buffer is full, a new message cannot be added and is
+ * discarded, this is counted.
  */
 struct dt_msg_queue {
-	/** lock of the buffer structure.  Hold this lock to add or remove
-	 * entries to the buffer.  Release it so that other threads can also
-	 * put messages to log, or a message can be taken out to send away
-	 * by the writer thread.
-	 */
+	/** lock of the queue registration, of io_busy and io_orphan,
+	 * and of the head and tail if there are no atomic operations. */
 	lock_basic_type lock;
-	/** the maximum size of the buffer, in bytes */
+	/** the ring buffer, malloced, maxsize bytes */
+	uint8_t* ring;
+	/** the maximum size of the buffer, in bytes, a power of two */
 	size_t maxsize;
-	/** current size of the buffer, in bytes.  data bytes of messages.
-	 * If a new message make it more than maxsize, the buffer is full */
-	size_t cursize;
-	/** number of messages in the queue */
-	int msgcount;
-	/** list of messages.  The messages are added to the back and taken
-	 * out from the front. */
-	struct dt_msg_entry* first, *last;
+	/** count of bytes published by the worker, including the bytes that
+	 * are skipped at the end of the ring.  Changed by the worker. */
+	size_t head;
+	/** count of bytes released by the io thread, the io thread
+	 * continues writing the output from here.  Changed by the io
+	 * thread. */
+	size_t tail;
+	/** end of the data in the ring, in the pass of the ring that
+	 * the io thread reads, if the head is in the next pass.  Set by
+	 * the worker before it moves the head to the next pass. */
+	size_t end;
+	/** number of messages published, changed by the worker */
+	size_t num_put;
+	/** number of messages written out, changed by the io thread */
+	size_t num_done;
+	/** number of messages dropped because the buffer was full,
+	 * changed by the worker */
+	size_t num_dropped;
+
+	/** producer side: copy of tail from the last time the
+	 * producer read it.  The io thread only moves tail forwards,
+	 * so the free space computed from it is a conservative amount. */
+	size_t p_tail;
+	/** producer side: byte count of the start of the reserved frame */
+	size_t resv_pos;
+	/** producer side: length of the reserved frame, with the length
+	 * field, 0 if no frame is reserved. */
+	size_t resv_len;
+
+	/** io thread side, number of bytes still to write out of the
+	 * frame that the io thread has partially written, if nonzero the
+	 * tail is in the middle of that frame. */
+	size_t partial;
+	/** if the io thread is using the queue, and has a reference to it.
+	 * Protected by the lock. */
+	int io_busy;
+	/** if the queue is deleted by the worker while the io thread was
+	 * busy with it.  The io thread deletes it when it is done.
+	 * Protected by the lock. */
+	int io_orphan;
+
 	/** reference to the io thread to wakeup */
 	struct dt_io_thread* dtio;
 	/** the wakeup timer for dtio, on worker event base */
 	struct comm_timer* wakeup_timer;
 };
 
-/**
- * An entry in the dt_msg_queue. contains one DNSTAP message.
- * It is malloced.
- */
-struct dt_msg_entry {
-	/** next in the list. */
-	struct dt_msg_entry* next;
-	/** the buffer with the data to send, an encoded DNSTAP message */
-	void* buf;
-	/** the length to send. */
-	size_t len;
-};
-
 /**
  * Containing buffer and counter for reading DNSTAP frames.
  */
@@ -170,6 +200,9 @@ struct dt_io_thread {
 	/** number of bytes of the length that have been written,
 	 * for the current message length that precedes the frame */
 	size_t cur_msg_len_done;
+	/** the queue that is currently getting written, in batches of
+	 * frames straight from its ring, or NULL if none. */
+	struct dt_msg_queue* cur_mq;
 
 	/** lock on wakeup_timer_enabled */
 	lock_basic_type wakeup_timer_lock;
@@ -250,24 +283,55 @@ struct dt_msg_queue* dt_msg_queue_create(struct comm_base* base);
 /**
  * Delete a worker message queue.  It has to be unlinked from access,
  * so it can be deleted without lock worries.  The queue is emptied (deleted).
+ * If the io thread is still writing a frame out of the ring, the io
+ * thread deletes the queue when it is done with it.
  * @param mq: message queue.
  */
 void dt_msg_queue_delete(struct dt_msg_queue* mq);
 
 /**
- * Submit a message to the queue.  The queue is locked by the routine,
- * the message is inserted, and then the queue is unlocked so the
- * message can be picked up by the writer thread.
+ * Submit a message to the queue.  The message is copied into the ring
+ * of the queue, and published so that it can be picked up by the
+ * writer thread.
  * @param mq: message queue.
  * @param buf: buffer with message (dnstap contents).
- * 	The buffer must have been malloced by caller.  It is linked in
- * 	the queue, and is free()d after use.  If the routine fails
- * 	the buffer is freed as well (and nothing happens, the item
- * 	could not be logged).
+ * 	The buffer must have been malloced by caller.  It is free()d after
+ * 	use.  If the routine fails the buffer is freed as well (and nothing
+ * 	happens, the item could not be logged).
  * @param len: length of buffer.
  */
 void dt_msg_queue_submit(struct dt_msg_queue* mq, void* buf, size_t len);
 
+/**
+ * Reserve space for a message in the ring of the queue.  The caller
+ * writes the message in the returned space, and calls
+ * dt_msg_queue_commit.  No other message can be reserved or submitted
+ * on the queue in between, the worker owns the queue.
+ * @param mq: message queue.
+ * @param len: maximum length of the message.
+ * @return space of len bytes to write the message into, or NULL if the
+ * 	buffer is full, and the message is dropped.
+ */
+uint8_t* dt_msg_queue_reserve(struct dt_msg_queue* mq, size_t len);
+
+/**
+ * Publish the message that was written in the reserved space.
+ * @param mq: message queue.
+ * @param len: length of the message, at most the reserved length.
+ * 	If 0, the reservation is cancelled and nothing is logged.
+ */
+void dt_msg_queue_commit(struct dt_msg_queue* mq, size_t len);
+
+/**
+ * Get the counters of the queue.
+ * @param mq: message queue.
+ * @param queued: number of messages in the queue is returned.
+ * @param dropped: number of messages dropped is returned.
+ * @param reset: if true the dropped counter is reset.
+ */
+void dt_msg_queue_get_stats(struct dt_msg_queue* mq, size_t* queued,
+	size_t* dropped, int reset);
+
 /** timer callback to wakeup dtio thread to process messages */
 void mq_wakeup_cb(void* arg);
 
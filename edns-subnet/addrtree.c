@@ -42,60 +42,140 @@
 #include "util/module.h"
 #include "addrtree.h"
 
+/** first arena chunk of a tree holds this many blocks, the root and
+ * the two nodes of a first insert, most trees stay that small */
+#define ADDRTREE_CHUNK_MIN 3
+/** the arena chunks grow up to this many blocks */
+#define ADDRTREE_CHUNK_MAX 256
+
+#ifdef __GNUC__
+/** prefetch memory for a lookup that is about to read it */
+#define addrtree_prefetch(p) __builtin_prefetch(p)
+#else
+#define addrtree_prefetch(p) /* nothing */
+#endif
+
+#ifdef __ATOMIC_RELAXED
+/** the used flag of a node is set by concurrent lookups, without a lock */
+#define addrtree_used_get(p) __atomic_load_n(p, __ATOMIC_RELAXED)
+#define addrtree_used_set(p) __atomic_store_n(p, 1, __ATOMIC_RELAXED)
+#else
+#define addrtree_used_get(p) (*(volatile uint8_t*)(p))
+#define addrtree_used_set(p) (*(volatile uint8_t*)(p) = 1)
+#endif
+
+/** the arena block that holds a node */
+static inline uint8_t*
+node_block(const struct addrtree *tree, struct addrnode *node)
+{
+	return (uint8_t*)node - tree->node_offset;
+}
+
+/**
+ * Allocate a new arena chunk and put its blocks on the freelist.
+ * @param tree: the tree.
+ * @return false on malloc failure.
+ */
+static int
+chunk_create(struct addrtree *tree)
+{
+	size_t i, n = tree->chunk_blocks;
+	struct addrtree_chunk *chunk = (struct addrtree_chunk *)malloc(
+		sizeof(*chunk) + n*tree->block_size);
+	uint8_t *block;
+	if (!chunk)
+		return 0;
+	chunk->size = sizeof(*chunk) + n*tree->block_size;
+	chunk->next = tree->chunks;
+	tree->chunks = chunk;
+	tree->size_bytes += chunk->size;
+	/* so that blocks are handed out in address order */
+	for (i = n; i > 0; i--) {
+		block = (uint8_t*)(chunk+1) + (i-1)*tree->block_size;
+		*(void**)block = tree->freelist;
+		tree->freelist = block;
+	}
+	tree->chunk_blocks *= 2;
+	if (tree->chunk_blocks > ADDRTREE_CHUNK_MAX)
+		tree->chunk_blocks = ADDRTREE_CHUNK_MAX;
+	return 1;
+}
+
+/**
+ * Make sure the freelist has a number of blocks.
+ * @param tree: the tree.
+ * @param num: number of blocks needed, at most ADDRTREE_CHUNK_MIN.
+ * @return false on malloc failure.
+ */
+static int
+block_reserve(struct addrtree *tree, int num)
+{
+	void *b = tree->freelist;
+	int i;
+	log_assert(num <= ADDRTREE_CHUNK_MIN);
+	for (i = 0; i < num; i++) {
+		if (!b)
+			return chunk_create(tree);
+		b = *(void**)b;
+	}
+	return 1;
+}
+
 /** 
- * Create a new edge
+ * Create a new edge, it lives in the arena block of the node.
+ * @param tree: Tree the node lives in.
  * @param node: Child node this edge will connect to.
  * @param addr: full key to this edge.
  * @param addrlen: length of relevant part of key for this node
  * @param parent_node: Parent node for node
  * @param parent_index: Index of child node at parent node
- * @return new addredge or NULL on failure
  */
-static struct addredge * 
-edge_create(struct addrnode *node, const addrkey_t *addr, 
-	addrlen_t addrlen, struct addrnode *parent_node, int parent_index)
+static void
+edge_create(struct addrtree *tree, struct addrnode *node,
+	const addrkey_t *addr, addrlen_t addrlen, struct addrnode *parent_node,
+	int parent_index)
 {
 	size_t n;
-	struct addredge *edge = (struct addredge *)malloc( sizeof (*edge) );
-	if (!edge)
-		return NULL;
+	uint8_t *block = node_block(tree, node);
+	struct addredge *edge = (struct addredge *)block;
+	log_assert(addrlen <= tree->max_depth);
 	edge->node = node;
 	edge->len = addrlen;
 	edge->parent_index = parent_index;
 	edge->parent_node = parent_node;
 	/* ceil() */
 	n = (size_t)((addrlen / KEYWIDTH) + ((addrlen % KEYWIDTH != 0)?1:0));
-	edge->str = (addrkey_t *)calloc(n, sizeof (addrkey_t));
-	if (!edge->str) {
-		free(edge);
-		return NULL;
-	}
+	edge->str = (addrkey_t *)(block + sizeof(*edge));
 	memcpy(edge->str, addr, n * sizeof (addrkey_t));
-	/* Only manipulate other objects after successful alloc */
 	node->parent_edge = edge;
 	log_assert(parent_node->edge[parent_index] == NULL);
 	parent_node->edge[parent_index] = edge;
-	return edge;
 }
 
 /** 
- * Create a new node
+ * Create a new node, takes a block from the freelist.
  * @param tree: Tree the node lives in.
  * @param elem: Element to store at this node
  * @param scope: Scopemask from server reply
  * @param ttl: Element is valid up to this time. Absolute, seconds
- * @return new addrnode or NULL on failure
+ * @return new addrnode or NULL if there is no free block.
  */
 static struct addrnode * 
 node_create(struct addrtree *tree, void *elem, addrlen_t scope, 
 	time_t ttl)
 {
-	struct addrnode* node = (struct addrnode *)malloc( sizeof (*node) );
-	if (!node)
+	struct addrnode *node;
+	uint8_t *block = (uint8_t *)tree->freelist;
+	if (!block)
 		return NULL;
+	tree->freelist = *(void**)block;
+	node = (struct addrnode *)(block + tree->node_offset);
 	node->elem = elem;
+	if (elem)
+		tree->size_bytes += tree->sizefunc(elem);
 	tree->node_count++;
 	node->scope = scope;
+	node->used = 0;
 	node->ttl = ttl;
 	node->edge[0] = NULL;
 	node->edge[1] = NULL;
@@ -105,16 +185,14 @@ node_create(struct addrtree *tree, void *elem, addrlen_t scope,
 	return node;
 }
 
-/** Size in bytes of node and parent edge
- * @param tree: tree the node lives in
- * @param n: node which size must be calculated 
- * @return size in bytes.
- **/
-static inline size_t 
-node_size(const struct addrtree *tree, const struct addrnode *n)
+/** Return the block of a node to the freelist, elem must be cleaned */
+static void
+node_free(struct addrtree *tree, struct addrnode *node)
 {
-	return sizeof *n + sizeof *n->parent_edge + n->parent_edge->len + 
-		(n->elem?tree->sizefunc(n->elem):0);
+	uint8_t *block = node_block(tree, node);
+	log_assert(!node->elem);
+	*(void**)block = tree->freelist;
+	tree->freelist = block;
 }
 
 struct addrtree * 
@@ -122,25 +200,33 @@ addrtree_create(addrlen_t max_depth, void (*delfunc)(void *, void *),
 	size_t (*sizefunc)(void *), void *env, uint32_t max_node_count)
 {
 	struct addrtree *tree;
+	size_t keylen;
 	log_assert(delfunc != NULL);
 	log_assert(sizefunc != NULL);
 	tree = (struct addrtree *)calloc(1, sizeof(*tree));
 	if (!tree)
 		return NULL;
-	tree->root = node_create(tree, NULL, 0, 0);
-	if (!tree->root) {
-		free(tree);
-		return NULL;
-	}
-	tree->size_bytes = sizeof *tree + sizeof *tree->root;
+	tree->size_bytes = sizeof *tree;
 	tree->first = NULL;
 	tree->last = NULL;
 	tree->max_depth = max_depth;
 	tree->delfunc = delfunc;
 	tree->sizefunc = sizefunc;
 	tree->env = env;
-	tree->node_count = 0;
 	tree->max_node_count = max_node_count;
+	/* the key is kept next to the edge, the fields that are read
+	 * when the edge is traversed */
+	keylen = ((size_t)max_depth + KEYWIDTH - 1) / KEYWIDTH;
+	keylen = (keylen + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+	tree->node_offset = sizeof(struct addredge) + keylen;
+	tree->block_size = tree->node_offset + sizeof(struct addrnode);
+	tree->chunk_blocks = ADDRTREE_CHUNK_MIN;
+	if (!chunk_create(tree)) {
+		free(tree);
+		return NULL;
+	}
+	tree->root = node_create(tree, NULL, 0, 0);
+	tree->node_count = 0;
 	return tree;
 }
 
@@ -227,15 +313,15 @@ purge_node(struct addrtree *tree, struct addrnode *node)
 		child_edge->parent_index = index;
 	}
 	parent_edge->parent_node->edge[index] = child_edge;
-	tree->size_bytes -= node_size(tree, node);
-	free(parent_edge->str);
-	free(parent_edge);
 	lru_pop(tree, node);
-	free(node);
+	node_free(tree, node);
 }
 
 /**
  * If a limit is set remove old nodes while above that limit.
+ * The LRU list is in order of insertion, a node that was found by a
+ * lookup since it was last moved gets a second chance, it is moved to
+ * the end of the list.
  * @param tree: Tree to be cleaned up.
  */
 static void
@@ -247,6 +333,11 @@ lru_cleanup(struct addrtree *tree)
 	while (tree->node_count > tree->max_node_count) {
 		n = tree->first;
 		if (!n) break;
+		if (n->used) {
+			n->used = 0;
+			lru_update(tree, n);
+			continue;
+		}
 		children = (n->edge[0] != NULL) + (n->edge[1] != NULL);
 		/** Don't remove this node, it is either the root or we can't
 		 * do without it because it has 2 children */
@@ -275,17 +366,15 @@ addrtree_size(const struct addrtree *tree)
 void addrtree_delete(struct addrtree *tree)
 {
 	struct addrnode *n;
+	struct addrtree_chunk *chunk;
 	if (!tree) return;
 	clean_node(tree, tree->root);
-	free(tree->root);
-	tree->size_bytes -= sizeof(struct addrnode);
-	while ((n = tree->first)) {
-		tree->first = n->next;
+	for (n = tree->first; n; n = n->next)
 		clean_node(tree, n);
-		tree->size_bytes -= node_size(tree, n);
-		free(n->parent_edge->str);
-		free(n->parent_edge);
-		free(n);
+	while ((chunk = tree->chunks)) {
+		tree->chunks = chunk->next;
+		tree->size_bytes -= chunk->size;
+		free(chunk);
 	}
 	log_assert(sizeof *tree == addrtree_size(tree));
 	free(tree);
@@ -330,14 +419,27 @@ static addrlen_t
 bits_common(const addrkey_t *s1, addrlen_t l1, 
 	const addrkey_t *s2, addrlen_t l2, addrlen_t skip)
 {
-	addrlen_t len, i;
+	unsigned int len, i;
+	addrkey_t c;
 	len = (l1 > l2) ? l2 : l1;
 	log_assert(skip < len);
-	for (i = skip; i < len; i++) {
-		if (cmpbit(s1, s2, i)) return i;
+	/* compare a byte at a time, the first one from the skip bit */
+	i = skip;
+	while (i < len) {
+		c = (addrkey_t)((s1[i/KEYWIDTH] ^ s2[i/KEYWIDTH]) <<
+			(i%KEYWIDTH));
+		if (c) {
+			/* the first bit that differs in this byte */
+			while (!(c & 0x80)) {
+				c = (addrkey_t)(c << 1);
+				i++;
+			}
+			return (addrlen_t)(i < len ? i : len);
+		}
+		i = (i/KEYWIDTH + 1)*KEYWIDTH;
 	}
-	return len;
-} 
+	return (addrlen_t)len;
+}
 
 /**
  * Tests if s1 is a substring of s2
@@ -372,6 +474,12 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 	if (tree->max_depth < scope) scope = tree->max_depth;
 	/* Server answer was less specific than question */
 	if (scope < sourcemask) sourcemask = scope;
+	/* A split needs two new nodes, get the blocks for them now, so
+	 * that the tree is not left halfway changed. */
+	if (!block_reserve(tree, 2)) {
+		if (elem) tree->delfunc(tree->env, elem);
+		return;
+	}
 
 	depth = 0;
 	while (1) {
@@ -399,15 +507,9 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 		/* Case 2: New leafnode */
 		if (!edge) {
 			newnode = node_create(tree, elem, scope, ttl);
-			if (!newnode) return;
-			if (!edge_create(newnode, addr, sourcemask, node,
-				index)) {
-				clean_node(tree, newnode);
-				tree->node_count--;
-				free(newnode);
-				return;
-			}
-			tree->size_bytes += node_size(tree, newnode);
+			log_assert(newnode);
+			edge_create(tree, newnode, addr, sourcemask, node,
+				index);
 			lru_push(tree, newnode);
 			lru_cleanup(tree);
 			return;
@@ -425,16 +527,10 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 			continue;
 		}
 		/* Case 4: split. */
-		if (!(newnode = node_create(tree, NULL, 0, 0)))
-			return;
+		newnode = node_create(tree, NULL, 0, 0);
+		log_assert(newnode);
 		node->edge[index] = NULL;
-		if (!edge_create(newnode, addr, common, node, index)) {
-			node->edge[index] = edge;
-			clean_node(tree, newnode);
-			tree->node_count--;
-			free(newnode);
-			return;
-		}
+		edge_create(tree, newnode, addr, common, node, index);
 		lru_push(tree, newnode);
 		/* connect existing child to our new node */
 		index = getbit(edge->str, edge->len, common);
@@ -447,22 +543,14 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 			newnode->elem = elem;
 			newnode->scope = scope;
 			newnode->ttl = ttl;
-		} 
-		
-		tree->size_bytes += node_size(tree, newnode);
-
-		if (common != sourcemask) {
+			tree->size_bytes += tree->sizefunc(elem);
+		} else {
 			/* Data is stored in other leafnode */
 			node = newnode;
 			newnode = node_create(tree, elem, scope, ttl);
-			if (!edge_create(newnode, addr, sourcemask, node,
-				index^1)) {
-				clean_node(tree, newnode);
-				tree->node_count--;
-				free(newnode);
-				return;
-			}
-			tree->size_bytes += node_size(tree, newnode);
+			log_assert(newnode);
+			edge_create(tree, newnode, addr, sourcemask, node,
+				index^1);
 			lru_push(tree, newnode);
 		}
 		lru_cleanup(tree);
@@ -480,6 +568,10 @@ addrtree_find(struct addrtree *tree, const addrkey_t *addr,
 
 	log_assert(node != NULL);
 	while (1) {
+		/* the child blocks are read next, while this node is
+		 * checked */
+		addrtree_prefetch(node->edge[0]);
+		addrtree_prefetch(node->edge[1]);
 		/* Current node more specific then question. */
 		log_assert(depth <= sourcemask);
 		/* does this node have data? if yes, see if we have a match */
@@ -492,7 +584,10 @@ addrtree_find(struct addrtree *tree, const addrkey_t *addr,
 				/* Authority indicates it does not have a more
 				 * precise answer or we cannot ask a more
 				 * specific question. */
-				lru_update(tree, node);
+				/* mark it for the LRU, the store is skipped
+				 * if it is already set */
+				if (!addrtree_used_get(&node->used))
+					addrtree_used_set(&node->used);
 				return node;
 			}
 		}
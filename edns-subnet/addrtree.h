@@ -53,6 +53,11 @@
  * address is capped by min(sourcemask, scope). While traversing the
  * tree the scope of all visited nodes is updated. This ensures we are
  * always able to find the most specific answer available.
+ *
+ * The node, the edge to its parent and the key of that edge are stored
+ * together in one block of a per tree arena. The arena grows in chunks
+ * and freed blocks are reused, so a tree does not malloc for every
+ * branch and a lookup touches one block per level.
  */
 
 #ifndef ADDRTREE_H
@@ -86,6 +91,24 @@ struct addrtree {
 	struct addrnode* first;
 	/** last node in LRU list, last candidate to go */
 	struct addrnode *last;
+	/** arena chunks the nodes are allocated from, linked list */
+	struct addrtree_chunk* chunks;
+	/** free blocks in the chunks, linked through their first bytes */
+	void* freelist;
+	/** size of an arena block: the parent edge, the key and the node */
+	size_t block_size;
+	/** offset of the node in an arena block */
+	size_t node_offset;
+	/** number of blocks for the next chunk that is allocated */
+	size_t chunk_blocks;
+};
+
+/** A chunk of the arena of a tree, it is followed by the blocks. */
+struct addrtree_chunk {
+	/** next chunk in the list */
+	struct addrtree_chunk* next;
+	/** size of the chunk in bytes, including this header */
+	size_t size;
 };
 
 struct addrnode {
@@ -95,6 +118,9 @@ struct addrnode {
 	time_t ttl;
 	/** Number of significant bits in address. */
 	addrlen_t scope;
+	/** set by addrtree_find when the node is found, and cleared when
+	 * the LRU cleanup moves the node to the end of the list */
+	uint8_t used;
 	/** A node can have 0-2 edges, set to NULL for unused */
 	struct addredge *edge[2];
 	/** edge between this node and parent */
@@ -119,7 +145,8 @@ struct addredge {
 };
 
 /**
- * Size of tree in bytes.
+ * Size of tree in bytes. This is the arena the nodes live in,
+ * and the elements.
  * @param tree: Tree.
  * @return size of tree in bytes.
  */
@@ -165,6 +192,8 @@ void addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 
 /**
  * Find a node containing an element in the tree.
+ * Can be called by concurrent readers of the tree, it only sets the
+ * used flag of the node that is found, without a lock.
  * 
  * @param tree: Tree to search.
  * @param addr: key for element lookup.
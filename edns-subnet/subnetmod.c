@@ -241,7 +241,12 @@ subnetmod_init(struct module_env *env, int id)
 		inplace_cb_edns_back_parsed, NULL, env, id);
 	inplace_cb_register((void*)ecs_query_response,
 		inplace_cb_query_response, NULL, env, id);
-	lock_rw_init(&sn_env->biglock);
+	lock_basic_init(&sn_env->insert_lock);
+	lock_quick_init(&sn_env->stats_lock);
+	lock_protect(&sn_env->stats_lock, &sn_env->num_msg_cache,
+		sizeof(sn_env->num_msg_cache));
+	lock_protect(&sn_env->stats_lock, &sn_env->num_msg_nocache,
+		sizeof(sn_env->num_msg_nocache));
 	return 1;
 }
 
@@ -252,7 +257,8 @@ subnetmod_deinit(struct module_env *env, int id)
 	if(!env || !env->modinfo[id])
 		return;
 	sn_env = (struct subnet_env*)env->modinfo[id];
-	lock_rw_destroy(&sn_env->biglock);
+	lock_basic_destroy(&sn_env->insert_lock);
+	lock_quick_destroy(&sn_env->stats_lock);
 	inplace_cb_delete(env, inplace_cb_edns_back_parsed, id);
 	inplace_cb_delete(env, inplace_cb_query, id);
 	inplace_cb_delete(env, inplace_cb_query_response, id);
@@ -334,11 +340,22 @@ update_cache(struct module_qstate *qstate, int id)
 	/* Step 1, general qinfo lookup */
 	struct lruhash_entry *lru_entry = slabhash_lookup(subnet_msg_cache, h,
 		&qstate->qinfo, 1);
-	int need_to_insert = (lru_entry == NULL);
+	int need_to_insert = 0;
+	if (!lru_entry) {
+		/* create the entry under the insert lock, another thread
+		 * may have inserted it in the meantime */
+		lock_basic_lock(&sne->insert_lock);
+		lru_entry = slabhash_lookup(subnet_msg_cache, h,
+			&qstate->qinfo, 1);
+		if(lru_entry)
+			lock_basic_unlock(&sne->insert_lock);
+		else	need_to_insert = 1;
+	}
 	if (!lru_entry) {
 		void* data = calloc(1,
 			sizeof(struct subnet_msg_cache_data));
 		if(!data) {
+			lock_basic_unlock(&sne->insert_lock);
 			log_err("malloc failed");
 			return;
 		}
@@ -347,6 +364,7 @@ update_cache(struct module_qstate *qstate, int id)
 			qstate->qinfo.qname_len);
 		if(!qinf.qname) {
 			free(data);
+			lock_basic_unlock(&sne->insert_lock);
 			log_err("memdup failed");
 			return;
 		}
@@ -354,6 +372,7 @@ update_cache(struct module_qstate *qstate, int id)
 		free(qinf.qname); /* if qname 'consumed', it is set to NULL */
 		if (!mrep_entry) {
 			free(data);
+			lock_basic_unlock(&sne->insert_lock);
 			log_err("query_info_entrysetup failed");
 			return;
 		}
@@ -365,6 +384,8 @@ update_cache(struct module_qstate *qstate, int id)
 	/* Step 2, find the correct tree */
 	if (!(tree = get_tree(lru_entry->data, edns, sne, qstate->env->cfg))) {
 		lock_rw_unlock(&lru_entry->lock);
+		if (need_to_insert)
+			lock_basic_unlock(&sne->insert_lock);
 		log_err("Subnet cache insertion failed");
 		return;
 	}
@@ -373,6 +394,8 @@ update_cache(struct module_qstate *qstate, int id)
 	lock_quick_unlock(&sne->alloc.lock);
 	if (!rep) {
 		lock_rw_unlock(&lru_entry->lock);
+		if (need_to_insert)
+			lock_basic_unlock(&sne->insert_lock);
 		log_err("Subnet cache insertion failed");
 		return;
 	}
@@ -393,6 +416,7 @@ update_cache(struct module_qstate *qstate, int id)
 	if (need_to_insert) {
 		slabhash_insert(subnet_msg_cache, h, lru_entry, lru_entry->data,
 			NULL);
+		lock_basic_unlock(&sne->insert_lock);
 	}
 }
 
@@ -413,7 +437,8 @@ lookup_and_reply(struct module_qstate *qstate, int id, struct subnet_qstate *sq)
 	memset(&sq->ecs_client_out, 0, sizeof(sq->ecs_client_out));
 
 	if (sq) sq->qinfo_hash = h; /* Might be useful on cache miss */
-	e = slabhash_lookup(sne->subnet_msg_cache, h, &qstate->qinfo, 1);
+	/* a read lock suffices, addrtree_find can be called concurrently */
+	e = slabhash_lookup(sne->subnet_msg_cache, h, &qstate->qinfo, 0);
 	if (!e) return 0; /* qinfo not in cache */
 	data = e->data;
 	tree = (ecs->subnet_addr_fam == EDNSSUBNET_ADDRFAM_IP4)?
@@ -501,9 +526,7 @@ eval_response(struct module_qstate *qstate, int id, struct subnet_qstate *sq)
 		 * when a client explicitly asks for subnet specific answer. */
 		verbose(VERB_QUERY, "subnet: Authority indicates no support");
 		if(!sq->started_no_cache_store) {
-			lock_rw_wrlock(&sne->biglock);
 			update_cache(qstate, id);
-			lock_rw_unlock(&sne->biglock);
 		}
 		if (sq->subnet_downstream)
 			cp_edns_bad_response(c_out, c_in);
@@ -529,12 +552,12 @@ eval_response(struct module_qstate *qstate, int id, struct subnet_qstate *sq)
 		return module_restart_next;
 	}
 
-	lock_rw_wrlock(&sne->biglock);
 	if(!sq->started_no_cache_store) {
 		update_cache(qstate, id);
 	}
+	lock_quick_lock(&sne->stats_lock);
 	sne->num_msg_nocache++;
-	lock_rw_unlock(&sne->biglock);
+	lock_quick_unlock(&sne->stats_lock);
 	
 	if (sq->subnet_downstream) {
 		/* Client wants to see the answer, echo option back
@@ -754,10 +777,10 @@ subnetmod_operate(struct module_qstate *qstate, enum module_ev event,
 				return;
 		}
 
-		lock_rw_wrlock(&sne->biglock);
 		if (lookup_and_reply(qstate, id, sq)) {
+			lock_quick_lock(&sne->stats_lock);
 			sne->num_msg_cache++;
-			lock_rw_unlock(&sne->biglock);
+			lock_quick_unlock(&sne->stats_lock);
 			verbose(VERB_QUERY, "subnet: answered from cache");
 			qstate->ext_state[id] = module_finished;
 
@@ -765,7 +788,6 @@ subnetmod_operate(struct module_qstate *qstate, enum module_ev event,
 				&qstate->edns_opts_front_out, qstate);
 			return;
 		}
-		lock_rw_unlock(&sne->biglock);
 		
 		sq->ecs_server_out.subnet_addr_fam =
 			sq->ecs_client_in.subnet_addr_fam;
@@ -61,7 +61,13 @@ struct subnet_env {
 	struct ecs_whitelist* whitelist;
 	/** allocation service */
 	struct alloc_cache alloc;
-	lock_rw_type biglock;
+	/** serializes the creation of new entries in the message cache,
+	 * so that concurrent inserts for the same query do not replace
+	 * each other. Lookups and updates of existing entries use the
+	 * entry lock. */
+	lock_basic_type insert_lock;
+	/** lock for the message counters */
+	lock_quick_type stats_lock;
 	/** number of messages from cache */
 	size_t num_msg_cache;
 	/** number of messages not from cache */
@@ -76,6 +76,9 @@
 #ifdef USE_DNSTAP
 #include "dnstap/dtstream.h"
 #endif
+#ifdef USE_CACHEDB
+#include "cachedb/cachedb.h"
+#endif
 
 #ifdef HAVE_TARGETCONDITIONALS_H
 #include <TargetConditionals.h>
@@ -95,6 +98,10 @@ libworker_delete_env(struct libworker* w)
 	if(w->env) {
 		outside_network_quit_prepare(w->back);
 		mesh_delete(w->env->mesh);
+#ifdef USE_CACHEDB
+		cachedb_thread_stop(w->env, modstack_find(&w->ctx->mods,
+			"cachedb"));
+#endif
 		context_release_alloc(w->ctx, w->env->alloc, 
 			!w->is_bg || w->is_bg_thread);
 		sldns_buffer_free(w->env->scratch_buffer);
@@ -1012,6 +1019,13 @@ void worker_probe_timer_cb(void* ATTR_UNUSED(arg))
 	log_assert(0);
 }
 
+void worker_anchor_prime_cb(void* ATTR_UNUSED(arg), int ATTR_UNUSED(rcode),
+	struct sldns_buffer* ATTR_UNUSED(buf), enum sec_status ATTR_UNUSED(s),
+	char* ATTR_UNUSED(why_bogus), int ATTR_UNUSED(was_ratelimited))
+{
+	log_assert(0);
+}
+
 void worker_start_accept(void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
@@ -795,6 +795,49 @@ struct ub_server_stats {
 	long long mem_http2_response_buffer;
 	/** number of TLS connection resume */
 	long long qtls_resume;
+	/** number of TLS handshakes of downstream connections */
+	long long tls_handshake;
+	/** number of those TLS handshakes that resumed a session */
+	long long tls_handshake_resumed;
+	/** number of those TLS connections that use kernel TLS offload */
+	long long tls_ktls;
+	/** number of cachedb stores in the write-behind queue */
+	long long cachedb_wb_queue;
+	/** number of cachedb stores merged with a queued store for the key */
+	long long cachedb_wb_merged;
+	/** number of cachedb stores dropped because the queue was full */
+	long long cachedb_wb_dropped;
+	/** number of write-behind flushes to the cachedb backend */
+	long long cachedb_wb_flush;
+	/** number of stores written to the cachedb backend by the flushes */
+	long long cachedb_wb_stored;
+	/** sum of time the flushed stores waited in the queue, seconds */
+	long long cachedb_wb_wait_sec;
+	/** sum of time the flushed stores waited in the queue, microseconds */
+	long long cachedb_wb_wait_usec;
+	/** sum of time the flushes took to write to the backend, seconds */
+	long long cachedb_wb_flush_sec;
+	/** sum of time the flushes took to write to the backend,
+	 * microseconds */
+	long long cachedb_wb_flush_usec;
+	/** number of dnstap messages in the queues to the io thread */
+	long long dnstap_queue;
+	/** number of dnstap messages dropped because the queue was full */
+	long long dnstap_dropped;
+	/** number of times the event loop woke up with events */
+	long long event_wakeup;
+	/** number of socket events handled by the event loop */
+	long long event_handled;
+	/** number of zone transfers swapped into the served auth zones */
+	long long auth_xfr_swap;
+	/** total time, in usec, that auth zone lookups were blocked by the
+	 * zone transfer swaps */
+	long long auth_xfr_lock_usec;
+	/** longest time, in usec, that auth zone lookups were blocked by a
+	 * zone transfer swap */
+	long long auth_xfr_lock_usec_max;
+	/** number of bytes in use by the auth zones */
+	long long mem_authzone;
 	/** RPZ action stats */
 	long long rpz_action[UB_STATS_RPZ_ACTION_NUM];
 };
@@ -163,6 +163,10 @@ void worker_stat_timer_cb(void* arg);
 /** probe timer callback handler */
 void worker_probe_timer_cb(void* arg);
 
+/** callback for the trust anchor primes at startup, arg is worker */
+void worker_anchor_prime_cb(void* arg, int rcode, struct sldns_buffer* buf,
+	enum sec_status s, char* why_bogus, int was_ratelimited);
+
 /** start accept callback handler */
 void worker_start_accept(void* arg);
 
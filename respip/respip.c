@@ -65,6 +65,7 @@ respip_set_create(void)
 		return NULL;
 	}
 	addr_tree_init(&set->ip_tree);
+	addr_radix_init(&set->ip_radix, &set->ip_tree);
 	lock_rw_init(&set->lock);
 	return set;
 }
@@ -87,6 +88,7 @@ respip_set_delete(struct respip_set* set)
 		return;
 	lock_rw_destroy(&set->lock);
 	traverse_postorder(&set->ip_tree, resp_addr_del, NULL);
+	addr_radix_clear(&set->ip_radix);
 	regional_destroy(set->region);
 	free(set);
 }
@@ -118,21 +120,29 @@ respip_sockaddr_find_or_create(struct respip_set* set, struct sockaddr_storage*
 			/* We know we didn't find it, so this should be
 			 * impossible. */
 			log_warn("unexpected: duplicate address: %s", ipstr);
-		}
+		} else	addr_radix_insert(&set->ip_radix, &node->node);
 	}
 	return node;
 }
 
+void
+respip_set_init_parents(struct respip_set* set)
+{
+	addr_tree_init_parents(&set->ip_tree);
+	(void)addr_radix_build(&set->ip_radix);
+}
+
 void
 respip_sockaddr_delete(struct respip_set* set, struct resp_addr* node)
 {
 	struct resp_addr* prev;
 	prev = (struct resp_addr*)rbtree_previous((struct rbnode_type*)node);	
 	lock_rw_destroy(&node->lock);
+	addr_radix_remove(&set->ip_radix, &node->node);
 	rbtree_delete(&set->ip_tree, node);
 	/* no free'ing, all allocated in region */
 	if(!prev)
-		addr_tree_init_parents((rbtree_type*)set);
+		addr_tree_init_parents(&set->ip_tree);
 	else
 		addr_tree_init_parents_node(&prev->node);
 }
@@ -389,7 +399,7 @@ respip_set_apply_cfg(struct respip_set* set, char* const* tagname, int num_tags,
 		free(pd);
 		pd = np;
 	}
-	addr_tree_init_parents(&set->ip_tree);
+	respip_set_init_parents(set);
 
 	return 1;
 }
@@ -467,8 +477,8 @@ respip_views_apply_cfg(struct views* vs, struct config_file* cfg,
  * - It doesn't assume all data in 'key' are in a contiguous memory region.
  *   Although that would be the case in most cases, 'key' can be passed from
  *   a lower-level module and it might not build the rrset to meet the
- *   assumption.  In fact, an rrset specified as response-ip-data or generated
- *   in local_data_find_tag_datas() breaks the assumption.  So it would be
+ *   assumption.  In fact, an rrset specified as response-ip-data or built
+ *   by local_data_add_tag_data() breaks the assumption.  So it would be
  *   safer not to naively rely on the assumption.  On the other hand, this
  *   function ensures the copied rrset data are in a contiguous region so
  *   that it won't cause a disruption even if an upper layer module naively
@@ -621,8 +631,8 @@ respip_addr_lookup(const struct reply_info *rep, struct respip_set* rs,
 		for(j = 0; j < rd->count; j++) {
 			if(!rdata2sockaddr(rd, rtype, j, &ss, &addrlen))
 				continue;
-			ra = (struct resp_addr*)addr_tree_lookup(&rs->ip_tree,
-				&ss, addrlen);
+			ra = (struct resp_addr*)addr_radix_lookup(
+				&rs->ip_radix, &ss, addrlen);
 			if(ra) {
 				*rrset_id = i;
 				lock_rw_rdlock(&ra->lock);
@@ -700,7 +710,7 @@ respip_data_answer(enum respip_action action,
 	struct ub_packed_rrset_key* data,
 	uint16_t qtype, const struct reply_info* rep,
 	size_t rrset_id, struct reply_info** new_repp, int tag,
-	struct config_strlist** tag_datas, size_t tag_datas_size,
+	struct local_rrset** tag_datas, size_t tag_datas_size,
 	char* const* tagname, int num_tags,
 	struct ub_packed_rrset_key** redirect_rrsetp, struct regional* region)
 {
@@ -724,8 +734,7 @@ respip_data_answer(enum respip_action action,
 		dataqinfo.qclass = ntohs(rep->rrsets[rrset_id]->rk.rrset_class);
 
 		memset(&r, 0, sizeof(r));
-		if(local_data_find_tag_datas(&dataqinfo, tag_datas[tag], &r,
-			region)) {
+		if(local_data_find_tag_datas(&dataqinfo, tag_datas[tag], &r)) {
 			verbose(VERB_ALGO,
 				"response-ip redirect with tag data [%d] %s",
 				tag, (tag<num_tags?tagname[tag]:"null"));
@@ -903,7 +912,7 @@ respip_rewrite_reply(const struct query_info* qinfo,
 	size_t ctaglen;
 	const uint8_t* tag_actions;
 	size_t tag_actions_size;
-	struct config_strlist** tag_datas;
+	struct local_rrset** tag_datas;
 	size_t tag_datas_size;
 	struct view* view = NULL;
 	struct respip_set* ipset = NULL;
@@ -971,8 +980,8 @@ respip_rewrite_reply(const struct query_info* qinfo,
 	}
 	lock_rw_rdlock(&az->rpz_lock);
 	for(a = az->rpz_first; a && !raddr; a = a->rpz_az_next) {
-		lock_rw_rdlock(&a->lock);
 		r = a->rpz;
+		lock_rw_rdlock(&r->lock);
 		if(!r->taglist || taglist_intersect(r->taglist, 
 			r->taglistlen, ctaglist, ctaglen)) {
 			if((raddr = respip_addr_lookup(rep,
@@ -982,13 +991,13 @@ respip_rewrite_reply(const struct query_info* qinfo,
 					region, &rpz_used)) {
 					log_err("out of memory");
 					lock_rw_unlock(&raddr->lock);
-					lock_rw_unlock(&a->lock);
+					lock_rw_unlock(&r->lock);
 					lock_rw_unlock(&az->rpz_lock);
 					return 0;
 				}
 				if(rpz_used) {
 					/* break to make sure 'a' stays pointed
-					 * to used auth_zone, and keeps lock */
+					 * to used auth_zone, and keeps rpz lock */
 					break;
 				}
 				lock_rw_unlock(&raddr->lock);
@@ -996,7 +1005,7 @@ respip_rewrite_reply(const struct query_info* qinfo,
 				actinfo->rpz_disabled++;
 			}
 		}
-		lock_rw_unlock(&a->lock);
+		lock_rw_unlock(&r->lock);
 	}
 	lock_rw_unlock(&az->rpz_lock);
 	if(raddr && !search_only) {
@@ -1051,7 +1060,7 @@ respip_rewrite_reply(const struct query_info* qinfo,
 		lock_rw_unlock(&raddr->lock);
 	}
 	if(rpz_used) {
-		lock_rw_unlock(&a->lock);
+		lock_rw_unlock(&a->rpz->lock);
 	}
 	return ret;
 }
@@ -15,6 +15,7 @@
 #include "util/module.h"
 #include "services/localzone.h"
 #include "util/locks.h"
+#include "util/storage/addrradix.h"
 
 /**
  * Conceptual set of IP addresses for response AAAA or A records that should
@@ -23,6 +24,7 @@
 struct respip_set {
 	struct regional* region;
 	struct rbtree_type ip_tree;
+	struct addr_radix ip_radix;	/* lookup index on ip_tree */
 	lock_rw_type lock;	/* lock on the respip tree */
 	char* const* tagname;	/* shallow copy of tag names, for logging */
 	int num_tags;		/* number of tagname entries */
@@ -66,7 +68,7 @@ struct respip_client_info {
 	size_t taglen;
 	uint8_t* tag_actions;
 	size_t tag_actions_size;
-	struct config_strlist** tag_datas;
+	struct local_rrset** tag_datas;
 	size_t tag_datas_size;
 	struct view* view;
 	struct respip_set* respip_set;
@@ -287,6 +289,13 @@ respip_enter_rr(struct regional* region, struct resp_addr* raddr,
 	uint16_t rrtype, uint16_t rrclass, time_t ttl, uint8_t* rdata,
 	size_t rdata_len, const char* rrstr, const char* netblockstr);
 
+/**
+ * Set up the parent pointers and the lookup index of the address tree,
+ * after the insertions for a (re)load are done.
+ * @param set: the respip set. Must hold write lock.
+ */
+void respip_set_init_parents(struct respip_set* set);
+
 /**
  * Delete resp_addr node from tree.
  * @param set: struct containing tree. Must hold write lock.
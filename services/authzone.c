@@ -55,6 +55,8 @@
 #include "util/log.h"
 #include "util/module.h"
 #include "util/random.h"
+#include "util/storage/slabhash.h"
+#include "util/storage/lookup3.h"
 #include "services/cache/dns.h"
 #include "services/outside_network.h"
 #include "services/listen_dnsport.h"
@@ -69,9 +71,16 @@
 #include "validator/val_nsec3.h"
 #include "validator/val_secalgo.h"
 #include <ctype.h>
+#include <sys/time.h>
+#ifdef HAVE_SYS_MMAN_H
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 /** bytes to use for NSEC3 hash buffer. 20 for sha1 */
 #define N3HASHBUFLEN 32
+/** number of slabs in the answer cache of a zone */
+#define AUTH_ANSWER_CACHE_SLABS 4
 /** max number of CNAMEs we are willing to follow (in one answer) */
 #define MAX_CNAME_CHAIN 8
 /** timeout for probe packets for SOA */
@@ -301,6 +310,13 @@ struct auth_zones* auth_zones_create(void)
 	/* also lock protects the rbnode's in struct auth_zone, auth_xfer */
 	lock_rw_init(&az->rpz_lock);
 	lock_protect(&az->rpz_lock, &az->rpz_first, sizeof(az->rpz_first));
+	lock_basic_init(&az->xfr_stats_lock);
+	lock_protect(&az->xfr_stats_lock, &az->num_xfr_swap,
+		sizeof(az->num_xfr_swap));
+	lock_protect(&az->xfr_stats_lock, &az->xfr_lock_usec,
+		sizeof(az->xfr_lock_usec));
+	lock_protect(&az->xfr_stats_lock, &az->xfr_lock_usec_max,
+		sizeof(az->xfr_lock_usec_max));
 	return az;
 }
 
@@ -353,10 +369,21 @@ static void
 auth_rrset_delete(struct auth_rrset* rrset)
 {
 	if(!rrset) return;
-	free(rrset->data);
+	if(!rrset->shared)
+		free(rrset->data);
 	free(rrset);
 }
 
+/** put new data in the rrset, the old data is freed if the rrset owns it */
+static void
+auth_rrset_set_data(struct auth_rrset* rrset, struct packed_rrset_data* d)
+{
+	if(!rrset->shared)
+		free(rrset->data);
+	rrset->data = d;
+	rrset->shared = 0;
+}
+
 /** delete auth data domain node */
 static void
 auth_data_delete(struct auth_data* n)
@@ -381,13 +408,214 @@ auth_data_del(rbnode_type* n, void* ATTR_UNUSED(arg))
 	auth_data_delete(z);
 }
 
+/** delete the data of the zone, the compact block and the data tree,
+ * and leave an empty data tree */
+static void
+auth_zone_data_clear(struct auth_zone* z)
+{
+	traverse_postorder(&z->data, auth_data_del, NULL);
+	rbtree_init(&z->data, &auth_data_cmp);
+	free(z->compact);
+	z->compact = NULL;
+	z->compact_num = 0;
+	z->compact_size = 0;
+}
+
+/** the compact data has the name in full, every AZ_COMPACT_RESTART
+ * domains, the names in between are prefix compressed */
+#define AZ_COMPACT_RESTART 16
+/** the number of restart domains, that have the name in full, in the
+ * compact data of num domains */
+#define AZ_COMPACT_NUM_RESTART(num) \
+	(((num)+AZ_COMPACT_RESTART-1)/AZ_COMPACT_RESTART)
+
+/** the number of labels at the end of the names that are the same */
+static int
+az_compact_shared_labels(struct auth_data* a, struct auth_data* b)
+{
+	uint8_t* la[LDNS_MAX_DOMAINLEN], *lb[LDNS_MAX_DOMAINLEN], *p;
+	int i, n = 0;
+	for(i=0, p=a->name; i<a->namelabs; i++, p += *p+1)
+		la[i] = p;
+	for(i=0, p=b->name; i<b->namelabs; i++, p += *p+1)
+		lb[i] = p;
+	while(n < a->namelabs && n < b->namelabs) {
+		uint8_t* x = la[a->namelabs-1-n], *y = lb[b->namelabs-1-n];
+		if(*x != *y || memcmp(x, y, (size_t)*x+1) != 0)
+			break;
+		n++;
+	}
+	return n;
+}
+
+/** the number of bytes of the name of n, that are not shared with the
+ * name of the domain before it */
+static size_t
+az_compact_prefix(struct auth_data* n, int shared)
+{
+	uint8_t* p = n->name;
+	int i;
+	for(i=0; i < n->namelabs - shared; i++)
+		p += *p+1;
+	return (size_t)(p - n->name);
+}
+
+/** write the domain n in the compact block at pos, prev is the domain
+ * before it, or NULL if the name is written in full.  If block is NULL,
+ * nothing is written.  Returns the position after the domain. */
+static size_t
+az_compact_write(uint8_t* block, size_t pos, struct auth_data* n,
+	struct auth_data* prev)
+{
+	int shared = (prev?az_compact_shared_labels(n, prev):0);
+	size_t prefix = az_compact_prefix(n, shared), num = 0, i, total;
+	size_t numpos = pos + 2 + prefix;
+	struct auth_rrset* r;
+	struct packed_rrset_data* d;
+	if(block) {
+		block[pos] = (uint8_t)shared;
+		block[pos+1] = (uint8_t)prefix;
+		memmove(block+pos+2, n->name, prefix);
+	}
+	pos = numpos + 2;
+	for(r = n->rrsets; r; r = r->next, num++) {
+		d = r->data;
+		total = d->count + d->rrsig_count;
+		if(block) {
+			sldns_write_uint16(block+pos, r->type);
+			sldns_write_uint16(block+pos+2, (uint16_t)d->count);
+			sldns_write_uint16(block+pos+4,
+				(uint16_t)d->rrsig_count);
+			sldns_write_uint32(block+pos+6, (uint32_t)d->ttl);
+		}
+		pos += 10;
+		for(i=0; i<total; i++) {
+			/* the rdata has the rdata length in front */
+			if(block) {
+				sldns_write_uint32(block+pos,
+					(uint32_t)d->rr_ttl[i]);
+				memmove(block+pos+4, d->rr_data[i],
+					d->rr_len[i]);
+			}
+			pos += 4 + d->rr_len[i];
+		}
+	}
+	if(block)
+		sldns_write_uint16(block+numpos, (uint16_t)num);
+	return pos;
+}
+
+/** if the domain fits in the compact data, that has 16bit counts */
+static int
+az_compact_fits(struct auth_data* n)
+{
+	struct auth_rrset* r;
+	size_t num = 0;
+	for(r = n->rrsets; r; r = r->next) {
+		if(r->data->count > 0xffff || r->data->rrsig_count > 0xffff)
+			return 0;
+		num++;
+	}
+	return num <= 0xffff;
+}
+
+/** Move the data tree of the zone into compact storage, in one block.
+ * The block starts with the positions of the restart domains, then the
+ * domains in canonical order.  A domain is stored as:
+ *	uint8 number of labels shared with the name before it
+ *	uint8 length, and the labels of the name that are not shared
+ *	uint16 number of rrsets, and for every rrset:
+ *		uint16 type, count, rrsig_count, uint32 ttl, and then
+ *		for every RR the uint32 ttl and the rdata with the length.
+ * The restart domains share no labels, they have the name in full.
+ * On malloc failure the data tree is kept. */
+static void
+auth_zone_compact(struct auth_zone* z)
+{
+	size_t num = z->data.count, size, pos, i = 0;
+	struct auth_data* n, *prev = NULL;
+	uint8_t* block;
+	if(z->compact || num == 0)
+		return;
+	size = AZ_COMPACT_NUM_RESTART(num)*sizeof(size_t);
+	RBTREE_FOR(n, struct auth_data*, &z->data) {
+		if(!az_compact_fits(n))
+			return; /* it stays in the data tree */
+		size = az_compact_write(NULL, size, n,
+			(i%AZ_COMPACT_RESTART==0?NULL:prev));
+		prev = n;
+		i++;
+	}
+	block = (uint8_t*)malloc(size);
+	if(!block) {
+		log_err("out of memory for compact auth zone data");
+		return;
+	}
+	pos = AZ_COMPACT_NUM_RESTART(num)*sizeof(size_t);
+	i = 0;
+	RBTREE_FOR(n, struct auth_data*, &z->data) {
+		if(i%AZ_COMPACT_RESTART == 0)
+			((size_t*)block)[i/AZ_COMPACT_RESTART] = pos;
+		pos = az_compact_write(block, pos, n,
+			(i%AZ_COMPACT_RESTART==0?NULL:prev));
+		prev = n;
+		i++;
+	}
+	log_assert(pos == size);
+	traverse_postorder(&z->data, auth_data_del, NULL);
+	rbtree_init(&z->data, &auth_data_cmp);
+	z->compact = block;
+	z->compact_num = num;
+	z->compact_size = size;
+}
+
+/** memory in use by the zone */
+static size_t
+auth_zone_get_mem(struct auth_zone* z)
+{
+	size_t m = sizeof(*z) + z->namelen;
+	struct auth_data* n;
+	struct auth_rrset* r;
+	if(z->zonefile)
+		m += strlen(z->zonefile)+1;
+	if(z->answer_cache)
+		m += slabhash_get_mem(z->answer_cache);
+	if(z->compact)
+		m += z->compact_size;
+	RBTREE_FOR(n, struct auth_data*, &z->data) {
+		m += sizeof(*n) + n->namelen;
+		for(r = n->rrsets; r; r = r->next) {
+			m += sizeof(*r);
+			if(!r->shared)
+				m += packed_rrset_sizeof(r->data);
+		}
+	}
+	return m;
+}
+
+size_t auth_zones_get_mem(struct auth_zones* az)
+{
+	size_t m;
+	struct auth_zone* z;
+	if(!az) return 0;
+	m = sizeof(*az);
+	lock_rw_rdlock(&az->lock);
+	RBTREE_FOR(z, struct auth_zone*, &az->ztree) {
+		lock_rw_rdlock(&z->lock);
+		m += auth_zone_get_mem(z);
+		lock_rw_unlock(&z->lock);
+	}
+	lock_rw_unlock(&az->lock);
+	return m;
+}
+
 /** delete an auth zone structure (tree remove must be done elsewhere) */
 static void
 auth_zone_delete(struct auth_zone* z, struct auth_zones* az)
 {
 	if(!z) return;
 	lock_rw_destroy(&z->lock);
-	traverse_postorder(&z->data, auth_data_del, NULL);
+	auth_zone_data_clear(z);
 
 	if(az && z->rpz) {
 		/* keep RPZ linked list intact */
@@ -402,6 +630,7 @@ auth_zone_delete(struct auth_zone* z, struct auth_zones* az)
 	}
 	if(z->rpz)
 		rpz_delete(z->rpz);
+	slabhash_delete(z->answer_cache);
 	free(z->name);
 	free(z->zonefile);
 	free(z);
@@ -604,30 +833,575 @@ az_domain_create(struct auth_zone* z, uint8_t* nm, size_t nmlen)
 	return n;
 }
 
-/** find domain with exactly the given name */
+/** a domain that is decoded from the compact data */
+struct auth_compact_node {
+	/** the domain, the node key is NULL if it is in a region */
+	struct auth_data d;
+	/** the number of the domain in the compact data */
+	size_t index;
+	/** the position of the domain in the compact block */
+	size_t pos;
+};
+
+/** position of the restart domain in the compact block */
+static size_t
+az_compact_restart(struct auth_zone* z, size_t i)
+{
+	return ((size_t*)z->compact)[i];
+}
+
+/** get the name of the compact domain at pos. The name before it is in
+ * nm, with labs labels, it is replaced by the name.  Returns the position
+ * of the rrsets after the name. */
+static size_t
+az_compact_name(struct auth_zone* z, size_t pos, uint8_t* nm,
+	size_t* nmlen, int* labs)
+{
+	uint8_t* p = z->compact + pos;
+	uint8_t* suffix = nm;
+	size_t prefix = p[1], suffixlen;
+	int i;
+	/* the shared labels are at the end of the name before it */
+	for(i=0; i < *labs - (int)p[0]; i++)
+		suffix += *suffix + 1;
+	suffixlen = *nmlen - (size_t)(suffix - nm);
+	memmove(nm+prefix, suffix, suffixlen);
+	memmove(nm, p+2, prefix);
+	*nmlen = prefix + suffixlen;
+	*labs = dname_count_labels(nm);
+	return pos + 2 + prefix;
+}
+
+/** the position after the rrsets of the compact domain, that start at
+ * pos */
+static size_t
+az_compact_skip_rrsets(struct auth_zone* z, size_t pos)
+{
+	uint8_t* p = z->compact + pos;
+	size_t num = sldns_read_uint16(p), i, j, total;
+	p += 2;
+	for(i=0; i<num; i++) {
+		total = (size_t)sldns_read_uint16(p+2) +
+			(size_t)sldns_read_uint16(p+4);
+		p += 10;
+		for(j=0; j<total; j++)
+			p += 6 + sldns_read_uint16(p+4);
+	}
+	return (size_t)(p - z->compact);
+}
+
+/** allocate in the region, or with malloc if region is NULL */
+static void*
+az_alloc(struct regional* region, size_t size)
+{
+	if(region)
+		return regional_alloc(region, size);
+	return malloc(size);
+}
+
+/** decode the compact domain with the number index, at pos, and its name
+ * in nm, into a domain in the region.  If the region is NULL, the domain
+ * is allocated with malloc, and it owns its rrsets, so it can be put in
+ * the data tree.  NULL on malloc failure. */
 static struct auth_data*
-az_find_name(struct auth_zone* z, uint8_t* nm, size_t nmlen)
+az_compact_decode(struct auth_zone* z, struct regional* region,
+	size_t index, size_t pos, uint8_t* nm, size_t nmlen, int labs)
 {
-	struct auth_zone key;
+	struct auth_compact_node* c;
+	struct auth_rrset* r, **prevp;
+	struct packed_rrset_data* d;
+	uint8_t* p = z->compact + pos + 2 + z->compact[pos+1], *rr;
+	size_t num, i, j, total, size;
+	if(!(c = (struct auth_compact_node*)az_alloc(region, sizeof(*c))))
+		return NULL;
+	memset(c, 0, sizeof(*c));
+	c->d.node.key = (region?NULL:c);
+	c->index = index;
+	c->pos = pos;
+	c->d.namelen = nmlen;
+	c->d.namelabs = labs;
+	if(!(c->d.name = (uint8_t*)az_alloc(region, nmlen)))
+		goto fail;
+	memmove(c->d.name, nm, nmlen);
+	num = sldns_read_uint16(p);
+	p += 2;
+	prevp = &c->d.rrsets;
+	for(i=0; i<num; i++) {
+		if(!(r = (struct auth_rrset*)az_alloc(region, sizeof(*r))))
+			goto fail;
+		memset(r, 0, sizeof(*r));
+		r->type = sldns_read_uint16(p);
+		r->shared = (region != NULL);
+		*prevp = r;
+		prevp = &r->next;
+		total = (size_t)sldns_read_uint16(p+2) +
+			(size_t)sldns_read_uint16(p+4);
+		size = sizeof(*d) + total*(sizeof(size_t)+sizeof(uint8_t*)+
+			sizeof(time_t));
+		for(j=0, rr=p+10; j<total; j++) {
+			size += 2 + sldns_read_uint16(rr+4);
+			rr += 6 + sldns_read_uint16(rr+4);
+		}
+		if(!(d = (struct packed_rrset_data*)az_alloc(region, size)))
+			goto fail;
+		memset(d, 0, sizeof(*d));
+		d->count = sldns_read_uint16(p+2);
+		d->rrsig_count = sldns_read_uint16(p+4);
+		d->ttl = (time_t)sldns_read_uint32(p+6);
+		d->trust = rrset_trust_prim_noglue;
+		r->data = d;
+		p += 10;
+		d->rr_len = (size_t*)((uint8_t*)d + sizeof(*d));
+		for(j=0, rr=p; j<total; j++) {
+			d->rr_len[j] = 2 + sldns_read_uint16(rr+4);
+			rr += 4 + d->rr_len[j];
+		}
+		packed_rrset_ptr_fixup(d);
+		for(j=0; j<total; j++) {
+			d->rr_ttl[j] = (time_t)sldns_read_uint32(p);
+			memmove(d->rr_data[j], p+4, d->rr_len[j]);
+			p += 4 + d->rr_len[j];
+		}
+	}
+	return &c->d;
+fail:
+	log_err("out of memory decoding compact auth zone data");
+	if(!region)
+		auth_data_delete(&c->d);
+	return NULL;
+}
+
+/** binary search in the compact data for the domain, or the one before
+ * it.  Returns true if exact match.  The number, position and name of
+ * the domain are returned, the number is compact_num if there is no
+ * domain before it. */
+static int
+az_compact_search(struct auth_zone* z, struct auth_data* key, size_t* index,
+	size_t* pos, uint8_t* nm, size_t* nmlen, int* labs)
+{
+	size_t lo = 0, hi = AZ_COMPACT_NUM_RESTART(z->compact_num), mid;
+	size_t i, p, r;
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
+	struct auth_data cur;
+	int c;
+	*index = z->compact_num;
+	cur.name = buf;
+	/* find the last restart domain that sorts before the key */
+	while(lo < hi) {
+		mid = lo + (hi-lo)/2;
+		cur.namelen = 0;
+		cur.namelabs = 0;
+		(void)az_compact_name(z, az_compact_restart(z, mid), buf,
+			&cur.namelen, &cur.namelabs);
+		if(auth_data_cmp(&cur, key) <= 0)
+			lo = mid+1;
+		else	hi = mid;
+	}
+	if(lo == 0)
+		return 0;
+	/* walk from the restart domain up to the key */
+	i = (lo-1)*AZ_COMPACT_RESTART;
+	p = az_compact_restart(z, lo-1);
+	cur.namelen = 0;
+	cur.namelabs = 0;
+	for(; i < z->compact_num && i < lo*AZ_COMPACT_RESTART; i++) {
+		r = az_compact_name(z, p, buf, &cur.namelen, &cur.namelabs);
+		if((c = auth_data_cmp(&cur, key)) > 0)
+			break;
+		*index = i;
+		*pos = p;
+		memmove(nm, buf, cur.namelen);
+		*nmlen = cur.namelen;
+		*labs = cur.namelabs;
+		if(c == 0)
+			return 1;
+		p = az_compact_skip_rrsets(z, r);
+	}
+	return 0;
+}
+
+/** if the compact data has the domain */
+static int
+az_compact_has(struct auth_zone* z, struct auth_data* key)
+{
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t index, pos, nmlen;
+	int labs;
+	return z->compact && az_compact_search(z, key, &index, &pos, nm,
+		&nmlen, &labs);
+}
+
+/** the compact domain with the number index, decoded in the region,
+ * or NULL */
+static struct auth_data*
+az_compact_get(struct auth_zone* z, struct regional* region, size_t index)
+{
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t nmlen = 0, i = index - index%AZ_COMPACT_RESTART, pos, r;
+	int labs = 0;
+	if(index >= z->compact_num)
+		return NULL;
+	pos = az_compact_restart(z, i/AZ_COMPACT_RESTART);
+	for(;;) {
+		r = az_compact_name(z, pos, nm, &nmlen, &labs);
+		if(i == index)
+			break;
+		pos = az_compact_skip_rrsets(z, r);
+		i++;
+	}
+	return az_compact_decode(z, region, index, pos, nm, nmlen, labs);
+}
+
+/** the compact domain after n, decoded in the region, or NULL */
+static struct auth_data*
+az_compact_next(struct auth_zone* z, struct regional* region,
+	struct auth_data* n)
+{
+	struct auth_compact_node* c = (struct auth_compact_node*)n;
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t nmlen = n->namelen, pos;
+	int labs = n->namelabs;
+	if(c->index+1 >= z->compact_num)
+		return NULL;
+	pos = az_compact_skip_rrsets(z, c->pos + 2 + z->compact[c->pos+1]);
+	memmove(nm, n->name, nmlen);
+	(void)az_compact_name(z, pos, nm, &nmlen, &labs);
+	return az_compact_decode(z, region, c->index+1, pos, nm, nmlen, labs);
+}
+
+/** the compact domain before n, decoded in the region, or NULL */
+static struct auth_data*
+az_compact_previous(struct auth_zone* z, struct regional* region,
+	struct auth_data* n)
+{
+	struct auth_compact_node* c = (struct auth_compact_node*)n;
+	if(c->index == 0)
+		return NULL;
+	return az_compact_get(z, region, c->index-1);
+}
+
+/** find the domain in the compact data, or the one before it (or NULL),
+ * decoded in the region. returns true if exact match */
+static int
+az_compact_find_less_equal(struct auth_zone* z, struct regional* region,
+	struct auth_data* key, struct auth_data** node)
+{
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t index, pos, nmlen;
+	int labs, exact = az_compact_search(z, key, &index, &pos, nm,
+		&nmlen, &labs);
+	if(index == z->compact_num)
+		*node = NULL;
+	else	*node = az_compact_decode(z, region, index, pos, nm, nmlen,
+			labs);
+	return exact;
+}
+
+/** if the domain is decoded from the compact data, and not in the data
+ * tree */
+static int
+az_in_compact(struct auth_data* n)
+{
+	return n->node.key == NULL;
+}
+
+/** the next domain in the data tree, or NULL */
+static struct auth_data*
+az_tree_next(struct auth_data* n)
+{
+	rbnode_type* r = rbtree_next(&n->node);
+	return (r==RBTREE_NULL?NULL:(struct auth_data*)r->key);
+}
+
+/** the previous domain in the data tree, or NULL */
+static struct auth_data*
+az_tree_previous(struct auth_data* n)
+{
+	rbnode_type* r = rbtree_previous(&n->node);
+	return (r==RBTREE_NULL?NULL:(struct auth_data*)r->key);
+}
+
+/** the first domain from o, in the data tree, and b, in the compact data,
+ * going up in canonical order. A domain in the data tree replaces the
+ * compact domain with the same name, and if it has no rrsets it removes
+ * it. */
+static struct auth_data*
+az_merge_next(struct auth_zone* z, struct regional* region,
+	struct auth_data* o, struct auth_data* b)
+{
+	int c = 0;
+	while(o) {
+		if(b && (c = auth_data_cmp(o, b)) > 0)
+			return b;
+		if(b && c == 0)
+			b = az_compact_next(z, region, b);
+		if(o->rrsets)
+			return o;
+		o = az_tree_next(o);
+	}
+	return b;
+}
+
+/** the first domain from o and b going down in canonical order, like
+ * az_merge_next. */
+static struct auth_data*
+az_merge_previous(struct auth_zone* z, struct regional* region,
+	struct auth_data* o, struct auth_data* b)
+{
+	int c = 0;
+	while(o) {
+		if(b && (c = auth_data_cmp(o, b)) < 0)
+			return b;
+		if(b && c == 0)
+			b = az_compact_previous(z, region, b);
+		if(o->rrsets)
+			return o;
+		o = az_tree_previous(o);
+	}
+	return b;
+}
+
+/** find domain with exactly the given name, the domains of the compact
+ * data are decoded in the region */
+static struct auth_data*
+az_find_name(struct auth_zone* z, struct regional* region, uint8_t* nm,
+	size_t nmlen)
+{
+	struct auth_data key, *n;
 	key.node.key = &key;
 	key.name = nm;
 	key.namelen = nmlen;
 	key.namelabs = dname_count_labels(nm);
-	return (struct auth_data*)rbtree_search(&z->data, &key);
+	if((n = (struct auth_data*)rbtree_search(&z->data, &key)) != NULL)
+		return (n->rrsets?n:NULL);
+	if(z->ixfr_base)
+		return az_find_name(z->ixfr_base, region, nm, nmlen);
+	if(z->compact && az_compact_find_less_equal(z, region, &key, &n))
+		return n;
+	return NULL;
+}
+
+/** previous domain in the zone before node, or NULL */
+static struct auth_data*
+az_previous(struct auth_zone* z, struct regional* region,
+	struct auth_data* node)
+{
+	struct auth_data* o = NULL, *b = NULL;
+	if(az_in_compact(node)) {
+		if(rbtree_find_less_equal(&z->data, node, (rbnode_type**)&o)
+			&& o)
+			o = az_tree_previous(o);
+		b = az_compact_previous(z, region, node);
+	} else {
+		o = az_tree_previous(node);
+		if(z->compact && az_compact_find_less_equal(z, region, node,
+			&b) && b)
+			b = az_compact_previous(z, region, b);
+	}
+	return az_merge_previous(z, region, o, b);
 }
 
 /** Find domain name (or closest match) */
 static void
-az_find_domain(struct auth_zone* z, struct query_info* qinfo, int* node_exact,
-	struct auth_data** node)
+az_find_domain(struct auth_zone* z, struct regional* region,
+	struct query_info* qinfo, int* node_exact, struct auth_data** node)
 {
-	struct auth_zone key;
+	struct auth_data key;
+	struct auth_data* o = NULL;
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t index = 0, pos = 0, nmlen = 0;
+	int o_exact, b_exact = 0, labs = 0;
 	key.node.key = &key;
 	key.name = qinfo->qname;
 	key.namelen = qinfo->qname_len;
 	key.namelabs = dname_count_labels(key.name);
-	*node_exact = rbtree_find_less_equal(&z->data, &key,
-		(rbnode_type**)node);
+	o_exact = rbtree_find_less_equal(&z->data, &key, (rbnode_type**)&o);
+	if(z->compact)
+		b_exact = az_compact_search(z, &key, &index, &pos, nm, &nmlen,
+			&labs);
+	if(!z->compact || index == z->compact_num) {
+		/* no domain in the compact data before it */
+		index = z->compact_num;
+	} else if(o) {
+		struct auth_data b;
+		b.name = nm;
+		b.namelen = nmlen;
+		b.namelabs = labs;
+		if(auth_data_cmp(o, &b) < 0)
+			o = NULL;
+	}
+	if(o) {
+		/* the domain from the tree, if it is removed, the one
+		 * before it */
+		if(o->rrsets) {
+			*node_exact = o_exact;
+			*node = o;
+		} else {
+			*node_exact = 0;
+			*node = az_previous(z, region, o);
+		}
+		return;
+	}
+	*node_exact = b_exact;
+	if(index == z->compact_num)
+		*node = NULL;
+	else	*node = az_compact_decode(z, region, index, pos, nm, nmlen,
+			labs);
+}
+
+/** first domain in the zone in canonical order, or NULL */
+static struct auth_data*
+az_first(struct auth_zone* z, struct regional* region)
+{
+	rbnode_type* n = rbtree_first(&z->data);
+	return az_merge_next(z, region, (n==RBTREE_NULL?NULL:
+		(struct auth_data*)n->key), (z->compact?az_compact_get(z,
+		region, 0):NULL));
+}
+
+/** last domain in the zone in canonical order, or NULL */
+static struct auth_data*
+az_last(struct auth_zone* z, struct regional* region)
+{
+	rbnode_type* n = rbtree_last(&z->data);
+	return az_merge_previous(z, region, (n==RBTREE_NULL?NULL:
+		(struct auth_data*)n->key), (z->compact?az_compact_get(z,
+		region, z->compact_num-1):NULL));
+}
+
+/** next domain in the zone after node, or NULL */
+static struct auth_data*
+az_next(struct auth_zone* z, struct regional* region, struct auth_data* node)
+{
+	struct auth_data* o = NULL, *b = NULL;
+	if(az_in_compact(node)) {
+		rbnode_type* r;
+		(void)rbtree_find_less_equal(&z->data, node, (rbnode_type**)&o);
+		if(o)
+			o = az_tree_next(o);
+		else if((r = rbtree_first(&z->data)) != RBTREE_NULL)
+			o = (struct auth_data*)r->key;
+		b = az_compact_next(z, region, node);
+	} else {
+		o = az_tree_next(node);
+		if(z->compact) {
+			(void)az_compact_find_less_equal(z, region, node, &b);
+			if(!b)
+				b = az_compact_get(z, region, 0);
+			else	b = az_compact_next(z, region, b);
+		}
+	}
+	return az_merge_next(z, region, o, b);
+}
+
+/** next domain in a walk over all the domains of the zone, or the first
+ * if n is NULL. The region has the decoded compact domains, it is freed
+ * at every step, so that it keeps only the current domain. */
+static struct auth_data*
+az_walk_next(struct auth_zone* z, struct regional* region,
+	struct auth_data* n)
+{
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t index, pos, nmlen;
+	int labs;
+	n = (n?az_next(z, region, n):az_first(z, region));
+	if(!n || !az_in_compact(n)) {
+		regional_free_all(region);
+		return n;
+	}
+	/* decode it again, in the freed region */
+	index = ((struct auth_compact_node*)n)->index;
+	pos = ((struct auth_compact_node*)n)->pos;
+	nmlen = n->namelen;
+	labs = n->namelabs;
+	memmove(nm, n->name, nmlen);
+	regional_free_all(region);
+	return az_compact_decode(z, region, index, pos, nm, nmlen, labs);
+}
+
+/** copy auth data domain node, with its rrsets. If share is true, the
+ * copy shares the rrset data with n, otherwise the data is copied too.
+ * NULL on malloc failure */
+static struct auth_data*
+auth_data_copy(struct auth_data* n, int share)
+{
+	struct auth_rrset* p, **prevp;
+	struct auth_data* c = (struct auth_data*)calloc(1, sizeof(*c));
+	if(!c) return NULL;
+	c->node.key = c;
+	c->name = memdup(n->name, n->namelen);
+	if(!c->name) {
+		free(c);
+		return NULL;
+	}
+	c->namelen = n->namelen;
+	c->namelabs = n->namelabs;
+	prevp = &c->rrsets;
+	for(p = n->rrsets; p; p = p->next) {
+		struct auth_rrset* r = (struct auth_rrset*)calloc(1,
+			sizeof(*r));
+		if(!r) {
+			auth_data_delete(c);
+			return NULL;
+		}
+		r->type = p->type;
+		*prevp = r;
+		prevp = &r->next;
+		if(share) {
+			r->data = p->data;
+			r->shared = 1;
+			continue;
+		}
+		r->data = (struct packed_rrset_data*)memdup(p->data,
+			packed_rrset_sizeof(p->data));
+		if(!r->data) {
+			auth_data_delete(c);
+			return NULL;
+		}
+		packed_rrset_ptr_fixup(r->data);
+	}
+	return c;
+}
+
+/** find the domain to change in the zone. For the staging zone of an IXFR
+ * a domain of the zone it changes is copied into the staging data tree,
+ * that copy is changed.  The domain is NULL if not found, and for the
+ * staging zone it can have no rrsets, if it is removed.
+ * false on malloc failure */
+static int
+az_domain_for_change(struct auth_zone* z, uint8_t* nm, size_t nmlen,
+	struct auth_data** node)
+{
+	struct auth_zone* base = z->ixfr_base;
+	struct auth_data key, *n;
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
+	size_t index, pos, buflen;
+	int labs;
+	key.node.key = &key;
+	key.name = nm;
+	key.namelen = nmlen;
+	key.namelabs = dname_count_labels(nm);
+	*node = (struct auth_data*)rbtree_search(&z->data, &key);
+	if(*node || !base)
+		return 1;
+	if((n = (struct auth_data*)rbtree_search(&base->data, &key))) {
+		/* the changed domain of an earlier IXFR, or a removed one */
+		if(!n->rrsets)
+			return 1;
+		*node = auth_data_copy(n, 1);
+	} else if(base->compact && az_compact_search(base, &key, &index,
+		&pos, buf, &buflen, &labs)) {
+		*node = az_compact_decode(base, NULL, index, pos, buf,
+			buflen, labs);
+	} else {
+		return 1;
+	}
+	if(!*node) {
+		log_err("out of memory");
+		return 0;
+	}
+	(void)rbtree_insert(&z->data, &(*node)->node);
+	return 1;
 }
 
 /** find or create domain with name in zone */
@@ -635,7 +1409,9 @@ static struct auth_data*
 az_domain_find_or_create(struct auth_zone* z, uint8_t* dname,
 	size_t dname_len)
 {
-	struct auth_data* n = az_find_name(z, dname, dname_len);
+	struct auth_data* n;
+	if(!az_domain_for_change(z, dname, dname_len, &n))
+		return NULL;
 	if(!n) {
 		n = az_domain_create(z, dname, dname_len);
 	}
@@ -779,8 +1555,7 @@ rrset_remove_rr(struct auth_rrset* rrset, size_t index)
 			d->ttl = d->rr_ttl[i];
 	}
 
-	free(rrset->data);
-	rrset->data = d;
+	auth_rrset_set_data(rrset, d);
 	return 1;
 }
 
@@ -850,8 +1625,7 @@ rrset_add_rr(struct auth_rrset* rrset, uint32_t rr_ttl, uint8_t* rdata,
 		memmove(d->rr_data[total-1], rdata, rdatalen);
 	}
 
-	rrset->data = d;
-	free(old);
+	auth_rrset_set_data(rrset, d);
 	return 1;
 }
 
@@ -998,8 +1772,7 @@ rrset_moveover_rrsigs(struct auth_data* node, uint16_t rr_type,
 	}
 
 	/* put it in and deallocate the old rrset */
-	rrset->data = d;
-	free(old);
+	auth_rrset_set_data(rrset, d);
 
 	/* now make rrsig set smaller */
 	if(sigold->count+sigold->rrsig_count == sigs) {
@@ -1054,8 +1827,7 @@ rrset_moveover_rrsigs(struct auth_data* node, uint16_t rr_type,
 	}
 
 	/* put it in and deallocate the old rrset */
-	rrsig->data = sigd;
-	free(sigold);
+	auth_rrset_set_data(rrsig, sigd);
 
 	return 1;
 }
@@ -1151,6 +1923,96 @@ az_domain_add_rr(struct auth_data* node, uint16_t rr_type, uint32_t rr_ttl,
 	return 1;
 }
 
+/** An RR that is added to or removed from the RPZ policies, when the
+ * data of the IXFR is published. Allocated together with the RR. */
+struct auth_rpz_change {
+	/** next in list */
+	struct auth_rpz_change* next;
+	/** if the RR is added, or removed */
+	int add;
+	/** length of the RR */
+	size_t rr_len;
+	/** length of the owner name, at the start of the RR */
+	size_t dname_len;
+	/** the RR in uncompressed wireformat */
+	uint8_t* rr;
+};
+
+/** add an RPZ change to the list of the staging zone, false on malloc
+ * failure */
+static int
+az_rpz_change_add(struct auth_zone* z, int add, uint8_t* rr, size_t rr_len,
+	size_t dname_len)
+{
+	struct auth_rpz_change* c;
+	if(!dname_subdomain_c(rr, z->name)) {
+		/* the RPZ cannot insert it, and ignores the removal */
+		if(add)
+			log_err("RPZ: name of record to insert into RPZ is "
+				"not a subdomain of the name of the RPZ zone");
+		return !add;
+	}
+	c = (struct auth_rpz_change*)malloc(sizeof(*c) + rr_len);
+	if(!c) {
+		log_err("out of memory");
+		return 0;
+	}
+	c->next = NULL;
+	c->add = add;
+	c->rr_len = rr_len;
+	c->dname_len = dname_len;
+	c->rr = (uint8_t*)(c+1);
+	memmove(c->rr, rr, rr_len);
+	*z->rpz_changes_last = c;
+	z->rpz_changes_last = &c->next;
+	return 1;
+}
+
+/** delete the list of RPZ changes of the staging zone */
+static void
+az_rpz_changes_delete(struct auth_zone* z)
+{
+	struct auth_rpz_change* c = z->rpz_changes, *n;
+	while(c) {
+		n = c->next;
+		free(c);
+		c = n;
+	}
+	z->rpz_changes = NULL;
+	z->rpz_changes_last = NULL;
+}
+
+/** make the RPZ changes of the staging zone s to the policies of the zone
+ * z, that is writelocked */
+static void
+az_rpz_changes_apply(struct auth_zone* z, struct auth_zone* s)
+{
+	struct auth_rpz_change* c;
+	rpz_apply_start(z->rpz);
+	for(c = s->rpz_changes; c; c = c->next) {
+		uint16_t rr_type = sldns_wirerr_get_type(c->rr, c->rr_len,
+			c->dname_len);
+		uint16_t rr_class = sldns_wirerr_get_class(c->rr, c->rr_len,
+			c->dname_len);
+		size_t rdatalen = ((size_t)sldns_wirerr_get_rdatalen(c->rr,
+			c->rr_len, c->dname_len))+2;
+		uint8_t* rdata = sldns_wirerr_get_rdatawl(c->rr, c->rr_len,
+			c->dname_len);
+		if(c->add) {
+			if(!rpz_insert_rr(z->rpz, z->name, z->namelen, c->rr,
+				c->dname_len, rr_type, rr_class,
+				sldns_wirerr_get_ttl(c->rr, c->rr_len,
+				c->dname_len), rdata, rdatalen, c->rr,
+				c->rr_len))
+				log_err("RPZ: could not insert RR");
+		} else {
+			rpz_remove_rr(z->rpz, z->namelen, c->rr, c->dname_len,
+				rr_type, rr_class, rdata, rdatalen);
+		}
+	}
+	rpz_finish_config(z->rpz);
+}
+
 /** insert RR into zone, ignore duplicates */
 static int
 az_insert_rr(struct auth_zone* z, uint8_t* rr, size_t rr_len,
@@ -1166,6 +2028,9 @@ az_insert_rr(struct auth_zone* z, uint8_t* rr, size_t rr_len,
 	/* rdata points to rdata prefixed with uint16 rdatalength */
 	uint8_t* rdata = sldns_wirerr_get_rdatawl(rr, rr_len, dname_len);
 
+	/* compact data is not changed, changes go to a staging zone */
+	log_assert(!z->compact);
+
 	if(rr_class != z->dclass) {
 		log_err("wrong class for RR");
 		return 0;
@@ -1179,7 +2044,10 @@ az_insert_rr(struct auth_zone* z, uint8_t* rr, size_t rr_len,
 		log_err("cannot add RR to domain");
 		return 0;
 	}
-	if(z->rpz) {
+	if(z->rpz_changes_last && !(duplicate && *duplicate)) {
+		if(!az_rpz_change_add(z, 1, rr, rr_len, dname_len))
+			return 0;
+	} else if(z->rpz) {
 		if(!(rpz_insert_rr(z->rpz, z->name, z->namelen, dname,
 			dname_len, rr_type, rr_class, rr_ttl, rdata, rdatalen,
 			rr, rr_len)))
@@ -1274,6 +2142,9 @@ az_remove_rr(struct auth_zone* z, uint8_t* rr, size_t rr_len,
 	/* rdata points to rdata prefixed with uint16 rdatalength */
 	uint8_t* rdata = sldns_wirerr_get_rdatawl(rr, rr_len, dname_len);
 
+	/* compact data is not changed, changes go to a staging zone */
+	log_assert(!z->compact);
+
 	if(rr_class != z->dclass) {
 		log_err("wrong class for RR");
 		/* really also a nonexisting entry, because no records
@@ -1282,8 +2153,9 @@ az_remove_rr(struct auth_zone* z, uint8_t* rr, size_t rr_len,
 		 * zone transfer */
 		return 0;
 	}
-	node = az_find_name(z, dname, dname_len);
-	if(!node) {
+	if(!az_domain_for_change(z, dname, dname_len, &node))
+		return 0;
+	if(!node || !node->rrsets) {
 		/* node with that name does not exist */
 		/* nonexisting entry, because no such name */
 		*nonexist = 1;
@@ -1295,12 +2167,17 @@ az_remove_rr(struct auth_zone* z, uint8_t* rr, size_t rr_len,
 	}
 	/* remove the node, if necessary */
 	/* an rrsets==NULL entry is not kept around for empty nonterminals,
-	 * and also parent nodes are not kept around, so we just delete it */
-	if(node->rrsets == NULL) {
+	 * and also parent nodes are not kept around, so we just delete it.
+	 * In the staging zone of an IXFR it is kept, it removes the
+	 * domain when the data is published. */
+	if(node->rrsets == NULL && !z->ixfr_base) {
 		(void)rbtree_delete(&z->data, node);
 		auth_data_delete(node);
 	}
-	if(z->rpz) {
+	if(z->rpz_changes_last && !*nonexist) {
+		if(!az_rpz_change_add(z, 0, rr, rr_len, dname_len))
+			return 0;
+	} else if(z->rpz) {
 		rpz_remove_rr(z->rpz, z->namelen, dname, dname_len, rr_type,
 			rr_class, rdata, rdatalen);
 	}
@@ -1536,28 +2413,407 @@ az_parse_file(struct auth_zone* z, FILE* in, uint8_t* rr, size_t rrbuflen,
 			continue;
 		}
 		if(status != 0) {
-			log_err("parse error %s %d:%d: %s", fname,
-				state->lineno, LDNS_WIREPARSE_OFFSET(status),
+			log_err("parse error %s %d:%d: %s", fname,
+				state->lineno, LDNS_WIREPARSE_OFFSET(status),
+				sldns_get_errorstr_parse(status));
+			return 0;
+		}
+		if(rr_len == 0) {
+			/* EMPTY line, TTL or ORIGIN */
+			continue;
+		}
+		/* insert wirerr in rrbuf */
+		if(!az_insert_rr(z, rr, rr_len, dname_len, NULL)) {
+			char buf[17];
+			sldns_wire2str_type_buf(sldns_wirerr_get_type(rr,
+				rr_len, dname_len), buf, sizeof(buf));
+			log_err("%s:%d cannot insert RR of type %s",
+				fname, state->lineno, buf);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_FMEMOPEN) && !defined(THREADS_DISABLED)
+/** zonefiles are parsed in parallel, in chunks on several threads */
+#define AZ_PARALLEL_LOAD 1
+/** zonefiles smaller than this are parsed on one thread */
+#define AZ_LOAD_PARALLEL_MIN (1024*1024)
+/** max number of threads for zonefile parsing */
+#define AZ_LOAD_MAX_THREADS 16
+
+/** A parsed RR, stored in the region of the chunk */
+struct az_load_rr {
+	/** next in list */
+	struct az_load_rr* next;
+	/** line number, for errors */
+	int lineno;
+	/** the RR in uncompressed wireformat */
+	uint8_t* rr;
+	/** length of rr */
+	size_t rr_len;
+	/** length of the owner name at the start of rr */
+	size_t dname_len;
+};
+
+/** A $ directive entry in the zonefile, like $ORIGIN and $TTL */
+struct az_load_directive {
+	/** start offset of the entry in the text */
+	size_t start;
+	/** end offset of the entry */
+	size_t end;
+};
+
+/** Part of the zonefile that is parsed by one thread */
+struct az_load_chunk {
+	/** filename, for errors */
+	const char* fname;
+	/** the text of the chunk, it is not zero terminated */
+	char* text;
+	/** length of text */
+	size_t len;
+	/** parse state at the start of the chunk */
+	struct sldns_file_parse_state state;
+	/** region with the parsed RRs */
+	struct regional* region;
+	/** list of parsed RRs, in file order */
+	struct az_load_rr* first;
+	/** last in the list */
+	struct az_load_rr* last;
+	/** true if the chunk was parsed without error */
+	int ok;
+	/** thread that parses the chunk */
+	ub_thread_type thr;
+	/** true if the thread was started */
+	int thr_started;
+};
+
+/** true if the char can start an owner name, at the start of an entry,
+ * so the entry does not use the previous owner name */
+static int
+az_load_owner_char(char c)
+{
+	return !(c == ' ' || c == '\t' || c == '\n' || c == '\r' ||
+		c == '\f' || c == '\v' || c == ';' || c == '(' ||
+		c == ')' || c == '$' || c == '"');
+}
+
+/**
+ * Scan the zonefile text for entry boundaries, with the rules of the
+ * sldns_fp2wire_rr_buf tokenizer for parentheses, comments and quoted
+ * strings.  The chunk boundaries are the entry starts, with an owner
+ * name, at or after the split targets.  The $ entries are listed, the
+ * chunks start with the $ORIGIN and $TTL state from them.
+ * @param text: zonefile text.
+ * @param len: length of the text.
+ * @param num: number of chunks.
+ * @param bounds: start offsets of the chunks, bounds[0] is 0.  Chunks
+ *	that have no boundary start at len.
+ * @param lines: line numbers of the chunk starts.
+ * @param dirs: returned malloced array of $ entries.
+ * @param dirnum: number of $ entries.
+ * @return false if the file cannot be split, like with $INCLUDE, or on
+ *	malloc failure.
+ */
+static int
+az_load_scan(char* text, size_t len, int num, size_t* bounds, int* lines,
+	struct az_load_directive** dirs, size_t* dirnum)
+{
+	int p = 0, com = 0, quoted = 0, prev = 0, line = 1, k = 1;
+	int in_dir = 0;
+	size_t i, cnt, dirmax = 0;
+	size_t s = 0; /* start of the entry */
+
+	*dirs = NULL;
+	*dirnum = 0;
+	bounds[0] = 0;
+	lines[0] = 1;
+	i = 0;
+	while(1) {
+		/* at the start of a line that starts an entry */
+		if(s < len && text[s] == '$') {
+			if(strncmp(text+s, "$INCLUDE", 8) == 0)
+				goto fail;
+			if(*dirnum == dirmax) {
+				struct az_load_directive* d;
+				dirmax = (dirmax?dirmax*2:16);
+				d = (struct az_load_directive*)realloc(*dirs,
+					dirmax*sizeof(*d));
+				if(!d) goto fail;
+				*dirs = d;
+			}
+			(*dirs)[*dirnum].start = s;
+			(*dirs)[*dirnum].end = len;
+			(*dirnum)++;
+			in_dir = 1;
+		} else if(s < len && k < num &&
+			s >= (len/(size_t)num)*(size_t)k &&
+			az_load_owner_char(text[s])) {
+			bounds[k] = s;
+			lines[k] = line;
+			k++;
+		}
+		cnt = 0;
+		for(; i<len; i++) {
+			char c = text[i];
+			if(c == '\r')
+				c = ' ';
+			if(c == '(' && prev != '\\' && !quoted) {
+				if(!com) p++;
+				prev = c;
+				continue;
+			}
+			if(c == ')' && prev != '\\' && !quoted) {
+				if(!com) p--;
+				prev = c;
+				continue;
+			}
+			if(p < 0)
+				goto fail; /* the parser gives the error */
+			if(c == ';' && !quoted && prev != '\\')
+				com = 1;
+			if(c == '"' && !com && prev != '\\')
+				quoted = !quoted;
+			if(c == '\n') {
+				line++;
+				/* the end of a comment ends the entry, and
+				 * so does an unescaped newline.  After an
+				 * empty line, the entry starts on the next */
+				if(p == 0 && (cnt == 0 || com || prev != '\\')) {
+					com = 0;
+					quoted = 0;
+					prev = 0;
+					i++;
+					break;
+				}
+				com = 0;
+				prev = c;
+				continue;
+			}
+			if(com) {
+				prev = c;
+				continue;
+			}
+			if(c != '\0')
+				cnt++;
+			if(c == '\\' && prev == '\\')
+				prev = 0;
+			else	prev = c;
+		}
+		if(in_dir) {
+			(*dirs)[*dirnum-1].end = i;
+			in_dir = 0;
+		}
+		if(i >= len)
+			break;
+		s = i;
+	}
+	for(; k < num; k++) {
+		bounds[k] = len;
+		lines[k] = line;
+	}
+	return 1;
+fail:
+	free(*dirs);
+	*dirs = NULL;
+	*dirnum = 0;
+	return 0;
+}
+
+/** apply the $ entry to the parse state, false on failure */
+static int
+az_load_directive(char* text, struct az_load_directive* d,
+	struct sldns_file_parse_state* state)
+{
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t rr_len = sizeof(rr), dname_len = 0;
+	int status, lineno = state->lineno;
+	FILE* in = fmemopen(text+d->start, d->end-d->start, "r");
+	if(!in)
+		return 0;
+	status = sldns_fp2wire_rr_buf(in, rr, &rr_len, &dname_len, state);
+	fclose(in);
+	state->lineno = lineno;
+	return (status == 0 || (status == LDNS_WIREPARSE_ERR_INCLUDE &&
+		rr_len == 0));
+}
+
+/** parse the chunk of zonefile into RRs in the region, thread function */
+static void*
+az_load_chunk_parse(void* arg)
+{
+	struct az_load_chunk* c = (struct az_load_chunk*)arg;
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t rr_len, dname_len;
+	int status;
+	FILE* in;
+	if(c->thr_started)
+		ub_thread_blocksigs();
+	if(c->len == 0) {
+		c->ok = 1;
+		return NULL;
+	}
+	in = fmemopen(c->text, c->len, "r");
+	if(!in) {
+		log_err("fmemopen failed: %s", strerror(errno));
+		return NULL;
+	}
+	while(!feof(in)) {
+		struct az_load_rr* r;
+		rr_len = sizeof(rr);
+		dname_len = 0;
+		status = sldns_fp2wire_rr_buf(in, rr, &rr_len, &dname_len,
+			&c->state);
+		if(status == LDNS_WIREPARSE_ERR_INCLUDE && rr_len == 0) {
+			/* $something, $INCLUDE is not in the chunks */
+			continue;
+		}
+		if(status != 0) {
+			log_err("parse error %s %d:%d: %s", c->fname,
+				c->state.lineno, LDNS_WIREPARSE_OFFSET(status),
 				sldns_get_errorstr_parse(status));
-			return 0;
+			fclose(in);
+			return NULL;
 		}
 		if(rr_len == 0) {
 			/* EMPTY line, TTL or ORIGIN */
 			continue;
 		}
-		/* insert wirerr in rrbuf */
-		if(!az_insert_rr(z, rr, rr_len, dname_len, NULL)) {
+		r = (struct az_load_rr*)regional_alloc(c->region, sizeof(*r));
+		if(!r || !(r->rr = regional_alloc_init(c->region, rr,
+			rr_len))) {
+			log_err("out of memory");
+			fclose(in);
+			return NULL;
+		}
+		r->next = NULL;
+		r->lineno = c->state.lineno;
+		r->rr_len = rr_len;
+		r->dname_len = dname_len;
+		if(c->last)
+			c->last->next = r;
+		else	c->first = r;
+		c->last = r;
+	}
+	fclose(in);
+	c->ok = 1;
+	return NULL;
+}
+
+/** insert the parsed RRs of the chunk in the zone, false on failure */
+static int
+az_load_chunk_merge(struct auth_zone* z, struct az_load_chunk* c)
+{
+	struct az_load_rr* r;
+	for(r = c->first; r; r = r->next) {
+		if(!az_insert_rr(z, r->rr, r->rr_len, r->dname_len, NULL)) {
 			char buf[17];
-			sldns_wire2str_type_buf(sldns_wirerr_get_type(rr,
-				rr_len, dname_len), buf, sizeof(buf));
+			sldns_wire2str_type_buf(sldns_wirerr_get_type(r->rr,
+				r->rr_len, r->dname_len), buf, sizeof(buf));
 			log_err("%s:%d cannot insert RR of type %s",
-				fname, state->lineno, buf);
+				c->fname, r->lineno, buf);
 			return 0;
 		}
 	}
 	return 1;
 }
 
+/**
+ * Read the zonefile in parallel.  The file is mapped into memory and
+ * split at entry boundaries, the chunks are parsed on threads into
+ * their own region, and the RRs are inserted in the zone in file order,
+ * while the later chunks are being parsed.
+ * @param z: zone, with empty data.
+ * @param in: the opened zonefile.
+ * @param fname: filename for errors.
+ * @param state: parse state at the start of the file.
+ * @param num: number of threads.
+ * @return 1 on success, 0 on failure, -1 if the file is not suitable,
+ *	too small or with $INCLUDE, and it has to be read line by line.
+ */
+static int
+az_load_parallel(struct auth_zone* z, FILE* in, char* fname,
+	struct sldns_file_parse_state* state, int num)
+{
+	struct stat st;
+	char* text;
+	size_t len, bounds[AZ_LOAD_MAX_THREADS], dirnum, d = 0;
+	int lines[AZ_LOAD_MAX_THREADS];
+	struct az_load_directive* dirs;
+	struct az_load_chunk* chunks;
+	int i, ret = 1;
+
+	if(num > AZ_LOAD_MAX_THREADS)
+		num = AZ_LOAD_MAX_THREADS;
+	if(num < 2 || fstat(fileno(in), &st) < 0 ||
+		st.st_size < AZ_LOAD_PARALLEL_MIN)
+		return -1;
+	len = (size_t)st.st_size;
+	text = (char*)mmap(NULL, len, PROT_READ, MAP_PRIVATE, fileno(in), 0);
+	if(text == MAP_FAILED)
+		return -1;
+#ifdef MADV_SEQUENTIAL
+	(void)madvise(text, len, MADV_SEQUENTIAL);
+#endif
+	if(!az_load_scan(text, len, num, bounds, lines, &dirs, &dirnum)) {
+		munmap(text, len);
+		return -1;
+	}
+	chunks = (struct az_load_chunk*)calloc((size_t)num, sizeof(*chunks));
+	if(!chunks) {
+		free(dirs);
+		munmap(text, len);
+		return -1;
+	}
+	for(i=0; i<num; i++) {
+		struct az_load_chunk* c = &chunks[i];
+		c->fname = fname;
+		c->text = text + bounds[i];
+		c->len = (i+1<num?bounds[i+1]:len) - bounds[i];
+		/* the $ORIGIN and $TTL before the chunk */
+		if(i > 0)
+			memcpy(&c->state, &chunks[i-1].state, sizeof(c->state));
+		else	memcpy(&c->state, state, sizeof(c->state));
+		c->state.lineno = lines[i];
+		while(d < dirnum && dirs[d].start < bounds[i]) {
+			if(!az_load_directive(text, &dirs[d], &c->state))
+				ret = -1; /* the line parser reports it */
+			d++;
+		}
+		c->state.lineno = lines[i];
+		c->state.prev_rr_len = 0;
+		c->region = regional_create_custom(65536);
+		if(!c->region)
+			ret = -1;
+	}
+	free(dirs);
+	if(ret == 1 && verbosity >= VERB_ALGO)
+		verbose(VERB_ALGO, "parse zonefile %s in %d parts", fname,
+			num);
+
+	/* parse the chunks on threads, the first one on this thread */
+	for(i=1; ret == 1 && i<num; i++) {
+		chunks[i].thr_started = 1;
+		ub_thread_create(&chunks[i].thr, az_load_chunk_parse,
+			&chunks[i]);
+	}
+	if(ret == 1)
+		(void)az_load_chunk_parse(&chunks[0]);
+	for(i=0; i<num; i++) {
+		if(chunks[i].thr_started)
+			ub_thread_join(chunks[i].thr);
+		if(ret == 1 && (!chunks[i].ok ||
+			!az_load_chunk_merge(z, &chunks[i])))
+			ret = 0;
+		regional_destroy(chunks[i].region);
+	}
+	free(chunks);
+	munmap(text, len);
+	return ret;
+}
+#endif /* AZ_PARALLEL_LOAD */
+
 int
 auth_zone_read_zonefile(struct auth_zone* z, struct config_file* cfg)
 {
@@ -1565,6 +2821,9 @@ auth_zone_read_zonefile(struct auth_zone* z, struct config_file* cfg)
 	struct sldns_file_parse_state state;
 	char* zfilename;
 	FILE* in;
+#ifdef AZ_PARALLEL_LOAD
+	int r;
+#endif
 	if(!z || !z->zonefile || z->zonefile[0]==0)
 		return 1; /* no file, or "", nothing to read */
 	
@@ -1593,12 +2852,24 @@ auth_zone_read_zonefile(struct auth_zone* z, struct config_file* cfg)
 		return 0;
 	}
 
+	/* clear the RPZ policies, the new policies are loaded beside the
+	 * current ones */
+	if(z->rpz) {
+		rpz_apply_start(z->rpz);
+		if(!rpz_clear(z->rpz)) {
+			char* n = sldns_wire2str_dname(z->name, z->namelen);
+			log_err("cannot read zonefile %s for %s: out of memory",
+				zfilename, n?n:"error");
+			free(n);
+			fclose(in);
+			return 0;
+		}
+	}
 	/* clear the data tree */
-	traverse_postorder(&z->data, auth_data_del, NULL);
-	rbtree_init(&z->data, &auth_data_cmp);
-	/* clear the RPZ policies */
-	if(z->rpz)
-		rpz_clear(z->rpz);
+	auth_zone_data_clear(z);
+	z->data_version++;
+	if(z->answer_cache)
+		slabhash_clear(z->answer_cache);
 
 	memset(&state, 0, sizeof(state));
 	/* default TTL to 3600 */
@@ -1608,6 +2879,25 @@ auth_zone_read_zonefile(struct auth_zone* z, struct config_file* cfg)
 		memcpy(state.origin, z->name, z->namelen);
 		state.origin_len = z->namelen;
 	}
+#ifdef AZ_PARALLEL_LOAD
+	/* large zonefiles are parsed on several threads */
+	if((r = az_load_parallel(z, in, zfilename, &state,
+		cfg->num_threads)) != -1) {
+		if(!r) {
+			char* n = sldns_wire2str_dname(z->name, z->namelen);
+			log_err("error parsing zonefile %s for %s",
+				zfilename, n?n:"error");
+			free(n);
+			fclose(in);
+			return 0;
+		}
+		fclose(in);
+		auth_zone_compact(z);
+		if(z->rpz)
+			rpz_finish_config(z->rpz);
+		return 1;
+	}
+#endif
 	/* parse the (toplevel) file */
 	if(!az_parse_file(z, in, rr, sizeof(rr), &state, zfilename, 0, cfg)) {
 		char* n = sldns_wire2str_dname(z->name, z->namelen);
@@ -1618,6 +2908,7 @@ auth_zone_read_zonefile(struct auth_zone* z, struct config_file* cfg)
 		return 0;
 	}
 	fclose(in);
+	auth_zone_compact(z);
 
 	if(z->rpz)
 		rpz_finish_config(z->rpz);
@@ -1725,19 +3016,28 @@ int auth_zone_write_file(struct auth_zone* z, const char* fname)
 {
 	FILE* out;
 	struct auth_data* n;
+	struct regional* region = regional_create();
+	if(!region) {
+		log_err("out of memory");
+		return 0;
+	}
 	out = fopen(fname, "w");
 	if(!out) {
 		log_err("could not open %s: %s", fname, strerror(errno));
+		regional_destroy(region);
 		return 0;
 	}
-	RBTREE_FOR(n, struct auth_data*, &z->data) {
+	for(n = az_walk_next(z, region, NULL); n;
+		n = az_walk_next(z, region, n)) {
 		if(!auth_zone_write_domain(z, n, out)) {
 			log_err("could not write domain to %s", fname);
 			fclose(out);
+			regional_destroy(region);
 			return 0;
 		}
 	}
 	fclose(out);
+	regional_destroy(region);
 	return 1;
 }
 
@@ -1760,21 +3060,42 @@ auth_zones_read_zones(struct auth_zones* az, struct config_file* cfg)
 	return 1;
 }
 
-/** find serial number of zone or false if none */
-int
-auth_zone_get_serial(struct auth_zone* z, uint32_t* serial)
+/** get the serial, refresh, retry and expiry values from the SOA of the
+ * zone, false if none */
+static int
+az_soa_values(struct auth_zone* z, uint32_t* vals)
 {
+	struct regional* region;
 	struct auth_data* apex;
 	struct auth_rrset* soa;
 	struct packed_rrset_data* d;
-	apex = az_find_name(z, z->name, z->namelen);
-	if(!apex) return 0;
-	soa = az_domain_rrset(apex, LDNS_RR_TYPE_SOA);
-	if(!soa || soa->data->count==0)
-		return 0; /* no RRset or no RRs in rrset */
-	if(soa->data->rr_len[0] < 2+4*5) return 0; /* SOA too short */
-	d = soa->data;
-	*serial = sldns_read_uint32(d->rr_data[0]+(d->rr_len[0]-20));
+	int i, r = 0;
+	/* for the apex that is decoded from compact data */
+	if(!(region = regional_create()))
+		return 0;
+	apex = az_find_name(z, region, z->name, z->namelen);
+	soa = (apex?az_domain_rrset(apex, LDNS_RR_TYPE_SOA):NULL);
+	/* SOA record ends with serial, refresh, retry, expiry, minimum,
+	 * as 4 byte fields */
+	if(soa && soa->data->count != 0 && soa->data->rr_len[0] >= 2+4*5) {
+		d = soa->data;
+		for(i=0; i<4; i++)
+			vals[i] = sldns_read_uint32(d->rr_data[0]+
+				(d->rr_len[0]-20+4*i));
+		r = 1;
+	}
+	regional_destroy(region);
+	return r;
+}
+
+/** find serial number of zone or false if none */
+int
+auth_zone_get_serial(struct auth_zone* z, uint32_t* serial)
+{
+	uint32_t vals[4];
+	if(!az_soa_values(z, vals))
+		return 0;
+	*serial = vals[0];
 	return 1;
 }
 
@@ -1782,24 +3103,14 @@ auth_zone_get_serial(struct auth_zone* z, uint32_t* serial)
 static int
 xfr_find_soa(struct auth_zone* z, struct auth_xfer* xfr)
 {
-	struct auth_data* apex;
-	struct auth_rrset* soa;
-	struct packed_rrset_data* d;
-	apex = az_find_name(z, z->name, z->namelen);
-	if(!apex) return 0;
-	soa = az_domain_rrset(apex, LDNS_RR_TYPE_SOA);
-	if(!soa || soa->data->count==0)
-		return 0; /* no RRset or no RRs in rrset */
-	if(soa->data->rr_len[0] < 2+4*5) return 0; /* SOA too short */
-	/* SOA record ends with serial, refresh, retry, expiry, minimum,
-	 * as 4 byte fields */
-	d = soa->data;
+	uint32_t vals[4];
+	if(!az_soa_values(z, vals))
+		return 0;
 	xfr->have_zone = 1;
-	xfr->serial = sldns_read_uint32(d->rr_data[0]+(d->rr_len[0]-20));
-	xfr->refresh = sldns_read_uint32(d->rr_data[0]+(d->rr_len[0]-16));
-	xfr->retry = sldns_read_uint32(d->rr_data[0]+(d->rr_len[0]-12));
-	xfr->expiry = sldns_read_uint32(d->rr_data[0]+(d->rr_len[0]-8));
-	/* soa minimum at d->rr_len[0]-4 */
+	xfr->serial = vals[0];
+	xfr->refresh = vals[1];
+	xfr->retry = vals[2];
+	xfr->expiry = vals[3];
 	return 1;
 }
 
@@ -1858,6 +3169,30 @@ auth_zones_setup_zones(struct auth_zones* az)
 	return 1;
 }
 
+/** setup the answer cache of the zone with the configured size,
+ * false on malloc failure. Caller holds writelock on z */
+static int
+auth_zone_set_answer_cache(struct auth_zone* z, struct config_auth* c)
+{
+	size_t size = (c->for_downstream?c->answer_cache_size:0);
+	if(z->answer_cache && size == slabhash_get_size(z->answer_cache))
+		return 1; /* no change, the contents are flushed by the
+			load of the zone data */
+	slabhash_delete(z->answer_cache);
+	z->answer_cache = NULL;
+	if(size == 0)
+		return 1;
+	z->answer_cache = slabhash_create(AUTH_ANSWER_CACHE_SLABS,
+		HASH_DEFAULT_STARTARRAY, size, &auth_answer_sizefunc,
+		&auth_answer_compfunc, &auth_answer_delkeyfunc,
+		&auth_answer_deldatafunc, NULL);
+	if(!z->answer_cache) {
+		log_err("out of memory for auth zone answer cache");
+		return 0;
+	}
+	return 1;
+}
+
 /** set config items and create zones */
 static int
 auth_zones_cfg(struct auth_zones* az, struct config_auth* c)
@@ -1908,12 +3243,31 @@ auth_zones_cfg(struct auth_zones* az, struct config_auth* c)
 	z->for_downstream = c->for_downstream;
 	z->for_upstream = c->for_upstream;
 	z->fallback_enabled = c->fallback_enabled;
+	if(!auth_zone_set_answer_cache(z, c)) {
+		if(x) {
+			lock_basic_unlock(&x->lock);
+		}
+		lock_rw_unlock(&z->lock);
+		if(c->isrpz) {
+			lock_rw_unlock(&az->rpz_lock);
+		}
+		return 0;
+	}
 	if(c->isrpz && !z->rpz){
 		if(!(z->rpz = rpz_create(c))){
 			fatal_exit("Could not setup RPZ zones");
 			return 0;
 		}
-		lock_protect(&z->lock, &z->rpz->local_zones, sizeof(*z->rpz));
+		/* the z lock protects the policies that are being loaded,
+		 * the current policies are protected by the rpz lock */
+		lock_protect(&z->lock, &z->rpz->load_zones,
+			sizeof(z->rpz->load_zones));
+		lock_protect(&z->lock, &z->rpz->load_respip,
+			sizeof(z->rpz->load_respip));
+		lock_protect(&z->lock, &z->rpz->respip_changed,
+			sizeof(z->rpz->respip_changed));
+		lock_protect(&z->lock, &z->rpz->apply_start,
+			sizeof(z->rpz->apply_start));
 		/* the az->rpz_lock is locked above */
 		z->rpz_az_next = az->rpz_first;
 		if(az->rpz_first)
@@ -2126,6 +3480,7 @@ void auth_zones_delete(struct auth_zones* az)
 	if(!az) return;
 	lock_rw_destroy(&az->lock);
 	lock_rw_destroy(&az->rpz_lock);
+	lock_basic_destroy(&az->xfr_stats_lock);
 	traverse_postorder(&az->ztree, auth_zone_del, NULL);
 	traverse_postorder(&az->xtree, auth_xfer_del, NULL);
 	free(az);
@@ -2150,7 +3505,8 @@ domain_has_only_nsec3(struct auth_data* n)
 
 /** see if the domain has a wildcard child '*.domain' */
 static struct auth_data*
-az_find_wildcard_domain(struct auth_zone* z, uint8_t* nm, size_t nmlen)
+az_find_wildcard_domain(struct auth_zone* z, struct regional* region,
+	uint8_t* nm, size_t nmlen)
 {
 	uint8_t wc[LDNS_MAX_DOMAINLEN];
 	if(nmlen+2 > sizeof(wc))
@@ -2158,20 +3514,20 @@ az_find_wildcard_domain(struct auth_zone* z, uint8_t* nm, size_t nmlen)
 	wc[0] = 1; /* length of wildcard label */
 	wc[1] = (uint8_t)'*'; /* wildcard label */
 	memmove(wc+2, nm, nmlen);
-	return az_find_name(z, wc, nmlen+2);
+	return az_find_name(z, region, wc, nmlen+2);
 }
 
 /** find wildcard between qname and cename */
 static struct auth_data*
-az_find_wildcard(struct auth_zone* z, struct query_info* qinfo,
-	struct auth_data* ce)
+az_find_wildcard(struct auth_zone* z, struct regional* region,
+	struct query_info* qinfo, struct auth_data* ce)
 {
 	uint8_t* nm = qinfo->qname;
 	size_t nmlen = qinfo->qname_len;
 	struct auth_data* node;
 	if(!dname_subdomain_c(nm, z->name))
 		return NULL; /* out of zone */
-	while((node=az_find_wildcard_domain(z, nm, nmlen))==NULL) {
+	while((node=az_find_wildcard_domain(z, region, nm, nmlen))==NULL) {
 		/* see if we can go up to find the wildcard */
 		if(nmlen == z->namelen)
 			return NULL; /* top of zone reached */
@@ -2187,8 +3543,8 @@ az_find_wildcard(struct auth_zone* z, struct query_info* qinfo,
 /** domain is not exact, find first candidate ce (name that matches
  * a part of qname) in tree */
 static struct auth_data*
-az_find_candidate_ce(struct auth_zone* z, struct query_info* qinfo,
-	struct auth_data* n)
+az_find_candidate_ce(struct auth_zone* z, struct regional* region,
+	struct query_info* qinfo, struct auth_data* n)
 {
 	uint8_t* nm;
 	size_t nmlen;
@@ -2198,26 +3554,27 @@ az_find_candidate_ce(struct auth_zone* z, struct query_info* qinfo,
 		nm = qinfo->qname;
 	}
 	dname_count_size_labels(nm, &nmlen);
-	n = az_find_name(z, nm, nmlen);
+	n = az_find_name(z, region, nm, nmlen);
 	/* delete labels and go up on name */
 	while(!n) {
 		if(dname_is_root(nm))
 			return NULL; /* cannot go up */
 		dname_remove_label(&nm, &nmlen);
-		n = az_find_name(z, nm, nmlen);
+		n = az_find_name(z, region, nm, nmlen);
 	}
 	return n;
 }
 
 /** go up the auth tree to next existing name. */
 static struct auth_data*
-az_domain_go_up(struct auth_zone* z, struct auth_data* n)
+az_domain_go_up(struct auth_zone* z, struct regional* region,
+	struct auth_data* n)
 {
 	uint8_t* nm = n->name;
 	size_t nmlen = n->namelen;
 	while(!dname_is_root(nm)) {
 		dname_remove_label(&nm, &nmlen);
-		if((n=az_find_name(z, nm, nmlen)) != NULL)
+		if((n=az_find_name(z, region, nm, nmlen)) != NULL)
 			return n;
 	}
 	return NULL;
@@ -2236,16 +3593,16 @@ az_domain_go_up(struct auth_zone* z, struct auth_data* n)
  *	rrset is the closest DNAME or NS rrset that was found.
  */
 static int
-az_find_ce(struct auth_zone* z, struct query_info* qinfo,
-	struct auth_data* node, int node_exact, struct auth_data** ce,
-	struct auth_rrset** rrset)
+az_find_ce(struct auth_zone* z, struct regional* region,
+	struct query_info* qinfo, struct auth_data* node, int node_exact,
+	struct auth_data** ce, struct auth_rrset** rrset)
 {
 	struct auth_data* n = node;
 	*ce = NULL;
 	*rrset = NULL;
 	if(!node_exact) {
 		/* if not exact, lookup closest exact match */
-		n = az_find_candidate_ce(z, qinfo, n);
+		n = az_find_candidate_ce(z, region, qinfo, n);
 	} else {
 		/* if exact, the node itself is the first candidate ce */
 		*ce = n;
@@ -2287,7 +3644,7 @@ az_find_ce(struct auth_zone* z, struct query_info* qinfo,
 		}
 
 		/* walk up the tree by removing labels from name and lookup */
-		n = az_domain_go_up(z, n);
+		n = az_domain_go_up(z, region, n);
 	}
 	/* found no problems, if it was an exact node, it is fine to use */
 	return node_exact;
@@ -2311,7 +3668,7 @@ az_add_additionals_from(struct auth_zone* z, struct regional* region,
 		if(!(dlen = dname_valid(d->rr_data[i]+2+offset,
 			d->rr_len[i]-2-offset)))
 			continue; /* malformed */
-		domain = az_find_name(z, d->rr_data[i]+2+offset, dlen);
+		domain = az_find_name(z, region, d->rr_data[i]+2+offset, dlen);
 		if(!domain)
 			continue;
 		if((ref=az_domain_rrset(domain, LDNS_RR_TYPE_A)) != NULL) {
@@ -2335,7 +3692,7 @@ az_add_negative_soa(struct auth_zone* z, struct regional* region,
 	size_t i;
 	struct packed_rrset_data* d;
 	struct auth_rrset* soa;
-	struct auth_data* apex = az_find_name(z, z->name, z->namelen);
+	struct auth_data* apex = az_find_name(z, region, z->name, z->namelen);
 	if(!apex) return 0;
 	soa = az_domain_rrset(apex, LDNS_RR_TYPE_SOA);
 	if(!soa) return 0;
@@ -2365,23 +3722,23 @@ az_add_negative_soa(struct auth_zone* z, struct regional* region,
  * not NS, or DNAME above, so that we only need to check if some node
  * exists below (with nonempty rr list), return true if emptynonterminal */
 static int
-az_empty_nonterminal(struct auth_zone* z, struct query_info* qinfo,
-	struct auth_data* node)
+az_empty_nonterminal(struct auth_zone* z, struct regional* region,
+	struct query_info* qinfo, struct auth_data* node)
 {
 	struct auth_data* next;
 	if(!node) {
 		/* no smaller was found, use first (smallest) node as the
 		 * next one */
-		next = (struct auth_data*)rbtree_first(&z->data);
+		next = az_first(z, region);
 	} else {
-		next = (struct auth_data*)rbtree_next(&node->node);
+		next = az_next(z, region, node);
 	}
-	while(next && (rbnode_type*)next != RBTREE_NULL && next->rrsets == NULL) {
+	while(next && next->rrsets == NULL) {
 		/* the next name has empty rrsets, is an empty nonterminal
 		 * itself, see if there exists something below it */
-		next = (struct auth_data*)rbtree_next(&node->node);
+		next = az_next(z, region, node);
 	}
-	if((rbnode_type*)next == RBTREE_NULL || !next) {
+	if(!next) {
 		/* there is no next node, so something below it cannot
 		 * exist */
 		return 0;
@@ -2528,7 +3885,8 @@ az_change_dnames(struct dns_msg* msg, uint8_t* oldname, uint8_t* newname,
 
 /** find NSEC record covering the query */
 static struct auth_rrset*
-az_find_nsec_cover(struct auth_zone* z, struct auth_data** node)
+az_find_nsec_cover(struct auth_zone* z, struct regional* region,
+	struct auth_data** node)
 {
 	uint8_t* nm = (*node)->name;
 	size_t nmlen = (*node)->namelen;
@@ -2547,7 +3905,7 @@ az_find_nsec_cover(struct auth_zone* z, struct auth_data** node)
 		if(nmlen == z->namelen) return NULL;
 		dname_remove_label(&nm, &nmlen);
 		/* adjust *node for the nsec rrset to find in */
-		*node = az_find_name(z, nm, nmlen);
+		*node = az_find_name(z, region, nm, nmlen);
 	}
 	return rrset;
 }
@@ -2574,8 +3932,8 @@ az_nsec_wildcard_denial(struct auth_zone* z, struct regional* region,
 	qinfo.qname_len = cenmlen+2;
 	qinfo.qtype = 0;
 	qinfo.qclass = 0;
-	az_find_domain(z, &qinfo, &node_exact, &node);
-	if((nsec=az_find_nsec_cover(z, &node)) != NULL) {
+	az_find_domain(z, region, &qinfo, &node_exact, &node);
+	if((nsec=az_find_nsec_cover(z, region, &node)) != NULL) {
 		if(!msg_add_rrset_ns(z, region, msg, node, nsec)) return 0;
 	}
 	return 1;
@@ -2583,13 +3941,13 @@ az_nsec_wildcard_denial(struct auth_zone* z, struct regional* region,
 
 /** Find the NSEC3PARAM rrset (if any) and if true you have the parameters */
 static int
-az_nsec3_param(struct auth_zone* z, int* algo, size_t* iter, uint8_t** salt,
-	size_t* saltlen)
+az_nsec3_param(struct auth_zone* z, struct regional* region, int* algo,
+	size_t* iter, uint8_t** salt, size_t* saltlen)
 {
 	struct auth_data* apex;
 	struct auth_rrset* param;
 	size_t i;
-	apex = az_find_name(z, z->name, z->namelen);
+	apex = az_find_name(z, region, z->name, z->namelen);
 	if(!apex) return 0;
 	param = az_domain_rrset(apex, LDNS_RR_TYPE_NSEC3PARAM);
 	if(!param || param->data->count==0)
@@ -2681,7 +4039,8 @@ az_nsec3_hashname(struct auth_zone* z, uint8_t* hashname, size_t* hashnmlen,
 
 /** Find the datanode that covers the nsec3hash-name */
 static struct auth_data*
-az_nsec3_findnode(struct auth_zone* z, uint8_t* hashnm, size_t hashnmlen)
+az_nsec3_findnode(struct auth_zone* z, struct regional* region,
+	uint8_t* hashnm, size_t hashnmlen)
 {
 	struct query_info qinfo;
 	struct auth_data* node;
@@ -2692,23 +4051,21 @@ az_nsec3_findnode(struct auth_zone* z, uint8_t* hashnm, size_t hashnmlen)
 	qinfo.qname_len = hashnmlen;
 	/* because canonical ordering and b32 nsec3 ordering are the same.
 	 * this is a good lookup to find the nsec3 name. */
-	az_find_domain(z, &qinfo, &node_exact, &node);
+	az_find_domain(z, region, &qinfo, &node_exact, &node);
 	/* but we may have to skip non-nsec3 nodes */
 	/* this may be a lot, the way to speed that up is to have a
 	 * separate nsec3 tree with nsec3 nodes */
-	while(node && (rbnode_type*)node != RBTREE_NULL &&
-		!az_domain_rrset(node, LDNS_RR_TYPE_NSEC3)) {
-		node = (struct auth_data*)rbtree_previous(&node->node);
+	while(node && !az_domain_rrset(node, LDNS_RR_TYPE_NSEC3)) {
+		node = az_previous(z, region, node);
 	}
-	if((rbnode_type*)node == RBTREE_NULL)
-		node = NULL;
 	return node;
 }
 
 /** Find cover for hashed(nm, nmlen) (or NULL) */
 static struct auth_data*
-az_nsec3_find_cover(struct auth_zone* z, uint8_t* nm, size_t nmlen,
-	int algo, size_t iter, uint8_t* salt, size_t saltlen)
+az_nsec3_find_cover(struct auth_zone* z, struct regional* region,
+	uint8_t* nm, size_t nmlen, int algo, size_t iter, uint8_t* salt,
+	size_t saltlen)
 {
 	struct auth_data* node;
 	uint8_t hname[LDNS_MAX_DOMAINLEN];
@@ -2716,25 +4073,23 @@ az_nsec3_find_cover(struct auth_zone* z, uint8_t* nm, size_t nmlen,
 	if(!az_nsec3_hashname(z, hname, &hlen, nm, nmlen, algo, iter,
 		salt, saltlen))
 		return NULL;
-	node = az_nsec3_findnode(z, hname, hlen);
+	node = az_nsec3_findnode(z, region, hname, hlen);
 	if(node)
 		return node;
 	/* we did not find any, perhaps because the NSEC3 hash is before
 	 * the first hash, we have to find the 'last hash' in the zone */
-	node = (struct auth_data*)rbtree_last(&z->data);
-	while(node && (rbnode_type*)node != RBTREE_NULL &&
-		!az_domain_rrset(node, LDNS_RR_TYPE_NSEC3)) {
-		node = (struct auth_data*)rbtree_previous(&node->node);
+	node = az_last(z, region);
+	while(node && !az_domain_rrset(node, LDNS_RR_TYPE_NSEC3)) {
+		node = az_previous(z, region, node);
 	}
-	if((rbnode_type*)node == RBTREE_NULL)
-		node = NULL;
 	return node;
 }
 
 /** Find exact match for hashed(nm, nmlen) NSEC3 record or NULL */
 static struct auth_data*
-az_nsec3_find_exact(struct auth_zone* z, uint8_t* nm, size_t nmlen,
-	int algo, size_t iter, uint8_t* salt, size_t saltlen)
+az_nsec3_find_exact(struct auth_zone* z, struct regional* region,
+	uint8_t* nm, size_t nmlen, int algo, size_t iter, uint8_t* salt,
+	size_t saltlen)
 {
 	struct auth_data* node;
 	uint8_t hname[LDNS_MAX_DOMAINLEN];
@@ -2742,7 +4097,7 @@ az_nsec3_find_exact(struct auth_zone* z, uint8_t* nm, size_t nmlen,
 	if(!az_nsec3_hashname(z, hname, &hlen, nm, nmlen, algo, iter,
 		salt, saltlen))
 		return NULL;
-	node = az_find_name(z, hname, hlen);
+	node = az_find_name(z, region, hname, hlen);
 	if(az_domain_rrset(node, LDNS_RR_TYPE_NSEC3))
 		return node;
 	return NULL;
@@ -2767,11 +4122,12 @@ az_nsec3_get_nextcloser(uint8_t* cenm, uint8_t* qname, size_t qname_len,
 /** Find the closest encloser that has exact NSEC3.
  * updated cenm to the new name. If it went up no-exact-ce is true. */
 static struct auth_data*
-az_nsec3_find_ce(struct auth_zone* z, uint8_t** cenm, size_t* cenmlen,
-	int* no_exact_ce, int algo, size_t iter, uint8_t* salt, size_t saltlen)
+az_nsec3_find_ce(struct auth_zone* z, struct regional* region,
+	uint8_t** cenm, size_t* cenmlen, int* no_exact_ce, int algo,
+	size_t iter, uint8_t* salt, size_t saltlen)
 {
 	struct auth_data* node;
-	while((node = az_nsec3_find_exact(z, *cenm, *cenmlen,
+	while((node = az_nsec3_find_exact(z, region, *cenm, *cenmlen,
 		algo, iter, salt, saltlen)) == NULL) {
 		if(*cenmlen == z->namelen) {
 			/* next step up would take us out of the zone. fail */
@@ -2823,13 +4179,13 @@ az_add_nsec3_proof(struct auth_zone* z, struct regional* region,
 	struct auth_data* node;
 
 	/* find parameters of nsec3 proof */
-	if(!az_nsec3_param(z, &algo, &iter, &salt, &saltlen))
+	if(!az_nsec3_param(z, region, &algo, &iter, &salt, &saltlen))
 		return 1; /* no nsec3 */
 	if(nodataproof) {
 		/* see if the node has a hash of itself for the nodata
 		 * proof nsec3, this has to be an exact match nsec3. */
 		struct auth_data* match;
-		match = az_nsec3_find_exact(z, qname, qname_len, algo,
+		match = az_nsec3_find_exact(z, region, qname, qname_len, algo,
 			iter, salt, saltlen);
 		if(match) {
 			if(!az_nsec3_insert(z, region, msg, match))
@@ -2840,7 +4196,7 @@ az_add_nsec3_proof(struct auth_zone* z, struct regional* region,
 	}
 	/* find ce that has an NSEC3 */
 	if(ceproof) {
-		node = az_nsec3_find_ce(z, &cenm, &cenmlen, &no_exact_ce,
+		node = az_nsec3_find_ce(z, region, &cenm, &cenmlen, &no_exact_ce,
 			algo, iter, salt, saltlen);
 		if(no_exact_ce) nxproof = 1;
 		if(!az_nsec3_insert(z, region, msg, node))
@@ -2853,7 +4209,7 @@ az_add_nsec3_proof(struct auth_zone* z, struct regional* region,
 		/* create nextcloser domain name */
 		az_nsec3_get_nextcloser(cenm, qname, qname_len, &nx, &nxlen);
 		/* find nsec3 that matches or covers it */
-		node = az_nsec3_find_cover(z, nx, nxlen, algo, iter, salt,
+		node = az_nsec3_find_cover(z, region, nx, nxlen, algo, iter, salt,
 			saltlen);
 		if(!az_nsec3_insert(z, region, msg, node))
 			return 0;
@@ -2869,7 +4225,7 @@ az_add_nsec3_proof(struct auth_zone* z, struct regional* region,
 		memmove(wc+2, cenm, cenmlen);
 		wclen = cenmlen+2;
 		/* find nsec3 that matches or covers it */
-		node = az_nsec3_find_cover(z, wc, wclen, algo, iter, salt,
+		node = az_nsec3_find_cover(z, region, wc, wclen, algo, iter, salt,
 			saltlen);
 		if(!az_nsec3_insert(z, region, msg, node))
 			return 0;
@@ -2947,7 +4303,7 @@ follow_cname_chain(struct auth_zone* z, uint16_t qtype,
 			break; /* malformed */
 		if(!dname_subdomain_c(d->rr_data[0]+2, z->name))
 			break; /* target out of zone */
-		if((node = az_find_name(z, d->rr_data[0]+2, clen))==NULL)
+		if((node = az_find_name(z, region, d->rr_data[0]+2, clen))==NULL)
 			break; /* no such target name */
 		if((rrset=az_domain_rrset(node, qtype))!=NULL) {
 			/* done we found the target */
@@ -3090,7 +4446,7 @@ az_generate_wildcard_answer(struct auth_zone* z, struct query_info* qinfo,
 	}
 
 	/* ce and node for dnssec denial of wildcard original name */
-	if((nsec=az_find_nsec_cover(z, &node)) != NULL) {
+	if((nsec=az_find_nsec_cover(z, region, &node)) != NULL) {
 		if(!msg_add_rrset_ns(z, region, msg, node, nsec)) return 0;
 	} else if(ce) {
 		uint8_t* wildup = wildcard->name;
@@ -3117,7 +4473,7 @@ az_generate_nxdomain_answer(struct auth_zone* z, struct regional* region,
 	struct auth_rrset* nsec;
 	msg->rep->flags |= LDNS_RCODE_NXDOMAIN;
 	if(!az_add_negative_soa(z, region, msg)) return 0;
-	if((nsec=az_find_nsec_cover(z, &node)) != NULL) {
+	if((nsec=az_find_nsec_cover(z, region, &node)) != NULL) {
 		if(!msg_add_rrset_ns(z, region, msg, node, nsec)) return 0;
 		if(ce && !az_nsec_wildcard_denial(z, region, msg, ce->name,
 			ce->namelen)) return 0;
@@ -3173,11 +4529,11 @@ az_generate_answer_nonexistnode(struct auth_zone* z, struct query_info* qinfo,
 	}
 	/* if there is an empty nonterminal, wildcard and nxdomain don't
 	 * happen, it is a notype answer */
-	if(az_empty_nonterminal(z, qinfo, node)) {
+	if(az_empty_nonterminal(z, region, qinfo, node)) {
 		return az_generate_notype_answer(z, region, msg, node);
 	}
 	/* see if we have a wildcard under the ce */
-	if((wildcard=az_find_wildcard(z, qinfo, ce)) != NULL) {
+	if((wildcard=az_find_wildcard(z, region, qinfo, ce)) != NULL) {
 		return az_generate_wildcard_answer(z, qinfo, region, msg,
 			ce, wildcard, node);
 	}
@@ -3198,13 +4554,13 @@ auth_zone_generate_answer(struct auth_zone* z, struct query_info* qinfo,
 	if(!(*msg=msg_create(region, qinfo))) return 0;
 
 	/* lookup if there is a matching domain name for the query */
-	az_find_domain(z, qinfo, &node_exact, &node);
+	az_find_domain(z, region, qinfo, &node_exact, &node);
 
 	/* see if node exists for generating answers from (i.e. not glue and
 	 * obscured by NS or DNAME or NSEC3-only), and also return the
 	 * closest-encloser from that, closest node that should be used
 	 * to generate answers from that is above the query */
-	node_exists = az_find_ce(z, qinfo, node, node_exact, &ce, &rrset);
+	node_exists = az_find_ce(z, region, qinfo, node, node_exact, &ce, &rrset);
 
 	if(verbosity >= VERB_ALGO) {
 		char zname[256], qname[256], nname[256], cename[256],
@@ -3301,6 +4657,183 @@ auth_answer_encode(struct query_info* qinfo, struct module_env* env,
 	}
 }
 
+size_t
+auth_answer_sizefunc(void* k, void* d)
+{
+	struct auth_answer_key* key = (struct auth_answer_key*)k;
+	struct auth_answer_data* data = (struct auth_answer_data*)d;
+	return sizeof(*key) + key->qname_len + lock_get_mem(&key->entry.lock)
+		+ sizeof(*data) + data->len;
+}
+
+int
+auth_answer_compfunc(void* k1, void* k2)
+{
+	struct auth_answer_key* a = (struct auth_answer_key*)k1;
+	struct auth_answer_key* b = (struct auth_answer_key*)k2;
+	if(a->qtype != b->qtype)
+		return (a->qtype < b->qtype)?-1:1;
+	if(a->qclass != b->qclass)
+		return (a->qclass < b->qclass)?-1:1;
+	if(a->dnssec != b->dnssec)
+		return (a->dnssec < b->dnssec)?-1:1;
+	return query_dname_compare(a->qname, b->qname);
+}
+
+void
+auth_answer_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
+{
+	struct auth_answer_key* key = (struct auth_answer_key*)k;
+	lock_rw_destroy(&key->entry.lock);
+	free(key);
+}
+
+void
+auth_answer_deldatafunc(void* d, void* ATTR_UNUSED(arg))
+{
+	free(d);
+}
+
+/** hash for the answer cache */
+static hashvalue_type
+auth_answer_hash(struct query_info* qinfo, int dnssec)
+{
+	hashvalue_type h = 0xab;
+	h = hashlittle(&qinfo->qtype, sizeof(qinfo->qtype), h);
+	h = hashlittle(&qinfo->qclass, sizeof(qinfo->qclass), h);
+	h = hashlittle(&dnssec, sizeof(dnssec), h);
+	return dname_query_hash(qinfo->qname, h);
+}
+
+/** see if the answer cache can be used for the query, the inplace
+ * callbacks, local alias and EDNS padding change the answer per query */
+static int
+auth_answer_cache_usable(struct module_env* env, struct query_info* qinfo,
+	struct edns_data* edns)
+{
+	return env->inplace_cb_lists[inplace_cb_reply_local] == NULL &&
+		qinfo->local_alias == NULL && edns->padding_block_size == 0;
+}
+
+/** store the answer in the answer cache of the zone, from the reply
+ * packet that auth_answer_encode made in buf, without its EDNS record.
+ * The readlock on the zone is held, so the answer is from the current
+ * zone data. */
+static void
+auth_answer_cache_store(struct auth_zone* z, struct query_info* qinfo,
+	struct edns_data* edns, struct dns_msg* msg, sldns_buffer* buf)
+{
+	int dnssec = (int)(edns->bits&EDNS_DO);
+	size_t len = sldns_buffer_limit(buf);
+	size_t optlen = calc_edns_field_size(edns);
+	uint8_t* pkt = sldns_buffer_begin(buf);
+	struct auth_answer_key* k;
+	struct auth_answer_data* d;
+	sldns_buffer nopt;
+	if(len < LDNS_HEADER_SIZE + qinfo->qname_len + optlen ||
+		LDNS_RCODE_WIRE(pkt) != FLAGS_GET_RCODE(msg->rep->flags))
+		return;
+	if(optlen) {
+		/* the EDNS record is the last one in the packet */
+		uint8_t* opt = pkt + len - optlen;
+		if(LDNS_ARCOUNT(pkt) == 0 || opt[0] != 0 ||
+			sldns_read_uint16(opt+1) != LDNS_RR_TYPE_OPT ||
+			sldns_read_uint16(opt+9) != optlen - 11)
+			return;
+		len -= optlen;
+	}
+	k = (struct auth_answer_key*)calloc(1, sizeof(*k)+qinfo->qname_len);
+	d = (struct auth_answer_data*)malloc(sizeof(*d)+len);
+	if(!k || !d) {
+		free(k);
+		free(d);
+		return;
+	}
+	d->len = len;
+	d->data = (uint8_t*)(d+1);
+	memmove(d->data, pkt, len);
+	/* the lookup puts in the ID and RD, CD flags of the query */
+	LDNS_ID_SET(d->data, 0);
+	LDNS_RD_CLR(d->data);
+	LDNS_CD_CLR(d->data);
+	if(optlen)
+		sldns_write_uint16(d->data+10, LDNS_ARCOUNT(pkt)-1);
+	sldns_buffer_init_frm_data(&nopt, d->data, d->len);
+	if(!reply_info_encoded_complete(qinfo, msg->rep, &nopt, dnssec)) {
+		/* truncated for this client, not for the next one */
+		free(k);
+		free(d);
+		return;
+	}
+	k->qname = (uint8_t*)(k+1);
+	memmove(k->qname, qinfo->qname, qinfo->qname_len);
+	k->qname_len = qinfo->qname_len;
+	k->qtype = qinfo->qtype;
+	k->qclass = qinfo->qclass;
+	k->dnssec = dnssec;
+	lock_rw_init(&k->entry.lock);
+	k->entry.hash = auth_answer_hash(qinfo, dnssec);
+	k->entry.key = k;
+	k->entry.data = d;
+	slabhash_insert(z->answer_cache, k->entry.hash, &k->entry, d, NULL);
+}
+
+/** answer the query from the answer cache of the zone, by copying the
+ * encoded answer and patching the ID, flags and qname case.
+ * The readlock on the zone is held.  false if not answered */
+static int
+auth_answer_cache_lookup(struct auth_zone* z, struct module_env* env,
+	struct query_info* qinfo, struct edns_data* edns, sldns_buffer* buf)
+{
+	struct auth_answer_key key;
+	struct auth_answer_data* d;
+	struct lruhash_entry* e;
+	uint16_t id, qflags, flags;
+	size_t limit = edns->udp_size, qlen = qinfo->qname_len;
+	uint8_t* pkt = sldns_buffer_begin(buf);
+	if(!auth_answer_cache_usable(env, qinfo, edns))
+		return 0;
+	memset(&key, 0, sizeof(key));
+	key.qname = qinfo->qname;
+	key.qname_len = qlen;
+	key.qtype = qinfo->qtype;
+	key.qclass = qinfo->qclass;
+	key.dnssec = (int)(edns->bits&EDNS_DO);
+	e = slabhash_lookup(z->answer_cache, auth_answer_hash(qinfo,
+		key.dnssec), &key, 0);
+	if(!e)
+		return 0;
+	d = (struct auth_answer_data*)e->data;
+	/* it has to fit without truncation, with the EDNS record */
+	if(sldns_buffer_capacity(buf) < limit)
+		limit = sldns_buffer_capacity(buf);
+	if(d->len + calc_edns_field_size(edns) > limit) {
+		lock_rw_unlock(&e->lock);
+		return 0;
+	}
+	/* the qname in the query, at the same position as in the answer,
+	 * keeps the case of the query */
+	id = *(uint16_t*)pkt;
+	qflags = sldns_buffer_read_u16_at(buf, 2);
+	if(qinfo->qname != pkt+LDNS_HEADER_SIZE)
+		memmove(pkt+LDNS_HEADER_SIZE, qinfo->qname, qlen);
+	memmove(pkt, d->data, LDNS_HEADER_SIZE);
+	memmove(pkt+LDNS_HEADER_SIZE+qlen, d->data+LDNS_HEADER_SIZE+qlen,
+		d->len-LDNS_HEADER_SIZE-qlen);
+	sldns_buffer_set_position(buf, 0);
+	sldns_buffer_set_limit(buf, d->len);
+	lock_rw_unlock(&e->lock);
+	*(uint16_t*)pkt = id;
+	flags = sldns_buffer_read_u16_at(buf, 2);
+	sldns_buffer_write_u16_at(buf, 2, flags | (qflags&(BIT_RD|BIT_CD)));
+	edns->edns_version = EDNS_ADVERTISED_VERSION;
+	edns->udp_size = EDNS_ADVERTISED_SIZE;
+	edns->ext_rcode = 0;
+	edns->bits &= EDNS_DO;
+	attach_edns_record(buf, edns);
+	return 1;
+}
+
 /** encode auth error answer */
 static void
 auth_error_encode(struct query_info* qinfo, struct module_env* env,
@@ -3326,7 +4859,7 @@ int auth_zones_answer(struct auth_zones* az, struct module_env* env,
 {
 	struct dns_msg* msg = NULL;
 	struct auth_zone* z;
-	int r;
+	int r, cached;
 	int fallback = 0;
 
 	lock_rw_rdlock(&az->lock);
@@ -3370,8 +4903,25 @@ int auth_zones_answer(struct auth_zones* az, struct module_env* env,
 		return 1;
 	}
 
-	/* answer it from zone z */
+	/* answer it from the answer cache of zone z */
+	if(z->answer_cache && auth_answer_cache_lookup(z, env, qinfo, edns,
+		buf)) {
+		lock_rw_unlock(&z->lock);
+		lock_rw_wrlock(&az->lock);
+		az->num_query_down++;
+		lock_rw_unlock(&az->lock);
+		return 1;
+	}
+
+	/* answer it from zone z, when the answer is cached, encode it
+	 * while the zone is locked and store the encoded reply */
 	r = auth_zone_generate_answer(z, qinfo, temp, &msg, &fallback);
+	cached = r && z->answer_cache &&
+		auth_answer_cache_usable(env, qinfo, edns);
+	if(cached) {
+		auth_answer_encode(qinfo, env, edns, repinfo, buf, temp, msg);
+		auth_answer_cache_store(z, qinfo, edns, msg, buf);
+	}
 	lock_rw_unlock(&z->lock);
 	if(!r && fallback) {
 		/* fallback to regular answering (recursive) */
@@ -3385,7 +4935,8 @@ int auth_zones_answer(struct auth_zones* az, struct module_env* env,
 	if(!r)
 		auth_error_encode(qinfo, env, edns, repinfo, buf, temp,
 			LDNS_RCODE_SERVFAIL);
-	else	auth_answer_encode(qinfo, env, edns, repinfo, buf, temp, msg);
+	else if(!cached)
+		auth_answer_encode(qinfo, env, edns, repinfo, buf, temp, msg);
 
 	return 1;
 }
@@ -4585,7 +6136,9 @@ ixfr_start_serial(struct auth_chunk* rr_chunk, int rr_num, size_t rr_pos,
 	return 1;
 }
 
-/** apply IXFR to zone in memory. z is locked. false on failure(mallocfail) */
+/** apply IXFR to zone in memory. z is the staging zone, with a copy of the
+ * zone data, the RPZ policies are loaded from it afterwards.
+ * false on failure(mallocfail) */
 static int
 apply_ixfr(struct auth_xfer* xfr, struct auth_zone* z,
 	struct sldns_buffer* scratch_buffer)
@@ -4722,7 +6275,8 @@ apply_ixfr(struct auth_xfer* xfr, struct auth_zone* z,
 	return 1;
 }
 
-/** apply AXFR to zone in memory. z is locked. false on failure(mallocfail) */
+/** apply AXFR to zone in memory. z is the staging zone, the RPZ policies
+ * are loaded from it afterwards.  false on failure(mallocfail) */
 static int
 apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 	struct sldns_buffer* scratch_buffer)
@@ -4739,11 +6293,7 @@ apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 	int have_end_soa = 0;
 
 	/* clear the data tree */
-	traverse_postorder(&z->data, auth_data_del, NULL);
-	rbtree_init(&z->data, &auth_data_cmp);
-	/* clear the RPZ policies */
-	if(z->rpz)
-		rpz_clear(z->rpz);
+	auth_zone_data_clear(z);
 
 	xfr->have_zone = 0;
 	xfr->serial = 0;
@@ -4792,7 +6342,8 @@ apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 	return 1;
 }
 
-/** apply HTTP to zone in memory. z is locked. false on failure(mallocfail) */
+/** apply HTTP to zone in memory. z is the staging zone, the RPZ policies
+ * are loaded from it afterwards.  false on failure(mallocfail) */
 static int
 apply_http(struct auth_xfer* xfr, struct auth_zone* z,
 	struct sldns_buffer* scratch_buffer)
@@ -4839,11 +6390,7 @@ apply_http(struct auth_xfer* xfr, struct auth_zone* z,
 	}
 
 	/* clear the data tree */
-	traverse_postorder(&z->data, auth_data_del, NULL);
-	rbtree_init(&z->data, &auth_data_cmp);
-	/* clear the RPZ policies */
-	if(z->rpz)
-		rpz_clear(z->rpz);
+	auth_zone_data_clear(z);
 
 	xfr->have_zone = 0;
 	xfr->serial = 0;
@@ -4969,13 +6516,148 @@ xfr_write_after_update(struct auth_xfer* xfr, struct module_env* env)
 	lock_rw_unlock(&z->lock);
 }
 
+/** setup the staging zone, that the transfer is applied to, off to the
+ * side of zone z that answers queries.  It has the name and class of z,
+ * and empty data, or a copy of the data of z.  It has no RPZ, the
+ * policies are loaded from the data after the transfer is applied, or
+ * for an IXFR the changes are listed.  Only the data tree is used and it
+ * is not locked.  z is readlocked.  false on malloc failure */
+static int
+xfr_staging_zone(struct auth_zone* z, struct auth_zone* s, int copy)
+{
+	struct auth_data* n;
+	struct regional* region;
+	memset(s, 0, sizeof(*s));
+	s->node.key = s;
+	s->name = z->name;
+	s->namelen = z->namelen;
+	s->namelabs = z->namelabs;
+	s->dclass = z->dclass;
+	rbtree_init(&s->data, &auth_data_cmp);
+	if(!copy)
+		return 1;
+	if(!(region = regional_create()))
+		return 0;
+	for(n = az_walk_next(z, region, NULL); n;
+		n = az_walk_next(z, region, n)) {
+		struct auth_data* c = auth_data_copy(n, 0);
+		if(!c) {
+			regional_destroy(region);
+			auth_zone_data_clear(s);
+			return 0;
+		}
+		(void)rbtree_insert(&s->data, &c->node);
+	}
+	regional_destroy(region);
+	return 1;
+}
+
+/** The changed domains of an IXFR are put in the data tree of the zone,
+ * that overlays the compact data.  If the tree has more than 1/ratio of
+ * the domains of the compact data, the IXFR is applied to a copy of the
+ * zone that is compacted again. */
+#define AZ_OVERLAY_RATIO 8
+
+/** publish the domains of the staging zone s of an IXFR in zone z, that
+ * is writelocked.  The domains that they replace are moved to old, they
+ * are deleted after the lock is released. */
+static void
+xfr_publish_changes(struct auth_zone* z, struct auth_zone* s,
+	struct auth_zone* old)
+{
+	struct auth_data* n, *o;
+	struct auth_rrset* r, *q;
+	rbnode_type* del;
+	while(s->data.count != 0) {
+		n = (struct auth_data*)rbtree_first(&s->data)->key;
+		(void)rbtree_delete(&s->data, n);
+		if((del = rbtree_delete(&z->data, n)) != NULL) {
+			/* the new domain shares unchanged rrsets with the
+			 * old domain, it owns them from now on */
+			o = (struct auth_data*)del->key;
+			for(r = n->rrsets; r; r = r->next) {
+				if(!r->shared)
+					continue;
+				for(q = o->rrsets; q; q = q->next) {
+					if(q->data == r->data && !q->shared) {
+						r->shared = 0;
+						q->shared = 1;
+					}
+				}
+			}
+			(void)rbtree_insert(&old->data, &o->node);
+		}
+		if(!n->rrsets && !az_compact_has(z, n)) {
+			/* removed domain that the compact data does
+			 * not have, no need to keep it */
+			auth_data_delete(n);
+			continue;
+		}
+		(void)rbtree_insert(&z->data, &n->node);
+	}
+}
+
+/** load the RPZ policies from the data of the staging zone s into the
+ * load.  false on failure(mallocfail) */
+static int
+xfr_rpz_load(struct auth_zone* s, struct rpz* load)
+{
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	struct auth_data* n;
+	struct auth_rrset* rrset;
+	size_t i, rr_len;
+	uint16_t rr_type;
+	/* the staging zone has no compact data */
+	for(n = az_first(s, NULL); n; n = az_next(s, NULL, n)) {
+		for(rrset = n->rrsets; rrset; rrset = rrset->next) {
+			struct packed_rrset_data* d = rrset->data;
+			for(i=0; i<d->count+d->rrsig_count; i++) {
+				rr_type = (i<d->count)?rrset->type:
+					LDNS_RR_TYPE_RRSIG;
+				/* the RR in wireformat, rr_data has the
+				 * rdata length in front */
+				rr_len = n->namelen + 8 + d->rr_len[i];
+				if(rr_len > sizeof(rr)) {
+					log_err("RPZ: RR too long");
+					return 0;
+				}
+				memmove(rr, n->name, n->namelen);
+				sldns_write_uint16(rr+n->namelen, rr_type);
+				sldns_write_uint16(rr+n->namelen+2, s->dclass);
+				sldns_write_uint32(rr+n->namelen+4,
+					(uint32_t)d->rr_ttl[i]);
+				memmove(rr+n->namelen+8, d->rr_data[i],
+					d->rr_len[i]);
+				if(!rpz_insert_rr(load, s->name, s->namelen,
+					rr, n->namelen, rr_type, s->dclass,
+					(uint32_t)d->rr_ttl[i], rr+n->namelen+8,
+					d->rr_len[i], rr, rr_len))
+					return 0;
+			}
+		}
+	}
+	rpz_load_finish(load);
+	return 1;
+}
+
 /** process chunk list and update zone in memory,
  * return false if it did not work */
-static int
+int
 xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
 	int* ixfr_fail)
 {
 	struct auth_zone* z;
+	struct auth_zone staging, old;
+	struct rpz* rpz_load = NULL;
+	unsigned int data_version;
+	int is_ixfr = (!xfr->task_transfer->master->http &&
+		xfr->task_transfer->on_ixfr &&
+		!xfr->task_transfer->on_ixfr_is_axfr);
+	int is_overlay = 0, rdlocked = 0;
+	int old_have_zone = xfr->have_zone;
+	uint32_t old_serial = xfr->serial;
+	struct timeval start, lock_start, lock_end;
+	long long lock_usec;
 
 	/* obtain locks and structures */
 	/* release xfr lock, then, while holding az->lock grab both
@@ -4990,61 +6672,175 @@ xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
 		lock_basic_lock(&xfr->lock);
 		return 0;
 	}
-	lock_rw_wrlock(&z->lock);
+	/* the transfer is applied to a staging zone, off to the side of
+	 * the zone, so that lookups continue in the meantime.  The readlock
+	 * is held to copy the data for an IXFR, or, if the IXFR changes
+	 * are put over the data of the zone, until they are applied. */
+	lock_rw_rdlock(&z->lock);
 	lock_basic_lock(&xfr->lock);
 	lock_rw_unlock(&env->auth_zones->lock);
+	gettimeofday(&start, NULL);
+	is_overlay = is_ixfr && !(z->compact && (z->data.count+1)*
+		AZ_OVERLAY_RATIO > z->compact_num);
+	if(!xfr_staging_zone(z, &staging, is_ixfr && !is_overlay)) {
+		lock_rw_unlock(&z->lock);
+		log_err("xfr from %s: out of memory",
+			xfr->task_transfer->master->host);
+		return 0;
+	}
+	if(is_overlay) {
+		staging.ixfr_base = z;
+		rdlocked = 1;
+	}
+	/* if a zonefile reload replaces the data in the meantime, the
+	 * transfer is dropped */
+	data_version = z->data_version;
+	/* the RPZ changes of an IXFR are made to the policies when the
+	 * data is published, for a full transfer the policies are loaded
+	 * beside the current policies, and swapped in together with
+	 * the data */
+	if(z->rpz && is_ixfr) {
+		staging.rpz_changes_last = &staging.rpz_changes;
+	} else if(z->rpz && !(rpz_load = rpz_load_create())) {
+		lock_rw_unlock(&z->lock);
+		auth_zone_data_clear(&staging);
+		log_err("xfr from %s: out of memory",
+			xfr->task_transfer->master->host);
+		return 0;
+	}
+	if(!is_overlay)
+		lock_rw_unlock(&z->lock);
 
 	/* apply data */
 	if(xfr->task_transfer->master->http) {
-		if(!apply_http(xfr, z, env->scratch_buffer)) {
-			lock_rw_unlock(&z->lock);
+		if(!apply_http(xfr, &staging, env->scratch_buffer)) {
 			verbose(VERB_ALGO, "http from %s: could not store data",
 				xfr->task_transfer->master->host);
-			return 0;
+			goto fail;
 		}
-	} else if(xfr->task_transfer->on_ixfr &&
-		!xfr->task_transfer->on_ixfr_is_axfr) {
-		if(!apply_ixfr(xfr, z, env->scratch_buffer)) {
-			lock_rw_unlock(&z->lock);
+	} else if(is_ixfr) {
+		if(!apply_ixfr(xfr, &staging, env->scratch_buffer)) {
 			verbose(VERB_ALGO, "xfr from %s: could not store IXFR"
 				" data", xfr->task_transfer->master->host);
 			*ixfr_fail = 1;
-			return 0;
+			goto fail;
 		}
 	} else {
-		if(!apply_axfr(xfr, z, env->scratch_buffer)) {
-			lock_rw_unlock(&z->lock);
+		if(!apply_axfr(xfr, &staging, env->scratch_buffer)) {
 			verbose(VERB_ALGO, "xfr from %s: could not store AXFR"
 				" data", xfr->task_transfer->master->host);
-			return 0;
+			goto fail;
 		}
 	}
-	xfr->zone_expired = 0;
-	z->zone_expired = 0;
-	if(!xfr_find_soa(z, xfr)) {
-		lock_rw_unlock(&z->lock);
+	if(!xfr_find_soa(&staging, xfr)) {
 		verbose(VERB_ALGO, "xfr from %s: no SOA in zone after update"
 			" (or malformed RR)", xfr->task_transfer->master->host);
+		goto fail;
+	}
+	if(rdlocked) {
+		lock_rw_unlock(&z->lock);
+		rdlocked = 0;
+	}
+	if(rpz_load && !xfr_rpz_load(&staging, rpz_load)) {
+		verbose(VERB_ALGO, "xfr from %s: could not load RPZ policies",
+			xfr->task_transfer->master->host);
+		goto fail;
+	}
+	if(!is_overlay)
+		auth_zone_compact(&staging);
+
+	/* publish the new data, the writelock is held for the swap only */
+	lock_basic_unlock(&xfr->lock);
+	lock_rw_rdlock(&env->auth_zones->lock);
+	z = auth_zone_find(env->auth_zones, xfr->name, xfr->namelen,
+		xfr->dclass);
+	if(!z) {
+		lock_rw_unlock(&env->auth_zones->lock);
+		/* the zone is gone, ignore xfr results */
+		auth_zone_data_clear(&staging);
+		az_rpz_changes_delete(&staging);
+		rpz_delete(rpz_load);
+		lock_basic_lock(&xfr->lock);
 		return 0;
 	}
+	gettimeofday(&lock_start, NULL);
+	lock_rw_wrlock(&z->lock);
+	lock_basic_lock(&xfr->lock);
+	lock_rw_unlock(&env->auth_zones->lock);
+	if(z->data_version != data_version) {
+		lock_rw_unlock(&z->lock);
+		verbose(VERB_ALGO, "xfr from %s: zone was reloaded during "
+			"the transfer, dropped the transfer",
+			xfr->task_transfer->master->host);
+		goto fail;
+	}
+	memset(&old, 0, sizeof(old));
+	rbtree_init(&old.data, &auth_data_cmp);
+	if(is_overlay) {
+		xfr_publish_changes(z, &staging, &old);
+	} else {
+		old.data = z->data;
+		old.compact = z->compact;
+		old.compact_num = z->compact_num;
+		old.compact_size = z->compact_size;
+		z->data = staging.data;
+		z->compact = staging.compact;
+		z->compact_num = staging.compact_num;
+		z->compact_size = staging.compact_size;
+	}
+	z->data_version++;
+	if(z->rpz && rpz_load) {
+		rpz_load_publish(z->rpz, rpz_load);
+		rpz_load = NULL;
+	} else if(z->rpz && staging.rpz_changes) {
+		az_rpz_changes_apply(z, &staging);
+	}
+	if(z->answer_cache)
+		slabhash_clear(z->answer_cache);
+	xfr->zone_expired = 0;
+	z->zone_expired = 0;
 	if(xfr->have_zone)
 		xfr->lease_time = *env->now;
-
-	if(z->rpz)
-		rpz_finish_config(z->rpz);
-
-	/* unlock */
 	lock_rw_unlock(&z->lock);
+	gettimeofday(&lock_end, NULL);
+	/* the readers of the old data are gone, once the writelock
+	 * was obtained */
+	auth_zone_data_clear(&old);
+	az_rpz_changes_delete(&staging);
+	rpz_delete(rpz_load);
+	lock_usec = (long long)(lock_end.tv_sec-lock_start.tv_sec)*1000000 +
+		(long long)(lock_end.tv_usec-lock_start.tv_usec);
+	lock_basic_lock(&env->auth_zones->xfr_stats_lock);
+	env->auth_zones->num_xfr_swap++;
+	env->auth_zones->xfr_lock_usec += lock_usec;
+	if(lock_usec > env->auth_zones->xfr_lock_usec_max)
+		env->auth_zones->xfr_lock_usec_max = lock_usec;
+	lock_basic_unlock(&env->auth_zones->xfr_stats_lock);
 
 	if(verbosity >= VERB_QUERY && xfr->have_zone) {
 		char zname[256];
 		dname_str(xfr->name, zname);
-		verbose(VERB_QUERY, "auth zone %s updated to serial %u", zname,
-			(unsigned)xfr->serial);
+		verbose(VERB_QUERY, "auth zone %s updated to serial %u, "
+			"applied in %d msec, lookups blocked for %d usec",
+			zname, (unsigned)xfr->serial,
+			(int)((lock_start.tv_sec-start.tv_sec)*1000 +
+			(lock_start.tv_usec-start.tv_usec)/1000),
+			(int)lock_usec);
 	}
 	/* see if we need to write to a zonefile */
 	xfr_write_after_update(xfr, env);
 	return 1;
+
+fail:
+	/* the zone keeps the data and the RPZ policies it had */
+	if(rdlocked)
+		lock_rw_unlock(&z->lock);
+	auth_zone_data_clear(&staging);
+	az_rpz_changes_delete(&staging);
+	rpz_delete(rpz_load);
+	xfr->have_zone = old_have_zone;
+	xfr->serial = old_serial;
+	return 0;
 }
 
 /** disown task_transfer.  caller must hold xfr.lock */
@@ -45,6 +45,7 @@
 #define SERVICES_AUTHZONE_H
 #include "util/rbtree.h"
 #include "util/locks.h"
+#include "util/storage/lruhash.h"
 #include "services/mesh.h"
 #include "services/rpz.h"
 struct ub_packed_rrset_key;
@@ -65,6 +66,8 @@ struct auth_probe;
 struct auth_transfer;
 struct auth_master;
 struct auth_chunk;
+struct auth_rpz_change;
+struct slabhash;
 
 /**
  * Authoritative zones, shared.
@@ -82,6 +85,15 @@ struct auth_zones {
 	size_t num_query_up;
 	/** number of queries downstream */
 	size_t num_query_down;
+	/** lock on the zone transfer swap counters, no other locks are
+	 * taken while it is held */
+	lock_basic_type xfr_stats_lock;
+	/** number of zone transfers that were swapped into the served data */
+	size_t num_xfr_swap;
+	/** total time, in usec, that lookups were blocked by the swaps */
+	long long xfr_lock_usec;
+	/** longest time, in usec, that lookups were blocked by a swap */
+	long long xfr_lock_usec_max;
 	/** first auth zone containing rpz item in linked list */
 	struct auth_zone* rpz_first;
 	/** rw lock for rpz linked list, needed when iterating or editing linked
@@ -114,8 +126,43 @@ struct auth_zone {
 	lock_rw_type lock;
 
 	/** auth data for this zone
-	 * rbtree of struct auth_data */
+	 * rbtree of struct auth_data. If the data is compact, it has the
+	 * domains that IXFRs changed since: a domain in the tree replaces
+	 * the compact domain with that name, and a domain without rrsets
+	 * removes it. */
 	rbtree_type data;
+	/** compact storage of the auth data, or NULL. A read optimized
+	 * block with the domains in canonical order, in wireformat. The
+	 * owner names are prefix compressed against the name before them,
+	 * and the rrsets are stored with the RRs in a row. Every 16
+	 * domains the name is stored in full, and the block starts with
+	 * the positions of those restart domains, that lookups do a binary
+	 * search on.  Domains are decoded into a
+	 * struct auth_data for a lookup.  The block is not modified, the
+	 * changes go in the data tree. */
+	uint8_t* compact;
+	/** number of domains in the compact block */
+	size_t compact_num;
+	/** size in bytes of the compact block */
+	size_t compact_size;
+	/** changed when the data is replaced by a zonefile read or a zone
+	 * transfer.  A transfer that is applied to a copy of data that has
+	 * since been replaced, is dropped. */
+	unsigned int data_version;
+	/** for the staging zone of an IXFR, the zone that it changes, or
+	 * NULL. The staging data tree has copies of the domains that
+	 * change, they share the rrsets that do not change with it. */
+	struct auth_zone* ixfr_base;
+	/** for the staging zone of an IXFR of an RPZ zone, the list of
+	 * RPZ changes, that are made to the policies when the data is
+	 * published. NULL if not used, otherwise the end of the list. */
+	struct auth_rpz_change** rpz_changes_last;
+	/** the first of the RPZ changes */
+	struct auth_rpz_change* rpz_changes;
+	/** cache of encoded answers for downstream queries, or NULL.
+	 * slabhash of auth_answer_key, auth_answer_data. It is cleared when
+	 * the data changes, with the writelock on the zone. */
+	struct slabhash* answer_cache;
 
 	/** zonefile name (or NULL for no zonefile) */
 	char* zonefile;
@@ -149,7 +196,8 @@ struct auth_zone {
  * Auth data. One domain name, and the RRs to go with it.
  */
 struct auth_data {
-	/** rbtree node, key is name only */
+	/** rbtree node, key is name only, the key is NULL for a domain
+	 * that is decoded from the compact data */
 	rbnode_type node;
 	/** domain name */
 	uint8_t* name;
@@ -173,10 +221,43 @@ struct auth_rrset {
 	struct auth_rrset* next;
 	/** RR type in host byteorder */
 	uint16_t type;
+	/** if the data is not owned by this rrset, it is shared with the
+	 * rrset of the domain that this copy replaces, or it is in the
+	 * compact block. It is not freed, a change makes new data. */
+	int shared;
 	/** RRset data item */
 	struct packed_rrset_data* data;
 };
 
+/**
+ * Key for the answer cache of an auth zone.
+ */
+struct auth_answer_key {
+	/** lruhash entry, data is struct auth_answer_data */
+	struct lruhash_entry entry;
+	/** query name, allocated after the struct, compared without case */
+	uint8_t* qname;
+	/** length of qname */
+	size_t qname_len;
+	/** query type, host byteorder */
+	uint16_t qtype;
+	/** query class, host byteorder */
+	uint16_t qclass;
+	/** if the DO bit was set, and DNSSEC records are in the answer */
+	int dnssec;
+};
+
+/**
+ * Data for the answer cache of an auth zone. The encoded answer without
+ * EDNS record, and ID, RD and CD bits to be filled in from the query.
+ */
+struct auth_answer_data {
+	/** length of the encoded answer */
+	size_t len;
+	/** the encoded answer, allocated after the struct */
+	uint8_t* data;
+};
+
 /**
  * Authoritative zone transfer structure.
  * Create and destroy needs the auth_zones* biglock.
@@ -503,6 +584,13 @@ void auth_zones_delete(struct auth_zones* az);
  */
 int auth_zone_write_file(struct auth_zone* z, const char* fname);
 
+/**
+ * Get memory in use by the auth zones, the zone data.
+ * @param az: auth zones structure.
+ * @return memory in bytes.
+ */
+size_t auth_zones_get_mem(struct auth_zones* az);
+
 /**
  * Use auth zones to lookup the answer to a query.
  * The query is from the iterator.  And the auth zones attempts to provide
@@ -634,6 +722,18 @@ int auth_data_cmp(const void* z1, const void* z2);
 /** compare auth_xfer for sorted rbtree */
 int auth_xfer_cmp(const void* z1, const void* z2);
 
+/** calculate size of auth answer cache entry, for lruhash */
+size_t auth_answer_sizefunc(void* k, void* d);
+
+/** compare auth answer cache keys, for lruhash */
+int auth_answer_compfunc(void* k1, void* k2);
+
+/** delete auth answer cache key, for lruhash */
+void auth_answer_delkeyfunc(void* k, void* arg);
+
+/** delete auth answer cache data, for lruhash */
+void auth_answer_deldatafunc(void* d, void* arg);
+
 /** Create auth_xfer structure.
  * Caller must have wrlock on az. Returns locked xfer zone.
  * @param az: zones structure.
@@ -652,6 +752,20 @@ struct auth_xfer* auth_xfer_create(struct auth_zones* az, struct auth_zone* z);
 int xfer_set_masters(struct auth_master** list, struct config_auth* c,
 	int with_http);
 
+/**
+ * Apply the transfer in the chunk list of the task_transfer to the zone.
+ * The IXFR and AXFR are applied off to the side of the zone and published
+ * with the writelock.
+ * @param xfr: the xfer, locked by caller, the lock is released and
+ *	obtained again.
+ * @param env: module env with the auth zones.
+ * @param ixfr_fail: set to true if the IXFR failed to apply, and a
+ *	full transfer is needed.
+ * @return false on failure.
+ */
+int xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
+	int* ixfr_fail);
+
 /** xfer nextprobe timeout callback, this is part of task_nextprobe */
 void auth_xfer_timer(void* arg);
 
@@ -190,7 +190,7 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	struct ub_packed_rrset_key* k = ref->key;
 	hashvalue_type h = k->entry.hash;
 	uint16_t rrset_type = ntohs(k->rk.type);
-	int equal = 0;
+	int equal = 0, lost_secure = 0;
 	log_assert(ref->id != 0 && k->id != 0);
 	log_assert(k->rk.dname != NULL);
 	/* looks up item with a readlock - no editing! */
@@ -206,6 +206,9 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 		ref->id = ref->key->id;
 		equal = rrsetdata_equal((struct packed_rrset_data*)k->entry.
 			data, (struct packed_rrset_data*)e->data);
+		lost_secure = (((struct packed_rrset_data*)e->data)->security
+			== sec_status_secure && ((struct packed_rrset_data*)
+			k->entry.data)->security != sec_status_secure);
 		if(!need_to_update_rrset(k->entry.data, e->data, timenow,
 			equal, (rrset_type==LDNS_RR_TYPE_NS))) {
 			/* cache is superior, return that value */
@@ -233,6 +236,10 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 			|| rrset_type == LDNS_RR_TYPE_NSEC3
 			|| rrset_type == LDNS_RR_TYPE_DNAME) && !equal) {
 			rrset_update_id(ref, alloc);
+		} else if(lost_secure) {
+			/* secure messages in the message cache use the ID
+			 * to know that their rrsets are still secure */
+			rrset_update_id(ref, alloc);
 		}
 		return 1;
 	}
@@ -81,6 +81,15 @@
 
 /** number of queued TCP connections for listen() */
 #define TCP_BACKLOG 256 
+/** number of queries read in a row from a stream, before the pending
+ * replies are written, so that other streams also get a turn */
+#define TCP_REQ_READ_BATCH 32
+/** number of queries of a stream that can wait for recursion, no more
+ * queries are read from the stream while it has more than this */
+#define TCP_REQ_MAX_OPEN 256
+/** initial capacity of the buffer for the results that are written
+ * together, it grows when more are pending, a bigger one is not kept */
+#define TCP_REQ_WRITE_BUFSIZE 4096
 
 #ifndef THREADS_DISABLED
 /** lock on the counter of stream buffer memory */
@@ -103,6 +112,39 @@ static size_t http2_response_buffer_count = 0;
 /** is the lock initialised for HTTP2 response buffers */
 static int http2_response_buffer_lock_inited = 0;
 
+#ifdef HAVE_NGHTTP2
+/** HTTP2 buffer memory is added to the global counters in reserves of
+ * this size, per thread, so that most stream buffers do not need to take
+ * the counter locks.  What is not used of the reserve, counts as in use. */
+#define HTTP2_BUFFER_RESERVE 16384
+/** max capacity of pooled HTTP2 query buffers, bigger ones are freed */
+#define HTTP2_POOL_QUERY_BUFSIZE 512
+/** max capacity of pooled HTTP2 response buffers */
+#define HTTP2_POOL_RESPONSE_BUFSIZE 1232
+/** max number of pooled buffers per thread, per kind.  The idle pooled
+ * memory is also kept below 1/64th of the http buffer size config */
+#define HTTP2_POOL_MAX 64
+/** buffer kind for HTTP2 query buffers */
+#define HTTP2_QUERY_BUFFER 0
+/** buffer kind for HTTP2 response buffers */
+#define HTTP2_RESPONSE_BUFFER 1
+
+/** per thread state for the HTTP2 stream buffers */
+struct http2_thread_buffers {
+	/** per kind, bytes added to the global counter that are not in use */
+	size_t reserve[2];
+	/** per kind, number of buffers in the pool */
+	size_t pool_num[2];
+	/** per kind, the free buffers */
+	sldns_buffer* pool[2][HTTP2_POOL_MAX];
+};
+
+/** thread key for the http2_thread_buffers of the thread */
+static ub_thread_key_type http2_thread_key;
+/** is the thread key created */
+static int http2_thread_key_inited = 0;
+#endif /* HAVE_NGHTTP2 */
+
 /**
  * Debug print of the getaddrinfo returned address.
  * @param addr: the address returned.
@@ -1261,34 +1303,30 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 		free(front);
 		return NULL;
 	}
-	if(!stream_wait_lock_inited) {
-		lock_basic_init(&stream_wait_count_lock);
-		stream_wait_lock_inited = 1;
-	}
-	if(!http2_query_buffer_lock_inited) {
-		lock_basic_init(&http2_query_buffer_count_lock);
-		http2_query_buffer_lock_inited = 1;
-	}
-	if(!http2_response_buffer_lock_inited) {
-		lock_basic_init(&http2_response_buffer_count_lock);
-		http2_response_buffer_lock_inited = 1;
-	}
+	listen_setup_locks();
 
 	/* create comm points as needed */
 	while(ports) {
 		struct comm_point* cp = NULL;
 		if(ports->ftype == listen_type_udp ||
-		   ports->ftype == listen_type_udp_dnscrypt)
+		   ports->ftype == listen_type_udp_dnscrypt) {
 			cp = comm_point_create_udp(base, ports->fd, 
 				front->udp_buff, cb, cb_arg);
-		else if(ports->ftype == listen_type_tcp ||
-				ports->ftype == listen_type_tcp_dnscrypt)
+			/* receive with the io_uring if the base has one */
+			if(cp)
+				(void)comm_point_use_uring(cp);
+		} else if(ports->ftype == listen_type_tcp ||
+				ports->ftype == listen_type_tcp_dnscrypt) {
 			cp = comm_point_create_tcp(base, ports->fd, 
 				tcp_accept_count, tcp_idle_timeout,
 				harden_large_queries, 0, NULL,
 				tcp_conn_limit, bufsize, front->udp_buff,
 				ports->ftype, cb, cb_arg);
-		else if(ports->ftype == listen_type_ssl ||
+			/* accept, read and write with the io_uring if the
+			 * base has one */
+			if(cp)
+				(void)comm_point_use_uring(cp);
+		} else if(ports->ftype == listen_type_ssl ||
 			ports->ftype == listen_type_http) {
 			cp = comm_point_create_tcp(base, ports->fd, 
 				tcp_accept_count, tcp_idle_timeout,
@@ -1330,6 +1368,8 @@ listen_create(struct comm_base* base, struct listen_port* ports,
 		}
 		cp->dtenv = dtenv;
 		cp->do_not_close = 1;
+		/* the port can be shared by the threads */
+		comm_point_set_exclusive(cp);
 #ifdef USE_DNSCRYPT
 		if (ports->ftype == listen_type_udp_dnscrypt ||
 			ports->ftype == listen_type_tcp_dnscrypt ||
@@ -1388,6 +1428,66 @@ listen_delete(struct listen_dnsport* front)
 #endif
 	sldns_buffer_free(front->udp_buff);
 	free(front);
+}
+
+#ifdef HAVE_NGHTTP2
+/** delete the HTTP2 buffer state of a thread, at thread exit */
+static void
+http2_thread_buffers_delete(void* arg)
+{
+	struct http2_thread_buffers* tb = (struct http2_thread_buffers*)arg;
+	size_t i;
+	if(!tb)
+		return;
+	lock_basic_lock(&http2_query_buffer_count_lock);
+	http2_query_buffer_count -= tb->reserve[HTTP2_QUERY_BUFFER];
+	lock_basic_unlock(&http2_query_buffer_count_lock);
+	lock_basic_lock(&http2_response_buffer_count_lock);
+	http2_response_buffer_count -= tb->reserve[HTTP2_RESPONSE_BUFFER];
+	lock_basic_unlock(&http2_response_buffer_count_lock);
+	for(i=0; i<tb->pool_num[HTTP2_QUERY_BUFFER]; i++)
+		sldns_buffer_free(tb->pool[HTTP2_QUERY_BUFFER][i]);
+	for(i=0; i<tb->pool_num[HTTP2_RESPONSE_BUFFER]; i++)
+		sldns_buffer_free(tb->pool[HTTP2_RESPONSE_BUFFER][i]);
+	free(tb);
+}
+#endif /* HAVE_NGHTTP2 */
+
+void
+listen_setup_locks(void)
+{
+	if(!stream_wait_lock_inited) {
+		lock_basic_init(&stream_wait_count_lock);
+		stream_wait_lock_inited = 1;
+	}
+	if(!http2_query_buffer_lock_inited) {
+		lock_basic_init(&http2_query_buffer_count_lock);
+		http2_query_buffer_lock_inited = 1;
+	}
+	if(!http2_response_buffer_lock_inited) {
+		lock_basic_init(&http2_response_buffer_count_lock);
+		http2_response_buffer_lock_inited = 1;
+	}
+#ifdef HAVE_NGHTTP2
+	if(!http2_thread_key_inited) {
+		ub_thread_key_create(&http2_thread_key,
+			http2_thread_buffers_delete);
+		http2_thread_key_inited = 1;
+	}
+#endif
+}
+
+void
+listen_desetup_locks(void)
+{
+#ifdef HAVE_NGHTTP2
+	if(http2_thread_key_inited) {
+		/* the other threads have exited, and released theirs */
+		http2_thread_buffers_delete(ub_thread_key_get(
+			http2_thread_key));
+		ub_thread_key_set(http2_thread_key, NULL);
+	}
+#endif
 	if(stream_wait_lock_inited) {
 		stream_wait_lock_inited = 0;
 		lock_basic_destroy(&stream_wait_count_lock);
@@ -1656,9 +1756,33 @@ listening_ports_open(struct config_file* cfg, char** ifs, int num_ifs,
 			}
 		}
 	}
+	if(cfg->busy_poll > 0)
+		listening_ports_busy_poll(list, cfg->busy_poll);
 	return list;
 }
 
+void listening_ports_busy_poll(struct listen_port* list, int usec)
+{
+#ifdef SO_BUSY_POLL
+	struct listen_port* p;
+	for(p = list; p; p = p->next) {
+		if(setsockopt(p->fd, SOL_SOCKET, SO_BUSY_POLL, (void*)&usec,
+			(socklen_t)sizeof(usec)) < 0) {
+			/* this option is not essential, we can continue,
+			 * above the net.core.busy_read sysctl it needs
+			 * CAP_NET_ADMIN */
+			log_warn("setsockopt(.. SO_BUSY_POLL ..) failed: %s",
+				sock_strerror(errno));
+			return;
+		}
+	}
+#else
+	(void)list;
+	(void)usec;
+	verbose(VERB_OPS, "busy-poll: SO_BUSY_POLL is not available");
+#endif
+}
+
 void listening_ports_free(struct listen_port* list)
 {
 	struct listen_port* nx;
@@ -1741,6 +1865,39 @@ tcp_req_info_delete(struct tcp_req_info* req)
 	free(req);
 }
 
+/** count space in the stream wait size, false if there is no room */
+static int
+stream_wait_count_add(size_t space)
+{
+	lock_basic_lock(&stream_wait_count_lock);
+	if(stream_wait_count + space > stream_wait_max) {
+		lock_basic_unlock(&stream_wait_count_lock);
+		verbose(VERB_ALGO, "drop stream reply, no space left, in stream-wait-size");
+		return 0;
+	}
+	stream_wait_count += space;
+	lock_basic_unlock(&stream_wait_count_lock);
+	return 1;
+}
+
+/** remove space from the stream wait size count */
+static void
+stream_wait_count_sub(size_t space)
+{
+	lock_basic_lock(&stream_wait_count_lock);
+	stream_wait_count -= space;
+	lock_basic_unlock(&stream_wait_count_lock);
+}
+
+/** free a write buffer of results, and its space in the stream wait size */
+static void
+tcp_req_info_free_write_buffer(sldns_buffer* buf)
+{
+	if(!buf) return;
+	stream_wait_count_sub(sldns_buffer_capacity(buf));
+	sldns_buffer_free(buf);
+}
+
 void tcp_req_info_clear(struct tcp_req_info* req)
 {
 	struct tcp_req_open_item* open, *nopen;
@@ -1773,6 +1930,30 @@ void tcp_req_info_clear(struct tcp_req_info* req)
 	req->done_req_list = NULL;
 	req->num_done_req = 0;
 	req->read_is_closed = 0;
+	req->num_read_batch = 0;
+
+	/* free the results that are written together, and put the buffer
+	 * of the comm point back if they were being written */
+	if(req->read_buffer) {
+		tcp_req_info_free_write_buffer(req->cp->buffer);
+		req->cp->buffer = req->read_buffer;
+		req->read_buffer = NULL;
+	}
+	tcp_req_info_free_write_buffer(req->write_buffer);
+	req->write_buffer = NULL;
+}
+
+/** setup listening for read or write */
+static void tcp_req_info_setup_listen(struct tcp_req_info* req);
+
+/** see if reading can continue after the number of queries that wait for
+ * recursion dropped below the maximum */
+static void
+tcp_req_info_check_open_max(struct tcp_req_info* req)
+{
+	if(req->num_open_req == TCP_REQ_MAX_OPEN-1 && !req->in_worker_handle
+		&& req->cp->tcp_is_reading && req->cp->tcp_byte_count == 0)
+		tcp_req_info_setup_listen(req);
 }
 
 void
@@ -1790,6 +1971,7 @@ tcp_req_info_remove_mesh_state(struct tcp_req_info* req, struct mesh_state* m)
 			next = open->next;
 			free(open);
 			req->num_open_req --;
+			tcp_req_info_check_open_max(req);
 
 			/* prev = prev; */
 			open = next;
@@ -1814,7 +1996,7 @@ tcp_req_info_setup_listen(struct tcp_req_info* req)
 
 	if(!req->cp->tcp_is_reading)
 		wr = 1;
-	if(!req->read_is_closed)
+	if(!req->read_is_closed && req->num_open_req < TCP_REQ_MAX_OPEN)
 		rd = 1;
 	
 	if(wr) {
@@ -1866,13 +2048,92 @@ tcp_req_info_start_write_buf(struct tcp_req_info* req, uint8_t* buf,
 	req->cp->tcp_is_reading = 0; /* we are now writing */
 }
 
-/** pick up the next result and start writing it to the channel */
+/** see if the replies can be written together, with their lengths,
+ * in the buffer of the channel */
+static int
+tcp_req_info_can_coalesce(struct tcp_req_info* req)
+{
+#ifdef USE_DNSCRYPT
+	/* dnscrypt encrypts the reply in the buffer, one at a time */
+	if(req->cp->dnscrypt)
+		return 0;
+#endif
+	(void)req;
+	return 1;
+}
+
+/** append a result with its length to a write buffer.  The buffer is
+ * created, or grows, if the stream wait size has room */
+static int
+tcp_req_info_append_write_buf(sldns_buffer** bp, uint8_t* buf, size_t len)
+{
+	sldns_buffer* b = *bp;
+	size_t need, cap;
+	if(!b) {
+		cap = TCP_REQ_WRITE_BUFSIZE;
+		if(cap < sizeof(uint16_t) + len)
+			cap = sizeof(uint16_t) + len;
+		if(!stream_wait_count_add(cap))
+			return 0;
+		if(!(b = sldns_buffer_new(cap))) {
+			log_err("malloc failure, for stream write buffer");
+			stream_wait_count_sub(cap);
+			return 0;
+		}
+		sldns_buffer_flip(b);
+		*bp = b;
+	}
+	need = sldns_buffer_limit(b) + sizeof(uint16_t) + len;
+	sldns_buffer_set_position(b, sldns_buffer_limit(b));
+	if(need > sldns_buffer_capacity(b)) {
+		cap = sldns_buffer_capacity(b)*2;
+		if(cap < need)
+			cap = need;
+		if(!stream_wait_count_add(cap - sldns_buffer_capacity(b))) {
+			sldns_buffer_flip(b);
+			return 0;
+		}
+		if(!sldns_buffer_set_capacity(b, cap)) {
+			log_err("malloc failure, for stream write buffer");
+			stream_wait_count_sub(cap - sldns_buffer_capacity(b));
+			sldns_buffer_flip(b);
+			return 0;
+		}
+	}
+	sldns_buffer_set_limit(b, sldns_buffer_capacity(b));
+	sldns_buffer_write_u16(b, (uint16_t)len);
+	sldns_buffer_write(b, buf, len);
+	sldns_buffer_flip(b);
+	return 1;
+}
+
+/** see if there are results waiting to be written */
+static int
+tcp_req_info_have_results(struct tcp_req_info* req)
+{
+	return req->num_done_req > 0 || (req->write_buffer &&
+		sldns_buffer_limit(req->write_buffer) > 0);
+}
+
+/** pick up the next result and start writing it to the channel.
+ * The results in the write buffer are written together, from that
+ * buffer, and the buffer of the comm point is kept for reading. */
 static void
 tcp_req_pickup_next_result(struct tcp_req_info* req)
 {
+	struct tcp_req_done_item* item;
+	req->num_read_batch = 0;
+	if(req->write_buffer && sldns_buffer_limit(req->write_buffer) > 0) {
+		req->read_buffer = req->cp->buffer;
+		req->cp->buffer = req->write_buffer;
+		req->write_buffer = NULL;
+		req->cp->tcp_write_prefixed = 1;
+		req->cp->tcp_is_reading = 0; /* we are now writing */
+		return;
+	}
 	if(req->num_done_req > 0) {
 		/* unlist the done item from the list of pending results */
-		struct tcp_req_done_item* item = tcp_req_info_pop_done(req);
+		item = tcp_req_info_pop_done(req);
 		tcp_req_info_start_write_buf(req, item->buf, item->len);
 		free(item->buf);
 		free(item);
@@ -1887,13 +2148,13 @@ tcp_req_info_handle_read_close(struct tcp_req_info* req)
 	/* reset byte count for (potential) partial read */
 	req->cp->tcp_byte_count = 0;
 	/* if we still have results to write, pick up next and write it */
-	if(req->num_done_req != 0) {
+	if(tcp_req_info_have_results(req)) {
 		tcp_req_pickup_next_result(req);
 		tcp_req_info_setup_listen(req);
 		return 1;
 	}
 	/* if nothing to do, this closes the connection */
-	if(req->num_open_req == 0 && req->num_done_req == 0)
+	if(req->num_open_req == 0)
 		return 0;
 	/* otherwise, we must be waiting for dns resolve, wait with timeout */
 	req->read_is_closed = 1;
@@ -1904,16 +2165,34 @@ tcp_req_info_handle_read_close(struct tcp_req_info* req)
 void
 tcp_req_info_handle_writedone(struct tcp_req_info* req)
 {
+	if(req->read_buffer) {
+		/* the results were written from the write buffer, put the
+		 * buffer of the comm point back.  The write buffer is kept
+		 * for the next results, unless it has grown */
+		sldns_buffer* written = req->cp->buffer;
+		req->cp->buffer = req->read_buffer;
+		req->read_buffer = NULL;
+		if(!req->write_buffer && sldns_buffer_capacity(written) <=
+			TCP_REQ_WRITE_BUFSIZE) {
+			sldns_buffer_clear(written);
+			sldns_buffer_flip(written);
+			req->write_buffer = written;
+		} else	tcp_req_info_free_write_buffer(written);
+	}
 	/* back to reading state, we finished this write event */
 	sldns_buffer_clear(req->cp->buffer);
-	if(req->num_done_req == 0 && req->read_is_closed) {
+	if(!tcp_req_info_have_results(req) && req->read_is_closed) {
 		/* no more to write and nothing to read, close it */
 		comm_point_drop_reply(&req->cp->repinfo);
 		return;
 	}
 	req->cp->tcp_is_reading = 1;
-	/* see if another result needs writing */
-	tcp_req_pickup_next_result(req);
+	/* see if another result needs writing, if no queries can be read.
+	 * Otherwise read the queries that have arrived first, the results
+	 * are written when there is nothing more to read */
+	if(req->read_is_closed || req->num_open_req >= TCP_REQ_MAX_OPEN
+		|| !tcp_req_info_can_coalesce(req))
+		tcp_req_pickup_next_result(req);
 
 	/* see if there is more to write, if not stop_listening for writing */
 	/* see if new requests are allowed, if so, start_listening
@@ -1921,6 +2200,19 @@ tcp_req_info_handle_writedone(struct tcp_req_info* req)
 	tcp_req_info_setup_listen(req);
 }
 
+void
+tcp_req_info_handle_read_wait(struct tcp_req_info* req)
+{
+	/* no (more) queries to read right now, write the pending results */
+	req->num_read_batch = 0;
+	if(!tcp_req_info_have_results(req) || !req->cp->tcp_is_reading)
+		return;
+	tcp_req_pickup_next_result(req);
+	tcp_req_info_setup_listen(req);
+	/* and write it now, the channel is most likely writable */
+	req->read_again = 1;
+}
+
 void
 tcp_req_info_handle_readdone(struct tcp_req_info* req)
 {
@@ -1941,10 +2233,18 @@ tcp_req_info_handle_readdone(struct tcp_req_info* req)
 	if( (*c->callback)(c, c->cb_arg, NETEVENT_NOERROR, &c->repinfo) ) {
 		req->in_worker_handle = 0;
 		/* there is an answer, put it up.  It is already in the
-		 * c->buffer, just send it. */
-		/* since we were just reading a query, the channel is
-		 * clear to write to */
+		 * c->buffer. */
 	send_it:
+		/* append it to the results that are written together, and
+		 * read on, they are written when no more queries can be
+		 * read right away */
+		if(tcp_req_info_can_coalesce(req) &&
+			tcp_req_info_append_write_buf(&req->write_buffer,
+			sldns_buffer_begin(c->buffer),
+			sldns_buffer_limit(c->buffer)))
+			goto read_more;
+		/* since we were just reading a query, the channel is
+		 * clear to write to, just send it */
 		c->tcp_is_reading = 0;
 		comm_point_stop_listening(c);
 		comm_point_start_listening(c, -1, adjusted_tcp_timeout(c));
@@ -1964,9 +2264,14 @@ tcp_req_info_handle_readdone(struct tcp_req_info* req)
 		goto send_it;
 	}
 
+read_more:
 	sldns_buffer_clear(c->buffer);
-	/* if pending answers, pick up an answer and start sending it */
-	tcp_req_pickup_next_result(req);
+	/* if pending answers, and this stream had its turn or can read
+	 * no more, pick up the answers and start sending them */
+	if(++req->num_read_batch >= TCP_REQ_READ_BATCH ||
+		req->num_open_req >= TCP_REQ_MAX_OPEN ||
+		!tcp_req_info_can_coalesce(req))
+		tcp_req_pickup_next_result(req);
 
 	/* if answers pending, start sending answers */
 	/* read more requests if we can have more requests */
@@ -2054,12 +2359,26 @@ tcp_req_info_send_reply(struct tcp_req_info* req)
 	 * should be removed, from the tcp_req_info list,
 	 * the mesh state cleanup removes then with region_cleanup and
 	 * replies_sent true. */
+	/* if a write of results is pending and has not started yet,
+	 * add it to that */
+	if(req->read_buffer && req->cp->tcp_byte_count == 0 &&
+		tcp_req_info_append_write_buf(&req->cp->buffer,
+		sldns_buffer_begin(req->spool_buffer),
+		sldns_buffer_limit(req->spool_buffer)))
+		return;
 	/* see if we can send it straight away (we are not doing
 	 * anything else).  If so, copy to buffer and start */
 	if(req->cp->tcp_is_reading && req->cp->tcp_byte_count == 0) {
 		/* buffer is free, and was ready to read new query into,
-		 * but we are now going to use it to send this answer */
-		tcp_req_info_start_write_buf(req,
+		 * but we are now going to use it to send this answer,
+		 * together with the answers that are already pending */
+		if(tcp_req_info_have_results(req) &&
+			tcp_req_info_can_coalesce(req) &&
+			tcp_req_info_append_write_buf(&req->write_buffer,
+			sldns_buffer_begin(req->spool_buffer),
+			sldns_buffer_limit(req->spool_buffer)))
+			tcp_req_pickup_next_result(req);
+		else tcp_req_info_start_write_buf(req,
 			sldns_buffer_begin(req->spool_buffer),
 			sldns_buffer_limit(req->spool_buffer));
 		/* switch to listen to write events */
@@ -2069,6 +2388,10 @@ tcp_req_info_send_reply(struct tcp_req_info* req)
 		return;
 	}
 	/* queue up the answer behind the others already pending */
+	if(tcp_req_info_can_coalesce(req) && tcp_req_info_append_write_buf(
+		&req->write_buffer, sldns_buffer_begin(req->spool_buffer),
+		sldns_buffer_limit(req->spool_buffer)))
+		return;
 	if(!tcp_req_info_add_result(req, sldns_buffer_begin(req->spool_buffer),
 		sldns_buffer_limit(req->spool_buffer))) {
 		/* drop the connection, we are out of resources */
@@ -2110,6 +2433,179 @@ size_t http2_get_response_buffer_size(void)
 }
 
 #ifdef HAVE_NGHTTP2
+/** get the HTTP2 buffer state of this thread, NULL on malloc failure */
+static struct http2_thread_buffers*
+http2_thread_buffers_get(void)
+{
+	struct http2_thread_buffers* tb;
+	if(!http2_thread_key_inited)
+		return NULL;
+	tb = (struct http2_thread_buffers*)ub_thread_key_get(
+		http2_thread_key);
+	if(!tb) {
+		tb = (struct http2_thread_buffers*)calloc(1, sizeof(*tb));
+		if(!tb)
+			return NULL;
+		ub_thread_key_set(http2_thread_key, tb);
+	}
+	return tb;
+}
+
+/** capacity of the pooled buffers of the kind */
+static size_t
+http2_pool_bufsize(int kind)
+{
+	if(kind == HTTP2_QUERY_BUFFER)
+		return HTTP2_POOL_QUERY_BUFSIZE;
+	return HTTP2_POOL_RESPONSE_BUFSIZE;
+}
+
+/** max number of pooled buffers of the kind */
+static size_t
+http2_pool_max(int kind)
+{
+	size_t m = ((kind == HTTP2_QUERY_BUFFER)?http2_query_buffer_max:
+		http2_response_buffer_max) / 64 / http2_pool_bufsize(kind);
+	return (m < HTTP2_POOL_MAX)?m:HTTP2_POOL_MAX;
+}
+
+/** change the global counter of the kind, if it stays within the max.
+ * If the optional extra does not fit, only the len is added.
+ * @return the number of bytes added, or 0 if len does not fit. */
+static size_t
+http2_buffer_count_add(int kind, size_t len, size_t extra)
+{
+	size_t* count;
+	size_t max;
+	if(kind == HTTP2_QUERY_BUFFER) {
+		lock_basic_lock(&http2_query_buffer_count_lock);
+		count = &http2_query_buffer_count;
+		max = http2_query_buffer_max;
+	} else {
+		lock_basic_lock(&http2_response_buffer_count_lock);
+		count = &http2_response_buffer_count;
+		max = http2_response_buffer_max;
+	}
+	if(*count + len + extra > max)
+		extra = 0;
+	if(*count + len > max)
+		len = 0;
+	else	*count += len + extra;
+	if(kind == HTTP2_QUERY_BUFFER)
+		lock_basic_unlock(&http2_query_buffer_count_lock);
+	else	lock_basic_unlock(&http2_response_buffer_count_lock);
+	return len?len+extra:0;
+}
+
+/** remove bytes from the global counter of the kind */
+static void
+http2_buffer_count_sub(int kind, size_t len)
+{
+	if(kind == HTTP2_QUERY_BUFFER) {
+		lock_basic_lock(&http2_query_buffer_count_lock);
+		http2_query_buffer_count -= len;
+		lock_basic_unlock(&http2_query_buffer_count_lock);
+	} else {
+		lock_basic_lock(&http2_response_buffer_count_lock);
+		http2_response_buffer_count -= len;
+		lock_basic_unlock(&http2_response_buffer_count_lock);
+	}
+}
+
+/** find the smallest pooled buffer of the kind that fits len.
+ * @return index in the pool, or -1 if none fits. */
+static int
+http2_pool_find(struct http2_thread_buffers* tb, int kind, size_t len)
+{
+	size_t i, best_cap = 0;
+	int best = -1;
+	for(i=0; i<tb->pool_num[kind]; i++) {
+		size_t c = sldns_buffer_capacity(tb->pool[kind][i]);
+		if(c >= len && (best == -1 || c < best_cap)) {
+			best = (int)i;
+			best_cap = c;
+		}
+	}
+	return best;
+}
+
+/**
+ * Get a buffer for an HTTP2 stream, counted in the http buffer size.
+ * The capacity of the buffer is counted, that is len for a new buffer,
+ * and a pooled buffer that fits is reused.  The thread reserve is used
+ * if it has room.  The buffer is cleared with the limit at len.
+ * @param kind: HTTP2_QUERY_BUFFER or HTTP2_RESPONSE_BUFFER.
+ * @param len: length needed.
+ * @param full: set to true if the http buffer size is exhausted.
+ * @return the buffer, or NULL if full or on malloc failure.
+ */
+static sldns_buffer*
+http2_buffer_new(int kind, size_t len, int* full)
+{
+	struct http2_thread_buffers* tb = http2_thread_buffers_get();
+	size_t cap = len, added;
+	int p = -1;
+	sldns_buffer* buf;
+	*full = 0;
+	if(tb && len <= http2_pool_bufsize(kind) &&
+		(p = http2_pool_find(tb, kind, len)) != -1)
+		cap = sldns_buffer_capacity(tb->pool[kind][p]);
+	if(tb && tb->reserve[kind] >= cap) {
+		tb->reserve[kind] -= cap;
+	} else if(tb) {
+		if(!(added = http2_buffer_count_add(kind,
+			cap - tb->reserve[kind], HTTP2_BUFFER_RESERVE))) {
+			*full = 1;
+			return NULL;
+		}
+		tb->reserve[kind] = tb->reserve[kind] + added - cap;
+	} else if(!http2_buffer_count_add(kind, cap, 0)) {
+		*full = 1;
+		return NULL;
+	}
+	if(p != -1) {
+		buf = tb->pool[kind][p];
+		tb->pool[kind][p] = tb->pool[kind][--tb->pool_num[kind]];
+	} else if(!(buf = sldns_buffer_new(cap))) {
+		if(tb)
+			tb->reserve[kind] += cap;
+		else	http2_buffer_count_sub(kind, cap);
+		return NULL;
+	}
+	sldns_buffer_clear(buf);
+	sldns_buffer_set_limit(buf, len);
+	return buf;
+}
+
+/**
+ * Free a buffer from http2_buffer_new.  Returns its capacity to the thread
+ * reserve, and keeps a small buffer in the pool if it has room.
+ * @param kind: HTTP2_QUERY_BUFFER or HTTP2_RESPONSE_BUFFER.
+ * @param buf: the buffer.
+ */
+static void
+http2_buffer_free(int kind, sldns_buffer* buf)
+{
+	struct http2_thread_buffers* tb = http2_thread_buffers_get();
+	size_t cap = sldns_buffer_capacity(buf);
+	if(!tb) {
+		http2_buffer_count_sub(kind, cap);
+		sldns_buffer_free(buf);
+		return;
+	}
+	tb->reserve[kind] += cap;
+	if(tb->reserve[kind] > 2*HTTP2_BUFFER_RESERVE) {
+		/* give back what is more than one reserve */
+		http2_buffer_count_sub(kind, tb->reserve[kind] -
+			HTTP2_BUFFER_RESERVE);
+		tb->reserve[kind] = HTTP2_BUFFER_RESERVE;
+	}
+	if(cap <= http2_pool_bufsize(kind) &&
+		tb->pool_num[kind] < http2_pool_max(kind))
+		tb->pool[kind][tb->pool_num[kind]++] = buf;
+	else	sldns_buffer_free(buf);
+}
+
 /** nghttp2 callback. Used to copy response from rbuffer to nghttp2 session */
 static ssize_t http2_submit_response_read_callback(
 	nghttp2_session* ATTR_UNUSED(session),
@@ -2143,11 +2639,7 @@ static ssize_t http2_submit_response_read_callback(
 
 	if(sldns_buffer_remaining(h2_stream->rbuffer) == 0) {
 		*data_flags |= NGHTTP2_DATA_FLAG_EOF;
-		lock_basic_lock(&http2_response_buffer_count_lock);
-		http2_response_buffer_count -=
-			sldns_buffer_capacity(h2_stream->rbuffer);
-		lock_basic_unlock(&http2_response_buffer_count_lock);
-		sldns_buffer_free(h2_stream->rbuffer);
+		http2_buffer_free(HTTP2_RESPONSE_BUFFER, h2_stream->rbuffer);
 		h2_stream->rbuffer = NULL;
 	}
 
@@ -2189,6 +2681,7 @@ int http2_submit_dns_response(struct http2_session* h2_session)
 	nghttp2_nv headers[3];
 	struct http2_stream* h2_stream = h2_session->c->h2_stream;
 	size_t rlen;
+	int full;
 	char rlen_str[32];
 
 	if(h2_stream->rbuffer) {
@@ -2210,20 +2703,13 @@ int http2_submit_dns_response(struct http2_session* h2_session)
 	rlen = sldns_buffer_remaining(h2_session->c->buffer);
 	snprintf(rlen_str, sizeof(rlen_str), "%u", (unsigned)rlen);
 
-	lock_basic_lock(&http2_response_buffer_count_lock);
-	if(http2_response_buffer_count + rlen > http2_response_buffer_max) {
-		lock_basic_unlock(&http2_response_buffer_count_lock);
-		verbose(VERB_ALGO, "reset HTTP2 stream, no space left, "
-			"in https-response-buffer-size");
-		return http2_submit_rst_stream(h2_session, h2_stream);
-	}
-	http2_response_buffer_count += rlen;
-	lock_basic_unlock(&http2_response_buffer_count_lock);
-
-	if(!(h2_stream->rbuffer = sldns_buffer_new(rlen))) {
-		lock_basic_lock(&http2_response_buffer_count_lock);
-		http2_response_buffer_count -= rlen;
-		lock_basic_unlock(&http2_response_buffer_count_lock);
+	if(!(h2_stream->rbuffer = http2_buffer_new(HTTP2_RESPONSE_BUFFER,
+		rlen, &full))) {
+		if(full) {
+			verbose(VERB_ALGO, "reset HTTP2 stream, no space left, "
+				"in https-response-buffer-size");
+			return http2_submit_rst_stream(h2_session, h2_stream);
+		}
 		log_err("http2 submit response error: malloc failure");
 		return 0;
 	}
@@ -2384,10 +2870,7 @@ static int http2_query_read_done(struct http2_session* h2_session,
 		sldns_buffer_current(h2_stream->qbuffer),
 		sldns_buffer_remaining(h2_stream->qbuffer));
 
-	lock_basic_lock(&http2_query_buffer_count_lock);
-	http2_query_buffer_count -= sldns_buffer_capacity(h2_stream->qbuffer);
-	lock_basic_unlock(&http2_query_buffer_count_lock);
-	sldns_buffer_free(h2_stream->qbuffer);
+	http2_buffer_free(HTTP2_QUERY_BUFFER, h2_stream->qbuffer);
 	h2_stream->qbuffer = NULL;
 
 	sldns_buffer_flip(h2_session->c->buffer);
@@ -2533,7 +3016,7 @@ static int http2_buffer_uri_query(struct http2_session* h2_session,
 	struct http2_stream* h2_stream, const uint8_t* start, size_t length)
 {
 	size_t expectb64len;
-	int b64len;
+	int b64len, full;
 	if(h2_stream->http_method == HTTP_METHOD_POST)
 		return 1;
 	if(length == 0)
@@ -2554,19 +3037,13 @@ static int http2_buffer_uri_query(struct http2_session* h2_session,
 		return 1;
 	}
 
-	lock_basic_lock(&http2_query_buffer_count_lock);
-	if(http2_query_buffer_count + expectb64len > http2_query_buffer_max) {
-		lock_basic_unlock(&http2_query_buffer_count_lock);
-		verbose(VERB_ALGO, "reset HTTP2 stream, no space left, "
-			"in http2-query-buffer-size");
-		return http2_submit_rst_stream(h2_session, h2_stream);
-	}
-	http2_query_buffer_count += expectb64len;
-	lock_basic_unlock(&http2_query_buffer_count_lock);
-	if(!(h2_stream->qbuffer = sldns_buffer_new(expectb64len))) {
-		lock_basic_lock(&http2_query_buffer_count_lock);
-		http2_query_buffer_count -= expectb64len;
-		lock_basic_unlock(&http2_query_buffer_count_lock);
+	if(!(h2_stream->qbuffer = http2_buffer_new(HTTP2_QUERY_BUFFER,
+		expectb64len, &full))) {
+		if(full) {
+			verbose(VERB_ALGO, "reset HTTP2 stream, no space left, "
+				"in http2-query-buffer-size");
+			return http2_submit_rst_stream(h2_session, h2_stream);
+		}
 		log_err("http2_req_header fail, qbuffer "
 			"malloc failure");
 		return 0;
@@ -2576,10 +3053,7 @@ static int http2_buffer_uri_query(struct http2_session* h2_session,
 		(char const *)start, length,
 		sldns_buffer_current(h2_stream->qbuffer),
 		expectb64len)) || b64len < 0) {
-		lock_basic_lock(&http2_query_buffer_count_lock);
-		http2_query_buffer_count -= expectb64len;
-		lock_basic_unlock(&http2_query_buffer_count_lock);
-		sldns_buffer_free(h2_stream->qbuffer);
+		http2_buffer_free(HTTP2_QUERY_BUFFER, h2_stream->qbuffer);
 		h2_stream->qbuffer = NULL;
 		/* return without error, method can be an
 		 * unknown POST */
@@ -2633,11 +3107,8 @@ static int http2_req_header_cb(nghttp2_session* session,
 			h2_stream->http_method = HTTP_METHOD_POST;
 			if(h2_stream->qbuffer) {
 				/* POST method uses query from DATA frames */
-				lock_basic_lock(&http2_query_buffer_count_lock);
-				http2_query_buffer_count -=
-					sldns_buffer_capacity(h2_stream->qbuffer);
-				lock_basic_unlock(&http2_query_buffer_count_lock);
-				sldns_buffer_free(h2_stream->qbuffer);
+				http2_buffer_free(HTTP2_QUERY_BUFFER,
+					h2_stream->qbuffer);
 				h2_stream->qbuffer = NULL;
 			}
 		} else
@@ -2743,20 +3214,13 @@ static int http2_req_data_chunk_recv_cb(nghttp2_session* ATTR_UNUSED(session),
 		}
 	}
 	if(!h2_stream->qbuffer && qlen) {
-		lock_basic_lock(&http2_query_buffer_count_lock);
-		if(http2_query_buffer_count + qlen > http2_query_buffer_max) {
-			lock_basic_unlock(&http2_query_buffer_count_lock);
+		int full;
+		if(!(h2_stream->qbuffer = http2_buffer_new(HTTP2_QUERY_BUFFER,
+			qlen, &full)) && full) {
 			verbose(VERB_ALGO, "reset HTTP2 stream, no space left, "
 				"in http2-query-buffer-size");
 			return http2_submit_rst_stream(h2_session, h2_stream);
 		}
-		http2_query_buffer_count += qlen;
-		lock_basic_unlock(&http2_query_buffer_count_lock);
-		if(!(h2_stream->qbuffer = sldns_buffer_new(qlen))) {
-			lock_basic_lock(&http2_query_buffer_count_lock);
-			http2_query_buffer_count -= qlen;
-			lock_basic_unlock(&http2_query_buffer_count_lock);
-		}
 	}
 
 	if(!h2_stream->qbuffer ||
@@ -2776,19 +3240,11 @@ static int http2_req_data_chunk_recv_cb(nghttp2_session* ATTR_UNUSED(session),
 void http2_req_stream_clear(struct http2_stream* h2_stream)
 {
 	if(h2_stream->qbuffer) {
-		lock_basic_lock(&http2_query_buffer_count_lock);
-		http2_query_buffer_count -=
-			sldns_buffer_capacity(h2_stream->qbuffer);
-		lock_basic_unlock(&http2_query_buffer_count_lock);
-		sldns_buffer_free(h2_stream->qbuffer);
+		http2_buffer_free(HTTP2_QUERY_BUFFER, h2_stream->qbuffer);
 		h2_stream->qbuffer = NULL;
 	}
 	if(h2_stream->rbuffer) {
-		lock_basic_lock(&http2_response_buffer_count_lock);
-		http2_response_buffer_count -=
-			sldns_buffer_capacity(h2_stream->rbuffer);
-		lock_basic_unlock(&http2_response_buffer_count_lock);
-		sldns_buffer_free(h2_stream->rbuffer);
+		http2_buffer_free(HTTP2_RESPONSE_BUFFER, h2_stream->rbuffer);
 		h2_stream->rbuffer = NULL;
 	}
 }
@@ -131,6 +131,15 @@ struct listen_port {
 struct listen_port* listening_ports_open(struct config_file* cfg,
 	char** ifs, int num_ifs, int* reuseport);
 
+/**
+ * Set SO_BUSY_POLL on the listening ports, so that the kernel polls the
+ * device queue for that long when the socket is read and empty.
+ * Failure is logged, but not fatal.
+ * @param list: list of ports.
+ * @param usec: microseconds to poll.
+ */
+void listening_ports_busy_poll(struct listen_port* list, int usec);
+
 /**
  * Close and delete the (list of) listening ports.
  */
@@ -182,6 +191,18 @@ listen_create(struct comm_base* base, struct listen_port* ports,
  */
 void listen_delete(struct listen_dnsport* listen);
 
+/**
+ * Setup the locks and the thread key for the counters that are shared
+ * between the listening structures of the threads.  Call before the
+ * threads are started, it does nothing if already setup.
+ */
+void listen_setup_locks(void);
+
+/**
+ * Delete the shared locks and thread key, after the threads have exited.
+ */
+void listen_desetup_locks(void);
+
 /**
  * delete listen_list of commpoints. Calls commpointdelete() on items.
  * This may close the fds or not depending on flags.
@@ -293,8 +314,18 @@ struct tcp_req_info {
 	struct tcp_req_open_item* open_req_list;
 	/** number of pending writeable results */
 	int num_done_req;
-	/** list of pending writable result packets, malloced one at a time */
+	/** list of pending writable result packets, malloced one at a time,
+	 * for streams that write one result at a time */
 	struct tcp_req_done_item* done_req_list;
+	/** number of queries read since the results were last written */
+	int num_read_batch;
+	/** pending results to write together, each with its length in
+	 * front, or NULL.  It is swapped with the buffer of the comm point
+	 * while it is written */
+	struct sldns_buffer* write_buffer;
+	/** the buffer of the comm point, while the write_buffer is in its
+	 * place, or NULL */
+	struct sldns_buffer* read_buffer;
 };
 
 /**
@@ -365,6 +396,13 @@ void tcp_req_info_handle_writedone(struct tcp_req_info* req);
  */
 void tcp_req_info_handle_readdone(struct tcp_req_info* req);
 
+/**
+ * Handle that no new request can be read from the client right now,
+ * the pending results are written.
+ * @param req: the tcp req info.
+ */
+void tcp_req_info_handle_read_wait(struct tcp_req_info* req);
+
 /**
  * Add mesh state to the tcp req list of open requests.
  * So the comm_reply can be removed off the mesh reply list when
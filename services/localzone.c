@@ -39,6 +39,7 @@
  * This file contains functions to enable local zone authority service.
  */
 #include "config.h"
+#include <ctype.h>
 #include "services/localzone.h"
 #include "sldns/str2wire.h"
 #include "util/regional.h"
@@ -51,10 +52,28 @@
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
 #include "util/as112.h"
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+#include <fcntl.h>
+#ifndef USE_WINSOCK
+#include <sys/mman.h>
+#endif
 
 /* maximum RRs in an RRset, to cap possible 'endless' list RRs.
  * with 16 bytes for an A record, a 64K packet has about 4000 max */
 #define LOCALZONE_RRSET_COUNT_MAX 4096
+/* number of slots in a newly created local zones index */
+#define LZ_INDEX_MIN_SIZE 16
+/* magic string at the start of a compiled local zone file */
+#define LZ_FILE_MAGIC "UBLZ"
+/* version of the compiled local zone file format */
+#define LZ_FILE_VERSION 3
+/* size of the header of a compiled local zone file */
+#define LZ_FILE_HEADER_SIZE 36
+/* size of the fixed part of a zone record in a compiled local zone file,
+ * hash, class, type, labels, name length */
+#define LZ_FILE_ZONE_SIZE 9
 
 struct local_zones* 
 local_zones_create(void)
@@ -66,6 +85,7 @@ local_zones_create(void)
 	rbtree_init(&zones->ztree, &local_zone_cmp);
 	lock_rw_init(&zones->lock);
 	lock_protect(&zones->lock, &zones->ztree, sizeof(zones->ztree));
+	lock_protect(&zones->lock, &zones->index, sizeof(zones->index));
 	/* also lock protects the rbnode's in struct local_zone */
 	return zones;
 }
@@ -86,6 +106,14 @@ local_zones_delete(struct local_zones* zones)
 	lock_rw_destroy(&zones->lock);
 	/* walk through zones and delete them all */
 	traverse_postorder(&zones->ztree, lzdel, NULL);
+	free(zones->index);
+	if(zones->file_map) {
+#ifndef USE_WINSOCK
+		(void)munmap(zones->file_map, zones->file_len);
+#else
+		free(zones->file_map);
+#endif
+	}
 	free(zones);
 }
 
@@ -127,6 +155,211 @@ local_data_cmp(const void* d1, const void* d2)
 		b->namelabs, &m);
 }
 
+/** hash a label into the hash of its parent name */
+static hashvalue_type
+lz_index_hash_label(hashvalue_type h, uint8_t* lab)
+{
+	uint8_t lablen = *lab++;
+	h = (h ^ lablen) * 16777619u;
+	while(lablen--) {
+		h = (h ^ (uint8_t)tolower((unsigned char)*lab)) * 16777619u;
+		lab++;
+	}
+	return h;
+}
+
+/** hash a zone name and class for the zones index, for the name and all
+ * its suffixes. The hash of a name continues from the hash of its parent,
+ * so they take one pass over the name. hs[i] is the hash of the name with
+ * i labels removed, the number of labels without the root is returned.
+ * This does not use the lookup3 hash, because its random seed is set
+ * after the zones are read from config, and the index has to stay valid
+ * after that. */
+static int
+lz_index_hashes(uint8_t* name, uint16_t dclass,
+	hashvalue_type hs[LOCAL_ZONES_INDEX_MAXLABS])
+{
+	uint8_t* labels[LOCAL_ZONES_INDEX_MAXLABS];
+	/* FNV-1a over the class and the lowercased labels from the root */
+	hashvalue_type h = 2166136261u;
+	int n = 0, i;
+	h = (h ^ (dclass&0xff)) * 16777619u;
+	h = (h ^ (dclass>>8)) * 16777619u;
+	while(*name && n < LOCAL_ZONES_INDEX_MAXLABS-1) {
+		labels[n++] = name;
+		name += *name+1;
+	}
+	hs[n] = h;
+	for(i=n-1; i>=0; i--)
+		hs[i] = h = lz_index_hash_label(h, labels[i]);
+	return n;
+}
+
+/** hash a zone name and class for the zones index */
+static hashvalue_type
+lz_index_hash(uint8_t* name, uint16_t dclass)
+{
+	hashvalue_type hs[LOCAL_ZONES_INDEX_MAXLABS];
+	(void)lz_index_hashes(name, dclass, hs);
+	return hs[0];
+}
+
+/** the bits in the bloom filter of the zones index for a hash, the low
+ * bits of the hash pick the slot, so the hash is mixed for them */
+static void
+lz_index_bloom_bits(struct local_zones_index* idx, hashvalue_type h,
+	size_t* b1, size_t* b2)
+{
+	size_t mask = idx->size*4-1;
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	*b1 = h & mask;
+	*b2 = ((h >> 16) | (h << 16)) & mask;
+}
+
+/** create an empty zones index, with the slots and the bloom filter in
+ * the same allocation */
+static struct local_zones_index*
+lz_index_create(size_t size)
+{
+	struct local_zones_index* idx = (struct local_zones_index*)calloc(1,
+		sizeof(*idx) + size*sizeof(*idx->slots) + size/2);
+	if(!idx)
+		return NULL;
+	idx->size = size;
+	idx->slots = (struct local_zone**)(idx+1);
+	idx->bloom = (uint8_t*)(idx->slots+size);
+	return idx;
+}
+
+/** put a zone in a free slot of the zones index, that has room for it */
+static void
+lz_index_put(struct local_zones_index* idx, struct local_zone* z)
+{
+	size_t mask = idx->size-1;
+	size_t i = z->hash & mask, b1, b2;
+	while(idx->slots[i])
+		i = (i+1) & mask;
+	idx->slots[i] = z;
+	lz_index_bloom_bits(idx, z->hash, &b1, &b2);
+	idx->bloom[b1>>3] |= (uint8_t)(1<<(b1&7));
+	idx->bloom[b2>>3] |= (uint8_t)(1<<(b2&7));
+	idx->labs[z->namelabs>>3] |= (uint8_t)(1<<(z->namelabs&7));
+}
+
+/** create the zones index again for the zones in the tree, the new index
+ * is at most a quarter full, so that there is room to add zones. It is
+ * built aside and replaces the old index when complete, that is kept if
+ * there is no memory for the new one. */
+static int
+lz_index_rebuild(struct local_zones* zones)
+{
+	struct local_zones_index* idx;
+	struct local_zone* z;
+	size_t size = LZ_INDEX_MIN_SIZE;
+	while(size < zones->ztree.count*4)
+		size *= 2;
+	if(!(idx = lz_index_create(size))) {
+		log_err("out of memory for local zones index");
+		return 0;
+	}
+	RBTREE_FOR(z, struct local_zone*, &zones->ztree)
+		lz_index_put(idx, z);
+	free(zones->index);
+	zones->index = idx;
+	return 1;
+}
+
+/** add a zone, that was inserted in the tree, to the zones index */
+static void
+lz_index_insert(struct local_zones* zones, struct local_zone* z)
+{
+	/* grow when half full, the tree count includes the new zone */
+	if(!zones->index || zones->ztree.count*2 > zones->index->size) {
+		if(lz_index_rebuild(zones))
+			return;
+		/* the old index is used while it has a free slot, lookups
+		 * use the tree without one, and a later insert tries again */
+		if(zones->index && zones->ztree.count >= zones->index->size) {
+			free(zones->index);
+			zones->index = NULL;
+		}
+		if(!zones->index)
+			return;
+	}
+	lz_index_put(zones->index, z);
+}
+
+/** remove a zone from the zones index. Its bits in the bloom filter and
+ * label counts stay, they are cleaned up when the index is rebuilt. */
+static void
+lz_index_remove(struct local_zones* zones, struct local_zone* z)
+{
+	struct local_zones_index* idx = zones->index;
+	size_t mask, i, j, home;
+	if(!idx)
+		return;
+	mask = idx->size-1;
+	i = z->hash & mask;
+	while(idx->slots[i] != z) {
+		if(!idx->slots[i])
+			return; /* not in the index */
+		i = (i+1) & mask;
+	}
+	idx->slots[i] = NULL;
+	/* move the zones after it back, so that their probe sequence does
+	 * not have a hole in it */
+	for(j = (i+1) & mask; idx->slots[j]; j = (j+1) & mask) {
+		home = idx->slots[j]->hash & mask;
+		/* can it move to the hole at i, that is, is the home slot
+		 * not cyclically in (i, j] */
+		if((i < j && (home <= i || home > j)) ||
+			(i > j && home <= i && home > j)) {
+			idx->slots[i] = idx->slots[j];
+			idx->slots[j] = NULL;
+			i = j;
+		}
+	}
+}
+
+/** find a zone in the zones index, exact match on name and class, with
+ * the hash of the name */
+static struct local_zone*
+lz_index_find_hash(struct local_zones_index* idx, uint8_t* name, int labs,
+	uint16_t dclass, hashvalue_type h)
+{
+	size_t mask = idx->size-1;
+	size_t i, b1, b2;
+	struct local_zone* z;
+	/* no zone with this label count or hash */
+	if(labs < 0 || labs > LOCAL_ZONES_INDEX_MAXLABS ||
+		!(idx->labs[labs>>3] & (1<<(labs&7))))
+		return NULL;
+	lz_index_bloom_bits(idx, h, &b1, &b2);
+	if(!(idx->bloom[b1>>3] & (1<<(b1&7))) ||
+		!(idx->bloom[b2>>3] & (1<<(b2&7))))
+		return NULL;
+	for(i = h & mask; (z = idx->slots[i]) != NULL; i = (i+1) & mask) {
+		if(z->hash == h && z->dclass == dclass &&
+			z->namelabs == labs &&
+			query_dname_compare(z->name, name) == 0)
+			return z;
+	}
+	return NULL;
+}
+
+/** find a zone in the zones index, exact match on name and class */
+static struct local_zone*
+lz_index_find(struct local_zones_index* idx, uint8_t* name, int labs,
+	uint16_t dclass)
+{
+	return lz_index_find_hash(idx, name, labs, dclass,
+		lz_index_hash(name, dclass));
+}
+
 /* form wireformat from text format domain name */
 int
 parse_dname(const char* str, uint8_t** res, size_t* len, int* labs)
@@ -156,6 +389,7 @@ local_zone_create(uint8_t* nm, size_t len, int labs,
 	z->name = nm;
 	z->namelen = len;
 	z->namelabs = labs;
+	z->hash = lz_index_hash(nm, dclass);
 	lock_rw_init(&z->lock);
 	z->region = regional_create_nochunk(sizeof(struct regional));
 	if(!z->region) {
@@ -199,6 +433,7 @@ lz_enter_zone_dname(struct local_zones* zones, uint8_t* nm, size_t len,
 		local_zone_delete(oldz);
 		return z;
 	}
+	lz_index_insert(zones, z);
 	lock_rw_unlock(&zones->lock);
 	return z;
 }
@@ -1080,6 +1315,431 @@ lz_enter_data(struct local_zones* zones, struct config_file* cfg)
 	return 1;
 }
 
+/*
+ * The compiled local zone file, made by unbound-localzone-compile and
+ * read with the local-zone-file option. All numbers are in network format.
+ * header:	"UBLZ", u32 version, u32 number of zones, u32 number of slots,
+ *		u32 offset of slots, u32 number of zones with data,
+ *		u32 offset of data list, u32 length of the file,
+ *		u32 checksum of the file after the header.
+ * slots:	u32 offset of a zone record, or 0. This is the hash table,
+ *		with linear probing, of the zones without local data. It is
+ *		used for lookups straight from the mapped file.
+ * data list:	u32 offset of a zone record, for every zone with local data.
+ *		These zones are entered in the zone tree when the file is read.
+ * zone record:	u32 hash, u16 class, u8 type, u8 labels, u8 name length,
+ *		name, and for zones with data, u32 number of RRs and the RRs:
+ *		u8 owner length, owner, u16 type, u16 class, u32 ttl,
+ *		u16 rdata length, rdata.
+ */
+
+/** checksum of the compiled local zone file, FNV-1a over the bytes */
+static uint32_t
+lz_file_checksum(uint8_t* p, size_t len)
+{
+	uint32_t h = 2166136261u;
+	while(len--)
+		h = (h ^ *p++) * 16777619u;
+	return h;
+}
+
+/** get the zone record at offset in the compiled local zone file, checks
+ * that it fits in the file, returns NULL if it is malformed */
+static uint8_t*
+lz_file_zone(struct local_zones* zones, uint32_t off, size_t* namelen)
+{
+	uint8_t* rec;
+	if(off < LZ_FILE_HEADER_SIZE ||
+		(size_t)off + LZ_FILE_ZONE_SIZE > zones->file_len)
+		return NULL;
+	rec = zones->file_map + off;
+	*namelen = rec[8];
+	if((size_t)off + LZ_FILE_ZONE_SIZE + *namelen > zones->file_len ||
+		dname_valid(rec+LZ_FILE_ZONE_SIZE, *namelen) != *namelen)
+		return NULL;
+	if(rec[6] == local_zone_unset || rec[6] == local_zone_nodefault ||
+		rec[6] >= local_zone_invalid)
+		return NULL;
+	if(rec[7] != dname_count_labels(rec+LZ_FILE_ZONE_SIZE) ||
+		sldns_read_uint32(rec) != lz_index_hash(rec+LZ_FILE_ZONE_SIZE,
+		sldns_read_uint16(rec+4)))
+		return NULL;
+	return rec;
+}
+
+/** check the hash table of the compiled local zone file, every zone
+ * record in it is checked once, so that lookups can trust the file */
+static int
+lz_file_check_slots(struct local_zones* zones)
+{
+	size_t slots = sldns_read_uint32(zones->file_map+12);
+	uint8_t* tab = zones->file_map + sldns_read_uint32(zones->file_map+16);
+	size_t i, nmlen, used = 0;
+	uint32_t off;
+	for(i=0; i<slots; i++) {
+		if((off = sldns_read_uint32(tab+i*4)) == 0)
+			continue;
+		if(!lz_file_zone(zones, off, &nmlen))
+			return 0;
+		used++;
+	}
+	/* the probes stop at an empty slot */
+	return (used < slots);
+}
+
+/** find the closest enclosing zone for the name in the hash table of the
+ * compiled local zone file. The zone is returned in z, its name points
+ * into the file and it has no local data. */
+static int
+lz_file_lookup(struct local_zones* zones, uint8_t* name, size_t len,
+	int labs, uint16_t dclass, uint16_t dtype, struct local_zone* z)
+{
+	size_t slots = sldns_read_uint32(zones->file_map+12);
+	uint8_t* tab = zones->file_map + sldns_read_uint32(zones->file_map+16);
+	uint8_t* rec;
+	size_t i, n, nmlen;
+	uint32_t off;
+	hashvalue_type h, hs[LOCAL_ZONES_INDEX_MAXLABS];
+	int lab = 0;
+	/* for type DS use a zone higher when on a zonecut */
+	if(dtype == LDNS_RR_TYPE_DS && !dname_is_root(name)) {
+		dname_remove_label(&name, &len);
+		labs--;
+	}
+	(void)lz_index_hashes(name, dclass, hs);
+	while(1) {
+		h = hs[lab++];
+		for(i = h&(slots-1), n = 0; n < slots; i = (i+1)&(slots-1), n++) {
+			/* the records were checked when the file was read */
+			if((off = sldns_read_uint32(tab+i*4)) == 0)
+				break;
+			rec = zones->file_map + off;
+			nmlen = rec[8];
+			if(sldns_read_uint32(rec) == h &&
+				sldns_read_uint16(rec+4) == dclass &&
+				rec[7] == labs &&
+				query_dname_compare(rec+LZ_FILE_ZONE_SIZE,
+				name) == 0) {
+				memset(z, 0, sizeof(*z));
+				z->name = rec+LZ_FILE_ZONE_SIZE;
+				z->namelen = nmlen;
+				z->namelabs = labs;
+				z->dclass = dclass;
+				z->type = (enum localzone_type)rec[6];
+				rbtree_init(&z->data, &local_data_cmp);
+				return 1;
+			}
+		}
+		if(dname_is_root(name))
+			return 0;
+		dname_remove_label(&name, &len);
+		labs--;
+	}
+}
+
+/** enter a zone with local data from the compiled local zone file into
+ * the zone tree */
+static int
+lz_enter_file_zone(struct local_zones* zones, uint32_t off)
+{
+	uint8_t* end = zones->file_map + zones->file_len;
+	uint8_t* rec, *p, *nm, *owner;
+	size_t nmlen, ownerlen, rdlen;
+	uint32_t i, rrnum;
+	uint16_t dclass;
+	struct local_zone* z;
+	if(!(rec = lz_file_zone(zones, off, &nmlen)))
+		return 0;
+	dclass = sldns_read_uint16(rec+4);
+	p = rec + LZ_FILE_ZONE_SIZE + nmlen;
+	if(end - p < 4)
+		return 0;
+	rrnum = sldns_read_uint32(p);
+	p += 4;
+	/* a local-zone from the config file takes precedence */
+	lock_rw_rdlock(&zones->lock);
+	z = local_zones_find(zones, rec+LZ_FILE_ZONE_SIZE, nmlen, rec[7],
+		dclass);
+	lock_rw_unlock(&zones->lock);
+	if(z)
+		return 1;
+	if(!(nm = memdup(rec+LZ_FILE_ZONE_SIZE, nmlen))) {
+		log_err("out of memory");
+		return 0;
+	}
+	if(!(z = lz_enter_zone_dname(zones, nm, nmlen, rec[7],
+		(enum localzone_type)rec[6], dclass)))
+		return 0;
+	for(i=0; i<rrnum; i++) {
+		if(end - p < 1)
+			break;
+		ownerlen = *p++;
+		if((size_t)(end - p) < ownerlen + 10 ||
+			dname_valid(p, ownerlen) != ownerlen)
+			break;
+		owner = p;
+		p += ownerlen;
+		rdlen = sldns_read_uint16(p+8) + 2;
+		if((size_t)(end - (p+8)) < rdlen)
+			break;
+		if(!local_zone_enter_rr(z, owner, ownerlen,
+			dname_count_labels(owner), sldns_read_uint16(p),
+			sldns_read_uint16(p+2), (time_t)sldns_read_uint32(p+4),
+			p+8, rdlen, "local-zone-file data"))
+			break;
+		p += 8 + rdlen;
+	}
+	lock_rw_unlock(&z->lock);
+	return (i == rrnum);
+}
+
+/** map the compiled local zone file into memory, read-only.  It is a
+ * private mapping, the file is replaced with a write to a new file and a
+ * rename, like unbound-localzone-compile does, and not changed in place */
+static int
+lz_map_file(struct local_zones* zones, const char* fname)
+{
+	struct stat st;
+	uint8_t* map;
+	int fd = open(fname, O_RDONLY);
+	if(fd == -1) {
+		log_err("could not open local-zone-file %s: %s", fname,
+			strerror(errno));
+		return 0;
+	}
+	if(fstat(fd, &st) != 0) {
+		log_err("could not stat local-zone-file %s: %s", fname,
+			strerror(errno));
+		close(fd);
+		return 0;
+	}
+	if(st.st_size < LZ_FILE_HEADER_SIZE ||
+		(uint64_t)st.st_size > (uint64_t)0xffffffff) {
+		log_err("local-zone-file %s: bad file size", fname);
+		close(fd);
+		return 0;
+	}
+#ifndef USE_WINSOCK
+	map = (uint8_t*)mmap(NULL, (size_t)st.st_size, PROT_READ,
+		MAP_PRIVATE, fd, 0);
+	if(map == (uint8_t*)MAP_FAILED) {
+		log_err("could not mmap local-zone-file %s: %s", fname,
+			strerror(errno));
+		close(fd);
+		return 0;
+	}
+#else
+	map = (uint8_t*)malloc((size_t)st.st_size);
+	if(!map || read(fd, map, (size_t)st.st_size) != (ssize_t)st.st_size) {
+		log_err("could not read local-zone-file %s", fname);
+		free(map);
+		close(fd);
+		return 0;
+	}
+#endif
+	close(fd);
+	zones->file_map = map;
+	zones->file_len = (size_t)st.st_size;
+	return 1;
+}
+
+/** read the compiled local zone file, the zones with local data are
+ * entered in the zone tree, the others are looked up in the file */
+static int
+lz_enter_file(struct local_zones* zones, struct config_file* cfg)
+{
+	char* fname = cfg->local_zone_file;
+	uint8_t* map;
+	size_t len, slots, slots_off, datanum, data_off, i;
+	if(!fname || fname[0] == 0)
+		return 1;
+	if(cfg->chrootdir && cfg->chrootdir[0] && strncmp(fname,
+		cfg->chrootdir, strlen(cfg->chrootdir)) == 0)
+		fname += strlen(cfg->chrootdir);
+	if(!lz_map_file(zones, fname))
+		return 0;
+	map = zones->file_map;
+	len = zones->file_len;
+	slots = sldns_read_uint32(map+12);
+	slots_off = sldns_read_uint32(map+16);
+	datanum = sldns_read_uint32(map+20);
+	data_off = sldns_read_uint32(map+24);
+	if(memcmp(map, LZ_FILE_MAGIC, 4) != 0 ||
+		sldns_read_uint32(map+4) != LZ_FILE_VERSION) {
+		log_err("local-zone-file %s: not a compiled local zone file "
+			"of version %d", fname, LZ_FILE_VERSION);
+		return 0;
+	}
+	if(sldns_read_uint32(map+28) != len ||
+		sldns_read_uint32(map+32) != lz_file_checksum(
+		map+LZ_FILE_HEADER_SIZE, len-LZ_FILE_HEADER_SIZE)) {
+		log_err("local-zone-file %s: bad file length or checksum, "
+			"the file is truncated or changed", fname);
+		return 0;
+	}
+	if(slots == 0 || (slots&(slots-1)) != 0 ||
+		slots_off < LZ_FILE_HEADER_SIZE || slots_off + slots*4 > len ||
+		data_off < LZ_FILE_HEADER_SIZE || data_off + datanum*4 > len) {
+		log_err("local-zone-file %s: malformed header", fname);
+		return 0;
+	}
+	if(!lz_file_check_slots(zones)) {
+		log_err("local-zone-file %s: malformed zone", fname);
+		return 0;
+	}
+	for(i=0; i<datanum; i++) {
+		if(!lz_enter_file_zone(zones,
+			sldns_read_uint32(map+data_off+i*4))) {
+			log_err("local-zone-file %s: malformed zone with data",
+				fname);
+			return 0;
+		}
+	}
+	verbose(VERB_ALGO, "local-zone-file %s: %u zones, %u with data",
+		fname, (unsigned)sldns_read_uint32(map+8), (unsigned)datanum);
+	return 1;
+}
+
+/** write a zone record for the compiled local zone file to the buffer */
+static int
+lz_write_file_zone(sldns_buffer* buf, struct local_zone* z, size_t slots_off,
+	size_t slots, size_t data_off, size_t* dataidx)
+{
+	size_t off = sldns_buffer_position(buf), rrnum_at, i;
+	uint32_t rrnum = 0;
+	struct local_data* ld;
+	struct local_rrset* p;
+	struct packed_rrset_data* d;
+	if(!sldns_buffer_reserve(buf, LZ_FILE_ZONE_SIZE + z->namelen + 4))
+		return 0;
+	sldns_buffer_write_u32(buf, z->hash);
+	sldns_buffer_write_u16(buf, z->dclass);
+	sldns_buffer_write_u8(buf, (uint8_t)z->type);
+	sldns_buffer_write_u8(buf, (uint8_t)z->namelabs);
+	sldns_buffer_write_u8(buf, (uint8_t)z->namelen);
+	sldns_buffer_write(buf, z->name, z->namelen);
+	if(z->data.count == 0) {
+		/* into the hash table, it is at most half full */
+		i = z->hash & (slots-1);
+		while(sldns_read_uint32(sldns_buffer_at(buf, slots_off+i*4)))
+			i = (i+1) & (slots-1);
+		sldns_buffer_write_u32_at(buf, slots_off+i*4, (uint32_t)off);
+		return 1;
+	}
+	sldns_buffer_write_u32_at(buf, data_off+(*dataidx)*4, (uint32_t)off);
+	(*dataidx)++;
+	rrnum_at = sldns_buffer_position(buf);
+	sldns_buffer_write_u32(buf, 0);
+	RBTREE_FOR(ld, struct local_data*, &z->data) {
+		for(p = ld->rrsets; p; p = p->next) {
+			d = (struct packed_rrset_data*)p->rrset->entry.data;
+			for(i=0; i<d->count; i++) {
+				if(!sldns_buffer_reserve(buf, 1 + ld->namelen +
+					8 + d->rr_len[i]))
+					return 0;
+				sldns_buffer_write_u8(buf, (uint8_t)ld->namelen);
+				sldns_buffer_write(buf, ld->name, ld->namelen);
+				sldns_buffer_write_u16(buf,
+					ntohs(p->rrset->rk.type));
+				sldns_buffer_write_u16(buf,
+					ntohs(p->rrset->rk.rrset_class));
+				sldns_buffer_write_u32(buf,
+					(uint32_t)d->rr_ttl[i]);
+				sldns_buffer_write(buf, d->rr_data[i],
+					d->rr_len[i]);
+				rrnum++;
+			}
+		}
+	}
+	sldns_buffer_write_u32_at(buf, rrnum_at, rrnum);
+	return 1;
+}
+
+int
+local_zones_write_file(struct local_zones* zones, const char* fname)
+{
+	struct local_zone* z;
+	sldns_buffer* buf;
+	size_t num = 0, datanum = 0, dataidx = 0, slots = LZ_INDEX_MIN_SIZE;
+	size_t slots_off = LZ_FILE_HEADER_SIZE, data_off, len;
+	char tmpf[1024];
+	FILE* out;
+	int ok = 1;
+
+	lock_rw_rdlock(&zones->lock);
+	RBTREE_FOR(z, struct local_zone*, &zones->ztree) {
+		num++;
+		if(z->data.count != 0)
+			datanum++;
+	}
+	while(slots < (num-datanum)*2)
+		slots *= 2;
+	data_off = slots_off + slots*4;
+	if(!(buf = sldns_buffer_new(data_off + datanum*4 + 1024))) {
+		lock_rw_unlock(&zones->lock);
+		log_err("out of memory");
+		return 0;
+	}
+	memset(sldns_buffer_begin(buf), 0, data_off + datanum*4);
+	sldns_buffer_skip(buf, (ssize_t)(data_off + datanum*4));
+	RBTREE_FOR(z, struct local_zone*, &zones->ztree) {
+		lock_rw_rdlock(&z->lock);
+		ok = lz_write_file_zone(buf, z, slots_off, slots, data_off,
+			&dataidx);
+		lock_rw_unlock(&z->lock);
+		if(!ok)
+			break;
+	}
+	lock_rw_unlock(&zones->lock);
+	len = sldns_buffer_position(buf);
+	if(!ok || len > (size_t)0xffffffff) {
+		log_err("%s: %s", fname, ok?"file too large":"out of memory");
+		sldns_buffer_free(buf);
+		return 0;
+	}
+	sldns_buffer_write_at(buf, 0, LZ_FILE_MAGIC, 4);
+	sldns_buffer_write_u32_at(buf, 4, LZ_FILE_VERSION);
+	sldns_buffer_write_u32_at(buf, 8, (uint32_t)num);
+	sldns_buffer_write_u32_at(buf, 12, (uint32_t)slots);
+	sldns_buffer_write_u32_at(buf, 16, (uint32_t)slots_off);
+	sldns_buffer_write_u32_at(buf, 20, (uint32_t)datanum);
+	sldns_buffer_write_u32_at(buf, 24, (uint32_t)data_off);
+	sldns_buffer_write_u32_at(buf, 28, (uint32_t)len);
+	sldns_buffer_write_u32_at(buf, 32, lz_file_checksum(
+		sldns_buffer_at(buf, LZ_FILE_HEADER_SIZE),
+		len-LZ_FILE_HEADER_SIZE));
+
+	snprintf(tmpf, sizeof(tmpf), "%s.%u", fname, (unsigned)getpid());
+	if(!(out = fopen(tmpf, "wb"))) {
+		log_err("could not open %s: %s", tmpf, strerror(errno));
+		sldns_buffer_free(buf);
+		return 0;
+	}
+	if(fwrite(sldns_buffer_begin(buf), 1, len, out) != len) {
+		log_err("could not write %s: %s", tmpf, strerror(errno));
+		fclose(out);
+		unlink(tmpf);
+		sldns_buffer_free(buf);
+		return 0;
+	}
+	sldns_buffer_free(buf);
+	if(fclose(out) != 0) {
+		log_err("could not complete write %s: %s", tmpf,
+			strerror(errno));
+		unlink(tmpf);
+		return 0;
+	}
+#ifdef UB_ON_WINDOWS
+	(void)unlink(fname); /* windows does not replace file with rename() */
+#endif
+	if(rename(tmpf, fname) < 0) {
+		log_err("rename(%s to %s): %s", tmpf, fname, strerror(errno));
+		unlink(tmpf);
+		return 0;
+	}
+	return 1;
+}
+
 /** free memory from config */
 static void
 lz_freeup_cfg(struct config_file* cfg)
@@ -1099,6 +1759,10 @@ local_zones_apply_cfg(struct local_zones* zones, struct config_file* cfg)
 	if(!lz_enter_zones(zones, cfg)) {
 		return 0;
 	}
+	/* map the compiled zones, the config file zones take precedence */
+	if(!lz_enter_file(zones, cfg)) {
+		return 0;
+	}
 	/* apply default zones+content (unless disabled, or overridden) */
 	if(!local_zone_enter_defaults(zones, cfg)) {
 		return 0;
@@ -1149,19 +1813,35 @@ local_zones_tags_lookup(struct local_zones* zones,
 		dname_remove_label(&name, &len);
 		labs--;
 	}
-	key.node.key = &key;
-	key.dclass = dclass;
-	key.name = name;
-	key.namelen = len;
-	key.namelabs = labs;
-	rbtree_find_less_equal(&zones->ztree, &key, &res);
-	result = (struct local_zone*)res;
-	/* exact or smaller element (or no element) */
-	if(!result || result->dclass != dclass)
-		return NULL;
-	/* count number of labels matched */
-	(void)dname_lab_cmp(result->name, result->namelabs, key.name,
-		key.namelabs, &m);
+	if(zones->index) {
+		hashvalue_type hs[LOCAL_ZONES_INDEX_MAXLABS];
+		int i = 0;
+		(void)lz_index_hashes(name, dclass, hs);
+		/* the closest enclosing zone, from the name up to the root */
+		while(!(result=lz_index_find_hash(zones->index, name, labs,
+			dclass, hs[i]))) {
+			if(dname_is_root(name))
+				return NULL;
+			dname_remove_label(&name, &len);
+			labs--;
+			i++;
+		}
+		m = labs;
+	} else {
+		key.node.key = &key;
+		key.dclass = dclass;
+		key.name = name;
+		key.namelen = len;
+		key.namelabs = labs;
+		rbtree_find_less_equal(&zones->ztree, &key, &res);
+		result = (struct local_zone*)res;
+		/* exact or smaller element (or no element) */
+		if(!result || result->dclass != dclass)
+			return NULL;
+		/* count number of labels matched */
+		(void)dname_lab_cmp(result->name, result->namelabs, key.name,
+			key.namelabs, &m);
+	}
 	while(result) { /* go up until qname is zone or subdomain of zone */
 		if(result->namelabs <= m)
 			if(ignoretags || !result->taglist ||
@@ -1178,6 +1858,8 @@ local_zones_find(struct local_zones* zones,
         uint8_t* name, size_t len, int labs, uint16_t dclass)
 {
 	struct local_zone key;
+	if(zones->index)
+		return lz_index_find(zones->index, name, labs, dclass);
 	key.node.key = &key;
 	key.dclass = dclass;
 	key.name = name;
@@ -1287,100 +1969,88 @@ local_error_encode(struct query_info* qinfo, struct module_env* env,
 		sldns_buffer_read_u16_at(buf, 2), edns);
 }
 
-/** find local data tag string match for the given type in the list */
 int
-local_data_find_tag_datas(const struct query_info* qinfo,
-	struct config_strlist* list, struct ub_packed_rrset_key* r,
-	struct regional* temp)
+local_data_add_tag_data(struct regional* region, struct local_rrset** list,
+	const char* data)
 {
-	struct config_strlist* p;
 	char buf[65536];
 	uint8_t rr[LDNS_RR_BUF_SIZE];
-	size_t len;
-	int res;
-	struct packed_rrset_data* d;
-	for(p=list; p; p=p->next) {
-		uint16_t rdr_type;
-
-		len = sizeof(rr);
-		/* does this element match the type? */
-		snprintf(buf, sizeof(buf), ". %s", p->str);
-		res = sldns_str2wire_rr_buf(buf, rr, &len, NULL, 3600,
-			NULL, 0, NULL, 0);
-		if(res != 0)
-			/* parse errors are already checked before, in
-			 * acllist check_data, skip this for robustness */
-			continue;
-		if(len < 1 /* . */ + 8 /* typeclassttl*/ + 2 /*rdatalen*/)
-			continue;
-		rdr_type = sldns_wirerr_get_type(rr, len, 1);
-		if(rdr_type != qinfo->qtype && rdr_type != LDNS_RR_TYPE_CNAME)
-			continue;
-		
-		/* do we have entries already? if not setup key */
-		if(r->rk.dname == NULL) {
-			r->entry.key = r;
-			r->rk.dname = qinfo->qname;
-			r->rk.dname_len = qinfo->qname_len;
-			r->rk.type = htons(rdr_type);
-			r->rk.rrset_class = htons(qinfo->qclass);
-			r->rk.flags = 0;
-			d = (struct packed_rrset_data*)regional_alloc_zero(
-				temp, sizeof(struct packed_rrset_data)
-				+ sizeof(size_t) + sizeof(uint8_t*) +
-				sizeof(time_t));
-			if(!d) return 0; /* out of memory */
-			r->entry.data = d;
-			d->ttl = sldns_wirerr_get_ttl(rr, len, 1);
-			d->rr_len = (size_t*)((uint8_t*)d +
-				sizeof(struct packed_rrset_data));
-			d->rr_data = (uint8_t**)&(d->rr_len[1]);
-			d->rr_ttl = (time_t*)&(d->rr_data[1]);
+	uint8_t* nm, *rdata;
+	uint16_t rrtype, rrclass;
+	time_t ttl;
+	size_t rdata_len;
+	struct local_rrset* p;
+	struct packed_rrset_data* pd;
+	/* the owner name is replaced with the qname when it is used */
+	snprintf(buf, sizeof(buf), ". %s", data);
+	if(!rrstr_get_rr_content(buf, &nm, &rrtype, &rrclass, &ttl, rr,
+		sizeof(rr), &rdata, &rdata_len))
+		return 0;
+	free(nm);
+	for(p = *list; p; p = p->next) {
+		if(p->rrset->rk.type == htons(rrtype))
+			break;
+	}
+	if(!p) {
+		p = (struct local_rrset*)regional_alloc_zero(region,
+			sizeof(*p));
+		if(!p) {
+			log_err("out of memory");
+			return 0;
 		}
-		d = (struct packed_rrset_data*)r->entry.data;
-		/* add entry to the data */
-		if(d->count != 0) {
-			size_t* oldlen = d->rr_len;
-			uint8_t** olddata = d->rr_data;
-			time_t* oldttl = d->rr_ttl;
-			/* increase arrays for lookup */
-			/* this is of course slow for very many records,
-			 * but most redirects are expected with few records */
-			d->rr_len = (size_t*)regional_alloc_zero(temp,
-				(d->count+1)*sizeof(size_t));
-			d->rr_data = (uint8_t**)regional_alloc_zero(temp,
-				(d->count+1)*sizeof(uint8_t*));
-			d->rr_ttl = (time_t*)regional_alloc_zero(temp,
-				(d->count+1)*sizeof(time_t));
-			if(!d->rr_len || !d->rr_data || !d->rr_ttl)
-				return 0; /* out of memory */
-			/* first one was allocated after struct d, but new
-			 * ones get their own array increment alloc, so
-			 * copy old content */
-			memmove(d->rr_len, oldlen, d->count*sizeof(size_t));
-			memmove(d->rr_data, olddata, d->count*sizeof(uint8_t*));
-			memmove(d->rr_ttl, oldttl, d->count*sizeof(time_t));
+		p->rrset = (struct ub_packed_rrset_key*)regional_alloc_zero(
+			region, sizeof(*p->rrset));
+		pd = (struct packed_rrset_data*)regional_alloc_zero(region,
+			sizeof(*pd));
+		if(!p->rrset || !pd) {
+			log_err("out of memory");
+			return 0;
 		}
+		pd->trust = rrset_trust_prim_noglue;
+		pd->security = sec_status_insecure;
+		pd->ttl = ttl;
+		p->rrset->entry.key = p->rrset;
+		p->rrset->entry.data = pd;
+		p->rrset->rk.dname = (uint8_t*)"\000";
+		p->rrset->rk.dname_len = 1;
+		p->rrset->rk.type = htons(rrtype);
+		p->rrset->rk.rrset_class = htons(rrclass);
+		p->next = *list;
+		*list = p;
+	}
+	pd = (struct packed_rrset_data*)p->rrset->entry.data;
+	if(ttl < pd->ttl)
+		pd->ttl = ttl;
+	return rrset_insert_rr(region, pd, rdata, rdata_len, ttl, data);
+}
 
-		d->rr_len[d->count] = sldns_wirerr_get_rdatalen(rr, len, 1)+2;
-		d->rr_ttl[d->count] = sldns_wirerr_get_ttl(rr, len, 1);
-		d->rr_data[d->count] = regional_alloc_init(temp,
-			sldns_wirerr_get_rdatawl(rr, len, 1),
-			d->rr_len[d->count]);
-		if(!d->rr_data[d->count])
-			return 0; /* out of memory */
-		d->count++;
+int
+local_data_find_tag_datas(const struct query_info* qinfo,
+	struct local_rrset* list, struct ub_packed_rrset_key* r)
+{
+	struct local_rrset* p;
+	for(p = list; p; p = p->next) {
+		if(p->rrset->rk.type == htons(qinfo->qtype) ||
+			p->rrset->rk.type == htons(LDNS_RR_TYPE_CNAME))
+			break;
 	}
-	if(r->rk.dname)
-		return 1;
-	return 0;
+	if(!p)
+		return 0;
+	r->entry.key = r;
+	r->entry.data = p->rrset->entry.data;
+	r->rk.dname = qinfo->qname;
+	r->rk.dname_len = qinfo->qname_len;
+	r->rk.type = p->rrset->rk.type;
+	r->rk.rrset_class = htons(qinfo->qclass);
+	r->rk.flags = 0;
+	return 1;
 }
 
 static int
-find_tag_datas(struct query_info* qinfo, struct config_strlist* list,
+find_tag_datas(struct query_info* qinfo, struct local_rrset* list,
 	struct ub_packed_rrset_key* r, struct regional* temp)
 {
-	int result = local_data_find_tag_datas(qinfo, list, r, temp);
+	int result = local_data_find_tag_datas(qinfo, list, r);
 
 	/* If we've found a non-exact alias type of local data, make a shallow
 	 * copy of the RRset and remember it in qinfo to complete the alias
@@ -1404,7 +2074,7 @@ local_data_answer(struct local_zone* z, struct module_env* env,
 	struct query_info* qinfo, struct edns_data* edns,
 	struct comm_reply* repinfo, sldns_buffer* buf,
 	struct regional* temp, int labs, struct local_data** ldp,
-	enum localzone_type lz_type, int tag, struct config_strlist** tag_datas,
+	enum localzone_type lz_type, int tag, struct local_rrset** tag_datas,
 	size_t tag_datas_size, char** tagname, int num_tags)
 {
 	struct local_data key;
@@ -1732,20 +2402,53 @@ local_data_find_tag_action(const uint8_t* taglist, size_t taglen,
 	return lzt;
 }
 
+/** answer the query from the local zone that was found for it, returns 1
+ * if the reply was encoded in the buffer */
+static int
+local_zones_answer_zone(struct local_zone* z, struct module_env* env,
+	struct query_info* qinfo, struct edns_data* edns, sldns_buffer* buf,
+	struct regional* temp, struct comm_reply* repinfo, int labs,
+	enum localzone_type lzt, int tag, struct local_rrset** tag_datas,
+	size_t tag_datas_size, char** tagname, int num_tags)
+{
+	struct local_data* ld = NULL;
+	int r;
+	if((env->cfg->log_local_actions ||
+			lzt == local_zone_inform ||
+			lzt == local_zone_inform_deny ||
+			lzt == local_zone_inform_redirect)
+			&& repinfo)
+		lz_inform_print(z, qinfo, repinfo);
+
+	if(lzt != local_zone_always_refuse
+		&& lzt != local_zone_always_transparent
+		&& lzt != local_zone_always_nxdomain
+		&& lzt != local_zone_always_nodata
+		&& lzt != local_zone_always_deny
+		&& local_data_answer(z, env, qinfo, edns, repinfo, buf, temp, labs,
+			&ld, lzt, tag, tag_datas, tag_datas_size, tagname, num_tags)) {
+		/* We should tell the caller that encode is deferred if we found
+		 * a local alias. */
+		return !qinfo->local_alias;
+	}
+	r = local_zones_zone_answer(z, env, qinfo, edns, repinfo, buf, temp, ld, lzt);
+	return r && !qinfo->local_alias; /* see above */
+}
+
 int 
 local_zones_answer(struct local_zones* zones, struct module_env* env,
 	struct query_info* qinfo, struct edns_data* edns, sldns_buffer* buf,
 	struct regional* temp, struct comm_reply* repinfo, uint8_t* taglist,
 	size_t taglen, uint8_t* tagactions, size_t tagactionssize,
-	struct config_strlist** tag_datas, size_t tag_datas_size,
+	struct local_rrset** tag_datas, size_t tag_datas_size,
 	char** tagname, int num_tags, struct view* view)
 {
 	/* see if query is covered by a zone,
 	 * 	if so:	- try to match (exact) local data 
 	 * 		- look at zone type for negative response. */
 	int labs = dname_count_labels(qinfo->qname);
-	struct local_data* ld = NULL;
 	struct local_zone* z = NULL;
+	struct local_zone filez;
 	enum localzone_type lzt = local_zone_transparent;
 	int r, tag = -1;
 
@@ -1785,9 +2488,27 @@ local_zones_answer(struct local_zones* zones, struct module_env* env,
 	if(!z) {
 		/* try global local_zones tree */
 		lock_rw_rdlock(&zones->lock);
-		if(!(z = local_zones_tags_lookup(zones, qinfo->qname,
+		z = local_zones_tags_lookup(zones, qinfo->qname,
 			qinfo->qname_len, labs, qinfo->qclass, qinfo->qtype,
-			taglist, taglen, 0))) {
+			taglist, taglen, 0);
+		/* the compiled zones from the local-zone-file, a zone from
+		 * the tree takes precedence if it is as close to the qname */
+		if(zones->file_map && lz_file_lookup(zones, qinfo->qname,
+			qinfo->qname_len, labs, qinfo->qclass, qinfo->qtype,
+			&filez) && (!z || filez.namelabs > z->namelabs)) {
+			lock_rw_unlock(&zones->lock);
+			if(verbosity >= VERB_ALGO) {
+				char zname[255+1];
+				dname_str(filez.name, zname);
+				verbose(VERB_ALGO, "using localzone %s %s from "
+					"local-zone-file", zname,
+					local_zone_type2str(filez.type));
+			}
+			return local_zones_answer_zone(&filez, env, qinfo,
+				edns, buf, temp, repinfo, labs, filez.type, tag,
+				tag_datas, tag_datas_size, tagname, num_tags);
+		}
+		if(!z) {
 			lock_rw_unlock(&zones->lock);
 			return 0;
 		}
@@ -1803,28 +2524,10 @@ local_zones_answer(struct local_zones* zones, struct module_env* env,
 				local_zone_type2str(lzt));
 		}
 	}
-	if((env->cfg->log_local_actions ||
-			lzt == local_zone_inform ||
-			lzt == local_zone_inform_deny ||
-			lzt == local_zone_inform_redirect)
-			&& repinfo)
-		lz_inform_print(z, qinfo, repinfo);
-
-	if(lzt != local_zone_always_refuse
-		&& lzt != local_zone_always_transparent
-		&& lzt != local_zone_always_nxdomain
-		&& lzt != local_zone_always_nodata
-		&& lzt != local_zone_always_deny
-		&& local_data_answer(z, env, qinfo, edns, repinfo, buf, temp, labs,
-			&ld, lzt, tag, tag_datas, tag_datas_size, tagname, num_tags)) {
-		lock_rw_unlock(&z->lock);
-		/* We should tell the caller that encode is deferred if we found
-		 * a local alias. */
-		return !qinfo->local_alias;
-	}
-	r = local_zones_zone_answer(z, env, qinfo, edns, repinfo, buf, temp, ld, lzt);
+	r = local_zones_answer_zone(z, env, qinfo, edns, buf, temp, repinfo,
+		labs, lzt, tag, tag_datas, tag_datas_size, tagname, num_tags);
 	lock_rw_unlock(&z->lock);
-	return r && !qinfo->local_alias; /* see above */
+	return r;
 }
 
 const char* local_zone_type2str(enum localzone_type t)
@@ -1942,6 +2645,7 @@ struct local_zone* local_zones_add_zone(struct local_zones* zones,
 		log_err("internal: duplicate entry in local_zones_add_zone");
 		return NULL;
 	}
+	lz_index_insert(zones, z);
 
 	/* set parent pointers right */
 	set_kiddo_parents(z, z->parent, z);
@@ -1958,6 +2662,7 @@ void local_zones_del_zone(struct local_zones* zones, struct local_zone* z)
 
 	/* remove from tree */
 	(void)rbtree_delete(&zones->ztree, z);
+	lz_index_remove(zones, z);
 
 	/* delete the zone */
 	lock_rw_unlock(&z->lock);
@@ -105,6 +105,27 @@ enum localzone_type {
 	local_zone_invalid
 };
 
+/** the maximum number of labels of a zone name, with the root label */
+#define LOCAL_ZONES_INDEX_MAXLABS 128
+
+/**
+ * Hash index of the local zones, by name and class, with open addressing.
+ * It is allocated in one piece, built aside and then put in place.
+ */
+struct local_zones_index {
+	/** number of slots, a power of 2 */
+	size_t size;
+	/** the slots, NULL if empty */
+	struct local_zone** slots;
+	/** bloom filter of the hashes of the zones, size*4 bits, with
+	 * two bits per zone, a suffix of the name that is not in it is
+	 * not looked up in the slots */
+	uint8_t* bloom;
+	/** bit for every label count that has zones, a suffix of the
+	 * name with a label count that has no zones is skipped */
+	uint8_t labs[LOCAL_ZONES_INDEX_MAXLABS/8+1];
+};
+
 /**
  * Authoritative local zones storage, shared.
  */
@@ -113,6 +134,17 @@ struct local_zones {
 	lock_rw_type lock;
 	/** rbtree of struct local_zone */
 	rbtree_type ztree;
+	/** hash index of the zones in the ztree. The closest enclosing
+	 * zone is found with a hash lookup for the suffixes of the name,
+	 * instead of a tree walk. NULL if it could not be allocated, then
+	 * the ztree is used. */
+	struct local_zones_index* index;
+	/** compiled local zones from the local-zone-file, mapped in memory
+	 * read-only, or NULL. The zones without local data are looked up
+	 * in the hash table in the file itself. */
+	uint8_t* file_map;
+	/** length of the file_map */
+	size_t file_len;
 };
 
 /**
@@ -133,6 +165,8 @@ struct local_zone {
 	/** the class of this zone. 
 	 * uses 'dclass' to not conflict with c++ keyword class. */
 	uint16_t dclass;
+	/** hash of the name and class, for the zones index */
+	hashvalue_type hash;
 
 	/** lock on the data in the structure
 	 * For the node, parent, name, namelen, namelabs, dclass, you
@@ -222,6 +256,18 @@ void local_zones_delete(struct local_zones* zones);
  */
 int local_zones_apply_cfg(struct local_zones* zones, struct config_file* cfg);
 
+/**
+ * Write the local zones and their local data to a compiled local zone
+ * file, that can be loaded with the local-zone-file option. The file is
+ * written under a temporary name and then renamed into place, so that
+ * a running server that has the old file mapped is not affected.
+ * Takes care of locking.
+ * @param zones: the local zones to write.
+ * @param fname: name of the output file.
+ * @return false on error, the error is logged.
+ */
+int local_zones_write_file(struct local_zones* zones, const char* fname);
+
 /**
  * Compare two local_zone entries in rbtree. Sort hierarchical but not
  * canonical
@@ -300,7 +346,7 @@ void local_zones_print(struct local_zones* zones);
  * @param taglen: length of the taglist.
  * @param tagactions: local zone actions for tags. May be NULL.
  * @param tagactionssize: length of the tagactions.
- * @param tag_datas: array per tag of strlist with rdata strings. or NULL.
+ * @param tag_datas: array per tag of the tag data rrsets. or NULL.
  * @param tag_datas_size: size of tag_datas array.
  * @param tagname: array of tag name strings (for debug output).
  * @param num_tags: number of items in tagname array.
@@ -321,7 +367,7 @@ int local_zones_answer(struct local_zones* zones, struct module_env* env,
 	struct query_info* qinfo, struct edns_data* edns, struct sldns_buffer* buf,
 	struct regional* temp, struct comm_reply* repinfo, uint8_t* taglist,
 	size_t taglen, uint8_t* tagactions, size_t tagactionssize,
-	struct config_strlist** tag_datas, size_t tag_datas_size,
+	struct local_rrset** tag_datas, size_t tag_datas_size,
 	char** tagname, int num_tags, struct view* view);
 
 /** 
@@ -447,18 +493,27 @@ void local_zones_del_data(struct local_zones* zones,
 int parse_dname(const char* str, uint8_t** res, size_t* len, int* labs);
 
 /**
- * Find local data tag string match for the given type (in qinfo) in the list.
+ * Add local tag data to the rrsets for the tag.  The data is parsed here,
+ * at config load, so that answers use the rrsets as they are.
+ * @param region: where the rrsets are allocated.
+ * @param list: the list of rrsets for the tag, one per type.
+ * @param data: the rdata string, like 'A 127.0.0.1'.
+ * @return false on parse error or malloc failure.
+ */
+int local_data_add_tag_data(struct regional* region, struct local_rrset** list,
+	const char* data);
+
+/**
+ * Find local tag data for the given type (in qinfo) in the list.
  * If found, 'r' will be filled with corresponding rrset information.
  * @param qinfo: contains name, type, and class for the data
- * @param list: stores local tag data to be searched
- * @param r: rrset key to be filled for matched data
- * @param temp: region to allocate rrset in 'r'
- * @return 1 if a match is found and rrset is built; otherwise 0 including
- * errors.
+ * @param list: local tag data rrsets to be searched
+ * @param r: rrset key to be filled for matched data.  It is renamed to
+ *	the qname, the rdata is shared with the list.
+ * @return 1 if a match is found; otherwise 0.
  */
 int local_data_find_tag_datas(const struct query_info* qinfo,
-	struct config_strlist* list, struct ub_packed_rrset_key* r,
-	struct regional* temp);
+	struct local_rrset* list, struct ub_packed_rrset_key* r);
 
 /**
  * See if two sets of tag lists (in the form of bitmap) have the same tag that
@@ -603,7 +658,7 @@ local_data_answer(struct local_zone* z, struct module_env* env,
 	struct query_info* qinfo, struct edns_data* edns,
 	struct comm_reply* repinfo, sldns_buffer* buf,
 	struct regional* temp, int labs, struct local_data** ldp,
-	enum localzone_type lz_type, int tag, struct config_strlist** tag_datas,
+	enum localzone_type lz_type, int tag, struct local_rrset** tag_datas,
 	size_t tag_datas_size, char** tagname, int num_tags);
 
 /**
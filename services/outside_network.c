@@ -1545,6 +1545,21 @@ outside_network_quit_prepare(struct outside_network* outnet)
 	outnet->want_to_quit = 1; 
 }
 
+void
+outside_network_use_uring(struct outside_network* outnet, int udp)
+{
+	struct port_comm* pc;
+	size_t i;
+	if(udp) {
+		/* the ports receive with it when they open a socket */
+		for(pc = outnet->unused_fds; pc; pc = pc->next)
+			(void)comm_point_use_uring(pc->cp);
+	}
+	for(i=0; i<outnet->num_tcp; i++)
+		(void)comm_point_use_uring(outnet->tcp_conns[i]->c);
+	outnet->tcp_use_uring = 1;
+}
+
 void 
 outside_network_delete(struct outside_network* outnet)
 {
@@ -3292,6 +3307,8 @@ outnet_comm_point_for_tcp(struct outside_network* outnet,
 	}
 	cp->repinfo.addrlen = to_addrlen;
 	memcpy(&cp->repinfo.addr, to_addr, to_addrlen);
+	if(outnet->tcp_use_uring)
+		(void)comm_point_use_uring(cp);
 
 	/* setup for SSL (if needed) */
 	if(ssl) {
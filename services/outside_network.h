@@ -110,6 +110,9 @@ struct outside_network {
 	/** if we perform udp-connect, connect() for UDP socket to mitigate
 	 * ICMP side channel leakage */
 	int udp_connect;
+	/** if the TCP streams read and write with the io_uring of the
+	 * comm base */
+	int tcp_use_uring;
 
 	/** array of outgoing IP4 interfaces */
 	struct port_if* ip4_ifs;
@@ -545,6 +548,16 @@ struct outside_network* outside_network_create(struct comm_base* base,
 	void* sslctx, int delayclose, int tls_use_sni, struct dt_env *dtenv,
 	int udp_connect);
 
+/**
+ * Do the I/O of the outgoing sockets with the io_uring of the comm base.
+ * The UDP ports receive with it, and the TCP streams read and write with
+ * it, from the next time that they open a socket.
+ * @param outnet: the outside network.
+ * @param udp: if the UDP ports use it, the answers have to fit in
+ *	COMM_URING_UDP_SIZE.
+ */
+void outside_network_use_uring(struct outside_network* outnet, int udp);
+
 /**
  * Delete outside_network structure.
  * @param outnet: object to delete.
@@ -40,6 +40,7 @@
  */
 
 #include "config.h"
+#include <sys/time.h>
 #include "services/rpz.h"
 #include "util/config_file.h"
 #include "sldns/wire2str.h"
@@ -301,35 +302,186 @@ void rpz_delete(struct rpz* r)
 {
 	if(!r)
 		return;
+	lock_rw_destroy(&r->lock);
 	local_zones_delete(r->local_zones);
 	respip_set_delete(r->respip_set);
+	local_zones_delete(r->load_zones);
+	respip_set_delete(r->load_respip);
 	regional_destroy(r->region);
 	free(r->taglist);
 	free(r->log_name);
 	free(r);
 }
 
+void
+rpz_apply_start(struct rpz* r)
+{
+	/* must hold write lock on auth_zone */
+	/* drop the policies of a load that failed halfway */
+	local_zones_delete(r->load_zones);
+	respip_set_delete(r->load_respip);
+	r->load_zones = NULL;
+	r->load_respip = NULL;
+	if(gettimeofday(&r->apply_start, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+}
+
 int
 rpz_clear(struct rpz* r)
 {
 	/* must hold write lock on auth_zone */
-	local_zones_delete(r->local_zones);
-	respip_set_delete(r->respip_set);
-	if(!(r->local_zones = local_zones_create())){
+	/* the policies are loaded beside the current ones */
+	local_zones_delete(r->load_zones);
+	respip_set_delete(r->load_respip);
+	r->load_respip = NULL;
+	if(!(r->load_zones = local_zones_create())){
 		return 0;
 	}
-	if(!(r->respip_set = respip_set_create())) {
+	if(!(r->load_respip = respip_set_create())) {
+		local_zones_delete(r->load_zones);
+		r->load_zones = NULL;
 		return 0;
 	}
 	return 1;
 }
 
+/** the local zones that an update changes, the policies that are being
+ * loaded, or else the current policies for an incremental update */
+static struct local_zones*
+rpz_update_zones(struct rpz* r)
+{
+	return r->load_zones?r->load_zones:r->local_zones;
+}
+
+/** the respip set that an update changes */
+static struct respip_set*
+rpz_update_respip(struct rpz* r)
+{
+	return r->load_respip?r->load_respip:r->respip_set;
+}
+
+/** subtract timers and the values do not overflow or become negative */
+static void
+rpz_timeval_subtract(struct timeval* d, const struct timeval* end,
+	const struct timeval* start)
+{
+#ifndef S_SPLINT_S
+	time_t end_usec = end->tv_usec;
+	d->tv_sec = end->tv_sec - start->tv_sec;
+	if(end_usec < start->tv_usec) {
+		end_usec += 1000000;
+		d->tv_sec--;
+	}
+	d->tv_usec = end_usec - start->tv_usec;
+	if(d->tv_sec < 0) {
+		d->tv_sec = 0;
+		d->tv_usec = 0;
+	}
+#endif
+}
+
+/** swap in the new policies with the rpz lock, and record the update
+ * statistics.  The new policies are set in zones and respip, if not
+ * NULL, and the old policies are returned in them. */
+static void
+rpz_swap_policies(struct rpz* r, struct local_zones** zones,
+	struct respip_set** respip, struct timeval* apply_start)
+{
+	struct local_zones* old_zones = NULL;
+	struct respip_set* old_respip = NULL;
+	struct timeval start, end;
+	if(gettimeofday(&start, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+	lock_rw_wrlock(&r->lock);
+	if(*zones) {
+		old_zones = r->local_zones;
+		old_respip = r->respip_set;
+		r->local_zones = *zones;
+		r->respip_set = *respip;
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+	if(old_zones)
+		rpz_timeval_subtract(&r->swap_time, &end, &start);
+	if(apply_start->tv_sec != 0) {
+		rpz_timeval_subtract(&r->apply_time, &end, apply_start);
+		r->apply_count++;
+		apply_start->tv_sec = 0;
+	}
+	lock_rw_unlock(&r->lock);
+	*zones = old_zones;
+	*respip = old_respip;
+}
+
 void
 rpz_finish_config(struct rpz* r)
 {
-	lock_rw_wrlock(&r->respip_set->lock);
-	addr_tree_init_parents(&r->respip_set->ip_tree);
-	lock_rw_unlock(&r->respip_set->lock);
+	/* must hold write lock on auth_zone */
+	if(r->load_zones) {
+		/* set up the new policies, before lookups can see them */
+		lock_rw_wrlock(&r->load_respip->lock);
+		respip_set_init_parents(r->load_respip);
+		lock_rw_unlock(&r->load_respip->lock);
+	} else if(r->respip_changed) {
+		lock_rw_wrlock(&r->respip_set->lock);
+		respip_set_init_parents(r->respip_set);
+		lock_rw_unlock(&r->respip_set->lock);
+	}
+	r->respip_changed = 0;
+
+	rpz_swap_policies(r, &r->load_zones, &r->load_respip,
+		&r->apply_start);
+
+	/* lookups hold the rpz lock, the old policies are no longer used */
+	local_zones_delete(r->load_zones);
+	respip_set_delete(r->load_respip);
+	r->load_zones = NULL;
+	r->load_respip = NULL;
+}
+
+struct rpz*
+rpz_load_create(void)
+{
+	struct rpz* load = calloc(1, sizeof(*load));
+	if(!load)
+		return NULL;
+	lock_rw_init(&load->lock);
+	if(!(load->load_zones = local_zones_create()) ||
+		!(load->load_respip = respip_set_create())) {
+		rpz_delete(load);
+		return NULL;
+	}
+	if(gettimeofday(&load->apply_start, NULL) < 0)
+		log_err("gettimeofday: %s", strerror(errno));
+	return load;
+}
+
+void
+rpz_load_finish(struct rpz* load)
+{
+	/* the load is not visible to lookups yet */
+	lock_rw_wrlock(&load->load_respip->lock);
+	respip_set_init_parents(load->load_respip);
+	lock_rw_unlock(&load->load_respip->lock);
+}
+
+void
+rpz_load_publish(struct rpz* r, struct rpz* load)
+{
+	/* must hold write lock on auth_zone */
+	/* drop the policies of a zonefile read that failed halfway */
+	local_zones_delete(r->load_zones);
+	respip_set_delete(r->load_respip);
+	r->load_zones = NULL;
+	r->load_respip = NULL;
+	r->respip_changed = 0;
+
+	rpz_swap_policies(r, &load->load_zones, &load->load_respip,
+		&load->apply_start);
+
+	/* lookups hold the rpz lock, the old policies are no longer used,
+	 * and are deleted with the load */
+	rpz_delete(load);
 }
 
 /** new rrset containing CNAME override, does not yet contain a dname */
@@ -390,6 +542,7 @@ rpz_create(struct config_auth* p)
 		goto err;
 	}
 
+	lock_rw_init(&r->lock);
 	if(!(r->local_zones = local_zones_create())){
 		goto err;
 	}
@@ -434,6 +587,8 @@ rpz_create(struct config_auth* p)
 	return r;
 err:
 	if(r) {
+		if(r->region)
+			lock_rw_destroy(&r->lock);
 		if(r->local_zones)
 			local_zones_delete(r->local_zones);
 		if(r->respip_set)
@@ -477,6 +632,7 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 	int dnamelabs = dname_count_labels(dname);
 	char* rrstr;
 	int newzone = 0;
+	struct local_zones* zones = rpz_update_zones(r);
 
 	if(a == RPZ_TCP_ONLY_ACTION || a == RPZ_INVALID_ACTION) {
 		verbose(VERB_ALGO, "RPZ: skipping unsupported action: %s",
@@ -485,9 +641,9 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 		return;
 	}
 
-	lock_rw_wrlock(&r->local_zones->lock);
+	lock_rw_wrlock(&zones->lock);
 	/* exact match */
-	z = local_zones_find(r->local_zones, dname, dnamelen, dnamelabs,
+	z = local_zones_find(zones, dname, dnamelen, dnamelabs,
 		LDNS_RR_CLASS_IN);
 	if(z && a != RPZ_LOCAL_DATA_ACTION) {
 		rrstr = sldns_wire2str_rr(rr, rr_len);
@@ -495,22 +651,22 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 			log_err("malloc error while inserting RPZ qname "
 				"trigger");
 			free(dname);
-			lock_rw_unlock(&r->local_zones->lock);
+			lock_rw_unlock(&zones->lock);
 			return;
 		}
 		verbose(VERB_ALGO, "RPZ: skipping duplicate record: '%s'",
 			rrstr);
 		free(rrstr);
 		free(dname);
-		lock_rw_unlock(&r->local_zones->lock);
+		lock_rw_unlock(&zones->lock);
 		return;
 	}
 	if(!z) {
 		tp = rpz_action_to_localzone_type(a);
-		if(!(z = local_zones_add_zone(r->local_zones, dname, dnamelen,
+		if(!(z = local_zones_add_zone(zones, dname, dnamelen,
 			dnamelabs, rrclass, tp))) {
 			log_warn("RPZ create failed");
-			lock_rw_unlock(&r->local_zones->lock);
+			lock_rw_unlock(&zones->lock);
 			/* dname will be free'd in failed local_zone_create() */
 			return;
 		}
@@ -522,7 +678,7 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 			log_err("malloc error while inserting RPZ qname "
 				"trigger");
 			free(dname);
-			lock_rw_unlock(&r->local_zones->lock);
+			lock_rw_unlock(&zones->lock);
 			return;
 		}
 		lock_rw_wrlock(&z->lock);
@@ -533,7 +689,7 @@ rpz_insert_qname_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 	}
 	if(!newzone)
 		free(dname);
-	lock_rw_unlock(&r->local_zones->lock);
+	lock_rw_unlock(&zones->lock);
 	return;
 }
 
@@ -549,6 +705,7 @@ rpz_insert_response_ip_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 	int net, af;
 	char* rrstr;
 	enum respip_action respa = rpz_action_to_respip_action(a);
+	struct respip_set* set = rpz_update_respip(r);
 
 	if(a == RPZ_TCP_ONLY_ACTION || a == RPZ_INVALID_ACTION ||
 		respa == respip_invalid) {
@@ -560,26 +717,28 @@ rpz_insert_response_ip_trigger(struct rpz* r, uint8_t* dname, size_t dnamelen,
 	if(!netblockdnametoaddr(dname, dnamelen, &addr, &addrlen, &net, &af))
 		return 0;
 
-	lock_rw_wrlock(&r->respip_set->lock);
+	lock_rw_wrlock(&set->lock);
 	rrstr = sldns_wire2str_rr(rr, rr_len);
 	if(!rrstr) {
 		log_err("malloc error while inserting RPZ respip trigger");
-		lock_rw_unlock(&r->respip_set->lock);
+		lock_rw_unlock(&set->lock);
 		return 0;
 	}
-	if(!(node=respip_sockaddr_find_or_create(r->respip_set, &addr, addrlen,
+	if(!(node=respip_sockaddr_find_or_create(set, &addr, addrlen,
 		net, 1, rrstr))) {
-		lock_rw_unlock(&r->respip_set->lock);
+		lock_rw_unlock(&set->lock);
 		free(rrstr);
 		return 0;
 	}
 
 	lock_rw_wrlock(&node->lock);
-	lock_rw_unlock(&r->respip_set->lock);
+	lock_rw_unlock(&set->lock);
 	node->action = respa;
+	if(set == r->respip_set)
+		r->respip_changed = 1;
 
 	if(a == RPZ_LOCAL_DATA_ACTION) {
-		respip_enter_rr(r->respip_set->region, node, rrtype,
+		respip_enter_rr(set->region, node, rrtype,
 			rrclass, ttl, rdata, rdata_len, rrstr, "");
 	}
 	lock_rw_unlock(&node->lock);
@@ -962,8 +1121,8 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 	struct local_data* ld = NULL;
 	lock_rw_rdlock(&az->rpz_lock);
 	for(a = az->rpz_first; a; a = a->rpz_az_next) {
-		lock_rw_rdlock(&a->lock);
 		r = a->rpz;
+		lock_rw_rdlock(&r->lock);
 		if(!r->disabled && (!r->taglist || taglist_intersect(r->taglist,
 			r->taglistlen, taglist, taglen))) {
 			z = rpz_find_zone(r, qinfo->qname, qinfo->qname_len,
@@ -982,11 +1141,11 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 			if(z)
 				break;
 		}
-		lock_rw_unlock(&a->lock); /* not found in this auth_zone */
+		lock_rw_unlock(&r->lock); /* not found in this auth_zone */
 	}
 	lock_rw_unlock(&az->rpz_lock);
 	if(!z)
-		return 0; /* not holding auth_zone.lock anymore */
+		return 0; /* not holding rpz.lock anymore */
 
 	log_assert(r);
 	if(r->action_override == RPZ_NO_OVERRIDE_ACTION)
@@ -999,7 +1158,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 			regional_alloc_zero(temp, sizeof(struct local_rrset));
 		if(!qinfo->local_alias) {
 			lock_rw_unlock(&z->lock);
-			lock_rw_unlock(&a->lock);
+			lock_rw_unlock(&r->lock);
 			return 0; /* out of memory */
 		}
 		qinfo->local_alias->rrset =
@@ -1007,7 +1166,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 				sizeof(*r->cname_override));
 		if(!qinfo->local_alias->rrset) {
 			lock_rw_unlock(&z->lock);
-			lock_rw_unlock(&a->lock);
+			lock_rw_unlock(&r->lock);
 			return 0; /* out of memory */
 		}
 		qinfo->local_alias->rrset->rk.dname = qinfo->qname;
@@ -1017,7 +1176,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 				qinfo, repinfo, r->log_name);
 		stats->rpz_action[RPZ_CNAME_OVERRIDE_ACTION]++;
 		lock_rw_unlock(&z->lock);
-		lock_rw_unlock(&a->lock);
+		lock_rw_unlock(&r->lock);
 		return 0;
 	}
 
@@ -1030,7 +1189,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 				repinfo, r->log_name);
 		stats->rpz_action[localzone_type_to_rpz_action(lzt)]++;
 		lock_rw_unlock(&z->lock);
-		lock_rw_unlock(&a->lock);
+		lock_rw_unlock(&r->lock);
 		return !qinfo->local_alias;
 	}
 
@@ -1041,7 +1200,7 @@ rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
 			qinfo, repinfo, r->log_name);
 	stats->rpz_action[localzone_type_to_rpz_action(lzt)]++;
 	lock_rw_unlock(&z->lock);
-	lock_rw_unlock(&a->lock);
+	lock_rw_unlock(&r->lock);
 
 	return ret;
 }
@@ -1050,12 +1209,16 @@ void rpz_enable(struct rpz* r)
 {
     if(!r)
         return;
+    lock_rw_wrlock(&r->lock);
     r->disabled = 0;
+    lock_rw_unlock(&r->lock);
 }
 
 void rpz_disable(struct rpz* r)
 {
     if(!r)
         return;
+    lock_rw_wrlock(&r->lock);
     r->disabled = 1;
+    lock_rw_unlock(&r->lock);
 }
@@ -87,11 +87,25 @@ enum rpz_action {
  * RPZ containing policies. Pointed to from corresponding auth-zone. Part of a
  * linked list to keep configuration order. Iterating or changing the linked
  * list requires the rpz_lock from struct auth_zones. Changing items in this
- * struct require the lock from struct auth_zone.
+ * struct require the lock from struct auth_zone. Lookups hold the lock in
+ * this struct, and not the auth-zone lock, so that they can continue while
+ * a transfer holds the auth-zone lock.
  */
 struct rpz {
+	/** lock for lookups in the policies, held for writing to swap in
+	 * the newly loaded policies and to change the disabled flag */
+	lock_rw_type lock;
 	struct local_zones* local_zones;
 	struct respip_set* respip_set;
+	/** the policies that are being loaded by a zonefile read, NULL if
+	 * not loading. These are built while lookups use the current
+	 * policies, and swapped in when done.  Zone transfers build their
+	 * policies in a load, see rpz_load_create. */
+	struct local_zones* load_zones;
+	/** the respip set that is being loaded, or NULL */
+	struct respip_set* load_respip;
+	/** if response ip triggers were changed by an incremental update */
+	int respip_changed;
 	uint8_t* taglist;
 	size_t taglistlen;
 	enum rpz_action action_override;
@@ -100,6 +114,15 @@ struct rpz {
 	char* log_name;
 	struct regional* region;
 	int disabled;
+	/** start time of the update of the policies that is in progress */
+	struct timeval apply_start;
+	/** number of times the policies were updated, protected by lock */
+	size_t apply_count;
+	/** duration of the last update, protected by lock */
+	struct timeval apply_time;
+	/** time it took to swap in the policies of the last full load, that
+	 * is mostly the wait for lookups to release the lock */
+	struct timeval swap_time;
 };
 
 /**
@@ -162,9 +185,17 @@ int rpz_apply_qname_trigger(struct auth_zones* az, struct module_env* env,
  */
 void rpz_delete(struct rpz* r);
 
+/**
+ * Start an update of the RPZ policies, from a zonefile or a zone transfer.
+ * Records the start time for the statistics.
+ * @param r: RPZ to use
+ */
+void rpz_apply_start(struct rpz* r);
+
 /**
  * Clear local-zones and respip data in RPZ, used after reloading file or
- * AXFR/HTTP transfer.
+ * AXFR/HTTP transfer. The new policies are loaded beside the current
+ * policies, that are used for lookups until rpz_finish_config.
  * @param r: RPZ to use
  */
 int rpz_clear(struct rpz* r);
@@ -186,11 +217,35 @@ enum rpz_action
 respip_action_to_rpz_action(enum respip_action a);
 
 /**
- * Prepare RPZ after procesing feed content.
+ * Prepare RPZ after procesing feed content. If the policies were loaded
+ * with rpz_clear, they replace the current policies.
  * @param r: RPZ to use
  */
 void rpz_finish_config(struct rpz* r);
 
+/**
+ * Create a load, the policies of an RPZ that are built off to the side by
+ * a zone transfer, without the auth_zone lock.  The policies are inserted
+ * in the load with rpz_insert_rr, and the RPZ is not changed until
+ * rpz_load_publish.  Delete an unused load with rpz_delete.
+ * @return: the load, or NULL on malloc failure.
+ */
+struct rpz* rpz_load_create(void);
+
+/**
+ * Prepare the policies of the load after the last insert.
+ * @param load: the load.
+ */
+void rpz_load_finish(struct rpz* load);
+
+/**
+ * Replace the policies of the RPZ with the policies of the load.
+ * Must hold the write lock on the auth_zone.
+ * @param r: RPZ to use
+ * @param load: the load, it is deleted.
+ */
+void rpz_load_publish(struct rpz* r, struct rpz* load);
+
 /**
  * Classify respip action for RPZ action
  * @param a: RPZ action
@@ -283,6 +283,7 @@ static void print_mem(struct ub_shm_stat_info* shm_stat,
 	PR_LL("mem.cache.dnscrypt_nonce",
 		shm_stat->mem.dnscrypt_nonce);
 #endif
+	PR_LL("mem.authzone", s->svr.mem_authzone);
 	PR_LL("mem.streamwait", s->svr.mem_stream_wait);
 	PR_LL("mem.http.query_buffer", s->svr.mem_http2_query_buffer);
 	PR_LL("mem.http.response_buffer", s->svr.mem_http2_response_buffer);
@@ -349,6 +350,11 @@ static void print_extended(struct ub_stats_info* s)
 	PR_UL("num.query.tcpout", s->svr.qtcp_outgoing);
 	PR_UL("num.query.tls", s->svr.qtls);
 	PR_UL("num.query.tls_resume", s->svr.qtls_resume);
+	PR_UL("num.tls.handshake", s->svr.tls_handshake);
+	PR_UL("num.tls.handshake.resumed", s->svr.tls_handshake_resumed);
+	PR_UL("num.tls.ktls", s->svr.tls_ktls);
+	PR_UL("num.event.wakeup", s->svr.event_wakeup);
+	PR_UL("num.event.handled", s->svr.event_handled);
 	PR_UL("num.query.ipv6", s->svr.qipv6);
 	PR_UL("num.query.https", s->svr.qhttps);
 
@@ -410,10 +416,39 @@ static void print_extended(struct ub_stats_info* s)
 #endif /* USE_DNSCRYPT */
 	PR_UL("num.query.authzone.up", s->svr.num_query_authzone_up);
 	PR_UL("num.query.authzone.down", s->svr.num_query_authzone_down);
+	PR_UL("auth.xfr.swap", s->svr.auth_xfr_swap);
+	PR_UL("auth.xfr.lock_usec", s->svr.auth_xfr_lock_usec);
+	PR_UL("auth.xfr.lock_usec.max", s->svr.auth_xfr_lock_usec_max);
 #ifdef CLIENT_SUBNET
 	PR_UL("num.query.subnet", s->svr.num_query_subnet);
 	PR_UL("num.query.subnet_cache", s->svr.num_query_subnet_cache);
 #endif
+#ifdef USE_CACHEDB
+	PR_UL("num.cachedb.write_behind.queue", s->svr.cachedb_wb_queue);
+	PR_UL("num.cachedb.write_behind.merged", s->svr.cachedb_wb_merged);
+	PR_UL("num.cachedb.write_behind.dropped", s->svr.cachedb_wb_dropped);
+	PR_UL("num.cachedb.write_behind.flush", s->svr.cachedb_wb_flush);
+	PR_UL("num.cachedb.write_behind.stored", s->svr.cachedb_wb_stored);
+	{
+		struct timeval sumwait, avg;
+#ifndef S_SPLINT_S
+		sumwait.tv_sec = s->svr.cachedb_wb_wait_sec;
+		sumwait.tv_usec = s->svr.cachedb_wb_wait_usec;
+#endif
+		timeval_divide(&avg, &sumwait, s->svr.cachedb_wb_stored);
+		PR_TIMEVAL("cachedb.write_behind.wait.avg", avg);
+#ifndef S_SPLINT_S
+		sumwait.tv_sec = s->svr.cachedb_wb_flush_sec;
+		sumwait.tv_usec = s->svr.cachedb_wb_flush_usec;
+#endif
+		timeval_divide(&avg, &sumwait, s->svr.cachedb_wb_flush);
+		PR_TIMEVAL("cachedb.write_behind.flush.avg", avg);
+	}
+#endif
+#ifdef USE_DNSTAP
+	PR_UL("num.dnstap.queue", s->svr.dnstap_queue);
+	PR_UL("num.dnstap.dropped", s->svr.dnstap_dropped);
+#endif
 }
 
 /** print statistics out of memory structures */
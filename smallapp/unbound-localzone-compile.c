@@ -0,0 +1,139 @@
+/*
+ * smallapp/unbound-localzone-compile.c - compile local zones into a file.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * The local zone compiler reads the local-zone and local-data elements
+ * from a config file and writes them to a compiled file, that the server
+ * maps into memory with the local-zone-file option.  Large blocklists then
+ * do not have to be parsed at every server start.
+ * Exit status 1 means an error.
+ */
+
+#include "config.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/locks.h"
+#include "services/localzone.h"
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+
+/** Give usage, and exit (1). */
+static void
+usage(void)
+{
+	printf("Usage:	unbound-localzone-compile [opts] file output\n");
+	printf("	Compiles the local-zone and local-data elements from the\n");
+	printf("	config file into an output file for local-zone-file.\n");
+	printf("-h		show this usage help.\n");
+	printf("Version %s\n", PACKAGE_VERSION);
+	printf("BSD licensed, see LICENSE in source package for details.\n");
+	printf("Report bugs to %s\n", PACKAGE_BUGREPORT);
+	exit(1);
+}
+
+/** compile the local zones from the config file into the output file */
+static int
+compile(const char* cfgfile, const char* outfile)
+{
+	struct local_zones* zones;
+	struct config_file* cfg = config_create();
+	size_t num;
+	if(!cfg)
+		fatal_exit("out of memory");
+	if(!config_read(cfg, cfgfile, NULL)) {
+		/* config_read prints messages to stderr */
+		config_delete(cfg);
+		return 0;
+	}
+	if(cfg->local_zone_tags || cfg->local_zone_overrides)
+		log_warn("local-zone-tag and local-zone-override are not "
+			"stored in the compiled file");
+	/* only the zones from the file, not the default zones or another
+	 * compiled file, the server adds those itself */
+	cfg->local_zones_disable_default = 1;
+	free(cfg->local_zone_file);
+	cfg->local_zone_file = NULL;
+	if(!(zones = local_zones_create()))
+		fatal_exit("out of memory");
+	if(!local_zones_apply_cfg(zones, cfg)) {
+		log_err("failed local-zone, local-data configuration");
+		local_zones_delete(zones);
+		config_delete(cfg);
+		return 0;
+	}
+	num = zones->ztree.count;
+	if(!local_zones_write_file(zones, outfile)) {
+		local_zones_delete(zones);
+		config_delete(cfg);
+		return 0;
+	}
+	printf("unbound-localzone-compile: %u zones from %s written to %s\n",
+		(unsigned)num, cfgfile, outfile);
+	local_zones_delete(zones);
+	config_delete(cfg);
+	return 1;
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** Main routine for unbound-localzone-compile */
+int main(int argc, char* argv[])
+{
+	int c, r;
+	log_ident_set("unbound-localzone-compile");
+	log_init(NULL, 0, NULL);
+	checklock_start();
+	while( (c=getopt(argc, argv, "h")) != -1) {
+		switch(c) {
+		case '?':
+		case 'h':
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc != 2)
+		usage();
+	r = compile(argv[0], argv[1]);
+	checklock_stop();
+	return r?0:1;
+}
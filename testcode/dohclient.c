@@ -54,6 +54,7 @@
 #include "util/net_help.h"
 #include <openssl/ssl.h>
 #include <openssl/err.h>
+#include <sys/time.h>
 #ifdef HAVE_NGHTTP2
 #include <nghttp2/nghttp2.h>
 
@@ -65,6 +66,16 @@ struct http2_session {
 	/* Use POST :method if 1 */
 	int post;
 	int block_select;
+	/* number of queries that still have to be submitted */
+	int to_submit;
+	/* index in the query list of the next query to submit */
+	int next_query;
+	/* max number of queries in flight on the session */
+	int max_streams;
+	/* do not print headers and answers if 1 */
+	int quiet;
+	/* number of answers with status 200 */
+	int answer_count;
 	const char* authority;
 	const char* endpoint;
 	const char* content_type;
@@ -91,6 +102,10 @@ static void usage(char* argv[])
 	printf("-c		Content-type in request, default: "
 		"application/dns-message\n");
 	printf("-n		no-tls, TLS is disabled\n");
+	printf("-r num		repeat the queries num times, default: 1\n");
+	printf("-m num		max number of queries in flight, "
+		"default: 100\n");
+	printf("-q		quiet, print only the timing summary\n");
 	printf("-h 		This help text\n");
 	exit(1);
 }
@@ -195,12 +210,15 @@ submit_query(struct http2_session* h2_session, struct sldns_buffer* buf)
 	headers[4].name = (uint8_t*)"content-type";
 	headers[4].value = (uint8_t*)h2_session->content_type;
 
-	printf("Request headers\n");
+	if(!h2_session->quiet)
+		printf("Request headers\n");
 	for(i=0; i<sizeof(headers)/sizeof(headers[0]); i++) {
 		headers[i].namelen = strlen((char*)headers[i].name);
 		headers[i].valuelen = strlen((char*)headers[i].value);
 		headers[i].flags = NGHTTP2_NV_FLAG_NONE;
-		printf("%s: %s\n", headers[i].name, headers[i].value);
+		if(!h2_session->quiet)
+			printf("%s: %s\n", headers[i].name,
+				headers[i].value);
 	}
 
 	stream_id = nghttp2_submit_request(h2_session->session, NULL, headers,
@@ -260,6 +278,11 @@ static ssize_t http2_recv_cb(nghttp2_session* ATTR_UNUSED(session),
 	if(h2_session->block_select && h2_session->query_count <= 0) {
 		return NGHTTP2_ERR_WOULDBLOCK;
 	}
+	if(h2_session->block_select && h2_session->to_submit > 0 &&
+		h2_session->query_count < h2_session->max_streams) {
+		/* return to the caller, to submit more queries */
+		return NGHTTP2_ERR_WOULDBLOCK;
+	}
 	if(h2_session->block_select)
 		waittv = NULL;
 	else
@@ -368,8 +391,9 @@ static int http2_data_chunk_recv_cb(nghttp2_session* ATTR_UNUSED(session),
 }
 
 static int http2_frame_recv_cb(nghttp2_session *session,
-	const nghttp2_frame *frame, void* ATTR_UNUSED(cb_arg))
+	const nghttp2_frame *frame, void* cb_arg)
 {
+	struct http2_session* h2_session = (struct http2_session*)cb_arg;
 	struct http2_stream* h2_stream;
 
 	if(!(h2_stream = nghttp2_session_get_stream_user_data(
@@ -384,6 +408,9 @@ static int http2_frame_recv_cb(nghttp2_session *session,
 		frame->hd.flags & NGHTTP2_FLAG_END_STREAM) &&
 			h2_stream->res_status == 200) {
 			char* pktstr;
+			h2_session->answer_count++;
+			if(h2_session->quiet)
+				return 0;
 			sldns_buffer_flip(h2_stream->buf);
 			pktstr = sldns_wire2str_pkt(
 				sldns_buffer_begin(h2_stream->buf),
@@ -401,7 +428,8 @@ static int http2_header_cb(nghttp2_session* ATTR_UNUSED(session),
 {
 	struct http2_stream* h2_stream;
 	struct http2_session* h2_session = (struct http2_session*)cb_arg;
-	printf("%s %s\n", name, value);
+	if(!h2_session->quiet)
+		printf("%s %s\n", name, value);
 	if(namelen == 7 && memcmp(":status", name, namelen) == 0) {
 		if(!(h2_stream = nghttp2_session_get_stream_user_data(
 			h2_session->session, frame->hd.stream_id))) {
@@ -486,14 +514,32 @@ http2_read(struct http2_session* h2_session)
 	}
 }
 
+/** submit queries from the list, up to the max in flight */
 static void
-run(struct http2_session* h2_session, int port, int no_tls, int count, char** q)
+refill(struct http2_session* h2_session, int count, char** q)
 {
 	int i;
+	struct sldns_buffer* buf;
+	while(h2_session->to_submit > 0 &&
+		h2_session->query_count < h2_session->max_streams) {
+		/* the list is used in order, repeated */
+		i = h2_session->next_query;
+		buf = make_query(q[i], q[i+1], q[i+2]);
+		submit_query(h2_session, buf);
+		h2_session->to_submit--;
+		h2_session->next_query = (i+3)%count;
+	}
+}
+
+static void
+run(struct http2_session* h2_session, int port, int no_tls, int count, char** q,
+	int repeat)
+{
 	SSL_CTX* ctx = NULL;
 	SSL* ssl = NULL;
-	int fd;
-	struct sldns_buffer* buf = NULL;
+	int fd, total;
+	struct timeval start, end;
+	double dt;
 
 	fd = open_svr(h2_session->authority, port);
 	h2_session->fd = fd;
@@ -529,15 +575,23 @@ run(struct http2_session* h2_session, int port, int no_tls, int count, char** q)
 	h2_session->block_select = 1;
 
 	/* hande query */
-	for(i=0; i<count; i+=3) {
-		buf = make_query(q[i], q[i+1], q[i+2]);
-		submit_query(h2_session, buf);
-	}
+	total = (count/3)*repeat;
+	h2_session->to_submit = total;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	refill(h2_session, count, q);
 	http2_write(h2_session);
-	while(h2_session->query_count) {
+	while(h2_session->query_count || h2_session->to_submit) {
 		http2_read(h2_session);
+		refill(h2_session, count, q);
 		http2_write(h2_session);
 	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+	printf("%d queries, %d answers in %.6f sec, %.1f qps\n", total,
+		h2_session->answer_count, dt, (dt>0)?((double)total/dt):0.);
 
 	/* shutdown */
 	http2_session_delete(h2_session);
@@ -558,7 +612,7 @@ extern char* optarg;
 int main(int argc, char** argv)
 {
 	int c;
-	int port = UNBOUND_DNS_OVER_HTTPS_PORT, no_tls = 0;
+	int port = UNBOUND_DNS_OVER_HTTPS_PORT, no_tls = 0, repeat = 1;
 	struct http2_session* h2_session;
 
 #ifdef USE_WINSOCK
@@ -581,8 +635,9 @@ int main(int argc, char** argv)
 	h2_session->post = 0;
 	h2_session->endpoint = "/dns-query";
 	h2_session->content_type = "application/dns-message";
+	h2_session->max_streams = 100;
 
-	while((c=getopt(argc, argv, "c:e:hns:p:P")) != -1) {
+	while((c=getopt(argc, argv, "c:e:hm:ns:p:Pqr:")) != -1) {
 		switch(c) {
 			case 'c':
 				h2_session->content_type = optarg;
@@ -590,6 +645,14 @@ int main(int argc, char** argv)
 			case 'e':
 				h2_session->endpoint = optarg;
 				break;
+			case 'm':
+				h2_session->max_streams = atoi(optarg);
+				if(h2_session->max_streams < 1) {
+					printf("error parsing max streams, "
+					    "number expected: %s\n", optarg);
+					return 1;
+				}
+				break;
 			case 'n':
 				no_tls = 1;
 				break;
@@ -604,6 +667,17 @@ int main(int argc, char** argv)
 			case 'P':
 				h2_session->post = 1;
 				break;
+			case 'q':
+				h2_session->quiet = 1;
+				break;
+			case 'r':
+				repeat = atoi(optarg);
+				if(repeat < 1) {
+					printf("error parsing repeat, "
+					    "number expected: %s\n", optarg);
+					return 1;
+				}
+				break;
 			case 's':
 				h2_session->authority = optarg;
 				break;
@@ -621,7 +695,7 @@ int main(int argc, char** argv)
 	}
 
 
-	run(h2_session, port, no_tls, argc, argv);
+	run(h2_session, port, no_tls, argc, argv, repeat);
 
 	checklock_stop();
 #ifdef USE_WINSOCK
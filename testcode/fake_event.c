@@ -903,6 +903,16 @@ listen_delete(struct listen_dnsport* listen)
 	free(listen);
 }
 
+void
+listen_setup_locks(void)
+{
+}
+
+void
+listen_desetup_locks(void)
+{
+}
+
 struct comm_base* 
 comm_base_create(int ATTR_UNUSED(sigs))
 {
@@ -1078,6 +1088,12 @@ outside_network_quit_prepare(struct outside_network* ATTR_UNUSED(outnet))
 {
 }
 
+void
+outside_network_use_uring(struct outside_network* ATTR_UNUSED(outnet),
+	int ATTR_UNUSED(udp))
+{
+}
+
 struct pending* 
 pending_udp_query(struct serviced_query* sq, sldns_buffer* packet,
 	int timeout, comm_point_callback_type* callback, void* callback_arg)
@@ -1485,6 +1501,12 @@ void comm_base_handle_slow_accept(int ATTR_UNUSED(fd),
 	log_assert(0);
 }
 
+void comm_base_handle_uring(int ATTR_UNUSED(fd), 
+	short ATTR_UNUSED(event), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 int serviced_udp_callback(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(reply_info))
@@ -1594,6 +1616,22 @@ struct ub_event_base* comm_base_internal(struct comm_base* ATTR_UNUSED(b))
 	return NULL;
 }
 
+int comm_base_setup_uring(struct comm_base* ATTR_UNUSED(b))
+{
+	/* no io_uring in testbound */
+	return 0;
+}
+
+int comm_point_use_uring(struct comm_point* ATTR_UNUSED(c))
+{
+	return 0;
+}
+
+void comm_point_set_exclusive(struct comm_point* ATTR_UNUSED(c))
+{
+	/* the fake event loop does not wake threads */
+}
+
 void daemon_remote_exec(struct worker* ATTR_UNUSED(worker))
 {
 }
@@ -0,0 +1,447 @@
+/*
+ * testcode/fakeredis.c - stand-in redis server for the cachedb tests.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This program is a stand-in for a redis server, for the tests of the
+ * cachedb redis backend.  It speaks the redis protocol on TCP, and
+ * keeps the data in memory.  It knows the GET, SET, SETEX and PING
+ * commands, that are what the backend uses; the expiry time of SETEX is
+ * ignored.  The replies can be delayed, to test the timeouts, and the
+ * commands are printed, to see what the backend did.
+ */
+
+#include "config.h"
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#include <sys/time.h>
+#include "util/log.h"
+#include "util/net_help.h"
+#include <signal.h>
+
+/** max number of client connections */
+#define FR_MAX_CLIENTS 16
+/** size of the input buffer of a client, the largest command */
+#define FR_BUF_SIZE (128*1024)
+/** max number of arguments of a command */
+#define FR_MAX_ARGS 4
+
+/** a stored key and value */
+struct fr_entry {
+	/** next in the list */
+	struct fr_entry* next;
+	/** the key, nul terminated */
+	char* key;
+	/** the value */
+	uint8_t* val;
+	/** length of the value */
+	size_t len;
+};
+
+/** a client connection */
+struct fr_client {
+	/** the socket, or -1 if not in use */
+	int s;
+	/** the input that is not yet handled */
+	uint8_t buf[FR_BUF_SIZE];
+	/** length of the input */
+	size_t len;
+};
+
+/** the stored data */
+static struct fr_entry* fr_data = NULL;
+/** delay of every reply, in msec */
+static int fr_delay = 0;
+/** if the commands are printed */
+static int fr_print = 0;
+/** if the program has to stop */
+static volatile int fr_quit = 0;
+
+/** signal handler */
+static RETSIGTYPE
+fr_sigh(int sig)
+{
+	(void)sig;
+	fr_quit = 1;
+}
+
+/** print usage and exit */
+static void
+usage(char* argv[])
+{
+	printf("usage: %s [options]\n", argv[0]);
+	printf("	stand-in redis server for the cachedb tests.\n");
+	printf("-p port	listen on the port on 127.0.0.1, default 6379\n");
+	printf("-d msec	delay every reply by msec\n");
+	printf("-v	print the commands\n");
+	printf("-h	this help\n");
+	exit(1);
+}
+
+/** find the entry for the key */
+static struct fr_entry*
+fr_find(const char* key)
+{
+	struct fr_entry* e;
+	for(e = fr_data; e; e = e->next)
+		if(strcmp(e->key, key) == 0)
+			return e;
+	return NULL;
+}
+
+/** store the value for the key, false if out of memory */
+static int
+fr_set(const char* key, const uint8_t* val, size_t len)
+{
+	struct fr_entry* e = fr_find(key);
+	uint8_t* v = (uint8_t*)malloc(len?len:1);
+	if(!v)
+		return 0;
+	memmove(v, val, len);
+	if(!e) {
+		e = (struct fr_entry*)calloc(1, sizeof(*e));
+		if(!e || !(e->key = strdup(key))) {
+			free(e);
+			free(v);
+			return 0;
+		}
+		e->next = fr_data;
+		fr_data = e;
+	}
+	free(e->val);
+	e->val = v;
+	e->len = len;
+	return 1;
+}
+
+/** write the data to the client, the socket blocks */
+static void
+fr_write(int s, const void* data, size_t len)
+{
+	const uint8_t* p = (const uint8_t*)data;
+	ssize_t r;
+	while(len > 0) {
+		r = send(s, (void*)p, len, 0);
+		if(r == -1) {
+			if(errno == EINTR || errno == EAGAIN)
+				continue;
+			log_err("send: %s", strerror(errno));
+			return;
+		}
+		p += r;
+		len -= (size_t)r;
+	}
+}
+
+/** write a status or error reply line */
+static void
+fr_reply_line(int s, const char* line)
+{
+	fr_write(s, line, strlen(line));
+}
+
+/**
+ * Parse a command from the input, a redis array of bulk strings.
+ * @param buf: the input.
+ * @param len: length of the input.
+ * @param argv: the arguments are returned, they point into buf.
+ * @param argl: the lengths of the arguments.
+ * @param argc: the number of arguments is returned.
+ * @return the length of the command, 0 if it is not complete yet, or -1
+ * 	if it is malformed.
+ */
+static int
+fr_parse(uint8_t* buf, size_t len, uint8_t** argv, size_t* argl, int* argc)
+{
+	size_t pos = 0;
+	long n, i, l;
+	char* end;
+	/* "*<n>\r\n" then n times "$<len>\r\n<data>\r\n" */
+	if(len < 4 || !memchr(buf, '\n', len))
+		return 0;
+	if(buf[0] != '*')
+		return -1;
+	n = strtol((char*)buf+1, &end, 10);
+	if(n < 1 || n > FR_MAX_ARGS || *end != '\r')
+		return -1;
+	pos = (size_t)(end - (char*)buf) + 2;
+	for(i=0; i<n; i++) {
+		if(pos >= len || !memchr(buf+pos, '\n', len-pos))
+			return 0;
+		if(buf[pos] != '$')
+			return -1;
+		l = strtol((char*)buf+pos+1, &end, 10);
+		if(l < 0 || l > FR_BUF_SIZE || *end != '\r')
+			return -1;
+		pos = (size_t)(end - (char*)buf) + 2;
+		if(pos + (size_t)l + 2 > len)
+			return 0;
+		argv[i] = buf+pos;
+		argl[i] = (size_t)l;
+		pos += (size_t)l + 2;
+	}
+	*argc = (int)n;
+	return (int)pos;
+}
+
+/** if the argument is the command name, case insensitive */
+static int
+fr_cmd_is(uint8_t* arg, size_t len, const char* name)
+{
+	return len == strlen(name) && strncasecmp((char*)arg, name, len) == 0;
+}
+
+/** perform a command and write the reply */
+static void
+fr_command(int s, uint8_t** argv, size_t* argl, int argc)
+{
+	char key[1024], hdr[64];
+	struct fr_entry* e;
+	if(fr_delay > 0) {
+		struct timeval tv;
+		tv.tv_sec = fr_delay/1000;
+		tv.tv_usec = (fr_delay%1000)*1000;
+		(void)select(0, NULL, NULL, NULL, &tv);
+	}
+	if(argc >= 2) {
+		size_t kl = argl[1] < sizeof(key)-1?argl[1]:sizeof(key)-1;
+		memmove(key, argv[1], kl);
+		key[kl] = 0;
+	} else	key[0] = 0;
+	if(fr_cmd_is(argv[0], argl[0], "PING") && argc == 1) {
+		fr_reply_line(s, "+PONG\r\n");
+	} else if(fr_cmd_is(argv[0], argl[0], "GET") && argc == 2) {
+		e = fr_find(key);
+		if(fr_print)
+			printf("GET %s %s\n", key, e?"hit":"miss");
+		if(!e) {
+			fr_reply_line(s, "$-1\r\n");
+			return;
+		}
+		snprintf(hdr, sizeof(hdr), "$%d\r\n", (int)e->len);
+		fr_reply_line(s, hdr);
+		fr_write(s, e->val, e->len);
+		fr_reply_line(s, "\r\n");
+	} else if((fr_cmd_is(argv[0], argl[0], "SET") && argc == 3) ||
+		(fr_cmd_is(argv[0], argl[0], "SETEX") && argc == 4)) {
+		if(fr_print)
+			printf("SET %s %d bytes\n", key, (int)argl[argc-1]);
+		if(!fr_set(key, argv[argc-1], argl[argc-1]))
+			fr_reply_line(s, "-ERR out of memory\r\n");
+		else	fr_reply_line(s, "+OK\r\n");
+	} else {
+		fr_reply_line(s, "-ERR unknown command\r\n");
+	}
+}
+
+/** read from the client and handle the commands, false if it closed */
+static int
+fr_client_read(struct fr_client* c)
+{
+	uint8_t* argv[FR_MAX_ARGS];
+	size_t argl[FR_MAX_ARGS];
+	int argc, n;
+	ssize_t r = recv(c->s, (void*)(c->buf+c->len), sizeof(c->buf)-c->len,
+		0);
+	if(r == -1) {
+		if(errno == EINTR || errno == EAGAIN)
+			return 1;
+		log_err("recv: %s", strerror(errno));
+		return 0;
+	}
+	if(r == 0)
+		return 0;
+	c->len += (size_t)r;
+	/* the commands that are complete, the pipelined ones in order */
+	while((n = fr_parse(c->buf, c->len, argv, argl, &argc)) > 0) {
+		fr_command(c->s, argv, argl, argc);
+		memmove(c->buf, c->buf+n, c->len-(size_t)n);
+		c->len -= (size_t)n;
+	}
+	fflush(stdout);
+	if(n == -1 || c->len == sizeof(c->buf)) {
+		log_err("malformed command, connection closed");
+		return 0;
+	}
+	return 1;
+}
+
+/** accept a new client */
+static void
+fr_accept(int ls, struct fr_client* clients)
+{
+	int i, s = accept(ls, NULL, NULL);
+	if(s == -1) {
+		log_err("accept: %s", strerror(errno));
+		return;
+	}
+	for(i=0; i<FR_MAX_CLIENTS; i++) {
+		if(clients[i].s == -1) {
+			clients[i].s = s;
+			clients[i].len = 0;
+			if(fr_print)
+				printf("connection %d\n", i);
+			return;
+		}
+	}
+	log_err("too many connections");
+	sock_close(s);
+}
+
+/** listen and serve */
+static void
+fr_service(int port)
+{
+	struct sockaddr_in sa;
+	struct fr_client* clients;
+	fd_set rset;
+	int ls, i, m, on = 1;
+	clients = (struct fr_client*)calloc(FR_MAX_CLIENTS, sizeof(*clients));
+	if(!clients)
+		fatal_exit("out of memory");
+	for(i=0; i<FR_MAX_CLIENTS; i++)
+		clients[i].s = -1;
+	ls = socket(AF_INET, SOCK_STREAM, 0);
+	if(ls == -1)
+		fatal_exit("socket: %s", strerror(errno));
+	if(setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, (void*)&on,
+		(socklen_t)sizeof(on)) < 0)
+		fatal_exit("setsockopt: %s", strerror(errno));
+	memset(&sa, 0, sizeof(sa));
+	sa.sin_family = AF_INET;
+	sa.sin_port = htons((uint16_t)port);
+	sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if(bind(ls, (struct sockaddr*)&sa, (socklen_t)sizeof(sa)) == -1)
+		fatal_exit("bind: %s", strerror(errno));
+	if(listen(ls, 5) == -1)
+		fatal_exit("listen: %s", strerror(errno));
+	printf("fakeredis start on port %d\n", port);
+	fflush(stdout);
+
+	while(!fr_quit) {
+		FD_ZERO(&rset);
+		FD_SET(ls, &rset);
+		m = ls;
+		for(i=0; i<FR_MAX_CLIENTS; i++) {
+			if(clients[i].s == -1)
+				continue;
+			FD_SET(clients[i].s, &rset);
+			if(clients[i].s > m)
+				m = clients[i].s;
+		}
+		if(select(m+1, &rset, NULL, NULL, NULL) == -1) {
+			if(errno == EINTR)
+				continue;
+			fatal_exit("select: %s", strerror(errno));
+		}
+		if(FD_ISSET(ls, &rset))
+			fr_accept(ls, clients);
+		for(i=0; i<FR_MAX_CLIENTS; i++) {
+			if(clients[i].s == -1 || !FD_ISSET(clients[i].s, &rset))
+				continue;
+			if(!fr_client_read(&clients[i])) {
+				if(fr_print)
+					printf("connection %d closed\n", i);
+				sock_close(clients[i].s);
+				clients[i].s = -1;
+			}
+		}
+		fflush(stdout);
+	}
+	for(i=0; i<FR_MAX_CLIENTS; i++)
+		if(clients[i].s != -1)
+			sock_close(clients[i].s);
+	sock_close(ls);
+	free(clients);
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** main program for fakeredis */
+int main(int argc, char** argv)
+{
+	int c, port = 6379;
+	struct fr_entry* e, *ne;
+	log_init(0, 0, 0);
+	log_ident_set("fakeredis");
+	while( (c=getopt(argc, argv, "d:hp:v")) != -1) {
+		switch(c) {
+			case 'd':
+				if(atoi(optarg)==0 && strcmp(optarg,"0")!=0) {
+					printf("bad delay: %s\n", optarg);
+					return 1;
+				}
+				fr_delay = atoi(optarg);
+				break;
+			case 'p':
+				if(atoi(optarg)==0) {
+					printf("bad port nr: %s\n", optarg);
+					return 1;
+				}
+				port = atoi(optarg);
+				break;
+			case 'v':
+				fr_print = 1;
+				break;
+			case 'h':
+			case '?':
+			default:
+				usage(argv);
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc != 0)
+		usage(argv);
+	if(signal(SIGINT, fr_sigh) == SIG_ERR ||
+		signal(SIGTERM, fr_sigh) == SIG_ERR)
+		fatal_exit("could not bind signal handler");
+#ifdef SIGPIPE
+	(void)signal(SIGPIPE, SIG_IGN);
+#endif
+	fr_service(port);
+	for(e = fr_data; e; e = ne) {
+		ne = e->next;
+		free(e->key);
+		free(e->val);
+		free(e);
+	}
+	return 0;
+}
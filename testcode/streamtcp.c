@@ -46,6 +46,7 @@
 #include <signal.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <sys/time.h>
 #include "util/locks.h"
 #include "util/log.h"
 #include "util/net_help.h"
@@ -65,6 +66,18 @@
 #define PF_INET6 10
 #endif
 
+/** if the received answers are not printed */
+static int quiet = 0;
+#ifdef MSG_WAITALL
+/** recv flags to get the full length or packet from the stream */
+#define RECV_WAITALL MSG_WAITALL
+#else
+#define RECV_WAITALL 0
+#endif
+
+/** number of pipelined queries in flight, for the burst test */
+#define BURST_WINDOW 200
+
 /** usage information for streamtcp */
 static void usage(char* argv[])
 {
@@ -75,7 +88,15 @@ static void usage(char* argv[])
 	printf("-n 		do not wait for an answer.\n");
 	printf("-a 		print answers as they arrive.\n");
 	printf("-d secs		delay after connection before sending query\n");
+	printf("-w secs		with -a, wait after sending the queries before\n");
+	printf("		reading the answers\n");
 	printf("-s		use ssl\n");
+	printf("-c num		connect num times, send the queries on every\n");
+	printf("		connection and print the timing, quietly\n");
+	printf("-r		with -c and -s, resume the TLS session of the\n");
+	printf("		previous connection\n");
+	printf("-b num		send the queries num times, pipelined on one\n");
+	printf("		connection, and print the timing, quietly\n");
 	printf("-h 		this help text\n");
 	exit(1);
 }
@@ -152,27 +173,16 @@ write_q(int fd, int udp, SSL* ssl, sldns_buffer* buf, uint16_t id,
 			attach_edns_record(buf, &edns);
 	}
 
-	/* send it */
+	/* send it, with the length in front for TCP, in one write, so the
+	 * query is not split up over packets */
 	if(!udp) {
 		len = (uint16_t)sldns_buffer_limit(buf);
-		len = htons(len);
-		if(ssl) {
-			if(SSL_write(ssl, (void*)&len, (int)sizeof(len)) <= 0) {
-				log_crypto_err("cannot SSL_write");
-				exit(1);
-			}
-		} else {
-			if(send(fd, (void*)&len, sizeof(len), 0) <
-				(ssize_t)sizeof(len)){
-#ifndef USE_WINSOCK
-				perror("send() len failed");
-#else
-				printf("send len: %s\n", 
-					wsa_strerror(WSAGetLastError()));
-#endif
-				exit(1);
-			}
-		}
+		if(sldns_buffer_capacity(buf) < (size_t)len + sizeof(len))
+			fatal_exit("query too long");
+		memmove(sldns_buffer_at(buf, sizeof(len)),
+			sldns_buffer_begin(buf), len);
+		sldns_buffer_set_limit(buf, (size_t)len + sizeof(len));
+		sldns_buffer_write_u16_at(buf, 0, len);
 	}
 	if(ssl) {
 		if(SSL_write(ssl, (void*)sldns_buffer_begin(buf),
@@ -215,7 +225,8 @@ recv_one(int fd, int udp, SSL* ssl, sldns_buffer* buf)
 				exit(1);
 			}
 		} else {
-			ssize_t r = recv(fd, (void*)&len, sizeof(len), 0);
+			ssize_t r = recv(fd, (void*)&len, sizeof(len),
+				RECV_WAITALL);
 			if(r == 0) {
 				printf("recv: stream closed\n");
 				exit(1);
@@ -243,7 +254,8 @@ recv_one(int fd, int udp, SSL* ssl, sldns_buffer* buf)
 			if(r != (int)len)
 				fatal_exit("ssl_read %d of %d", r, len);
 		} else {
-			if(recv(fd, (void*)sldns_buffer_begin(buf), len, 0) < 
+			if(recv(fd, (void*)sldns_buffer_begin(buf), len,
+				RECV_WAITALL) < 
 				(ssize_t)len) {
 #ifndef USE_WINSOCK
 				perror("read() data failed");
@@ -270,6 +282,8 @@ recv_one(int fd, int udp, SSL* ssl, sldns_buffer* buf)
 		sldns_buffer_set_limit(buf, (size_t)l);
 		len = (size_t)l;
 	}
+	if(quiet)
+		return;
 	printf("\nnext received packet\n");
 	printf("data[%d] ", (int)sldns_buffer_limit(buf));
 	for(i=0; i<sldns_buffer_limit(buf); i++) {
@@ -294,6 +308,12 @@ print_any_answers(int fd, int udp, SSL* ssl, sldns_buffer* buf,
 	struct timeval tv, *waittv;
 	fd_set rfd;
 	while(*num_answers > 0) {
+		if(ssl && SSL_pending(ssl) > 0) {
+			/* the answer is already read into the ssl buffer */
+			(*num_answers) -= 1;
+			recv_one(fd, udp, ssl, buf);
+			continue;
+		}
 		memset(&rfd, 0, sizeof(rfd));
 		memset(&tv, 0, sizeof(tv));
 		FD_ZERO(&rfd);
@@ -324,10 +344,28 @@ static int get_random(void)
 	return (int)arc4random();
 }
 
+/** perform the TLS handshake on the blocking socket */
+static void
+ssl_handshake_wait(SSL* ssl)
+{
+	while(1) {
+		int r;
+		ERR_clear_error();
+		if( (r=SSL_do_handshake(ssl)) == 1)
+			break;
+		r = SSL_get_error(ssl, r);
+		if(r != SSL_ERROR_WANT_READ &&
+			r != SSL_ERROR_WANT_WRITE) {
+			log_crypto_err("could not ssl_handshake");
+			exit(1);
+		}
+	}
+}
+
 /** send the TCP queries and print answers */
 static void
 send_em(const char* svr, int udp, int usessl, int noanswer, int onarrival,
-	int delay, int num, char** qs)
+	int delay, int wait, int num, char** qs)
 {
 	sldns_buffer* buf = sldns_buffer_new(65553);
 	int fd = open_svr(svr, udp);
@@ -340,18 +378,7 @@ send_em(const char* svr, int udp, int usessl, int noanswer, int onarrival,
 		if(!ctx) fatal_exit("cannot create ssl ctx");
 		ssl = outgoing_ssl_fd(ctx, fd);
 		if(!ssl) fatal_exit("cannot create ssl");
-		while(1) {
-			int r;
-			ERR_clear_error();
-			if( (r=SSL_do_handshake(ssl)) == 1)
-				break;
-			r = SSL_get_error(ssl, r);
-			if(r != SSL_ERROR_WANT_READ &&
-				r != SSL_ERROR_WANT_WRITE) {
-				log_crypto_err("could not ssl_handshake");
-				exit(1);
-			}
-		}
+		ssl_handshake_wait(ssl);
 		if(1) {
 			X509* x = SSL_get_peer_certificate(ssl);
 			if(!x) printf("SSL: no peer certificate\n");
@@ -375,11 +402,21 @@ send_em(const char* svr, int udp, int usessl, int noanswer, int onarrival,
 		/* print at least one result */
 		if(onarrival) {
 			wait_results += 1; /* one more answer to fetch */
-			print_any_answers(fd, udp, ssl, buf, &wait_results, 0);
+			if(!wait)
+				print_any_answers(fd, udp, ssl, buf,
+					&wait_results, 0);
 		} else if(!noanswer) {
 			recv_one(fd, udp, ssl, buf);
 		}
 	}
+	if(onarrival && wait) {
+		/* the answers wait on the other side */
+#ifdef HAVE_SLEEP
+		sleep((unsigned)wait);
+#else
+		Sleep(wait*1000);
+#endif
+	}
 	if(onarrival)
 		print_any_answers(fd, udp, ssl, buf, &wait_results, 1);
 
@@ -393,6 +430,127 @@ send_em(const char* svr, int udp, int usessl, int noanswer, int onarrival,
 	printf("orderly exit\n");
 }
 
+/** connect num_conn times in sequence, and send the queries on every
+ * connection, to measure the connection setup rate */
+static void
+churn_em(const char* svr, int usessl, int resume, int num_conn, int num,
+	char** qs)
+{
+	sldns_buffer* buf = sldns_buffer_new(65553);
+	SSL_CTX* ctx = NULL;
+	SSL_SESSION* sess = NULL;
+	int c, i, resumed = 0;
+	struct timeval start, end;
+	double dt;
+	if(!buf) fatal_exit("out of memory");
+	if(usessl) {
+		ctx = connect_sslctx_create(NULL, NULL, NULL, 0);
+		if(!ctx) fatal_exit("cannot create ssl ctx");
+	}
+	quiet = 1;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(c=0; c<num_conn; c++) {
+		int fd = open_svr(svr, 0);
+		SSL* ssl = NULL;
+		if(usessl) {
+			ssl = outgoing_ssl_fd(ctx, fd);
+			if(!ssl) fatal_exit("cannot create ssl");
+			if(resume && sess && !SSL_set_session(ssl, sess))
+				log_crypto_err("could not SSL_set_session");
+			ssl_handshake_wait(ssl);
+			if(SSL_session_reused(ssl))
+				resumed++;
+		}
+		for(i=0; i<num; i+=3) {
+			write_q(fd, 0, ssl, buf, (uint16_t)get_random(), qs[i],
+				qs[i+1], qs[i+2]);
+			recv_one(fd, 0, ssl, buf);
+		}
+		if(usessl) {
+			if(resume) {
+				/* with TLS 1.3 the session arrives after the
+				 * handshake, with the answers */
+				SSL_SESSION* s = SSL_get1_session(ssl);
+				if(s) {
+					if(sess)
+						SSL_SESSION_free(sess);
+					sess = s;
+				}
+			}
+			SSL_shutdown(ssl);
+			SSL_free(ssl);
+		}
+		sock_close(fd);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+	printf("%d connections, %d resumed, %d queries in %.6f sec, "
+		"%.1f connections/sec\n", num_conn, resumed,
+		num_conn*(num/3), dt, (dt>0)?((double)num_conn/dt):0.);
+	if(sess)
+		SSL_SESSION_free(sess);
+	if(ctx)
+		SSL_CTX_free(ctx);
+	sldns_buffer_free(buf);
+}
+
+/** send the queries num_burst times pipelined on one connection, without
+ * waiting for the answers, to measure the stream throughput */
+static void
+burst_em(const char* svr, int usessl, int num_burst, int num, char** qs)
+{
+	sldns_buffer* buf = sldns_buffer_new(65553);
+	int fd = open_svr(svr, 0);
+	int b, i, wait_results = 0, sent = 0;
+	SSL_CTX* ctx = NULL;
+	SSL* ssl = NULL;
+	struct timeval start, end;
+	double dt;
+	if(!buf) fatal_exit("out of memory");
+	if(usessl) {
+		ctx = connect_sslctx_create(NULL, NULL, NULL, 0);
+		if(!ctx) fatal_exit("cannot create ssl ctx");
+		ssl = outgoing_ssl_fd(ctx, fd);
+		if(!ssl) fatal_exit("cannot create ssl");
+		ssl_handshake_wait(ssl);
+	}
+	quiet = 1;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(b=0; b<num_burst; b++) {
+		for(i=0; i<num; i+=3) {
+			write_q(fd, 0, ssl, buf, (uint16_t)get_random(), qs[i],
+				qs[i+1], qs[i+2]);
+			sent++;
+			wait_results++;
+			/* fetch the answers that have arrived, and keep
+			 * the number in flight limited */
+			print_any_answers(fd, 0, ssl, buf, &wait_results, 0);
+			while(wait_results >= BURST_WINDOW) {
+				recv_one(fd, 0, ssl, buf);
+				wait_results--;
+			}
+		}
+	}
+	print_any_answers(fd, 0, ssl, buf, &wait_results, 1);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+	printf("%d queries in %.6f sec, %.1f queries/sec\n", sent, dt,
+		(dt>0)?((double)sent/dt):0.);
+	if(usessl) {
+		SSL_shutdown(ssl);
+		SSL_free(ssl);
+		SSL_CTX_free(ctx);
+	}
+	sock_close(fd);
+	sldns_buffer_free(buf);
+}
+
 #ifdef SIGPIPE
 /** SIGPIPE handler */
 static RETSIGTYPE sigh(int sig)
@@ -421,6 +579,10 @@ int main(int argc, char** argv)
 	int onarrival = 0;
 	int usessl = 0;
 	int delay = 0;
+	int wait = 0;
+	int num_conn = 0;
+	int num_burst = 0;
+	int resume = 0;
 
 #ifdef USE_WINSOCK
 	WSADATA wsa_data;
@@ -445,7 +607,7 @@ int main(int argc, char** argv)
 	if(argc == 1) {
 		usage(argv);
 	}
-	while( (c=getopt(argc, argv, "af:hnsud:")) != -1) {
+	while( (c=getopt(argc, argv, "ab:c:f:hnrsud:w:")) != -1) {
 		switch(c) {
 			case 'f':
 				svr = optarg;
@@ -453,9 +615,28 @@ int main(int argc, char** argv)
 			case 'a':
 				onarrival = 1;
 				break;
+			case 'b':
+				num_burst = atoi(optarg);
+				if(num_burst < 1) {
+					printf("error parsing burst, "
+					    "number expected: %s\n", optarg);
+					return 1;
+				}
+				break;
+			case 'c':
+				num_conn = atoi(optarg);
+				if(num_conn < 1) {
+					printf("error parsing connections, "
+					    "number expected: %s\n", optarg);
+					return 1;
+				}
+				break;
 			case 'n':
 				noanswer = 1;
 				break;
+			case 'r':
+				resume = 1;
+				break;
 			case 'u':
 				udp = 1;
 				break;
@@ -470,6 +651,14 @@ int main(int argc, char** argv)
 				}
 				delay = atoi(optarg);
 				break;
+			case 'w':
+				if(atoi(optarg)==0 && strcmp(optarg,"0")!=0) {
+					printf("error parsing wait, "
+					    "number expected: %s\n", optarg);
+					return 1;
+				}
+				wait = atoi(optarg);
+				break;
 			case 'h':
 			case '?':
 			default:
@@ -502,7 +691,12 @@ int main(int argc, char** argv)
 		(void)OPENSSL_init_ssl(OPENSSL_INIT_LOAD_SSL_STRINGS, NULL);
 #endif
 	}
-	send_em(svr, udp, usessl, noanswer, onarrival, delay, argc, argv);
+	if(num_burst)
+		burst_em(svr, usessl, num_burst, argc, argv);
+	else if(num_conn)
+		churn_em(svr, usessl, resume, num_conn, argc, argv);
+	else	send_em(svr, udp, usessl, noanswer, onarrival, delay, wait,
+			argc, argv);
 	checklock_stop();
 #ifdef USE_WINSOCK
 	WSACleanup();
@@ -44,10 +44,14 @@
 #include "util/net_help.h"
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/module.h"
+#include "util/storage/slabhash.h"
 #include "services/cache/dns.h"
 #include "sldns/str2wire.h"
 #include "sldns/wire2str.h"
 #include "sldns/sbuffer.h"
+#include <sys/time.h>
 
 /** verbosity for this test */
 static int vbmp = 0;
@@ -888,6 +892,617 @@ authzone_query_test(void)
 	check_queries("example.com", zone_example_com, example_com_queries);
 }
 
+/** read zone from file with the number of threads, returns the zone
+ * in a new auth_zones, and the time taken in sec */
+static struct auth_zones*
+load_zone_threads(const char* name, char* fname, int threads, double* sec)
+{
+	struct auth_zones* az;
+	struct auth_zone* z;
+	size_t nmlen;
+	uint8_t* nm = sldns_str2wire_dname(name, &nmlen);
+	struct config_file* cfg = config_create();
+	struct timeval start, end;
+	if(!nm || !cfg) fatal_exit("out of memory");
+	free(cfg->chrootdir);
+	cfg->chrootdir = NULL;
+	cfg->num_threads = threads;
+	az = auth_zones_create();
+	unit_assert(az);
+	lock_rw_wrlock(&az->lock);
+	z = auth_zone_create(az, nm, nmlen, LDNS_RR_CLASS_IN);
+	lock_rw_unlock(&az->lock);
+	if(!z) fatal_exit("cannot find zone");
+	auth_zone_set_zonefile(z, fname);
+	gettimeofday(&start, NULL);
+	if(!auth_zone_read_zonefile(z, cfg))
+		fatal_exit("parse failure for auth zone %s", name);
+	gettimeofday(&end, NULL);
+	lock_rw_unlock(&z->lock);
+	*sec = (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+	free(nm);
+	config_delete(cfg);
+	return az;
+}
+
+/** write the zone to a new temp file */
+static char*
+write_zone_tmp(struct auth_zones* az, const char* name)
+{
+	char* outf = create_tmp_file(NULL);
+	struct auth_zone* z;
+	size_t nmlen;
+	uint8_t* nm = sldns_str2wire_dname(name, &nmlen);
+	if(!nm) fatal_exit("out of memory");
+	z = auth_zone_find(az, nm, nmlen, LDNS_RR_CLASS_IN);
+	unit_assert(z);
+	if(!auth_zone_write_file(z, outf))
+		fatal_exit("write file failed for %s", outf);
+	free(nm);
+	return outf;
+}
+
+/** make a zonefile with num record groups, with the parentheses,
+ * comments, quotes and $ entries that the parallel parse has to split
+ * around */
+static char*
+create_large_zone(int num, int tricky)
+{
+	char* fname = create_tmp_file(NULL);
+	FILE* out = fopen(fname, "w");
+	int i;
+	if(!out) fatal_exit("cannot open %s: %s", fname, strerror(errno));
+	fprintf(out, "$ORIGIN example.com.\n$TTL 3600\n"
+		"@ IN SOA ns.example.com. hostmaster.example.com. (\n"
+		"\t1 ; serial\n\t3600 ; refresh\n\t600 86400 300 )\n"
+		"@ IN NS ns.example.com.\nns IN A 192.0.2.1\n");
+	for(i=0; i<num; i++) {
+		if(!tricky) {
+			fprintf(out, "h%d IN A 10.%d.%d.%d\n", i,
+				(i>>16)&0xff, (i>>8)&0xff, i&0xff);
+			continue;
+		}
+		if(i%1000 == 0)
+			fprintf(out, "\n$ORIGIN s%d.example.com.\n"
+				"$TTL %d\n", i/1000, 100+i/1000);
+		fprintf(out, "h%d IN A 192.0.2.%d\n", i, i&0xff);
+		fprintf(out, "\tIN AAAA 2001:db8::%x\n", i);
+		fprintf(out, "t%d 300 IN TXT \"a;b(c\" \"d\\\"e)\" ; x ( \"\n",
+			i);
+		fprintf(out, "m%d IN MX ( 10 ; pref (\n  mail%d\n  ) ; end\n",
+			i, i);
+		fprintf(out, "; comment line ( \"\n\n");
+		fprintf(out, "  IN TXT \"esc\\\\\" \"%d\"\n", i);
+	}
+	fclose(out);
+	return fname;
+}
+
+/** check that the zone data is in compact storage, and that the memory
+ * is counted */
+static void
+check_compact(struct auth_zones* az, const char* name, size_t minnum)
+{
+	struct auth_zone* z;
+	size_t nmlen;
+	uint8_t* nm = sldns_str2wire_dname(name, &nmlen);
+	if(!nm) fatal_exit("out of memory");
+	z = auth_zone_find(az, nm, nmlen, LDNS_RR_CLASS_IN);
+	unit_assert(z);
+	unit_assert(z->compact && z->compact_num >= minnum);
+	unit_assert(z->data.count == 0);
+	unit_assert(auth_zones_get_mem(az) > z->compact_size);
+	free(nm);
+}
+
+/** zone for the answer cache test */
+static const char* zone_answer_cache =
+	"example.com.	3600	IN	SOA	ns.example.com. hostmaster.example.com. 1 3600 600 86400 300\n"
+	"example.com.	3600	IN	NS	ns.example.com.\n"
+	"ns.example.com.	3600	IN	A	192.0.2.1\n"
+	"www.example.com.	3600	IN	A	192.0.2.2\n"
+	"www.example.com.	3600	IN	AAAA	2001:db8::2\n"
+	"alias.example.com.	3600	IN	CNAME	www.example.com.\n"
+	"*.wild.example.com.	3600	IN	A	192.0.2.3\n"
+	"sub.example.com.	3600	IN	NS	ns.sub.example.com.\n"
+	"ns.sub.example.com.	3600	IN	A	192.0.2.4\n";
+
+/** create auth zones from config with the zonefile, and answer cache */
+static struct auth_zones*
+answer_cache_zones(char* fname, size_t cachesize)
+{
+	struct auth_zones* az = auth_zones_create();
+	struct config_file* cfg = config_create();
+	int is_rpz = 0;
+	if(!az || !cfg) fatal_exit("out of memory");
+	free(cfg->chrootdir);
+	cfg->chrootdir = NULL;
+	cfg->auths = (struct config_auth*)calloc(1, sizeof(*cfg->auths));
+	if(!cfg->auths) fatal_exit("out of memory");
+	cfg->auths->name = strdup("example.com");
+	cfg->auths->zonefile = strdup(fname);
+	if(!cfg->auths->name || !cfg->auths->zonefile)
+		fatal_exit("out of memory");
+	cfg->auths->for_downstream = 1;
+	cfg->auths->answer_cache_size = cachesize;
+	if(!auth_zones_apply_cfg(az, cfg, 0, &is_rpz))
+		fatal_exit("could not apply auth zones config");
+	config_delete(cfg);
+	return az;
+}
+
+/** number of entries in the answer cache of the zone */
+static size_t
+answer_cache_count(struct auth_zones* az)
+{
+	uint8_t nm[] = "\007example\003com";
+	struct auth_zone* z = auth_zone_find(az, nm, sizeof(nm),
+		LDNS_RR_CLASS_IN);
+	size_t i, num = 0;
+	unit_assert(z && z->answer_cache);
+	for(i=0; i<z->answer_cache->size; i++) {
+		lock_quick_lock(&z->answer_cache->array[i]->lock);
+		num += z->answer_cache->array[i]->num;
+		lock_quick_unlock(&z->answer_cache->array[i]->lock);
+	}
+	return num;
+}
+
+/** read the zonefile again */
+static void
+answer_cache_reload(struct auth_zones* az)
+{
+	uint8_t nm[] = "\007example\003com";
+	struct config_file* cfg = config_create();
+	struct auth_zone* z;
+	if(!cfg) fatal_exit("out of memory");
+	free(cfg->chrootdir);
+	cfg->chrootdir = NULL;
+	lock_rw_rdlock(&az->lock);
+	z = auth_zone_find(az, nm, sizeof(nm), LDNS_RR_CLASS_IN);
+	unit_assert(z);
+	lock_rw_wrlock(&z->lock);
+	lock_rw_unlock(&az->lock);
+	unit_assert(auth_zone_read_zonefile(z, cfg));
+	lock_rw_unlock(&z->lock);
+	config_delete(cfg);
+}
+
+/** answer query from the auth zones, the answer is in buf */
+static void
+answer_cache_query(struct auth_zones* az, sldns_buffer* buf,
+	const char* name, uint16_t qtype, uint16_t id, uint16_t flags,
+	int edns_present, uint16_t udpsize, int dnssec)
+{
+	struct regional* region = regional_create();
+	struct module_env env;
+	struct query_info qinfo;
+	struct edns_data edns;
+	struct timeval now;
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t nmlen = sizeof(nm);
+	if(!region) fatal_exit("out of memory");
+	if(sldns_str2wire_dname_buf(name, nm, &nmlen) != 0)
+		fatal_exit("bad name %s", name);
+	sldns_buffer_clear(buf);
+	sldns_buffer_write_u16(buf, id);
+	sldns_buffer_write_u16(buf, flags);
+	sldns_buffer_write_u16(buf, 1);
+	sldns_buffer_write_u16(buf, 0);
+	sldns_buffer_write_u16(buf, 0);
+	sldns_buffer_write_u16(buf, (edns_present?1:0));
+	sldns_buffer_write(buf, nm, nmlen);
+	sldns_buffer_write_u16(buf, qtype);
+	sldns_buffer_write_u16(buf, LDNS_RR_CLASS_IN);
+	if(edns_present) {
+		sldns_buffer_write_u8(buf, 0);
+		sldns_buffer_write_u16(buf, LDNS_RR_TYPE_OPT);
+		sldns_buffer_write_u16(buf, udpsize);
+		sldns_buffer_write_u16(buf, 0);
+		sldns_buffer_write_u16(buf, (dnssec?EDNS_DO:0));
+		sldns_buffer_write_u16(buf, 0);
+	}
+	sldns_buffer_flip(buf);
+
+	memset(&env, 0, sizeof(env));
+	gettimeofday(&now, NULL);
+	env.now_tv = &now;
+	unit_assert(query_info_parse(&qinfo, buf));
+	unit_assert(parse_edns_from_pkt(buf, &edns, region) == 0);
+	if(!edns.edns_present)
+		edns.udp_size = udpsize;
+	unit_assert(auth_zones_answer(az, &env, &qinfo, &edns, NULL, buf,
+		region));
+	regional_destroy(region);
+}
+
+/** check that the answer from the answer cache is the same as the one
+ * without cache */
+static void
+answer_cache_check(struct auth_zones* azc, struct auth_zones* az,
+	const char* name, uint16_t qtype, uint16_t id, uint16_t flags,
+	int edns_present, uint16_t udpsize, int dnssec)
+{
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	sldns_buffer* ref = sldns_buffer_new(65535);
+	if(!buf || !ref) fatal_exit("out of memory");
+	answer_cache_query(az, ref, name, qtype, id, flags, edns_present,
+		udpsize, dnssec);
+	answer_cache_query(azc, buf, name, qtype, id, flags, edns_present,
+		udpsize, dnssec);
+	if(vbmp) {
+		char* s = sldns_wire2str_pkt(sldns_buffer_begin(buf),
+			sldns_buffer_limit(buf));
+		printf("answer %s", s?s:"null");
+		free(s);
+	}
+	unit_assert(sldns_buffer_limit(buf) == sldns_buffer_limit(ref));
+	unit_assert(memcmp(sldns_buffer_begin(buf), sldns_buffer_begin(ref),
+		sldns_buffer_limit(ref)) == 0);
+	sldns_buffer_free(buf);
+	sldns_buffer_free(ref);
+}
+
+/** Test the answer cache for downstream auth zone answers */
+static void
+authzone_answer_cache_test(void)
+{
+	struct auth_zones* az, *azc;
+	char* fname;
+	FILE* out;
+	int i;
+	if(vbmp) printf("Testing auth zone answer cache\n");
+	fname = create_tmp_file(zone_answer_cache);
+	/* a large rrset that does not fit in a small udp answer */
+	out = fopen(fname, "a");
+	if(!out) fatal_exit("cannot open %s", fname);
+	for(i=0; i<40; i++)
+		fprintf(out, "big.example.com.\t3600\tIN\tTXT\t\"%d "
+			"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\"\n",
+			i);
+	/* a referral with more glue than fits in a small udp answer */
+	for(i=0; i<10; i++) {
+		int j;
+		fprintf(out, "glue.example.com.\t3600\tIN\tNS\t"
+			"ns%d.glue.example.com.\n", i);
+		for(j=0; j<5; j++)
+			fprintf(out, "ns%d.glue.example.com.\t3600\tIN\tA\t"
+				"192.0.2.%d\n", i, 100+i*5+j);
+	}
+	fclose(out);
+	az = answer_cache_zones(fname, 0);
+	azc = answer_cache_zones(fname, 1024*1024);
+	unit_assert(answer_cache_count(azc) == 0);
+
+	/* the first stores the answer, the next are from the cache, with
+	 * another ID, qname case, flags and EDNS */
+	answer_cache_check(azc, az, "www.example.com.", LDNS_RR_TYPE_A,
+		1, BIT_RD, 1, 4096, 0);
+	unit_assert(answer_cache_count(azc) == 1);
+	answer_cache_check(azc, az, "www.example.com.", LDNS_RR_TYPE_A,
+		2, BIT_RD, 1, 4096, 0);
+	answer_cache_check(azc, az, "WwW.eXaMpLe.CoM.", LDNS_RR_TYPE_A,
+		3, BIT_CD, 1, 1232, 0);
+	answer_cache_check(azc, az, "www.example.com.", LDNS_RR_TYPE_A,
+		4, 0, 0, 512, 0);
+	unit_assert(answer_cache_count(azc) == 1);
+	/* the DO bit is part of the key */
+	answer_cache_check(azc, az, "www.example.com.", LDNS_RR_TYPE_A,
+		5, BIT_RD, 1, 4096, 1);
+	answer_cache_check(azc, az, "Www.example.com.", LDNS_RR_TYPE_A,
+		6, BIT_RD, 1, 4096, 1);
+	unit_assert(answer_cache_count(azc) == 2);
+
+	/* cname, nodata, nxdomain, wildcard, referral */
+	for(i=0; i<2; i++) {
+		answer_cache_check(azc, az, "alias.example.com.",
+			LDNS_RR_TYPE_A, 10+i, BIT_RD, 1, 4096, 0);
+		answer_cache_check(azc, az, "www.example.com.",
+			LDNS_RR_TYPE_MX, 20+i, BIT_RD, 1, 4096, 0);
+		answer_cache_check(azc, az, "nx.example.com.",
+			LDNS_RR_TYPE_A, 30+i, BIT_RD, 1, 4096, 0);
+		answer_cache_check(azc, az, "a.wild.example.com.",
+			LDNS_RR_TYPE_A, 40+i, BIT_RD, 1, 4096, 0);
+		answer_cache_check(azc, az, "Foo.Sub.example.com.",
+			LDNS_RR_TYPE_A, 50+i, BIT_RD, 0, 512, 0);
+	}
+	unit_assert(answer_cache_count(azc) == 7);
+
+	/* a large answer is truncated for small udp sizes, like without
+	 * the cache, and from the cache when it fits */
+	answer_cache_check(azc, az, "big.example.com.", LDNS_RR_TYPE_TXT,
+		60, BIT_RD, 1, 1232, 0);
+	answer_cache_check(azc, az, "big.example.com.", LDNS_RR_TYPE_TXT,
+		61, BIT_RD, 0, 512, 0);
+	answer_cache_check(azc, az, "big.example.com.", LDNS_RR_TYPE_TXT,
+		62, BIT_RD, 1, 65535, 0);
+	answer_cache_check(azc, az, "big.example.com.", LDNS_RR_TYPE_TXT,
+		63, BIT_RD, 1, 1232, 0);
+	unit_assert(answer_cache_count(azc) == 8);
+
+	/* glue left out of the additional section, without the TC bit,
+	 * is not stored, the complete answer is */
+	answer_cache_check(azc, az, "www.glue.example.com.", LDNS_RR_TYPE_A,
+		64, BIT_RD, 0, 512, 0);
+	unit_assert(answer_cache_count(azc) == 8);
+	answer_cache_check(azc, az, "www.glue.example.com.", LDNS_RR_TYPE_A,
+		65, BIT_RD, 1, 4096, 0);
+	unit_assert(answer_cache_count(azc) == 9);
+	answer_cache_check(azc, az, "www.glue.example.com.", LDNS_RR_TYPE_A,
+		66, BIT_RD, 0, 512, 0);
+	answer_cache_check(azc, az, "www.glue.example.com.", LDNS_RR_TYPE_A,
+		67, BIT_RD, 1, 4096, 0);
+
+	/* loading the zone again clears the cache */
+	answer_cache_reload(azc);
+	unit_assert(answer_cache_count(azc) == 0);
+	answer_cache_check(azc, az, "www.example.com.", LDNS_RR_TYPE_A,
+		70, BIT_RD, 1, 4096, 0);
+	unit_assert(answer_cache_count(azc) == 1);
+
+	auth_zones_delete(az);
+	auth_zones_delete(azc);
+	del_tmp_file(fname);
+}
+
+/** Test that the parallel zonefile parse gives the same zone */
+static void
+authzone_parallel_load_test(void)
+{
+	struct auth_zones* az1, *az4;
+	char* fname, *out1, *out4;
+	double t1, t4;
+	if(vbmp) printf("Testing parallel load auth zone\n");
+	fname = create_large_zone(20000, 1);
+	az1 = load_zone_threads("example.com", fname, 1, &t1);
+	az4 = load_zone_threads("example.com", fname, 4, &t4);
+	out1 = write_zone_tmp(az1, "example.com");
+	out4 = write_zone_tmp(az4, "example.com");
+	checkfile(out1, out4);
+	check_compact(az1, "example.com", 20000*3);
+	check_compact(az4, "example.com", 20000*3);
+	del_tmp_file(out1);
+	del_tmp_file(out4);
+	auth_zones_delete(az1);
+	auth_zones_delete(az4);
+	del_tmp_file(fname);
+}
+
+/** make the zonefile that create_large_zone is after the IXFRs of
+ * ixfr_serial_test, up to the serial */
+static char*
+create_ixfr_zone(int num, int serial)
+{
+	char* fname = create_tmp_file(NULL);
+	FILE* out = fopen(fname, "w");
+	int i;
+	if(!out) fatal_exit("cannot open %s: %s", fname, strerror(errno));
+	fprintf(out, "$ORIGIN example.com.\n$TTL 3600\n"
+		"@ IN SOA ns.example.com. hostmaster.example.com. "
+		"%d 3600 600 86400 300\n"
+		"@ IN NS ns.example.com.\nns IN A 192.0.2.1\n", serial);
+	for(i=0; i<num; i++) {
+		if(i == 1) {
+			fprintf(out, "h1 IN A 10.9.9.9\n");
+			if(serial == 3)
+				fprintf(out, "h1 IN AAAA 2001:db8::1\n");
+			continue;
+		}
+		if(i == 2 && serial == 2)
+			continue;
+		fprintf(out, "h%d IN A 10.%d.%d.%d\n", i,
+			(i>>16)&0xff, (i>>8)&0xff, i&0xff);
+	}
+	if(serial == 2)
+		fprintf(out, "n1 IN A 10.8.8.8\n");
+	fclose(out);
+	return fname;
+}
+
+/** put the RRs in a packet in the chunk list of the transfer */
+static void
+ixfr_add_chunk(struct auth_xfer* xfr, const char** rrs)
+{
+	struct auth_chunk* c = (struct auth_chunk*)calloc(1, sizeof(*c));
+	uint8_t buf[65535];
+	size_t pos = LDNS_HEADER_SIZE, len, dname_len;
+	int num = 0;
+	if(!c) fatal_exit("out of memory");
+	memset(buf, 0, LDNS_HEADER_SIZE);
+	LDNS_QR_SET(buf);
+	LDNS_AA_SET(buf);
+	for(; *rrs; rrs++) {
+		len = sizeof(buf)-pos;
+		if(sldns_str2wire_rr_buf(*rrs, buf+pos, &len, &dname_len,
+			3600, NULL, 0, NULL, 0) != 0)
+			fatal_exit("cannot parse RR %s", *rrs);
+		pos += len;
+		num++;
+	}
+	sldns_write_uint16(buf+LDNS_ANCOUNT_OFF, (uint16_t)num);
+	c->data = memdup(buf, pos);
+	c->len = pos;
+	if(!c->data) fatal_exit("out of memory");
+	if(xfr->task_transfer->chunks_last)
+		xfr->task_transfer->chunks_last->next = c;
+	else	xfr->task_transfer->chunks_first = c;
+	xfr->task_transfer->chunks_last = c;
+}
+
+/** delete the chunks of the transfer */
+static void
+ixfr_clear_chunks(struct auth_xfer* xfr)
+{
+	struct auth_chunk* c = xfr->task_transfer->chunks_first, *n;
+	while(c) {
+		n = c->next;
+		free(c->data);
+		free(c);
+		c = n;
+	}
+	xfr->task_transfer->chunks_first = NULL;
+	xfr->task_transfer->chunks_last = NULL;
+}
+
+/** first IXFR, changes and removes a domain, and adds one */
+static const char* ixfr_serial2[] = {
+	"example.com. 3600 IN SOA ns.example.com. hostmaster.example.com. 2 3600 600 86400 300",
+	"example.com. 3600 IN SOA ns.example.com. hostmaster.example.com. 1 3600 600 86400 300",
+	"h1.example.com. 3600 IN A 10.0.0.1",
+	"h2.example.com. 3600 IN A 10.0.0.2",
+	"example.com. 3600 IN SOA ns.example.com. hostmaster.example.com. 2 3600 600 86400 300",
+	"h1.example.com. 3600 IN A 10.9.9.9",
+	"n1.example.com. 3600 IN A 10.8.8.8",
+	"example.com. 3600 IN SOA ns.example.com. hostmaster.example.com. 2 3600 600 86400 300",
+	NULL
+};
+
+/** second IXFR, adds to the changed domain, and brings the removed
+ * domain back and removes the added one */
+static const char* ixfr_serial3[] = {
+	"example.com. 3600 IN SOA ns.example.com. hostmaster.example.com. 3 3600 600 86400 300",
+	"example.com. 3600 IN SOA ns.example.com. hostmaster.example.com. 2 3600 600 86400 300",
+	"n1.example.com. 3600 IN A 10.8.8.8",
+	"example.com. 3600 IN SOA ns.example.com. hostmaster.example.com. 3 3600 600 86400 300",
+	"h1.example.com. 3600 IN AAAA 2001:db8::1",
+	"h2.example.com. 3600 IN A 10.0.0.2",
+	"example.com. 3600 IN SOA ns.example.com. hostmaster.example.com. 3 3600 600 86400 300",
+	NULL
+};
+
+/** apply the IXFR to the zone, and check the zone contents, returns the
+ * time it took in sec */
+static double
+ixfr_apply_check(struct auth_zones* az, struct auth_xfer* xfr,
+	struct module_env* env, const char** rrs, int num, int serial)
+{
+	struct timeval start, end;
+	char* fname, *out1, *out2;
+	struct auth_zones* az2;
+	double sec;
+	int ixfr_fail = 0;
+	ixfr_add_chunk(xfr, rrs);
+	gettimeofday(&start, NULL);
+	if(!xfr_process_chunk_list(xfr, env, &ixfr_fail))
+		fatal_exit("could not apply IXFR");
+	gettimeofday(&end, NULL);
+	ixfr_clear_chunks(xfr);
+	unit_assert(!ixfr_fail && xfr->serial == (uint32_t)serial);
+	fname = create_ixfr_zone(num, serial);
+	az2 = load_zone_threads("example.com", fname, 1, &sec);
+	out1 = write_zone_tmp(az, "example.com");
+	out2 = write_zone_tmp(az2, "example.com");
+	checkfile(out1, out2);
+	del_tmp_file(out1);
+	del_tmp_file(out2);
+	del_tmp_file(fname);
+	auth_zones_delete(az2);
+	return (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+}
+
+/** apply two IXFRs to a compact zone with num domains. The changed
+ * domains are put over the compact data, so the cost is that of the
+ * changes.  The small zone is compacted again when the changes become
+ * many. */
+static void
+ixfr_serial_test(int num)
+{
+	uint8_t nm[] = "\007example\003com";
+	struct auth_zones* az;
+	struct auth_zone* z;
+	struct auth_xfer* xfr;
+	uint8_t* compact;
+	struct config_file* cfg = config_create();
+	struct module_env env;
+	time_t now = 0;
+	char* fname;
+	double t2, t3;
+	if(!cfg) fatal_exit("out of memory");
+	fname = create_large_zone(num, 0);
+	az = load_zone_threads("example.com", fname, 1, &t2);
+	del_tmp_file(fname);
+	lock_rw_wrlock(&az->lock);
+	z = auth_zone_find(az, nm, sizeof(nm), LDNS_RR_CLASS_IN);
+	unit_assert(z && z->compact);
+	/* the names are prefix compressed, and the A records are in a
+	 * row, about 30 bytes for the domain */
+	unit_assert(z->compact_size < (size_t)num*40 + 1024);
+	compact = z->compact;
+	auth_zone_set_zonefile(z, NULL);
+	xfr = auth_xfer_create(az, z);
+	lock_rw_unlock(&az->lock);
+	unit_assert(xfr);
+	xfr->have_zone = 1;
+	xfr->serial = 1;
+	xfr->task_transfer->masters = (struct auth_master*)calloc(1,
+		sizeof(struct auth_master));
+	unit_assert(xfr->task_transfer->masters);
+	xfr->task_transfer->masters->host = strdup("192.0.2.53");
+	xfr->task_transfer->master = xfr->task_transfer->masters;
+	xfr->task_transfer->on_ixfr = 1;
+	memset(&env, 0, sizeof(env));
+	env.cfg = cfg;
+	env.auth_zones = az;
+	env.now = &now;
+	env.scratch_buffer = sldns_buffer_new(65535);
+	unit_assert(env.scratch_buffer);
+
+	t2 = ixfr_apply_check(az, xfr, &env, ixfr_serial2, num, 2);
+	/* apex, h1, n1 and h2 that is removed */
+	unit_assert(z->compact == compact && z->data.count == 4);
+	t3 = ixfr_apply_check(az, xfr, &env, ixfr_serial3, num, 3);
+	if(num > 1000) {
+		/* n1 is gone, it is not in the compact data */
+		unit_assert(z->compact == compact && z->data.count == 3);
+	} else {
+		/* the changes are many for the small zone */
+		unit_assert(z->compact && z->compact != compact &&
+			z->data.count == 0);
+	}
+	if(vbmp) printf("IXFR on zone of %d RRs: %.6f sec and %.6f sec\n",
+		num, t2, t3);
+	lock_basic_unlock(&xfr->lock);
+	sldns_buffer_free(env.scratch_buffer);
+	config_delete(cfg);
+	auth_zones_delete(az);
+}
+
+/** Test that IXFR changes are put over the compact data of the zone */
+static void
+authzone_ixfr_test(void)
+{
+	if(vbmp) printf("Testing IXFR on compact auth zone\n");
+	ixfr_serial_test(10);
+	ixfr_serial_test(100000);
+}
+
+/** Benchmark zonefile loading, on a generated zone */
+static void
+authzone_load_bench(void)
+{
+	int num = 4000000, threads = 4;
+	struct auth_zones* az;
+	char* fname;
+	double t1, tn;
+	size_t mem;
+	unit_show_func("services/authzone.c", "auth_zone_read_zonefile");
+	fname = create_large_zone(num, 0);
+	az = load_zone_threads("example.com", fname, 1, &t1);
+	mem = auth_zones_get_mem(az);
+	auth_zones_delete(az);
+	az = load_zone_threads("example.com", fname, threads, &tn);
+	auth_zones_delete(az);
+	del_tmp_file(fname);
+	printf("zonefile of %d RRs: 1 thread %.3f sec (%.0f RR/s), "
+		"%d threads %.3f sec (%.0f RR/s)\n", num,
+		t1, (t1>0?(double)num/t1:0.), threads,
+		tn, (tn>0?(double)num/tn:0.));
+	printf("zone memory %u bytes, %.1f bytes per RR\n", (unsigned)mem,
+		(double)mem/(double)num);
+}
+
 /** test authzone code */
 void 
 authzone_test(void)
@@ -897,4 +1512,15 @@ authzone_test(void)
 	authzone_compare_serial();
 	authzone_read_test();
 	authzone_query_test();
+	authzone_answer_cache_test();
+	authzone_parallel_load_test();
+	authzone_ixfr_test();
+}
+
+void
+authzone_bench(void)
+{
+	unit_show_feature("authzone");
+	atexit(tmpfilecleanup);
+	authzone_load_bench();
 }
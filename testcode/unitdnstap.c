@@ -0,0 +1,554 @@
+/*
+ * testcode/unitdnstap.c - unit test for dnstap message encoding.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * \file
+ * Calls dnstap related unit tests. Exits with code 1 on a failure.
+ * The dnstap encoder is compared with protobuf-c, for the output and
+ * for the speed.
+ */
+
+#include "config.h"
+
+#ifdef USE_DNSTAP
+
+#include <sys/time.h>
+#include <protobuf-c/protobuf-c.h>
+#include "util/log.h"
+#include "util/netevent.h"
+#include "util/net_help.h"
+#include "util/config_file.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+#include "sldns/rrdef.h"
+#include "sldns/str2wire.h"
+#include "testcode/unitmain.h"
+#include "dnstap/dnstap.h"
+#include "dnstap/dnstap.pb-c.h"
+
+/** fill the protobuf-c structures with the contents of the message */
+static void
+pbc_fill(struct dt_env* env, struct dt_msg* dm, Dnstap__Dnstap* d,
+	Dnstap__Message* m)
+{
+	ProtobufCBinaryData* addr;
+	protobuf_c_boolean* has_addr, *has_port;
+	uint32_t* port;
+	memset(d, 0, sizeof(*d));
+	memset(m, 0, sizeof(*m));
+	d->base.descriptor = &dnstap__dnstap__descriptor;
+	m->base.descriptor = &dnstap__message__descriptor;
+	d->type = DNSTAP__DNSTAP__TYPE__MESSAGE;
+	d->message = m;
+	m->type = (Dnstap__Message__Type)dm->type;
+	if(env->identity) {
+		d->identity.data = (uint8_t*)env->identity;
+		d->identity.len = (size_t)env->len_identity;
+		d->has_identity = 1;
+	}
+	if(env->version) {
+		d->version.data = (uint8_t*)env->version;
+		d->version.len = (size_t)env->len_version;
+		d->has_version = 1;
+	}
+	if(dm->addr_is_response) {
+		addr = &m->response_address;
+		has_addr = &m->has_response_address;
+		port = &m->response_port;
+		has_port = &m->has_response_port;
+	} else {
+		addr = &m->query_address;
+		has_addr = &m->has_query_address;
+		port = &m->query_port;
+		has_port = &m->has_query_port;
+	}
+	if(dm->ss && dm->ss->ss_family == AF_INET6) {
+		struct sockaddr_in6* s = (struct sockaddr_in6*)dm->ss;
+		m->socket_family = DNSTAP__SOCKET_FAMILY__INET6;
+		m->has_socket_family = 1;
+		addr->data = s->sin6_addr.s6_addr;
+		addr->len = 16;
+		*has_addr = 1;
+		*port = ntohs(s->sin6_port);
+		*has_port = 1;
+	} else if(dm->ss && dm->ss->ss_family == AF_INET) {
+		struct sockaddr_in* s = (struct sockaddr_in*)dm->ss;
+		m->socket_family = DNSTAP__SOCKET_FAMILY__INET;
+		m->has_socket_family = 1;
+		addr->data = (uint8_t*)&s->sin_addr.s_addr;
+		addr->len = 4;
+		*has_addr = 1;
+		*port = ntohs(s->sin_port);
+		*has_port = 1;
+	}
+	if(dm->cptype == comm_udp) {
+		m->socket_protocol = DNSTAP__SOCKET_PROTOCOL__UDP;
+		m->has_socket_protocol = 1;
+	} else if(dm->cptype == comm_tcp) {
+		m->socket_protocol = DNSTAP__SOCKET_PROTOCOL__TCP;
+		m->has_socket_protocol = 1;
+	}
+	if(dm->qtime) {
+		m->query_time_sec = (uint64_t)dm->qtime->tv_sec;
+		m->has_query_time_sec = 1;
+		m->query_time_nsec = (uint32_t)dm->qtime->tv_usec * 1000;
+		m->has_query_time_nsec = 1;
+	}
+	if(dm->qmsg) {
+		m->query_message.data = sldns_buffer_begin(dm->qmsg);
+		m->query_message.len = sldns_buffer_limit(dm->qmsg);
+		m->has_query_message = 1;
+	}
+	if(dm->zone) {
+		m->query_zone.data = dm->zone;
+		m->query_zone.len = dm->zone_len;
+		m->has_query_zone = 1;
+	}
+	if(dm->rtime) {
+		m->response_time_sec = (uint64_t)dm->rtime->tv_sec;
+		m->has_response_time_sec = 1;
+		m->response_time_nsec = (uint32_t)dm->rtime->tv_usec * 1000;
+		m->has_response_time_nsec = 1;
+	}
+	if(dm->rmsg) {
+		m->response_message.data = sldns_buffer_begin(dm->rmsg);
+		m->response_message.len = sldns_buffer_limit(dm->rmsg);
+		m->has_response_message = 1;
+	}
+}
+
+/** pack with protobuf-c into a malloced buffer, NULL on failure */
+static uint8_t*
+pbc_pack(Dnstap__Dnstap* d, size_t* len)
+{
+	ProtobufCBufferSimple sbuf;
+	memset(&sbuf, 0, sizeof(sbuf));
+	sbuf.base.append = protobuf_c_buffer_simple_append;
+	sbuf.len = 0;
+	sbuf.alloced = 256;
+	sbuf.data = malloc(sbuf.alloced);
+	if(!sbuf.data)
+		return NULL;
+	sbuf.must_free_data = 1;
+	*len = dnstap__dnstap__pack_to_buffer(d, (ProtobufCBuffer*)&sbuf);
+	return sbuf.data;
+}
+
+/** check that the encoder output is the same as that of protobuf-c */
+static void
+dnstap_encode_check(struct dt_env* env, struct dt_msg* dm)
+{
+	Dnstap__Dnstap d;
+	Dnstap__Message m;
+	size_t pbc_len = 0, len, enc_len;
+	uint8_t* pbc, *buf;
+
+	pbc_fill(env, dm, &d, &m);
+	pbc = pbc_pack(&d, &pbc_len);
+	unit_assert(pbc);
+	len = dt_msg_encode_len(env, dm);
+	unit_assert(len == pbc_len);
+	buf = malloc(len);
+	unit_assert(buf);
+	enc_len = dt_msg_encode(env, dm, buf);
+	unit_assert(enc_len == len);
+	unit_assert(memcmp(buf, pbc, len) == 0);
+	free(buf);
+	free(pbc);
+}
+
+/** time a number of encodes, with protobuf-c or with the encoder */
+static double
+dnstap_encode_time(struct dt_env* env, struct dt_msg* dm, int num,
+	int use_pbc)
+{
+	struct timeval start, end;
+	uint8_t buf[1024];
+	size_t total = 0;
+	int i;
+	gettimeofday(&start, NULL);
+	for(i=0; i<num; i++) {
+		if(use_pbc) {
+			/* the work that was done for every message */
+			Dnstap__Dnstap d;
+			Dnstap__Message m;
+			size_t len = 0;
+			uint8_t* pbc;
+			pbc_fill(env, dm, &d, &m);
+			pbc = pbc_pack(&d, &len);
+			unit_assert(pbc);
+			total += len;
+			free(pbc);
+		} else {
+			size_t len = dt_msg_encode_len(env, dm);
+			unit_assert(len <= sizeof(buf));
+			total += dt_msg_encode(env, dm, buf);
+		}
+	}
+	gettimeofday(&end, NULL);
+	unit_assert(total > 0);
+	return (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+}
+
+/** test the dnstap encoder */
+static void
+dnstap_encode_test(void)
+{
+	struct dt_env env;
+	struct dt_msg dm;
+	struct sockaddr_storage a4, a6;
+	socklen_t l4, l6;
+	struct timeval qtime, rtime;
+	uint8_t zone[] = {7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 3, 'c', 'o',
+		'm', 0};
+	sldns_buffer* qmsg = sldns_buffer_new(65536);
+	sldns_buffer* rmsg = sldns_buffer_new(65536);
+	size_t i;
+	unit_show_func("dnstap/dnstap.c", "dt_msg_encode");
+	unit_assert(qmsg && rmsg);
+	unit_assert(ipstrtoaddr("192.0.2.1", 53, &a4, &l4));
+	unit_assert(ipstrtoaddr("2001:db8::1", 65535, &a6, &l6));
+	qtime.tv_sec = 1600000000;
+	qtime.tv_usec = 123456;
+	rtime.tv_sec = 1600000001;
+	rtime.tv_usec = 999999;
+	for(i=0; i<40; i++)
+		sldns_buffer_write_u8(qmsg, (uint8_t)i);
+	sldns_buffer_flip(qmsg);
+	for(i=0; i<300; i++)
+		sldns_buffer_write_u8(rmsg, (uint8_t)(i*7));
+	sldns_buffer_flip(rmsg);
+	memset(&env, 0, sizeof(env));
+
+	/* client query, without identity and version */
+	memset(&dm, 0, sizeof(dm));
+	dm.type = DT_MSG_TYPE_CLIENT_QUERY;
+	dm.ss = &a4;
+	dm.cptype = comm_udp;
+	dm.qtime = &qtime;
+	dm.qmsg = qmsg;
+	dnstap_encode_check(&env, &dm);
+
+	env.identity = "ns1.example.com";
+	env.len_identity = (unsigned)strlen(env.identity);
+	env.version = "unbound 1.13.2";
+	env.len_version = (unsigned)strlen(env.version);
+	dnstap_encode_check(&env, &dm);
+
+	/* client response over IPv6 and TCP */
+	memset(&dm, 0, sizeof(dm));
+	dm.type = DT_MSG_TYPE_CLIENT_RESPONSE;
+	dm.ss = &a6;
+	dm.cptype = comm_tcp;
+	dm.rtime = &rtime;
+	dm.rmsg = rmsg;
+	dnstap_encode_check(&env, &dm);
+
+	/* resolver query, with the response address and query zone */
+	memset(&dm, 0, sizeof(dm));
+	dm.type = DT_MSG_TYPE_RESOLVER_QUERY;
+	dm.ss = &a6;
+	dm.addr_is_response = 1;
+	dm.cptype = comm_udp;
+	dm.zone = zone;
+	dm.zone_len = sizeof(zone);
+	dm.qtime = &qtime;
+	dm.qmsg = qmsg;
+	dnstap_encode_check(&env, &dm);
+
+	/* forwarder response, with both times */
+	memset(&dm, 0, sizeof(dm));
+	dm.type = DT_MSG_TYPE_FORWARDER_RESPONSE;
+	dm.ss = &a4;
+	dm.addr_is_response = 1;
+	dm.cptype = comm_tcp;
+	dm.zone = zone;
+	dm.zone_len = sizeof(zone);
+	dm.qtime = &qtime;
+	dm.rtime = &rtime;
+	dm.rmsg = rmsg;
+	dnstap_encode_check(&env, &dm);
+
+	/* large response, the lengths take more bytes */
+	sldns_buffer_clear(rmsg);
+	for(i=0; i<65000; i++)
+		sldns_buffer_write_u8(rmsg, (uint8_t)i);
+	sldns_buffer_flip(rmsg);
+	dnstap_encode_check(&env, &dm);
+
+	sldns_buffer_free(qmsg);
+	sldns_buffer_free(rmsg);
+}
+
+/** encode speed, the encoder against protobuf-c */
+static void
+dnstap_encode_bench(void)
+{
+	struct dt_env env;
+	struct dt_msg dm;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct timeval rtime;
+	sldns_buffer* rmsg = sldns_buffer_new(512);
+	int num = 200000;
+	double t_pbc, t_enc;
+	size_t i;
+	unit_show_func("dnstap/dnstap.c", "dt_msg_encode speed");
+	unit_assert(rmsg);
+	unit_assert(ipstrtoaddr("192.0.2.1", 53, &addr, &addrlen));
+	rtime.tv_sec = 1600000000;
+	rtime.tv_usec = 123456;
+	/* about the size of a typical response */
+	for(i=0; i<120; i++)
+		sldns_buffer_write_u8(rmsg, (uint8_t)i);
+	sldns_buffer_flip(rmsg);
+	memset(&env, 0, sizeof(env));
+	env.identity = "ns1.example.com";
+	env.len_identity = (unsigned)strlen(env.identity);
+	env.version = "unbound 1.13.2";
+	env.len_version = (unsigned)strlen(env.version);
+	memset(&dm, 0, sizeof(dm));
+	dm.type = DT_MSG_TYPE_CLIENT_RESPONSE;
+	dm.ss = &addr;
+	dm.cptype = comm_udp;
+	dm.rtime = &rtime;
+	dm.rmsg = rmsg;
+
+	t_pbc = dnstap_encode_time(&env, &dm, num, 1);
+	t_enc = dnstap_encode_time(&env, &dm, num, 0);
+	printf("%d messages: protobuf-c %.3f sec (%.0f msg/s), "
+		"dt_msg_encode %.3f sec (%.0f msg/s)\n", num,
+		t_pbc, (t_pbc>0?(double)num/t_pbc:0.),
+		t_enc, (t_enc>0?(double)num/t_enc:0.));
+	sldns_buffer_free(rmsg);
+}
+
+/** make a DNS message with a question and rcode in the buffer */
+static void
+filter_mkmsg(sldns_buffer* buf, const char* qname, uint16_t qtype, int rcode,
+	int qdcount)
+{
+	uint8_t dname[LDNS_MAX_DOMAINLEN+1];
+	size_t dname_len = sizeof(dname);
+	unit_assert(sldns_str2wire_dname_buf(qname, dname, &dname_len) == 0);
+	sldns_buffer_clear(buf);
+	sldns_buffer_write_u16(buf, 0x1234); /* id */
+	sldns_buffer_write_u16(buf, (uint16_t)(rcode?0x8000|rcode:0));
+	sldns_buffer_write_u16(buf, (uint16_t)qdcount);
+	sldns_buffer_write_u16(buf, 0);
+	sldns_buffer_write_u16(buf, 0);
+	sldns_buffer_write_u16(buf, 0);
+	sldns_buffer_write(buf, dname, dname_len);
+	sldns_buffer_write_u16(buf, qtype);
+	sldns_buffer_write_u16(buf, LDNS_RR_CLASS_IN);
+	sldns_buffer_flip(buf);
+}
+
+/** check the sampling and filters of dnstap messages */
+static void
+dnstap_filter_test(void)
+{
+	struct dt_env env;
+	struct dt_msg q, r;
+	struct config_file* cfg = config_create();
+	struct sockaddr_storage a4, a6;
+	socklen_t l4, l6;
+	struct timeval qtime, rtime;
+	sldns_buffer* qmsg = sldns_buffer_new(512);
+	sldns_buffer* rmsg = sldns_buffer_new(512);
+	int i, num;
+	unit_show_func("dnstap/dnstap.c", "dt_msg_filter");
+	unit_assert(cfg && qmsg && rmsg);
+	unit_assert(ipstrtoaddr("192.0.2.1", 53, &a4, &l4));
+	unit_assert(ipstrtoaddr("2001:db8::1", 53, &a6, &l6));
+	memset(&env, 0, sizeof(env));
+	memset(&q, 0, sizeof(q));
+	memset(&r, 0, sizeof(r));
+	q.type = DT_MSG_TYPE_CLIENT_QUERY;
+	q.ss = &a4;
+	q.qmsg = qmsg;
+	r.type = DT_MSG_TYPE_CLIENT_RESPONSE;
+	r.ss = &a4;
+	r.rmsg = rmsg;
+	filter_mkmsg(qmsg, "www.example.com.", LDNS_RR_TYPE_A, 0, 1);
+	filter_mkmsg(rmsg, "www.example.com.", LDNS_RR_TYPE_A,
+		LDNS_RCODE_SERVFAIL, 1);
+
+	/* no filters */
+	unit_assert(dt_msg_filter(&env, &q, 0));
+	unit_assert(dt_msg_filter(&env, &r, 0));
+
+	/* the config strings */
+	cfg->dnstap = 1;
+	cfg->dnstap_filter_rcode = strdup("SERVFAIL, refused 3 BADVERS");
+	cfg->dnstap_filter_qtype = strdup("A aaaa TYPE65 nosuchtype");
+	unit_assert(cfg->dnstap_filter_rcode && cfg->dnstap_filter_qtype);
+	dt_apply_cfg(&env, cfg);
+	unit_assert(env.filter_rcode == ((1<<LDNS_RCODE_SERVFAIL) |
+		(1<<LDNS_RCODE_REFUSED) | (1<<LDNS_RCODE_NXDOMAIN)));
+	unit_assert(env.filter_qtype_num == 3);
+	unit_assert(env.filter_qtype[0] == LDNS_RR_TYPE_A);
+	unit_assert(env.filter_qtype[1] == LDNS_RR_TYPE_AAAA);
+	unit_assert(env.filter_qtype[2] == 65);
+	unit_assert(env.sample_rate == 0 && !env.filter_local_zone &&
+		env.filter_response_time == 0);
+
+	/* rcode, queries are not filtered by rcode */
+	unit_assert(dt_msg_filter(&env, &q, 0));
+	unit_assert(dt_msg_filter(&env, &r, 0));
+	filter_mkmsg(rmsg, "www.example.com.", LDNS_RR_TYPE_A, 0, 1);
+	unit_assert(!dt_msg_filter(&env, &r, 0));
+	env.filter_rcode = 0;
+	unit_assert(dt_msg_filter(&env, &r, 0));
+
+	/* qtype */
+	filter_mkmsg(qmsg, "www.example.com.", LDNS_RR_TYPE_MX, 0, 1);
+	unit_assert(!dt_msg_filter(&env, &q, 0));
+	filter_mkmsg(qmsg, "www.example.com.", LDNS_RR_TYPE_AAAA, 0, 1);
+	unit_assert(dt_msg_filter(&env, &q, 0));
+	filter_mkmsg(qmsg, "www.example.com.", LDNS_RR_TYPE_AAAA, 0, 0);
+	unit_assert(!dt_msg_filter(&env, &q, 0));
+	sldns_buffer_set_limit(rmsg, LDNS_HEADER_SIZE + 4);
+	unit_assert(!dt_msg_filter(&env, &r, 0));
+	free(env.filter_qtype);
+	env.filter_qtype = NULL;
+	env.filter_qtype_num = 0;
+
+	/* local zone, only for client responses */
+	env.filter_local_zone = 1;
+	filter_mkmsg(qmsg, "www.example.com.", LDNS_RR_TYPE_A, 0, 1);
+	filter_mkmsg(rmsg, "www.example.com.", LDNS_RR_TYPE_A, 0, 1);
+	unit_assert(dt_msg_filter(&env, &q, 0));
+	unit_assert(!dt_msg_filter(&env, &r, 0));
+	unit_assert(dt_msg_filter(&env, &r, 1));
+	env.filter_local_zone = 0;
+
+	/* response time, only for resolver and forwarder responses */
+	env.filter_response_time = 100;
+	r.type = DT_MSG_TYPE_RESOLVER_RESPONSE;
+	r.qtime = &qtime;
+	r.rtime = &rtime;
+	qtime.tv_sec = 1600000000;
+	qtime.tv_usec = 990000;
+	rtime.tv_sec = 1600000001;
+	rtime.tv_usec = 50000;
+	unit_assert(!dt_msg_filter(&env, &r, 0));
+	rtime.tv_usec = 90000;
+	unit_assert(dt_msg_filter(&env, &r, 0));
+	r.type = DT_MSG_TYPE_FORWARDER_RESPONSE;
+	unit_assert(dt_msg_filter(&env, &r, 0));
+	rtime.tv_usec = 0;
+	unit_assert(!dt_msg_filter(&env, &r, 0));
+	r.type = DT_MSG_TYPE_CLIENT_RESPONSE;
+	r.qtime = NULL;
+	r.rtime = NULL;
+	unit_assert(dt_msg_filter(&env, &r, 0));
+	env.filter_response_time = 0;
+
+	/* sample the client subnets, the /24 is kept together */
+	env.sample_rate = 4;
+	num = 0;
+	for(i=0; i<256; i++) {
+		struct sockaddr_in* s4 = (struct sockaddr_in*)&a4;
+		int res;
+		uint8_t* ip = (uint8_t*)&s4->sin_addr;
+		ip[2] = (uint8_t)i;
+		ip[3] = 1;
+		res = dt_msg_filter(&env, &q, 0);
+		ip[3] = 200;
+		unit_assert(dt_msg_filter(&env, &q, 0) == res);
+		unit_assert(dt_msg_filter(&env, &r, 0) == res);
+		num += res;
+	}
+	unit_assert(num > 256/4/2 && num < 256/4*2);
+	/* and the IPv6 /56 */
+	q.ss = &a6;
+	num = 0;
+	for(i=0; i<256; i++) {
+		struct sockaddr_in6* s6 = (struct sockaddr_in6*)&a6;
+		int res;
+		s6->sin6_addr.s6_addr[6] = (uint8_t)i;
+		s6->sin6_addr.s6_addr[7] = 1;
+		res = dt_msg_filter(&env, &q, 0);
+		s6->sin6_addr.s6_addr[7] = 2;
+		unit_assert(dt_msg_filter(&env, &q, 0) == res);
+		num += res;
+	}
+	unit_assert(num > 256/4/2 && num < 256/4*2);
+
+	/* sample resolver messages by the query name, in any case */
+	q.type = DT_MSG_TYPE_RESOLVER_QUERY;
+	r.type = DT_MSG_TYPE_RESOLVER_RESPONSE;
+	num = 0;
+	for(i=0; i<256; i++) {
+		char nm[64];
+		int res;
+		snprintf(nm, sizeof(nm), "host%d.example.com.", i);
+		filter_mkmsg(qmsg, nm, LDNS_RR_TYPE_A, 0, 1);
+		snprintf(nm, sizeof(nm), "HoSt%d.ExAmPlE.cOm.", i);
+		filter_mkmsg(rmsg, nm, LDNS_RR_TYPE_A, 0, 1);
+		res = dt_msg_filter(&env, &q, 0);
+		unit_assert(dt_msg_filter(&env, &r, 0) == res);
+		num += res;
+	}
+	unit_assert(num > 256/4/2 && num < 256/4*2);
+	/* without a question it cannot be sampled */
+	filter_mkmsg(qmsg, "www.example.com.", LDNS_RR_TYPE_A, 0, 0);
+	unit_assert(!dt_msg_filter(&env, &q, 0));
+	env.sample_rate = 1;
+	unit_assert(dt_msg_filter(&env, &q, 0));
+
+	config_delete(cfg);
+	sldns_buffer_free(qmsg);
+	sldns_buffer_free(rmsg);
+}
+
+void
+dnstap_test(void)
+{
+	unit_show_feature("dnstap");
+	dnstap_encode_test();
+	dnstap_filter_test();
+}
+
+void
+dnstap_bench(void)
+{
+	dnstap_encode_bench();
+}
+
+#endif /* USE_DNSTAP */
@@ -43,6 +43,7 @@
 
 #ifdef CLIENT_SUBNET
 
+#include <sys/time.h>
 #include "util/log.h"
 #include "util/module.h"
 #include "testcode/unitmain.h"
@@ -209,6 +210,232 @@ static void consistency_test(void)
 	addrtree_delete(t);
 }
 
+/** a node that is found by a lookup is kept by the LRU cleanup */
+static void lru_test(void)
+{
+	struct addrtree* t;
+	struct module_env env;
+	struct reply_info *elem;
+	addrkey_t k1[1] = {0x80}, k2[1] = {0x40}, k3[1] = {0x20};
+	unit_show_func("edns-subnet/addrtree.h", "LRU with lookups");
+	t = addrtree_create(8, &elemfree, &unittest_wrapper_subnetmod_sizefunc,
+		&env, 3);
+	unit_assert(t);
+	elem = (struct reply_info *) calloc(1, sizeof(struct reply_info));
+	addrtree_insert(t, k1, 8, 8, elem, 10, 0);
+	elem = (struct reply_info *) calloc(1, sizeof(struct reply_info));
+	addrtree_insert(t, k2, 8, 8, elem, 10, 0);
+	unit_assert(t->node_count == 2);
+	/* k1 is the oldest, but it is used */
+	unit_assert(addrtree_find(t, k1, 8, 0));
+	/* k3 needs a new node and a branch node, that is over the limit */
+	elem = (struct reply_info *) calloc(1, sizeof(struct reply_info));
+	addrtree_insert(t, k3, 8, 8, elem, 10, 0);
+	unit_assert(t->node_count <= 3);
+	unit_assert(addrtree_find(t, k1, 8, 0));
+	unit_assert(!addrtree_find(t, k2, 8, 0));
+	unit_assert(addrtree_find(t, k3, 8, 0));
+	unit_assert(!addrtree_inconsistent(t));
+	addrtree_delete(t);
+}
+
+/** number of prefixes in the threaded lookup benchmark */
+#define ECS_BENCH_PREFIXES 10000
+/** number of lookups per thread in the threaded lookup benchmark */
+#define ECS_BENCH_LOOKUPS 200000
+
+/** cache entry shared by the benchmark threads */
+struct ecs_bench_entry {
+	/** the lock, like the slabhash entry lock */
+	lock_rw_type lock;
+	/** the tree with the prefixes */
+	struct addrtree* tree;
+};
+
+/** benchmark thread */
+struct ecs_bench_thr {
+	/** thread id */
+	ub_thread_type id;
+	/** thread number, seeds the addresses it looks up */
+	int num;
+	/** if lookups use the write lock, as with the old biglock */
+	int wrlock;
+	/** the shared entry */
+	struct ecs_bench_entry* entry;
+	/** number of lookups that found an answer */
+	int hits;
+};
+
+/** the address of prefix i for the benchmark, a /24 */
+static void ecs_bench_addr(addrkey_t* k, uint32_t i)
+{
+	k[0] = 10 + (i>>16)%200;
+	k[1] = (i>>8)&0xff;
+	k[2] = i&0xff;
+	k[3] = 1;
+}
+
+/** benchmark thread that does lookups in the shared tree */
+static void* ecs_bench_thr_main(void* arg)
+{
+	struct ecs_bench_thr* t = (struct ecs_bench_thr*)arg;
+	uint32_t s = 1 + (uint32_t)t->num*7919;
+	addrkey_t k[4];
+	int i;
+	log_thread_set(&t->num);
+	for(i=0; i<ECS_BENCH_LOOKUPS; i++) {
+		s = s*1103515245 + 12345;
+		ecs_bench_addr(k, (s>>8)%ECS_BENCH_PREFIXES);
+		if(t->wrlock)
+			lock_rw_wrlock(&t->entry->lock);
+		else	lock_rw_rdlock(&t->entry->lock);
+		if(addrtree_find(t->entry->tree, k, 32, 0))
+			t->hits++;
+		lock_rw_unlock(&t->entry->lock);
+	}
+	return NULL;
+}
+
+/** run the lookups with a number of threads, returns time in seconds */
+static double ecs_bench_run(struct ecs_bench_entry* entry, int numth,
+	int wrlock)
+{
+	struct ecs_bench_thr t[8];
+	struct timeval start, end;
+	int i;
+	log_assert(numth <= 8);
+	gettimeofday(&start, NULL);
+	for(i=0; i<numth; i++) {
+		t[i].num = i+1;
+		t[i].wrlock = wrlock;
+		t[i].entry = entry;
+		t[i].hits = 0;
+		ub_thread_create(&t[i].id, ecs_bench_thr_main, &t[i]);
+	}
+	for(i=0; i<numth; i++) {
+		ub_thread_join(t[i].id);
+		unit_assert(t[i].hits == ECS_BENCH_LOOKUPS);
+	}
+	gettimeofday(&end, NULL);
+	return (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+}
+
+/** count the nodes in the LRU list, checks the links */
+static uint32_t ecs_bench_lru_count(struct addrtree* tree)
+{
+	struct addrnode* n, *prev = NULL;
+	uint32_t count = 0;
+	for(n = tree->first; n; n = n->next) {
+		unit_assert(n->prev == prev);
+		prev = n;
+		count++;
+	}
+	unit_assert(tree->last == prev);
+	return count;
+}
+
+/** lookups by concurrent threads, under a write lock and a read lock */
+static void threaded_lookup_bench(void)
+{
+	struct ecs_bench_entry entry;
+	struct module_env env;
+	struct reply_info *elem;
+	addrkey_t k[4];
+	uint32_t i, lru;
+	int numth;
+	double t_wr, t_rd;
+	unit_show_func("edns-subnet/addrtree.h", "threaded addrtree_find speed");
+	lock_rw_init(&entry.lock);
+	entry.tree = addrtree_create(32, &elemfree,
+		&unittest_wrapper_subnetmod_sizefunc, &env, 0);
+	unit_assert(entry.tree);
+	for(i=0; i<ECS_BENCH_PREFIXES; i++) {
+		ecs_bench_addr(k, i);
+		elem = (struct reply_info *) calloc(1, sizeof(struct reply_info));
+		unit_assert(elem);
+		addrtree_insert(entry.tree, k, 24, 24, elem, 10, 0);
+	}
+	lru = ecs_bench_lru_count(entry.tree);
+	for(numth = 1; numth <= 8; numth *= 2) {
+		t_wr = ecs_bench_run(&entry, numth, 1);
+		t_rd = ecs_bench_run(&entry, numth, 0);
+		printf("%d threads, %d lookups each: write lock %.3f sec, "
+			"read lock %.3f sec\n", numth, ECS_BENCH_LOOKUPS,
+			t_wr, t_rd);
+	}
+	/* concurrent finds must have kept the LRU list intact */
+	unit_assert(ecs_bench_lru_count(entry.tree) == lru);
+	unit_assert(!addrtree_inconsistent(entry.tree));
+	addrtree_delete(entry.tree);
+	lock_rw_destroy(&entry.lock);
+}
+
+/** number of IPv6 prefixes in the lookup and memory benchmark */
+#define ECS_BENCH6_PREFIXES 50000
+/** number of lookups in the lookup and memory benchmark */
+#define ECS_BENCH6_LOOKUPS 1000000
+
+/** the address of prefix i for the IPv6 benchmark, a /56 in one of
+ * a couple of /32s, like clients from several providers */
+static void ecs_bench6_addr(addrkey_t* k, uint32_t i)
+{
+	uint32_t h = i*2654435761U;
+	memset(k, 0, 16);
+	k[0] = 0x20;
+	k[1] = 0x01;
+	k[2] = 0x0d;
+	k[3] = (addrkey_t)(i%16);
+	k[4] = (addrkey_t)(h>>24);
+	k[5] = (addrkey_t)(h>>16);
+	k[6] = (addrkey_t)(h>>8);
+	k[15] = 1;
+}
+
+/** lookup speed and memory use of a tree with many IPv6 /56 scopes */
+static void ipv6_lookup_bench(void)
+{
+	struct addrtree* t;
+	struct module_env env;
+	struct reply_info *elem;
+	struct timeval start, end;
+	addrkey_t k[16];
+	uint32_t i, s = 4321;
+	int hits = 0;
+	size_t mem;
+	double sec;
+	unit_show_func("edns-subnet/addrtree.h", "addrtree IPv6 lookup speed");
+	t = addrtree_create(56, &elemfree,
+		&unittest_wrapper_subnetmod_sizefunc, &env, 0);
+	unit_assert(t);
+	for(i=0; i<ECS_BENCH6_PREFIXES; i++) {
+		ecs_bench6_addr(k, i);
+		elem = (struct reply_info *) calloc(1, sizeof(struct reply_info));
+		unit_assert(elem);
+		addrtree_insert(t, k, 56, 56, elem, 10, 0);
+	}
+	unit_assert(!addrtree_inconsistent(t));
+	/* the tree without the elements */
+	mem = addrtree_size(t) - (size_t)ECS_BENCH6_PREFIXES*
+		unittest_wrapper_subnetmod_sizefunc(elem);
+	gettimeofday(&start, NULL);
+	for(i=0; i<ECS_BENCH6_LOOKUPS; i++) {
+		s = s*1103515245 + 12345;
+		ecs_bench6_addr(k, (s>>8)%ECS_BENCH6_PREFIXES);
+		if(addrtree_find(t, k, 64, 0))
+			hits++;
+	}
+	gettimeofday(&end, NULL);
+	unit_assert(hits == ECS_BENCH6_LOOKUPS);
+	sec = (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+	printf("%d /56 prefixes, %u nodes, %d lookups: %.3f sec, "
+		"tree %u bytes (%u per node)\n", ECS_BENCH6_PREFIXES,
+		(unsigned)t->node_count, ECS_BENCH6_LOOKUPS, sec,
+		(unsigned)mem, (unsigned)(mem/(t->node_count+1)));
+	addrtree_delete(t);
+}
+
 static void issub_test(void)
 {
 	addrkey_t k1[] = {0x55, 0x55, 0x5A};
@@ -279,6 +506,14 @@ void ecs_test(void)
 	getbit_test();
 	issub_test();
 	consistency_test();
+	lru_test();
+}
+
+void ecs_bench(void)
+{
+	unit_show_feature("ecs");
+	threaded_lookup_bench();
+	ipv6_lookup_bench();
 }
 #endif /* CLIENT_SUBNET */
 
@@ -885,6 +885,915 @@ static void tcpid_test(void)
 	ub_randfree(outnet.rnd);
 }
 
+#include <sys/time.h>
+#include "services/cache/rrset.h"
+#include "util/data/msgreply.h"
+#include "sldns/str2wire.h"
+/** make an A rrset with one RR for the rrset cache test, for the name
+ * h<num>.example.com. */
+static struct ub_packed_rrset_key*
+rrset_test_make(struct alloc_cache* alloc, int num, uint8_t a,
+	enum sec_status sec, enum rrset_trust trust, time_t ttl)
+{
+	char buf[64];
+	uint8_t rdata[6] = {0, 4, 192, 0, 2, 0};
+	struct ub_packed_rrset_key* k = alloc_special_obtain(alloc);
+	struct packed_rrset_data* d = (struct packed_rrset_data*)calloc(1,
+		sizeof(*d) + sizeof(size_t) + sizeof(uint8_t*) +
+		sizeof(time_t) + sizeof(rdata));
+	unit_assert(k && d);
+	snprintf(buf, sizeof(buf), "h%d.example.com.", num);
+	k->rk.dname = sldns_str2wire_dname(buf, &k->rk.dname_len);
+	unit_assert(k->rk.dname);
+	k->rk.type = htons(LDNS_RR_TYPE_A);
+	k->rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	k->entry.hash = rrset_key_hash(&k->rk);
+	k->entry.data = d;
+	d->ttl = ttl;
+	d->count = 1;
+	d->trust = trust;
+	d->security = sec;
+	d->rr_len = (size_t*)((uint8_t*)d + sizeof(*d));
+	d->rr_len[0] = sizeof(rdata);
+	packed_rrset_ptr_fixup(d);
+	d->rr_ttl[0] = ttl;
+	rdata[5] = a;
+	memcpy(d->rr_data[0], rdata, sizeof(rdata));
+	return k;
+}
+
+/** store the rrset in the rrset cache, like the message store does */
+static void
+rrset_test_store(struct rrset_cache* r, struct alloc_cache* alloc,
+	struct rrset_ref* ref, struct ub_packed_rrset_key* k, time_t now)
+{
+	ref->key = k;
+	ref->id = k->id;
+	(void)rrset_cache_update(r, ref, alloc, now);
+}
+
+/** test that a secure rrset that is replaced by data that is not secure
+ * gets a new ID, and a message that references it has to be checked */
+static void
+rrset_cache_downgrade_test(void)
+{
+	struct alloc_cache alloc;
+	struct rrset_cache* r;
+	struct rrset_ref ref, msgref;
+	time_t now = 1000;
+	unit_show_func("services/cache/rrset.c", "rrset_cache_update");
+	alloc_init(&alloc, NULL, 0);
+	r = rrset_cache_create(NULL, &alloc);
+	unit_assert(r);
+
+	/* a secure rrset, as referenced by a secure message */
+	rrset_test_store(r, &alloc, &msgref, rrset_test_make(&alloc, 1, 1,
+		sec_status_secure, rrset_trust_ans_noAA, now+3600), now);
+	unit_assert(rrset_array_lock(&msgref, 1, now));
+	rrset_array_unlock(&msgref, 1);
+
+	/* the same data again, secure, does not change the ID */
+	rrset_test_store(r, &alloc, &ref, rrset_test_make(&alloc, 1, 1,
+		sec_status_secure, rrset_trust_ans_noAA, now+3600), now);
+	unit_assert(ref.key == msgref.key && ref.id == msgref.id);
+
+	/* other data that is not secure, with higher trust, replaces it */
+	rrset_test_store(r, &alloc, &ref, rrset_test_make(&alloc, 1, 2,
+		sec_status_insecure, rrset_trust_ans_AA, now+3600), now);
+	unit_assert(ref.key == msgref.key);
+	unit_assert(((struct packed_rrset_data*)ref.key->entry.data)->security
+		== sec_status_insecure);
+	unit_assert(ref.id != msgref.id);
+	/* the message can no longer use the rrset, it is checked again */
+	unit_assert(!rrset_array_lock(&msgref, 1, now));
+	unit_assert(rrset_array_lock(&ref, 1, now));
+	rrset_array_unlock(&ref, 1);
+
+	/* an insecure rrset that is replaced by insecure data keeps its ID,
+	 * messages with it are not secure and do not depend on it */
+	msgref = ref;
+	rrset_test_store(r, &alloc, &ref, rrset_test_make(&alloc, 1, 3,
+		sec_status_insecure, rrset_trust_ans_AA, now+3600), now);
+	unit_assert(ref.key == msgref.key && ref.id == msgref.id);
+
+	/* a downgrade of expired data also changes the ID */
+	rrset_test_store(r, &alloc, &msgref, rrset_test_make(&alloc, 2, 1,
+		sec_status_secure, rrset_trust_ans_noAA, now+10), now);
+	rrset_test_store(r, &alloc, &ref, rrset_test_make(&alloc, 2, 1,
+		sec_status_unchecked, rrset_trust_ans_noAA, now+3600), now+20);
+	unit_assert(ref.key == msgref.key && ref.id != msgref.id);
+	unit_assert(!rrset_array_lock(&msgref, 1, now));
+
+	rrset_cache_delete(r);
+	alloc_clear(&alloc);
+}
+
+/** number of messages in the cache hit benchmark */
+#define RRSET_BENCH_MSGS 200000
+/** number of rrsets per message in the cache hit benchmark */
+#define RRSET_BENCH_RRSETS 3
+
+/** cache hit check speed, the rrset locks with and without the walk
+ * over the rrsets for the security status, for secure messages */
+static void
+rrset_cache_bench(void)
+{
+	struct alloc_cache alloc;
+	struct config_file* cfg = config_create();
+	struct rrset_cache* r;
+	struct reply_info** reps;
+	struct timeval start, end;
+	time_t now = 1000;
+	double t[2];
+	int i, j, m, n = RRSET_BENCH_MSGS, lookups = 2000000, ok = 0;
+	uint32_t s;
+	unit_show_func("daemon/worker.c", "answer_from_cache secure check "
+		"speed");
+	unit_assert(cfg);
+	cfg->rrset_cache_size = 256*1024*1024;
+	alloc_init(&alloc, NULL, 0);
+	r = rrset_cache_create(cfg, &alloc);
+	reps = (struct reply_info**)calloc((size_t)n, sizeof(*reps));
+	unit_assert(r && reps);
+	for(i=0; i<n; i++) {
+		reps[i] = construct_reply_info_base(NULL, 0, 1, 3600, 3600,
+			3600, RRSET_BENCH_RRSETS, 0, 0, RRSET_BENCH_RRSETS,
+			sec_status_secure);
+		unit_assert(reps[i]);
+		for(j=0; j<RRSET_BENCH_RRSETS; j++) {
+			rrset_test_store(r, &alloc, &reps[i]->ref[j],
+				rrset_test_make(&alloc, i*RRSET_BENCH_RRSETS+j,
+				1, sec_status_secure, rrset_trust_ans_noAA,
+				now+3600), now);
+			reps[i]->rrsets[j] = reps[i]->ref[j].key;
+		}
+		reply_info_sortref(reps[i]);
+	}
+	/* alternate the two, and keep the fastest run of each */
+	t[0] = t[1] = 0;
+	for(m=0; m<6; m++) {
+		double d;
+		s = 1234;
+		gettimeofday(&start, NULL);
+		for(i=0; i<lookups; i++) {
+			struct reply_info* rep;
+			s = s*1103515245 + 12345;
+			rep = reps[(s>>8)%(uint32_t)n];
+			if(!rrset_array_lock(rep->ref, rep->rrset_count, now))
+				continue;
+			if(m%2 == 0 && !reply_all_rrsets_secure(rep)) {
+				rrset_array_unlock(rep->ref, rep->rrset_count);
+				continue;
+			}
+			ok++;
+			rrset_array_unlock(rep->ref, rep->rrset_count);
+		}
+		gettimeofday(&end, NULL);
+		d = (double)(end.tv_sec - start.tv_sec) +
+			(double)(end.tv_usec - start.tv_usec)/1000000.;
+		if(t[m%2] == 0 || d < t[m%2])
+			t[m%2] = d;
+	}
+	unit_assert(ok == 6*lookups);
+	printf("%d secure messages of %d rrsets, %d hits: locks and walk "
+		"%.3f sec (%.1f ns/hit), locks only %.3f sec (%.1f ns/hit)\n",
+		n, RRSET_BENCH_RRSETS, lookups, t[0], t[0]*1e9/lookups, t[1],
+		t[1]*1e9/lookups);
+	for(i=0; i<n; i++)
+		free(reps[i]);
+	free(reps);
+	rrset_cache_delete(r);
+	alloc_clear(&alloc);
+	config_delete(cfg);
+}
+
+#include "services/localzone.h"
+#include "util/data/dname.h"
+#include "sldns/str2wire.h"
+/** add a local zone by its string name */
+static struct local_zone*
+lzindex_add(struct local_zones* zones, const char* str)
+{
+	size_t len = 0;
+	uint8_t* nm = sldns_str2wire_dname(str, &len);
+	struct local_zone* z;
+	unit_assert(nm);
+	lock_rw_wrlock(&zones->lock);
+	z = local_zones_add_zone(zones, nm, len, dname_count_labels(nm),
+		LDNS_RR_CLASS_IN, local_zone_static);
+	lock_rw_unlock(&zones->lock);
+	unit_assert(z);
+	return z;
+}
+
+/** check that the lookup finds the expected closest enclosing zone */
+static void
+lzindex_check(struct local_zones* zones, const char* str,
+	const char* expect)
+{
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t len = sizeof(nm);
+	struct local_zone* z;
+	unit_assert(sldns_str2wire_dname_buf(str, nm, &len) == 0);
+	lock_rw_rdlock(&zones->lock);
+	z = local_zones_lookup(zones, nm, len, dname_count_labels(nm),
+		LDNS_RR_CLASS_IN, LDNS_RR_TYPE_A);
+	if(expect) {
+		size_t elen = 0;
+		uint8_t* enm = sldns_str2wire_dname(expect, &elen);
+		unit_assert(enm && z);
+		unit_assert(query_dname_compare(z->name, enm) == 0);
+		free(enm);
+	} else {
+		unit_assert(z == NULL);
+	}
+	lock_rw_unlock(&zones->lock);
+}
+
+/** test the local zones index */
+static void
+localzone_index_test(void)
+{
+	struct local_zones* zones = local_zones_create();
+	struct local_zone* z;
+	char buf[64];
+	int i;
+	unit_show_func("services/localzone.c", "lz_index_find");
+	unit_assert(zones);
+	lzindex_check(zones, "www.example.com.", NULL);
+	lzindex_add(zones, "example.com.");
+	z = lzindex_add(zones, "sub.example.com.");
+	lzindex_add(zones, "net.");
+	lzindex_check(zones, "www.example.com.", "example.com.");
+	lzindex_check(zones, "www.SUB.example.com.", "sub.example.com.");
+	lzindex_check(zones, "sub.example.com.", "sub.example.com.");
+	lzindex_check(zones, "example.org.", NULL);
+	lzindex_check(zones, "a.b.c.net.", "net.");
+	/* grow the index many times */
+	for(i=0; i<5000; i++) {
+		snprintf(buf, sizeof(buf), "z%d.example.com.", i);
+		lzindex_add(zones, buf);
+	}
+	unit_assert(zones->index && zones->index->size >= 10000);
+	/* label counts of the zones, with the root label */
+	unit_assert(zones->index->labs[0] == ((1<<2)|(1<<3)|(1<<4)));
+	lzindex_check(zones, "a.b.c.d.e.f.example.org.", NULL);
+	lzindex_check(zones, "a.b.c.d.e.f.example.com.", "example.com.");
+	for(i=0; i<5000; i+=7) {
+		char expect[64];
+		snprintf(buf, sizeof(buf), "www.z%d.example.com.", i);
+		snprintf(expect, sizeof(expect), "z%d.example.com.", i);
+		lzindex_check(zones, buf, expect);
+	}
+	lzindex_check(zones, "z5000.example.com.", "example.com.");
+	/* removal keeps the other zones findable */
+	lock_rw_wrlock(&zones->lock);
+	local_zones_del_zone(zones, z);
+	lock_rw_unlock(&zones->lock);
+	lzindex_check(zones, "www.sub.example.com.", "example.com.");
+	for(i=1; i<5000; i+=2) {
+		uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+		size_t len = sizeof(nm);
+		snprintf(buf, sizeof(buf), "z%d.example.com.", i);
+		unit_assert(sldns_str2wire_dname_buf(buf, nm, &len) == 0);
+		lock_rw_wrlock(&zones->lock);
+		z = local_zones_find(zones, nm, len, dname_count_labels(nm),
+			LDNS_RR_CLASS_IN);
+		unit_assert(z);
+		local_zones_del_zone(zones, z);
+		lock_rw_unlock(&zones->lock);
+	}
+	for(i=0; i<5000; i+=3) {
+		char expect[64];
+		snprintf(buf, sizeof(buf), "a.z%d.example.com.", i);
+		snprintf(expect, sizeof(expect), "z%d.example.com.", i);
+		lzindex_check(zones, buf, (i%2)?"example.com.":expect);
+	}
+	local_zones_delete(zones);
+}
+
+#include "util/regional.h"
+/** number of query names in the local zones benchmark */
+#define LZBENCH_QUERIES 100000
+
+/** time lookups of the query names, returns ns per lookup */
+static double
+lzindex_bench_time(struct local_zones* zones, uint8_t** qs, int lookups,
+	int expect_found)
+{
+	struct timeval start, end;
+	uint32_t s = 1234;
+	int i, found = 0;
+	gettimeofday(&start, NULL);
+	lock_rw_rdlock(&zones->lock);
+	for(i=0; i<lookups; i++) {
+		uint8_t* nm;
+		s = s*1103515245 + 12345;
+		nm = qs[(s>>8)%LZBENCH_QUERIES];
+		if(local_zones_lookup(zones, nm, dname_valid(nm,
+			LDNS_MAX_DOMAINLEN+1), dname_count_labels(nm),
+			LDNS_RR_CLASS_IN, LDNS_RR_TYPE_A))
+			found++;
+	}
+	lock_rw_unlock(&zones->lock);
+	gettimeofday(&end, NULL);
+	unit_assert(found == (expect_found?lookups:0));
+	return ((double)(end.tv_sec - start.tv_sec)*1e9 +
+		(double)(end.tv_usec - start.tv_usec)*1e3) / (double)lookups;
+}
+
+/** make the query names, under a zone or not */
+static uint8_t**
+lzindex_bench_names(int num, int hit)
+{
+	char buf[128];
+	int i;
+	uint8_t** qs = (uint8_t**)calloc(LZBENCH_QUERIES, sizeof(*qs));
+	unit_assert(qs);
+	for(i=0; i<LZBENCH_QUERIES; i++) {
+		size_t len = 0;
+		int z = (int)(((unsigned)i*2654435761u) % (unsigned)num);
+		snprintf(buf, sizeof(buf), "www.host.%c%d.d%d.%s", (hit?'z':'y'),
+			z, z%100, (hit?"example.":"other."));
+		qs[i] = sldns_str2wire_dname(buf, &len);
+		unit_assert(qs[i]);
+	}
+	return qs;
+}
+
+/** local zones lookup speed, build time and memory, the zones index
+ * against the tree */
+static void
+localzone_index_bench(void)
+{
+	int sizes[] = {1000, 100000, 1000000}, n, i, j;
+	int lookups = 2000000;
+	unit_show_func("services/localzone.c", "lz_index_find speed");
+	for(n=0; n<(int)(sizeof(sizes)/sizeof(sizes[0])); n++) {
+		int num = sizes[n];
+		struct local_zones* zones = local_zones_create();
+		struct local_zone* z;
+		struct local_zones_index* idx;
+		uint8_t** qs[2];
+		struct timeval start, end;
+		double build, t_idx[2], t_tree[2];
+		size_t mem_tree = 0, mem_idx;
+		char buf[64];
+		unit_assert(zones);
+		gettimeofday(&start, NULL);
+		lock_rw_wrlock(&zones->lock);
+		for(i=0; i<num; i++) {
+			size_t len = 0;
+			uint8_t* nm;
+			snprintf(buf, sizeof(buf), "z%d.d%d.example.", i, i%100);
+			nm = sldns_str2wire_dname(buf, &len);
+			unit_assert(nm);
+			z = local_zones_add_zone(zones, nm, len,
+				dname_count_labels(nm), LDNS_RR_CLASS_IN,
+				local_zone_static);
+			unit_assert(z);
+		}
+		lock_rw_unlock(&zones->lock);
+		gettimeofday(&end, NULL);
+		build = (double)(end.tv_sec - start.tv_sec) +
+			(double)(end.tv_usec - start.tv_usec)/1e6;
+		RBTREE_FOR(z, struct local_zone*, &zones->ztree)
+			mem_tree += sizeof(*z) + z->namelen +
+				sizeof(struct regional);
+		mem_idx = sizeof(*zones->index) + zones->index->size *
+			sizeof(*zones->index->slots) + zones->index->size/2;
+		qs[0] = lzindex_bench_names(num, 1);
+		qs[1] = lzindex_bench_names(num, 0);
+		for(j=0; j<2; j++)
+			t_idx[j] = lzindex_bench_time(zones, qs[j], lookups,
+				j==0);
+		/* the tree lookup is used when there is no index */
+		idx = zones->index;
+		zones->index = NULL;
+		for(j=0; j<2; j++)
+			t_tree[j] = lzindex_bench_time(zones, qs[j], lookups,
+				j==0);
+		zones->index = idx;
+		printf("%d zones: build %.3f sec (%.0f ns/zone), zones %u "
+			"bytes, index %u bytes (+%.0f%%)\n", num, build,
+			build*1e9/num, (unsigned)mem_tree, (unsigned)mem_idx,
+			100.*(double)mem_idx/(double)mem_tree);
+		printf("%d zones: lookup under a zone: index %.1f ns, "
+			"tree %.1f ns; not under a zone: index %.1f ns, "
+			"tree %.1f ns\n", num, t_idx[0], t_tree[0], t_idx[1],
+			t_tree[1]);
+		for(j=0; j<2; j++) {
+			for(i=0; i<LZBENCH_QUERIES; i++)
+				free(qs[j][i]);
+			free(qs[j]);
+		}
+		local_zones_delete(zones);
+	}
+}
+
+#include "util/module.h"
+#include "util/regional.h"
+#include "sldns/pkthdr.h"
+/** answer a query from the local zones, returns the rcode, or -1 if the
+ * local zones did not answer. The number of answer RRs is in ancount. */
+static int
+lzfile_answer(struct local_zones* zones, struct config_file* cfg,
+	const char* str, int* ancount)
+{
+	uint8_t nm[LDNS_MAX_DOMAINLEN+1];
+	size_t len = sizeof(nm);
+	struct module_env env;
+	struct query_info qinfo;
+	struct edns_data edns;
+	struct regional* temp = regional_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	int r = -1;
+	unit_assert(temp && buf);
+	unit_assert(sldns_str2wire_dname_buf(str, nm, &len) == 0);
+	memset(&env, 0, sizeof(env));
+	env.cfg = cfg;
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = nm;
+	qinfo.qname_len = len;
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	memset(&edns, 0, sizeof(edns));
+	edns.udp_size = 512;
+	sldns_buffer_clear(buf);
+	memset(sldns_buffer_begin(buf), 0, LDNS_HEADER_SIZE);
+	if(local_zones_answer(zones, &env, &qinfo, &edns, buf, temp, NULL,
+		NULL, 0, NULL, 0, NULL, 0, NULL, 0, NULL)) {
+		r = (int)LDNS_RCODE_WIRE(sldns_buffer_begin(buf));
+		*ancount = (int)LDNS_ANCOUNT(sldns_buffer_begin(buf));
+	}
+	sldns_buffer_free(buf);
+	regional_destroy(temp);
+	return r;
+}
+
+/** test the compiled local zone file */
+static void
+localzone_file_test(void)
+{
+	const char* fname = "unitmain.lzc.tmp";
+	FILE* out;
+	struct config_file* cfg = config_create();
+	struct local_zones* zones = local_zones_create();
+	int i, an = 0;
+	char buf[64];
+	unit_show_func("services/localzone.c", "local_zones_write_file");
+	unit_assert(cfg && zones);
+	cfg->local_zones_disable_default = 1;
+	unit_assert(config_set_option(cfg, "local-zone:",
+		"blocked.example. always_nxdomain"));
+	unit_assert(config_set_option(cfg, "local-zone:",
+		"refused.example. always_refuse"));
+	unit_assert(config_set_option(cfg, "local-zone:",
+		"data.example. static"));
+	unit_assert(config_set_option(cfg, "local-data:",
+		"www.data.example. A 192.0.2.1"));
+	for(i=0; i<1000; i++) {
+		snprintf(buf, sizeof(buf), "b%d.example. refuse", i);
+		unit_assert(config_set_option(cfg, "local-zone:", buf));
+	}
+	unit_assert(local_zones_apply_cfg(zones, cfg));
+	unit_assert(local_zones_write_file(zones, fname));
+	local_zones_delete(zones);
+	config_delete(cfg);
+
+	unit_show_func("services/localzone.c", "lz_enter_file");
+	cfg = config_create();
+	zones = local_zones_create();
+	unit_assert(cfg && zones);
+	cfg->local_zones_disable_default = 1;
+	cfg->local_zone_file = strdup(fname);
+	unit_assert(cfg->local_zone_file);
+	/* the config zone is closer to the qname than the file zone */
+	unit_assert(config_set_option(cfg, "local-zone:",
+		"sub.blocked.example. transparent"));
+	unit_assert(local_zones_apply_cfg(zones, cfg));
+	unit_assert(zones->file_map);
+	/* only the zone with data is in the tree, besides the config zone */
+	unit_assert(zones->ztree.count == 2);
+	unit_assert(lzfile_answer(zones, cfg, "x.BLOCKED.example.", &an)
+		== LDNS_RCODE_NXDOMAIN);
+	unit_assert(lzfile_answer(zones, cfg, "refused.example.", &an)
+		== LDNS_RCODE_REFUSED);
+	unit_assert(lzfile_answer(zones, cfg, "sub.blocked.example.", &an)
+		== -1);
+	unit_assert(lzfile_answer(zones, cfg, "www.data.example.", &an)
+		== LDNS_RCODE_NOERROR && an == 1);
+	unit_assert(lzfile_answer(zones, cfg, "ftp.data.example.", &an)
+		== LDNS_RCODE_NXDOMAIN);
+	unit_assert(lzfile_answer(zones, cfg, "example.", &an) == -1);
+	for(i=0; i<1000; i+=13) {
+		snprintf(buf, sizeof(buf), "www.b%d.example.", i);
+		unit_assert(lzfile_answer(zones, cfg, buf, &an)
+			== LDNS_RCODE_REFUSED);
+	}
+	local_zones_delete(zones);
+	config_delete(cfg);
+
+	/* a changed byte in the file fails the checksum */
+	out = fopen(fname, "r+b");
+	unit_assert(out);
+	unit_assert(fseek(out, -3, SEEK_END) == 0);
+	unit_assert(fputc('x', out) != EOF);
+	fclose(out);
+	cfg = config_create();
+	zones = local_zones_create();
+	unit_assert(cfg && zones);
+	cfg->local_zones_disable_default = 1;
+	cfg->local_zone_file = strdup(fname);
+	unit_assert(cfg->local_zone_file);
+	unit_assert(!local_zones_apply_cfg(zones, cfg));
+	local_zones_delete(zones);
+	config_delete(cfg);
+	unlink(fname);
+}
+
+/** test the tag data rrsets that are built at config load */
+static void
+localzone_tag_data_test(void)
+{
+	struct regional* region = regional_create();
+	struct local_rrset* list = NULL, *clist = NULL;
+	struct ub_packed_rrset_key r;
+	struct packed_rrset_data* d;
+	struct query_info qinfo;
+	uint8_t qname[] = "\003www\007example\003com\000";
+	unit_show_func("services/localzone.c", "local_data_add_tag_data");
+	unit_assert(region);
+	unit_assert(local_data_add_tag_data(region, &list, "A 10.0.0.1"));
+	unit_assert(local_data_add_tag_data(region, &list, "A 10.0.0.2"));
+	unit_assert(local_data_add_tag_data(region, &list, "AAAA ::1"));
+	unit_assert(!local_data_add_tag_data(region, &list, "A 10.0.0.x"));
+	unit_assert(local_data_add_tag_data(region, &clist,
+		"CNAME example.org."));
+
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = qname;
+	qinfo.qname_len = sizeof(qname)-1;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	memset(&r, 0, sizeof(r));
+	unit_assert(local_data_find_tag_datas(&qinfo, list, &r));
+	d = (struct packed_rrset_data*)r.entry.data;
+	unit_assert(r.rk.dname == qname && ntohs(r.rk.type) == LDNS_RR_TYPE_A);
+	unit_assert(d->count == 2 && d->rr_len[0] == 6 && d->rr_len[1] == 6);
+	qinfo.qtype = LDNS_RR_TYPE_AAAA;
+	memset(&r, 0, sizeof(r));
+	unit_assert(local_data_find_tag_datas(&qinfo, list, &r));
+	unit_assert(((struct packed_rrset_data*)r.entry.data)->count == 1);
+	qinfo.qtype = LDNS_RR_TYPE_TXT;
+	memset(&r, 0, sizeof(r));
+	unit_assert(!local_data_find_tag_datas(&qinfo, list, &r));
+	/* a CNAME is an answer for every type */
+	unit_assert(local_data_find_tag_datas(&qinfo, clist, &r));
+	unit_assert(ntohs(r.rk.type) == LDNS_RR_TYPE_CNAME);
+	regional_destroy(region);
+}
+
+#if defined(USE_CACHEDB) && defined(HAVE_SYS_MMAN_H)
+#include "cachedb/cachedb.h"
+#include "cachedb/mmapdb.h"
+#include "util/module.h"
+#include <fcntl.h>
+
+/** the key of the cachedb entry number i, the leading bits are spread */
+static char*
+mmapdb_test_key(unsigned int i)
+{
+	static char key[CACHEDB_HASHSIZE/4+1];
+	snprintf(key, sizeof(key), "%08x%056x", i*2654435761U, i);
+	return key;
+}
+
+/** store the data for entry i, the first byte of data is the value */
+static void
+mmapdb_test_store(struct module_env* env, struct cachedb_env* ce,
+	unsigned int i, uint8_t v, size_t len)
+{
+	uint8_t data[1000];
+	unit_assert(len <= sizeof(data));
+	memset(data, v, len);
+	(*ce->backend->store)(env, ce, mmapdb_test_key(i), data, len, 3600);
+}
+
+/** lookup entry i, returns the first byte of the data or -1 if not found */
+static int
+mmapdb_test_lookup(struct module_env* env, struct cachedb_env* ce,
+	unsigned int i, sldns_buffer* buf)
+{
+	if(!(*ce->backend->lookup)(env, ce, mmapdb_test_key(i), buf))
+		return -1;
+	unit_assert(sldns_buffer_limit(buf) > 0);
+	return (int)sldns_buffer_read_u8_at(buf, 0);
+}
+
+/** read a number at the offset in the file */
+static uint64_t
+mmapdb_test_read(int fd, off_t off)
+{
+	uint64_t v = 0;
+	unit_assert(pread(fd, &v, sizeof(v), off) == (ssize_t)sizeof(v));
+	return v;
+}
+
+/** test a corrupt length of the second record, the compaction does not
+ * copy it */
+static void
+mmapdb_test_corrupt(struct module_env* env, struct cachedb_env* ce,
+	sldns_buffer* buf, uint32_t len)
+{
+	const char* fname = env->cfg->cachedb_mmap_file;
+	uint64_t start;
+	unsigned int i;
+	int fd;
+	unlink(fname);
+	unit_assert((*ce->backend->init)(env, ce));
+	mmapdb_test_store(env, ce, 1, 11, 100);
+	mmapdb_test_store(env, ce, 2, 22, 100);
+	(*ce->backend->deinit)(env, ce);
+	fd = open(fname, O_RDWR);
+	unit_assert(fd != -1);
+	/* the data_start field of the header; the second record starts
+	 * after the first, with a 48 byte header and rounded up to 8, and
+	 * has the length after the key and expiry time */
+	start = mmapdb_test_read(fd, 32);
+	unit_assert(pwrite(fd, &len, sizeof(len), (off_t)(start + 152 + 40))
+		== (ssize_t)sizeof(len));
+	close(fd);
+	unit_assert((*ce->backend->init)(env, ce));
+	unit_assert(mmapdb_test_lookup(env, ce, 1, buf) == 11);
+	unit_assert(mmapdb_test_lookup(env, ce, 2, buf) == -1);
+	/* the file fills up and is compacted once */
+	for(i=10; i<110; i++)
+		mmapdb_test_store(env, ce, i, (uint8_t)i, 500);
+	mmapdb_compact_wait(ce);
+	unit_assert(mmapdb_test_lookup(env, ce, 109, buf) == 109);
+	unit_assert(mmapdb_test_lookup(env, ce, 2, buf) == -1);
+	unit_assert(mmapdb_test_lookup(env, ce, 1, buf) == 11);
+	(*ce->backend->deinit)(env, ce);
+}
+
+/** test the mmap cachedb backend */
+static void
+mmapdb_test(void)
+{
+	const char* fname = "unitmain.mmapdb.tmp";
+	struct config_file* cfg = config_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	struct module_env env;
+	struct cachedb_env ce;
+	time_t now = 1000000;
+	unsigned int i;
+	int fd;
+	unit_show_func("cachedb/mmapdb.c", "mmapdb_init");
+	unit_assert(cfg && buf);
+	memset(&env, 0, sizeof(env));
+	memset(&ce, 0, sizeof(ce));
+	env.cfg = cfg;
+	env.now = &now;
+	ce.backend = &mmapdb_backend;
+	free(cfg->cachedb_mmap_file);
+	cfg->cachedb_mmap_file = strdup(fname);
+	unit_assert(cfg->cachedb_mmap_file);
+	cfg->cachedb_mmap_size = 65536;
+	unlink(fname);
+
+	/* open, store and reopen */
+	unit_assert((*ce.backend->init)(&env, &ce));
+	mmapdb_test_store(&env, &ce, 1, 11, 100);
+	unit_assert(mmapdb_test_lookup(&env, &ce, 1, buf) == 11);
+	unit_assert(sldns_buffer_limit(buf) == 100);
+	unit_assert(mmapdb_test_lookup(&env, &ce, 2, buf) == -1);
+	(*ce.backend->deinit)(&env, &ce);
+	unit_assert((*ce.backend->init)(&env, &ce));
+	unit_assert(mmapdb_test_lookup(&env, &ce, 1, buf) == 11);
+
+	/* the older records of the same key are removed by compaction */
+	unit_show_func("cachedb/mmapdb.c", "mmapdb_compact");
+	for(i=0; i<300; i++)
+		mmapdb_test_store(&env, &ce, 2, (uint8_t)i, 500);
+	mmapdb_compact_wait(&ce);
+	unit_assert(mmapdb_test_lookup(&env, &ce, 2, buf) == (uint8_t)299);
+	unit_assert(mmapdb_test_lookup(&env, &ce, 1, buf) == 11);
+	/* the oldest are dropped when the file is full */
+	for(i=10; i<210; i++)
+		mmapdb_test_store(&env, &ce, i, (uint8_t)i, 500);
+	mmapdb_compact_wait(&ce);
+	unit_assert(mmapdb_test_lookup(&env, &ce, 209, buf) == 209);
+	unit_assert(mmapdb_test_lookup(&env, &ce, 10, buf) == -1);
+	/* expired entries are not returned */
+	now += 3601;
+	unit_assert(mmapdb_test_lookup(&env, &ce, 209, buf) == -1);
+	(*ce.backend->deinit)(&env, &ce);
+
+	/* a record with a corrupt length, that is in the log and that is
+	 * past the end of the log */
+	unit_show_func("cachedb/mmapdb.c", "mmapdb_rec_size");
+	mmapdb_test_corrupt(&env, &ce, buf, 20000);
+	mmapdb_test_corrupt(&env, &ce, buf, 0xfffffff0);
+
+	/* a corrupt header, the file is made empty */
+	fd = open(fname, O_RDWR);
+	unit_assert(fd != -1);
+	unit_assert(pwrite(fd, "garbage!", 8, 0) == 8);
+	close(fd);
+	unit_assert((*ce.backend->init)(&env, &ce));
+	unit_assert(mmapdb_test_lookup(&env, &ce, 109, buf) == -1);
+	mmapdb_test_store(&env, &ce, 3, 33, 100);
+	unit_assert(mmapdb_test_lookup(&env, &ce, 3, buf) == 33);
+	(*ce.backend->deinit)(&env, &ce);
+
+	unlink(fname);
+	sldns_buffer_free(buf);
+	config_delete(cfg);
+}
+#endif /* USE_CACHEDB && HAVE_SYS_MMAN_H */
+
+#include <sys/time.h>
+#include "util/storage/addrradix.h"
+/** element for the addr radix test */
+struct radix_test_elem {
+	/** node in the addr tree */
+	struct addr_tree_node node;
+	/** if inserted in the tree */
+	int inserted;
+};
+
+/** random number for the addr radix test, xorshift */
+static uint32_t
+radix_test_rnd(uint32_t* s)
+{
+	*s ^= *s << 13;
+	*s ^= *s >> 17;
+	*s ^= *s << 5;
+	return *s;
+}
+
+/** make random address, in a small part of the space so prefixes nest */
+static void
+radix_test_addr(struct sockaddr_storage* addr, socklen_t* addrlen, int ip6,
+	uint32_t* s)
+{
+	uint8_t* a;
+	size_t i, n;
+	memset(addr, 0, sizeof(*addr));
+	if(ip6) {
+		struct sockaddr_in6* sa6 = (struct sockaddr_in6*)addr;
+		sa6->sin6_family = AF_INET6;
+		a = (uint8_t*)&sa6->sin6_addr;
+		n = 16;
+		*addrlen = (socklen_t)sizeof(*sa6);
+	} else {
+		struct sockaddr_in* sa = (struct sockaddr_in*)addr;
+		sa->sin_family = AF_INET;
+		a = (uint8_t*)&sa->sin_addr;
+		n = 4;
+		*addrlen = (socklen_t)sizeof(*sa);
+	}
+	for(i=0; i<n; i++)
+		a[i] = (uint8_t)radix_test_rnd(s);
+	a[0] = (uint8_t)(10 + (a[0]&3));
+	a[1] &= 0x0f;
+}
+
+/** check that radix lookups give the same result as the addr tree */
+static void
+radix_test_compare(rbtree_type* tree, struct addr_radix* radix, int num,
+	uint32_t* s)
+{
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	int i;
+	for(i=0; i<num; i++) {
+		radix_test_addr(&addr, &addrlen, (i&1), s);
+		unit_assert(addr_radix_lookup(radix, &addr, addrlen) ==
+			addr_tree_lookup(tree, &addr, addrlen));
+	}
+}
+
+/** fill tree with random prefixes */
+static void
+radix_test_fill(rbtree_type* tree, struct radix_test_elem* elems, int num,
+	uint32_t* s, struct addr_radix* radix)
+{
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	int i, net;
+	for(i=0; i<num; i++) {
+		if(elems[i].inserted)
+			continue;
+		radix_test_addr(&addr, &addrlen, (i&1), s);
+		net = (int)(radix_test_rnd(s)%((i&1)?129:33));
+		addr_mask(&addr, addrlen, net);
+		elems[i].inserted = addr_tree_insert(tree, &elems[i].node,
+			&addr, addrlen, net);
+		if(elems[i].inserted && radix)
+			addr_radix_insert(radix, &elems[i].node);
+	}
+}
+
+/** time lookups, in seconds */
+static double
+radix_test_time(rbtree_type* tree, struct addr_radix* radix, int num,
+	uint32_t seed)
+{
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct timeval start, end;
+	int i, found = 0;
+	gettimeofday(&start, NULL);
+	for(i=0; i<num; i++) {
+		radix_test_addr(&addr, &addrlen, 0, &seed);
+		if(radix)
+			found += (addr_radix_lookup(radix, &addr, addrlen)!=NULL);
+		else	found += (addr_tree_lookup(tree, &addr, addrlen)!=NULL);
+	}
+	gettimeofday(&end, NULL);
+	unit_assert(found >= 0);
+	return (double)(end.tv_sec - start.tv_sec) +
+		(double)(end.tv_usec - start.tv_usec)/1000000.;
+}
+
+/** test the radix index on addr trees, and compare lookup speed */
+static void
+addr_radix_test(void)
+{
+	int num = 5000, i;
+	uint32_t s = 4711;
+	rbtree_type tree;
+	struct addr_radix radix;
+	struct radix_test_elem* elems = calloc((size_t)num, sizeof(*elems));
+	unit_show_func("util/storage/addrradix.c", "addr_radix_lookup");
+	unit_assert(elems);
+	addr_tree_init(&tree);
+	addr_radix_init(&radix, &tree);
+	/* not built, lookups use the tree */
+	radix_test_fill(&tree, elems, num, &s, NULL);
+	addr_tree_init_parents(&tree);
+	radix_test_compare(&tree, &radix, 10000, &s);
+	unit_assert(addr_radix_build(&radix));
+	unit_assert(radix.built && radix.num_alloc == 0);
+	radix_test_compare(&tree, &radix, 50000, &s);
+
+	/* remove and insert elements */
+	unit_show_func("util/storage/addrradix.c", "addr_radix_remove");
+	for(i=0; i<num; i+=3) {
+		if(!elems[i].inserted)
+			continue;
+		addr_radix_remove(&radix, &elems[i].node);
+		(void)rbtree_delete(&tree, &elems[i].node);
+		elems[i].inserted = 0;
+	}
+	addr_tree_init_parents(&tree);
+	radix_test_compare(&tree, &radix, 50000, &s);
+	radix_test_fill(&tree, elems, num, &s, &radix);
+	addr_tree_init_parents(&tree);
+	radix_test_compare(&tree, &radix, 50000, &s);
+	/* removing all elements leaves no branch nodes */
+	for(i=0; i<num; i++) {
+		if(!elems[i].inserted)
+			continue;
+		addr_radix_remove(&radix, &elems[i].node);
+		(void)rbtree_delete(&tree, &elems[i].node);
+	}
+	unit_assert(tree.count == 0);
+	unit_assert(radix.root4 == NULL && radix.root6 == NULL);
+	unit_assert(radix.num_alloc == 0);
+	addr_radix_clear(&radix);
+	unit_assert(!radix.built && addr_radix_get_mem(&radix) == 0);
+	free(elems);
+}
+
+/** lookup microbenchmark, addr tree against the radix index */
+static void
+addr_radix_bench(void)
+{
+	int num = 50000, lookups = 200000;
+	uint32_t s = 1234;
+	rbtree_type tree;
+	struct addr_radix radix;
+	double t_tree, t_radix;
+	struct radix_test_elem* elems = calloc((size_t)num, sizeof(*elems));
+	unit_show_func("util/storage/addrradix.c", "addr_radix_lookup speed");
+	unit_assert(elems);
+	addr_tree_init(&tree);
+	addr_radix_init(&radix, &tree);
+	radix_test_fill(&tree, elems, num, &s, NULL);
+	addr_tree_init_parents(&tree);
+	unit_assert(addr_radix_build(&radix));
+	t_tree = radix_test_time(&tree, NULL, lookups, 5678);
+	t_radix = radix_test_time(&tree, &radix, lookups, 5678);
+	printf("%d prefixes, %d lookups: addr_tree %.3f sec, "
+		"addr_radix %.3f sec\n", (int)tree.count, lookups, t_tree,
+		t_radix);
+	addr_radix_clear(&radix);
+	free(elems);
+}
+
 void unit_show_func(const char* file, const char* func)
 {
 	printf("test %s:%s\n", file, func);
@@ -907,10 +1816,14 @@ void ecdsa_evp_workaround_init(void);
 int 
 main(int argc, char* argv[])
 {
+	int bench = 0;
 	log_init(NULL, 0, NULL);
-	if(argc != 1) {
-		printf("usage: %s\n", argv[0]);
+	if(argc == 2 && strcmp(argv[1], "-b") == 0) {
+		bench = 1;
+	} else if(argc != 1) {
+		printf("usage: %s [-b]\n", argv[0]);
 		printf("\tperforms unit tests.\n");
+		printf("-b\truns the speed benchmarks, not the unit tests.\n");
 		return 1;
 	}
 	/* Disable roundrobin for the unit tests */
@@ -935,6 +1848,20 @@ main(int argc, char* argv[])
 		fatal_exit("could not init NSS");
 #endif /* HAVE_SSL or HAVE_NSS*/
 	checklock_start();
+	if(bench) {
+		authzone_bench();
+		rrset_cache_bench();
+		localzone_index_bench();
+		addr_radix_bench();
+#ifdef CLIENT_SUBNET
+		ecs_bench();
+#endif /* CLIENT_SUBNET */
+#ifdef USE_DNSTAP
+		dnstap_bench();
+#endif /* USE_DNSTAP */
+		checklock_stop();
+		return 0;
+	}
 	authzone_test();
 	neg_test();
 	rnd_test();
@@ -954,9 +1881,20 @@ main(int argc, char* argv[])
 	ldns_test();
 	msgparse_test();
 	tcpid_test();
+	rrset_cache_downgrade_test();
+	localzone_index_test();
+	localzone_file_test();
+	localzone_tag_data_test();
+#if defined(USE_CACHEDB) && defined(HAVE_SYS_MMAN_H)
+	mmapdb_test();
+#endif
+	addr_radix_test();
 #ifdef CLIENT_SUBNET
 	ecs_test();
 #endif /* CLIENT_SUBNET */
+#ifdef USE_DNSTAP
+	dnstap_test();
+#endif /* USE_DNSTAP */
 	if(log_get_lock()) {
 		lock_basic_destroy((lock_basic_type*)log_get_lock());
 	}
@@ -75,10 +75,20 @@ void regional_test(void);
 #ifdef CLIENT_SUBNET
 /** Unit test for ECS functions */
 void ecs_test(void);
+/** Speed benchmark for ECS functions */
+void ecs_bench(void);
 #endif /* CLIENT_SUBNET */
+#ifdef USE_DNSTAP
+/** Unit test for dnstap functions */
+void dnstap_test(void);
+/** Speed benchmark for dnstap functions */
+void dnstap_bench(void);
+#endif /* USE_DNSTAP */
 /** unit test for ldns functions */
 void ldns_test(void);
 /** unit test for auth zone functions */
 void authzone_test(void);
+/** speed benchmark for auth zone functions */
+void authzone_bench(void);
 
 #endif /* TESTCODE_UNITMAIN_H */
@@ -119,6 +119,8 @@ config_create(void)
 	cfg->tls_cert_bundle = NULL;
 	cfg->tls_win_cert = 0;
 	cfg->tls_use_sni = 1;
+	cfg->tls_session_cache_size = 0;
+	cfg->tls_use_ktls = 0;
 	cfg->https_port = UNBOUND_DNS_OVER_HTTPS_PORT;
 	if(!(cfg->http_endpoint = strdup("/dns-query"))) goto error_exit;
 	cfg->http_max_streams = 100;
@@ -195,6 +197,8 @@ config_create(void)
 	cfg->so_rcvbuf = 0;
 	cfg->so_sndbuf = 0;
 	cfg->so_reuseport = REUSEPORT_DEFAULT;
+	cfg->busy_poll = 0;
+	cfg->use_io_uring = 0;
 	cfg->ip_transparent = 0;
 	cfg->ip_freebind = 0;
 	cfg->ip_dscp = 0;
@@ -245,6 +249,7 @@ config_create(void)
 	cfg->trust_anchor_list = NULL;
 	cfg->trusted_keys_file_list = NULL;
 	cfg->trust_anchor_signaling = 1;
+	cfg->trust_anchor_prime_on_start = 0;
 	cfg->root_key_sentinel = 1;
 	cfg->domain_insecure = NULL;
 	cfg->val_date_override = 0;
@@ -276,6 +281,7 @@ config_create(void)
 #endif
 	cfg->local_zones_disable_default = 0;
 	cfg->local_data = NULL;
+	cfg->local_zone_file = NULL;
 	cfg->local_zone_overrides = NULL;
 	cfg->unblock_lan_zones = 0;
 	cfg->insecure_lan_zones = 0;
@@ -354,6 +360,10 @@ config_create(void)
 #ifdef USE_CACHEDB
 	if(!(cfg->cachedb_backend = strdup("testframe"))) goto error_exit;
 	if(!(cfg->cachedb_secret = strdup("default"))) goto error_exit;
+	cfg->cachedb_write_behind_size = 0;
+	cfg->cachedb_write_behind_interval = 10;
+	if(!(cfg->cachedb_mmap_file = strdup("cachedb.mmap"))) goto error_exit;
+	cfg->cachedb_mmap_size = 64*1024*1024;
 #ifdef USE_REDIS
 	if(!(cfg->redis_server_host = strdup("127.0.0.1"))) goto error_exit;
 	cfg->redis_timeout = 100;
@@ -531,6 +541,8 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STRLIST_APPEND("tls-session-ticket-keys:", tls_session_ticket_keys)
 	else S_STR("tls-ciphers:", tls_ciphers)
 	else S_STR("tls-ciphersuites:", tls_ciphersuites)
+	else S_NUMBER_OR_ZERO("tls-session-cache-size:", tls_session_cache_size)
+	else S_YNO("tls-use-ktls:", tls_use_ktls)
 	else S_YNO("tls-use-sni:", tls_use_sni)
 	else S_NUMBER_NONZERO("https-port:", https_port)
 	else S_STR("http-endpoint:", http_endpoint)
@@ -556,6 +568,8 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_MEMSIZE("so-rcvbuf:", so_rcvbuf)
 	else S_MEMSIZE("so-sndbuf:", so_sndbuf)
 	else S_YNO("so-reuseport:", so_reuseport)
+	else S_NUMBER_OR_ZERO("busy-poll:", busy_poll)
+	else S_YNO("use-io-uring:", use_io_uring)
 	else S_YNO("ip-transparent:", ip_transparent)
 	else S_YNO("ip-freebind:", ip_freebind)
 	else S_NUMBER_OR_ZERO("ip-dscp:", ip_dscp)
@@ -624,6 +638,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STRLIST("trust-anchor:", trust_anchor_list)
 	else S_STRLIST("trusted-keys-file:", trusted_keys_file_list)
 	else S_YNO("trust-anchor-signaling:", trust_anchor_signaling)
+	else S_YNO("trust-anchor-prime-on-start:", trust_anchor_prime_on_start)
 	else S_YNO("root-key-sentinel:", root_key_sentinel)
 	else S_STRLIST("domain-insecure:", domain_insecure)
 	else S_NUMBER_OR_ZERO("val-bogus-ttl:", bogus_ttl)
@@ -634,6 +649,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("log-replies:", log_replies)
 	else S_YNO("log-tag-queryreply:", log_tag_queryreply)
 	else S_YNO("log-local-actions:", log_local_actions)
+	else S_STR("local-zone-file:", local_zone_file)
 	else S_YNO("log-servfail:", log_servfail)
 	else S_YNO("val-permissive-mode:", val_permissive_mode)
 	else S_YNO("aggressive-nsec:", aggressive_nsec)
@@ -708,6 +724,12 @@ int config_set_option(struct config_file* cfg, const char* opt,
 		dnstap_log_forwarder_query_messages)
 	else S_YNO("dnstap-log-forwarder-response-messages:",
 		dnstap_log_forwarder_response_messages)
+	else S_NUMBER_OR_ZERO("dnstap-sample-rate:", dnstap_sample_rate)
+	else S_STR("dnstap-filter-qtype:", dnstap_filter_qtype)
+	else S_STR("dnstap-filter-rcode:", dnstap_filter_rcode)
+	else S_YNO("dnstap-filter-local-zone:", dnstap_filter_local_zone)
+	else S_NUMBER_OR_ZERO("dnstap-filter-response-time:",
+		dnstap_filter_response_time)
 #endif
 #ifdef USE_DNSCRYPT
 	else S_YNO("dnscrypt-enable:", dnscrypt)
@@ -977,6 +999,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_MEM(opt, "so-rcvbuf", so_rcvbuf)
 	else O_MEM(opt, "so-sndbuf", so_sndbuf)
 	else O_YNO(opt, "so-reuseport", so_reuseport)
+	else O_DEC(opt, "busy-poll", busy_poll)
+	else O_YNO(opt, "use-io-uring", use_io_uring)
 	else O_YNO(opt, "ip-transparent", ip_transparent)
 	else O_YNO(opt, "ip-freebind", ip_freebind)
 	else O_DEC(opt, "ip-dscp", ip_dscp)
@@ -1018,6 +1042,8 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_LST(opt, "tls-session-ticket-keys", tls_session_ticket_keys.first)
 	else O_STR(opt, "tls-ciphers", tls_ciphers)
 	else O_STR(opt, "tls-ciphersuites", tls_ciphersuites)
+	else O_DEC(opt, "tls-session-cache-size", tls_session_cache_size)
+	else O_YNO(opt, "tls-use-ktls", tls_use_ktls)
 	else O_YNO(opt, "tls-use-sni", tls_use_sni)
 	else O_DEC(opt, "https-port", https_port)
 	else O_STR(opt, "http-endpoint", http_endpoint)
@@ -1036,6 +1062,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "log-replies", log_replies)
 	else O_YNO(opt, "log-tag-queryreply", log_tag_queryreply)
 	else O_YNO(opt, "log-local-actions", log_local_actions)
+	else O_STR(opt, "local-zone-file", local_zone_file)
 	else O_YNO(opt, "log-servfail", log_servfail)
 	else O_STR(opt, "pidfile", pidfile)
 	else O_YNO(opt, "hide-identity", hide_identity)
@@ -1094,6 +1121,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_LST(opt, "trust-anchor", trust_anchor_list)
 	else O_LST(opt, "trusted-keys-file", trusted_keys_file_list)
 	else O_YNO(opt, "trust-anchor-signaling", trust_anchor_signaling)
+	else O_YNO(opt, "trust-anchor-prime-on-start", trust_anchor_prime_on_start)
 	else O_YNO(opt, "root-key-sentinel", root_key_sentinel)
 	else O_LST(opt, "control-interface", control_ifs.first)
 	else O_LST(opt, "domain-insecure", domain_insecure)
@@ -1141,6 +1169,12 @@ config_get_option(struct config_file* cfg, const char* opt,
 		dnstap_log_forwarder_query_messages)
 	else O_YNO(opt, "dnstap-log-forwarder-response-messages",
 		dnstap_log_forwarder_response_messages)
+	else O_DEC(opt, "dnstap-sample-rate", dnstap_sample_rate)
+	else O_STR(opt, "dnstap-filter-qtype", dnstap_filter_qtype)
+	else O_STR(opt, "dnstap-filter-rcode", dnstap_filter_rcode)
+	else O_YNO(opt, "dnstap-filter-local-zone", dnstap_filter_local_zone)
+	else O_DEC(opt, "dnstap-filter-response-time",
+		dnstap_filter_response_time)
 #endif
 #ifdef USE_DNSCRYPT
 	else O_YNO(opt, "dnscrypt-enable", dnscrypt)
@@ -1204,6 +1238,10 @@ config_get_option(struct config_file* cfg, const char* opt,
 #ifdef USE_CACHEDB
 	else O_STR(opt, "backend", cachedb_backend)
 	else O_STR(opt, "secret-seed", cachedb_secret)
+	else O_DEC(opt, "write-behind-size", cachedb_write_behind_size)
+	else O_DEC(opt, "write-behind-interval", cachedb_write_behind_interval)
+	else O_STR(opt, "mmap-file", cachedb_mmap_file)
+	else O_MEM(opt, "mmap-size", cachedb_mmap_size)
 #ifdef USE_REDIS
 	else O_STR(opt, "redis-server-host", redis_server_host)
 	else O_DEC(opt, "redis-server-port", redis_server_port)
@@ -1537,6 +1575,7 @@ config_delete(struct config_file* cfg)
 	config_delstrlist(cfg->local_zones_ipset);
 #endif
 	config_delstrlist(cfg->local_data);
+	free(cfg->local_zone_file);
 	config_deltrplstrlist(cfg->local_zone_overrides);
 	config_del_strarray(cfg->tagname, cfg->num_tags);
 	config_del_strbytelist(cfg->local_zone_tags);
@@ -1558,6 +1597,8 @@ config_delete(struct config_file* cfg)
 	free(cfg->dnstap_tls_client_key_file);
 	free(cfg->dnstap_tls_client_cert_file);
 	free(cfg->dnstap_identity);
+	free(cfg->dnstap_filter_qtype);
+	free(cfg->dnstap_filter_rcode);
 	free(cfg->dnstap_version);
 	config_deldblstrlist(cfg->ratelimit_for_domain);
 	config_deldblstrlist(cfg->ratelimit_below_domain);
@@ -1571,6 +1612,7 @@ config_delete(struct config_file* cfg)
 #ifdef USE_CACHEDB
 	free(cfg->cachedb_backend);
 	free(cfg->cachedb_secret);
+	free(cfg->cachedb_mmap_file);
 #ifdef USE_REDIS
 	free(cfg->redis_server_host);
 #endif  /* USE_REDIS */
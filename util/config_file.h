@@ -128,6 +128,11 @@ struct config_file {
 	char* tls_ciphers;
 	/** TLS chiphersuites (TLSv1.3) */
 	char* tls_ciphersuites;
+	/** number of sessions in the TLS session cache, 0 keeps the defaults
+	 * of the TLS library */
+	int tls_session_cache_size;
+	/** if kernel TLS offload is to be used for downstream TLS */
+	int tls_use_ktls;
 	/** if SNI is to be used */
 	int tls_use_sni;
 
@@ -205,6 +210,11 @@ struct config_file {
 	size_t so_sndbuf;
 	/** SO_REUSEPORT requested on port 53 sockets */
 	int so_reuseport;
+	/** SO_BUSY_POLL microseconds on port 53 sockets, and to poll in
+	 * the epoll event loop before it sleeps */
+	int busy_poll;
+	/** if the UDP ports receive and reply with an io_uring */
+	int use_io_uring;
 	/** IP_TRANSPARENT socket option requested on port 53 sockets */
 	int ip_transparent;
 	/** IP_FREEBIND socket option request on port 53 sockets */
@@ -358,6 +368,8 @@ struct config_file {
 	struct config_strlist* domain_insecure;
 	/** send key tag query */
 	int trust_anchor_signaling;
+	/** prime the trust anchors at startup, and signal readiness after */
+	int trust_anchor_prime_on_start;
 	/** enable root key sentinel */
 	int root_key_sentinel;
 
@@ -424,6 +436,8 @@ struct config_file {
 	int local_zones_disable_default;
 	/** local data RRs configured */
 	struct config_strlist* local_data;
+	/** compiled local zone file, mapped into memory, or NULL */
+	char* local_zone_file;
 	/** local zone override types per netblock */
 	struct config_str3list* local_zone_overrides;
 	/** unblock lan zones (reverse lookups for AS112 zones) */
@@ -539,6 +553,16 @@ struct config_file {
 	int dnstap_log_forwarder_query_messages;
 	/** true to log dnstap FORWARDER_RESPONSE message events */
 	int dnstap_log_forwarder_response_messages;
+	/** log 1 in this many client subnets or query names, 0 logs all */
+	int dnstap_sample_rate;
+	/** list of qtypes to log, NULL or "" logs all */
+	char* dnstap_filter_qtype;
+	/** list of rcodes to log responses for, NULL or "" logs all */
+	char* dnstap_filter_rcode;
+	/** true to log client responses only for local-zone and RPZ answers */
+	int dnstap_filter_local_zone;
+	/** log upstream responses that took at least this many msec, 0 all */
+	int dnstap_filter_response_time;
 
 	/** true to disable DNSSEC lameness check in iterator */
 	int disable_dnssec_lame_check;
@@ -635,6 +659,14 @@ struct config_file {
 	char* cachedb_backend;
 	/** secret seed for hash key calculation */
 	char* cachedb_secret;
+	/** max number of stores queued per thread, 0 stores directly */
+	int cachedb_write_behind_size;
+	/** interval (in ms) to flush the queued stores to the backend */
+	int cachedb_write_behind_interval;
+	/** file for the mmap backend */
+	char* cachedb_mmap_file;
+	/** size of the file of the mmap backend */
+	size_t cachedb_mmap_size;
 #ifdef USE_REDIS
 	/** redis server's IP address or host name */
 	char* redis_server_host;
@@ -712,6 +744,8 @@ struct config_auth {
 	/** fallback to recursion to authorities if zone expired and other
 	 * reasons perhaps (like, query bogus) */
 	int fallback_enabled;
+	/** size of the cache of encoded downstream answers, 0 is off */
+	size_t answer_cache_size;
 	/** this zone is used to create local-zone policies */
 	int isrpz;
 	/** rpz tags (or NULL) */
@@ -354,8 +354,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 	(yy_hold_char) = *yy_cp; \
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
-#define YY_NUM_RULES 343
-#define YY_END_OF_BUFFER 344
+#define YY_NUM_RULES 359
+#define YY_END_OF_BUFFER 360
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -363,377 +363,395 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[3354] =
+static const flex_int16_t yy_accept[3519] =
     {   0,
-        1,    1,  317,  317,  321,  321,  325,  325,  329,  329,
-        1,    1,  333,  333,  337,  337,  344,  341,    1,  315,
-      315,  342,    2,  342,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  317,  318,  318,  319,
-      342,  321,  322,  322,  323,  342,  328,  325,  326,  326,
-      327,  342,  329,  330,  330,  331,  342,  340,  316,    2,
-      320,  342,  340,  336,  333,  334,  334,  335,  342,  337,
-      338,  338,  339,  342,  341,    0,    1,    2,    2,    2,
-        2,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  317,
-        0,  321,    0,  328,    0,  325,  329,    0,  340,    0,
-        2,    2,  340,  336,    0,  333,  337,    0,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  340,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  125,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  134,
-      341,  341,  341,  341,  341,  341,  341,  340,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  109,  341,  314,  341,
-      341,  341,  341,  341,  341,  341,    8,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  126,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  139,  341,  340,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  307,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  340,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,   64,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      239,  341,   14,   15,  341,   19,   18,  341,  341,  223,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  132,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  221,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,    3,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      340,  341,  341,  341,  341,  341,  341,  341,  301,  341,
-      341,  300,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  324,
-      341,  341,  341,  341,  341,  341,  341,  341,   63,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,   67,  341,  270,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  308,  309,  341,  341,
-      341,  341,  341,  341,  341,   68,  341,  341,  133,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  129,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  210,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,   21,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  158,  341,  341,  340,  324,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      107,  341,  341,  341,  341,  341,  341,  341,  278,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  182,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  157,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  106,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-       32,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-       33,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,   65,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  131,  340,  341,  341,
-
-      341,  341,  341,  124,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,   66,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  243,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  183,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,   54,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  261,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,   58,  341,   59,
-      341,  341,  341,  341,  341,  110,  341,  111,  341,  341,
-      341,  341,  108,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,    7,  341,  340,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  232,  341,  341,  341,  341,  160,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  244,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,   45,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,   55,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  202,  341,  201,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,   16,   17,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,   69,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  209,  341,  341,  341,
-      341,  341,  341,  113,  341,  112,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  193,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  140,  340,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  101,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,   89,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  222,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,   94,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,   62,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  196,  197,  341,  341,  341,
-      272,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,    6,  341,  341,  341,  341,  341,  341,
-      291,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  276,  341,
-      341,  341,  341,  341,  341,  302,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,   42,  341,  341,
-      341,  341,   44,  341,  341,  341,   90,  341,  341,  341,
-
-      341,  341,   52,  341,  341,  341,  341,  341,  341,  341,
-      340,  341,  189,  341,  341,  341,  135,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  214,  341,  190,
-      341,  341,  341,  229,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,   53,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  137,  118,  341,  119,  341,
-      341,  341,  117,  341,  341,  341,  341,  341,  341,  341,
-      341,  155,  341,  341,   50,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  260,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  191,  341,  341,  341,  341,  341,  194,  341,  200,
-      341,  341,  341,  341,  341,  228,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  105,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  130,  341,  341,  341,  341,  341,  341,  341,   60,
-      341,  341,  341,   26,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,   20,  341,  341,  341,  341,  341,  341,
-       27,   36,  341,  165,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  340,  341,  341,
-      341,  341,  341,  341,   77,   79,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  280,
-      341,  341,  341,  341,  240,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  120,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  154,  341,   46,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  295,  341,  341,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      159,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  289,  341,  341,  341,  220,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  305,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  176,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  114,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  171,
-      341,  184,  341,  341,  341,  341,  340,  341,  143,  341,
-      341,  341,  341,  341,  100,  341,  341,  341,  341,  212,
-
-      341,  341,  341,  341,  341,  341,  230,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  252,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  136,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  175,
-      341,  341,  341,  341,  341,  341,   80,  341,   81,  341,
-      341,  341,  341,  341,   61,  298,  341,  341,  341,  341,
-      341,   88,  185,  341,  203,  341,  233,  341,  341,  195,
-      273,  341,  341,  341,  341,  341,   73,  341,  187,  341,
-      341,  341,  341,  341,    9,  341,  341,  341,  341,  341,
-
-      104,  341,  341,  341,  341,  265,  341,  341,  341,  341,
-      211,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  340,  341,  341,
-      341,  341,  174,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  161,  341,  279,  341,  341,  341,  341,
-      341,  251,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  224,  341,  341,  341,  341,  341,  271,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      299,  341,  186,  341,  341,  341,  341,  341,  341,  341,
-       72,   74,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  103,  341,  341,  341,  341,  263,  341,  341,  341,
-      341,  275,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  216,   34,   28,   30,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,   35,  341,   29,
-       31,  341,  341,  341,  341,  341,  341,  341,  341,   99,
-
-      341,  341,  341,  341,  341,  341,  340,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  218,  215,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,   71,  341,
-      341,  341,  138,  341,  121,  341,  341,  341,  341,  341,
-      341,  341,  341,  156,   47,  341,  341,  341,  332,   13,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      293,  341,  296,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,   12,  341,  341,   22,  341,  341,  341,
-      341,  341,  269,  341,  341,  341,  341,  277,  341,  341,
-
-      341,   75,  341,  226,  341,  341,  341,  341,  341,  217,
-      341,  341,   70,  341,  341,  341,  341,   23,  341,   43,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  170,  169,  332,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  219,  213,  341,  231,  341,  341,
-      281,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,   82,  341,  341,  341,  341,  264,  341,
-      341,  341,  341,  199,  341,  341,  341,  341,  225,  341,
-
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      303,  304,  167,  341,  341,   76,  341,  341,  341,  341,
-      177,  341,  341,  341,  115,  116,  341,  341,  341,  341,
-      162,  341,  164,  341,  204,  341,  341,  341,  341,  168,
-      341,  341,  234,  341,  341,  341,  341,  341,  341,  341,
-      145,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  242,  341,  341,  341,  341,  341,  341,
-      341,  312,  341,   24,  341,  274,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-       86,  205,  341,  341,  262,  341,  297,  341,  198,  341,
-
-      341,  341,  341,   56,  341,  341,  341,  341,  341,  341,
-        4,  341,  341,  341,  341,  128,  144,  341,  341,  341,
-      181,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  237,   37,   38,  341,
-      341,  341,  341,  341,  341,  341,  282,  341,  341,  341,
-      341,  341,  341,  341,  250,  341,  341,  341,  341,  341,
-      341,  341,  341,  208,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,   85,  341,   57,  268,
-      341,  238,  341,  341,  341,  341,   11,  341,  341,  341,
-      341,  341,  341,  341,  341,  127,  341,  341,  341,  341,
-
-      206,   91,  341,   40,  341,  341,  341,  341,  341,  341,
-      341,  341,  173,  341,  341,  341,  341,  341,  147,  341,
-      341,  341,  341,  241,  341,  341,  341,  341,  341,  249,
-      341,  341,  341,  341,  141,  341,  341,  341,  122,  123,
-      341,  341,  341,   93,   97,   92,  341,  341,  341,  341,
-       83,  341,  341,  341,  341,  341,   10,  341,  341,  341,
-      341,  341,  266,  306,  341,  341,  341,  341,  311,   39,
-      341,  341,  341,  341,  341,  172,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,   98,
-
-       96,  341,   51,  341,  341,   84,  294,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  192,  341,  341,  341,
-      341,  341,  207,  341,  341,  341,  341,  341,  341,  341,
-      341,  163,   78,  341,  341,  341,  341,  341,  283,  341,
-      341,  341,  341,  341,  341,  341,  246,  341,  341,  245,
-      142,  341,  341,   95,   48,  341,  148,  149,  152,  153,
-      150,  151,   87,  292,  341,  341,  267,  341,  341,  341,
-      341,  166,  341,  341,  341,  341,  341,  236,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  179,  178,
-
-       41,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  290,  341,  341,  341,  341,  102,  341,
-      235,  341,  259,  287,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  313,  341,   49,    5,  341,
-      341,  227,  341,  341,  288,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  247,   25,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  248,  341,
-      341,  341,  146,  341,  341,  341,  341,  341,  341,  341,
-      341,  180,  341,  188,  341,  341,  341,  341,  341,  341,
-
-      341,  341,  341,  284,  341,  341,  341,  341,  341,  341,
-      341,  341,  341,  341,  341,  341,  341,  341,  341,  341,
-      341,  310,  341,  341,  255,  341,  341,  341,  341,  341,
-      285,  341,  341,  341,  341,  341,  341,  286,  341,  341,
-      341,  253,  341,  256,  257,  341,  341,  341,  341,  341,
-      254,  258,    0
+        1,    1,  333,  333,  337,  337,  341,  341,  345,  345,
+        1,    1,  349,  349,  353,  353,  360,  357,    1,  331,
+      331,  358,    2,  358,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  333,  334,  334,
+      335,  358,  337,  338,  338,  339,  358,  344,  341,  342,
+      342,  343,  358,  345,  346,  346,  347,  358,  356,  332,
+        2,  336,  358,  356,  352,  349,  350,  350,  351,  358,
+      353,  354,  354,  355,  358,  357,    0,    1,    2,    2,
+        2,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  333,    0,  337,    0,  344,    0,  341,
+      345,    0,  356,    0,    2,    2,  356,  352,    0,  349,
+      353,    0,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  356,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  129,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      138,  357,  357,  357,  357,  357,  357,  357,  357,  356,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  113,  357,  330,  357,  357,  357,  357,  357,  357,
+      357,    8,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  130,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  144,  357,  357,  356,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  323,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  356,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+       68,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  246,  357,   14,   15,  357,
+       19,   18,  357,  357,  230,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  136,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  228,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,    3,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  356,
+      357,  357,  357,  357,  357,  357,  357,  357,  313,  357,
+      357,  357,  312,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  340,  357,  357,  357,  357,  357,  357,  357,  357,
+       67,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,   71,  357,  282,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      324,  325,  357,  357,  357,  357,  357,  357,  357,   72,
+      357,  357,  137,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  133,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  217,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,   21,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  163,
+      357,  357,  357,  356,  340,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  111,  357,
+      357,  357,  357,  357,  357,  357,  290,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  188,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  162,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  110,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,   32,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,   33,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+       69,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  135,  356,  357,  357,  357,  357,  357,  357,  128,
+      357,   63,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,   70,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      250,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  189,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,   56,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  317,  318,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  273,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,   60,  357,
+       61,  357,  357,  357,  357,  357,  114,  357,  115,  357,
+      357,  357,  357,  112,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,    7,  357,  357,  356,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  239,  357,
+      357,  357,  357,  165,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  251,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,   47,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,   57,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  208,  357,  207,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,   16,   17,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+       73,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  216,  357,  357,  357,  357,  357,  357,
+      117,  357,  116,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  199,  357,  357,
+      357,  357,  357,  357,  357,  357,  145,  357,  356,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      105,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+       93,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  229,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,   98,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,   66,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  202,
+      203,  357,  357,  357,  284,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,    6,  357,  357,
+
+      357,  357,  357,  357,  303,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  288,  357,  357,  357,  357,  357,  357,  314,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,   42,  357,  357,  357,  357,  357,   46,  357,  357,
+      357,   94,  357,  357,  357,  357,  357,  357,   54,  357,
+      357,  357,  357,  357,  357,  357,  357,  356,  357,  195,
+      357,  357,  357,  139,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  221,  357,  196,  357,  357,
+
+      357,  236,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,   55,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  141,  122,  357,  123,  357,
+      357,  357,  121,  357,  357,  357,  357,  357,  357,  357,
+      357,  160,  357,  357,   52,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  272,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  197,  357,  357,  357,  357,  357,  357,  200,  357,
+      206,  357,  357,  357,  357,  357,  235,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  109,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  134,  357,  357,  357,  357,  357,  357,  357,
+       62,  357,  357,  357,   26,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,   20,  357,  357,  357,  357,  357,
+      357,  357,   27,   45,   36,  357,  170,  357,  357,  357,
+      357,  357,  357,   64,  357,  357,  357,  357,  357,  357,
+      357,  357,  356,  357,  357,  357,  357,  357,  357,  357,
+       81,   83,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  292,  357,  357,  357,  357,
+      247,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  124,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  159,  357,   48,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  307,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  164,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  301,  357,  357,  357,  227,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  321,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  182,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  118,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      177,  357,  190,  357,  357,  357,  357,  357,  357,  356,
+      357,  148,  357,  357,  357,  357,  357,  357,  104,  357,
+      357,  357,  357,  219,  357,  357,  357,  357,  357,  357,
+      237,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  259,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  140,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  181,  357,  357,
+      357,  357,  357,  357,   84,  357,   85,  357,  357,  357,
+      357,  357,   65,  310,  357,  357,  357,  357,  357,   92,
+      191,  357,  210,  357,  357,  240,  357,  357,  201,  285,
+      357,  357,  357,  357,  357,   77,  357,  193,  357,  357,
+      357,  357,  357,    9,  357,  357,  357,  357,  357,  108,
+      357,  357,  357,  357,  277,  357,  357,  357,  357,  218,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      356,  357,  357,  357,  357,  180,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  166,  357,  291,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  258,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  231,  357,  357,  357,  357,  357,  283,  357,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  311,
+      357,  192,  209,  357,  357,  357,  357,  357,  357,  357,
+       76,   78,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  107,  357,  357,  357,  357,  275,  357,  357,  357,
+      357,  287,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  223,   34,   28,   30,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,   35,  357,   29,
+       31,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  103,  357,  357,  357,  357,  357,  357,  357,  357,
+      356,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  225,  222,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,   75,  357,
+      357,  357,  142,  357,  125,  357,  357,  357,  357,  357,
+      357,  357,  357,  161,   49,  357,  357,  357,  348,   13,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      305,  357,  308,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,   12,  357,  357,   22,  357,  357,  357,
+
+      357,  357,  281,  357,  357,  357,  357,  289,  357,  357,
+      357,   79,  357,  233,  357,  357,  357,  357,  357,  224,
+      357,  357,   74,  357,  357,  357,  357,   23,  357,   43,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  176,  175,  357,  357,  348,  357,
+      357,  357,  357,  143,  357,  357,  357,  357,  357,  226,
+      220,  357,  238,  357,  357,  293,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,   86,  357,  357,  357,  357,  276,  357,
+      357,  357,  357,  205,  357,  357,  357,  357,  232,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      319,  320,  173,  357,  357,   80,  357,  357,  357,  357,
+      183,  357,  357,  357,  119,  120,  357,  357,  357,  357,
+      357,  167,  357,  357,  169,  357,  211,  357,  357,  357,
+      357,  174,  357,  357,  315,  357,  241,  357,  357,  357,
+      357,  357,  357,  357,  150,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  266,
+      357,  357,  249,  357,  357,  357,  357,  357,  357,  357,
+
+      328,  357,   24,  357,  286,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,   90,
+      212,  357,  357,  274,  357,  309,  357,  204,  357,  357,
+      357,  357,   58,  357,  357,  357,  357,  357,  357,    4,
+      357,  357,  357,  357,  132,  149,  357,  357,  357,  187,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  244,   37,
+       38,  357,  357,  357,  357,  357,  357,  357,  294,  357,
+      357,  357,  267,  268,  357,  357,  357,  357,  357,  357,
+      257,  357,  357,  357,  357,  357,  357,  357,  357,  215,
+
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,   89,  357,   59,  280,  357,  245,  357,  357,
+      357,  357,   11,  357,  357,  357,  357,  357,  357,  357,
+      357,  131,  357,  357,  357,  357,  213,   95,  357,   40,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      179,  357,  357,  357,  357,  357,  357,  152,  357,  357,
+      357,  357,  248,  357,  357,  357,  357,  357,  357,  357,
+      256,  357,  357,  357,  357,  146,  357,  357,  357,  126,
+      127,  357,  357,  357,   97,  101,   96,  357,  357,  357,
+      357,   87,  357,  357,  357,  357,  357,   10,  357,  357,
+
+      357,  357,  357,  278,  322,  357,  357,  357,  357,  327,
+       39,  357,  357,  357,  357,  357,  357,  357,  178,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  102,  100,  357,   53,  357,
+      357,   88,  306,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  198,  357,  357,  357,  357,  357,  214,  357,
+      357,  357,  357,  357,  357,  357,  357,  316,  357,  357,
+      168,   82,  357,  357,  357,  357,  357,  295,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  253,  357,  357,
+
+      252,  147,  357,  357,   99,   50,  357,  153,  154,  157,
+      158,  155,  156,   91,  304,  357,  357,  279,  357,  357,
+      357,   44,  357,  357,  171,  357,  357,  357,  357,  357,
+      243,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  185,  184,   41,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  269,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  302,  357,  357,  357,  357,  357,  106,  357,  242,
+      357,  271,  299,  357,  357,  357,  357,  357,  357,  357,
+
+      357,  357,  357,  357,  357,  329,  357,   51,    5,  357,
+      357,  357,  234,  357,  357,  300,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  254,   25,  357,  357,
+      357,  357,  357,  357,  357,  270,  357,  357,  357,  357,
+      357,  357,  255,  357,  172,  357,  357,  151,  357,  357,
+      357,  357,  357,  357,  357,  357,  186,  357,  194,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  296,  357,
+      357,  357,  357,  357,  357,  357,  357,  357,  357,  357,
+      357,  357,  357,  357,  357,  357,  326,  357,  357,  262,
+      357,  357,  357,  357,  357,  297,  357,  357,  357,  357,
+
+      357,  357,  298,  357,  357,  357,  260,  357,  263,  264,
+      357,  357,  357,  357,  357,  261,  265,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -770,2216 +788,1768 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[41] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    1,    7,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[3372] =
+static const flex_int16_t yy_base[3519] =
     {   0,
-        0,    0,   38,   41,   44,   46,   59,   65,   71,   77,
-       90,  112,   96,  118,  124,  136, 4327, 4282,   81, 6547,
-     6547, 6547,  129,   52,  130,   63,  131,  152,   70,  140,
-      149,  156,   57,   88,   76,  173,  175,   95,  197,  145,
-      185,  199,  208,  213,  178,  123, 4186, 6547, 6547, 6547,
-      107, 4109, 6547, 6547, 6547,  154, 4045, 3722, 6547, 6547,
-     6547,  245, 3578, 6547, 6547, 6547,  163, 3220, 6547,  249,
-     6547,  253,  148, 2696, 2594, 6547, 6547, 6547,  257, 2157,
-     6547, 6547, 6547,  233, 1707,  263,  201,    0,  267,    0,
-        0,  165,  191,  221,  252,  205,  181,  265,   92,  261,
-
-      216,  263,  271,  272,  210,  279,  274,  282,  278,  291,
-      283,  286,  276,  285,  295,  293,  306,  314,  297,  313,
-      317,  311,  315,  319,  321,  331,  327,  332,  336,  322,
-      339,  337,  346,  345,  347,  348,  353,  351,  357,  284,
-      358,  359,  369,  360,  380,  365,  381,  379,  375,  366,
-      367,  389,  390,  394,  393,  395,  396,  403,  404, 1665,
-      419, 1172,  422,  924,  429,  854,  832,  433,  781,  437,
-      441,    0,  433,  705,  447,  479,  287,  452,  411,  445,
-      426,  446,  447,  448,  449,  450,  451,  453,  452,  456,
-      470,  234,  463,  473,  481,  479,  476,  483,  486,  487,
-
-      488,  489,  491,  492,  501,  500,  502,  505,  508,  510,
-      511,  460,  509,  513,  527,  515,  516,  519,  538,  529,
-      540,  543,  539,  548,  555,  400,  550,  551,  558,  553,
-      560,  561,  569,  562,  565,  566,  567,  570,  572,  574,
-      576,  579,  578,  582,  577,  590,  591,  585,  595,  594,
-      606,  601,  608,  604,  605,  362,  607,  611,  615,  623,
-      612,  627,  613,  614,  629,  633,  640,  641,  636,  622,
-      637,  639,  643,  644,  646,  648,  647,  656,  660,  659,
-      663,  667,  657,  665,  669,  671,  673,  649,  682,  675,
-      684,  688,  680,  683,  690,  692,  694,  696,  695,  699,
-
-      697,  700,  708,  704,  713,  712,  721,  716,  722,  719,
-      731,  732,  727,  717,  728,  729,  733,  736,  730,  740,
-      738,  741,  745,  743,  750,  752,  760,  755,  756,  771,
-      763,  766,  762,  773,  774,  769,  775,  793,  798,  799,
-      786,  800,  801,  804,  803,  805,  807,  808,  809,  818,
-      811,  823,  815,  824,  825,  829,  836,  834, 6547,  831,
-      833,  847,  848,  849,  852,  765,  856,  858,  839,  868,
-      864,  861,  870,  892,  865,  878,  869,  871,  874, 6547,
-      887,  880,  916,  882,  889,  902,  903,  900,  904,  905,
-      917,  910,  933,  850,  914,  922,  943,  939,  925,  938,
-
-      940,  907,  941,  948,  949,  946,  951,  953,  960,  952,
-      957,  959,  971,  961,  970,  972,  965,  974,  980,  985,
-      987,  992,  975,  984,  995,  978,  990,  998, 1008, 1003,
-     1001, 1009, 1012, 1015, 1023, 1019, 1027, 1028, 1002, 1029,
-     1030, 1035, 1031, 1038, 1041, 1039, 1042, 1051, 1049, 1047,
-     1048, 1054, 1055, 1056, 1058, 1061, 1064, 1063, 1068, 1072,
-     1066, 1073, 1079, 1067, 1085, 1077, 6547, 1089, 6547, 1080,
-     1083, 1087, 1092, 1093, 1094, 1095, 6547, 1097, 1100, 1102,
-     1105, 1109, 1111, 1110, 1116, 1112, 1123, 1124, 1125, 1128,
-     1135, 1130, 1133, 1138, 1137, 1140, 1141, 1144, 1142, 1147,
-
-     1149, 1148, 1154, 1155, 1158, 1175, 6547, 1157, 1167, 1162,
-     1159, 1168, 1169, 1187, 1185, 1188, 1186, 1190, 1203, 1198,
-     1204, 1206, 1207, 1160, 1210, 1212, 1214, 1216, 1217, 1218,
-     1219, 1221, 1222, 1223, 1225, 1224, 1228, 6547, 1226, 1236,
-     1247, 1242, 1245, 1246, 1248, 1249, 1161, 1251, 1250, 1106,
-      517, 1253, 1257, 1258, 1259, 1272, 1267, 1270, 1268, 1269,
-     1275, 1274, 1276, 1278, 1287, 1283, 1289, 1291, 1299, 1298,
-     1301, 1308, 1310, 1303, 1305, 1311, 1307, 1306, 1313, 1315,
-     1322, 1316, 1319, 1326, 1329, 1328, 1331, 1335, 1320, 1336,
-     1333, 1341, 1342, 1343, 1344, 1351, 1350, 1346, 1358, 1353,
-
-     1356, 1354, 1352, 1373, 1374, 1363, 1365, 6547, 1381, 1367,
-     1382, 1383, 1384, 1388, 1390, 1386, 1392, 1393, 1394, 1396,
-     1397, 1399, 1403, 1404, 1405, 1406, 1408, 1419, 1416, 1411,
-     1427, 1426, 1428, 1418, 1430, 1432, 1431, 1440, 1438, 1441,
-     1439, 1445, 1446, 1453, 1448, 1449, 1454, 1463, 1456, 1455,
-     1460, 1458, 1466, 1469, 1468, 1483, 1472, 1480, 1488, 1489,
-     1479, 1491, 1481, 1492, 1496, 1497, 1498, 1499, 1501, 1508,
-     1503, 1510, 1505, 1509, 1511, 1506, 1522, 1512, 1523, 1526,
-     1530, 1513, 1528, 1531, 1533, 1536, 1537, 1538, 1539, 1541,
-     1545, 1543, 1549, 1548, 1550, 1554, 1560, 1561, 1563, 1564,
-
-     1567, 1568, 1571, 1570, 1573, 1581, 1572, 1582, 1584, 1585,
-     1587, 1588, 1592, 1591, 1598, 1595, 1601, 1603, 1605, 1604,
-     1607, 1611, 1614, 1616, 1608, 6547, 1615, 1628, 1623, 1626,
-     1624, 1627, 1629, 1637, 1632, 1635, 1633, 1638, 1639, 1664,
-     6547, 1641, 6547, 6547, 1644, 6547, 6547, 1645, 1649, 6547,
-     1662, 1648, 1658, 1646, 1670, 1677, 1679, 1667, 1675, 1660,
-     1687, 1691, 1694, 1696, 1682, 1697, 1688, 1702, 1708, 1653,
-     1704, 1705, 1711, 1721, 1716, 1724, 1718, 1726, 1727, 1729,
-     1732, 1736, 1738, 1740, 1739, 1743, 1744, 1745, 1747, 1746,
-     1749, 1752, 1755, 1756, 1753, 1758, 1759, 1774, 1772, 1761,
-
-     1779, 6547, 1775, 1782, 1789, 1785, 1792, 1784, 1788, 1791,
-     1764, 1796, 1793, 1797, 1798, 1800, 1802, 1805, 1804, 1809,
-     1810, 1806, 1812, 1822, 1813, 6547, 1817, 1818, 1824, 1825,
-     1828, 1831, 1833, 1829, 1835, 1836, 1839, 1847, 1849, 1840,
-     1842, 1844, 1851, 1854, 1856, 6547, 1862, 1858, 1863, 1865,
-     1866, 1868, 1869, 1871, 1874, 1873, 1876, 1877, 1878, 1879,
-     1886, 1883, 1885, 1890, 1891, 1895, 1900, 1902, 1904, 1906,
-     1908, 1910, 1911, 1912, 1913, 1915, 1916, 1924, 1927, 1923,
-     1928, 1925, 1920, 1944, 1947, 1929, 1931, 1942, 1943, 1945,
-     1951, 1955, 1953, 1946, 1957, 1965, 1958, 1961, 1963, 1967,
-
-     1974, 1969, 1971, 1976, 1979, 1980, 1982, 1983, 6547, 1985,
-     1989, 6547, 1986, 1988, 1990, 2012, 1991, 1993, 1995, 2005,
-     1994, 2014, 1998, 2006, 2022, 2016, 2032, 2025, 2024, 2035,
-     2029, 2037, 2036, 2040, 2041, 2043, 2046, 2047, 2053, 2049,
-     2063, 2067, 2066, 2073, 2075, 2050, 2058, 2062, 2081, 2071,
-     2074, 2070, 2076, 2085, 2091, 2090, 2078, 2093, 2094, 2099,
-     2103, 2104, 2102, 2105, 2106, 2108, 2111, 2116, 2117, 6547,
-     2124, 2125, 2119, 2127, 2121, 2135, 2131, 2130, 6547, 2133,
-     2139, 2140, 2147, 2143, 2144, 2145, 2146, 2151, 2153, 2155,
-     2159, 2160, 2158, 2154, 2176, 6547, 2161, 6547, 2172, 2162,
-
-     2174, 2175, 2178, 2179, 2180, 2183, 6547, 6547, 2187, 2181,
-     2197, 2201, 2191, 2184, 2202, 6547, 2203, 2210, 6547, 2207,
-     2213, 2206, 2205, 2212, 2214, 2217, 2218, 2227, 2222, 2229,
-     2224, 2226, 2234, 6547, 2235, 2236, 2240, 2241, 2237, 2243,
-     2244, 2250, 2247, 6547, 2254, 2251, 2256, 2264, 2266, 2261,
-     2263, 2268, 2272, 2269, 2274, 2275, 2276, 2277, 2284, 2286,
-     2283, 2289, 2291, 2298, 6547, 2282, 2285, 2303, 2299, 2302,
-     2306, 2307, 2308, 2309, 2310, 2311, 1996, 2312, 2318, 2319,
-     2320, 2327, 2329, 2322, 2325, 2333, 2324, 2334, 2335, 2342,
-     2340, 2341, 2344, 2345, 6547, 2346, 2352, 2349,  171, 2353,
-
-     2356, 2354, 2355, 2359, 2362, 2357, 2378, 2379, 2364, 2376,
-     2382, 2383, 2375, 2385, 2386, 2387, 2374, 2390, 2392, 2394,
-     6547, 2396, 2398, 2400, 2401, 2403, 2404, 2406, 6547, 2410,
-     2426, 2423, 2430, 2408, 2405, 2431, 2417, 2421, 2432, 2433,
-     2435, 2437, 2440, 2442, 2444, 2443, 6547, 2447, 2448, 2452,
-     2450, 2458, 2460, 2459, 2451, 2461, 2465, 2467, 2471, 2473,
-     2469, 2472, 2474, 2475, 2477, 2482, 2478, 2485, 2487, 2488,
-     2489, 2490, 2492, 2494, 2499, 2500, 6547, 2507, 2506, 2504,
-     2509, 2510, 2512, 2522, 2513, 2532, 2515, 2523, 2516, 2535,
-     2538, 2540, 2524, 2548, 2544, 2549, 2541, 2558, 2555, 2559,
-
-     2562, 2556, 2565, 2567, 2568, 2569, 2571, 2573, 2574, 2575,
-     2576, 2584, 2591, 2581, 2592, 2590, 2595, 2583, 2601, 2614,
-     2598, 6547, 2603, 2605, 2613, 2615, 2622, 2617, 2618, 2623,
-     2619, 2625, 2627, 2629, 2630, 2638, 2635, 2637, 2639, 2642,
-     2641, 2643, 2649, 2650, 2651, 2654, 2658, 2660, 2662, 2663,
-     6547, 2664, 2666, 2669, 2670, 2673, 2674, 2678, 2680, 2682,
-     2683, 2684, 2686, 2689, 2690, 2691, 2692, 2698, 2699, 2695,
-     6547, 2700, 2702, 2710, 2706, 2714, 2708, 2718, 2721, 2722,
-     2725, 2728, 2712, 2729, 2731, 2732, 6547, 2740, 2742, 2739,
-     2743, 2741, 2746, 2747, 2749, 2751, 6547, 2752, 2753, 2754,
-
-     2761, 2762, 2757, 6547, 2766, 2764, 2759, 2768, 2769, 2772,
-     2774, 2775, 2770, 2780, 2782, 2789, 2796, 2783, 2793, 6547,
-     2785, 2803, 2791, 2799, 2807, 2787, 2810, 2811, 2812, 2813,
-     2814, 2818, 6547, 2827, 2819, 2824, 2834, 2830, 2831, 2836,
-     2837, 2838, 2840, 2839, 2841, 2844, 6547, 2847, 2845, 2848,
-     2850, 2852, 2853, 2855, 2868, 2860, 2865, 2867, 2870, 2873,
-     2875, 2877, 2869, 2878, 2879, 2880, 2886, 2890, 2891, 2892,
-     2895, 2899, 2904, 2901, 2903, 2907, 2906, 2908, 2909, 2916,
-     2917, 2924, 2919, 2925, 6547, 2928, 2930, 2923, 2921, 2931,
-     2933, 2935, 2937, 2940, 2936, 2938, 2948, 2945, 2942, 2955,
-
-     2958, 2951, 2962, 2960, 2964, 2965, 2967, 2966, 2968, 2969,
-     2976, 2973, 2975, 2986, 2977, 2984, 2995, 2981, 2991, 2992,
-     2993, 2994, 2982, 2998, 3004, 2999, 2997, 3006, 3007, 3015,
-     3018, 3021, 3020, 3009, 3023, 3027, 3028, 6547, 3031, 3033,
-     3029, 3035, 3036, 3042, 3043, 3045, 3046, 3037, 3051, 3053,
-     3054, 3059, 3060, 3062, 3063, 3070, 3066, 6547, 3067, 6547,
-     3068, 3069, 3072, 3081, 3076, 6547, 3087, 6547, 3077, 3091,
-     3082, 3084, 6547, 3092, 3088, 3093, 3103, 3094, 3097, 3101,
-     3105, 3099, 3106, 3112, 3111, 3115, 3114, 3116, 3122, 3117,
-     3119, 3127, 3125, 3134, 3124, 3126, 3141, 3135, 3138, 3143,
-
-     3144, 3145, 6547, 3152, 3148, 3153, 3154, 3155, 3156, 3158,
-     3159, 3161, 3162, 3165, 3173, 3167, 3179, 3169, 3178, 3181,
-     3193, 3177, 3194, 6547, 3190, 3192, 3195, 3196, 6547, 3198,
-     3199, 3200, 3205, 3207, 3208, 3209, 3210, 3211, 3215, 3216,
-     3217, 3229, 3225, 3222, 3231, 6547, 3230, 3236, 3218, 3242,
-     3249, 3244, 3246, 3251, 3252, 3254, 3263, 3259, 3258, 3260,
-     3261, 3262, 3265, 3272, 3273, 3269, 3276, 3275, 3279, 3286,
-     3283, 3277, 3281, 3287, 3289, 3290, 3291, 3292, 3293, 3296,
-     3297, 3294, 6547, 3302, 3308, 3306, 3315, 3311, 3312, 3316,
-     3321, 3317, 6547, 3323, 3324, 3325, 3327, 3332, 3326, 3329,
-
-     3334, 3337, 3340, 3342, 3345, 3347, 3346, 6547, 3348, 6547,
-     3350, 3351, 3361, 3365, 3366, 3353, 3367, 3373, 3369, 3374,
-     3376, 3379, 3377, 3383, 3380, 3385, 3386, 3388, 3400, 3391,
-     3387, 3392, 3401, 3402, 3406, 3409, 3410, 3411, 6547, 6547,
-     3412, 3413, 3417, 3414, 3420, 3421, 3424, 3432, 3428, 3427,
-     3434, 3435, 3448, 6547, 3436, 3443, 3438, 3446, 3462, 3449,
-     3464, 3465, 3452, 3440, 3472, 3468, 6547, 3461, 3469, 3476,
-     3471, 3477, 3479, 6547, 3482, 6547, 3475, 3478, 3485, 3487,
-     3488, 3489, 3491, 3492, 3499, 3509, 3510, 3495, 3512, 3507,
-     3500, 3513, 3515, 3516, 3523, 3519, 3521, 3522, 6547, 3525,
-
-     3526, 3530, 3528, 3531, 3538, 3535, 3539, 6547, 3542, 3545,
-     3548, 3549, 3551, 3550, 3553, 3556, 3557, 3555, 3559, 6547,
-     3558, 3561, 3572, 3573, 3565, 3574, 3576, 3579, 3587, 6547,
-     3584, 3588, 3596, 3592, 3593, 3598, 3599, 3594, 3595, 3601,
-     3603, 3604, 3606, 3607, 3608, 3610, 3613, 3615, 3612, 3622,
-     3623, 3626, 3630, 3639, 3631, 6547, 3635, 3636, 3640, 3638,
-     3642, 3643, 3645, 3648, 3650, 3651, 3661, 3662, 3653, 3664,
-     3666, 3668, 3673, 3675, 6547, 3676, 3669, 3683, 3679, 3681,
-     3689, 3680, 3686, 3693, 3682, 3690, 3694, 3695, 3698, 3707,
-     3702, 3705, 3706, 3708, 3718, 3709, 6547, 3723, 3713, 3719,
-
-     3730, 3720, 3726, 3739, 3735, 3736, 3737, 3743, 3738, 3745,
-     3740, 3747, 3748, 3751, 3752, 6547, 6547, 3754, 3755, 3757,
-     6547, 3759, 3761, 3771, 3763, 3767, 3770, 3774, 3775, 3773,
-     3776, 3778, 3779, 6547, 3786, 3789, 3787, 3790, 3798, 3794,
-     6547, 3793, 3806, 3802, 3803, 3805, 3809, 3811, 3810, 3813,
-     3815, 3817, 3818, 3826, 3827, 3824, 3823, 3828, 6547, 3825,
-     3831, 3834, 3836, 3837, 3840, 6547, 3841, 3842, 3849, 3851,
-     3852, 3859, 3862, 3854, 3864, 3847, 3867, 3869, 3871, 3872,
-     3873, 3880, 3875, 3877, 3879, 3883, 3885, 6547, 3886, 3887,
-     3891, 3897, 6547, 3900, 3907, 3908, 6547, 3910, 3894, 3909,
-
-     3905, 3918, 6547, 3913, 3915, 3916, 3921, 3929, 3922, 3930,
-     3926, 3927, 6547, 3933, 3932, 3935, 6547, 3934, 3941, 3948,
-     3950, 3936, 3958, 3953, 3938, 3954, 3955, 6547, 3957, 6547,
-     3963, 3961, 3967, 6547, 3965, 3969, 3970, 3972, 3974, 3979,
-     3980, 3986, 3988, 3976, 3982, 3990, 3978, 3994, 3995, 3999,
-     3992, 4002, 4001, 4003, 6547, 4004, 4006, 4009, 4007, 4012,
-     4014, 4020, 4015, 4021, 4022, 6547, 6547, 4029, 6547, 4030,
-     4025, 4031, 6547, 4034, 4037, 4044, 4039, 4042, 4046, 4053,
-     4050, 6547, 4055, 4059, 6547, 4040, 4061, 4068, 4057, 4065,
-     4066, 4069, 4071, 4072, 4073, 4076, 4074, 4078, 4075, 4077,
-
-     4091, 6547, 4079, 4081, 4082, 4084, 4095, 4096, 4100, 4102,
-     4098, 6547, 4106, 4112, 4105, 4115, 4117, 6547, 4119, 6547,
-     4108, 4121, 4122, 4125, 4129, 6547, 4131, 4132, 4136, 4137,
-     4138, 4139, 4140, 4142, 4144, 4149, 4156, 4152, 4151, 4153,
-     4160, 4158, 6547, 4155, 4161, 4168, 4170, 4172, 4173, 4182,
-     4178, 4177, 4180, 4181, 4185, 4188, 4190, 4194, 4192, 4199,
-     4196, 6547, 4203, 4205, 4202, 4217, 4206, 4210, 4208, 6547,
-     4209, 4222, 4224, 6547, 4213, 4225, 4228, 4231, 4232, 4233,
-     4236, 4234, 4238, 6547, 4235, 4242, 4239, 4241, 4244, 4255,
-     6547, 6547, 4256, 6547, 4257, 4243, 4258, 4260, 4240, 4261,
-
-     4268, 4271, 4277, 4269, 4279, 4281, 4272, 4274, 4290, 4293,
-     4297, 4292, 4294, 4298, 6547, 6547, 4300, 4304, 4301, 4307,
-     4308, 4303, 4311, 4320, 4312, 4321, 4324, 4326, 4333, 6547,
-     4328, 4316, 4334, 4325, 6547, 4335, 4337, 4339, 4340, 4341,
-     4343, 4347, 4344, 4348, 4349, 4351, 4352, 4354, 4365, 4357,
-     4358, 4366, 4367, 4368, 4359, 4374, 4380, 6547, 4377, 4375,
-     4381, 4382, 4384, 4387, 4388, 4389, 4390, 6547, 4395, 6547,
-     4391, 4393, 4396, 4397, 4413, 4398, 4414, 4415, 4416, 4418,
-     4419, 4422, 4423, 4427, 4424, 4429, 4432, 4434, 4436, 4438,
-     4440, 6547, 4444, 4441, 4447, 4448, 4451, 4453, 4454, 4456,
-
-     4457, 4459, 4462, 4463, 4465, 4470, 4466, 4472, 4471, 4474,
-     6547, 4478, 4487, 4476, 4489, 4479, 4484, 4491, 4498, 4501,
-     4492, 4502, 4503, 6547, 4504, 4496, 4507, 6547, 4508, 4509,
-     4510, 4512, 4521, 4518, 4522, 4523, 4524, 6547, 4530, 4513,
-     4534, 4526, 4531, 4535, 4536, 4542, 4545, 4544, 4547, 6547,
-     4557, 4548, 4556, 4558, 4552, 4555, 4559, 4564, 4566, 6547,
-     4570, 4571, 4572, 4579, 4574, 4584, 4581, 4583, 4582, 4585,
-     4590, 4591, 4594, 4596, 4597, 4599, 4608, 4610, 4611, 6547,
-     4589, 6547, 4612, 4616, 4620, 4618, 4623, 4622, 6547, 4624,
-     4625, 4630, 4631, 4626, 6547, 4633, 4632, 4634, 4638, 6547,
-
-     4636, 4647, 4637, 4643, 4654, 4658, 6547, 4661, 4662, 4651,
-     4669, 4670, 4666, 4668, 4671, 4672, 4674, 4676, 4677, 4678,
-     4687, 4680, 4683, 6547, 4689, 4692, 4698, 4699, 4682, 4700,
-     4701, 4702, 4708, 4703, 6547, 4705, 4711, 4712, 4713, 4714,
-     4715, 4717, 4725, 4720, 4723, 4724, 4728, 4729, 4730, 6547,
-     4733, 4736, 4737, 4744, 4740, 4753, 6547, 4749, 6547, 4746,
-     4756, 4759, 4739, 4763, 6547, 6547, 4750, 4767, 4766, 4769,
-     4770, 6547, 6547, 4772, 6547, 4773, 6547, 4774, 4776, 6547,
-     6547, 4775, 4777, 4781, 4782, 4784, 6547, 4790, 6547, 4799,
-     4794, 4785, 4796, 4797, 6547, 4798, 4804, 4800, 4808, 4806,
-
-     6547, 4810, 4815, 4811, 4813, 6547, 4822, 4823, 4814, 4816,
-     6547, 4824, 4831, 4827, 4835, 4836, 4837, 4838, 4841, 4843,
-     4839, 4844, 4846, 4847, 4854, 4861, 4863, 4865, 4869, 4858,
-     4856, 4871, 4872, 4877, 4875, 4879, 4880, 4881, 4883, 4884,
-     4886, 4889, 4890, 4892, 4895, 4893, 4894, 4906, 4896, 4898,
-     4908, 4910, 4899, 4909, 4913, 4912, 4917, 4915, 4920, 4923,
-     4922, 4924, 6547, 4928, 4930, 4933, 4935, 4934, 4940, 4942,
-     4944, 4950, 4953, 6547, 4957, 6547, 4959, 4951, 4955, 4961,
-     4962, 6547, 4963, 4964, 4965, 4968, 4967, 4970, 4848, 4971,
-     4974, 4975, 4972, 6547, 4979, 4981, 4984, 4985, 4997, 6547,
-
-     4989, 5000, 4986, 5001, 5002, 5003, 5005, 5007, 5008, 5010,
-     5012, 5014, 5015, 5016, 5020, 5022, 5028, 5036, 5031, 5017,
-     5033, 5037, 5038, 5039, 5040, 5041, 5042, 5048, 5053, 5057,
-     6547, 5045, 6547, 5054, 5050, 5058, 5061, 5062, 5065, 5068,
-     6547, 6547, 5066, 5071, 5073, 5075, 5076, 5078, 5080, 5082,
-     5079, 6547, 5084, 5088, 5096, 5089, 6547, 5093, 5098, 5100,
-     5104, 6547, 5101, 5105, 5106, 5112, 5107, 5116, 5117, 5119,
-     5109, 5121, 5123, 5130, 6547, 6547, 6547, 6547, 5131, 5124,
-     5135, 5127, 5136, 5138, 5139, 5142, 5137, 6547, 5145, 6547,
-     6547, 5150, 5151, 5153, 5154, 5157, 5158, 5160, 5162, 6547,
-
-     5161, 5163, 5166, 5164, 5173, 5175, 5181, 5178, 5182, 5183,
-     5184, 5192, 5188, 5189, 5191, 5194, 5196, 5198, 6547, 6547,
-     5200, 5204, 5205, 5215, 5207, 5211, 5210, 5223, 5218, 5220,
-     5219, 5221, 5226, 5227, 5235, 5237, 5233, 5230, 6547, 5232,
-     5240, 5241, 6547, 5243, 6547, 5246, 5247, 5249, 5250, 5253,
-     5256, 5257, 5259, 6547, 6547, 5254, 5266, 5264, 6547, 6547,
-     5261, 5269, 5271, 5274, 5275, 5276, 5277, 5278, 5284, 5279,
-     6547, 5281, 6547, 5285, 5287, 5300, 5288, 5303, 5307, 5308,
-     5310, 5304, 5306, 6547, 5314, 5315, 6547, 5322, 5317, 5321,
-     5318, 5319, 6547, 5326, 5324, 5330, 5336, 6547, 5338, 5339,
-
-     5340, 6547, 5347, 6547, 5331, 5344, 5341, 5356, 5348, 6547,
-     5352, 5357, 6547, 5362, 5364, 5365, 5354, 6547, 5359, 6547,
-     5366, 5370, 5373, 5376, 5378, 5380, 5371, 5381, 5382, 5389,
-     5388, 5390, 6547, 6547,  135, 5398, 5385, 5391, 5395, 5400,
-     5407, 5402, 5405, 5404, 6547, 6547, 5412, 6547, 5410, 5413,
-     6547, 5414, 5419, 5420, 5423, 5424, 5425, 5426, 5428, 5431,
-     5433, 5434, 5435, 5432, 5436, 5454, 5456, 5438, 5459, 5460,
-     5462, 5464, 5466, 5452, 5469, 5470, 5471, 5472, 5473, 5475,
-     5476, 5478, 5479, 6547, 5482, 5484, 5486, 5487, 6547, 5494,
-     5488, 5501, 5491, 6547, 5503, 5504, 5506, 5507, 6547, 5508,
-
-     5510, 5514, 5511, 5512, 5517, 5519, 5530, 5522, 5523, 5521,
-     6547, 6547, 6547, 5533, 5537, 6547, 5540, 5527, 5542, 5543,
-     6547, 5545, 5546, 5547, 6547, 6547, 5548, 5549, 5550, 5557,
-     6547, 5552, 6547, 5553, 6547, 5560, 5563, 5571, 5566, 6547,
-     5576, 5578, 6547, 5584, 5586, 5588, 5580, 5577, 5590, 5591,
-     6547, 5562, 5593, 5594, 5601, 5592, 5595, 5602, 5603, 5604,
-     5611, 5606, 5613, 6547, 5614, 5615, 5616, 5624, 5617, 5554,
-     5619, 6547, 5626, 6547, 5628, 6547, 5629, 5630, 5633, 5632,
-     5635, 5638, 5639, 5640, 5648, 5644, 5650, 5652, 5655, 5656,
-     6547, 6547, 5659, 5661, 6547, 5662, 6547, 5664, 6547, 5665,
-
-     5666, 5669, 5667, 6547, 5671, 5673, 5677, 5680, 5676, 5679,
-     6547, 5687, 5689, 5690, 5692, 6547, 6547, 5684, 5700, 5696,
-     6547, 5695, 5706, 5708, 5702, 5711, 5712, 5715, 5713, 5720,
-     5697, 5719, 5718, 5726, 5729, 5727, 6547, 6547, 6547, 5734,
-     5721, 5742, 5740, 5744, 5743, 5735, 6547, 5745, 5749, 5751,
-     5752, 5760, 5755, 5758, 6547, 5762, 5759, 5761, 5763, 5765,
-     5766, 5767, 5769, 6547, 5780, 5782, 5770, 5784, 5787, 5789,
-     5791, 5794, 5795, 5796, 5803, 5799, 6547, 5801, 6547, 6547,
-     5802, 6547, 5805, 5806, 5807, 5809, 6547, 5812, 5813, 5814,
-     5816, 5815, 5817, 5819, 5824, 6547, 5831, 5820, 5832, 5836,
-
-     6547, 6547, 5838, 6547, 5843, 5844, 5834, 5852, 5845, 5847,
-     5854, 5856, 6547, 5850, 5858, 5859, 5860, 5862, 6547, 5863,
-     5865, 5866, 5867, 6547, 5873, 5869, 5875, 5874, 5876, 6547,
-     5877, 5879, 5889, 5896, 6547, 5880, 5894, 5890, 6547, 6547,
-     5905, 5907, 5898, 6547, 6547, 6547, 5909, 5910, 5911, 5913,
-     6547, 5917, 5921, 5925, 5929, 5920, 6547, 5928, 5931, 5935,
-     5914, 5936, 6547, 6547, 5937, 5938, 5939, 5942, 6547, 6547,
-     5943, 5945, 5947, 5946, 5948, 6547, 5949, 5953, 5959, 5965,
-     5970, 5956, 5961, 5972, 5979, 5980, 5975, 5976, 5977, 5982,
-     5983, 5985, 5990, 5992, 5993, 5995, 5997, 6001, 6002, 6547,
-
-     6547, 6006, 6547, 6009, 6003, 6547, 6547, 6011, 6014, 6018,
-     6020, 6022, 6024, 6026, 6028, 6015, 6547, 6029, 6031, 6033,
-     6032, 6034, 6547, 6036, 6040, 6035, 6043, 6037, 6045, 6047,
-     6052, 6547, 6547, 6048, 6057, 6053, 6058, 6063, 6547, 6061,
-     6071, 6068, 6067, 6069, 6073, 6070, 6547, 6074, 6075, 6547,
-     6547, 6083, 6077, 6547, 6547, 6076, 6547, 6547, 6547, 6547,
-     6547, 6547, 6547, 6547, 6085, 6093, 6547, 6094, 6098, 6100,
-     6104, 6547, 6078, 6105, 6106, 6089, 6108, 6547, 6095, 6112,
-     6111, 5292, 6113, 6119, 6117, 6115, 6121, 6124, 6125, 6126,
-     6127, 6131, 6132, 6133, 6142, 6145, 6129, 6146, 6547, 6547,
-
-     6547, 6138, 6135, 6157, 6153, 6159, 6160, 6164, 6166, 6148,
-     6168, 6169, 6170, 6171, 6173, 6174, 6183, 6178, 6179, 6180,
-     6182, 6184, 6187, 6547, 6194, 6190, 6195, 6197, 6547, 6200,
-     6547, 6199, 6547, 6547, 6202, 6206, 6203, 6208, 6216, 6218,
-     6209, 6213, 6219, 6220, 6222, 6547, 6229, 6547, 6547, 6224,
-     6230, 6547, 6232, 6231, 6547, 6233, 6234, 6236, 6241, 6243,
-     6240, 6237, 6244, 6248, 6547, 6547, 6251, 6252, 6257, 6261,
-     6258, 6268, 6264, 6267, 6269, 6273, 6266, 6281, 6547, 6280,
-     6277, 6284, 6547, 6286, 6287, 6288, 6289, 6291, 6298, 6293,
-     6294, 6547, 6296, 6547, 6300, 6302, 6304, 6301, 6303, 6305,
-
-     6315, 6319, 6313, 6547, 6317, 6327, 6321, 6329, 6331, 6333,
-     6334, 6323, 6336, 6339, 6345, 6349, 6346, 6350, 6337, 6354,
-     6351, 6547, 6361, 6352, 6547, 6358, 6362, 6355, 6364, 6365,
-     6547, 6369, 6372, 6373, 6375, 6378, 6379, 6547, 6381, 6385,
-     6382, 6547, 6388, 6547, 6547, 6390, 6387, 6394, 6397, 6399,
-     6547, 6547, 6547, 6427, 6434, 6441, 6448, 6455, 6462, 6469,
-       88, 6476, 6483, 6490, 6497, 6504, 6511, 6518, 6525, 6532,
-     6539
+        0,    0,   40,    0,   80,    0,  120,  160,  200,    0,
+      240,  280,  320,  360,  400,    0,  127,  440,  441, 4355,
+     4355, 4355,  480,  519,  510,  507,  515,  520,  516,  532,
+      535,  534,  138,  223,  214,  545,  538,  209,  560,  254,
+      561,  548,  569,  570,  581,  251,  255,  604, 4355, 4355,
+     4355,  641,  648, 4355, 4355, 4355,  685,  692,  325, 4355,
+     4355, 4355,  731,  740, 4355, 4355, 4355,  777,  784, 4355,
+      824, 4355,  863,  339,  870,  440, 4355, 4355, 4355,  909,
+      918, 4355, 4355, 4355,  955,    0,  959,  523,  969,    0,
+     1008,  427,  427,  432,  457,  502,  506,  534,  523,  577,
+
+      531,  542,  538,  846,  576,  549,  554, 1003,  569,  619,
+      614,  991,  619,  620,  672,  657,  675,  667, 1003, 1006,
+      663,  943, 1008,  701,  669,  722,  722,  722,  717,  762,
+      761,  759,  753,  770,  757,  808,  795,  850,  794,  814,
+      797, 1000,  846,  872,  882, 1014,  890,  910,  895, 1017,
+      944,  892,  934,  933,  941, 1003,  948, 1007, 1008, 1003,
+     1019, 1018, 1015,    0, 1043,    0, 1046,    0, 1054, 1042,
+        0, 1050,    0, 1065, 1072, 1111, 1034,    0, 1115, 1060,
+        0, 1061, 1044, 1113, 1039, 1045, 1039, 1101, 1052, 1075,
+     1102, 1093, 1098, 1109, 1097, 1109, 1125, 1095, 1116, 1122,
+
+     1130, 1127, 1123, 1127, 1117, 1112, 1128, 1129, 1123, 1116,
+     1144, 1135, 1135, 1125, 1128, 1130, 1134, 1130, 1145, 1146,
+     1151, 1148, 1134, 1140, 1164, 1158, 1166, 1167, 1142, 1169,
+     1170, 1149, 1145, 1174, 1165, 1179, 1170, 1181, 1169, 1183,
+     1165, 1174, 1161, 1176, 1170, 1176, 1172, 1181, 1178, 1173,
+     1173, 1170, 1197, 1188, 1176, 1191, 1175, 1204, 1181, 1207,
+     1182, 1198, 1202, 1186, 1199, 1213, 1214, 1190, 1216, 1199,
+     1198, 1212, 1215, 1221, 1222, 1215, 1195, 1199, 1215, 1209,
+     1203, 1215, 1204, 1220, 1203, 1222, 1234, 1235, 1225, 1237,
+     1227, 1239, 1220, 1222, 1219, 1224, 1232, 1216, 1248, 1240,
+
+     1242, 1244, 1249, 1229, 1247, 1248, 1234, 1236, 1249, 1249,
+     1245, 1246, 1262, 1243, 1264, 1257, 1266, 1257, 1261, 1258,
+     1270, 1271, 1246, 1249, 1247, 1256, 1269, 1268, 1254, 1269,
+     1255, 1257, 1275, 1259, 1276, 1268, 1287, 1279, 1271, 1275,
+     1276, 1268, 1283, 1286, 1294, 1285, 1305, 1288, 1299, 1309,
+     1301, 1306, 1289, 1295, 1294, 1304, 1305, 1316, 1311, 1316,
+     1317, 1304, 1315, 1309, 1303, 1303, 1309, 1331, 1325, 4355,
+     1307, 1324, 1336, 1326, 1327, 1330, 1320, 1333, 1330, 1339,
+     1347, 1343, 1338, 1342, 1343, 1327, 1347, 1333, 1338, 1342,
+     4355, 1358, 1343, 1367, 1343, 1351, 1377, 1360, 1366, 1352,
+
+     1355, 1360, 1369, 1361, 1390, 1367, 1361, 1368, 1375, 1374,
+     1397, 1387, 1373, 1374, 1380, 1391, 1382, 1404, 1398, 1380,
+     1390, 1389, 1410, 1380, 1390, 1402, 1411, 1391, 1396, 1397,
+     1400, 1413, 1414, 1414, 1416, 1418, 1402, 1407, 1407, 1406,
+     1411, 1417, 1427, 1433, 1419, 1424, 1426, 1422, 1439, 1415,
+     1432, 1438, 1440, 1441, 1427, 1447, 1436, 1451, 1446, 1439,
+     1452, 1460, 1451, 1441, 1436, 1453, 1454, 1459, 1449, 1442,
+     1445, 1452, 1462, 1462, 1455, 1468, 1464, 1466, 1451, 1472,
+     1452, 4355, 1474, 4355, 1455, 1469, 1469, 1458, 1475, 1461,
+     1470, 4355, 1466, 1467, 1467, 1474, 1495, 1481, 1497, 1487,
+
+     1479, 1486, 1492, 1482, 1483, 1505, 1480, 1498, 1508, 1489,
+     1499, 1483, 1485, 1503, 1503, 1494, 1505, 1495, 1493, 1500,
+     1513, 4355, 1495, 1501, 1513, 1499, 1504, 1518, 1519, 1508,
+     1520, 1515, 1521, 1541, 1521, 1521, 1535, 1517, 1521, 1541,
+     1528, 1519, 1544, 1532, 1536, 1534, 1531, 1529, 1547, 1544,
+     1535, 1540, 1550, 4355, 1563, 1549, 1555, 1566, 1549, 1547,
+     1544, 1550, 1571, 1551, 1549, 1564, 1554, 1557, 1569, 1548,
+     1565, 1575, 1581, 1564, 1583, 1566, 1576, 1566, 1566, 1577,
+     1580, 1575, 1569, 1593, 1573, 1589, 1590, 1596, 1594, 1596,
+     1602, 1603, 1577, 1587, 1597, 1596, 1584, 1596, 1602, 1601,
+
+     1584, 1589, 1605, 1616, 1607, 1594, 1608, 1600, 1614, 1601,
+     1596, 1613, 1603, 1600, 1627, 1617, 1609, 1621, 1607, 1625,
+     1609, 1612, 1625, 1626, 1620, 1620, 4355, 1642, 1628, 1635,
+     1635, 1635, 1638, 1637, 1627, 1626, 1638, 1633, 1642, 1628,
+     1650, 1641, 1632, 1636, 1644, 1642, 1646, 1647, 1663, 1652,
+     1656, 1665, 1657, 1659, 1647, 1652, 1662, 1649, 1675, 1665,
+     1677, 1669, 1648, 1669, 1681, 1663, 1664, 1673, 1685, 1662,
+     1673, 1678, 1664, 1684, 1679, 1684, 1694, 1677, 1685, 1697,
+     1693, 1670, 1695, 1679, 1697, 1683, 1685, 1686, 1686, 1686,
+     1713, 1704, 1700, 1695, 1696, 1694, 1694, 1702, 1700, 1722,
+
+     1703, 1706, 1700, 1701, 1717, 1704, 1707, 1706, 1707, 1708,
+     1723, 1715, 1729, 1727, 1718, 1714, 1723, 1721, 1731, 1721,
+     1744, 1720, 1727, 1734, 1737, 1736, 1739, 1740, 1728, 1740,
+     1739, 1735, 1741, 1749, 1740, 1748, 1751, 1751, 1742, 1748,
+     1743, 1756, 1746, 1740, 1763, 1751, 1763, 1766, 1761, 1758,
+     4355, 1749, 1775, 1750, 1767, 1761, 1749, 1757, 1782, 1769,
+     1771, 1761, 1755, 1761, 1780, 4355, 1768, 4355, 4355, 1767,
+     4355, 4355, 1778, 1782, 4355, 1784, 1782, 1777, 1790, 1794,
+     1795, 1786, 1780, 1787, 1783, 1810, 1804, 1802, 1788, 1792,
+     1808, 1789, 1810, 1810, 1798, 1803, 1794, 1817, 1827, 1817,
+
+     1824, 1812, 1823, 1828, 1826, 1829, 1828, 1835, 1833, 1824,
+     1818, 1834, 1819, 1821, 1833, 1841, 1828, 1830, 1844, 1828,
+     1835, 1826, 1855, 1845, 1852, 1858, 4355, 1848, 1860, 1861,
+     1851, 1864, 1847, 1834, 1858, 1856, 1855, 1865, 1866, 1858,
+     1849, 1863, 1862, 1852, 1855, 1853, 1874, 1865, 1867, 1877,
+     1883, 1859, 4355, 1870, 1871, 1857, 1877, 1874, 1881, 1880,
+     1872, 1862, 1879, 1876, 1896, 1890, 1877, 1874, 1885, 1872,
+     1879, 1895, 4355, 1897, 1901, 1880, 1897, 1882, 1884, 1885,
+     1885, 1888, 1900, 1887, 1907, 1894, 1894, 1920, 1906, 1904,
+     1898, 1904, 1913, 1906, 1916, 1923, 1903, 1915, 1905, 1918,
+
+     1907, 1906, 1910, 1910, 1937, 1938, 1919, 1940, 1921, 1916,
+     1943, 1944, 1935, 1921, 1920, 1930, 1938, 1923, 1944, 1952,
+     1944, 1930, 1936, 1957, 1932, 1954, 1936, 1950, 1951, 1963,
+     1943, 1955, 1959, 1939, 1943, 1963, 1960, 1947, 4355, 1955,
+     1944, 1955, 4355, 1957, 1951, 1951, 1970, 1973, 1972, 1962,
+     1979, 1955, 1978, 1968, 1970, 1980, 1973, 1994, 1980, 1976,
+     1983, 1990, 1980, 1995, 1985, 1993, 1985, 1980, 1988, 1994,
+     1998, 2000, 2013, 2014, 2010, 2016, 2018, 1991, 1995, 1997,
+     2015, 2005, 2013, 2005, 2008, 2021, 2019, 2017, 2012, 2008,
+     2009, 2014, 2037, 2027, 2021, 2018, 2021, 2020, 2040, 2036,
+
+     2022, 4355, 2049, 2041, 2026, 2041, 2034, 2054, 2044, 2031,
+     4355, 2042, 2043, 2037, 2060, 2046, 2037, 2052, 2038, 2045,
+     2040, 2049, 2053, 2054, 2058, 2048, 2072, 4355, 2051, 4355,
+     2054, 2049, 2051, 2057, 2054, 2068, 2069, 2060, 2071, 2072,
+     4355, 4355, 2073, 2070, 2079, 2087, 2073, 2068, 2071, 4355,
+     2069, 2092, 4355, 2086, 2085, 2075, 2072, 2077, 2076, 2082,
+     2081, 2103, 2078, 2105, 2085, 2096, 2088, 4355, 2100, 2083,
+     2100, 2101, 2091, 2099, 2104, 2105, 2099, 4355, 2106, 2097,
+     2108, 2121, 2117, 2108, 2100, 2116, 2119, 2103, 2103, 2103,
+     2121, 2112, 2132, 2133, 2123, 2124, 2125, 2137, 4355, 2114,
+
+     2113, 2140, 2130, 2137, 2128, 2129, 2121, 2129, 2138, 2139,
+     2132, 2139, 2127, 2134, 2128, 2155, 2156, 2133, 2137, 2148,
+     2155, 2136, 2142, 2145, 2162, 2141, 2151, 2142, 2137, 4355,
+     2144, 2156, 2166, 2146,    0, 2153, 2153, 2157, 2165, 2162,
+     2169, 2174, 2154, 2176, 2182, 2183, 2162, 2174, 2178, 2176,
+     2168, 2169, 2179, 2170, 2167, 2180, 2173, 2170, 4355, 2191,
+     2177, 2174, 2178, 2188, 2175, 2191, 4355, 2193, 2197, 2187,
+     2195, 2202, 2195, 2190, 2190, 2203, 2189, 2191, 2202, 2207,
+     2194, 2202, 2210, 2202, 2206, 2199, 4355, 2220, 2215, 2216,
+     2202, 2218, 2220, 2216, 2211, 2212, 2209, 2217, 2215, 2224,
+
+     2220, 2214, 2213, 2217, 2230, 2222, 2218, 2219, 2231, 2226,
+     2223, 2231, 2225, 2220, 2231, 2227, 4355, 2254, 2234, 2236,
+     2243, 2232, 2237, 2249, 2243, 2262, 2238, 2244, 2246, 2259,
+     2261, 2250, 2255, 2271, 2266, 2263, 2262, 2278, 2268, 2270,
+     2275, 2256, 2277, 2276, 2262, 2265, 2276, 2266, 2282, 2289,
+     2290, 2276, 2273, 2298, 2299, 2289, 2291, 2287, 2292, 2284,
+     2298, 2311, 2289, 4355, 2298, 2289, 2288, 2301, 2317, 2303,
+     2291, 2309, 2301, 2308, 2299, 2300, 2306, 2327, 2321, 2315,
+     2310, 2320, 2312, 2318, 2321, 2311, 2305, 2326, 2333, 2318,
+     2335, 2333, 4355, 2333, 2332, 2319, 2330, 2341, 2321, 2343,
+
+     2342, 2339, 2324, 2325, 2348, 2328, 2346, 2330, 2346, 2343,
+     2351, 2336, 4355, 2352, 2341, 2352, 2338, 2345, 2355, 2353,
+     2357, 2360, 2359, 2364, 2361, 2349, 2362, 2360, 2363, 2358,
+     4355, 2378, 2379, 2369, 2381, 2367, 2358, 2367, 2380, 2360,
+     2372, 4355, 2367, 2363, 2361, 2391, 2392, 2381, 2380, 4355,
+     2395, 4355, 2376, 2371, 2372, 2381, 2380, 2377, 2396, 2378,
+     2374, 2382, 2396, 2403, 2380, 2399, 4355, 2386, 2412, 2389,
+     2399, 2401, 2396, 2397, 2398, 2409, 2406, 2416, 2399, 2406,
+     4355, 2427, 2406, 2419, 2413, 2431, 2407, 2401, 2410, 2424,
+     2426, 2414, 2413, 2429, 2415, 4355, 2422, 2419, 2420, 2438,
+
+     2436, 2423, 2423, 2449, 2432, 2426, 2432, 2432, 2433, 2430,
+     2445, 2444, 2447, 2435, 2445, 2454, 2441, 2448, 2438, 2458,
+     2466, 2467, 2448, 2464, 2458, 2449, 2445, 2462, 2474, 2475,
+     2476, 2470, 2471, 4355, 2474, 2470, 2466, 2458, 2465, 2464,
+     2464, 2473, 2480, 2462, 2475, 2479, 2471, 2467, 2493, 2494,
+     2469, 2489, 2472, 2475, 2486, 2491, 2478, 2478, 2481, 2506,
+     2496, 2476, 2509, 2485, 4355, 4355, 2499, 2512, 2488, 2489,
+     2490, 2491, 2497, 2491, 2498, 2513, 2512, 2497, 2498, 2506,
+     2520, 2521, 2516, 2518, 2510, 2515, 2512, 2524, 4355, 2509,
+     2523, 2514, 2511, 2516, 2534, 2529, 2541, 2521, 2524, 2533,
+
+     2535, 2536, 2521, 2524, 2535, 2525, 2552, 2548, 4355, 2530,
+     4355, 2528, 2545, 2550, 2558, 2533, 4355, 2555, 4355, 2552,
+     2557, 2541, 2542, 4355, 2556, 2540, 2552, 2561, 2548, 2543,
+     2546, 2561, 2553, 2567, 2557, 2561, 2553, 2557, 2548, 2554,
+     2574, 2562, 2559, 2573, 2564, 2566, 2582, 2578, 2563, 2583,
+     2563, 2575, 2583, 2569, 2584, 4355, 2591, 2577, 2576, 2575,
+     2580, 2576, 2583, 2573, 2594, 2599, 2596, 2582, 2583, 2605,
+     2596, 2601, 2587, 2606, 2604, 2616, 2591, 2618, 4355, 2599,
+     2615, 2596, 2610, 4355, 2612, 2594, 2618, 2619, 2607, 2604,
+     2608, 2621, 2624, 2608, 2615, 2623, 2609, 2627, 2619, 2638,
+
+     2629, 2632, 4355, 2627, 2632, 2613, 2636, 2641, 2647, 2648,
+     2638, 2643, 2645, 2653, 2643, 2636, 2632, 2633, 2633, 2651,
+     2661, 2662, 2652, 2664, 2636, 2655, 2662, 2657, 2645, 2644,
+     2645, 2652, 2653, 2654, 2651, 2645, 2667, 2670, 2654, 4355,
+     2662, 2663, 2663, 2683, 2658, 2663, 2660, 2667, 2661, 4355,
+     2684, 2664, 2680, 2674, 2686, 2673, 2675, 2666, 2673, 2683,
+     2678, 2687, 2686, 2680, 4355, 2691, 4355, 2674, 2697, 2702,
+     2703, 2691, 2686, 2702, 2708, 2695, 2690, 2705, 2707, 2694,
+     2698, 2706, 2697, 2708, 2709, 2725, 2722, 2702, 2710, 2706,
+     2711, 2710, 2733, 2723, 2717, 4355, 4355, 2705, 2713, 2732,
+
+     2718, 2726, 2731, 2736, 2729, 2734, 2722, 2721, 2725, 2750,
+     4355, 2731, 2731, 2725, 2743, 2756, 2734, 2754, 2760, 2750,
+     2742, 2763, 2752, 4355, 2739, 2746, 2767, 2749, 2760, 2770,
+     4355, 2757, 4355, 2747, 2748, 2760, 2761, 2758, 2759, 2759,
+     2760, 2776, 2782, 2783, 2765, 2760, 2781, 2761, 2764, 2764,
+     2785, 2772, 2792, 2765, 2772, 2771, 2783, 4355, 2792, 2772,
+     2789, 2789, 2790, 2791, 2789, 2776, 4355, 2796, 2789, 2787,
+     2804, 2785, 2793, 2787, 2808, 2814, 2795, 2803, 2799, 2800,
+     4355, 2794, 2794, 2821, 2804, 2799, 2812, 2820, 2817, 2822,
+     4355, 2817, 2814, 2830, 2826, 2814, 2825, 2825, 2809, 2808,
+
+     2813, 2814, 2828, 2829, 2817, 2827, 2825, 2823, 2834, 2835,
+     2832, 2822, 2838, 2839, 2830, 2847, 2853, 2827, 4355, 2830,
+     2832, 2836, 2833, 2853, 2842, 2856, 2860, 2861, 2841, 2863,
+     2862, 2843, 2844, 2867, 2863, 2874, 2866, 4355, 2876, 2853,
+     2878, 2848, 2871, 2876, 2856, 2872, 2879, 2864, 2859, 2876,
+     2881, 2878, 2890, 2873, 2868, 2871, 2870, 2897, 2873, 4355,
+     2900, 2881, 2881, 2895, 2887, 2885, 2907, 2893, 2883, 2883,
+     2906, 2880, 2906, 2888, 2900, 2888, 2910, 2913, 2893, 4355,
+     4355, 2915, 2890, 2907, 4355, 2908, 2897, 2925, 2921, 2900,
+     2907, 2916, 2915, 2899, 2925, 2901, 2912, 4355, 2924, 2936,
+
+     2911, 2925, 2939, 2932, 4355, 2916, 2942, 2938, 2933, 2930,
+     2920, 2922, 2930, 2940, 2926, 2919, 2945, 2953, 2954, 2929,
+     2935, 2947, 4355, 2932, 2931, 2949, 2956, 2937, 2942, 4355,
+     2939, 2955, 2959, 2955, 2953, 2964, 2960, 2954, 2967, 2947,
+     2955, 2952, 2967, 2953, 2954, 2981, 2961, 2972, 2979, 2978,
+     2976, 4355, 2972, 2971, 2980, 2985, 2986, 4355, 2987, 2994,
+     2995, 4355, 2996, 2965, 2987, 2982, 3001, 2997, 4355, 2985,
+     2994, 2987, 2976, 3008, 2981, 3010, 3011, 3001, 2995, 4355,
+     2996, 2990, 3005, 4355, 2992, 3009, 3012, 3015, 3016, 2996,
+     3023, 3012, 3014, 3014, 3012, 4355, 3017, 4355, 3020, 3012,
+
+     3024, 4355, 3014, 3015, 3023, 3030, 3021, 3026, 3027, 3030,
+     3035, 3041, 3016, 3028, 3020, 3020, 3046, 3037, 3037, 3049,
+     3026, 3036, 3028, 3033, 4355, 3047, 3031, 3041, 3031, 3051,
+     3044, 3042, 3034, 3051, 3044, 4355, 4355, 3059, 4355, 3057,
+     3045, 3046, 4355, 3048, 3050, 3071, 3049, 3066, 3066, 3070,
+     3062, 4355, 3072, 3071, 4355, 3050, 3068, 3081, 3069, 3055,
+     3058, 3078, 3071, 3060, 3070, 3071, 3069, 3073, 3060, 3072,
+     3082, 4355, 3069, 3067, 3079, 3093, 3075, 3074, 3092, 3091,
+     3077, 4355, 3093, 3097, 3082, 3090, 3098, 3097, 4355, 3096,
+     4355, 3088, 3098, 3096, 3107, 3091, 4355, 3109, 3098, 3114,
+
+     3088, 3110, 3114, 3112, 3113, 3101, 3100, 3127, 3117, 3110,
+     3112, 3131, 3118, 4355, 3108, 3114, 3130, 3130, 3117, 3113,
+     3140, 3130, 3134, 3119, 3130, 3140, 3128, 3140, 3141, 3134,
+     3139, 3127, 4355, 3138, 3146, 3128, 3157, 3140, 3144, 3142,
+     4355, 3143, 3152, 3153, 4355, 3146, 3140, 3152, 3163, 3145,
+     3146, 3149, 3152, 3152, 4355, 3156, 3157, 3150, 3166, 3167,
+     3172, 3165, 4355, 4355, 4355, 3169, 4355, 3170, 3154, 3163,
+     3161, 3155, 3172, 4355, 3183, 3174, 3185, 3167, 3183, 3184,
+     3177, 3182, 3170, 3199, 3200, 3201, 3193, 3188, 3191, 3180,
+     4355, 4355, 3203, 3202, 3195, 3206, 3205, 3195, 3190, 3215,
+
+     3205, 3210, 3213, 3208, 3220, 4355, 3211, 3196, 3214, 3199,
+     4355, 3208, 3196, 3217, 3200, 3209, 3209, 3224, 3212, 3215,
+     3212, 3228, 3212, 3236, 3232, 3222, 3233, 3213, 3222, 3229,
+     3223, 3238, 3231, 3227, 3247, 4355, 3239, 3229, 3230, 3227,
+     3227, 3233, 3232, 3242, 3234, 4355, 3241, 4355, 3244, 3244,
+     3253, 3258, 3262, 3257, 3260, 3251, 3251, 3253, 3266, 3269,
+     3267, 3271, 3256, 3259, 3272, 3265, 3276, 3277, 3273, 4355,
+     3274, 3260, 3261, 3270, 3284, 3285, 3266, 3287, 3282, 3270,
+     3290, 3275, 3286, 3293, 3294, 3280, 3286, 3282, 3278, 4355,
+     3293, 3300, 3281, 3302, 3284, 3297, 3301, 3304, 3307, 3288,
+
+     3293, 3307, 4355, 3295, 3292, 3313, 4355, 3293, 3291, 3300,
+     3312, 3318, 3299, 3314, 3306, 3307, 4355, 3324, 3304, 3318,
+     3312, 3309, 3310, 3303, 3329, 3322, 3330, 3330, 4355, 3340,
+     3323, 3331, 3332, 3313, 3326, 3319, 3336, 3316, 4355, 3338,
+     3339, 3330, 3352, 3326, 3355, 3346, 3347, 3328, 3341, 3352,
+     3353, 3348, 3340, 3350, 3351, 3352, 3348, 3369, 3370, 3361,
+     4355, 3346, 4355, 3358, 3367, 3375, 3369, 3357, 3363, 3368,
+     3354, 4355, 3359, 3361, 3380, 3354, 3366, 3373, 4355, 3371,
+     3368, 3370, 3374, 4355, 3384, 3383, 3369, 3378, 3392, 3391,
+     4355, 3394, 3391, 3390, 3402, 3403, 3389, 3384, 3380, 3398,
+
+     3403, 3390, 3404, 3394, 3406, 3394, 3390, 3409, 3417, 3398,
+     3408, 4355, 3410, 3412, 3417, 3412, 3409, 3410, 3400, 3417,
+     3423, 3410, 4355, 3419, 3405, 3406, 3413, 3424, 3409, 3425,
+     3437, 3426, 3415, 3415, 3416, 3431, 3416, 4355, 3426, 3423,
+     3435, 3447, 3434, 3441, 4355, 3435, 4355, 3431, 3445, 3444,
+     3422, 3448, 4355, 4355, 3446, 3457, 3440, 3454, 3445, 4355,
+     4355, 3456, 4355, 3457, 3439, 4355, 3444, 3443, 4355, 4355,
+     3455, 3435, 3457, 3458, 3465, 4355, 3466, 4355, 3472, 3466,
+     3452, 3447, 3465, 4355, 3452, 3469, 3461, 3462, 3476, 4355,
+     3467, 3483, 3460, 3464, 4355, 3481, 3478, 3463, 3465, 4355,
+
+     3483, 3486, 3481, 3469, 3479, 3484, 3488, 3477, 3478, 3481,
+     3489, 3475, 3476, 3492, 3499, 3500, 3501, 3502, 3490, 3485,
+     3499, 3504, 3505, 3495, 3496, 3489, 3494, 3512, 3493, 3514,
+     3515, 3507, 3505, 3505, 3509, 3512, 3508, 3501, 3517, 3503,
+     3504, 3526, 3517, 3501, 3508, 3516, 3506, 3517, 3512, 3507,
+     3522, 3534, 3527, 3522, 3523, 4355, 3534, 3522, 3519, 3519,
+     3540, 3530, 3540, 3541, 3548, 3549, 3548, 4355, 3549, 4355,
+     3550, 3534, 3542, 3535, 3540, 3553, 3532, 3543, 3540, 4355,
+     3540, 3543, 3540, 3543, 3544, 3556, 3546, 3565, 3548, 3551,
+     3552, 3570, 4355, 3573, 3559, 3552, 3566, 3577, 4355, 3568,
+
+     3579, 3561, 3562, 3574, 3567, 3565, 3566, 3569, 3567, 3588,
+     3589, 3569, 3572, 3585, 3593, 3594, 3600, 3577, 3581, 3578,
+     3584, 3594, 3580, 3581, 3597, 3601, 3605, 3603, 3607, 4355,
+     3588, 4355, 4355, 3599, 3590, 3598, 3591, 3607, 3593, 3595,
+     4355, 4355, 3595, 3613, 3618, 3603, 3601, 3621, 3610, 3607,
+     3619, 4355, 3609, 3621, 3627, 3614, 4355, 3613, 3609, 3610,
+     3632, 4355, 3620, 3624, 3630, 3636, 3617, 3638, 3633, 3630,
+     3624, 3629, 3622, 3644, 4355, 4355, 4355, 4355, 3643, 3623,
+     3647, 3634, 3635, 3640, 3641, 3652, 3637, 4355, 3654, 4355,
+     4355, 3649, 3650, 3651, 3644, 3644, 3654, 3652, 3642, 3653,
+
+     3655, 4355, 3649, 3660, 3661, 3652, 3669, 3670, 3665, 3666,
+     3673, 3666, 3669, 3657, 3658, 3678, 3684, 3674, 3679, 3666,
+     3677, 3684, 3685, 4355, 4355, 3672, 3687, 3684, 3694, 3684,
+     3685, 3677, 3691, 3678, 3691, 3680, 3703, 3694, 3694, 3695,
+     3692, 3687, 3695, 3683, 3711, 3712, 3702, 3696, 4355, 3702,
+     3705, 3708, 4355, 3700, 4355, 3708, 3709, 3697, 3703, 3708,
+     3709, 3718, 3711, 4355, 4355, 3703, 3728, 3717, 4355, 4355,
+     3705, 3705, 3707, 3728, 3721, 3710, 3721, 3716, 3733, 3714,
+     4355, 3719, 4355, 3715, 3732, 3738, 3713, 3745, 3746, 3747,
+     3743, 3735, 3739, 4355, 3736, 3733, 4355, 3753, 3745, 3745,
+
+     3736, 3736, 4355, 3751, 3735, 3755, 3756, 4355, 3757, 3753,
+     3753, 4355, 3760, 4355, 3740, 3756, 3750, 3769, 3752, 4355,
+     3745, 3765, 4355, 3768, 3770, 3767, 3758, 4355, 3754, 4355,
+     3779, 3754, 3776, 3771, 3776, 3779, 3764, 3781, 3768, 3764,
+     3769, 3790, 3786, 3782, 4355, 4355, 3769, 3789,    0, 3795,
+     3767, 3771, 3772, 4355, 3787, 3801, 3771, 3793, 3799, 4355,
+     4355, 3794, 4355, 3792, 3798, 4355, 3777, 3800, 3803, 3793,
+     3801, 3802, 3793, 3792, 3806, 3794, 3814, 3794, 3801, 3817,
+     3803, 3815, 3805, 3801, 3813, 3828, 3829, 3805, 3826, 3828,
+     3829, 3830, 3831, 3817, 3829, 3815, 3810, 3832, 3819, 3834,
+
+     3831, 3821, 3822, 4355, 3844, 3845, 3842, 3828, 4355, 3848,
+     3841, 3850, 3845, 4355, 3852, 3843, 3844, 3845, 4355, 3837,
+     3857, 3853, 3849, 3840, 3849, 3846, 3868, 3850, 3855, 3861,
+     4355, 4355, 4355, 3861, 3869, 4355, 3870, 3856, 3846, 3854,
+     4355, 3874, 3865, 3863, 4355, 4355, 3851, 3868, 3858, 3860,
+     3886, 4355, 3887, 3870, 4355, 3862, 4355, 3879, 3880, 3885,
+     3878, 4355, 3883, 3867, 4355, 3889, 4355, 3892, 3893, 3895,
+     3886, 3876, 3878, 3893, 4355, 3905, 3895, 3896, 3903, 3885,
+     3892, 3911, 3907, 3908, 3894, 3888, 3905, 3893, 3918, 4355,
+     3888, 3915, 4355, 3911, 3911, 3912, 3917, 3900, 3905, 3906,
+
+     4355, 3902, 4355, 3924, 4355, 3911, 3912, 3922, 3918, 3912,
+     3910, 3922, 3926, 3931, 3924, 3916, 3909, 3937, 3918, 4355,
+     4355, 3939, 3940, 4355, 3919, 4355, 3942, 4355, 3926, 3927,
+     3928, 3940, 4355, 3947, 3927, 3939, 3955, 3927, 3932, 4355,
+     3951, 3939, 3935, 3956, 4355, 4355, 3936, 3963, 3953, 4355,
+     3937, 3961, 3962, 3942, 3964, 3955, 3954, 3951, 3958, 3948,
+     3975, 3951, 3959, 3952, 3974, 3973, 3972, 3975, 4355, 4355,
+     4355, 3965, 3958, 3985, 3981, 3978, 3988, 3966, 4355, 3980,
+     3987, 3961, 4355, 4355, 3969, 3984, 3971, 3997, 3975, 3995,
+     4355, 3983, 3978, 3972, 3985, 4000, 3981, 3985, 3993, 4355,
+
+     4004, 4005, 4000, 3992, 4002, 4009, 4010, 4011, 3998, 3986,
+     4019, 4009, 4355, 4016, 4355, 4355, 3997, 4355, 3995, 3996,
+     3997, 4019, 4355, 4022, 3996, 4004, 4010, 4005, 4017, 4028,
+     4029, 4355, 4035, 4010, 4012, 4027, 4355, 4355, 4034, 4355,
+     4035, 4009, 4031, 4023, 4024, 4045, 4028, 4033, 4043, 4038,
+     4355, 4032, 4025, 4026, 4042, 4036, 4043, 4355, 4042, 4032,
+     4032, 4033, 4355, 4039, 4050, 4038, 4041, 4041, 4039, 4056,
+     4355, 4057, 4043, 4070, 4060, 4355, 4046, 4064, 4055, 4355,
+     4355, 4070, 4071, 4067, 4355, 4355, 4355, 4073, 4068, 4055,
+     4076, 4355, 4077, 4080, 4082, 4084, 4079, 4355, 4079, 4076,
+
+     4087, 4069, 4074, 4355, 4355, 4069, 4070, 4086, 4093, 4355,
+     4355, 4088, 4069, 4101, 4089, 4093, 4089, 4084, 4355, 4082,
+     4102, 4093, 4102, 4105, 4106, 4091, 4102, 4099, 4115, 4116,
+     4098, 4119, 4090, 4101, 4096, 4113, 4114, 4101, 4122, 4128,
+     4117, 4125, 4126, 4111, 4122, 4355, 4355, 4129, 4355, 4130,
+     4121, 4355, 4355, 4132, 4133, 4134, 4135, 4136, 4137, 4138,
+     4139, 4113, 4355, 4131, 4142, 4133, 4131, 4124, 4355, 4146,
+     4127, 4128, 4149, 4134, 4137, 4139, 4151, 4355, 4138, 4155,
+     4355, 4355, 4137, 4153, 4131, 4157, 4141, 4355, 4157, 4156,
+     4142, 4169, 4150, 4160, 4147, 4149, 4152, 4355, 4163, 4161,
+
+     4355, 4355, 4167, 4157, 4355, 4355, 4147, 4355, 4355, 4355,
+     4355, 4355, 4355, 4355, 4355, 4169, 4172, 4355, 4163, 4178,
+     4179, 4355, 4180, 4160, 4355, 4158, 4173, 4179, 4164, 4171,
+     4355, 4163, 4176, 4183, 4187, 4175, 4190, 4193, 4184, 4181,
+     4176, 4178, 4181, 4173, 4184, 4191, 4189, 4197, 4182, 4199,
+     4206, 4186, 4202, 4355, 4355, 4355, 4207, 4195, 4190, 4212,
+     4203, 4214, 4213, 4216, 4217, 4198, 4198, 4216, 4355, 4207,
+     4216, 4217, 4198, 4209, 4231, 4212, 4215, 4223, 4230, 4210,
+     4232, 4355, 4233, 4218, 4216, 4216, 4237, 4355, 4222, 4355,
+     4220, 4355, 4355, 4240, 4239, 4233, 4237, 4224, 4250, 4251,
+
+     4232, 4234, 4229, 4244, 4251, 4355, 4252, 4355, 4355, 4231,
+     4233, 4234, 4355, 4241, 4252, 4355, 4237, 4253, 4260, 4241,
+     4248, 4249, 4244, 4259, 4260, 4267, 4355, 4355, 4247, 4269,
+     4251, 4251, 4272, 4267, 4279, 4355, 4273, 4270, 4271, 4272,
+     4259, 4285, 4355, 4281, 4355, 4276, 4283, 4355, 4279, 4265,
+     4278, 4267, 4268, 4294, 4270, 4277, 4355, 4290, 4355, 4293,
+     4284, 4289, 4276, 4278, 4285, 4298, 4295, 4288, 4355, 4276,
+     4302, 4285, 4304, 4305, 4302, 4301, 4290, 4311, 4306, 4310,
+     4314, 4307, 4308, 4297, 4312, 4299, 4355, 4320, 4301, 4355,
+     4316, 4317, 4304, 4305, 4324, 4355, 4327, 4308, 4309, 4328,
+
+     4331, 4324, 4355, 4333, 4334, 4327, 4355, 4330, 4355, 4355,
+     4331, 4318, 4319, 4340, 4341, 4355, 4355, 4355
     } ;
 
-static const flex_int16_t yy_def[3372] =
+static const flex_int16_t yy_def[3519] =
     {   0,
-     3353,    1, 3354, 3354, 3355, 3355, 3356, 3356, 3357, 3357,
-     3358, 3358, 3359, 3359, 3360, 3360, 3353, 3361, 3353, 3353,
-     3353, 3353, 3362, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3363, 3353, 3353, 3353,
-     3363, 3364, 3353, 3353, 3353, 3364, 3365, 3353, 3353, 3353,
-     3353, 3365, 3366, 3353, 3353, 3353, 3366, 3367, 3353, 3368,
-     3353, 3367, 3367, 3369, 3353, 3353, 3353, 3353, 3369, 3370,
-     3353, 3353, 3353, 3370, 3361, 3361, 3353, 3371, 3362, 3371,
-     3362, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3363,
-     3363, 3364, 3364, 3365, 3365, 3353, 3366, 3366, 3367, 3367,
-     3368, 3368, 3367, 3369, 3369, 3353, 3370, 3370, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3367, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3367, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3367,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3367, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3353, 3353, 3361, 3353, 3353, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3367, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3353, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3367, 3367, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3367, 3361, 3361,
-
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3353, 3361, 3367, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3367, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3353, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3367, 3361, 3353, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3353, 3361, 3353, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3353, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3367, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3353, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3353, 3361, 3361, 3361, 3361, 3367, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3353,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3353, 3353, 3361, 3361, 3361, 3361,
-     3361, 3353, 3353, 3361, 3353, 3361, 3353, 3361, 3361, 3353,
-     3353, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-
-     3353, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3367, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3353,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3353, 3353, 3353, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3367, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3353, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3353, 3361, 3361, 3361, 3353, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3353, 3361, 3361,
-
-     3361, 3353, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3353, 3361, 3353,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3353, 3353, 3367, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3353, 3361, 3353, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3353, 3361,
-
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3353, 3353, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3353, 3353, 3361, 3361, 3361, 3361,
-     3353, 3361, 3353, 3361, 3353, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3353, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3353, 3361, 3361, 3353, 3361, 3353, 3361, 3353, 3361,
-
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3353, 3353, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3353, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353, 3353,
-     3361, 3353, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-
-     3353, 3353, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3353,
-     3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3353, 3353,
-     3361, 3361, 3361, 3353, 3353, 3353, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3353, 3353, 3361, 3361, 3361, 3361, 3353, 3353,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353,
-
-     3353, 3361, 3353, 3361, 3361, 3353, 3353, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3353, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361, 3353,
-     3353, 3361, 3361, 3353, 3353, 3361, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3361, 3361, 3353, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3353,
-
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3353, 3361,
-     3353, 3361, 3353, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3353, 3361, 3353, 3353, 3361,
-     3361, 3353, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3353, 3353, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361,
-     3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-
-     3361, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361, 3361,
-     3361, 3353, 3361, 3361, 3353, 3361, 3361, 3361, 3361, 3361,
-     3353, 3361, 3361, 3361, 3361, 3361, 3361, 3353, 3361, 3361,
-     3361, 3353, 3361, 3353, 3353, 3361, 3361, 3361, 3361, 3361,
-     3353, 3353,    0, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-     3353
+     3518,    1, 3518,    3, 3518,    5,    1,    1, 3518,    9,
+        1,    1,    1,    1, 3518,   15, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518,   18,   18,   18,   18,   18,   18,   18,
+       18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+       18,   18,   18,   18,   18,   18,   18, 3518, 3518, 3518,
+     3518,   48, 3518, 3518, 3518, 3518,   53, 3518, 3518, 3518,
+     3518, 3518,   58, 3518, 3518, 3518, 3518,   64, 3518, 3518,
+       23, 3518,   69,   69, 3518, 3518, 3518, 3518, 3518,   75,
+     3518, 3518, 3518, 3518,   81,   18,   86, 3518,   23,   23,
+       90,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   48,  164,   53,  166,   58,  168, 3518,
+       64,  171,   69,  173,   89,  175,  173,   75,  178, 3518,
+       81,  181,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,  173,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,  173,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86, 3518,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518,   86,   86,  173,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,  173,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518,   86, 3518, 3518,   86,
+     3518, 3518,   86,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,  173,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518, 3518,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,  173,  173,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,  173,   86,   86,   86,   86,   86,   86, 3518,
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86, 3518, 3518,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+     3518,   86,   86,   86,   86,   86, 3518,   86, 3518,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518,   86,   86,  173,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86, 3518,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518, 3518,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+     3518,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,  173,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+     3518,   86,   86,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+
+       86,   86,   86,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86, 3518,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,  173,   86, 3518,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518,   86, 3518,   86,   86,
+
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518, 3518,   86, 3518,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86,   86, 3518,   86,
+     3518,   86,   86,   86,   86,   86, 3518,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86, 3518, 3518, 3518,   86, 3518,   86,   86,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+       86,   86,  173,   86,   86,   86,   86,   86,   86,   86,
+     3518, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86, 3518,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518,   86, 3518,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86, 3518,   86,   86,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86, 3518,   86,   86,   86,   86,   86,   86,  173,
+       86, 3518,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+       86,   86,   86,   86, 3518,   86, 3518,   86,   86,   86,
+       86,   86, 3518, 3518,   86,   86,   86,   86,   86, 3518,
+     3518,   86, 3518,   86,   86, 3518,   86,   86, 3518, 3518,
+       86,   86,   86,   86,   86, 3518,   86, 3518,   86,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86, 3518,   86,   86,   86,   86, 3518,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+      173,   86,   86,   86,   86, 3518,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86, 3518,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86, 3518, 3518,   86,   86,   86,   86,   86,   86,   86,
+     3518, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86, 3518,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86, 3518, 3518, 3518, 3518,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86, 3518,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86, 3518,   86,   86,   86,   86,   86,   86,   86,   86,
+      173,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86, 3518,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518, 3518,   86,   86,   86, 3518, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518,   86,   86, 3518,   86,   86,   86,
+
+       86,   86, 3518,   86,   86,   86,   86, 3518,   86,   86,
+       86, 3518,   86, 3518,   86,   86,   86,   86,   86, 3518,
+       86,   86, 3518,   86,   86,   86,   86, 3518,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86, 3518, 3518,   86,   86,  173,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86,   86, 3518,
+     3518,   86, 3518,   86,   86, 3518,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86, 3518,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86, 3518,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518, 3518, 3518,   86,   86, 3518,   86,   86,   86,   86,
+     3518,   86,   86,   86, 3518, 3518,   86,   86,   86,   86,
+       86, 3518,   86,   86, 3518,   86, 3518,   86,   86,   86,
+       86, 3518,   86,   86, 3518,   86, 3518,   86,   86,   86,
+       86,   86,   86,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+
+     3518,   86, 3518,   86, 3518,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+     3518,   86,   86, 3518,   86, 3518,   86, 3518,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86, 3518,
+       86,   86,   86,   86, 3518, 3518,   86,   86,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518, 3518,
+     3518,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86, 3518, 3518,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86, 3518,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86, 3518, 3518,   86, 3518,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86, 3518, 3518,   86, 3518,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86, 3518,   86,   86,   86, 3518,
+     3518,   86,   86,   86, 3518, 3518, 3518,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86, 3518,   86,   86,
+
+       86,   86,   86, 3518, 3518,   86,   86,   86,   86, 3518,
+     3518,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86, 3518, 3518,   86, 3518,   86,
+       86, 3518, 3518,   86,   86,   86,   86,   86,   86,   86,
+       86,   86, 3518,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+     3518, 3518,   86,   86,   86,   86,   86, 3518,   86,   86,
+       86,   86,   86,   86,   86,   86,   86, 3518,   86,   86,
+
+     3518, 3518,   86,   86, 3518, 3518,   86, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518,   86,   86, 3518,   86,   86,
+       86, 3518,   86,   86, 3518,   86,   86,   86,   86,   86,
+     3518,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86, 3518, 3518, 3518,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86, 3518,   86,   86,   86,   86,   86, 3518,   86, 3518,
+       86, 3518, 3518,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86, 3518,   86, 3518, 3518,   86,
+       86,   86, 3518,   86,   86, 3518,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518, 3518,   86,   86,
+       86,   86,   86,   86,   86, 3518,   86,   86,   86,   86,
+       86,   86, 3518,   86, 3518,   86,   86, 3518,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86, 3518,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86, 3518,   86,   86, 3518,
+       86,   86,   86,   86,   86, 3518,   86,   86,   86,   86,
+
+       86,   86, 3518,   86,   86,   86, 3518,   86, 3518, 3518,
+       86,   86,   86,   86,   86, 3518, 3518,    0
     } ;
 
-static const flex_int16_t yy_nxt[6588] =
+static const flex_int16_t yy_nxt[4396] =
     {   0,
        18,   19,   20,   21,   22,   23,   22,   18,   18,   18,
        18,   18,   22,   24,   25,   26,   27,   28,   29,   30,
        18,   31,   32,   33,   34,   35,   36,   37,   38,   39,
-       40,   41,   42,   43,   44,   45,   18,   18,   18,   46,
-       48,   49,   50,   48,   49,   50,   53,   54,   53,   54,
-       55,   51,   55,   85,   51,   85,   85,   56,   85,   56,
-       58,   59,   60,   61,   85,   22,   58,   59,   60,   61,
-       86,   22,   62,   64,   65,   66,   86,   97,   62,   64,
-       65,   66,   87,   86,   67,  119,   88,  108,   85,   86,
-       67,   19,   20,   21,   69,   70,   71,   75,   76,   77,
-
-       78,   86,   22,   72,  121,   86,  120,  109,   86,   79,
-      160,  160,   73,   19,   20,   21,   69,   70,   71,   75,
-       76,   77,   78,  187,   22,   72,   81,   82,   83,  130,
-       90,   79,   90,   90,   73,   90,   86,   84,   81,   82,
-       83,   90,   91,   86,   86,   98,   92,   93,  170,   84,
-       94,  159,   99,   86,  110,   95,  100,  162,   86,  101,
-      162,  170,   86,  112,   96,   86,  167,  167,  111,   86,
-      102,  113,  137,  115,  103,  173,  116,  104,   86,  105,
-      106,  179,  114,  117,  170,  118,   86,  122,   86,  126,
-      107,   86,  156,  127,   86,  123,  157,  184,   86,  138,
-
-      158,  124,   87,  139,   86,  125,   88,  128,  180,  129,
-       86,  131,   86,  140,  141,  132,  142,  143,   86,  133,
-      144,   86,  148,   86,  149,  134,   86,  145,  135,   86,
-      152,  146,  147,  150,   86,  136,  177,  177,  183,  151,
-      153,  181,  196,  189,  154,  155,  164,   86,  164,  164,
-       90,  164,   90,   90,  169,   90,  169,  169,  174,  169,
-      174,  174,  172,  174,   85,   86,   85,   85,   90,   85,
-       90,   90,  289,   90,   86,   85,   86,  182,   86,   90,
-       91,  185,  190,  188,   86,   86,  197,   86,  191,   86,
-      192,   86,   86,  207,  186,   86,   86,   86,   86,   86,
-
-      178,  199,  193,  194,   86,  198,   86,  195,   86,  200,
-       86,  201,  245,  209,  205,  202,  203,  206,  208,   86,
-      210,  215,  211,  204,   86,  212,   86,   86,   86,  217,
-       86,  218,   86,  220,   86,   86,  226,  221,  213,  214,
-       86,  227,  225,  223,   86,   86,  216,  229,  224,   86,
-       86,  219,   86,  222,  230,  232,  233,  228,   86,   86,
-       86,   86,  231,  235,   86,  237,   86,  240,  234,  238,
-       86,   86,   86,   86,  242,   86,  236,  370,   86,   86,
-       86,  239,   86,  243,  241,  248,  251,  252,   86,  244,
-      253,  247,   86,   86,   86,  254,  249,  246,  260,  257,
-
-      250,  261,   86,   86,  259,  263,   86,   86,   86,   86,
-      258,  267,  255,   86,  264,  256,   86,   86,  262,  266,
-      268,  270,  160,  160,   86,  162,  265,  269,  162,  273,
-      164,  271,  164,  164,  337,  164,  167,  167,  169,   86,
-      169,  169,   90,  169,   90,   90,  170,   90,  174,  272,
-      174,  174,  274,  174,  172,  177,  177,  276,   86,   86,
-       86,   86,   86,   86,   86,   86,   86,  275,  278,   86,
-      281,  284,  280,   86,  277,  279,   86,  287,  286,  283,
-      176,  290,  282,   86,  288,  285,   86,  291,  292,   86,
-      293,  317,   86,  296,   86,  294,   86,  301,  297,   86,
-
-       86,   86,   86,  298,   86,   86,  304,  305,  308,  299,
-      300,  302,  295,   86,   86,   86,  306,  310,   86,  303,
-      311,   86,   86,   86,   86,  307,   86,  318,   86,   86,
-       86,  319,   86,  325,  312,  313,  315,  309,  314,  316,
-       86,  320,   86,  329,  321,  328,  322,  330,  327,  326,
-      332,   86,   86,   86,  724,  334,   86,  338,  323,  331,
-      324,   86,  335,   86,   86,  340,   86,  342,   86,  339,
-      341,   86,  333,   86,   86,   86,  344,  336,   86,   86,
-       86,  343,   86,   86,  346,   86,  348,   86,  345,   86,
-       86,   86,   86,  351,  353,   86,  349,  358,   86,  347,
-
-      352,  354,  359,   86,   86,  350,  355,   86,   86,  360,
-      357,  356,  362,  364,   86,  367,  361,   86,   86,   86,
-       86,   86,  373,  369,   86,   86,   86,   86,   86,  363,
-      374,  372,  365,  366,  376,   86,   86,  368,  377,  371,
-       86,  378,   86,  379,  375,  380,   86,  381,  383,   86,
-       86,  384,  170,   86,   86,  387,   86,   86,  386,   86,
-       86,   86,   86,  394,  388,  390,  392,  395,  385,   86,
-       86,  382,   86,   86,  398,  389,   86,  396,   86,  391,
-       86,  397,   86,  393,   86,  399,   86,  404,   86,  405,
-      409,  406,  400,   86,  403,   86,   86,   86,  402,  407,
-
-      401,   86,  408,   86,  411,   86,  412,   86,   86,   86,
-       86,  415,   86,   86,  410,  419,  416,   86,  175,  417,
-      421,   86,  418,  413,  414,   86,   86,  422,  423,   86,
-       86,  420,   86,  424,   86,   86,  426,  427,  428,  429,
-       86,   86,   86,   86,   86,   86,   86,  435,  432,   86,
-      425,   86,  436,   86,   86,  434,   86,  438,   86,  441,
-      431,  437,  433,   86,  430,   86,  443,  446,   86,   86,
-      439,  447,  440,   86,  442,   86,   86,  445,   86,   86,
-      457,  448,   86,  444,   86,  455,   86,   86,   86,  458,
-      461,  459,  499,  449,  170,  462,  450,  456,  469,   86,
-
-      463,  451,  452,  453,  454,  466,   86,  460,  464,  465,
-      467,   86,   86,   86,   86,  468,   86,   86,   86,  477,
-       86,   86,   86,  479,   86,  475,  478,  476,   86,  472,
-      470,   86,  480,  471,  473,  474,   86,   86,   86,  481,
-      483,  482,   86,  487,   86,  168,   86,   86,  488,   86,
-      489,  492,   86,  505,  493,  166,  484,  486,  485,  490,
-       86,   86,   86,   86,  491,   86,  494,  495,  497,   86,
-      498,   86,  500,  496,   86,  506,  507,   86,   86,  508,
-      504,   86,   86,   86,   86,  501,  509,   86,  502,  546,
-      503,   86,  510,   86,  520,   86,  511,  522,  519,  523,
-
-       86,  524,   86,  525,  512,   86,  513,  527,  514,  537,
-      535,  536,  521,  170,  538,   86,   86,   86,   86,  526,
-       86,  515,  539,   86,  516,  556,  517,   86,  518,   86,
-       86,  528,  529,  542,  540,   86,  541,  165,   86,  543,
-      545,  530,  544,  531,  532,  533,   86,  547,  534,  548,
-      549,   86,   86,   86,   86,  558,   86,  551,  553,   86,
-      550,   86,   86,  559,   86,   86,   86,  563,  555,  557,
-       86,  554,   86,   86,   86,  552,  561,  566,   86,  560,
-      562,  567,  568,   86,   86,   86,  565,   86,   86,  573,
-      564,   86,  572,   86,  569,  574,  575,   86,   86,  570,
-
-       86,  571,  577,   86,  578,   86,  580,  581,   86,  584,
-      594,   86,  582,  576,   86,   86,   86,  585,  603,  579,
-      586,   86,   86,  595,  583,   86,  589,  596,   86,  597,
-      599,  587,   86,  588,  590,  591,   86,  598,  592,  593,
-       86,   86,   86,   86,   86,  602,  601,  604,   86,  606,
-      608,   86,   86,  600,   86,   86,  611,  607,  612,  609,
-       86,   86,   86,  605,   86,  610,  613,   86,   86,   86,
-      618,   86,  616,  617,   86,  614,   86,   86,  619,   86,
-       86,   86,  615,  620,  624,   86,   86,  627,  623,  625,
-       86,  626,   86,   86,  621,  622,   86,  628,   86,  630,
-
-       86,  629,   86,  632,  634,   86,   86,   86,   86,  635,
-       86,  637,  631,   86,  633,   86,  645,  647,   86,   86,
-      639,  723,   86,   86,   86,   86,  636,  638,  640,   86,
-      641,  642,  644,  646,  648,  643,   86,   86,   86,  649,
-      652,   86,  655,   86,  650,  658,   86,  651,   86,  657,
-       86,   86,  653,   86,   86,   86,  654,   86,  661,  664,
-       86,   86,   86,  656,  660,  665,  667,   86,   86,  659,
-       86,   86,   86,   86,   86,   86,  662,  666,  663,  681,
-       86,   86,   86,  668,  670,  163,  684,  669,   86,  671,
-      679,  682,  720,  698,  672,  680,  673,  683,   86,   86,
-
-       86,   86,  674,   86,  675,  685,  688,  676,  677,  686,
-      692,   86,  691,  687,  678,  689,   86,   86,  690,   86,
-       86,  693,  696,   86,  699,   86,  694,   86,  701,   86,
-       86,   86,   86,  695,   86,   86,   86,   86,   86,   86,
-      707,   86,  703,  697,  702,  708,  704,  711,  712,  170,
-      700,  705,  710,  713,  714,   86,  706,  709,   86,   86,
-       86,   86,   86,   86,   86,  727,   86,  715,  721,  726,
-       86,   86,   86,  716,  725,  718,  722,  719,  717,  729,
-       86,   86,   86,   86,  728,   86,  731,   86,   86,   86,
-      735,   86,  730,  734,  740,  732,   86,  733,  736,  741,
-
-       86,  743,   86,  744,   86,  737,  745,  739,  738,  742,
-      746,   86,   86,  747,   86,  748,   86,  749,   86,   86,
-       86,   86,  750,   86,   86,  754,   86,  753,   86,   86,
-      752,  757,   86,   86,  756,   86,  762,  751,  755,   86,
-      758,   86,   86,  761,   86,  763,   86,  766,   86,   86,
-      767,  760,  759,  765,   86,   86,   86,   86,  773,   86,
-      770,  768,  764,   86,   86,   86,   86,   86,  774,   86,
-      781,   86,  771,  775,  776,  769,   86,  772,   86,  777,
-       86,  783,  778,  779,  780,  782,   86,   86,  788,  789,
-      786,  784,  785,  787,   86,   86,   86,   86,  790,   86,
-
-      791,   86,  793,   86,  794,   86,   86,   86,  795,   86,
-       86,  802,   86,  798,  800,  796,   86,   86,   86,   86,
-      799,   86,  792,  797,   86,  803,  808,  810,  806,   86,
-      801,   86,   86,  807,  805,  809,  804,  811,  812,   86,
-       86,   86,  813,   86,   86,   86,  814,  819,  821,  815,
-      817,   86,   86,   86,   86,  822,  820,  816,   86,   86,
-      825,   86,   86,  818,  824,  826,   86,   86,   86,   86,
-      832,   86,  829,   86,  827,  828,   86,  834,  835,   86,
-      837,   86,   86,  823,  839,   86,  830,  831,  833,  838,
-      841,  836,   86,   86,   86,  845,   86,  842,  843,  840,
-
-      846,   86,   86,  847,   86,   86,  849,  851,  844,   86,
-       86,   86,   86,  850,   86,  857,   86,  848,   86,   86,
-      858,   86,   86,   86,   86,   86,   86,  852,  853,  854,
-      866,  855,  859,  860,  856,   86,   86,  861,  863,   86,
-      865,   86,  862,   86,   86,  869,   86,  864,  871,   86,
-       86,   86,   86,  867,   86,  868,   86,  880,   86,  878,
-      870,   86,   86,   86,  872,  873,  881,   86,  874,  875,
-      876,  877,  879,   86,   86,  882,   86,   86,  884,  886,
-       86,   86,  883,   86,   86,   86,   86,  885,  890,  891,
-      892,  893,  887,  889,   86,   86,  888,   86,   86,  894,
-
-       86,   86,  896,  895,   86,  170,  897,  902,   86,  899,
-      901,   86,  898,  900,   86,  903,   86,   86,   86,  909,
-       86,   86,  904,  905,   86,  910,  912,   86,   86,   86,
-      914,  906,  907,  911,  913,  916,   86,   86,  908,   86,
-       86,   86,   86,  918,  922,   86,   86,  915,   86,  919,
-       86,   86,   86,  923,   86,  924,  917,   86,   86,   86,
-      921,   86,   86,  942,  925,  920,   86,  937,  938,  935,
-      940,   86,  927,   86,  936,   86,  926,   86,  161,  928,
-       86,  939,  929,   86,  943,  965,  930,  941,   86,  931,
-       86,  944,   86,  948,  949,   86,  932,  933,  946,  934,
-
-       86,   86,  947,  945,   86,  950,  951,   86,  952,   86,
-       86,  953,  957,  959,  960,   86,  954,   86,   86,  962,
-       86,   86,  955,  956,   86,  961,  964,  968,  969,   86,
-      958,   86,  966,  970,   86,  963,  971,   86,  972,   86,
-       86,  975,   86,  967,  974,   86,  973,  976,  977,   86,
-      979,   86,   86,   86,  978,  980,   86,   86,   86,   86,
-       86,  983,   86,  987,  981,   86,   86,  986,   86,   86,
-      990,   86,   86,  996,   86,  982, 1007,   86,  984,  985,
-      988,  994,  989,  992,  991,   86,  997,   86,   86, 1000,
-      995,  998,   86,  999,  993,   86, 1001,   86,   86, 1003,
-
-     1004,   86,   86, 1002,   86,   86,   86, 1005, 1008,   86,
-       86,   86, 1006,   86, 1009,   86, 1011,   86,   86,   86,
-     1012, 1016,   86,   86, 1019,   86,   86, 1018, 1010, 1020,
-       86,   86, 1017, 1013, 1014,   86, 1015,   86,   86, 1022,
-     1023,   86,   86, 1025,   86, 1021,   86, 1027,   86,   86,
-     1026, 1028,   86,   86, 1033,   86, 1029,   86, 1031, 1034,
-       86, 1024,   86, 1035,   86, 1032, 1038,   86, 1036,   86,
-     1044,   86, 1041, 1030, 1037,   86,   86, 1043,   86,   86,
-     1042,   86,   86, 1046,   86, 1040,   86,   86, 1039,   86,
-       86,   86,   86, 1057, 1054, 1052,   86, 1045,   86,   86,
-
-     1047, 1048, 1049,   86,   86, 1058, 1050, 1051,   86, 1055,
-     1059, 1056, 1053,   86, 1062,   86, 1065,   86, 1061,   86,
-     1064,   86, 1060,   86,   86,   86,   86, 1063,   86,   86,
-     1067, 1074, 1069,   86, 1075, 1077,   86,   86,   86, 1066,
-       86,   86,   86, 1068,   86, 1070, 1082, 1072, 1071, 1073,
-     1076, 1080, 1078, 1079, 1081,   86,   86,   86,   86,   86,
-       86, 1086, 1089, 1083,   86, 1088,   86, 1084,   86, 1090,
-       86,   86, 1093, 1095,   86, 1085,   86, 1091,   86, 1087,
-       86, 1098,   86, 1092,   86, 1097, 1099,  170, 1101,   86,
-     1102, 1094,   86,   86, 1096,   86,   86, 1100,   86,   86,
-
-     1105,   86,   86,   86,   86, 1118,   86,   86,   86,   86,
-     1119,   86, 1109, 1104, 1103, 1106, 1108, 1121,   86,   86,
-     1278, 1110, 1107, 1120, 1111,   86, 1124,   86, 1112,   86,
-     1113, 1123, 1122, 1125, 1114,   86, 1115,   86,   86, 1128,
-     1126, 1116,   86, 1127, 1129,   86, 1117, 1130,   86,   86,
-       86, 1131, 1132,   86,   86, 1135,   86, 1134, 1138,   86,
-       86, 1137,   86,   86, 1133, 1136,   86, 1144, 1139, 1142,
-     1145,   86, 1143, 1141, 1146,   86,   86, 1140, 1147,   86,
-       86, 1148, 1149,   86,   86, 1150,   86,   86,   86,   86,
-     1151,   86, 1161, 1152,   86, 1153, 1160, 1162,   86, 1164,
-
-     1154, 1163, 1155,   86,   86, 1167,   86,   86, 1156, 1165,
-     1171, 1166,   86, 1157, 1158,   86,   86,   86,   86,   86,
-     1159,   86, 1172, 1177,   86, 1168, 1169, 1173, 1170,   86,
-       86, 1180,   86, 1178,   86, 1175, 1174,   86,   86, 1176,
-       86, 1181, 1185,   86,   86, 1183,   86, 1184,   86, 1186,
-     1179, 1182,   86,   86, 1191, 1188,   86,   86,   86,   86,
-       86, 1189, 1187, 1194,   86, 1192,   86,   86,   86, 1190,
-      178,   86,   86,   86,   86,   86, 1193, 1201, 1196, 1195,
-     1198, 1199, 1200, 1203, 1202,   86, 1197,   86,   86,   86,
-     1204,   86,   86,   86,   86, 1206,   86,   86, 1211, 1205,
-
-       86, 1212, 1208, 1214,   86, 1213, 1207, 1210, 1216, 1209,
-       86, 1215, 1218, 1217,   86,   86,   86, 1221,   86,   86,
-       86, 1223, 1222,   86, 1224,   86,   86,   86, 1219, 1225,
-       86,   86, 1220, 1226, 1232,   86, 1234,   86, 1227,   86,
-       86, 1228,   86, 1230, 1236, 1229, 1231,   86,   86,   86,
-       86, 1238, 1235,   86,   86, 1233,   86,   86, 1240, 1241,
-       86, 1237, 1244,   86,   86, 1243, 1242,   86, 1245,   86,
-     1239, 1250, 1246, 1247,   86, 1249,   86,   86, 1251,   86,
-     1248,   86,   86, 1252, 1254,   86, 1255,   86,   86,   86,
-       86, 1261, 1259, 1262, 1253,   86,   86,   86,   86,   86,
-
-     1256, 1263,   86, 1260,   86, 1266, 1257, 1264, 1258, 1265,
-     1269,   86,   86, 1267, 1271,   86,   86, 1270, 1268,   86,
-       86,   86,   86,   86,   86,   86, 1276, 1277, 1272, 1273,
-     1279,   86,   86,   86, 1283,   86, 1284,   86,   86, 1274,
-       86, 1275,   86, 1286, 1281, 1287,   86,   86,   86, 1280,
-     1285, 1291, 1282,   86,   86,   86, 1288,   86,   86,   86,
-     1290, 1289,  170, 1293, 1297,   86,   86,   86,   86,   86,
-       86, 1292,   86, 1302, 1304,   86, 1294,   86, 1296, 1301,
-     1299, 1303, 1298, 1295, 1300, 1306, 1307,   86,   86,   86,
-     1305,   86,   86, 1308, 1309,   86,   86, 1310,   86,   86,
-
-       86, 1311, 1312,   86, 1314,   86, 1316,   86, 1320,   86,
-     1317,   86, 1313,   86,   86, 1315,   86,   86,   86,   86,
-     1318,   86, 1324,   86, 1326, 1321, 1319, 1330, 1334, 1323,
-       86, 1322, 1335, 1327,   86, 1328,   86, 1325, 1329,   86,
-     1331, 1332, 1333,   86,   86,   86,   86, 1336,   86, 1337,
-       86, 1340, 1338,   86, 1339,   86,   86,   86, 1343, 1347,
-       86,   86, 1342,   86,   86,   86, 1348, 1341, 1345, 1344,
-     1349,   86,   86,   86,   86, 1346, 1351, 1352,   86, 1354,
-       86, 1353,   86, 1350,   86,   86,   86,   86,   86, 1355,
-       86,   86, 1357, 1359, 1360,   86, 1364, 1356,   86, 1358,
-
-       86,   86,   86,   86, 1361,   86, 1363,   86, 1362, 1368,
-     1365, 1366,   86,   86, 1376, 1371, 1369,   86, 1367,   86,
-       86, 1370,   86,   86, 1372,   86,   86, 1374,   86,   86,
-     1379, 1378, 1373, 1375, 1377,   86,   86,   86, 1383, 1384,
-     1382, 1381, 1388, 1380, 1385,   86, 1398, 1386,   86, 1389,
-     1387,   86, 1390,   86,   86, 1399, 1391,   86, 1400, 1392,
-     1393,   86,   86, 1402, 1394, 1403, 1397, 1401,   86,   86,
-     1395,   86,   86, 1404, 1396,   86, 1406, 1405,   86, 1408,
-       86,   86,   86, 1409,   86, 1410,   86,   86,   86,   86,
-     1407, 1418, 1415, 1413,   86,  176,   86,   86, 1419, 1420,
-
-     1412, 1411, 1416,   86,   86,   86, 1414, 1417,   86, 1421,
-     1428,   86, 1422, 1427,   86, 1429,   86, 1423,   86, 1424,
-     1433, 1425, 1432, 1426, 1430, 1431,   86,   86,   86, 1437,
-       86,   86,   86, 1434, 1438,   86,   86, 1436,   86, 1439,
-       86, 1441,   86,   86, 1435, 1447, 1442, 1443,   86, 1448,
-       86,   86,   86, 1440,   86,   86,   86, 1446, 1449, 1444,
-     1451, 1445,   86,   86,   86, 1453, 1450,   86, 1452, 1454,
-     1458,   86, 1457,   86, 1460,   86,   86,   86, 1461,   86,
-     1462, 1455,   86,   86, 1463, 1466,   86,   86, 1459, 1456,
-     1468,   86, 1465,   86, 1469,   86,   86,   86, 1473,   86,
-
-     1470, 1464,   86,   86,   86,   86, 1475, 1467,   86,  175,
-     1477,   86,   86,   86, 1479,   86, 1481, 1471, 1472,   86,
-     1478,   86, 1474,   86, 1476,   86, 1480,   86, 1483, 1486,
-     1482,   86, 1485, 1484,   86,   86, 1487, 1488,   86, 1490,
-     1489,   86,   86, 1492,   86,   86, 1491, 1496, 1493, 1497,
-     1499, 1494,   86,   86,   86,   86,   86, 1498, 1495,   86,
-       86, 1503,   86, 1500,   86,  170,   86,   86, 1508, 1509,
-       86, 1502,   86, 1511,   86,   86, 1510,   86, 1501,   86,
-     1505,   86,   86,   86, 1504,   86, 1506,   86,   86, 1519,
-     1507, 1512, 1514,   86, 1516,   86,   86, 1513,   86, 1517,
-
-       86, 1515,   86, 1520,   86, 1518,   86, 1523, 1524,   86,
-     1528, 1526,   86, 1522, 1533, 1529,   86, 1527, 1521, 1525,
-       86, 1531, 1530,   86,   86,   86,   86,   86, 1532, 1540,
-     1537,   86,   86, 1538, 1542, 1539, 1543,   86, 1534, 1535,
-       86, 1545, 1536,   86,   86, 1541, 1546,   86, 1544,   86,
-       86,   86,   86,   86,   86, 1550, 1551,   86,   86, 1554,
-       86,   86, 1547,   86, 1559,   86,   86, 1549,   86, 1560,
-     1548, 1552, 1553,   86, 1556, 1563, 1557, 1555,   86, 1558,
-       86,   86,   86,   86, 1561, 1564,   86, 1562,   86, 1571,
-       86,   86,   86,   86, 1566, 1570, 1572, 1565, 1567,   86,
-
-     1575, 1568, 1574,   86,   86,   86, 1580, 1569,   86, 1579,
-     1573, 1581,   86, 1577,   86, 1583,   86,   86, 1576,   86,
-       86,   86,   86, 1588, 1589, 1578, 1584, 1587, 1582,   86,
-       86, 1590,   86, 1591,   86, 1585,   86,   86,   86, 1592,
-     1593,   86, 1586,   86,   86, 1595,   86, 1594,   86,   86,
-       86,   86, 1596,   86, 1601,   86, 1597, 1600,   86, 1603,
-     1598,   86, 1607, 1599,   86, 1609, 1604, 1608,   86, 1602,
-     1610,   86, 1605,   86, 1606,   86, 1612,   86,   86,   86,
-       86,   86,   86, 1620, 1611, 1616,   86, 1615,   86,   86,
-       86, 1621, 1613, 1623,   86,   86, 1614,   86, 1617,   86,
-
-     1619, 1618, 1626, 1625,   86,   86,   86,   86,   86, 1624,
-       86,   86,   86, 1627, 1622, 1635, 1632,   86, 1634,   86,
-       86, 1631,   86, 1628, 1629, 1630, 1633, 1639,   86, 1636,
-     1640,   86, 1638,   86,   86, 1643,   86, 1642, 1637, 1641,
-       86,   86,   86, 1646,   86, 1644,   86, 1647,   86,   86,
-       86, 1650, 1656, 1645, 1654,   86,   86, 1651,   86,   86,
-     1648, 1655, 1649, 1658,   86, 1653,   86,   86, 1652, 1659,
-     1660, 1661,   86,   86, 1657,   86,   86, 1666, 1667,   86,
-       86,   86,   86,   86, 1664,   86, 1671, 1670, 1672,   86,
-       86, 1663, 1662, 1675,   86,   86, 1665,   86, 1668, 1674,
-
-       86,   86, 1669, 1676,   86,   86,   86,   86, 1679, 1673,
-       86, 1677,   86, 1678,   86, 1681,   86, 1682,   86,   86,
-     1688, 1680, 1683, 1686,   86,   86, 1687,   86,   86,   86,
-       86, 1684,   86, 1685, 1689,   86, 1694,   86,   86,   86,
-       86, 1700, 1690, 1691, 1695, 1697, 1699,   86,   86, 1693,
-     1696,   86, 1692, 1698,   86, 1702,   86,   86,   86, 1701,
-     1705,  170, 1704, 1707, 1708,   86,   86,   86,   86,   86,
-     1703,   86,   86, 1716,   86,   86, 1706, 1709,   86, 1717,
-       86, 1711,   86, 1714, 1710, 1720,   86, 1712, 1713, 1721,
-       86,   86,   86, 1724,   86, 1718, 1715, 1722, 1719, 1725,
-
-     1726, 1728, 1723,   86, 1730,   86,   86,   86,   86,   86,
-     1727,   86,   86,   86, 1735, 1732, 1733, 1729,   86, 1736,
-       86,   86,   86,   86,   86, 1741, 1740, 1731,   86,   86,
-       86,   86, 1748,  170, 1737,   86, 1734, 1739,   86, 1738,
-     1749, 1743,   86,   86,   86, 1745, 1742, 1750, 1746,   86,
-     1744, 1757, 1752, 1758, 1753,   86, 1754,   86, 1755,   86,
-     1747, 1756,   86, 1751,   86,   86, 1760,   86, 1761, 1759,
-     1762,   86,   86,   86,   86,   86,   86, 1763,   86, 1769,
-     1770, 1768,   86, 1772, 1764,   86,   86, 1771,   86,   86,
-       86, 1765,   86, 1766,   86, 1767,   86, 1774, 1775,   86,
-
-       86, 1776,   86,   86,   86,   86,   86,   86, 1777,   86,
-       86, 1773, 1786, 1785, 1778,   86, 1780, 1781, 1782,   86,
-     1779,   86, 1791, 1783,   86,   86, 1787, 1788,   86,   86,
-       86, 1784, 1790, 1789,   86, 1797,   86,   86,   86,   86,
-       86, 1793,   86, 1799, 1792,   86, 1801,   86, 1795, 1794,
-       86, 1796, 1800,   86, 1802,   86, 1803, 1798,   86,   86,
-       86,   86, 1806,   86,   86, 1808,   86, 1815, 1805, 1809,
-     1807, 1804, 1810, 1816,   86, 1811, 1812, 1817,   86,   86,
-       86, 1813,   86, 1820, 1819, 1821,   86,   86, 1814,   86,
-       86, 1818,   86,   86, 1824, 1822,   86, 1825,   86,   86,
-
-       86,   86, 1828, 1834,   86,   86, 1823, 1833, 1830, 1826,
-     1832, 1831, 1827,   86,   86,   86, 1840, 1829, 1836,   86,
-     1835, 1841,   86,   86,   86,   86,   86,   86, 1842, 1838,
-       86, 1846, 1837,   86,   86, 1839, 1843,   86, 1850, 1849,
-       86,   86, 1848, 1847, 1845,   86, 1854,   86,   86,   86,
-     1844,   86, 1851,   86, 1852, 1858,   86, 1853, 1855,   86,
-     1859,   86,   86, 1860, 1863,   86, 1857, 1869, 1856, 1864,
-     1868, 1861, 1867, 1862,   86,   86, 1866,   86,   86, 1870,
-     1865,   86,   86, 1874,   86,   86, 1878, 1871,   86,   86,
-       86,   86,   86, 1876, 1872,   86, 1873, 1875,   86, 1877,
-
-       86,   86,   86, 1879,   86,   86, 1882, 1880,   86, 1883,
-     1881, 1888,   86,   86, 1884, 1885, 1890, 1891, 1886, 1887,
-       86, 1892,   86,   86, 1893,   86,   86, 1897,   86,   86,
-     1899, 1895,   86, 1889,   86,   86,   86, 1903,   86,   86,
-     1894,   86, 1898,   86,   86, 1896, 1906, 1905,   86, 1907,
-     1901,   86,   86, 1902, 1900,  170, 1908, 1909,   86, 1904,
-     1913,   86,   86,   86,   86, 1917,   86, 1911,   86,   86,
-       86,   86,   86, 1912,   86, 1910, 1915, 1919,   86, 1924,
-     1920, 1914, 1916, 1918, 1921,   86,   86,   86, 1928,   86,
-     1922,  168,   86, 1927, 1923, 1929, 1926,   86, 1925, 1930,
-
-       86,   86, 1931, 1933, 1934,   86,   86,   86,   86,   86,
-     1932,   86,   86, 1936,   86, 1937,   86,   86, 1935,   86,
-       86,   86, 1942,   86, 1943,   86,   86, 1938,   86, 1944,
-     1939, 1947, 1940, 1945, 1941,   86,   86, 1948, 1946,   86,
-     1951, 1953, 1955,   86,   86, 1950, 1956, 1952,   86,   86,
-     1949,   86,   86,   86, 1954,   86,   86, 1962,   86, 1965,
-     1966,   86, 1967,   86,   86, 1957,   86, 1958, 1959, 1960,
-     1963, 1961, 1964, 1969,   86,   86, 1970,   86, 1973,   86,
-     1975,   86,   86, 1977, 1968, 1974,   86, 1971,   86,   86,
-     1979, 1976,   86,   86,   86,   86,   86, 1981, 1972,   86,
-
-     1978, 1982,   86,   86, 1984, 1985,   86,   86,   86, 1989,
-     1986,   86, 1988, 1983, 1991,   86, 1990, 1980,   86,   86,
-       86,   86,   86,  166, 1987, 1999,   86, 1992, 1993, 1994,
-     2001,   86,   86,   86, 1995, 2002,   86, 1997, 1996,   86,
-     2003, 1998, 2000,   86, 2006, 2005, 2008, 2004,   86,   86,
-       86,   86,   86,   86, 2007, 2012,   86, 2009,   86, 2014,
-       86,   86, 2017, 2018,   86,   86, 2020,   86,   86, 2010,
-       86, 2011,   86, 2015,   86, 2026,   86, 2013, 2025, 2022,
-       86, 2023, 2016,   86,   86, 2019,   86,   86,   86,   86,
-     2032,   86,   86, 2021, 2029, 2024, 2036, 2030, 2028,   86,
-
-       86, 2027,   86,   86, 2035, 2039,   86,   86, 2034, 2040,
-     2038,   86, 2031, 2042, 2043,   86,   86, 2033,   86,   86,
-     2037, 2044,   86,   86,   86, 2041,   86, 2045,   86, 2049,
-       86,   86, 2052, 2053, 2054, 2048,   86,   86,   86,   86,
-       86,   86, 2046, 2047,   86, 2057, 2050,   86, 2062,   86,
-       86, 2056, 2061,   86,   86,   86, 2051, 2055, 2059, 2066,
-       86, 2058,   86, 2067,   86,   86, 2060,   86, 2064, 2063,
-     2068, 2070,   86, 2065, 2069,   86, 2074,   86, 2072, 2071,
-       86, 2075,   86, 2073,   86,   86,   86, 2081,   86, 2078,
-       86, 2084,   86,   86, 2076, 2083,   86, 2085,   86,   86,
-
-       86, 2077, 2086, 2082,   86, 2079, 2080,   86, 2087, 2091,
-       86, 2088, 2092,   86, 2093, 2095, 2089, 2096,   86, 2094,
-       86,   86,   86,   86, 2090, 2100,   86, 2098,   86,   86,
-     2099,   86, 2102, 2097,   86,   86, 2105, 2107, 2101,  170,
-       86, 2103,   86,   86, 2108,   86,   86,   86,   86,   86,
-     2113,   86, 2109, 2112,   86, 2114, 2120, 2106, 2110, 2104,
-     2115,   86, 2116,   86, 2111, 2118,   86,   86,   86, 2117,
-       86,   86, 2119, 2121,   86, 2123,   86, 2122,   86, 2124,
-       86, 2126,   86,   86, 2130,   86, 2125,   86, 2129,   86,
-     2127,   86,   86,   86, 2128,   86, 2131, 2132, 2133,   86,
-
-     2135,   86, 2134,   86, 2137,   86, 2142,   86,   86, 2136,
-     2139, 2140,   86, 2141,   86,   86,   86,   86, 2147,   86,
-       86, 2138,   86, 2143, 2144,   86, 2152,   86,   86, 2148,
-     2146, 2150, 2145,   86,   86,   86, 2153, 2149,   86, 2156,
-     2151, 2158,   86,   86,   86, 2154, 2159,   86, 2157, 2155,
-       86, 2164,   86,   86, 2160,   86, 2166,   86,  165,   86,
-     2161, 2167, 2162,   86, 2163, 2168,   86, 2170,   86, 2165,
-       86, 2169,   86, 2171,   86, 2174, 2172, 2175,   86,   86,
-     2173,   86,   86, 2178,   86,   86,   86,   86,   86,   86,
-       86,   86,   86, 2179,   86,   86, 2192,   86, 2181, 2177,
-
-     2176, 2182, 2183, 2184,   86, 2186, 2180, 2191,   86,   86,
-     2187,   86, 2189,   86, 2185,   86, 2195, 2190,   86,   86,
-     2196,   86,  163, 2188, 2198,   86, 2193, 2199,   86, 2194,
-       86, 2197,   86, 2201,   86,   86, 2200, 2202,   86, 2204,
-     2207, 2203,   86, 2205,   86,   86, 2209, 2206, 2211,   86,
-       86,   86,   86,   86, 2214,   86, 2213,   86, 2215, 2210,
-     2216, 2208,   86, 2219,   86,   86,   86, 2223,   86,   86,
-     2220,   86, 2224,   86,   86, 2217, 2212, 2221, 2222, 2225,
-     2228,   86, 2218,   86, 2229,   86,   86, 2226, 2227, 2232,
-       86,   86, 2234,   86,   86,   86, 2233, 2238,   86,  161,
-
-     2230,   86, 2236,   86, 2240,   86, 2231,   86, 2241,   86,
-     2237, 2235,   86, 2239, 2242,   86,   86, 2243,   86,   86,
-     2247,   86,   86,   86, 2249, 2245,   86, 2244, 2246, 2250,
-       86, 2251, 2252, 2253, 2254,   86, 2248,   86,   86, 2257,
-     2255,   86, 2256, 2260,   86,   86,   86,   86,   86,   86,
-     2259,   86,   86,   86,   86,   86,   86,   86, 2258, 2269,
-     2266, 2264, 2270, 2261, 2262, 2263, 2265, 2267,   86,   86,
-       86,   86, 2268,   86,   86, 2272, 2274, 2271, 2278, 2275,
-     2280,   86,   86, 2279,   86,   86, 2276,  170, 2273, 2282,
-       86, 2277,   86, 2281,   86,   86, 2284, 2288, 2286, 2285,
-
-     2290, 2283, 2289,   86, 2291,   86,   86,   86, 2292, 2287,
-       86,   86, 2295,   86,   86, 2293,   86,   86, 2296, 2300,
-       86,   86, 2301, 2299,   86,   86, 3353, 2304, 2302,   86,
-     2305, 2294, 2297,   86,   86, 2306, 2307,   86,   86,   86,
-     2309,   86, 2303, 2298, 2308, 2310,   86,   86,   86, 2311,
-       86, 2312,   86,   86,   86, 2315,   86,   86, 2313, 2318,
-       86,   86,   86, 2324,   86,   86, 2322,   86, 2317, 2325,
-       86,   86,   86, 2314, 2319, 2316, 2320, 2321,   86,   86,
-       86,   86, 2326, 2327, 2323, 2333, 2332,   86,   86, 2329,
-       86, 2330, 2335,   86,   86,   86, 2328,   86, 2336, 2331,
-
-       86,   86,   86,   86,   86, 2334,   86, 2337,   86,   86,
-       86,   86, 2349, 2338, 2343, 2348, 2351, 2346, 2339, 2341,
-     2347, 2340, 2342, 2345, 2344, 2350,   86,   86,   86,   86,
-     2352,   86,   86, 2356, 2357,   86,   86,   86, 2358, 2359,
-       86, 2353,   86, 2354, 2355,   86, 2362,   86, 2365,   86,
-     2366,   86, 2360,   86,   86, 2361, 2363,   86, 2367, 2364,
-       86,   86, 2368, 2372,   86, 2373,   86,   86, 2375,   86,
-       86, 2377,   86, 2371, 2369,   86,   86, 2380,   86,   86,
-     2370, 2379, 2381,   86,   86,   86, 2374,   86, 2376,   86,
-     2378,   86,   86, 2382, 2383, 3353, 2386,   86, 2384, 2387,
-
-       86, 2389,   86, 2391,   86,   86, 2385, 2392, 2388,   86,
-     2390,   86, 2393, 2395,   86,   86,   86,   86, 2398, 2401,
-       86,   86,   86,   86, 2396,   86,   86, 2394, 2400, 2405,
-     2397,   86, 2399, 2406,   86,   86,   86,   86, 2404,   86,
-     2408, 2402, 2411,   86,   86, 2403, 2412,   86,   86,   86,
-     2407, 2409, 2410, 2414, 2413,   86, 2418,   86,   86, 2420,
-       86,   86, 2415, 2421, 2424,   86, 2416, 2419,   86,   86,
-       86,   86,   86, 2425, 2426, 2417, 2427,   86, 2422,   86,
-     2423, 2429, 2431,   86,   86,   86, 2436,   86, 2433, 2434,
-     2428, 2438,   86, 2430,   86,   86,   86,   86,   86, 2439,
-
-     2435, 2440,   86,   86,   86, 2432, 2443,   86, 2437,   86,
-       86, 2442,   86, 2444, 3353, 2449, 2445, 2450, 2446, 2447,
-     2441,   86, 2452,   86,   86,   86, 2448, 2455, 2451,   86,
-     2454,   86, 2456,   86, 2453,   86,  170,   86,   86,   86,
-     2457, 2458, 2463,   86,   86,   86,   86,   86, 2465,   86,
-       86,   86, 2470, 2461, 2462, 2459,   86, 2460, 2466, 2464,
-       86, 2467, 2468, 2469,   86, 2471, 2474,   86, 2473, 2478,
-     2472,   86, 2475, 2476,   86,   86, 2479, 2480, 2477,   86,
-     2482,   86,   86,   86,   86,   86, 2484,   86, 2481,   86,
-       86,   86, 2488,   86, 2489,   86,   86, 3353, 2483, 2485,
-
-       86, 2491,   86, 2486, 2496,   86, 2492, 2490, 2493, 2487,
-     2494,   86,   86,   86,   86,   86,   86, 2495,   86, 2499,
-     2500,   86, 2497, 2502,   86,   86,   86,   86,   86, 2501,
-       86, 2506, 2509,   86, 2498, 2508,   86,   86,   86, 2510,
-     2505,   86,   86,   86, 2503, 2504,   86, 2514, 2507,   86,
-       86, 2519,   86,   86, 2511, 2518, 2512,   86, 2516,   86,
-     2513, 2520,   86,   86, 2515, 2517,   86, 2528, 2521,   86,
-     2524, 2522,   86, 2523, 2529, 2525,   86, 2527, 2526,   86,
-       86, 2531,   86,   86, 2533,   86,   86,   86,   86,   86,
-       86, 2530, 2532, 2537,   86,   86, 2541,   86,   86, 2539,
-
-     2540, 2535, 2542,   86, 2534, 2536, 2543,   86, 2544,   86,
-       86,   86,   86,   86, 2545, 2547, 2538,   86, 2552,   86,
-     2549,   86, 2554,   86,   86, 2550,   86,   86,   86,   86,
-     2548, 2546, 2553, 2551, 2557,   86,   86,   86, 2561, 2558,
-       86, 2556, 2555, 2562,   86, 2563, 2559, 2560,   86,   86,
-       86,   86,   86, 2567,   86, 2566,   86,   86, 2565,   86,
-       86,   86, 2571, 2634, 2570, 3353, 2564,   86, 2568,   86,
-     2569,   86, 2574, 2575,   86, 2576,   86, 2577,   86, 2572,
-     2573, 2578,   86, 2579,   86,   86, 2582, 2580,   86, 2581,
-       86, 2583,   86,   86,   86, 2588,   86,   86, 2590,   86,
-
-     2584, 2591,   86,   86, 2585,   86,   86,   86,   86,   86,
-     2587,   86,   86, 2586, 2592, 2594, 2589, 2593, 2595,   86,
-     2600,   86,   86,   86, 2597,   86,   86, 2596,  170, 2598,
-       86, 2599, 2601,   86, 2608,   86,   86,   86, 2602, 2604,
-     2607,   86, 2603,   86, 2606, 2609,   86,   86,   86, 2605,
-     2610, 2615, 2611,   86, 3353,   86, 2619,   86, 2617, 2612,
-     2618, 2616, 2620,   86,   86, 2613,   86, 2621,   86, 2614,
-       86, 2622,   86, 2623,   86,   86,   86,   86,   86, 2625,
-       86,   86, 2624,   86,   86,   86, 2638,   86,   86, 2632,
-     2627, 2639,   86, 2626,   86, 2629, 2628,   86,   86,   86,
-
-     2630, 2631,   86, 2633, 2635, 2636, 2637, 2642, 2640, 2643,
-       86, 2644, 2645,   86,   86,   86,   86, 2646,   86, 2641,
-       86,   86, 2648,   86, 2654,   86, 2655,   86,   86,   86,
-       86, 2649, 2647,   86, 2659,   86, 2650, 2652, 2651, 2658,
-     2660,   86, 2653, 2661,   86, 2663,   86, 2657, 2656,   86,
-       86,   86,   86,   86,   86,   86, 2666, 2670,   86, 2669,
-     2671,   86, 2662,   86, 2665, 2664,   86,   86, 2672, 2673,
-       86,   86, 2667, 2668,   86,   86, 2675, 2674,   86,   86,
-     2679,   86, 2676, 2677,   86, 2684,   86, 2683,   86,   86,
-     2687,   86,   86,   86, 2678,   86, 2690,   86, 2680, 2682,
-
-     2681,   86,   86, 2685, 2688, 2692,   86, 2686, 2693,   86,
-     2689,   86, 2691,   86,   86, 2694, 2698,   86,   86,   86,
-       86, 2695,   86, 2701, 2702,   86, 2699, 2700, 2704,   86,
-       86, 2696,   86, 2697,   86, 2705,   86,   86, 2707, 2703,
-       86, 2706, 2710,   86,   86, 2711, 2708, 2713,   86,   86,
-       86,   86,   86, 2714, 2718,   86, 2709, 2720,   86, 2712,
-     2716, 2717, 2715,   86,   86, 2719,   86,   86, 2721, 2722,
-       86,   86, 2724,   86,   86,   86,   86,   86, 2725,   86,
-     2723, 2730, 2727, 2728, 2731, 2733,   86, 2734,   86, 2729,
-     2726,   86, 2732, 2735,  170,   86,   86,   86, 2736, 2740,
-
-     2737,   86,   86, 2742,   86,   86, 2741,   86, 2745,   86,
-     2746,   86, 2744,   86, 2738, 2739, 2748,   86,   86, 2743,
-       86, 2749, 2750,   86,   86, 2752, 2747, 2751,   86, 2753,
-     2755,   86,   86,   86,   86, 2756,   86, 2754, 2757,   86,
-       86, 2758, 2762,   86, 2763,   86,   86, 2760,   86, 2759,
-       86, 2764, 2766,   86,   86, 2765,   86, 2768, 2767,   86,
-       86, 2761,   86,   86, 2770, 2771,   86,   86, 2769,   86,
-       86, 2776,   86, 2779,   86, 2774, 2773,   86, 2775,   86,
-     2772, 2777,   86, 2780,   86, 2778, 2784,   86,   86,   86,
-       86,   86,   86, 2781,   86, 2785, 2789,   86,   86, 2787,
-
-       86,   86, 2782, 2783, 2793,   86, 2788, 3210, 2786, 2791,
-     2796, 2790, 2794,   86, 2797, 2798,   86,   86, 2792,   86,
-       86,   86, 2799,   86, 2801, 2800, 2795,   86,   86, 2804,
-       86,   86,   86, 2805,   86,   86, 2802,   86, 2806,   86,
-     2809, 2803, 2811,   86,   86, 2807, 3353, 2808, 2812,   86,
-     2813,   86,   86,   86,   86, 2810, 2814,   86, 2815, 2816,
-       86,   86, 2818, 2820, 2817,   86, 2819,   86, 2821,   86,
-       86, 2824,   86, 2822, 2825,   86, 2826,   86,   86,   86,
-     2828, 2827, 2831,   86,   86, 2823,   86, 2832, 2833,   86,
-     2829,   86, 2835,   86,   86,   86, 2839, 2836,   86, 2830,
-
-     2840,   86,   86,   86,   86, 2842, 2834, 2841,   86, 2838,
-     2843,   86, 2837,   86, 2848,   86, 2851,   86,   86, 2847,
-       86, 2844, 2850,   86, 2845,   86,   86,   86, 2846, 2854,
-     2852, 2853,   86,   86, 2857, 2856,   86,   86,   86,   86,
-     2849,   86, 2860, 2864,   86,   86,   86,   86,   86,   86,
-     2866,   86, 2855, 2858, 2859, 2863, 2861, 2870, 2867, 2862,
-     2865, 2871, 2868, 2873, 2869,   86, 2872,   86, 2874,   86,
-     2875, 2876,   86,   86, 2877,   86, 2878,   86, 2879,   86,
-     2880, 2881,   86,   86,   86,   86,   86, 2882,   86,   86,
-     2885,   86,   86, 2887, 2891,   86, 2892,   86, 2888,   86,
-
-       86,   86, 2893, 2883,   86, 2886, 2895,   86, 2896, 2898,
-     2884, 2889, 2890, 2897,   86, 2899,   86,   86, 2894,   86,
-       86,   86, 2904,   86,   86,   86, 2900,   86, 2901, 2902,
-       86, 2905,   86, 2906,   86,   86,   86, 2910, 2914, 2903,
-       86, 2908, 2911,   86, 2907, 2913,   86, 2909, 2912, 2916,
-       86, 2915, 2917,   86, 2918,   86,   86, 2921,   86,   86,
-       86,   86,   86,   86, 2927,   86,   86,   86, 2922, 2944,
-       86, 2925, 2923,   86, 2920,   86,   86, 2928, 2930,   86,
-     2919, 2931, 2961, 2926,   86, 2932, 2924, 2929, 2933,   86,
-       86,   86, 2935,   86, 2934, 2936, 2937,   86, 2938,   86,
-
-     2939,   86, 2940,   86,   86,   86,   86,   86,   86, 2943,
-     2941, 2945, 2946, 2947,   86,   86,   86,   86, 2953,   86,
-     2949, 2951, 2942, 2948,   86, 2955,   86,   86,   86,   86,
-       86, 2956,   86, 2957, 2958, 2952, 2950,   86, 2959,   86,
-     2964,   86,   86,   86, 2954,   86,   86, 2962,   86, 2960,
-     2967,   86,   86,   86, 2968, 2965, 2966,   86, 2972, 2963,
-     2971,   86, 2973,   86, 2969,   86, 2974, 2977,   86,   86,
-     2970, 2979,   86, 2980,   86,   86, 2982,   86,   86,   86,
-       86, 2975,   86, 2987,   86, 2986,   86, 2990, 2978,   86,
-       86, 2976,   86,   86, 2983, 2984, 2981,   86, 2985, 2989,
-
-       86, 2993,   86,   86, 2996,   86, 2988, 2998,   86,   86,
-       86, 2992, 2991,   86, 2999,   86, 2994, 2997, 3001,   86,
-     3002,   86, 2995, 3004,   86,   86,   86, 3009,   86, 3010,
-     3000,   86,   86,   86,   86, 3003, 3006, 3007, 3013,   86,
-       86, 3015,   86, 3005, 3011, 3014, 3008,   86,   86, 3018,
-     3021, 3012, 3019,   86, 3017,   86,   86,   86,   86, 3016,
-     3020, 3024,   86, 3023,   86,   86, 3022, 3027,   86, 3025,
-     3030,   86,   86,   86,   86,   86,   86, 3035,   86,   86,
-       86, 3353,   86,   86, 3026, 3028, 3029, 3031, 3041, 3034,
-     3032, 3038, 3039,   86, 3040,   86, 3037,   86, 3036, 3033,
-
-       86, 3044,   86, 3045,   86, 3043, 3046,   86,   86,   86,
-     3049, 3042,   86, 3051,   86,   86,   86, 3050,   86,   86,
-       86, 3047,   86, 3056, 3057,   86,   86,   86,   86,   86,
-       86, 3063,   86,   86, 3052, 3048, 3064,   86, 3065, 3062,
-     3053, 3054, 3055, 3060,   86,   86, 3059,   86, 3061,   86,
-     3069,   86, 3058, 3066, 3068, 3070,   86,   86,   86, 3073,
-       86, 3072, 3071,   86, 3067,   86, 3076,   86, 3075,   86,
-     3074,   86,   86,   86, 3077,   86,   86, 3080,   86,   86,
-       86, 3082,   86, 3078, 3083, 3081,   86,   86,   86,   86,
-       86, 3079,   86,   86, 3092, 3093, 3095, 3084, 3088, 3085,
-
-     3086, 3353,   86,   86, 3087, 3089, 3090,   86, 3091,   86,
-     3098,   86, 3094, 3097, 3096, 3102, 3099, 3100,   86, 3101,
-       86, 3103,   86,   86,   86, 3106,   86,   86, 3104, 3107,
-       86, 3108, 3109,   86,   86, 3110, 3111, 3114,   86, 3112,
-     3113,   86,   86, 3105,   86, 3118, 3115, 3117,   86,   86,
-       86,   86,   86, 3116, 3123,   86,   86, 3122,   86,   86,
-       86,   86,   86, 3119, 3126, 3125,   86, 3353, 3127,   86,
-     3120, 3121,   86, 3131,   86, 3130, 3128, 3132,   86, 3135,
-     3129, 3124, 3133,   86, 3134,   86, 3138, 3140,   86,   86,
-       86, 3139,   86,   86, 3136,   86,   86, 3137,   86, 3148,
-
-     3144, 3145, 3147,   86, 3142,   86,   86, 3150,   86, 3151,
-       86, 3143, 3149, 3141,   86,   86,   86, 3146, 3154,   86,
-     3153, 3155,   86, 3157,   86, 3156, 3158,   86,   86, 3152,
-     3159,   86, 3160,   86, 3161,   86, 3162,   86, 3163,   86,
-     3164,   86,   86, 3167,   86,   86,   86,   86,   86,   86,
-       86, 3166, 3172,   86, 3165, 3168,   86, 3169,   86, 3176,
-       86,   86, 3175, 3173, 3178,   86,   86, 3170, 3171, 3174,
-       86,   86, 3182, 3180,   86, 3177,   86, 3184, 3185, 3179,
-       86,   86,   86,   86,   86, 3187,   86,   86,   86,   86,
-       86,   86, 3181, 3191, 3183, 3186,   86, 3192,   86, 3190,
-
-     3193, 3188,   86, 3196, 3189, 3194,   86,   86,   86, 3197,
-     3199,   86, 3200,   86, 3202, 3195, 3201,   86,   86,   86,
-     3198,   86, 3205, 3204,   86,   86,   86, 3203,   86, 3209,
-       86, 3207,   86, 3212,   86, 3206, 3208,   86,   86,   86,
-       86, 3211,   86, 3213,   86,   86,   86, 3214,   86, 3219,
-     3221,   86, 3215, 3216, 3218,   86, 3220, 3224,   86,   86,
-     3223,   86, 3225, 3217, 3226, 3227,   86, 3222, 3228, 3229,
-       86, 3231,   86,   86, 3232, 3230, 3233,   86, 3234,   86,
-     3235,   86,   86,   86,   86, 3237,   86,   86, 3238, 3239,
-     3242,   86,   86,   86, 3246,   86,   86,   86, 3245, 3248,
-
-       86, 3236, 3241,   86, 3244, 3243, 3249,   86,   86, 3252,
-       86, 3240,   86,   86, 3255,   86,   86, 3247, 3250,   86,
-     3256,   86,   86, 3259, 3257, 3260,   86, 3251, 3253,   86,
-     3254,   86,   86,   86, 3265,   86, 3261,   86, 3264, 3262,
-     3258, 3266,   86,   86,   86,   86,   86,   86, 3270,   86,
-       86, 3263, 3272,   86,   86, 3277,   86,   86, 3267, 3269,
-     3279,   86, 3278, 3268,   86,   86, 3271, 3274, 3273, 3275,
-       86,   86, 3276, 3283,   86, 3285, 3284,   86, 3286,   86,
-       86,   86,   86, 3281, 3280, 3287,   86, 3288, 3291, 3282,
-       86, 3289, 3292,   86,   86, 3293, 3294,   86, 3290,   86,
-
-       86,   86,   86, 3295,   86, 3300,   86,   86, 3297,   86,
-     3303,   86, 3304,   86,   86,   86,   86,   86,   86, 3296,
-     3302, 3298, 3307, 3299, 3305, 3301,   86, 3306,   86, 3311,
-       86, 3310,   86, 3308,   86, 3309,   86, 3312, 3353, 3313,
-       86, 3315,   86, 3317,   86, 3318,   86,   86, 3322,   86,
-       86, 3319,   86, 3316, 3320, 3321, 3314, 3323,   86,   86,
-     3324, 3325,   86,   86,   86,   86, 3326,   86,   86, 3328,
-     3327,   86, 3329, 3331,   86,   86, 3333,   86,   86, 3337,
-     3334, 3338,   86, 3330, 3332,   86,   86, 3335,   86, 3341,
-     3342,   86,   86, 3344,   86,   86, 3336, 3345,   86, 3343,
-
-       86,   86, 3346,   86, 3339, 3340, 3347,   86, 3348, 3351,
-       86, 3352,   86, 3353, 3353, 3353, 3353, 3353, 3353, 3349,
-     3353, 3353, 3353, 3353, 3353, 3353, 3350,   47,   47,   47,
-       47,   47,   47,   47,   52,   52,   52,   52,   52,   52,
-       52,   57,   57,   57,   57,   57,   57,   57,   63,   63,
-       63,   63,   63,   63,   63,   68,   68,   68,   68,   68,
-       68,   68,   74,   74,   74,   74,   74,   74,   74,   80,
-       80,   80,   80,   80,   80,   80,   89,   89, 3353,   89,
-       89,   89,   89,  160,  160, 3353, 3353, 3353,  160,  160,
-      162,  162, 3353, 3353,  162, 3353,  162,  164, 3353, 3353,
-
-     3353, 3353, 3353,  164,  167,  167, 3353, 3353, 3353,  167,
-      167,  169, 3353, 3353, 3353, 3353, 3353,  169,  171,  171,
-     3353,  171,  171,  171,  171,  174, 3353, 3353, 3353, 3353,
-     3353,  174,  177,  177, 3353, 3353, 3353,  177,  177,   90,
-       90, 3353,   90,   90,   90,   90,   17, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353
+       40,   41,   42,   43,   44,   45,   46,   18,   18,   47,
+       48,   48,   49,   50,   51,   48,   48,   48,   48,   48,
+       48,   48,   48,   52,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       53,   53,   54,   55,   53,   53,   56,   53,   53,   53,
+       53,   53,   53,   57,   53,   53,   53,   53,   53,   53,
+
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       58,   59,   60,   61,   62,   58, 3518,   58,   58,   58,
+       58,   58,   58,   63,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   59,   60,   61,   62,   58,  121,   58,   58,   58,
+       58,   58,   58,   63,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+
+       64,   64,   65,   66,   67,   64,   64,   64,   64,   64,
+       64,   64,   64,   68,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       69,  122,  123,  133,   70,   71,   72,   69,   69,   69,
+       69,   69,   69,   73,   69,   69,   69,   69,   69,   69,
+       69,   69,   74,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,  140,  162,  163,   70,   71,   72,   69,   69,   69,
+       69,   69,   69,   73,   69,   69,   69,   69,   69,   69,
+
+       69,   69,   74,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       75,   76,   77,   78,   79,   75,  170,   75,   75,   75,
+       75,   75,   75,   80,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   76,   77,   78,   79,   75,  177,   75,   75,   75,
+       75,   75,   75,   80,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+
+       81,   81,   82,   83,   84,   81,   81,   81,   81,   81,
+       81,   81,   81,   85,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       86,  180,   88,  183,  184,   86,   89,   86,   86,   86,
+       86,   86,  185,   87,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       90,   89,  186,   89,   89,   90,   89,   90,   90,   90,
+       90,   90,   89,   91,   90,   90,   90,   90,   90,   90,
+
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       86,   98,   86,   86,   88,   86,   92,   93,   89,  100,
+       94,   86,   86,  110,  187,   95,  101,   96,  104,  188,
+      102,   99,  105,  103,   97,  106,  112,  107,  108,  114,
+      189,  117,  129,  111,  118,  190,  130,  115,  109,  124,
+      113,  119,  193,  120,  194,  195,  146,  125,  116,  147,
+      131,  126,  132,  127,  134,  141,  148,  128,  135,  142,
+      149,  150,  136,  151,  201,  152,  202,  155,  137,  143,
+      144,  138,  145,  191,  153,  159,  205,  156,  139,  160,
+
+      154,  157,  158,  161,  164,  164,  192,  199,  200,  164,
+      164,  164,  164,  164,  164,  164,  164,  165,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  206,  207,  166,  166,
+      211,  212,  166,  166,  164,  166,  166,  166,  166,  166,
+      166,  167,  166,  166,  166,  166,  166,  166,  166,  166,
+      166,  166,  166,  166,  166,  166,  166,  166,  166,  166,
+      166,  166,  166,  166,  166,  166,  166,  166,  166,  213,
+      214,  166,  168,  215,  216,  223,  231,  168,  166,  168,
+
+      168,  168,  168,  168,  168,  169,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  168,  168,  168,  168,  168,  168,  168,
+      168,  168,  168,  229,  168,  168,  232,  168,  230,  233,
+      171,  171,  234,  235,  168,  171,  171,  171,  171,  171,
+      171,  171,  171,  172,  171,  171,  171,  171,  171,  171,
+      171,  171,  171,  171,  171,  171,  171,  171,  171,  171,
+      171,  171,  171,  171,  171,  171,  171,  171,  171,  171,
+      171,  171,  236,  237,  173,  238,  239,  240,  241,  173,
+      171,  173,  173,  173,  173,  173,  173,  174,  173,  173,
+
+      173,  173,  173,  173,  173,  173,  173,  173,  173,  173,
+      173,  173,  173,  173,  173,  173,  173,  173,  173,  173,
+      173,  173,  173,  173,  175,  242,  243,  246,  247,  175,
+      248,  175,  175,  175,  175,  175,  175,  176,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  173,  196,  173,  173,  244,  173,
+      178,  197,  245,  198,  252,  178,  173,  178,  178,  178,
+      178,  178,  178,  179,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  253,  178,  178,  254,  178,  258,  259,  181,  181,
+      260,  266,  178,  181,  181,  181,  181,  181,  181,  181,
+      181,  182,  181,  181,  181,  181,  181,  181,  181,  181,
+      181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+      181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+       86,  224,   86,   86,  264,   86,  267,  268,  181,   89,
+      269,   86,   86,  273,   89,  265,   89,   89,   89,   89,
+       89,  225,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   90,
+      203,   90,   90,  221,   90,  208,  209,  249,  270,  217,
+       90,   90,  218,  210,  226,  274,  250,  271,  227,  204,
+      255,  261,  251,  275,  276,  219,  220,  277,  222,  272,
+      278,  256,  279,  170,  228,  257,  164,  164,  262,  166,
+      280,  263,  166,  171,  171,  168,  164,  168,  168,  166,
+      168,  180,  281,  171,  181,  181,  173,  168,  173,  173,
+      284,  173,  175,  285,  181,  286,  289,  175,  173,  175,
+      175,  175,  175,  175,  175,  176,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  290,  175,  175,  178,  175,  178,  178,
+      282,  178,  287,  291,  175,  292,  293,  294,  178,  288,
+      295,  296,  297,  299,  300,  283,  301,  302,  303,  298,
+      306,  311,  312,  304,  313,  307,  314,  315,  316,  317,
+      308,  318,  320,  321,  322,  323,  309,  310,  324,  325,
+      305,  327,  326,  328,  329,  330,  335,  336,  331,  337,
+      332,  338,  339,  340,  342,  343,  344,  345,  347,  348,
+      319,  349,  333,  350,  334,  341,  351,  352,  353,  354,
+      355,  356,  346,  357,  358,  359,  360,  362,  363,  364,
+
+      365,  366,  367,  368,  369,  361,  371,  372,  373,  370,
+      374,  375,  376,  377,  378,  379,  380,  381,  382,  383,
+      384,  385,  386,  387,  388,  389,  390,  391,  392,  394,
+      395,  397,  398,  399,  400,  401,  402,  403,  404,  405,
+      406,  407,  408,  409,  410,  411,  412,  396,  413,  414,
+      415,  416,  393,  417,  418,  419,  420,  421,  422,  423,
+      424,  425,  426,  427,  428,  429,  430,  431,  432,  433,
+      434,  435,  436,  437,  438,  440,  441,  442,  443,  445,
+      446,  447,  448,  449,  450,  451,  452,  453,  454,  455,
+      456,  439,  457,  459,  460,  461,  462,  463,  469,  470,
+
+      464,  471,  472,  444,  473,  465,  466,  467,  468,  458,
+      475,  476,  477,  478,  479,  480,  481,  483,  484,  485,
+      474,  482,  486,  487,  488,  489,  490,  491,  492,  493,
+      494,  495,  496,  497,  498,  499,  500,  501,  502,  503,
+      506,  504,  507,  508,  509,  510,  512,  514,  513,  515,
+      505,  511,  519,  520,  521,  522,  523,  528,  524,  529,
+      534,  537,  516,  535,  525,  517,  538,  518,  526,  539,
+      543,  551,  530,  552,  540,  531,  527,  532,  555,  533,
+      541,  536,  544,  545,  553,  556,  557,  558,  559,  554,
+      542,  560,  546,  561,  547,  548,  549,  562,  563,  550,
+
+      564,  565,  566,  567,  568,  570,  572,  573,  574,  575,
+      576,  577,  578,  579,  569,  580,  581,  582,  583,  584,
+      585,  586,  587,  571,  588,  589,  590,  591,  592,  593,
+      594,  596,  599,  597,  600,  601,  602,  603,  604,  605,
+      613,  614,  615,  616,  617,  608,  618,  595,  598,  619,
+      606,  620,  607,  609,  610,  621,  622,  611,  612,  623,
+      624,  625,  626,  627,  628,  629,  630,  631,  632,  633,
+      634,  635,  636,  637,  639,  640,  641,  642,  643,  644,
+      645,  638,  646,  647,  649,  650,  651,  652,  653,  654,
+      655,  656,  657,  658,  659,  660,  648,  661,  663,  662,
+
+      664,  665,  666,  667,  668,  669,  670,  671,  673,  674,
+      672,  675,  676,  677,  678,  679,  681,  682,  683,  684,
+      685,  686,  687,  688,  689,  690,  691,  692,  700,  701,
+      702,  703,  693,  704,  694,  705,  708,  706,  709,  680,
+      695,  707,  696,  712,  710,  697,  698,  711,  713,  715,
+      716,  717,  699,  718,  719,  720,  721,  722,  723,  714,
+      724,  725,  726,  727,  728,  729,  730,  731,  732,  733,
+      734,  735,  736,  737,  738,  739,  740,  741,  742,  743,
+      744,  745,  746,  747,  748,  749,  750,  751,  752,  753,
+      754,  755,  756,  757,  758,  759,  760,  761,  764,  767,
+
+      765,  768,  769,  770,  762,  766,  771,  763,  772,  773,
+      774,  776,  777,  778,  779,  775,  780,  781,  782,  783,
+      784,  785,  786,  787,  788,  789,  790,  791,  792,  793,
+      794,  795,  796,  797,  798,  799,  800,  801,  805,  806,
+      807,  808,  802,  809,  810,  803,  804,  811,  812,  813,
+      814,  815,  816,  818,  819,  820,  821,  822,  823,  824,
+      825,  826,  827,  828,  829,  830,  831,  832,  833,  834,
+      835,  836,  837,  840,  817,  838,  839,  841,  842,  843,
+      844,  845,  846,  847,  848,  849,  850,  851,  852,  854,
+      855,  856,  859,  853,  860,  861,  862,  863,  864,  865,
+
+      866,  868,  869,  870,  872,  857,  858,  874,  875,  873,
+      876,  877,  878,  871,  879,  867,  880,  881,  882,  883,
+      884,  885,  886,  887,  888,  889,  890,  891,  892,  893,
+      894,  895,  896,  897,  898,  899,  900,  901,  902,  903,
+      904,  905,  906,  907,  908,  909,  910,  911,  912,  913,
+      914,  915,  916,  917,  918,  919,  920,  921,  922,  923,
+      924,  925,  926,  927,  928,  929,  930,  931,  932,  933,
+      934,  935,  936,  937,  938,  939,  940,  941,  943,  944,
+      945,  946,  947,  948,  949,  942,  950,  951,  952,  953,
+      954,  955,  956,  957,  958,  959,  967,  968,  960,  961,
+
+      969,  970,  962,  971,  972,  963,  973,  974,  975,  976,
+      977,  978,  964,  965,  979,  966,  980,  981,  982,  983,
+      989,  984,  990,  991,  985,  992,  993,  994,  996,  986,
+      997,  998,  999, 1000, 1001,  987,  988, 1003, 1004, 1002,
+     1005, 1006, 1007,  995, 1008, 1009, 1010, 1011, 1012, 1013,
+     1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023,
+     1024, 1025, 1026, 1027, 1028, 1029, 1031, 1032, 1033, 1034,
+     1030, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043,
+     1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+     1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
+
+     1064, 1065, 1066, 1067, 1069, 1070, 1071, 1072, 1068, 1073,
+     1074, 1075, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1076,
+     1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+     1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+     1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
+     1114, 1115, 1116, 1117, 1118, 1119, 1121, 1122, 1123, 1124,
+     1125, 1126, 1127, 1120, 1128, 1129, 1130, 1131, 1132, 1133,
+     1134, 1136, 1137, 1138, 1139, 1135, 1140, 1141, 1142, 1143,
+     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1156, 1151, 1157,
+     1158, 1159, 1152, 1160, 1153, 1161, 1162, 1163, 1164, 1154,
+
+     1165, 1166, 1168, 1169, 1155, 1170, 1167, 1171, 1173, 1174,
+     1177, 1178, 1179, 1175, 1180, 1181, 1182, 1183, 1184, 1172,
+     1185, 1186, 1187, 1176, 1188, 1189, 1190, 1191, 1192, 1193,
+     1200, 1201, 1202, 1203, 1194, 1204, 1195, 1205, 1206, 1207,
+     1208, 1209, 1196, 1210, 1211, 1212, 1213, 1197, 1198, 1214,
+     1215, 1216, 1217, 1218, 1199, 1219, 1220, 1221, 1222, 1223,
+     1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
+     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
+     1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
+     1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+
+     1265, 1267, 1268, 1266, 1264, 1269, 1270, 1271, 1272, 1273,
+     1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
+     1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293,
+     1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303,
+     1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313,
+     1314, 1315, 1316, 1317, 1319, 1320, 1321, 1322, 1323, 1324,
+     1325, 1318, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
+     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
+     1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
+     1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
+
+     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+     1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1374, 1385,
+     1375, 1386, 1387, 1376, 1388, 1389, 1390, 1391, 1392, 1393,
+     1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
+     1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413,
+     1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
+     1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433,
+     1435, 1436, 1437, 1438, 1434, 1439, 1446, 1447, 1448, 1440,
+     1449, 1450, 1441, 1442, 1451, 1452, 1453, 1443, 1454, 1455,
+     1456, 1457, 1458, 1444, 1459, 1460, 1461, 1445, 1462, 1463,
+
+     1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473,
+     1478, 1479, 1480, 1483, 1474, 1484, 1475, 1485, 1476, 1486,
+     1477, 1481, 1482, 1487, 1488, 1490, 1491, 1492, 1493, 1489,
+     1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+     1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513,
+     1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523,
+     1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533,
+     1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543,
+     1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553,
+     1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563,
+
+     1564, 1565, 1566, 1567, 1569, 1570, 1571, 1572, 1573, 1568,
+     1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+     1585, 1586, 1587, 1588, 1584, 1589, 1590, 1592, 1594, 1591,
+     1593, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1604,
+     1605, 1606, 1607, 1603, 1608, 1609, 1610, 1611, 1612, 1613,
+     1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623,
+     1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633,
+     1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643,
+     1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653,
+     1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+
+     1664, 1666, 1668, 1669, 1670, 1665, 1667, 1671, 1672, 1673,
+     1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683,
+     1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693,
+     1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703,
+     1706, 1707, 1708, 1704, 1709, 1710, 1711, 1712, 1713, 1714,
+     1715, 1716, 1717, 1718, 1719, 1720, 1705, 1721, 1722, 1723,
+     1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733,
+     1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+     1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753,
+     1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763,
+
+     1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
+     1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783,
+     1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793,
+     1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803,
+     1804, 1805, 1806, 1807, 1810, 1811, 1808, 1812, 1813, 1815,
+     1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1809, 1824,
+     1825, 1826, 1827, 1828, 1814, 1829, 1830, 1831, 1832, 1833,
+     1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843,
+     1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853,
+     1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863,
+
+     1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1874,
+     1875, 1873, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1876,
+     1885, 1886, 1887, 1888, 1877, 1889, 1890, 1891, 1892, 1893,
+     1894, 1896, 1897, 1895, 1898, 1899, 1900, 1901, 1902, 1903,
+     1904, 1906, 1907, 1908, 1909, 1905, 1910, 1911, 1912, 1913,
+     1914, 1916, 1918, 1919, 1917, 1920, 1921, 1922, 1924, 1925,
+     1926, 1927, 1923, 1928, 1915, 1929, 1930, 1931, 1932, 1933,
+     1934, 1935, 1936, 1937, 1938, 1939, 1940, 1942, 1943, 1944,
+     1945, 1946, 1941, 1947, 1948, 1949, 1950, 1951, 1952, 1954,
+     1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964,
+
+     1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974,
+     1953, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983,
+     1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993,
+     1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003,
+     2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+     2014, 2015, 2016, 2017, 2018, 2020, 2021, 2023, 2024, 2025,
+     2026, 2027, 2028, 2022, 2029, 2030, 2031, 2019, 2032, 2033,
+     2035, 2034, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043,
+     2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053,
+     2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+
+     2064, 2066, 2067, 2068, 2069, 2065, 2070, 2071, 2073, 2074,
+     2075, 2076, 2072, 2077, 2078, 2079, 2080, 2081, 2082, 2083,
+     2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093,
+     2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103,
+     2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113,
+     2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123,
+     2124, 2125, 2126, 2127, 2128, 2130, 2131, 2132, 2133, 2134,
+     2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2145,
+     2129, 2146, 2147, 2144, 2148, 2149, 2150, 2151, 2152, 2153,
+     2154, 2155, 2156, 2157, 2158, 2159, 2161, 2163, 2164, 2165,
+
+     2160, 2166, 2168, 2169, 2170, 2171, 2167, 2172, 2173, 2174,
+     2175, 2176, 2177, 2162, 2178, 2179, 2180, 2181, 2182, 2183,
+     2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193,
+     2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203,
+     2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213,
+     2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223,
+     2224, 2225, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234,
+     2235, 2236, 2226, 2237, 2238, 2239, 2240, 2241, 2242, 2243,
+     2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253,
+     2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263,
+
+     2264, 2265, 2267, 2268, 2269, 2270, 2271, 2272, 2273, 2274,
+     2275, 2276, 2277, 2278, 2266, 2279, 2280, 2281, 2282, 2283,
+     2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293,
+     2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2304,
+     2305, 2306, 2307, 2303, 2308, 2309, 2310, 2311, 2312, 2313,
+     2314, 2315, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2316,
+     2324, 2326, 2327, 2325, 2328, 2330, 2331, 2332, 2333, 2329,
+     2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343,
+     2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2355,
+     2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2353, 2364,
+
+     2365, 2354, 2366, 2367, 2368, 2370, 2371, 2373, 2374, 2375,
+     2376, 2372, 2377, 2378, 2369, 2379, 2380, 2383, 2384, 2385,
+     2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395,
+     2381, 2396, 2397, 2398, 2401, 2402, 2403, 2404, 2399, 2400,
+     2405, 2382, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+     2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423,
+     2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433,
+     2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443,
+     2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2453, 2454,
+     2452, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463,
+
+     2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473,
+     2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2484,
+     2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494,
+     2495, 2496, 2497, 2483, 2498, 2499, 2500, 2501, 2502, 2503,
+     2504, 2505, 2506, 2507, 2508, 2509, 2510, 2513, 2514, 2515,
+     2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525,
+     2526, 2511, 2527, 2512, 2528, 2529, 2530, 2531, 2532, 2533,
+     2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543,
+     2544, 2545, 2546, 2547, 2549, 2550, 2551, 2552, 2554, 2553,
+     2555, 2548, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563,
+
+     2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+     2574, 2575, 2576, 2577, 2578, 2580, 2579, 2581, 2582, 2583,
+     2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593,
+     2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603,
+     2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613,
+     2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+     2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633,
+     2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643,
+     2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653,
+     2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663,
+
+     2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673,
+     2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683,
+     2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693,
+     2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703,
+     2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713,
+     2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723,
+     2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733,
+     2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743,
+     2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753,
+     2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763,
+
+     2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773,
+     2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783,
+     2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793,
+     2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803,
+     2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813,
+     2814, 2815, 2816, 2817, 2818, 2819, 2820, 2821, 2822, 2823,
+     2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832, 2833,
+     2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843,
+     2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853,
+     2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863,
+
+     2864, 2865, 2867, 2868, 2869, 2870, 2866, 2871, 2872, 2873,
+     2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883,
+     2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893,
+     2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903,
+     2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913,
+     2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923,
+     2924, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933,
+     2934, 2935, 2936, 2937, 2938, 2939, 2940, 2942, 2943, 2944,
+     2945, 2941, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953,
+     2954, 2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963,
+
+     2964, 2965, 2966, 2968, 2969, 2970, 2971, 2967, 2972, 2973,
+     2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983,
+     2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993,
+     2994, 2995, 2997, 2998, 2999, 3000, 3002, 3004, 3005, 2996,
+     3001, 3003, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013,
+     3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023,
+     3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033,
+     3034, 3035, 3036, 3037, 3038, 3039, 3041, 3042, 3043, 3044,
+     3040, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053,
+     3054, 3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063,
+
+     3064, 3065, 3066, 3067, 3069, 3070, 3068, 3071, 3072, 3073,
+     3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083,
+     3084, 3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093,
+     3094, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103,
+     3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113,
+     3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123,
+     3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133,
+     3134, 3135, 3136, 3137, 3138, 3139, 3140, 3142, 3143, 3144,
+     3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154,
+     3155, 3156, 3157, 3158, 3159, 3160, 3141, 3161, 3162, 3163,
+
+     3164, 3165, 3166, 3167, 3168, 3169, 3170, 3171, 3172, 3173,
+     3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183,
+     3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193,
+     3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203,
+     3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213,
+     3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223,
+     3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233,
+     3234, 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243,
+     3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253,
+     3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263,
+
+     3264, 3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273,
+     3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283,
+     3284, 3285, 3287, 3289, 3286, 3290, 3291, 3288, 3292, 3293,
+     3294, 3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303,
+     3304, 3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312, 3313,
+     3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323,
+     3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332, 3333,
+     3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343,
+     3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353,
+     3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363,
+
+     3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373,
+     3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383,
+     3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393,
+     3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403,
+     3404, 3405, 3406, 3407, 3408, 3409, 3410, 3411, 3412, 3413,
+     3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423,
+     3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433,
+     3434, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442, 3443,
+     3444, 3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 3453,
+     3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463,
+
+     3464, 3465, 3466, 3467, 3468, 3469, 3470, 3472, 3473, 3471,
+     3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483,
+     3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493,
+     3494, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502, 3503,
+     3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513,
+     3514, 3515, 3516, 3517,   17, 3518, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518
+
     } ;
 
-static const flex_int16_t yy_chk[6588] =
+static const flex_int16_t yy_chk[4396] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    5,    5,    6,    6,
-        5,    3,    6,   24,    4,   24,   24,    5,   24,    6,
-        7,    7,    7,    7,   24,    7,    8,    8,    8,    8,
-       33,    8,    7,    9,    9,    9,   26,   26,    8,   10,
-       10,   10,   19,   29,    9,   33,   19,   29, 3361,   35,
-       10,   11,   11,   11,   11,   11,   11,   13,   13,   13,
-
-       13,   34,   13,   11,   35,   99,   34,   29,   38,   13,
-       51,   51,   11,   12,   12,   12,   12,   12,   12,   14,
-       14,   14,   14,   99,   14,   12,   15,   15,   15,   38,
-       23,   14,   23,   23,   12,   23,   46,   15,   16,   16,
-       16,   23,   23,   25,   27,   27,   25,   25, 2735,   16,
-       25,   46,   27,   30,   30,   25,   27,   56,   40,   27,
-       56,   73,   31,   31,   25,   28,   67,   67,   30,   32,
-       28,   31,   40,   32,   28,   73,   32,   28,   92,   28,
-       28,   92,   31,   32, 1099,   32,   36,   36,   37,   37,
-       28,   45,   45,   37,   97,   36,   45,   97,   41,   41,
-
-       45,   36,   87,   41,   93,   36,   87,   37,   93,   37,
-       39,   39,   42,   41,   41,   39,   41,   42,   96,   39,
-       42,   43,   43,  105,   43,   39,   44,   42,   39,  101,
-       44,   42,   42,   43,   94,   39,   84,   84,   96,   43,
-       44,   94,  105,  101,   44,   44,   62,  192,   62,   62,
-       70,   62,   70,   70,   72,   70,   72,   72,   79,   72,
-       79,   79,   70,   79,   86,   95,   86,   86,   89,   86,
-       89,   89,  192,   89,  100,   86,  102,   95,   98,   89,
-       89,   98,  102,  100,  103,  104,  106,  107,  102,  113,
-      102,  109,  106,  113,   98,  108,  111,  140,  114,  112,
-
-      177,  107,  103,  103,  110,  106,  116,  104,  115,  108,
-      119,  109,  140,  115,  111,  110,  110,  112,  114,  117,
-      116,  118,  117,  110,  122,  117,  120,  118,  123,  119,
-      121,  120,  124,  121,  125,  130,  124,  121,  117,  117,
-      127,  125,  123,  122,  126,  128,  118,  127,  122,  129,
-      132,  120,  131,  121,  128,  130,  131,  126,  134,  133,
-      135,  136,  129,  133,  138,  135,  137,  137,  132,  135,
-      139,  141,  142,  144,  139,  256,  134,  256,  146,  150,
-      151,  136,  143,  139,  138,  143,  144,  145,  149,  139,
-      146,  142,  148,  145,  147,  147,  143,  141,  150,  148,
-
-      143,  151,  152,  153,  149,  153,  155,  154,  156,  157,
-      148,  155,  147,  226,  153,  147,  158,  159,  152,  154,
-      156,  158,  161,  161,  179,  163,  153,  157,  163,  179,
-      165,  159,  165,  165,  226,  165,  168,  168,  170,  181,
-      170,  170,  171,  170,  171,  171,  173,  171,  175,  173,
-      175,  175,  180,  175,  171,  178,  178,  181,  180,  182,
-      183,  184,  185,  186,  187,  189,  188,  180,  183,  190,
-      185,  188,  184,  212,  182,  183,  193,  191,  190,  187,
-      176,  193,  186,  191,  191,  189,  194,  194,  195,  197,
-      196,  212,  196,  197,  195,  196,  198,  198,  197,  199,
-
-      200,  201,  202,  197,  203,  204,  201,  202,  205,  197,
-      197,  199,  196,  206,  205,  207,  203,  206,  208,  200,
-      207,  209,  213,  210,  211,  204,  214,  213,  216,  217,
-      551,  214,  218,  216,  208,  209,  211,  205,  210,  211,
-      215,  215,  220,  220,  215,  219,  215,  221,  218,  217,
-      222,  219,  223,  221,  551,  224,  222,  227,  215,  221,
-      215,  224,  225,  227,  228,  229,  230,  231,  225,  228,
-      230,  229,  223,  231,  232,  234,  233,  225,  235,  236,
-      237,  232,  233,  238,  235,  239,  237,  240,  234,  241,
-      245,  243,  242,  239,  241,  244,  238,  246,  248,  236,
-
-      240,  242,  246,  246,  247,  238,  243,  250,  249,  247,
-      245,  244,  249,  251,  252,  253,  248,  254,  255,  251,
-      257,  253,  259,  255,  258,  261,  263,  264,  259,  250,
-      260,  258,  252,  252,  262,  270,  260,  254,  263,  257,
-      262,  264,  265,  265,  261,  266,  266,  267,  268,  269,
-      271,  269,  272,  267,  268,  271,  273,  274,  270,  275,
-      277,  276,  288,  278,  272,  274,  276,  279,  269,  278,
-      283,  267,  280,  279,  282,  273,  281,  280,  284,  275,
-      282,  281,  285,  277,  286,  283,  287,  288,  290,  289,
-      293,  290,  284,  293,  287,  289,  294,  291,  286,  291,
-
-      285,  292,  292,  295,  295,  296,  296,  297,  299,  298,
-      301,  299,  300,  302,  294,  303,  300,  304,  174,  301,
-      305,  303,  302,  297,  298,  306,  305,  306,  307,  308,
-      314,  304,  310,  308,  307,  309,  309,  310,  311,  312,
-      313,  315,  316,  319,  311,  312,  317,  317,  314,  318,
-      308,  321,  318,  320,  322,  316,  324,  320,  323,  323,
-      313,  319,  315,  325,  312,  326,  325,  327,  328,  329,
-      321,  328,  322,  327,  324,  333,  331,  326,  366,  332,
-      333,  329,  336,  325,  330,  331,  334,  335,  337,  334,
-      335,  334,  366,  330,  169,  336,  330,  332,  341,  341,
-
-      337,  330,  330,  330,  330,  339,  338,  334,  338,  338,
-      339,  339,  340,  342,  343,  340,  345,  344,  346,  347,
-      347,  348,  349,  349,  351,  345,  348,  346,  353,  343,
-      342,  350,  350,  342,  344,  344,  352,  354,  355,  351,
-      353,  352,  356,  357,  360,  167,  361,  358,  358,  357,
-      358,  361,  369,  369,  362,  166,  354,  356,  355,  358,
-      362,  363,  364,  394,  360,  365,  363,  364,  365,  367,
-      365,  368,  367,  364,  372,  370,  371,  371,  375,  372,
-      368,  370,  377,  373,  378,  367,  373,  379,  367,  394,
-      367,  376,  373,  382,  376,  384,  373,  377,  375,  378,
-
-      381,  379,  385,  381,  373,  374,  374,  382,  374,  386,
-      384,  385,  376,  388,  386,  386,  387,  389,  390,  381,
-      402,  374,  387,  392,  374,  402,  374,  395,  374,  383,
-      391,  383,  383,  390,  388,  396,  389,  164,  399,  391,
-      393,  383,  392,  383,  383,  383,  393,  395,  383,  396,
-      397,  400,  398,  401,  403,  404,  397,  398,  399,  406,
-      397,  404,  405,  405,  407,  410,  408,  409,  401,  403,
-      411,  400,  412,  409,  414,  398,  407,  412,  417,  406,
-      408,  413,  413,  415,  413,  416,  411,  418,  423,  418,
-      410,  426,  417,  419,  414,  419,  419,  424,  420,  415,
-
-      421,  416,  420,  427,  421,  422,  422,  423,  425,  426,
-      430,  428,  424,  419,  431,  439,  430,  427,  439,  421,
-      428,  429,  432,  431,  425,  433,  429,  432,  434,  433,
-      435,  428,  436,  428,  429,  429,  435,  434,  429,  429,
-      437,  438,  440,  441,  443,  438,  437,  440,  442,  442,
-      444,  444,  446,  436,  445,  447,  447,  443,  448,  445,
-      450,  451,  449,  441,  448,  446,  449,  452,  453,  454,
-      454,  455,  452,  453,  456,  450,  458,  457,  454,  461,
-      464,  459,  451,  455,  459,  460,  462,  462,  458,  460,
-      466,  461,  463,  470,  456,  457,  471,  463,  465,  465,
-
-      472,  464,  468,  468,  471,  473,  474,  475,  476,  472,
-      478,  474,  466,  479,  470,  480,  482,  484,  481,  550,
-      476,  550,  482,  484,  483,  486,  473,  475,  478,  485,
-      478,  479,  481,  483,  485,  480,  487,  488,  489,  486,
-      488,  490,  491,  492,  487,  494,  493,  487,  491,  493,
-      495,  494,  489,  496,  497,  499,  490,  498,  496,  499,
-      500,  502,  501,  492,  495,  500,  502,  503,  504,  494,
-      508,  505,  511,  524,  547,  510,  497,  501,  498,  510,
-      509,  512,  513,  503,  505,  162,  513,  504,  506,  506,
-      508,  511,  547,  524,  506,  509,  506,  512,  515,  517,
-
-      514,  516,  506,  518,  506,  514,  516,  506,  506,  514,
-      519,  520,  518,  515,  506,  517,  519,  521,  517,  522,
-      523,  519,  522,  525,  525,  526,  520,  527,  527,  528,
-      529,  530,  531,  521,  532,  533,  534,  536,  535,  539,
-      533,  537,  529,  523,  528,  534,  530,  537,  539,  540,
-      526,  531,  536,  540,  541,  542,  532,  535,  543,  544,
-      541,  545,  546,  549,  548,  554,  552,  542,  548,  553,
-      553,  554,  555,  543,  552,  545,  549,  546,  544,  556,
-      557,  559,  560,  558,  555,  556,  558,  562,  561,  563,
-      562,  564,  557,  561,  565,  559,  566,  560,  563,  565,
-
-      565,  567,  567,  568,  568,  563,  569,  564,  563,  566,
-      570,  570,  569,  571,  571,  572,  574,  573,  575,  578,
-      577,  572,  573,  573,  576,  577,  579,  576,  580,  582,
-      575,  580,  583,  589,  579,  581,  585,  574,  578,  584,
-      581,  586,  585,  584,  587,  586,  591,  589,  588,  590,
-      590,  583,  582,  588,  592,  593,  594,  595,  596,  598,
-      593,  591,  587,  597,  596,  603,  600,  602,  597,  601,
-      601,  599,  594,  598,  599,  592,  606,  595,  607,  599,
-      610,  603,  599,  599,  600,  602,  604,  605,  609,  610,
-      606,  604,  605,  607,  609,  611,  612,  613,  611,  616,
-
-      612,  614,  613,  615,  614,  617,  618,  619,  615,  620,
-      621,  622,  622,  618,  620,  616,  623,  624,  625,  626,
-      619,  627,  612,  617,  630,  623,  628,  630,  626,  629,
-      621,  634,  628,  627,  625,  629,  624,  631,  631,  632,
-      631,  633,  632,  635,  637,  636,  633,  638,  640,  634,
-      636,  639,  641,  638,  640,  641,  639,  635,  642,  643,
-      644,  645,  646,  637,  643,  644,  644,  647,  650,  649,
-      648,  652,  647,  651,  645,  646,  648,  650,  651,  653,
-      653,  655,  654,  642,  655,  657,  647,  647,  649,  654,
-      656,  652,  661,  658,  663,  659,  656,  657,  658,  655,
-
-      659,  659,  660,  660,  662,  664,  662,  664,  658,  665,
-      666,  667,  668,  663,  669,  670,  671,  661,  673,  676,
-      671,  670,  674,  672,  675,  678,  682,  665,  666,  667,
-      679,  668,  672,  673,  669,  677,  679,  674,  676,  680,
-      678,  683,  675,  681,  684,  682,  685,  677,  684,  686,
-      687,  688,  689,  680,  690,  681,  692,  692,  691,  690,
-      683,  694,  693,  695,  685,  686,  693,  696,  687,  688,
-      688,  689,  691,  697,  698,  694,  699,  700,  696,  698,
-      701,  702,  695,  704,  703,  707,  705,  697,  702,  703,
-      704,  705,  699,  701,  706,  708,  700,  709,  710,  706,
-
-      711,  712,  708,  707,  714,  713,  709,  714,  716,  711,
-      713,  715,  710,  712,  717,  715,  718,  720,  719,  721,
-      721,  725,  716,  717,  722,  722,  723,  723,  727,  724,
-      725,  718,  719,  722,  724,  728,  729,  731,  720,  730,
-      732,  728,  733,  730,  734,  735,  737,  727,  736,  731,
-      734,  738,  739,  735,  742,  736,  729,  745,  748,  754,
-      733,  752,  749,  754,  737,  732,  770,  748,  749,  742,
-      752,  753,  739,  760,  745,  751,  738,  740,  160,  740,
-      758,  751,  740,  755,  755,  770,  740,  753,  759,  740,
-      756,  756,  757,  760,  761,  765,  740,  740,  758,  740,
-
-      761,  767,  759,  757,  762,  762,  762,  763,  762,  764,
-      766,  762,  763,  765,  766,  768,  762,  771,  772,  768,
-       85,  769,  762,  762,  773,  767,  769,  773,  774,  775,
-      764,  777,  771,  774,  774,  768,  775,  776,  776,  778,
-      779,  779,  780,  772,  778,  781,  777,  780,  781,  782,
-      783,  783,  785,  784,  782,  784,  786,  787,  788,  790,
-      789,  787,  791,  791,  785,  792,  795,  790,  793,  794,
-      794,  796,  797,  800,  800,  786,  811,  811,  788,  789,
-      792,  798,  793,  796,  795,  799,  801,  798,  803,  804,
-      799,  801,  801,  803,  797,  804,  805,  808,  806,  807,
-
-      808,  809,  805,  806,  810,  807,  813,  809,  812,  812,
-      814,  815,  810,  816,  813,  817,  815,  819,  818,  822,
-      816,  820,  820,  821,  823,  823,  825,  822,  814,  824,
-      827,  828,  821,  817,  818,  824,  819,  829,  830,  827,
-      828,  831,  834,  830,  832,  825,  833,  832,  835,  836,
-      831,  833,  837,  840,  838,  841,  834,  842,  836,  838,
-      838,  829,  839,  839,  843,  837,  842,  844,  840,  845,
-      848,  848,  845,  835,  841,  847,  849,  847,  850,  851,
-      845,  852,  853,  850,  854,  844,  856,  855,  843,  857,
-      858,  859,  860,  861,  858,  856,  862,  849,  863,  861,
-
-      851,  852,  853,  864,  865,  862,  854,  855,  866,  859,
-      863,  860,  857,  867,  866,  868,  869,  869,  865,  870,
-      868,  871,  864,  872,  873,  874,  875,  867,  876,  877,
-      871,  878,  873,  883,  879,  881,  880,  878,  882,  870,
-      879,  881,  886,  872,  887,  874,  886,  876,  875,  877,
-      880,  884,  882,  883,  885,  888,  889,  884,  890,  894,
-      885,  889,  892,  887,  891,  891,  893,  888,  892,  893,
-      895,  897,  896,  898,  898,  888,  899,  894,  896,  890,
-      900,  901,  902,  895,  903,  900,  901,  901,  903,  904,
-      904,  897,  905,  906,  899,  907,  908,  902,  910,  913,
-
-      907,  914,  911,  915,  917,  917,  918,  921,  919, 1077,
-      918,  923,  913,  906,  905,  908,  911,  920,  920,  924,
-     1077,  914,  910,  919,  915,  916,  923,  922,  916,  926,
-      916,  922,  921,  924,  916,  925,  916,  929,  928,  927,
-      925,  916,  931,  926,  927,  927,  916,  928,  930,  933,
-      932,  929,  930,  934,  935,  932,  936,  931,  934,  937,
-      938,  933,  940,  946,  930,  932,  939,  940,  935,  938,
-      941,  947,  939,  937,  942,  948,  941,  936,  943,  943,
-      942,  944,  945,  952,  950,  946,  944,  951,  945,  953,
-      947,  957,  951,  948,  949,  949,  950,  952,  954,  954,
-
-      949,  953,  949,  956,  955,  957,  958,  959,  949,  955,
-      961,  956,  960,  949,  949,  963,  961,  962,  964,  965,
-      949,  966,  962,  967,  967,  958,  959,  963,  960,  968,
-      969,  971,  973,  968,  975,  965,  964,  971,  972,  966,
-      974,  972,  976,  978,  977,  974,  980,  975,  976,  977,
-      969,  973,  981,  982,  983,  980,  984,  985,  986,  987,
-      983,  981,  978,  986,  988,  984,  989,  994,  990,  982,
-       80,  993,  991,  992,  997, 1000,  985,  993,  988,  987,
-      990,  991,  992,  995,  994,  999,  989, 1001, 1002,  995,
-      997, 1003, 1004, 1005, 1010, 1000, 1006, 1014, 1005,  999,
-
-     1009, 1006, 1002, 1010, 1013, 1009, 1001, 1004, 1012, 1003,
-     1011, 1011, 1014, 1013, 1012, 1015, 1017, 1018, 1023, 1022,
-     1020, 1020, 1018, 1018, 1020, 1024, 1021, 1025, 1015, 1021,
-     1026, 1027, 1017, 1022, 1028, 1029, 1030, 1031, 1023, 1032,
-     1028, 1024, 1030, 1026, 1032, 1025, 1027, 1033, 1035, 1036,
-     1039, 1035, 1031, 1037, 1038, 1029, 1040, 1041, 1037, 1038,
-     1043, 1033, 1041, 1042, 1046, 1040, 1039, 1045, 1042, 1047,
-     1036, 1048, 1043, 1045, 1050, 1047, 1051, 1048, 1049, 1049,
-     1046, 1052, 1054, 1050, 1052, 1053, 1053, 1055, 1056, 1057,
-     1058, 1059, 1057, 1060, 1051, 1066, 1061, 1059, 1067, 1060,
-
-     1054, 1061, 1062, 1058, 1063, 1064, 1055, 1062, 1056, 1063,
-     1068, 1064, 1069, 1066, 1070, 1070, 1068, 1069, 1067, 1071,
-     1072, 1073, 1074, 1075, 1076, 1078, 1075, 1076, 1071, 1072,
-     1078, 1079, 1080, 1081, 1082, 1084, 1083, 1087, 1085, 1073,
-     1082, 1074, 1083, 1085, 1080, 1086, 1086, 1088, 1089, 1079,
-     1084, 1090, 1081, 1091, 1092, 1090, 1087, 1093, 1094, 1096,
-     1089, 1088, 1098, 1092, 1097, 1097, 1100, 1102, 1103, 1101,
-     1106, 1091, 1104, 1103, 1105, 1105, 1093, 1109, 1096, 1102,
-     1100, 1104, 1098, 1094, 1101, 1107, 1108, 1117, 1113, 1110,
-     1106, 1107, 1108, 1109, 1110, 1111, 1112, 1111, 1114, 1115,
-
-     1116, 1112, 1113, 1118, 1115, 1119, 1117, 1120, 1122, 1122,
-     1118, 1123, 1114, 1124, 1125, 1116, 1126, 1127, 1135, 1128,
-     1119, 1134, 1126, 1130, 1128, 1123, 1120, 1130, 1134, 1125,
-     1137, 1124, 1135, 1128, 1138, 1128, 1132, 1127, 1128, 1131,
-     1131, 1132, 1133, 1133, 1136, 1139, 1140, 1136, 1141, 1137,
-     1142, 1140, 1138, 1143, 1139, 1144, 1146, 1145, 1143, 1148,
-     1148, 1149, 1142, 1151, 1155, 1150, 1149, 1141, 1145, 1144,
-     1150, 1152, 1154, 1153, 1156, 1146, 1152, 1153, 1157, 1155,
-     1158, 1154, 1161, 1151, 1159, 1162, 1160, 1163, 1164, 1156,
-     1165, 1167, 1158, 1160, 1161, 1166, 1165, 1157, 1168, 1159,
-
-     1169, 1170, 1171, 1172, 1162, 1173, 1164, 1174, 1163, 1169,
-     1166, 1167, 1175, 1176, 1178, 1172, 1170, 1180, 1168, 1179,
-     1178, 1171, 1181, 1182, 1173, 1183, 1185, 1175, 1187, 1189,
-     1181, 1180, 1174, 1176, 1179, 1184, 1188, 1193, 1185, 1186,
-     1184, 1183, 1189, 1182, 1186, 1186, 1193, 1187, 1190, 1190,
-     1188, 1191, 1191, 1192, 1197, 1194, 1191, 1195, 1195, 1191,
-     1191, 1194, 1196, 1197, 1191, 1198, 1192, 1196, 1199, 1202,
-     1191, 1198, 1200, 1199, 1191, 1201, 1201, 1200, 1203, 1203,
-     1204, 1205, 1206, 1204, 1207, 1204, 1208, 1209, 1210, 1211,
-     1202, 1212, 1209, 1207, 1214,   75, 1218, 1212, 1213, 1214,
-
-     1206, 1205, 1210, 1216, 1213, 1215, 1208, 1211, 1217, 1215,
-     1218, 1221, 1216, 1217, 1219, 1219, 1223, 1216, 1224, 1216,
-     1223, 1216, 1221, 1216, 1220, 1220, 1225, 1220, 1226, 1227,
-     1228, 1229, 1231, 1224, 1227, 1227, 1230, 1226, 1232, 1228,
-     1233, 1230, 1234, 1235, 1225, 1236, 1231, 1232, 1237, 1237,
-     1238, 1236, 1239, 1229, 1241, 1240, 1242, 1235, 1238, 1233,
-     1240, 1234, 1243, 1244, 1245, 1242, 1239, 1246, 1241, 1243,
-     1247, 1247, 1246, 1248, 1249, 1249, 1250, 1252, 1250, 1253,
-     1252, 1244, 1254, 1255, 1253, 1256, 1256, 1257, 1248, 1245,
-     1258, 1258, 1255, 1259, 1259, 1260, 1261, 1262, 1263, 1263,
-
-     1260, 1254, 1264, 1265, 1266, 1267, 1265, 1257, 1270,   74,
-     1267, 1268, 1269, 1272, 1269, 1273, 1272, 1261, 1262, 1275,
-     1268, 1277, 1264, 1274, 1266, 1283, 1270, 1276, 1274, 1277,
-     1273, 1278, 1276, 1275, 1279, 1280, 1278, 1279, 1281, 1281,
-     1280, 1282, 1284, 1283, 1285, 1286, 1282, 1288, 1284, 1289,
-     1291, 1285, 1290, 1288, 1292, 1289, 1291, 1290, 1286, 1293,
-     1294, 1295, 1295, 1292, 1296, 1298, 1299, 1300, 1301, 1302,
-     1303, 1294, 1307, 1305, 1301, 1302, 1303, 1306, 1293, 1305,
-     1298, 1308, 1309, 1313, 1296, 1310, 1299, 1311, 1312, 1312,
-     1300, 1306, 1307, 1314, 1309, 1315, 1318, 1306, 1321, 1310,
-
-     1326, 1308, 1316, 1313, 1323, 1311, 1319, 1316, 1317, 1317,
-     1322, 1319, 1324, 1315, 1326, 1322, 1322, 1321, 1314, 1318,
-     1325, 1324, 1323, 1327, 1328, 1329, 1330, 1331, 1325, 1331,
-     1329, 1332, 1335, 1329, 1334, 1330, 1335, 1336, 1327, 1328,
-     1334, 1337, 1328, 1338, 1339, 1332, 1337, 1337, 1336, 1340,
-     1341, 1342, 1344, 1343, 1345, 1341, 1342, 1346, 1349, 1345,
-     1348, 1350, 1338, 1351, 1351, 1352, 1353, 1340, 1354, 1352,
-     1339, 1343, 1344, 1356, 1348, 1355, 1349, 1346, 1357, 1350,
-     1358, 1355, 1363, 1359, 1353, 1356, 1360, 1354, 1361, 1363,
-     1362, 1364, 1365, 1366, 1358, 1362, 1364, 1357, 1359, 1367,
-
-     1367, 1360, 1366, 1368, 1369, 1370, 1372, 1361, 1371, 1371,
-     1365, 1373, 1372, 1369, 1374, 1375, 1375, 1373, 1368, 1377,
-     1376, 1378, 1379, 1380, 1381, 1370, 1376, 1379, 1374, 1380,
-     1381, 1382, 1383, 1383, 1389, 1377, 1388, 1382, 1384, 1384,
-     1386, 1386, 1378, 1387, 1390, 1388, 1391, 1387, 1392, 1395,
-     1393, 1396, 1389, 1394, 1394, 1399, 1390, 1393, 1398, 1396,
-     1391, 1397, 1400, 1392, 1402, 1401, 1397, 1400, 1400, 1395,
-     1401, 1401, 1398, 1404, 1399, 1403, 1403, 1405, 1406, 1408,
-     1407, 1409, 1410, 1411, 1402, 1407, 1412, 1406, 1413, 1411,
-     1415, 1412, 1404, 1414, 1418, 1423, 1405, 1416, 1408, 1414,
-
-     1410, 1409, 1417, 1416, 1419, 1420, 1421, 1422, 1417, 1415,
-     1427, 1424, 1426, 1418, 1413, 1426, 1423, 1425, 1425, 1428,
-     1429, 1422, 1434, 1419, 1420, 1421, 1424, 1430, 1430, 1427,
-     1431, 1431, 1429, 1433, 1432, 1434, 1435, 1433, 1428, 1432,
-     1436, 1437, 1441, 1437, 1439, 1435, 1440, 1437, 1442, 1443,
-     1448, 1440, 1446, 1436, 1444, 1444, 1445, 1441, 1446, 1447,
-     1437, 1445, 1439, 1448, 1449, 1443, 1450, 1451, 1442, 1449,
-     1450, 1451, 1452, 1453, 1447, 1454, 1455, 1456, 1457, 1457,
-     1459, 1461, 1462, 1456, 1454, 1463, 1463, 1462, 1464, 1465,
-     1469, 1453, 1452, 1469, 1464, 1471, 1455, 1472, 1459, 1467,
-
-     1467, 1475, 1461, 1470, 1470, 1474, 1476, 1478, 1474, 1465,
-     1479, 1471, 1482, 1472, 1480, 1476, 1477, 1477, 1481, 1483,
-     1483, 1475, 1478, 1481, 1485, 1484, 1482, 1487, 1486, 1488,
-     1490, 1479, 1491, 1480, 1484, 1489, 1489, 1495, 1493, 1496,
-     1492, 1495, 1485, 1486, 1490, 1492, 1494, 1494, 1498, 1488,
-     1491, 1499, 1487, 1493, 1497, 1497, 1500, 1501, 1502, 1496,
-     1500, 1505, 1499, 1502, 1504, 1504, 1506, 1507, 1508, 1509,
-     1498, 1510, 1511, 1511, 1512, 1513, 1501, 1505, 1514, 1512,
-     1516, 1507, 1518, 1509, 1506, 1515, 1515, 1508, 1508, 1516,
-     1522, 1519, 1517, 1519, 1520, 1513, 1510, 1517, 1514, 1520,
-
-     1521, 1523, 1518, 1525, 1526, 1526, 1521, 1523, 1527, 1528,
-     1522, 1530, 1531, 1532, 1532, 1528, 1530, 1525, 1533, 1533,
-     1534, 1535, 1536, 1537, 1538, 1538, 1537, 1527, 1539, 1540,
-     1541, 1549, 1543,   68, 1534, 1544, 1531, 1536, 1543, 1535,
-     1544, 1540, 1542, 1547, 1545, 1542, 1539, 1545, 1542, 1548,
-     1541, 1552, 1547, 1553, 1548, 1550, 1549, 1552, 1550, 1553,
-     1542, 1551, 1551, 1545, 1554, 1555, 1555, 1556, 1556, 1554,
-     1557, 1559, 1558, 1560, 1561, 1562, 1557, 1558, 1563, 1564,
-     1565, 1563, 1566, 1567, 1559, 1564, 1565, 1566, 1568, 1567,
-     1572, 1560, 1569, 1561, 1573, 1562, 1571, 1569, 1570, 1570,
-
-     1574, 1571, 1575, 1576, 1577, 1578, 1579, 1582, 1572, 1580,
-     1581, 1568, 1581, 1580, 1573, 1584, 1575, 1576, 1577, 1586,
-     1574, 1585, 1587, 1578, 1588, 1589, 1582, 1584, 1587, 1590,
-     1592, 1579, 1586, 1585, 1591, 1594, 1594, 1595, 1596, 1599,
-     1597, 1589, 1600, 1596, 1588, 1598, 1598, 1601, 1591, 1590,
-     1602, 1592, 1597, 1603, 1599, 1604, 1600, 1595, 1605, 1607,
-     1606, 1609, 1603, 1611, 1612, 1605, 1616, 1612, 1602, 1606,
-     1604, 1601, 1606, 1613, 1613, 1607, 1609, 1614, 1614, 1615,
-     1617, 1609, 1619, 1617, 1616, 1618, 1618, 1620, 1611, 1621,
-     1623, 1615, 1622, 1625, 1621, 1619, 1624, 1622, 1626, 1627,
-
-     1631, 1628, 1625, 1630, 1630, 1632, 1620, 1629, 1627, 1623,
-     1628, 1627, 1624, 1629, 1633, 1634, 1636, 1626, 1632, 1635,
-     1631, 1636, 1636, 1637, 1638, 1641, 1642, 1644, 1637, 1634,
-     1643, 1643, 1633, 1645, 1646, 1635, 1638, 1647, 1647, 1646,
-     1650, 1649, 1645, 1644, 1642, 1648, 1649, 1651, 1652, 1655,
-     1641, 1657, 1647, 1664, 1648, 1653, 1656, 1648, 1650, 1658,
-     1653, 1653, 1660, 1655, 1658, 1663, 1652, 1664, 1651, 1659,
-     1663, 1656, 1662, 1657, 1668, 1659, 1661, 1661, 1662, 1665,
-     1660, 1666, 1669, 1670, 1671, 1665, 1673, 1666, 1677, 1670,
-     1672, 1678, 1673, 1672, 1668, 1675, 1669, 1671, 1679, 1672,
-
-     1680, 1681, 1682, 1675, 1683, 1684, 1679, 1677, 1688, 1680,
-     1678, 1685, 1685, 1691, 1681, 1682, 1686, 1687, 1683, 1684,
-     1690, 1688, 1686, 1687, 1689, 1689, 1692, 1693, 1693, 1694,
-     1695, 1691, 1696, 1685, 1697, 1698, 1695, 1700, 1700, 1701,
-     1690, 1703, 1694, 1702, 1704, 1692, 1703, 1702, 1706, 1704,
-     1697, 1705, 1707, 1698, 1696, 1709, 1705, 1706, 1710, 1701,
-     1711, 1711, 1712, 1714, 1713, 1715, 1715, 1709, 1718, 1716,
-     1717, 1721, 1719, 1710, 1722, 1707, 1713, 1717, 1725, 1723,
-     1718, 1712, 1714, 1716, 1719, 1723, 1724, 1726, 1727, 1727,
-     1721,   63, 1728, 1726, 1722, 1728, 1725, 1731, 1724, 1729,
-
-     1729, 1732, 1731, 1733, 1734, 1734, 1735, 1738, 1739, 1733,
-     1732, 1736, 1737, 1736, 1740, 1737, 1741, 1742, 1735, 1743,
-     1744, 1745, 1742, 1746, 1743, 1749, 1747, 1738, 1748, 1744,
-     1739, 1747, 1740, 1745, 1741, 1750, 1751, 1748, 1746, 1752,
-     1750, 1751, 1753, 1753, 1755, 1749, 1754, 1750, 1757, 1758,
-     1748, 1760, 1754, 1759, 1752, 1761, 1762, 1761, 1763, 1763,
-     1764, 1764, 1765, 1765, 1766, 1755, 1769, 1757, 1758, 1759,
-     1762, 1760, 1762, 1767, 1767, 1768, 1768, 1770, 1771, 1771,
-     1773, 1772, 1777, 1776, 1766, 1772, 1773, 1769, 1774, 1776,
-     1778, 1774, 1779, 1782, 1780, 1785, 1778, 1780, 1770, 1783,
-
-     1777, 1781, 1781, 1786, 1783, 1784, 1784, 1787, 1788, 1788,
-     1785, 1789, 1787, 1782, 1790, 1791, 1789, 1779, 1792, 1793,
-     1790, 1794, 1796,   58, 1786, 1795, 1799, 1791, 1791, 1791,
-     1798, 1795, 1800, 1802, 1791, 1798, 1798, 1793, 1792, 1803,
-     1799, 1794, 1796, 1801, 1802, 1801, 1804, 1800, 1805, 1806,
-     1807, 1809, 1804, 1811, 1803, 1808, 1808, 1805, 1810, 1810,
-     1812, 1813, 1813, 1814, 1814, 1815, 1818, 1818, 1819, 1806,
-     1820, 1807, 1822, 1811, 1823, 1825, 1825, 1809, 1824, 1820,
-     1826, 1822, 1812, 1827, 1824, 1815, 1830, 1828, 1829, 1831,
-     1831, 1832, 1833, 1819, 1828, 1823, 1836, 1829, 1827, 1835,
-
-     1837, 1826, 1836, 1838, 1835, 1839, 1842, 1840, 1833, 1840,
-     1838, 1839, 1830, 1843, 1844, 1844, 1845, 1832, 1846, 1843,
-     1837, 1845, 1847, 1849, 1848, 1842, 1850, 1846, 1851, 1850,
-     1852, 1853, 1853, 1854, 1855, 1849, 1857, 1856, 1860, 1854,
-     1855, 1858, 1847, 1848, 1861, 1858, 1851, 1862, 1863, 1863,
-     1864, 1857, 1862, 1865, 1867, 1868, 1852, 1856, 1860, 1868,
-     1876, 1858, 1869, 1869, 1870, 1871, 1861, 1874, 1865, 1864,
-     1870, 1872, 1872, 1867, 1871, 1873, 1875, 1875, 1874, 1873,
-     1877, 1876, 1878, 1874, 1879, 1880, 1881, 1882, 1883, 1879,
-     1884, 1885, 1885, 1882, 1877, 1884, 1886, 1886, 1887, 1889,
-
-     1890, 1878, 1887, 1883, 1891, 1880, 1881, 1899, 1889, 1892,
-     1892, 1890, 1894, 1894, 1895, 1896, 1890, 1898, 1901, 1895,
-     1895, 1896, 1900, 1898, 1891, 1902, 1904, 1900, 1905, 1906,
-     1901, 1902, 1905, 1899, 1907, 1909, 1908, 1910, 1904, 1911,
-     1912, 1906, 1908, 1910, 1911, 1915, 1914, 1918, 1916, 1922,
-     1918, 1925, 1912, 1916, 1919, 1919, 1925, 1909, 1914, 1907,
-     1920, 1920, 1921, 1921, 1915, 1923, 1924, 1926, 1927, 1922,
-     1929, 1923, 1924, 1926, 1932, 1929, 1931, 1927, 1935, 1931,
-     1933, 1933, 1936, 1937, 1938, 1938, 1932, 1939, 1937, 1944,
-     1935, 1947, 1940, 1941, 1936, 1945, 1939, 1940, 1941, 1942,
-
-     1943, 1943, 1942, 1946, 1945, 1951, 1950, 1948, 1949, 1944,
-     1947, 1948, 1950, 1949, 1953, 1952, 1954, 1956, 1956, 1957,
-     1959, 1946, 1958, 1951, 1952, 1960, 1960, 1961, 1963, 1956,
-     1954, 1958, 1953, 1962, 1964, 1965, 1961, 1957, 1971, 1964,
-     1959, 1968, 1968, 1970, 1972, 1962, 1970, 1974, 1965, 1963,
-     1975, 1976, 1977, 1986, 1971, 1978, 1978, 1976,   57, 1979,
-     1972, 1979, 1974, 1981, 1975, 1980, 1980, 1983, 1983, 1977,
-     1989, 1981, 1984, 1984, 1987, 1988, 1986, 1989, 1990, 1991,
-     1987, 1988, 1992, 1992, 1993, 1994, 1995, 1997, 1999, 1996,
-     2000, 1998, 2003, 1993, 2004, 2005, 2006, 2006, 1995, 1991,
-
-     1990, 1996, 1997, 1998, 2001, 2000, 1994, 2005, 2007, 2008,
-     2001, 2011, 2003, 2009, 1999, 2010, 2009, 2004, 2015, 2013,
-     2010, 2021,   52, 2001, 2013, 2014, 2007, 2014, 2016, 2008,
-     2017, 2011, 2019, 2016, 2022, 2023, 2015, 2017, 2024, 2021,
-     2024, 2019, 2025, 2022, 2027, 2028, 2027, 2023, 2029, 2029,
-     2030, 2031, 2032, 2033, 2032, 2034, 2031, 2035, 2033, 2028,
-     2034, 2025, 2036, 2037, 2039, 2038, 2040, 2041, 2044, 2037,
-     2038, 2042, 2041, 2041, 2045, 2035, 2030, 2039, 2040, 2042,
-     2046, 2046, 2036, 2047, 2047, 2048, 2049, 2044, 2045, 2050,
-     2052, 2051, 2052, 2053, 2054, 2050, 2051, 2055, 2055,   47,
-
-     2048, 2056, 2054, 2057, 2057, 2059, 2049, 2058, 2058, 2061,
-     2054, 2053, 2060, 2056, 2059, 2065, 2063, 2060, 2064, 2067,
-     2064, 2069, 2071, 2068, 2066, 2063, 2075, 2061, 2063, 2066,
-     2066, 2067, 2068, 2069, 2071, 2072, 2065, 2073, 2076, 2075,
-     2072, 2077, 2073, 2078, 2078, 2079, 2080, 2082, 2085, 2081,
-     2077, 2083, 2087, 2099, 2088, 2086, 2096, 2089, 2076, 2088,
-     2085, 2082, 2089, 2079, 2080, 2081, 2083, 2086, 2090, 2093,
-     2095, 2097, 2087, 2098, 2100, 2093, 2095, 2090, 2099, 2096,
-     2101, 2101, 2104, 2100, 2102, 2107, 2097, 2108, 2093, 2103,
-     2103, 2098, 2105, 2102, 2106,   18, 2105, 2109, 2107, 2106,
-
-     2110, 2104, 2109, 2109, 2111, 2112, 2110, 2113, 2112, 2108,
-     2111, 2114, 2117, 2117, 2119, 2113, 2122, 2118, 2118, 2120,
-     2120, 2121, 2121, 2119, 2123, 2125,   17, 2124, 2122, 2132,
-     2125, 2114, 2118, 2124, 2126, 2126, 2127, 2127, 2134, 2128,
-     2129, 2131, 2123, 2118, 2128, 2131, 2129, 2133, 2136, 2132,
-     2137, 2133, 2138, 2139, 2140, 2137, 2141, 2143, 2134, 2140,
-     2142, 2144, 2145, 2146, 2146, 2147, 2144, 2148, 2139, 2147,
-     2150, 2151, 2155, 2136, 2141, 2138, 2142, 2143, 2149, 2152,
-     2153, 2154, 2148, 2149, 2145, 2155, 2154, 2156, 2160, 2151,
-     2159, 2152, 2157, 2157, 2161, 2162, 2150, 2163, 2159, 2153,
-
-     2164, 2165, 2166, 2167, 2171, 2156, 2172, 2160, 2169, 2173,
-     2174, 2176, 2174, 2161, 2166, 2173, 2176, 2171, 2162, 2164,
-     2172, 2163, 2165, 2169, 2167, 2175, 2175, 2177, 2178, 2179,
-     2177, 2180, 2181, 2181, 2182, 2182, 2183, 2185, 2183, 2184,
-     2184, 2178, 2186, 2179, 2180, 2187, 2187, 2188, 2189, 2189,
-     2190, 2190, 2185, 2191, 2194, 2186, 2188, 2193, 2191, 2188,
-     2195, 2196, 2193, 2197, 2197, 2198, 2198, 2199, 2200, 2200,
-     2201, 2202, 2202, 2196, 2194, 2203, 2204, 2205, 2205, 2207,
-     2195, 2204, 2206, 2206, 2209, 2208, 2199, 2210, 2201, 2214,
-     2203, 2212, 2216, 2207, 2208,    0, 2212, 2217, 2209, 2213,
-
-     2213, 2215, 2215, 2217, 2218, 2221, 2210, 2218, 2214, 2226,
-     2216, 2219, 2219, 2220, 2220, 2222, 2223, 2225, 2223, 2227,
-     2227, 2229, 2230, 2231, 2221, 2232, 2240, 2219, 2226, 2232,
-     2222, 2234, 2225, 2233, 2233, 2235, 2236, 2237, 2231, 2242,
-     2235, 2229, 2239, 2239, 2243, 2230, 2240, 2241, 2244, 2245,
-     2234, 2236, 2237, 2242, 2241, 2246, 2246, 2248, 2247, 2248,
-     2249, 2252, 2243, 2249, 2251, 2255, 2244, 2247, 2256, 2253,
-     2251, 2254, 2257, 2252, 2253, 2245, 2254, 2258, 2249, 2259,
-     2249, 2256, 2258, 2261, 2262, 2263, 2264, 2265, 2261, 2262,
-     2255, 2266, 2264, 2257, 2267, 2269, 2268, 2266, 2270, 2267,
-
-     2263, 2268, 2281, 2271, 2272, 2259, 2271, 2273, 2265, 2274,
-     2275, 2270, 2276, 2272,    0, 2277, 2273, 2278, 2274, 2275,
-     2269, 2277, 2281, 2278, 2279, 2283, 2276, 2285, 2279, 2284,
-     2284, 2286, 2286, 2285, 2283, 2288, 2287, 2290, 2291, 2294,
-     2286, 2287, 2292, 2292, 2293, 2297, 2296, 2298, 2294, 2301,
-     2303, 2299, 2301, 2290, 2291, 2288, 2304, 2288, 2296, 2293,
-     2302, 2297, 2298, 2299, 2310, 2302, 2305, 2305, 2304, 2310,
-     2303, 2306, 2306, 2308, 2308, 2309, 2311, 2312, 2309, 2313,
-     2314, 2314, 2311, 2312, 2315, 2316, 2316, 2317, 2313, 2318,
-     2319, 2320, 2320, 2322, 2321, 2329, 2323,    0, 2315, 2317,
-
-     2321, 2323, 2325, 2318, 2329, 2326, 2325, 2322, 2326, 2319,
-     2327, 2327, 2328, 2330, 2331, 2332, 2334, 2328, 2336, 2332,
-     2333, 2333, 2330, 2336, 2337, 2338, 2339, 2340, 2341, 2334,
-     2342, 2340, 2343, 2344, 2331, 2342, 2345, 2346, 2343, 2344,
-     2339, 2347, 2348, 2349, 2337, 2338, 2351, 2348, 2341, 2352,
-     2353, 2354, 2363, 2355, 2345, 2353, 2346, 2354, 2351, 2360,
-     2347, 2355, 2358, 2367, 2349, 2352, 2356, 2367, 2356, 2361,
-     2361, 2358, 2362, 2360, 2368, 2362, 2364, 2364, 2363, 2369,
-     2368, 2370, 2370, 2371, 2374, 2374, 2376, 2378, 2382, 2379,
-     2383, 2369, 2371, 2382, 2384, 2385, 2386, 2386, 2392, 2384,
-
-     2385, 2378, 2388, 2388, 2376, 2379, 2390, 2391, 2391, 2393,
-     2394, 2396, 2390, 2398, 2392, 2394, 2383, 2397, 2400, 2400,
-     2397, 2399, 2403, 2402, 2404, 2398, 2405, 2409, 2403, 2410,
-     2396, 2393, 2402, 2399, 2407, 2407, 2408, 2412, 2412, 2408,
-     2414, 2405, 2404, 2413, 2413, 2414, 2409, 2410, 2415, 2416,
-     2417, 2418, 2421, 2418, 2419, 2417, 2420, 2422, 2416, 2423,
-     2424, 2489, 2422, 2489, 2421,    0, 2415, 2425, 2419, 2431,
-     2420, 2430, 2425, 2426, 2426, 2427, 2427, 2428, 2428, 2423,
-     2424, 2429, 2429, 2430, 2432, 2433, 2433, 2431, 2435, 2432,
-     2434, 2434, 2436, 2437, 2438, 2439, 2439, 2440, 2441, 2441,
-
-     2435, 2442, 2442, 2443, 2436, 2444, 2446, 2447, 2445, 2449,
-     2438, 2450, 2453, 2437, 2443, 2445, 2440, 2444, 2446, 2448,
-     2451, 2451, 2454, 2452, 2448, 2456, 2455, 2447, 2458, 2449,
-     2457, 2450, 2452, 2459, 2459, 2461, 2460, 2462, 2453, 2455,
-     2458, 2464, 2454, 2465, 2457, 2460, 2466, 2468, 2467, 2456,
-     2461, 2467, 2462, 2469,    0, 2470, 2471, 2471, 2469, 2464,
-     2470, 2468, 2472, 2472, 2478, 2465, 2473, 2473, 2479, 2466,
-     2475, 2475, 2477, 2477, 2480, 2481, 2483, 2484, 2485, 2479,
-     2487, 2486, 2478, 2488, 2490, 2493, 2493, 2491, 2492, 2487,
-     2481, 2495, 2495, 2480, 2496, 2484, 2483, 2497, 2498, 2503,
-
-     2485, 2486, 2501, 2488, 2490, 2491, 2492, 2498, 2496, 2499,
-     2499, 2501, 2502, 2502, 2504, 2505, 2506, 2503, 2507, 2497,
-     2508, 2509, 2505, 2510, 2511, 2511, 2512, 2512, 2513, 2514,
-     2520, 2506, 2504, 2515, 2516, 2516, 2507, 2509, 2508, 2515,
-     2517, 2517, 2510, 2518, 2519, 2520, 2521, 2514, 2513, 2518,
-     2522, 2523, 2524, 2525, 2526, 2527, 2523, 2527, 2532, 2526,
-     2528, 2528, 2519, 2535, 2522, 2521, 2529, 2534, 2529, 2530,
-     2530, 2536, 2524, 2525, 2537, 2538, 2534, 2532, 2539, 2543,
-     2538, 2540, 2535, 2536, 2544, 2545, 2545, 2544, 2546, 2547,
-     2548, 2548, 2551, 2549, 2537, 2550, 2551, 2553, 2539, 2543,
-
-     2540, 2554, 2556, 2546, 2549, 2554, 2558, 2547, 2555, 2555,
-     2550, 2559, 2553, 2560, 2563, 2556, 2561, 2561, 2564, 2565,
-     2567, 2558, 2571, 2565, 2566, 2566, 2563, 2564, 2568, 2568,
-     2569, 2559, 2570, 2560, 2572, 2569, 2573, 2580, 2571, 2567,
-     2582, 2570, 2574, 2574, 2579, 2579, 2572, 2581, 2581, 2583,
-     2587, 2584, 2585, 2582, 2586, 2586, 2573, 2589, 2589, 2580,
-     2584, 2585, 2583, 2592, 2593, 2587, 2594, 2595, 2592, 2593,
-     2596, 2597, 2595, 2598, 2601, 2599, 2602, 2604, 2596, 2603,
-     2594, 2602, 2598, 2599, 2603, 2605, 2605, 2606, 2606, 2601,
-     2597, 2608, 2604, 2607, 2607, 2609, 2610, 2611, 2608, 2612,
-
-     2609, 2613, 2614, 2614, 2615, 2612, 2613, 2616, 2617, 2617,
-     2618, 2618, 2616, 2621, 2610, 2611, 2622, 2622, 2623, 2615,
-     2625, 2623, 2624, 2627, 2626, 2625, 2621, 2624, 2624, 2626,
-     2628, 2629, 2631, 2630, 2632, 2629, 2628, 2627, 2630, 2633,
-     2634, 2631, 2635, 2638, 2636, 2640, 2637, 2633, 2635, 2632,
-     2636, 2637, 2640, 2641, 2642, 2638, 2644, 2642, 2641, 2646,
-     2647, 2634, 2648, 2649, 2646, 2647, 2650, 2656, 2644, 2651,
-     2652, 2652, 2653, 2657, 2661, 2650, 2649, 2658, 2651, 2657,
-     2648, 2653, 2662, 2658, 2663, 2656, 2664, 2664, 2665, 2666,
-     2667, 2668, 2670, 2661, 2672, 2665, 2669, 2669, 2674, 2667,
-
-     2675, 2677, 2662, 2663, 2675, 3182, 2668, 3182, 2666, 2672,
-     2678, 2670, 2676, 2676, 2679, 2680, 2678, 2682, 2674, 2683,
-     2679, 2680, 2681, 2681, 2683, 2682, 2677, 2685, 2686, 2688,
-     2689, 2691, 2692, 2689, 2690, 2688, 2685, 2695, 2690, 2694,
-     2694, 2686, 2696, 2696, 2705, 2691,    0, 2692, 2697, 2697,
-     2699, 2699, 2700, 2701, 2707, 2695, 2700, 2706, 2701, 2703,
-     2703, 2709, 2706, 2708, 2705, 2711, 2707, 2717, 2708, 2708,
-     2712, 2712, 2719, 2709, 2714, 2714, 2715, 2715, 2716, 2721,
-     2717, 2716, 2722, 2722, 2727, 2711, 2723, 2723, 2724, 2724,
-     2719, 2725, 2726, 2726, 2728, 2729, 2730, 2727, 2737, 2721,
-
-     2731, 2731, 2730, 2732, 2738, 2736, 2725, 2732, 2739, 2729,
-     2736, 2736, 2728, 2740, 2741, 2742, 2744, 2744, 2743, 2740,
-     2741, 2737, 2743, 2749, 2738, 2747, 2750, 2752, 2739, 2750,
-     2747, 2749, 2753, 2754, 2754, 2753, 2755, 2756, 2757, 2758,
-     2742, 2759, 2756, 2760, 2760, 2764, 2761, 2762, 2763, 2765,
-     2762, 2768, 2752, 2755, 2755, 2759, 2757, 2765, 2762, 2758,
-     2761, 2766, 2763, 2767, 2764, 2774, 2766, 2766, 2767, 2767,
-     2768, 2769, 2769, 2770, 2770, 2771, 2771, 2772, 2772, 2773,
-     2773, 2774, 2775, 2776, 2777, 2778, 2779, 2775, 2780, 2781,
-     2778, 2782, 2783, 2780, 2785, 2785, 2786, 2786, 2781, 2787,
-
-     2788, 2791, 2787, 2776, 2793, 2779, 2790, 2790, 2791, 2793,
-     2777, 2782, 2783, 2792, 2792, 2795, 2795, 2796, 2788, 2797,
-     2798, 2800, 2801, 2801, 2803, 2804, 2796, 2802, 2797, 2798,
-     2805, 2802, 2806, 2803, 2810, 2808, 2809, 2807, 2810, 2800,
-     2818, 2805, 2807, 2807, 2804, 2809, 2814, 2806, 2808, 2815,
-     2815, 2814, 2817, 2817, 2818, 2819, 2820, 2822, 2822, 2823,
-     2824, 2827, 2828, 2829, 2830, 2832, 2834, 2870, 2823, 2852,
-     2830, 2828, 2824, 2836, 2820, 2852, 2837, 2832, 2836, 2839,
-     2819, 2837, 2870, 2829, 2838, 2838, 2827, 2834, 2839, 2841,
-     2848, 2842, 2842, 2847, 2841, 2842, 2844, 2844, 2845, 2845,
-
-     2846, 2846, 2847, 2849, 2850, 2856, 2853, 2854, 2857, 2850,
-     2848, 2853, 2854, 2855, 2855, 2858, 2859, 2860, 2861, 2862,
-     2857, 2859, 2849, 2856, 2861, 2863, 2863, 2865, 2866, 2867,
-     2869, 2865, 2871, 2866, 2867, 2860, 2858, 2868, 2868, 2873,
-     2875, 2875, 2877, 2878, 2862, 2880, 2879, 2871, 2881, 2869,
-     2879, 2882, 2883, 2884, 2880, 2877, 2878, 2886, 2884, 2873,
-     2883, 2885, 2885, 2887, 2881, 2888, 2886, 2889, 2889, 2890,
-     2882, 2893, 2893, 2894, 2894, 2896, 2898, 2898, 2900, 2901,
-     2903, 2887, 2902, 2905, 2905, 2903, 2906, 2908, 2890, 2909,
-     2907, 2888, 2910, 2908, 2900, 2901, 2896, 2918, 2902, 2907,
-
-     2912, 2912, 2913, 2914, 2915, 2915, 2906, 2919, 2922, 2920,
-     2931, 2910, 2909, 2919, 2920, 2925, 2913, 2918, 2923, 2923,
-     2924, 2924, 2914, 2926, 2926, 2927, 2929, 2930, 2928, 2931,
-     2922, 2933, 2932, 2930, 2941, 2925, 2927, 2928, 2934, 2934,
-     2936, 2936, 2935, 2926, 2932, 2935, 2929, 2940, 2946, 2942,
-     2945, 2933, 2943, 2943, 2941, 2942, 2945, 2944, 2948, 2940,
-     2944, 2949, 2949, 2948, 2950, 2951, 2946, 2952, 2953, 2950,
-     2954, 2954, 2957, 2952, 2958, 2956, 2959, 2960, 2960, 2961,
-     2962,    0, 2963, 2967, 2951, 2953, 2953, 2956, 2967, 2959,
-     2957, 2963, 2965, 2965, 2966, 2966, 2962, 2968, 2961, 2958,
-
-     2969, 2970, 2970, 2971, 2971, 2969, 2972, 2972, 2973, 2974,
-     2975, 2968, 2976, 2978, 2978, 2981, 2975, 2976, 2983, 2984,
-     2985, 2973, 2986, 2986, 2988, 2988, 2989, 2990, 2992, 2991,
-     2993, 2994, 2994, 2998, 2981, 2974, 2995, 2995, 2997, 2993,
-     2983, 2984, 2985, 2991, 2997, 2999, 2990, 3007, 2992, 3000,
-     3003, 3003, 2989, 2998, 3000, 3005, 3005, 3006, 3009, 3008,
-     3010, 3007, 3006, 3014, 2999, 3008, 3011, 3011, 3010, 3012,
-     3009, 3015, 3016, 3017, 3012, 3018, 3020, 3016, 3021, 3022,
-     3023, 3018, 3026, 3014, 3020, 3017, 3025, 3028, 3027, 3029,
-     3031, 3015, 3032, 3036, 3029, 3031, 3033, 3021, 3026, 3022,
-
-     3023,    0, 3033, 3038, 3025, 3027, 3027, 3037, 3028, 3034,
-     3037, 3043, 3032, 3036, 3034, 3043, 3038, 3041, 3041, 3042,
-     3042, 3047, 3047, 3048, 3049, 3050, 3050, 3061, 3048, 3052,
-     3052, 3053, 3053, 3056, 3053, 3054, 3054, 3056, 3054, 3055,
-     3055, 3058, 3055, 3049, 3059, 3061, 3058, 3060, 3060, 3062,
-     3065, 3066, 3067, 3059, 3068, 3068, 3071, 3067, 3072, 3074,
-     3073, 3075, 3077, 3062, 3073, 3072, 3078,    0, 3074, 3082,
-     3065, 3066, 3079, 3079, 3083, 3078, 3075, 3080, 3080, 3083,
-     3077, 3071, 3081, 3081, 3082, 3084, 3085, 3086, 3087, 3088,
-     3089, 3085, 3085, 3086, 3084, 3090, 3091, 3084, 3092, 3094,
-
-     3090, 3091, 3093, 3093, 3088, 3094, 3095, 3096, 3096, 3097,
-     3097, 3089, 3095, 3087, 3098, 3099, 3105, 3092, 3102, 3102,
-     3099, 3104, 3104, 3108, 3108, 3105, 3109, 3109, 3116, 3098,
-     3110, 3110, 3111, 3111, 3112, 3112, 3113, 3113, 3114, 3114,
-     3115, 3115, 3118, 3119, 3119, 3121, 3120, 3122, 3126, 3124,
-     3128, 3118, 3125, 3125, 3116, 3120, 3127, 3121, 3129, 3129,
-     3130, 3134, 3128, 3126, 3131, 3131, 3136, 3122, 3124, 3127,
-     3135, 3137, 3137, 3135, 3140, 3130, 3138, 3140, 3141, 3134,
-     3143, 3142, 3144, 3146, 3141, 3143, 3145, 3148, 3149, 3156,
-     3153, 3173, 3136, 3148, 3138, 3142, 3152, 3149, 3165, 3146,
-
-     3152, 3144, 3176, 3165, 3145, 3153, 3166, 3168, 3179, 3166,
-     3169, 3169, 3170, 3170, 3173, 3156, 3171, 3171, 3174, 3175,
-     3168, 3177, 3176, 3175, 3181, 3180, 3183, 3174, 3186, 3181,
-     3185, 3179, 3184, 3184, 3187, 3177, 3180, 3188, 3189, 3190,
-     3191, 3183, 3197, 3185, 3192, 3193, 3194, 3186, 3203, 3191,
-     3193, 3202, 3187, 3188, 3190, 3195, 3192, 3196, 3196, 3198,
-     3195, 3210, 3197, 3189, 3198, 3202, 3205, 3194, 3203, 3204,
-     3204, 3206, 3206, 3207, 3207, 3205, 3208, 3208, 3209, 3209,
-     3210, 3211, 3212, 3213, 3214, 3212, 3215, 3216, 3213, 3214,
-     3217, 3218, 3219, 3220, 3221, 3221, 3217, 3222, 3220, 3223,
-
-     3223, 3211, 3216, 3226, 3219, 3218, 3225, 3225, 3227, 3228,
-     3228, 3215, 3232, 3230, 3235, 3235, 3237, 3222, 3226, 3236,
-     3236, 3238, 3241, 3239, 3237, 3240, 3242, 3227, 3230, 3239,
-     3232, 3240, 3243, 3244, 3245, 3245, 3241, 3250, 3244, 3242,
-     3238, 3247, 3247, 3251, 3254, 3253, 3256, 3257, 3254, 3258,
-     3262, 3243, 3257, 3261, 3259, 3262, 3260, 3263, 3250, 3253,
-     3264, 3264, 3263, 3251, 3267, 3268, 3256, 3259, 3258, 3260,
-     3269, 3271, 3261, 3270, 3270, 3272, 3271, 3273, 3273, 3277,
-     3274, 3272, 3275, 3268, 3267, 3274, 3276, 3275, 3278, 3269,
-     3281, 3276, 3280, 3280, 3278, 3281, 3282, 3282, 3277, 3284,
-
-     3285, 3286, 3287, 3284, 3288, 3289, 3290, 3291, 3286, 3293,
-     3293, 3289, 3295, 3295, 3298, 3296, 3299, 3297, 3300, 3285,
-     3291, 3287, 3297, 3288, 3296, 3290, 3303, 3296, 3301, 3301,
-     3305, 3300, 3302, 3298, 3307, 3299, 3312, 3302,    0, 3303,
-     3306, 3306, 3308, 3308, 3309, 3309, 3310, 3311, 3313, 3313,
-     3319, 3310, 3314, 3307, 3311, 3312, 3305, 3314, 3315, 3317,
-     3315, 3316, 3316, 3318, 3321, 3324, 3317, 3320, 3328, 3319,
-     3318, 3326, 3320, 3323, 3323, 3327, 3326, 3329, 3330, 3330,
-     3327, 3332, 3332, 3321, 3324, 3333, 3334, 3328, 3335, 3335,
-     3336, 3336, 3337, 3339, 3339, 3341, 3329, 3340, 3340, 3337,
-
-     3347, 3343, 3341, 3346, 3333, 3334, 3343, 3348, 3346, 3349,
-     3349, 3350, 3350,    0,    0,    0,    0,    0,    0, 3347,
-        0,    0,    0,    0,    0,    0, 3348, 3354, 3354, 3354,
-     3354, 3354, 3354, 3354, 3355, 3355, 3355, 3355, 3355, 3355,
-     3355, 3356, 3356, 3356, 3356, 3356, 3356, 3356, 3357, 3357,
-     3357, 3357, 3357, 3357, 3357, 3358, 3358, 3358, 3358, 3358,
-     3358, 3358, 3359, 3359, 3359, 3359, 3359, 3359, 3359, 3360,
-     3360, 3360, 3360, 3360, 3360, 3360, 3362, 3362,    0, 3362,
-     3362, 3362, 3362, 3363, 3363,    0,    0,    0, 3363, 3363,
-     3364, 3364,    0,    0, 3364,    0, 3364, 3365,    0,    0,
-
-        0,    0,    0, 3365, 3366, 3366,    0,    0,    0, 3366,
-     3366, 3367,    0,    0,    0,    0,    0, 3367, 3368, 3368,
-        0, 3368, 3368, 3368, 3368, 3369,    0,    0,    0,    0,
-        0, 3369, 3370, 3370,    0,    0,    0, 3370, 3370, 3371,
-     3371,    0, 3371, 3371, 3371, 3371, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353, 3353,
-     3353, 3353, 3353, 3353, 3353, 3353, 3353
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        7,    7,    7,    7,    7,    7,   17,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        8,    8,    8,    8,    8,    8,   33,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       11,   34,   35,   38,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       12,   40,   46,   47,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       13,   13,   13,   13,   13,   13,   59,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       14,   14,   14,   14,   14,   14,   74,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       18,   76,   19,   92,   93,   18,   19,   18,   18,   18,
+       18,   18,   94,   18,   18,   18,   18,   18,   18,   18,
+       18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+       18,   18,   18,   18,   18,   18,   18,   18,   18,   18,
+       23,   23,   95,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       24,   26,   24,   24,   88,   24,   25,   25,   88,   27,
+       25,   24,   24,   29,   96,   25,   27,   25,   28,   97,
+       27,   26,   28,   27,   25,   28,   30,   28,   28,   31,
+       98,   32,   37,   29,   32,   99,   37,   31,   28,   36,
+       30,   32,  101,   32,  102,  103,   42,   36,   31,   42,
+       37,   36,   37,   36,   39,   41,   42,   36,   39,   41,
+       42,   42,   39,   43,  106,   43,  107,   44,   39,   41,
+       41,   39,   41,  100,   43,   45,  109,   44,   39,   45,
+
+       43,   44,   44,   45,   48,   48,  100,  105,  105,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   52,   52,  110,  111,   53,   53,
+      113,  114,   53,   53,   52,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   57,  115,
+      116,   57,   58,  117,  118,  121,  125,   58,   57,   58,
+
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   63,  124,   63,   63,  126,   63,  124,  127,
+       64,   64,  128,  129,   63,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       68,   68,  130,  131,   69,  132,  133,  134,  135,   69,
+       68,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   71,  136,  137,  139,  140,   71,
+      141,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   73,  104,   73,   73,  138,   73,
+       75,  104,  138,  104,  143,   75,   73,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       80,  144,   80,   80,  145,   80,  147,  148,   81,   81,
+      149,  152,   80,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   85,   85,
+       87,  122,   87,   87,  151,   87,  153,  154,   85,   89,
+      155,   87,   87,  157,   89,  151,   89,   89,   89,   89,
+       89,  122,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   91,
+      108,   91,   91,  120,   91,  112,  112,  142,  156,  119,
+       91,   91,  119,  112,  123,  158,  142,  156,  123,  108,
+      146,  150,  142,  159,  160,  119,  119,  161,  120,  156,
+      162,  146,  163,  170,  123,  146,  165,  165,  150,  167,
+      177,  150,  167,  172,  172,  169,  165,  169,  169,  167,
+      169,  180,  183,  172,  182,  182,  174,  169,  174,  174,
+      185,  174,  175,  186,  182,  187,  189,  175,  174,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  176,  190,  176,  176,  179,  176,  179,  179,
+      184,  179,  188,  191,  176,  192,  193,  194,  179,  188,
+      195,  196,  197,  198,  199,  184,  200,  201,  202,  197,
+      203,  204,  205,  202,  206,  203,  207,  208,  209,  210,
+      203,  211,  212,  213,  214,  215,  203,  203,  216,  217,
+      202,  218,  217,  219,  220,  221,  222,  223,  221,  224,
+      221,  225,  226,  227,  228,  229,  230,  231,  232,  233,
+      211,  234,  221,  235,  221,  227,  236,  237,  238,  239,
+      240,  241,  231,  242,  243,  244,  245,  246,  247,  248,
+
+      249,  250,  251,  252,  253,  245,  254,  255,  256,  253,
+      257,  258,  259,  259,  260,  261,  262,  263,  264,  265,
+      266,  267,  268,  269,  270,  271,  272,  273,  274,  275,
+      276,  277,  278,  279,  280,  281,  282,  283,  284,  285,
+      286,  287,  288,  289,  290,  291,  292,  276,  293,  294,
+      295,  296,  274,  297,  298,  299,  300,  301,  302,  303,
+      304,  305,  306,  307,  308,  309,  310,  311,  312,  313,
+      314,  315,  316,  317,  318,  319,  320,  321,  322,  323,
+      324,  325,  326,  327,  328,  329,  330,  331,  332,  333,
+      334,  318,  335,  336,  337,  338,  339,  340,  341,  342,
+
+      340,  343,  344,  322,  344,  340,  340,  340,  340,  335,
+      345,  346,  347,  348,  349,  349,  350,  351,  352,  353,
+      344,  350,  353,  354,  355,  355,  356,  357,  358,  359,
+      360,  361,  362,  363,  364,  365,  366,  367,  368,  369,
+      371,  369,  372,  373,  374,  375,  376,  377,  376,  378,
+      369,  375,  379,  380,  381,  382,  383,  385,  384,  385,
+      386,  388,  378,  387,  384,  378,  389,  378,  384,  390,
+      393,  395,  385,  396,  392,  385,  384,  385,  398,  385,
+      392,  387,  394,  394,  397,  399,  400,  401,  402,  397,
+      392,  403,  394,  404,  394,  394,  394,  405,  406,  394,
+
+      407,  408,  409,  410,  411,  412,  413,  414,  415,  416,
+      417,  418,  419,  420,  411,  421,  422,  423,  424,  425,
+      426,  427,  427,  412,  428,  429,  430,  431,  432,  433,
+      433,  434,  436,  435,  437,  438,  439,  440,  441,  442,
+      444,  445,  446,  447,  448,  443,  449,  433,  435,  450,
+      442,  451,  442,  443,  443,  452,  453,  443,  443,  454,
+      455,  456,  457,  458,  459,  460,  461,  462,  463,  464,
+      465,  466,  467,  468,  469,  470,  471,  472,  473,  474,
+      475,  468,  476,  477,  478,  479,  480,  481,  483,  485,
+      486,  487,  488,  489,  490,  491,  477,  493,  494,  493,
+
+      495,  496,  497,  498,  499,  500,  501,  502,  503,  504,
+      502,  505,  506,  507,  508,  509,  510,  511,  512,  513,
+      514,  515,  516,  517,  518,  519,  520,  521,  523,  524,
+      525,  526,  521,  527,  521,  528,  530,  529,  531,  509,
+      521,  529,  521,  533,  532,  521,  521,  532,  534,  535,
+      536,  537,  521,  538,  539,  540,  541,  542,  543,  534,
+      544,  545,  546,  547,  548,  549,  550,  551,  552,  553,
+      555,  556,  557,  558,  559,  560,  561,  562,  563,  564,
+      565,  566,  567,  568,  569,  570,  571,  572,  573,  574,
+      575,  576,  577,  578,  579,  580,  581,  582,  583,  585,
+
+      584,  586,  587,  588,  582,  584,  589,  582,  590,  591,
+      592,  593,  594,  595,  596,  592,  597,  598,  599,  600,
+      601,  602,  603,  604,  605,  606,  607,  608,  609,  610,
+      611,  612,  613,  614,  615,  616,  617,  618,  619,  620,
+      621,  622,  618,  623,  624,  618,  618,  625,  626,  628,
+      629,  630,  631,  632,  633,  634,  635,  636,  637,  638,
+      639,  640,  641,  642,  643,  644,  645,  646,  647,  648,
+      649,  650,  651,  653,  631,  652,  652,  654,  655,  656,
+      657,  658,  659,  660,  661,  662,  663,  664,  665,  666,
+      667,  668,  669,  665,  670,  671,  672,  673,  674,  675,
+
+      676,  677,  678,  679,  680,  668,  668,  681,  682,  680,
+      683,  684,  685,  679,  686,  676,  687,  688,  689,  690,
+      691,  692,  693,  694,  695,  696,  697,  698,  699,  700,
+      701,  702,  703,  704,  705,  706,  707,  708,  709,  709,
+      710,  711,  712,  713,  714,  715,  716,  717,  718,  719,
+      720,  721,  722,  723,  724,  725,  726,  727,  728,  729,
+      730,  731,  732,  733,  734,  735,  736,  737,  738,  739,
+      740,  741,  742,  743,  744,  745,  746,  747,  748,  749,
+      750,  752,  753,  754,  755,  747,  756,  757,  758,  759,
+      760,  761,  762,  763,  764,  765,  767,  770,  765,  765,
+
+      773,  774,  765,  776,  777,  765,  778,  779,  780,  781,
+      782,  783,  765,  765,  784,  765,  785,  786,  787,  787,
+      788,  787,  789,  790,  787,  791,  792,  793,  794,  787,
+      795,  796,  797,  798,  799,  787,  787,  800,  801,  799,
+      802,  803,  804,  793,  805,  806,  807,  808,  809,  810,
+      811,  812,  813,  814,  815,  816,  817,  818,  819,  820,
+      821,  822,  823,  824,  825,  826,  828,  829,  830,  831,
+      826,  832,  833,  834,  835,  836,  837,  838,  839,  840,
+      841,  842,  843,  844,  845,  846,  847,  848,  849,  850,
+      851,  852,  854,  855,  856,  857,  858,  859,  860,  861,
+
+      862,  863,  864,  865,  866,  867,  868,  869,  865,  870,
+      871,  872,  874,  875,  876,  877,  878,  879,  880,  872,
+      881,  882,  883,  884,  885,  886,  887,  888,  889,  890,
+      891,  892,  893,  894,  895,  896,  897,  898,  899,  900,
+      901,  902,  903,  904,  905,  906,  907,  908,  909,  910,
+      911,  912,  913,  914,  915,  916,  917,  918,  919,  920,
+      921,  922,  923,  916,  924,  925,  926,  927,  928,  929,
+      930,  931,  932,  933,  934,  930,  935,  936,  937,  938,
+      940,  941,  942,  944,  945,  946,  947,  948,  947,  949,
+      950,  951,  947,  952,  947,  953,  954,  955,  956,  947,
+
+      957,  958,  959,  960,  947,  961,  958,  962,  963,  964,
+      965,  966,  967,  964,  968,  969,  970,  971,  972,  962,
+      973,  974,  975,  964,  976,  977,  978,  979,  980,  981,
+      982,  983,  984,  985,  981,  986,  981,  987,  988,  989,
+      990,  991,  981,  992,  993,  994,  995,  981,  981,  996,
+      997,  998,  999, 1000,  981, 1001, 1003, 1004, 1005, 1006,
+     1007, 1008, 1009, 1010, 1012, 1013, 1014, 1015, 1016, 1017,
+     1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027,
+     1029, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+     1040, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1051, 1052,
+
+     1054, 1055, 1056, 1054, 1052, 1057, 1058, 1059, 1060, 1061,
+     1062, 1063, 1064, 1065, 1066, 1067, 1069, 1070, 1071, 1072,
+     1073, 1074, 1075, 1076, 1077, 1079, 1080, 1081, 1082, 1083,
+     1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+     1094, 1095, 1096, 1097, 1098, 1100, 1101, 1102, 1103, 1104,
+     1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114,
+     1115, 1108, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
+     1124, 1125, 1126, 1127, 1128, 1129, 1131, 1132, 1133, 1134,
+     1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145,
+     1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155,
+
+     1156, 1157, 1158, 1160, 1161, 1162, 1163, 1164, 1165, 1166,
+     1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1166, 1176,
+     1166, 1177, 1178, 1166, 1179, 1180, 1181, 1182, 1183, 1184,
+     1185, 1186, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+     1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205,
+     1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+     1216, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226,
+     1227, 1228, 1229, 1230, 1226, 1231, 1232, 1233, 1234, 1231,
+     1235, 1236, 1231, 1231, 1237, 1238, 1239, 1231, 1240, 1241,
+     1242, 1243, 1244, 1231, 1244, 1245, 1246, 1231, 1247, 1248,
+
+     1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258,
+     1259, 1260, 1261, 1263, 1258, 1265, 1258, 1266, 1258, 1267,
+     1258, 1262, 1262, 1268, 1269, 1270, 1271, 1272, 1273, 1269,
+     1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
+     1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1294,
+     1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304,
+     1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1314, 1315,
+     1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
+     1326, 1327, 1328, 1329, 1330, 1332, 1333, 1334, 1335, 1336,
+     1337, 1338, 1339, 1340, 1341, 1343, 1344, 1345, 1346, 1347,
+
+     1348, 1349, 1351, 1353, 1354, 1355, 1356, 1357, 1358, 1353,
+     1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1368, 1369,
+     1370, 1371, 1372, 1373, 1369, 1374, 1375, 1376, 1377, 1375,
+     1376, 1378, 1379, 1380, 1382, 1383, 1384, 1385, 1386, 1387,
+     1388, 1389, 1390, 1386, 1391, 1392, 1393, 1394, 1395, 1397,
+     1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
+     1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417,
+     1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427,
+     1428, 1429, 1430, 1431, 1432, 1433, 1435, 1436, 1437, 1438,
+     1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448,
+
+     1449, 1450, 1451, 1452, 1453, 1449, 1450, 1454, 1455, 1456,
+     1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1467, 1468,
+     1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478,
+     1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+     1490, 1491, 1492, 1488, 1493, 1494, 1495, 1496, 1497, 1498,
+     1499, 1500, 1501, 1502, 1503, 1504, 1488, 1505, 1506, 1507,
+     1508, 1510, 1512, 1513, 1514, 1515, 1516, 1518, 1520, 1521,
+     1522, 1523, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532,
+     1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542,
+     1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552,
+
+     1553, 1554, 1555, 1557, 1558, 1559, 1560, 1561, 1562, 1562,
+     1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572,
+     1573, 1574, 1575, 1576, 1577, 1578, 1580, 1581, 1582, 1583,
+     1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594,
+     1595, 1596, 1597, 1598, 1599, 1600, 1598, 1601, 1602, 1604,
+     1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1598, 1613,
+     1614, 1615, 1616, 1617, 1602, 1618, 1619, 1620, 1621, 1622,
+     1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632,
+     1633, 1634, 1635, 1636, 1637, 1638, 1639, 1641, 1642, 1643,
+     1644, 1645, 1646, 1647, 1648, 1649, 1651, 1652, 1653, 1654,
+
+     1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664,
+     1666, 1663, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1666,
+     1675, 1676, 1677, 1678, 1666, 1679, 1680, 1681, 1682, 1683,
+     1684, 1685, 1686, 1684, 1687, 1688, 1689, 1690, 1691, 1692,
+     1693, 1694, 1695, 1698, 1699, 1693, 1700, 1701, 1702, 1703,
+     1704, 1705, 1706, 1707, 1705, 1708, 1709, 1710, 1712, 1713,
+     1714, 1715, 1710, 1716, 1704, 1717, 1718, 1719, 1720, 1721,
+     1722, 1723, 1725, 1726, 1727, 1728, 1729, 1730, 1732, 1734,
+     1735, 1736, 1729, 1737, 1738, 1739, 1740, 1741, 1742, 1743,
+     1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753,
+
+     1754, 1755, 1756, 1757, 1759, 1760, 1761, 1762, 1763, 1764,
+     1742, 1765, 1766, 1768, 1769, 1770, 1771, 1772, 1773, 1774,
+     1775, 1776, 1777, 1778, 1779, 1780, 1782, 1783, 1784, 1785,
+     1786, 1787, 1788, 1789, 1790, 1792, 1793, 1794, 1795, 1796,
+     1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806,
+     1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816,
+     1817, 1818, 1820, 1813, 1821, 1822, 1823, 1811, 1824, 1825,
+     1826, 1825, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834,
+     1835, 1836, 1837, 1839, 1840, 1841, 1842, 1843, 1844, 1845,
+     1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1854,
+
+     1854, 1855, 1856, 1857, 1858, 1854, 1859, 1861, 1862, 1863,
+     1864, 1865, 1861, 1866, 1867, 1868, 1869, 1870, 1871, 1872,
+     1873, 1874, 1875, 1876, 1877, 1878, 1879, 1882, 1883, 1884,
+     1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895,
+     1896, 1897, 1899, 1900, 1901, 1902, 1903, 1904, 1906, 1907,
+     1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917,
+     1918, 1919, 1920, 1921, 1922, 1924, 1925, 1926, 1927, 1928,
+     1929, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939,
+     1922, 1940, 1941, 1938, 1942, 1943, 1944, 1945, 1946, 1947,
+     1948, 1949, 1950, 1951, 1953, 1954, 1955, 1956, 1957, 1959,
+
+     1954, 1960, 1961, 1963, 1964, 1965, 1960, 1966, 1967, 1968,
+     1970, 1971, 1972, 1955, 1973, 1974, 1975, 1976, 1977, 1978,
+     1979, 1981, 1982, 1983, 1985, 1986, 1987, 1988, 1989, 1990,
+     1991, 1992, 1993, 1994, 1995, 1997, 1999, 2000, 2001, 2003,
+     2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+     2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023,
+     2024, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+     2035, 2038, 2026, 2040, 2041, 2042, 2044, 2045, 2046, 2047,
+     2048, 2049, 2050, 2051, 2053, 2054, 2056, 2057, 2058, 2059,
+     2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069,
+
+     2070, 2071, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080,
+     2081, 2083, 2084, 2085, 2071, 2086, 2087, 2088, 2090, 2092,
+     2093, 2094, 2095, 2096, 2098, 2099, 2100, 2101, 2102, 2103,
+     2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113,
+     2115, 2116, 2117, 2112, 2118, 2119, 2120, 2121, 2122, 2123,
+     2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2125,
+     2134, 2135, 2136, 2134, 2137, 2138, 2139, 2140, 2142, 2137,
+     2143, 2144, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153,
+     2154, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2166, 2168,
+     2169, 2170, 2171, 2172, 2173, 2175, 2176, 2177, 2166, 2178,
+
+     2179, 2166, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187,
+     2188, 2184, 2189, 2190, 2182, 2193, 2194, 2195, 2196, 2197,
+     2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2207, 2208,
+     2194, 2209, 2210, 2212, 2213, 2214, 2215, 2216, 2212, 2212,
+     2217, 2194, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225,
+     2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235,
+     2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2247,
+     2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258,
+     2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268,
+     2266, 2269, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278,
+
+     2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288,
+     2289, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299,
+     2300, 2301, 2302, 2304, 2305, 2306, 2308, 2309, 2310, 2311,
+     2312, 2313, 2314, 2298, 2315, 2316, 2318, 2319, 2320, 2321,
+     2322, 2323, 2324, 2325, 2326, 2327, 2328, 2330, 2331, 2332,
+     2333, 2334, 2335, 2336, 2337, 2338, 2340, 2341, 2342, 2343,
+     2344, 2328, 2345, 2328, 2346, 2347, 2348, 2349, 2350, 2351,
+     2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2362,
+     2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2373, 2371,
+     2374, 2367, 2375, 2376, 2377, 2378, 2380, 2381, 2382, 2383,
+
+     2385, 2386, 2387, 2388, 2389, 2390, 2392, 2393, 2394, 2395,
+     2396, 2397, 2398, 2399, 2400, 2401, 2400, 2402, 2403, 2404,
+     2405, 2406, 2407, 2408, 2409, 2410, 2411, 2413, 2414, 2415,
+     2416, 2417, 2418, 2419, 2420, 2421, 2422, 2424, 2425, 2426,
+     2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436,
+     2437, 2439, 2440, 2441, 2442, 2443, 2444, 2446, 2448, 2449,
+     2450, 2451, 2452, 2455, 2456, 2457, 2458, 2459, 2462, 2464,
+     2465, 2467, 2468, 2471, 2472, 2473, 2474, 2475, 2477, 2479,
+     2480, 2481, 2482, 2483, 2485, 2486, 2487, 2488, 2489, 2491,
+     2492, 2493, 2494, 2496, 2497, 2498, 2499, 2501, 2502, 2503,
+
+     2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513,
+     2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523,
+     2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533,
+     2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543,
+     2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553,
+     2554, 2555, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564,
+     2565, 2566, 2567, 2569, 2571, 2572, 2573, 2574, 2575, 2576,
+     2577, 2578, 2579, 2581, 2582, 2583, 2584, 2585, 2586, 2587,
+     2588, 2589, 2590, 2591, 2592, 2594, 2595, 2596, 2597, 2598,
+     2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609,
+
+     2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619,
+     2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629,
+     2631, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2643, 2644,
+     2645, 2646, 2647, 2648, 2649, 2650, 2651, 2653, 2654, 2655,
+     2656, 2658, 2659, 2660, 2661, 2663, 2664, 2665, 2666, 2667,
+     2668, 2669, 2670, 2671, 2672, 2673, 2674, 2679, 2680, 2681,
+     2682, 2683, 2684, 2685, 2686, 2687, 2689, 2692, 2693, 2694,
+     2695, 2696, 2697, 2698, 2699, 2700, 2701, 2703, 2704, 2705,
+     2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715,
+     2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2726, 2727,
+
+     2728, 2729, 2730, 2731, 2732, 2733, 2729, 2734, 2735, 2736,
+     2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746,
+     2747, 2748, 2750, 2751, 2752, 2754, 2756, 2757, 2758, 2759,
+     2760, 2761, 2762, 2763, 2766, 2767, 2768, 2771, 2772, 2773,
+     2774, 2775, 2776, 2777, 2778, 2779, 2780, 2782, 2784, 2785,
+     2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2795, 2796,
+     2798, 2799, 2800, 2801, 2802, 2804, 2805, 2806, 2807, 2809,
+     2810, 2811, 2813, 2815, 2816, 2817, 2818, 2819, 2821, 2822,
+     2824, 2818, 2825, 2826, 2827, 2829, 2831, 2832, 2833, 2834,
+     2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844,
+
+     2847, 2848, 2850, 2851, 2852, 2853, 2855, 2850, 2856, 2857,
+     2858, 2859, 2862, 2864, 2865, 2867, 2868, 2869, 2870, 2871,
+     2872, 2873, 2874, 2874, 2875, 2876, 2877, 2878, 2879, 2880,
+     2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2882,
+     2886, 2887, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897,
+     2898, 2899, 2900, 2901, 2902, 2903, 2905, 2906, 2907, 2908,
+     2910, 2911, 2912, 2913, 2915, 2916, 2917, 2918, 2920, 2921,
+     2922, 2923, 2924, 2925, 2926, 2927, 2928, 2929, 2930, 2934,
+     2927, 2935, 2937, 2938, 2939, 2940, 2942, 2943, 2944, 2947,
+     2948, 2949, 2950, 2951, 2953, 2954, 2956, 2958, 2959, 2960,
+
+     2961, 2963, 2964, 2966, 2968, 2969, 2966, 2970, 2971, 2972,
+     2973, 2974, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983,
+     2984, 2985, 2986, 2987, 2988, 2989, 2991, 2992, 2994, 2995,
+     2996, 2997, 2998, 2999, 3000, 3002, 3004, 3006, 3007, 3008,
+     3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018,
+     3019, 3022, 3023, 3025, 3027, 3029, 3030, 3031, 3032, 3034,
+     3035, 3036, 3037, 3038, 3039, 3041, 3042, 3043, 3044, 3047,
+     3048, 3049, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058,
+     3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068,
+     3072, 3073, 3074, 3075, 3076, 3077, 3055, 3078, 3080, 3081,
+
+     3082, 3085, 3086, 3087, 3088, 3089, 3089, 3090, 3092, 3093,
+     3094, 3095, 3096, 3097, 3098, 3099, 3101, 3102, 3103, 3104,
+     3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3114, 3117,
+     3119, 3120, 3121, 3122, 3124, 3125, 3126, 3127, 3128, 3129,
+     3130, 3131, 3133, 3134, 3135, 3136, 3139, 3141, 3142, 3143,
+     3144, 3145, 3146, 3147, 3148, 3149, 3150, 3152, 3153, 3154,
+     3155, 3156, 3157, 3159, 3160, 3161, 3162, 3164, 3165, 3166,
+     3167, 3168, 3168, 3169, 3170, 3172, 3173, 3174, 3175, 3177,
+     3178, 3179, 3182, 3183, 3184, 3188, 3189, 3190, 3191, 3193,
+     3194, 3194, 3195, 3195, 3196, 3196, 3197, 3199, 3200, 3201,
+
+     3202, 3203, 3206, 3207, 3208, 3209, 3212, 3213, 3214, 3215,
+     3216, 3217, 3218, 3220, 3221, 3222, 3223, 3224, 3225, 3226,
+     3227, 3228, 3229, 3230, 3228, 3231, 3232, 3229, 3233, 3234,
+     3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244,
+     3245, 3248, 3250, 3251, 3254, 3255, 3256, 3257, 3258, 3259,
+     3260, 3261, 3262, 3264, 3265, 3266, 3267, 3268, 3270, 3271,
+     3272, 3273, 3274, 3275, 3276, 3277, 3279, 3280, 3283, 3284,
+     3285, 3286, 3287, 3289, 3290, 3291, 3292, 3293, 3294, 3295,
+     3296, 3297, 3299, 3300, 3303, 3304, 3307, 3316, 3317, 3319,
+     3320, 3321, 3323, 3324, 3326, 3327, 3328, 3329, 3330, 3332,
+
+     3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342,
+     3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352,
+     3353, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365,
+     3366, 3367, 3368, 3370, 3371, 3372, 3373, 3374, 3375, 3376,
+     3377, 3378, 3379, 3380, 3381, 3383, 3384, 3385, 3386, 3387,
+     3389, 3391, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401,
+     3402, 3403, 3404, 3405, 3407, 3410, 3411, 3412, 3414, 3415,
+     3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426,
+     3429, 3430, 3431, 3432, 3433, 3434, 3435, 3437, 3438, 3439,
+     3440, 3441, 3442, 3444, 3446, 3447, 3449, 3450, 3451, 3452,
+
+     3453, 3454, 3455, 3456, 3458, 3460, 3461, 3462, 3463, 3461,
+     3464, 3465, 3466, 3467, 3468, 3470, 3471, 3472, 3473, 3474,
+     3475, 3476, 3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484,
+     3485, 3486, 3488, 3489, 3491, 3492, 3493, 3494, 3495, 3497,
+     3498, 3499, 3500, 3501, 3502, 3504, 3505, 3506, 3508, 3511,
+     3512, 3513, 3514, 3515, 3518, 3518, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518, 3518,
+     3518, 3518, 3518, 3518, 3518
+
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -3185,7 +2755,7 @@ static void config_end_include(void)
         }
 #endif
 
-#line 3186 "<stdout>"
+#line 2756 "<stdout>"
 #define YY_NO_INPUT 1
 #line 191 "./util/configlexer.lex"
 #ifndef YY_NO_UNPUT
@@ -3194,9 +2764,9 @@ static void config_end_include(void)
 #ifndef YY_NO_INPUT
 #define YY_NO_INPUT 1
 #endif
-#line 3195 "<stdout>"
+#line 2765 "<stdout>"
 
-#line 3197 "<stdout>"
+#line 2767 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -3420,7 +2990,7 @@ YY_DECL
 	{
 #line 211 "./util/configlexer.lex"
 
-#line 3421 "<stdout>"
+#line 2991 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -3453,13 +3023,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 3354 )
+				if ( yy_current_state >= 3519 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 6547 );
+		while ( yy_base[yy_current_state] != 4355 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -3704,1404 +3274,1485 @@ YY_RULE_SETUP
 case 44:
 YY_RULE_SETUP
 #line 258 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_USE_SNI) }
+{ YDVAR(1, VAR_TLS_SESSION_CACHE_SIZE) }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 259 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTPS_PORT) }
+{ YDVAR(1, VAR_TLS_USE_KTLS) }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 260 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_ENDPOINT) }
+{ YDVAR(1, VAR_TLS_USE_SNI) }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 261 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_MAX_STREAMS) }
+{ YDVAR(1, VAR_HTTPS_PORT) }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 262 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_QUERY_BUFFER_SIZE) }
+{ YDVAR(1, VAR_HTTP_ENDPOINT) }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 263 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_RESPONSE_BUFFER_SIZE) }
+{ YDVAR(1, VAR_HTTP_MAX_STREAMS) }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 264 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_NODELAY) }
+{ YDVAR(1, VAR_HTTP_QUERY_BUFFER_SIZE) }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 265 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HTTP_NOTLS_DOWNSTREAM) }
+{ YDVAR(1, VAR_HTTP_RESPONSE_BUFFER_SIZE) }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 266 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSTEMD) }
+{ YDVAR(1, VAR_HTTP_NODELAY) }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 267 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_DAEMONIZE) }
+{ YDVAR(1, VAR_HTTP_NOTLS_DOWNSTREAM) }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 268 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_USE_SYSTEMD) }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 269 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_DO_DAEMONIZE) }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 270 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 271 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 272 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_RCVBUF) }
+{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 273 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_SNDBUF) }
+{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 274 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_REUSEPORT) }
+{ YDVAR(1, VAR_SO_RCVBUF) }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 275 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_TRANSPARENT) }
+{ YDVAR(1, VAR_SO_SNDBUF) }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 276 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_FREEBIND) }
+{ YDVAR(1, VAR_SO_REUSEPORT) }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 277 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_DSCP) }
+{ YDVAR(1, VAR_BUSY_POLL) }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 278 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CHROOT) }
+{ YDVAR(1, VAR_USE_IO_URING) }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 279 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USERNAME) }
+{ YDVAR(1, VAR_IP_TRANSPARENT) }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 280 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DIRECTORY) }
+{ YDVAR(1, VAR_IP_FREEBIND) }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 281 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOGFILE) }
+{ YDVAR(1, VAR_IP_DSCP) }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 282 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PIDFILE) }
+{ YDVAR(1, VAR_CHROOT) }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 283 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_HINTS) }
+{ YDVAR(1, VAR_USERNAME) }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 284 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STREAM_WAIT_SIZE) }
+{ YDVAR(1, VAR_DIRECTORY) }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 285 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
+{ YDVAR(1, VAR_LOGFILE) }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 286 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
+{ YDVAR(1, VAR_PIDFILE) }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 287 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
+{ YDVAR(1, VAR_ROOT_HINTS) }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 288 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
+{ YDVAR(1, VAR_STREAM_WAIT_SIZE) }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 289 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
+{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 290 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
+{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 291 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 292 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 293 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MIN_TTL) }
+{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 294 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_HOST_TTL) }
+{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 295 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_LAME_TTL) }
+{ YDVAR(1, VAR_CACHE_MAX_TTL) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 296 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
+{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 297 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
+{ YDVAR(1, VAR_CACHE_MIN_TTL) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 298 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
+{ YDVAR(1, VAR_INFRA_HOST_TTL) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 299 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
+{ YDVAR(1, VAR_INFRA_LAME_TTL) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 300 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_KEEP_PROBING) }
+{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 301 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 302 "./util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 303 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 304 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UDP_CONNECT) }
+{ YDVAR(1, VAR_INFRA_KEEP_PROBING) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 305 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 306 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 307 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 308 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_UDP_CONNECT) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 309 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 310 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 311 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 312 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 313 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 314 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 315 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 316 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 317 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 318 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 319 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 320 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 321 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DENY_ANY) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 322 "./util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 323 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 324 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 325 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_DENY_ANY) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 326 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 327 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 328 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_NO_CACHE) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 329 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 330 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 331 "./util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
 #line 332 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(1, VAR_STUB_NO_CACHE) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 333 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 334 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 335 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_NO_CACHE) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 336 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 337 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 338 "./util/configlexer.lex"
-{ YDVAR(0, VAR_AUTH_ZONE) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 339 "./util/configlexer.lex"
-{ YDVAR(0, VAR_RPZ) }
+{ YDVAR(1, VAR_FORWARD_NO_CACHE) }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 340 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TAGS) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 341 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RPZ_ACTION_OVERRIDE) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 342 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RPZ_CNAME_OVERRIDE) }
+{ YDVAR(0, VAR_AUTH_ZONE) }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 343 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RPZ_LOG) }
+{ YDVAR(0, VAR_RPZ) }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 344 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RPZ_LOG_NAME) }
+{ YDVAR(1, VAR_TAGS) }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 345 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ZONEFILE) }
+{ YDVAR(1, VAR_RPZ_ACTION_OVERRIDE) }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 346 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MASTER) }
+{ YDVAR(1, VAR_RPZ_CNAME_OVERRIDE) }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 347 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MASTER) }
+{ YDVAR(1, VAR_RPZ_LOG) }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 348 "./util/configlexer.lex"
-{ YDVAR(1, VAR_URL) }
+{ YDVAR(1, VAR_RPZ_LOG_NAME) }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 349 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ALLOW_NOTIFY) }
+{ YDVAR(1, VAR_ZONEFILE) }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 350 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
+{ YDVAR(1, VAR_MASTER) }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 351 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_UPSTREAM) }
+{ YDVAR(1, VAR_MASTER) }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 352 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FALLBACK_ENABLED) }
+{ YDVAR(1, VAR_URL) }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 353 "./util/configlexer.lex"
-{ YDVAR(0, VAR_VIEW) }
+{ YDVAR(1, VAR_ALLOW_NOTIFY) }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 354 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VIEW_FIRST) }
+{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 355 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(1, VAR_FOR_UPSTREAM) }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 356 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_FALLBACK_ENABLED) }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 357 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(1, VAR_ANSWER_CACHE_SIZE) }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 358 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
+{ YDVAR(0, VAR_VIEW) }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 359 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
+{ YDVAR(1, VAR_VIEW_FIRST) }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 360 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 361 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 362 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 363 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
+{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 364 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV4) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 365 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV6) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 366 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV4) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 367 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV6) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 368 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 369 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 370 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
+{ YDVAR(1, VAR_MIN_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 371 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV4) }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 372 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(1, VAR_MAX_ECS_TREE_SIZE_IPV6) }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 373 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 374 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 375 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 376 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 377 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 378 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 379 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 380 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 381 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_KEY_SENTINEL) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 382 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 383 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 384 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 385 "./util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 386 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_PRIME_ON_START) }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 387 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_ROOT_KEY_SENTINEL) }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 388 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
 #line 389 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 176:
 YY_RULE_SETUP
 #line 390 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 391 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_TTL) }
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 392 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_TTL_RESET) }
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 393 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_REPLY_TTL) }
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 394 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED_CLIENT_TIMEOUT) }
+{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
 #line 395 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_ORIGINAL_TTL) }
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
 #line 396 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_DSA) }
+{ YDVAR(1, VAR_SERVE_EXPIRED) }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
 #line 397 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_SHA1) }
+{ YDVAR(1, VAR_SERVE_EXPIRED_TTL) }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 398 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(1, VAR_SERVE_EXPIRED_TTL_RESET) }
 	YY_BREAK
 case 185:
 YY_RULE_SETUP
 #line 399 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_SERVE_EXPIRED_REPLY_TTL) }
 	YY_BREAK
 case 186:
 YY_RULE_SETUP
 #line 400 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_SERVE_EXPIRED_CLIENT_TIMEOUT) }
 	YY_BREAK
 case 187:
 YY_RULE_SETUP
 #line 401 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(1, VAR_SERVE_ORIGINAL_TTL) }
 	YY_BREAK
 case 188:
 YY_RULE_SETUP
 #line 402 "./util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_FAKE_DSA) }
 	YY_BREAK
 case 189:
 YY_RULE_SETUP
-#line 404 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 403 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_SHA1) }
 	YY_BREAK
 case 190:
 YY_RULE_SETUP
-#line 405 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 404 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 191:
 YY_RULE_SETUP
-#line 406 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 405 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 192:
 YY_RULE_SETUP
-#line 407 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
+#line 406 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 193:
 YY_RULE_SETUP
-#line 408 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 407 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
 	YY_BREAK
 case 194:
 YY_RULE_SETUP
-#line 409 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_IDENTITY) }
+#line 408 "./util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 195:
 YY_RULE_SETUP
 #line 410 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 196:
 YY_RULE_SETUP
 #line 411 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 197:
 YY_RULE_SETUP
 #line 412 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_REPLIES) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 198:
 YY_RULE_SETUP
 #line 413 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TAG_QUERYREPLY) }
+{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
 	YY_BREAK
 case 199:
 YY_RULE_SETUP
 #line 414 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_LOCAL_ACTIONS) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 200:
 YY_RULE_SETUP
 #line 415 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_SERVFAIL) }
+{ YDVAR(1, VAR_LOG_IDENTITY) }
 	YY_BREAK
 case 201:
 YY_RULE_SETUP
 #line 416 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 202:
 YY_RULE_SETUP
 #line 417 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 203:
 YY_RULE_SETUP
 #line 418 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+{ YDVAR(1, VAR_LOG_REPLIES) }
 	YY_BREAK
 case 204:
 YY_RULE_SETUP
 #line 419 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
+{ YDVAR(1, VAR_LOG_TAG_QUERYREPLY) }
 	YY_BREAK
 case 205:
 YY_RULE_SETUP
 #line 420 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
+{ YDVAR(1, VAR_LOG_LOCAL_ACTIONS) }
 	YY_BREAK
 case 206:
 YY_RULE_SETUP
 #line 421 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+{ YDVAR(1, VAR_LOG_SERVFAIL) }
 	YY_BREAK
 case 207:
 YY_RULE_SETUP
 #line 422 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 208:
 YY_RULE_SETUP
 #line 423 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
 case 209:
 YY_RULE_SETUP
 #line 424 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_ENABLE) }
+{ YDVAR(1, VAR_LOCAL_ZONE_FILE) }
 	YY_BREAK
 case 210:
 YY_RULE_SETUP
 #line 425 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_KEY) }
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
 	YY_BREAK
 case 211:
 YY_RULE_SETUP
 #line 426 "./util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
 	YY_BREAK
 case 212:
 YY_RULE_SETUP
 #line 427 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
 	YY_BREAK
 case 213:
 YY_RULE_SETUP
 #line 428 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
 	YY_BREAK
 case 214:
 YY_RULE_SETUP
 #line 429 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
 	YY_BREAK
 case 215:
 YY_RULE_SETUP
 #line 430 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
 	YY_BREAK
 case 216:
 YY_RULE_SETUP
 #line 431 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+{ YDVAR(1, VAR_SHM_ENABLE) }
 	YY_BREAK
 case 217:
 YY_RULE_SETUP
 #line 432 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+{ YDVAR(1, VAR_SHM_KEY) }
 	YY_BREAK
 case 218:
 YY_RULE_SETUP
 #line 433 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
 	YY_BREAK
 case 219:
 YY_RULE_SETUP
 #line 434 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
 	YY_BREAK
 case 220:
 YY_RULE_SETUP
 #line 435 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
 	YY_BREAK
 case 221:
 YY_RULE_SETUP
 #line 436 "./util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_CONTROL_PORT) }
 	YY_BREAK
 case 222:
 YY_RULE_SETUP
 #line 437 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DYNLIB_FILE) }
+{ YDVAR(1, VAR_CONTROL_USE_CERT) }
 	YY_BREAK
 case 223:
 YY_RULE_SETUP
 #line 438 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DYNLIB) }
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
 	YY_BREAK
 case 224:
 YY_RULE_SETUP
 #line 439 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
 	YY_BREAK
 case 225:
 YY_RULE_SETUP
 #line 440 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
 	YY_BREAK
 case 226:
 YY_RULE_SETUP
 #line 441 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
 	YY_BREAK
 case 227:
 YY_RULE_SETUP
 #line 442 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNKNOWN_SERVER_TIME_LIMIT) }
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
 	YY_BREAK
 case 228:
 YY_RULE_SETUP
 #line 443 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+{ YDVAR(0, VAR_PYTHON) }
 	YY_BREAK
 case 229:
 YY_RULE_SETUP
 #line 444 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_PREFIX) }
+{ YDVAR(1, VAR_DYNLIB_FILE) }
 	YY_BREAK
 case 230:
 YY_RULE_SETUP
 #line 445 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+{ YDVAR(0, VAR_DYNLIB) }
 	YY_BREAK
 case 231:
 YY_RULE_SETUP
 #line 446 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_IGNORE_AAAA) }
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
 	YY_BREAK
 case 232:
 YY_RULE_SETUP
 #line 447 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEFINE_TAG) }
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
 	YY_BREAK
 case 233:
 YY_RULE_SETUP
 #line 448 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
 	YY_BREAK
 case 234:
 YY_RULE_SETUP
 #line 449 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+{ YDVAR(1, VAR_UNKNOWN_SERVER_TIME_LIMIT) }
 	YY_BREAK
 case 235:
 YY_RULE_SETUP
 #line 450 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
+{ YDVAR(1, VAR_MAX_UDP_SIZE) }
 	YY_BREAK
 case 236:
 YY_RULE_SETUP
 #line 451 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+{ YDVAR(1, VAR_DNS64_PREFIX) }
 	YY_BREAK
 case 237:
 YY_RULE_SETUP
 #line 452 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+{ YDVAR(1, VAR_DNS64_SYNTHALL) }
 	YY_BREAK
 case 238:
 YY_RULE_SETUP
 #line 453 "./util/configlexer.lex"
-{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+{ YDVAR(1, VAR_DNS64_IGNORE_AAAA) }
 	YY_BREAK
 case 239:
 YY_RULE_SETUP
 #line 454 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DNSTAP) }
+{ YDVAR(1, VAR_DEFINE_TAG) }
 	YY_BREAK
 case 240:
 YY_RULE_SETUP
 #line 455 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
 	YY_BREAK
 case 241:
 YY_RULE_SETUP
 #line 456 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_BIDIRECTIONAL) }
+{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
 	YY_BREAK
 case 242:
 YY_RULE_SETUP
 #line 457 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
 	YY_BREAK
 case 243:
 YY_RULE_SETUP
 #line 458 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_IP) }
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
 	YY_BREAK
 case 244:
 YY_RULE_SETUP
 #line 459 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_TLS) }
+{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
 	YY_BREAK
 case 245:
 YY_RULE_SETUP
 #line 460 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_TLS_SERVER_NAME) }
+{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
 	YY_BREAK
 case 246:
 YY_RULE_SETUP
 #line 461 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_TLS_CERT_BUNDLE) }
+{ YDVAR(0, VAR_DNSTAP) }
 	YY_BREAK
 case 247:
 YY_RULE_SETUP
 #line 462 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_TLS_CLIENT_KEY_FILE) }
+{ YDVAR(1, VAR_DNSTAP_ENABLE) }
 	YY_BREAK
 case 248:
 YY_RULE_SETUP
-#line 464 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_TLS_CLIENT_CERT_FILE) }
+#line 463 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_BIDIRECTIONAL) }
 	YY_BREAK
 case 249:
 YY_RULE_SETUP
-#line 466 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+#line 464 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
 	YY_BREAK
 case 250:
 YY_RULE_SETUP
-#line 467 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+#line 465 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IP) }
 	YY_BREAK
 case 251:
 YY_RULE_SETUP
-#line 468 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+#line 466 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_TLS) }
 	YY_BREAK
 case 252:
 YY_RULE_SETUP
-#line 469 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_VERSION) }
+#line 467 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_TLS_SERVER_NAME) }
 	YY_BREAK
 case 253:
 YY_RULE_SETUP
-#line 470 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+#line 468 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_TLS_CERT_BUNDLE) }
 	YY_BREAK
 case 254:
 YY_RULE_SETUP
-#line 472 "./util/configlexer.lex"
+#line 469 "./util/configlexer.lex"
 {
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
+		YDVAR(1, VAR_DNSTAP_TLS_CLIENT_KEY_FILE) }
 	YY_BREAK
 case 255:
 YY_RULE_SETUP
-#line 474 "./util/configlexer.lex"
+#line 471 "./util/configlexer.lex"
 {
-		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
+		YDVAR(1, VAR_DNSTAP_TLS_CLIENT_CERT_FILE) }
 	YY_BREAK
 case 256:
 YY_RULE_SETUP
-#line 476 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
+#line 473 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
 	YY_BREAK
 case 257:
 YY_RULE_SETUP
-#line 478 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
+#line 474 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
 	YY_BREAK
 case 258:
 YY_RULE_SETUP
-#line 480 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
+#line 475 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
 	YY_BREAK
 case 259:
 YY_RULE_SETUP
-#line 482 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
+#line 476 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_VERSION) }
 	YY_BREAK
 case 260:
 YY_RULE_SETUP
-#line 483 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_RATELIMIT) }
+#line 477 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
 	YY_BREAK
 case 261:
 YY_RULE_SETUP
-#line 484 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RATELIMIT) }
+#line 479 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
 	YY_BREAK
 case 262:
 YY_RULE_SETUP
-#line 485 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
+#line 481 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
 case 263:
 YY_RULE_SETUP
-#line 486 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RATELIMIT_SLABS) }
+#line 483 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
 case 264:
 YY_RULE_SETUP
-#line 487 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
+#line 485 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
 case 265:
 YY_RULE_SETUP
-#line 488 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RATELIMIT_SIZE) }
+#line 487 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
 case 266:
 YY_RULE_SETUP
 #line 489 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
+{ YDVAR(1, VAR_DNSTAP_SAMPLE_RATE) }
 	YY_BREAK
 case 267:
 YY_RULE_SETUP
 #line 490 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
+{ YDVAR(1, VAR_DNSTAP_FILTER_QTYPE) }
 	YY_BREAK
 case 268:
 YY_RULE_SETUP
 #line 491 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
+{ YDVAR(1, VAR_DNSTAP_FILTER_RCODE) }
 	YY_BREAK
 case 269:
 YY_RULE_SETUP
 #line 492 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RATELIMIT_FACTOR) }
+{ YDVAR(1, VAR_DNSTAP_FILTER_LOCAL_ZONE) }
 	YY_BREAK
 case 270:
 YY_RULE_SETUP
 #line 493 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOW_RTT) }
+{
+		YDVAR(1, VAR_DNSTAP_FILTER_RESPONSE_TIME) }
 	YY_BREAK
 case 271:
 YY_RULE_SETUP
-#line 494 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAST_SERVER_NUM) }
+#line 495 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
 	YY_BREAK
 case 272:
 YY_RULE_SETUP
-#line 495 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+#line 496 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT) }
 	YY_BREAK
 case 273:
 YY_RULE_SETUP
-#line 496 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+#line 497 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RATELIMIT) }
 	YY_BREAK
 case 274:
 YY_RULE_SETUP
-#line 497 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
+#line 498 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
 	YY_BREAK
 case 275:
 YY_RULE_SETUP
-#line 498 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RESPONSE_IP_TAG) }
+#line 499 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RATELIMIT_SLABS) }
 	YY_BREAK
 case 276:
 YY_RULE_SETUP
-#line 499 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RESPONSE_IP) }
+#line 500 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
 	YY_BREAK
 case 277:
 YY_RULE_SETUP
-#line 500 "./util/configlexer.lex"
-{ YDVAR(2, VAR_RESPONSE_IP_DATA) }
+#line 501 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RATELIMIT_SIZE) }
 	YY_BREAK
 case 278:
 YY_RULE_SETUP
-#line 501 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DNSCRYPT) }
+#line 502 "./util/configlexer.lex"
+{ YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
 	YY_BREAK
 case 279:
 YY_RULE_SETUP
-#line 502 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_ENABLE) }
+#line 503 "./util/configlexer.lex"
+{ YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
 	YY_BREAK
 case 280:
 YY_RULE_SETUP
-#line 503 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_PORT) }
+#line 504 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
 	YY_BREAK
 case 281:
 YY_RULE_SETUP
-#line 504 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_PROVIDER) }
+#line 505 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RATELIMIT_FACTOR) }
 	YY_BREAK
 case 282:
 YY_RULE_SETUP
-#line 505 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_SECRET_KEY) }
+#line 506 "./util/configlexer.lex"
+{ YDVAR(1, VAR_LOW_RTT) }
 	YY_BREAK
 case 283:
 YY_RULE_SETUP
-#line 506 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT) }
+#line 507 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAST_SERVER_NUM) }
 	YY_BREAK
 case 284:
 YY_RULE_SETUP
-#line 507 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT_ROTATED) }
+#line 508 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
 	YY_BREAK
 case 285:
 YY_RULE_SETUP
-#line 508 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE) }
+#line 509 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
 	YY_BREAK
 case 286:
 YY_RULE_SETUP
 #line 510 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS) }
+{ YDVAR(1, VAR_FAST_SERVER_PERMIL) }
 	YY_BREAK
 case 287:
 YY_RULE_SETUP
-#line 512 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SIZE) }
+#line 511 "./util/configlexer.lex"
+{ YDVAR(2, VAR_RESPONSE_IP_TAG) }
 	YY_BREAK
 case 288:
 YY_RULE_SETUP
-#line 513 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SLABS) }
+#line 512 "./util/configlexer.lex"
+{ YDVAR(2, VAR_RESPONSE_IP) }
 	YY_BREAK
 case 289:
 YY_RULE_SETUP
-#line 514 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PAD_RESPONSES) }
+#line 513 "./util/configlexer.lex"
+{ YDVAR(2, VAR_RESPONSE_IP_DATA) }
 	YY_BREAK
 case 290:
 YY_RULE_SETUP
-#line 515 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PAD_RESPONSES_BLOCK_SIZE) }
+#line 514 "./util/configlexer.lex"
+{ YDVAR(0, VAR_DNSCRYPT) }
 	YY_BREAK
 case 291:
 YY_RULE_SETUP
-#line 516 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PAD_QUERIES) }
+#line 515 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_ENABLE) }
 	YY_BREAK
 case 292:
 YY_RULE_SETUP
-#line 517 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PAD_QUERIES_BLOCK_SIZE) }
+#line 516 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_PORT) }
 	YY_BREAK
 case 293:
 YY_RULE_SETUP
-#line 518 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSECMOD_ENABLED) }
+#line 517 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_PROVIDER) }
 	YY_BREAK
 case 294:
 YY_RULE_SETUP
-#line 519 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSECMOD_IGNORE_BOGUS) }
+#line 518 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_SECRET_KEY) }
 	YY_BREAK
 case 295:
 YY_RULE_SETUP
-#line 520 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSECMOD_HOOK) }
+#line 519 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT) }
 	YY_BREAK
 case 296:
 YY_RULE_SETUP
-#line 521 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSECMOD_MAX_TTL) }
+#line 520 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT_ROTATED) }
 	YY_BREAK
 case 297:
 YY_RULE_SETUP
-#line 522 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSECMOD_WHITELIST) }
+#line 521 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE) }
 	YY_BREAK
 case 298:
 YY_RULE_SETUP
 #line 523 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSECMOD_WHITELIST) }
+{
+		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS) }
 	YY_BREAK
 case 299:
 YY_RULE_SETUP
-#line 524 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSECMOD_STRICT) }
+#line 525 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SIZE) }
 	YY_BREAK
 case 300:
 YY_RULE_SETUP
-#line 525 "./util/configlexer.lex"
-{ YDVAR(0, VAR_CACHEDB) }
+#line 526 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SLABS) }
 	YY_BREAK
 case 301:
 YY_RULE_SETUP
-#line 526 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHEDB_BACKEND) }
+#line 527 "./util/configlexer.lex"
+{ YDVAR(1, VAR_PAD_RESPONSES) }
 	YY_BREAK
 case 302:
 YY_RULE_SETUP
-#line 527 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHEDB_SECRETSEED) }
+#line 528 "./util/configlexer.lex"
+{ YDVAR(1, VAR_PAD_RESPONSES_BLOCK_SIZE) }
 	YY_BREAK
 case 303:
 YY_RULE_SETUP
-#line 528 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHEDB_REDISHOST) }
+#line 529 "./util/configlexer.lex"
+{ YDVAR(1, VAR_PAD_QUERIES) }
 	YY_BREAK
 case 304:
 YY_RULE_SETUP
-#line 529 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHEDB_REDISPORT) }
+#line 530 "./util/configlexer.lex"
+{ YDVAR(1, VAR_PAD_QUERIES_BLOCK_SIZE) }
 	YY_BREAK
 case 305:
 YY_RULE_SETUP
-#line 530 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHEDB_REDISTIMEOUT) }
+#line 531 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSECMOD_ENABLED) }
 	YY_BREAK
 case 306:
 YY_RULE_SETUP
-#line 531 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHEDB_REDISEXPIRERECORDS) }
+#line 532 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSECMOD_IGNORE_BOGUS) }
 	YY_BREAK
 case 307:
 YY_RULE_SETUP
-#line 532 "./util/configlexer.lex"
-{ YDVAR(0, VAR_IPSET) }
+#line 533 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSECMOD_HOOK) }
 	YY_BREAK
 case 308:
 YY_RULE_SETUP
-#line 533 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSET_NAME_V4) }
+#line 534 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSECMOD_MAX_TTL) }
 	YY_BREAK
 case 309:
 YY_RULE_SETUP
-#line 534 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IPSET_NAME_V6) }
+#line 535 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSECMOD_WHITELIST) }
 	YY_BREAK
 case 310:
 YY_RULE_SETUP
-#line 535 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM) }
+#line 536 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSECMOD_WHITELIST) }
 	YY_BREAK
 case 311:
 YY_RULE_SETUP
-#line 536 "./util/configlexer.lex"
-{ YDVAR(2, VAR_TCP_CONNECTION_LIMIT) }
+#line 537 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSECMOD_STRICT) }
 	YY_BREAK
 case 312:
 YY_RULE_SETUP
-#line 537 "./util/configlexer.lex"
-{ YDVAR(2, VAR_EDNS_CLIENT_STRING) }
+#line 538 "./util/configlexer.lex"
+{ YDVAR(0, VAR_CACHEDB) }
 	YY_BREAK
 case 313:
 YY_RULE_SETUP
-#line 538 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_CLIENT_STRING_OPCODE) }
+#line 539 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_BACKEND) }
 	YY_BREAK
 case 314:
 YY_RULE_SETUP
-#line 539 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NSID ) }
+#line 540 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_SECRETSEED) }
 	YY_BREAK
 case 315:
-/* rule 315 can match eol */
 YY_RULE_SETUP
-#line 540 "./util/configlexer.lex"
-{ LEXOUT(("NL\n")); cfg_parser->line++; }
+#line 541 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_WRITEBEHINDSIZE) }
 	YY_BREAK
-/* Quoted strings. Strip leading and ending quotes */
 case 316:
 YY_RULE_SETUP
+#line 542 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_WRITEBEHINDINTERVAL) }
+	YY_BREAK
+case 317:
+YY_RULE_SETUP
 #line 543 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_MMAPFILE) }
+	YY_BREAK
+case 318:
+YY_RULE_SETUP
+#line 544 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_MMAPSIZE) }
+	YY_BREAK
+case 319:
+YY_RULE_SETUP
+#line 545 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_REDISHOST) }
+	YY_BREAK
+case 320:
+YY_RULE_SETUP
+#line 546 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_REDISPORT) }
+	YY_BREAK
+case 321:
+YY_RULE_SETUP
+#line 547 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_REDISTIMEOUT) }
+	YY_BREAK
+case 322:
+YY_RULE_SETUP
+#line 548 "./util/configlexer.lex"
+{ YDVAR(1, VAR_CACHEDB_REDISEXPIRERECORDS) }
+	YY_BREAK
+case 323:
+YY_RULE_SETUP
+#line 549 "./util/configlexer.lex"
+{ YDVAR(0, VAR_IPSET) }
+	YY_BREAK
+case 324:
+YY_RULE_SETUP
+#line 550 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSET_NAME_V4) }
+	YY_BREAK
+case 325:
+YY_RULE_SETUP
+#line 551 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IPSET_NAME_V6) }
+	YY_BREAK
+case 326:
+YY_RULE_SETUP
+#line 552 "./util/configlexer.lex"
+{ YDVAR(1, VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM) }
+	YY_BREAK
+case 327:
+YY_RULE_SETUP
+#line 553 "./util/configlexer.lex"
+{ YDVAR(2, VAR_TCP_CONNECTION_LIMIT) }
+	YY_BREAK
+case 328:
+YY_RULE_SETUP
+#line 554 "./util/configlexer.lex"
+{ YDVAR(2, VAR_EDNS_CLIENT_STRING) }
+	YY_BREAK
+case 329:
+YY_RULE_SETUP
+#line 555 "./util/configlexer.lex"
+{ YDVAR(1, VAR_EDNS_CLIENT_STRING_OPCODE) }
+	YY_BREAK
+case 330:
+YY_RULE_SETUP
+#line 556 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NSID ) }
+	YY_BREAK
+case 331:
+/* rule 331 can match eol */
+YY_RULE_SETUP
+#line 557 "./util/configlexer.lex"
+{ LEXOUT(("NL\n")); cfg_parser->line++; }
+	YY_BREAK
+/* Quoted strings. Strip leading and ending quotes */
+case 332:
+YY_RULE_SETUP
+#line 560 "./util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 544 "./util/configlexer.lex"
+#line 561 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 317:
+case 333:
 YY_RULE_SETUP
-#line 549 "./util/configlexer.lex"
+#line 566 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 318:
-/* rule 318 can match eol */
+case 334:
+/* rule 334 can match eol */
 YY_RULE_SETUP
-#line 550 "./util/configlexer.lex"
+#line 567 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 319:
+case 335:
 YY_RULE_SETUP
-#line 552 "./util/configlexer.lex"
+#line 569 "./util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -5114,34 +4765,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 320:
+case 336:
 YY_RULE_SETUP
-#line 564 "./util/configlexer.lex"
+#line 581 "./util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 565 "./util/configlexer.lex"
+#line 582 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 321:
+case 337:
 YY_RULE_SETUP
-#line 570 "./util/configlexer.lex"
+#line 587 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 322:
-/* rule 322 can match eol */
+case 338:
+/* rule 338 can match eol */
 YY_RULE_SETUP
-#line 571 "./util/configlexer.lex"
+#line 588 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 323:
+case 339:
 YY_RULE_SETUP
-#line 573 "./util/configlexer.lex"
+#line 590 "./util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -5154,38 +4805,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 324:
+case 340:
 YY_RULE_SETUP
-#line 585 "./util/configlexer.lex"
+#line 602 "./util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 587 "./util/configlexer.lex"
+#line 604 "./util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 325:
+case 341:
 YY_RULE_SETUP
-#line 591 "./util/configlexer.lex"
+#line 608 "./util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 326:
-/* rule 326 can match eol */
+case 342:
+/* rule 342 can match eol */
 YY_RULE_SETUP
-#line 592 "./util/configlexer.lex"
+#line 609 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 327:
+case 343:
 YY_RULE_SETUP
-#line 593 "./util/configlexer.lex"
+#line 610 "./util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 328:
+case 344:
 YY_RULE_SETUP
-#line 594 "./util/configlexer.lex"
+#line 611 "./util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext, 0);
@@ -5193,27 +4844,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 599 "./util/configlexer.lex"
+#line 616 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 329:
+case 345:
 YY_RULE_SETUP
-#line 603 "./util/configlexer.lex"
+#line 620 "./util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 330:
-/* rule 330 can match eol */
+case 346:
+/* rule 346 can match eol */
 YY_RULE_SETUP
-#line 604 "./util/configlexer.lex"
+#line 621 "./util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 331:
+case 347:
 YY_RULE_SETUP
-#line 606 "./util/configlexer.lex"
+#line 623 "./util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -5223,7 +4874,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 612 "./util/configlexer.lex"
+#line 629 "./util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -5238,39 +4889,39 @@ case YY_STATE_EOF(val):
 }
 	YY_BREAK
 /* include-toplevel: directive */
-case 332:
+case 348:
 YY_RULE_SETUP
-#line 626 "./util/configlexer.lex"
+#line 643 "./util/configlexer.lex"
 {
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include_toplevel);
 }
 	YY_BREAK
 case YY_STATE_EOF(include_toplevel):
-#line 629 "./util/configlexer.lex"
+#line 646 "./util/configlexer.lex"
 {
 	yyerror("EOF inside include_toplevel directive");
 	BEGIN(inc_prev);
 }
 	YY_BREAK
-case 333:
+case 349:
 YY_RULE_SETUP
-#line 633 "./util/configlexer.lex"
+#line 650 "./util/configlexer.lex"
 { LEXOUT(("ITSP ")); /* ignore */ }
 	YY_BREAK
-case 334:
-/* rule 334 can match eol */
+case 350:
+/* rule 350 can match eol */
 YY_RULE_SETUP
-#line 634 "./util/configlexer.lex"
+#line 651 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
-case 335:
+case 351:
 YY_RULE_SETUP
-#line 635 "./util/configlexer.lex"
+#line 652 "./util/configlexer.lex"
 { LEXOUT(("ITQS ")); BEGIN(include_toplevel_quoted); }
 	YY_BREAK
-case 336:
+case 352:
 YY_RULE_SETUP
-#line 636 "./util/configlexer.lex"
+#line 653 "./util/configlexer.lex"
 {
 	LEXOUT(("ITunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext, 1);
@@ -5279,29 +4930,29 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_toplevel_quoted):
-#line 642 "./util/configlexer.lex"
+#line 659 "./util/configlexer.lex"
 {
 	yyerror("EOF inside quoted string");
 	BEGIN(inc_prev);
 }
 	YY_BREAK
-case 337:
+case 353:
 YY_RULE_SETUP
-#line 646 "./util/configlexer.lex"
+#line 663 "./util/configlexer.lex"
 { LEXOUT(("ITSTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 338:
-/* rule 338 can match eol */
+case 354:
+/* rule 354 can match eol */
 YY_RULE_SETUP
-#line 647 "./util/configlexer.lex"
+#line 664 "./util/configlexer.lex"
 {
 	yyerror("newline before \" in include name");
 	cfg_parser->line++; BEGIN(inc_prev);
 }
 	YY_BREAK
-case 339:
+case 355:
 YY_RULE_SETUP
-#line 651 "./util/configlexer.lex"
+#line 668 "./util/configlexer.lex"
 {
 	LEXOUT(("ITQE "));
 	yytext[yyleng - 1] = '\0';
@@ -5310,33 +4961,33 @@ YY_RULE_SETUP
 	return (VAR_FORCE_TOPLEVEL);
 }
 	YY_BREAK
-case 340:
+case 356:
 YY_RULE_SETUP
-#line 659 "./util/configlexer.lex"
+#line 676 "./util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 341:
+case 357:
 YY_RULE_SETUP
-#line 663 "./util/configlexer.lex"
+#line 680 "./util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 342:
+case 358:
 YY_RULE_SETUP
-#line 667 "./util/configlexer.lex"
+#line 684 "./util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 343:
+case 359:
 YY_RULE_SETUP
-#line 671 "./util/configlexer.lex"
+#line 688 "./util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 5337 "<stdout>"
+#line 4988 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -5631,7 +5282,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 3354 )
+			if ( yy_current_state >= 3519 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5659,11 +5310,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 3354 )
+		if ( yy_current_state >= 3519 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 3353);
+	yy_is_jam = (yy_current_state == 3518);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -6302,6 +5953,6 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 671 "./util/configlexer.lex"
+#line 688 "./util/configlexer.lex"
 
 
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.6.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -45,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.6.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -119,669 +119,7 @@ extern struct config_parser_state* cfg_parser;
 #  endif
 # endif
 
-/* Use api.header.include to #include this header
-   instead of duplicating it here.  */
-#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token kinds.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    YYEMPTY = -2,
-    YYEOF = 0,                     /* "end of file"  */
-    YYerror = 256,                 /* error  */
-    YYUNDEF = 257,                 /* "invalid token"  */
-    SPACE = 258,                   /* SPACE  */
-    LETTER = 259,                  /* LETTER  */
-    NEWLINE = 260,                 /* NEWLINE  */
-    COMMENT = 261,                 /* COMMENT  */
-    COLON = 262,                   /* COLON  */
-    ANY = 263,                     /* ANY  */
-    ZONESTR = 264,                 /* ZONESTR  */
-    STRING_ARG = 265,              /* STRING_ARG  */
-    VAR_FORCE_TOPLEVEL = 266,      /* VAR_FORCE_TOPLEVEL  */
-    VAR_SERVER = 267,              /* VAR_SERVER  */
-    VAR_VERBOSITY = 268,           /* VAR_VERBOSITY  */
-    VAR_NUM_THREADS = 269,         /* VAR_NUM_THREADS  */
-    VAR_PORT = 270,                /* VAR_PORT  */
-    VAR_OUTGOING_RANGE = 271,      /* VAR_OUTGOING_RANGE  */
-    VAR_INTERFACE = 272,           /* VAR_INTERFACE  */
-    VAR_PREFER_IP4 = 273,          /* VAR_PREFER_IP4  */
-    VAR_DO_IP4 = 274,              /* VAR_DO_IP4  */
-    VAR_DO_IP6 = 275,              /* VAR_DO_IP6  */
-    VAR_PREFER_IP6 = 276,          /* VAR_PREFER_IP6  */
-    VAR_DO_UDP = 277,              /* VAR_DO_UDP  */
-    VAR_DO_TCP = 278,              /* VAR_DO_TCP  */
-    VAR_TCP_MSS = 279,             /* VAR_TCP_MSS  */
-    VAR_OUTGOING_TCP_MSS = 280,    /* VAR_OUTGOING_TCP_MSS  */
-    VAR_TCP_IDLE_TIMEOUT = 281,    /* VAR_TCP_IDLE_TIMEOUT  */
-    VAR_EDNS_TCP_KEEPALIVE = 282,  /* VAR_EDNS_TCP_KEEPALIVE  */
-    VAR_EDNS_TCP_KEEPALIVE_TIMEOUT = 283, /* VAR_EDNS_TCP_KEEPALIVE_TIMEOUT  */
-    VAR_CHROOT = 284,              /* VAR_CHROOT  */
-    VAR_USERNAME = 285,            /* VAR_USERNAME  */
-    VAR_DIRECTORY = 286,           /* VAR_DIRECTORY  */
-    VAR_LOGFILE = 287,             /* VAR_LOGFILE  */
-    VAR_PIDFILE = 288,             /* VAR_PIDFILE  */
-    VAR_MSG_CACHE_SIZE = 289,      /* VAR_MSG_CACHE_SIZE  */
-    VAR_MSG_CACHE_SLABS = 290,     /* VAR_MSG_CACHE_SLABS  */
-    VAR_NUM_QUERIES_PER_THREAD = 291, /* VAR_NUM_QUERIES_PER_THREAD  */
-    VAR_RRSET_CACHE_SIZE = 292,    /* VAR_RRSET_CACHE_SIZE  */
-    VAR_RRSET_CACHE_SLABS = 293,   /* VAR_RRSET_CACHE_SLABS  */
-    VAR_OUTGOING_NUM_TCP = 294,    /* VAR_OUTGOING_NUM_TCP  */
-    VAR_INFRA_HOST_TTL = 295,      /* VAR_INFRA_HOST_TTL  */
-    VAR_INFRA_LAME_TTL = 296,      /* VAR_INFRA_LAME_TTL  */
-    VAR_INFRA_CACHE_SLABS = 297,   /* VAR_INFRA_CACHE_SLABS  */
-    VAR_INFRA_CACHE_NUMHOSTS = 298, /* VAR_INFRA_CACHE_NUMHOSTS  */
-    VAR_INFRA_CACHE_LAME_SIZE = 299, /* VAR_INFRA_CACHE_LAME_SIZE  */
-    VAR_NAME = 300,                /* VAR_NAME  */
-    VAR_STUB_ZONE = 301,           /* VAR_STUB_ZONE  */
-    VAR_STUB_HOST = 302,           /* VAR_STUB_HOST  */
-    VAR_STUB_ADDR = 303,           /* VAR_STUB_ADDR  */
-    VAR_TARGET_FETCH_POLICY = 304, /* VAR_TARGET_FETCH_POLICY  */
-    VAR_HARDEN_SHORT_BUFSIZE = 305, /* VAR_HARDEN_SHORT_BUFSIZE  */
-    VAR_HARDEN_LARGE_QUERIES = 306, /* VAR_HARDEN_LARGE_QUERIES  */
-    VAR_FORWARD_ZONE = 307,        /* VAR_FORWARD_ZONE  */
-    VAR_FORWARD_HOST = 308,        /* VAR_FORWARD_HOST  */
-    VAR_FORWARD_ADDR = 309,        /* VAR_FORWARD_ADDR  */
-    VAR_DO_NOT_QUERY_ADDRESS = 310, /* VAR_DO_NOT_QUERY_ADDRESS  */
-    VAR_HIDE_IDENTITY = 311,       /* VAR_HIDE_IDENTITY  */
-    VAR_HIDE_VERSION = 312,        /* VAR_HIDE_VERSION  */
-    VAR_IDENTITY = 313,            /* VAR_IDENTITY  */
-    VAR_VERSION = 314,             /* VAR_VERSION  */
-    VAR_HARDEN_GLUE = 315,         /* VAR_HARDEN_GLUE  */
-    VAR_MODULE_CONF = 316,         /* VAR_MODULE_CONF  */
-    VAR_TRUST_ANCHOR_FILE = 317,   /* VAR_TRUST_ANCHOR_FILE  */
-    VAR_TRUST_ANCHOR = 318,        /* VAR_TRUST_ANCHOR  */
-    VAR_VAL_OVERRIDE_DATE = 319,   /* VAR_VAL_OVERRIDE_DATE  */
-    VAR_BOGUS_TTL = 320,           /* VAR_BOGUS_TTL  */
-    VAR_VAL_CLEAN_ADDITIONAL = 321, /* VAR_VAL_CLEAN_ADDITIONAL  */
-    VAR_VAL_PERMISSIVE_MODE = 322, /* VAR_VAL_PERMISSIVE_MODE  */
-    VAR_INCOMING_NUM_TCP = 323,    /* VAR_INCOMING_NUM_TCP  */
-    VAR_MSG_BUFFER_SIZE = 324,     /* VAR_MSG_BUFFER_SIZE  */
-    VAR_KEY_CACHE_SIZE = 325,      /* VAR_KEY_CACHE_SIZE  */
-    VAR_KEY_CACHE_SLABS = 326,     /* VAR_KEY_CACHE_SLABS  */
-    VAR_TRUSTED_KEYS_FILE = 327,   /* VAR_TRUSTED_KEYS_FILE  */
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 328, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
-    VAR_USE_SYSLOG = 329,          /* VAR_USE_SYSLOG  */
-    VAR_OUTGOING_INTERFACE = 330,  /* VAR_OUTGOING_INTERFACE  */
-    VAR_ROOT_HINTS = 331,          /* VAR_ROOT_HINTS  */
-    VAR_DO_NOT_QUERY_LOCALHOST = 332, /* VAR_DO_NOT_QUERY_LOCALHOST  */
-    VAR_CACHE_MAX_TTL = 333,       /* VAR_CACHE_MAX_TTL  */
-    VAR_HARDEN_DNSSEC_STRIPPED = 334, /* VAR_HARDEN_DNSSEC_STRIPPED  */
-    VAR_ACCESS_CONTROL = 335,      /* VAR_ACCESS_CONTROL  */
-    VAR_LOCAL_ZONE = 336,          /* VAR_LOCAL_ZONE  */
-    VAR_LOCAL_DATA = 337,          /* VAR_LOCAL_DATA  */
-    VAR_INTERFACE_AUTOMATIC = 338, /* VAR_INTERFACE_AUTOMATIC  */
-    VAR_STATISTICS_INTERVAL = 339, /* VAR_STATISTICS_INTERVAL  */
-    VAR_DO_DAEMONIZE = 340,        /* VAR_DO_DAEMONIZE  */
-    VAR_USE_CAPS_FOR_ID = 341,     /* VAR_USE_CAPS_FOR_ID  */
-    VAR_STATISTICS_CUMULATIVE = 342, /* VAR_STATISTICS_CUMULATIVE  */
-    VAR_OUTGOING_PORT_PERMIT = 343, /* VAR_OUTGOING_PORT_PERMIT  */
-    VAR_OUTGOING_PORT_AVOID = 344, /* VAR_OUTGOING_PORT_AVOID  */
-    VAR_DLV_ANCHOR_FILE = 345,     /* VAR_DLV_ANCHOR_FILE  */
-    VAR_DLV_ANCHOR = 346,          /* VAR_DLV_ANCHOR  */
-    VAR_NEG_CACHE_SIZE = 347,      /* VAR_NEG_CACHE_SIZE  */
-    VAR_HARDEN_REFERRAL_PATH = 348, /* VAR_HARDEN_REFERRAL_PATH  */
-    VAR_PRIVATE_ADDRESS = 349,     /* VAR_PRIVATE_ADDRESS  */
-    VAR_PRIVATE_DOMAIN = 350,      /* VAR_PRIVATE_DOMAIN  */
-    VAR_REMOTE_CONTROL = 351,      /* VAR_REMOTE_CONTROL  */
-    VAR_CONTROL_ENABLE = 352,      /* VAR_CONTROL_ENABLE  */
-    VAR_CONTROL_INTERFACE = 353,   /* VAR_CONTROL_INTERFACE  */
-    VAR_CONTROL_PORT = 354,        /* VAR_CONTROL_PORT  */
-    VAR_SERVER_KEY_FILE = 355,     /* VAR_SERVER_KEY_FILE  */
-    VAR_SERVER_CERT_FILE = 356,    /* VAR_SERVER_CERT_FILE  */
-    VAR_CONTROL_KEY_FILE = 357,    /* VAR_CONTROL_KEY_FILE  */
-    VAR_CONTROL_CERT_FILE = 358,   /* VAR_CONTROL_CERT_FILE  */
-    VAR_CONTROL_USE_CERT = 359,    /* VAR_CONTROL_USE_CERT  */
-    VAR_EXTENDED_STATISTICS = 360, /* VAR_EXTENDED_STATISTICS  */
-    VAR_LOCAL_DATA_PTR = 361,      /* VAR_LOCAL_DATA_PTR  */
-    VAR_JOSTLE_TIMEOUT = 362,      /* VAR_JOSTLE_TIMEOUT  */
-    VAR_STUB_PRIME = 363,          /* VAR_STUB_PRIME  */
-    VAR_UNWANTED_REPLY_THRESHOLD = 364, /* VAR_UNWANTED_REPLY_THRESHOLD  */
-    VAR_LOG_TIME_ASCII = 365,      /* VAR_LOG_TIME_ASCII  */
-    VAR_DOMAIN_INSECURE = 366,     /* VAR_DOMAIN_INSECURE  */
-    VAR_PYTHON = 367,              /* VAR_PYTHON  */
-    VAR_PYTHON_SCRIPT = 368,       /* VAR_PYTHON_SCRIPT  */
-    VAR_VAL_SIG_SKEW_MIN = 369,    /* VAR_VAL_SIG_SKEW_MIN  */
-    VAR_VAL_SIG_SKEW_MAX = 370,    /* VAR_VAL_SIG_SKEW_MAX  */
-    VAR_CACHE_MIN_TTL = 371,       /* VAR_CACHE_MIN_TTL  */
-    VAR_VAL_LOG_LEVEL = 372,       /* VAR_VAL_LOG_LEVEL  */
-    VAR_AUTO_TRUST_ANCHOR_FILE = 373, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
-    VAR_KEEP_MISSING = 374,        /* VAR_KEEP_MISSING  */
-    VAR_ADD_HOLDDOWN = 375,        /* VAR_ADD_HOLDDOWN  */
-    VAR_DEL_HOLDDOWN = 376,        /* VAR_DEL_HOLDDOWN  */
-    VAR_SO_RCVBUF = 377,           /* VAR_SO_RCVBUF  */
-    VAR_EDNS_BUFFER_SIZE = 378,    /* VAR_EDNS_BUFFER_SIZE  */
-    VAR_PREFETCH = 379,            /* VAR_PREFETCH  */
-    VAR_PREFETCH_KEY = 380,        /* VAR_PREFETCH_KEY  */
-    VAR_SO_SNDBUF = 381,           /* VAR_SO_SNDBUF  */
-    VAR_SO_REUSEPORT = 382,        /* VAR_SO_REUSEPORT  */
-    VAR_HARDEN_BELOW_NXDOMAIN = 383, /* VAR_HARDEN_BELOW_NXDOMAIN  */
-    VAR_IGNORE_CD_FLAG = 384,      /* VAR_IGNORE_CD_FLAG  */
-    VAR_LOG_QUERIES = 385,         /* VAR_LOG_QUERIES  */
-    VAR_LOG_REPLIES = 386,         /* VAR_LOG_REPLIES  */
-    VAR_LOG_LOCAL_ACTIONS = 387,   /* VAR_LOG_LOCAL_ACTIONS  */
-    VAR_TCP_UPSTREAM = 388,        /* VAR_TCP_UPSTREAM  */
-    VAR_SSL_UPSTREAM = 389,        /* VAR_SSL_UPSTREAM  */
-    VAR_SSL_SERVICE_KEY = 390,     /* VAR_SSL_SERVICE_KEY  */
-    VAR_SSL_SERVICE_PEM = 391,     /* VAR_SSL_SERVICE_PEM  */
-    VAR_SSL_PORT = 392,            /* VAR_SSL_PORT  */
-    VAR_FORWARD_FIRST = 393,       /* VAR_FORWARD_FIRST  */
-    VAR_STUB_SSL_UPSTREAM = 394,   /* VAR_STUB_SSL_UPSTREAM  */
-    VAR_FORWARD_SSL_UPSTREAM = 395, /* VAR_FORWARD_SSL_UPSTREAM  */
-    VAR_TLS_CERT_BUNDLE = 396,     /* VAR_TLS_CERT_BUNDLE  */
-    VAR_HTTPS_PORT = 397,          /* VAR_HTTPS_PORT  */
-    VAR_HTTP_ENDPOINT = 398,       /* VAR_HTTP_ENDPOINT  */
-    VAR_HTTP_MAX_STREAMS = 399,    /* VAR_HTTP_MAX_STREAMS  */
-    VAR_HTTP_QUERY_BUFFER_SIZE = 400, /* VAR_HTTP_QUERY_BUFFER_SIZE  */
-    VAR_HTTP_RESPONSE_BUFFER_SIZE = 401, /* VAR_HTTP_RESPONSE_BUFFER_SIZE  */
-    VAR_HTTP_NODELAY = 402,        /* VAR_HTTP_NODELAY  */
-    VAR_HTTP_NOTLS_DOWNSTREAM = 403, /* VAR_HTTP_NOTLS_DOWNSTREAM  */
-    VAR_STUB_FIRST = 404,          /* VAR_STUB_FIRST  */
-    VAR_MINIMAL_RESPONSES = 405,   /* VAR_MINIMAL_RESPONSES  */
-    VAR_RRSET_ROUNDROBIN = 406,    /* VAR_RRSET_ROUNDROBIN  */
-    VAR_MAX_UDP_SIZE = 407,        /* VAR_MAX_UDP_SIZE  */
-    VAR_DELAY_CLOSE = 408,         /* VAR_DELAY_CLOSE  */
-    VAR_UDP_CONNECT = 409,         /* VAR_UDP_CONNECT  */
-    VAR_UNBLOCK_LAN_ZONES = 410,   /* VAR_UNBLOCK_LAN_ZONES  */
-    VAR_INSECURE_LAN_ZONES = 411,  /* VAR_INSECURE_LAN_ZONES  */
-    VAR_INFRA_CACHE_MIN_RTT = 412, /* VAR_INFRA_CACHE_MIN_RTT  */
-    VAR_INFRA_KEEP_PROBING = 413,  /* VAR_INFRA_KEEP_PROBING  */
-    VAR_DNS64_PREFIX = 414,        /* VAR_DNS64_PREFIX  */
-    VAR_DNS64_SYNTHALL = 415,      /* VAR_DNS64_SYNTHALL  */
-    VAR_DNS64_IGNORE_AAAA = 416,   /* VAR_DNS64_IGNORE_AAAA  */
-    VAR_DNSTAP = 417,              /* VAR_DNSTAP  */
-    VAR_DNSTAP_ENABLE = 418,       /* VAR_DNSTAP_ENABLE  */
-    VAR_DNSTAP_SOCKET_PATH = 419,  /* VAR_DNSTAP_SOCKET_PATH  */
-    VAR_DNSTAP_IP = 420,           /* VAR_DNSTAP_IP  */
-    VAR_DNSTAP_TLS = 421,          /* VAR_DNSTAP_TLS  */
-    VAR_DNSTAP_TLS_SERVER_NAME = 422, /* VAR_DNSTAP_TLS_SERVER_NAME  */
-    VAR_DNSTAP_TLS_CERT_BUNDLE = 423, /* VAR_DNSTAP_TLS_CERT_BUNDLE  */
-    VAR_DNSTAP_TLS_CLIENT_KEY_FILE = 424, /* VAR_DNSTAP_TLS_CLIENT_KEY_FILE  */
-    VAR_DNSTAP_TLS_CLIENT_CERT_FILE = 425, /* VAR_DNSTAP_TLS_CLIENT_CERT_FILE  */
-    VAR_DNSTAP_SEND_IDENTITY = 426, /* VAR_DNSTAP_SEND_IDENTITY  */
-    VAR_DNSTAP_SEND_VERSION = 427, /* VAR_DNSTAP_SEND_VERSION  */
-    VAR_DNSTAP_BIDIRECTIONAL = 428, /* VAR_DNSTAP_BIDIRECTIONAL  */
-    VAR_DNSTAP_IDENTITY = 429,     /* VAR_DNSTAP_IDENTITY  */
-    VAR_DNSTAP_VERSION = 430,      /* VAR_DNSTAP_VERSION  */
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 431, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 432, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 433, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 434, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 435, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 436, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
-    VAR_RESPONSE_IP_TAG = 437,     /* VAR_RESPONSE_IP_TAG  */
-    VAR_RESPONSE_IP = 438,         /* VAR_RESPONSE_IP  */
-    VAR_RESPONSE_IP_DATA = 439,    /* VAR_RESPONSE_IP_DATA  */
-    VAR_HARDEN_ALGO_DOWNGRADE = 440, /* VAR_HARDEN_ALGO_DOWNGRADE  */
-    VAR_IP_TRANSPARENT = 441,      /* VAR_IP_TRANSPARENT  */
-    VAR_IP_DSCP = 442,             /* VAR_IP_DSCP  */
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 443, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
-    VAR_IP_RATELIMIT = 444,        /* VAR_IP_RATELIMIT  */
-    VAR_IP_RATELIMIT_SLABS = 445,  /* VAR_IP_RATELIMIT_SLABS  */
-    VAR_IP_RATELIMIT_SIZE = 446,   /* VAR_IP_RATELIMIT_SIZE  */
-    VAR_RATELIMIT = 447,           /* VAR_RATELIMIT  */
-    VAR_RATELIMIT_SLABS = 448,     /* VAR_RATELIMIT_SLABS  */
-    VAR_RATELIMIT_SIZE = 449,      /* VAR_RATELIMIT_SIZE  */
-    VAR_RATELIMIT_FOR_DOMAIN = 450, /* VAR_RATELIMIT_FOR_DOMAIN  */
-    VAR_RATELIMIT_BELOW_DOMAIN = 451, /* VAR_RATELIMIT_BELOW_DOMAIN  */
-    VAR_IP_RATELIMIT_FACTOR = 452, /* VAR_IP_RATELIMIT_FACTOR  */
-    VAR_RATELIMIT_FACTOR = 453,    /* VAR_RATELIMIT_FACTOR  */
-    VAR_SEND_CLIENT_SUBNET = 454,  /* VAR_SEND_CLIENT_SUBNET  */
-    VAR_CLIENT_SUBNET_ZONE = 455,  /* VAR_CLIENT_SUBNET_ZONE  */
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 456, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
-    VAR_CLIENT_SUBNET_OPCODE = 457, /* VAR_CLIENT_SUBNET_OPCODE  */
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 458, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 459, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
-    VAR_MIN_CLIENT_SUBNET_IPV4 = 460, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
-    VAR_MIN_CLIENT_SUBNET_IPV6 = 461, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
-    VAR_MAX_ECS_TREE_SIZE_IPV4 = 462, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
-    VAR_MAX_ECS_TREE_SIZE_IPV6 = 463, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
-    VAR_CAPS_WHITELIST = 464,      /* VAR_CAPS_WHITELIST  */
-    VAR_CACHE_MAX_NEGATIVE_TTL = 465, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
-    VAR_PERMIT_SMALL_HOLDDOWN = 466, /* VAR_PERMIT_SMALL_HOLDDOWN  */
-    VAR_QNAME_MINIMISATION = 467,  /* VAR_QNAME_MINIMISATION  */
-    VAR_QNAME_MINIMISATION_STRICT = 468, /* VAR_QNAME_MINIMISATION_STRICT  */
-    VAR_IP_FREEBIND = 469,         /* VAR_IP_FREEBIND  */
-    VAR_DEFINE_TAG = 470,          /* VAR_DEFINE_TAG  */
-    VAR_LOCAL_ZONE_TAG = 471,      /* VAR_LOCAL_ZONE_TAG  */
-    VAR_ACCESS_CONTROL_TAG = 472,  /* VAR_ACCESS_CONTROL_TAG  */
-    VAR_LOCAL_ZONE_OVERRIDE = 473, /* VAR_LOCAL_ZONE_OVERRIDE  */
-    VAR_ACCESS_CONTROL_TAG_ACTION = 474, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
-    VAR_ACCESS_CONTROL_TAG_DATA = 475, /* VAR_ACCESS_CONTROL_TAG_DATA  */
-    VAR_VIEW = 476,                /* VAR_VIEW  */
-    VAR_ACCESS_CONTROL_VIEW = 477, /* VAR_ACCESS_CONTROL_VIEW  */
-    VAR_VIEW_FIRST = 478,          /* VAR_VIEW_FIRST  */
-    VAR_SERVE_EXPIRED = 479,       /* VAR_SERVE_EXPIRED  */
-    VAR_SERVE_EXPIRED_TTL = 480,   /* VAR_SERVE_EXPIRED_TTL  */
-    VAR_SERVE_EXPIRED_TTL_RESET = 481, /* VAR_SERVE_EXPIRED_TTL_RESET  */
-    VAR_SERVE_EXPIRED_REPLY_TTL = 482, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
-    VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 483, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
-    VAR_SERVE_ORIGINAL_TTL = 484,  /* VAR_SERVE_ORIGINAL_TTL  */
-    VAR_FAKE_DSA = 485,            /* VAR_FAKE_DSA  */
-    VAR_FAKE_SHA1 = 486,           /* VAR_FAKE_SHA1  */
-    VAR_LOG_IDENTITY = 487,        /* VAR_LOG_IDENTITY  */
-    VAR_HIDE_TRUSTANCHOR = 488,    /* VAR_HIDE_TRUSTANCHOR  */
-    VAR_TRUST_ANCHOR_SIGNALING = 489, /* VAR_TRUST_ANCHOR_SIGNALING  */
-    VAR_AGGRESSIVE_NSEC = 490,     /* VAR_AGGRESSIVE_NSEC  */
-    VAR_USE_SYSTEMD = 491,         /* VAR_USE_SYSTEMD  */
-    VAR_SHM_ENABLE = 492,          /* VAR_SHM_ENABLE  */
-    VAR_SHM_KEY = 493,             /* VAR_SHM_KEY  */
-    VAR_ROOT_KEY_SENTINEL = 494,   /* VAR_ROOT_KEY_SENTINEL  */
-    VAR_DNSCRYPT = 495,            /* VAR_DNSCRYPT  */
-    VAR_DNSCRYPT_ENABLE = 496,     /* VAR_DNSCRYPT_ENABLE  */
-    VAR_DNSCRYPT_PORT = 497,       /* VAR_DNSCRYPT_PORT  */
-    VAR_DNSCRYPT_PROVIDER = 498,   /* VAR_DNSCRYPT_PROVIDER  */
-    VAR_DNSCRYPT_SECRET_KEY = 499, /* VAR_DNSCRYPT_SECRET_KEY  */
-    VAR_DNSCRYPT_PROVIDER_CERT = 500, /* VAR_DNSCRYPT_PROVIDER_CERT  */
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 501, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 502, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 503, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 504, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 505, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
-    VAR_PAD_RESPONSES = 506,       /* VAR_PAD_RESPONSES  */
-    VAR_PAD_RESPONSES_BLOCK_SIZE = 507, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
-    VAR_PAD_QUERIES = 508,         /* VAR_PAD_QUERIES  */
-    VAR_PAD_QUERIES_BLOCK_SIZE = 509, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
-    VAR_IPSECMOD_ENABLED = 510,    /* VAR_IPSECMOD_ENABLED  */
-    VAR_IPSECMOD_HOOK = 511,       /* VAR_IPSECMOD_HOOK  */
-    VAR_IPSECMOD_IGNORE_BOGUS = 512, /* VAR_IPSECMOD_IGNORE_BOGUS  */
-    VAR_IPSECMOD_MAX_TTL = 513,    /* VAR_IPSECMOD_MAX_TTL  */
-    VAR_IPSECMOD_WHITELIST = 514,  /* VAR_IPSECMOD_WHITELIST  */
-    VAR_IPSECMOD_STRICT = 515,     /* VAR_IPSECMOD_STRICT  */
-    VAR_CACHEDB = 516,             /* VAR_CACHEDB  */
-    VAR_CACHEDB_BACKEND = 517,     /* VAR_CACHEDB_BACKEND  */
-    VAR_CACHEDB_SECRETSEED = 518,  /* VAR_CACHEDB_SECRETSEED  */
-    VAR_CACHEDB_REDISHOST = 519,   /* VAR_CACHEDB_REDISHOST  */
-    VAR_CACHEDB_REDISPORT = 520,   /* VAR_CACHEDB_REDISPORT  */
-    VAR_CACHEDB_REDISTIMEOUT = 521, /* VAR_CACHEDB_REDISTIMEOUT  */
-    VAR_CACHEDB_REDISEXPIRERECORDS = 522, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 523, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
-    VAR_FOR_UPSTREAM = 524,        /* VAR_FOR_UPSTREAM  */
-    VAR_AUTH_ZONE = 525,           /* VAR_AUTH_ZONE  */
-    VAR_ZONEFILE = 526,            /* VAR_ZONEFILE  */
-    VAR_MASTER = 527,              /* VAR_MASTER  */
-    VAR_URL = 528,                 /* VAR_URL  */
-    VAR_FOR_DOWNSTREAM = 529,      /* VAR_FOR_DOWNSTREAM  */
-    VAR_FALLBACK_ENABLED = 530,    /* VAR_FALLBACK_ENABLED  */
-    VAR_TLS_ADDITIONAL_PORT = 531, /* VAR_TLS_ADDITIONAL_PORT  */
-    VAR_LOW_RTT = 532,             /* VAR_LOW_RTT  */
-    VAR_LOW_RTT_PERMIL = 533,      /* VAR_LOW_RTT_PERMIL  */
-    VAR_FAST_SERVER_PERMIL = 534,  /* VAR_FAST_SERVER_PERMIL  */
-    VAR_FAST_SERVER_NUM = 535,     /* VAR_FAST_SERVER_NUM  */
-    VAR_ALLOW_NOTIFY = 536,        /* VAR_ALLOW_NOTIFY  */
-    VAR_TLS_WIN_CERT = 537,        /* VAR_TLS_WIN_CERT  */
-    VAR_TCP_CONNECTION_LIMIT = 538, /* VAR_TCP_CONNECTION_LIMIT  */
-    VAR_FORWARD_NO_CACHE = 539,    /* VAR_FORWARD_NO_CACHE  */
-    VAR_STUB_NO_CACHE = 540,       /* VAR_STUB_NO_CACHE  */
-    VAR_LOG_SERVFAIL = 541,        /* VAR_LOG_SERVFAIL  */
-    VAR_DENY_ANY = 542,            /* VAR_DENY_ANY  */
-    VAR_UNKNOWN_SERVER_TIME_LIMIT = 543, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
-    VAR_LOG_TAG_QUERYREPLY = 544,  /* VAR_LOG_TAG_QUERYREPLY  */
-    VAR_STREAM_WAIT_SIZE = 545,    /* VAR_STREAM_WAIT_SIZE  */
-    VAR_TLS_CIPHERS = 546,         /* VAR_TLS_CIPHERS  */
-    VAR_TLS_CIPHERSUITES = 547,    /* VAR_TLS_CIPHERSUITES  */
-    VAR_TLS_USE_SNI = 548,         /* VAR_TLS_USE_SNI  */
-    VAR_IPSET = 549,               /* VAR_IPSET  */
-    VAR_IPSET_NAME_V4 = 550,       /* VAR_IPSET_NAME_V4  */
-    VAR_IPSET_NAME_V6 = 551,       /* VAR_IPSET_NAME_V6  */
-    VAR_TLS_SESSION_TICKET_KEYS = 552, /* VAR_TLS_SESSION_TICKET_KEYS  */
-    VAR_RPZ = 553,                 /* VAR_RPZ  */
-    VAR_TAGS = 554,                /* VAR_TAGS  */
-    VAR_RPZ_ACTION_OVERRIDE = 555, /* VAR_RPZ_ACTION_OVERRIDE  */
-    VAR_RPZ_CNAME_OVERRIDE = 556,  /* VAR_RPZ_CNAME_OVERRIDE  */
-    VAR_RPZ_LOG = 557,             /* VAR_RPZ_LOG  */
-    VAR_RPZ_LOG_NAME = 558,        /* VAR_RPZ_LOG_NAME  */
-    VAR_DYNLIB = 559,              /* VAR_DYNLIB  */
-    VAR_DYNLIB_FILE = 560,         /* VAR_DYNLIB_FILE  */
-    VAR_EDNS_CLIENT_STRING = 561,  /* VAR_EDNS_CLIENT_STRING  */
-    VAR_EDNS_CLIENT_STRING_OPCODE = 562, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
-    VAR_NSID = 563                 /* VAR_NSID  */
-  };
-  typedef enum yytokentype yytoken_kind_t;
-#endif
-/* Token kinds.  */
-#define YYEOF 0
-#define YYerror 256
-#define YYUNDEF 257
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_FORCE_TOPLEVEL 266
-#define VAR_SERVER 267
-#define VAR_VERBOSITY 268
-#define VAR_NUM_THREADS 269
-#define VAR_PORT 270
-#define VAR_OUTGOING_RANGE 271
-#define VAR_INTERFACE 272
-#define VAR_PREFER_IP4 273
-#define VAR_DO_IP4 274
-#define VAR_DO_IP6 275
-#define VAR_PREFER_IP6 276
-#define VAR_DO_UDP 277
-#define VAR_DO_TCP 278
-#define VAR_TCP_MSS 279
-#define VAR_OUTGOING_TCP_MSS 280
-#define VAR_TCP_IDLE_TIMEOUT 281
-#define VAR_EDNS_TCP_KEEPALIVE 282
-#define VAR_EDNS_TCP_KEEPALIVE_TIMEOUT 283
-#define VAR_CHROOT 284
-#define VAR_USERNAME 285
-#define VAR_DIRECTORY 286
-#define VAR_LOGFILE 287
-#define VAR_PIDFILE 288
-#define VAR_MSG_CACHE_SIZE 289
-#define VAR_MSG_CACHE_SLABS 290
-#define VAR_NUM_QUERIES_PER_THREAD 291
-#define VAR_RRSET_CACHE_SIZE 292
-#define VAR_RRSET_CACHE_SLABS 293
-#define VAR_OUTGOING_NUM_TCP 294
-#define VAR_INFRA_HOST_TTL 295
-#define VAR_INFRA_LAME_TTL 296
-#define VAR_INFRA_CACHE_SLABS 297
-#define VAR_INFRA_CACHE_NUMHOSTS 298
-#define VAR_INFRA_CACHE_LAME_SIZE 299
-#define VAR_NAME 300
-#define VAR_STUB_ZONE 301
-#define VAR_STUB_HOST 302
-#define VAR_STUB_ADDR 303
-#define VAR_TARGET_FETCH_POLICY 304
-#define VAR_HARDEN_SHORT_BUFSIZE 305
-#define VAR_HARDEN_LARGE_QUERIES 306
-#define VAR_FORWARD_ZONE 307
-#define VAR_FORWARD_HOST 308
-#define VAR_FORWARD_ADDR 309
-#define VAR_DO_NOT_QUERY_ADDRESS 310
-#define VAR_HIDE_IDENTITY 311
-#define VAR_HIDE_VERSION 312
-#define VAR_IDENTITY 313
-#define VAR_VERSION 314
-#define VAR_HARDEN_GLUE 315
-#define VAR_MODULE_CONF 316
-#define VAR_TRUST_ANCHOR_FILE 317
-#define VAR_TRUST_ANCHOR 318
-#define VAR_VAL_OVERRIDE_DATE 319
-#define VAR_BOGUS_TTL 320
-#define VAR_VAL_CLEAN_ADDITIONAL 321
-#define VAR_VAL_PERMISSIVE_MODE 322
-#define VAR_INCOMING_NUM_TCP 323
-#define VAR_MSG_BUFFER_SIZE 324
-#define VAR_KEY_CACHE_SIZE 325
-#define VAR_KEY_CACHE_SLABS 326
-#define VAR_TRUSTED_KEYS_FILE 327
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 328
-#define VAR_USE_SYSLOG 329
-#define VAR_OUTGOING_INTERFACE 330
-#define VAR_ROOT_HINTS 331
-#define VAR_DO_NOT_QUERY_LOCALHOST 332
-#define VAR_CACHE_MAX_TTL 333
-#define VAR_HARDEN_DNSSEC_STRIPPED 334
-#define VAR_ACCESS_CONTROL 335
-#define VAR_LOCAL_ZONE 336
-#define VAR_LOCAL_DATA 337
-#define VAR_INTERFACE_AUTOMATIC 338
-#define VAR_STATISTICS_INTERVAL 339
-#define VAR_DO_DAEMONIZE 340
-#define VAR_USE_CAPS_FOR_ID 341
-#define VAR_STATISTICS_CUMULATIVE 342
-#define VAR_OUTGOING_PORT_PERMIT 343
-#define VAR_OUTGOING_PORT_AVOID 344
-#define VAR_DLV_ANCHOR_FILE 345
-#define VAR_DLV_ANCHOR 346
-#define VAR_NEG_CACHE_SIZE 347
-#define VAR_HARDEN_REFERRAL_PATH 348
-#define VAR_PRIVATE_ADDRESS 349
-#define VAR_PRIVATE_DOMAIN 350
-#define VAR_REMOTE_CONTROL 351
-#define VAR_CONTROL_ENABLE 352
-#define VAR_CONTROL_INTERFACE 353
-#define VAR_CONTROL_PORT 354
-#define VAR_SERVER_KEY_FILE 355
-#define VAR_SERVER_CERT_FILE 356
-#define VAR_CONTROL_KEY_FILE 357
-#define VAR_CONTROL_CERT_FILE 358
-#define VAR_CONTROL_USE_CERT 359
-#define VAR_EXTENDED_STATISTICS 360
-#define VAR_LOCAL_DATA_PTR 361
-#define VAR_JOSTLE_TIMEOUT 362
-#define VAR_STUB_PRIME 363
-#define VAR_UNWANTED_REPLY_THRESHOLD 364
-#define VAR_LOG_TIME_ASCII 365
-#define VAR_DOMAIN_INSECURE 366
-#define VAR_PYTHON 367
-#define VAR_PYTHON_SCRIPT 368
-#define VAR_VAL_SIG_SKEW_MIN 369
-#define VAR_VAL_SIG_SKEW_MAX 370
-#define VAR_CACHE_MIN_TTL 371
-#define VAR_VAL_LOG_LEVEL 372
-#define VAR_AUTO_TRUST_ANCHOR_FILE 373
-#define VAR_KEEP_MISSING 374
-#define VAR_ADD_HOLDDOWN 375
-#define VAR_DEL_HOLDDOWN 376
-#define VAR_SO_RCVBUF 377
-#define VAR_EDNS_BUFFER_SIZE 378
-#define VAR_PREFETCH 379
-#define VAR_PREFETCH_KEY 380
-#define VAR_SO_SNDBUF 381
-#define VAR_SO_REUSEPORT 382
-#define VAR_HARDEN_BELOW_NXDOMAIN 383
-#define VAR_IGNORE_CD_FLAG 384
-#define VAR_LOG_QUERIES 385
-#define VAR_LOG_REPLIES 386
-#define VAR_LOG_LOCAL_ACTIONS 387
-#define VAR_TCP_UPSTREAM 388
-#define VAR_SSL_UPSTREAM 389
-#define VAR_SSL_SERVICE_KEY 390
-#define VAR_SSL_SERVICE_PEM 391
-#define VAR_SSL_PORT 392
-#define VAR_FORWARD_FIRST 393
-#define VAR_STUB_SSL_UPSTREAM 394
-#define VAR_FORWARD_SSL_UPSTREAM 395
-#define VAR_TLS_CERT_BUNDLE 396
-#define VAR_HTTPS_PORT 397
-#define VAR_HTTP_ENDPOINT 398
-#define VAR_HTTP_MAX_STREAMS 399
-#define VAR_HTTP_QUERY_BUFFER_SIZE 400
-#define VAR_HTTP_RESPONSE_BUFFER_SIZE 401
-#define VAR_HTTP_NODELAY 402
-#define VAR_HTTP_NOTLS_DOWNSTREAM 403
-#define VAR_STUB_FIRST 404
-#define VAR_MINIMAL_RESPONSES 405
-#define VAR_RRSET_ROUNDROBIN 406
-#define VAR_MAX_UDP_SIZE 407
-#define VAR_DELAY_CLOSE 408
-#define VAR_UDP_CONNECT 409
-#define VAR_UNBLOCK_LAN_ZONES 410
-#define VAR_INSECURE_LAN_ZONES 411
-#define VAR_INFRA_CACHE_MIN_RTT 412
-#define VAR_INFRA_KEEP_PROBING 413
-#define VAR_DNS64_PREFIX 414
-#define VAR_DNS64_SYNTHALL 415
-#define VAR_DNS64_IGNORE_AAAA 416
-#define VAR_DNSTAP 417
-#define VAR_DNSTAP_ENABLE 418
-#define VAR_DNSTAP_SOCKET_PATH 419
-#define VAR_DNSTAP_IP 420
-#define VAR_DNSTAP_TLS 421
-#define VAR_DNSTAP_TLS_SERVER_NAME 422
-#define VAR_DNSTAP_TLS_CERT_BUNDLE 423
-#define VAR_DNSTAP_TLS_CLIENT_KEY_FILE 424
-#define VAR_DNSTAP_TLS_CLIENT_CERT_FILE 425
-#define VAR_DNSTAP_SEND_IDENTITY 426
-#define VAR_DNSTAP_SEND_VERSION 427
-#define VAR_DNSTAP_BIDIRECTIONAL 428
-#define VAR_DNSTAP_IDENTITY 429
-#define VAR_DNSTAP_VERSION 430
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 431
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 432
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 433
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 434
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 435
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 436
-#define VAR_RESPONSE_IP_TAG 437
-#define VAR_RESPONSE_IP 438
-#define VAR_RESPONSE_IP_DATA 439
-#define VAR_HARDEN_ALGO_DOWNGRADE 440
-#define VAR_IP_TRANSPARENT 441
-#define VAR_IP_DSCP 442
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 443
-#define VAR_IP_RATELIMIT 444
-#define VAR_IP_RATELIMIT_SLABS 445
-#define VAR_IP_RATELIMIT_SIZE 446
-#define VAR_RATELIMIT 447
-#define VAR_RATELIMIT_SLABS 448
-#define VAR_RATELIMIT_SIZE 449
-#define VAR_RATELIMIT_FOR_DOMAIN 450
-#define VAR_RATELIMIT_BELOW_DOMAIN 451
-#define VAR_IP_RATELIMIT_FACTOR 452
-#define VAR_RATELIMIT_FACTOR 453
-#define VAR_SEND_CLIENT_SUBNET 454
-#define VAR_CLIENT_SUBNET_ZONE 455
-#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 456
-#define VAR_CLIENT_SUBNET_OPCODE 457
-#define VAR_MAX_CLIENT_SUBNET_IPV4 458
-#define VAR_MAX_CLIENT_SUBNET_IPV6 459
-#define VAR_MIN_CLIENT_SUBNET_IPV4 460
-#define VAR_MIN_CLIENT_SUBNET_IPV6 461
-#define VAR_MAX_ECS_TREE_SIZE_IPV4 462
-#define VAR_MAX_ECS_TREE_SIZE_IPV6 463
-#define VAR_CAPS_WHITELIST 464
-#define VAR_CACHE_MAX_NEGATIVE_TTL 465
-#define VAR_PERMIT_SMALL_HOLDDOWN 466
-#define VAR_QNAME_MINIMISATION 467
-#define VAR_QNAME_MINIMISATION_STRICT 468
-#define VAR_IP_FREEBIND 469
-#define VAR_DEFINE_TAG 470
-#define VAR_LOCAL_ZONE_TAG 471
-#define VAR_ACCESS_CONTROL_TAG 472
-#define VAR_LOCAL_ZONE_OVERRIDE 473
-#define VAR_ACCESS_CONTROL_TAG_ACTION 474
-#define VAR_ACCESS_CONTROL_TAG_DATA 475
-#define VAR_VIEW 476
-#define VAR_ACCESS_CONTROL_VIEW 477
-#define VAR_VIEW_FIRST 478
-#define VAR_SERVE_EXPIRED 479
-#define VAR_SERVE_EXPIRED_TTL 480
-#define VAR_SERVE_EXPIRED_TTL_RESET 481
-#define VAR_SERVE_EXPIRED_REPLY_TTL 482
-#define VAR_SERVE_EXPIRED_CLIENT_TIMEOUT 483
-#define VAR_SERVE_ORIGINAL_TTL 484
-#define VAR_FAKE_DSA 485
-#define VAR_FAKE_SHA1 486
-#define VAR_LOG_IDENTITY 487
-#define VAR_HIDE_TRUSTANCHOR 488
-#define VAR_TRUST_ANCHOR_SIGNALING 489
-#define VAR_AGGRESSIVE_NSEC 490
-#define VAR_USE_SYSTEMD 491
-#define VAR_SHM_ENABLE 492
-#define VAR_SHM_KEY 493
-#define VAR_ROOT_KEY_SENTINEL 494
-#define VAR_DNSCRYPT 495
-#define VAR_DNSCRYPT_ENABLE 496
-#define VAR_DNSCRYPT_PORT 497
-#define VAR_DNSCRYPT_PROVIDER 498
-#define VAR_DNSCRYPT_SECRET_KEY 499
-#define VAR_DNSCRYPT_PROVIDER_CERT 500
-#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 501
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 502
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 503
-#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 504
-#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 505
-#define VAR_PAD_RESPONSES 506
-#define VAR_PAD_RESPONSES_BLOCK_SIZE 507
-#define VAR_PAD_QUERIES 508
-#define VAR_PAD_QUERIES_BLOCK_SIZE 509
-#define VAR_IPSECMOD_ENABLED 510
-#define VAR_IPSECMOD_HOOK 511
-#define VAR_IPSECMOD_IGNORE_BOGUS 512
-#define VAR_IPSECMOD_MAX_TTL 513
-#define VAR_IPSECMOD_WHITELIST 514
-#define VAR_IPSECMOD_STRICT 515
-#define VAR_CACHEDB 516
-#define VAR_CACHEDB_BACKEND 517
-#define VAR_CACHEDB_SECRETSEED 518
-#define VAR_CACHEDB_REDISHOST 519
-#define VAR_CACHEDB_REDISPORT 520
-#define VAR_CACHEDB_REDISTIMEOUT 521
-#define VAR_CACHEDB_REDISEXPIRERECORDS 522
-#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 523
-#define VAR_FOR_UPSTREAM 524
-#define VAR_AUTH_ZONE 525
-#define VAR_ZONEFILE 526
-#define VAR_MASTER 527
-#define VAR_URL 528
-#define VAR_FOR_DOWNSTREAM 529
-#define VAR_FALLBACK_ENABLED 530
-#define VAR_TLS_ADDITIONAL_PORT 531
-#define VAR_LOW_RTT 532
-#define VAR_LOW_RTT_PERMIL 533
-#define VAR_FAST_SERVER_PERMIL 534
-#define VAR_FAST_SERVER_NUM 535
-#define VAR_ALLOW_NOTIFY 536
-#define VAR_TLS_WIN_CERT 537
-#define VAR_TCP_CONNECTION_LIMIT 538
-#define VAR_FORWARD_NO_CACHE 539
-#define VAR_STUB_NO_CACHE 540
-#define VAR_LOG_SERVFAIL 541
-#define VAR_DENY_ANY 542
-#define VAR_UNKNOWN_SERVER_TIME_LIMIT 543
-#define VAR_LOG_TAG_QUERYREPLY 544
-#define VAR_STREAM_WAIT_SIZE 545
-#define VAR_TLS_CIPHERS 546
-#define VAR_TLS_CIPHERSUITES 547
-#define VAR_TLS_USE_SNI 548
-#define VAR_IPSET 549
-#define VAR_IPSET_NAME_V4 550
-#define VAR_IPSET_NAME_V6 551
-#define VAR_TLS_SESSION_TICKET_KEYS 552
-#define VAR_RPZ 553
-#define VAR_TAGS 554
-#define VAR_RPZ_ACTION_OVERRIDE 555
-#define VAR_RPZ_CNAME_OVERRIDE 556
-#define VAR_RPZ_LOG 557
-#define VAR_RPZ_LOG_NAME 558
-#define VAR_DYNLIB 559
-#define VAR_DYNLIB_FILE 560
-#define VAR_EDNS_CLIENT_STRING 561
-#define VAR_EDNS_CLIENT_STRING_OPCODE 562
-#define VAR_NSID 563
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-union YYSTYPE
-{
-#line 66 "./util/configparser.y"
-
-	char*	str;
-
-#line 772 "util/configparser.c"
-
-};
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
-
-
-extern YYSTYPE yylval;
-
-int yyparse (void);
-
-#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
+#include "configparser.h"
 /* Symbol kind.  */
 enum yysymbol_kind_t
 {
@@ -968,467 +306,499 @@ enum yysymbol_kind_t
   YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 179, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
   YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 180, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
   YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 181, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
-  YYSYMBOL_VAR_RESPONSE_IP_TAG = 182,      /* VAR_RESPONSE_IP_TAG  */
-  YYSYMBOL_VAR_RESPONSE_IP = 183,          /* VAR_RESPONSE_IP  */
-  YYSYMBOL_VAR_RESPONSE_IP_DATA = 184,     /* VAR_RESPONSE_IP_DATA  */
-  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 185, /* VAR_HARDEN_ALGO_DOWNGRADE  */
-  YYSYMBOL_VAR_IP_TRANSPARENT = 186,       /* VAR_IP_TRANSPARENT  */
-  YYSYMBOL_VAR_IP_DSCP = 187,              /* VAR_IP_DSCP  */
-  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 188, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
-  YYSYMBOL_VAR_IP_RATELIMIT = 189,         /* VAR_IP_RATELIMIT  */
-  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 190,   /* VAR_IP_RATELIMIT_SLABS  */
-  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 191,    /* VAR_IP_RATELIMIT_SIZE  */
-  YYSYMBOL_VAR_RATELIMIT = 192,            /* VAR_RATELIMIT  */
-  YYSYMBOL_VAR_RATELIMIT_SLABS = 193,      /* VAR_RATELIMIT_SLABS  */
-  YYSYMBOL_VAR_RATELIMIT_SIZE = 194,       /* VAR_RATELIMIT_SIZE  */
-  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 195, /* VAR_RATELIMIT_FOR_DOMAIN  */
-  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 196, /* VAR_RATELIMIT_BELOW_DOMAIN  */
-  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 197,  /* VAR_IP_RATELIMIT_FACTOR  */
-  YYSYMBOL_VAR_RATELIMIT_FACTOR = 198,     /* VAR_RATELIMIT_FACTOR  */
-  YYSYMBOL_VAR_SEND_CLIENT_SUBNET = 199,   /* VAR_SEND_CLIENT_SUBNET  */
-  YYSYMBOL_VAR_CLIENT_SUBNET_ZONE = 200,   /* VAR_CLIENT_SUBNET_ZONE  */
-  YYSYMBOL_VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 201, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
-  YYSYMBOL_VAR_CLIENT_SUBNET_OPCODE = 202, /* VAR_CLIENT_SUBNET_OPCODE  */
-  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV4 = 203, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
-  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV6 = 204, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
-  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV4 = 205, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
-  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV6 = 206, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
-  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV4 = 207, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
-  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV6 = 208, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
-  YYSYMBOL_VAR_CAPS_WHITELIST = 209,       /* VAR_CAPS_WHITELIST  */
-  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 210, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
-  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 211, /* VAR_PERMIT_SMALL_HOLDDOWN  */
-  YYSYMBOL_VAR_QNAME_MINIMISATION = 212,   /* VAR_QNAME_MINIMISATION  */
-  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 213, /* VAR_QNAME_MINIMISATION_STRICT  */
-  YYSYMBOL_VAR_IP_FREEBIND = 214,          /* VAR_IP_FREEBIND  */
-  YYSYMBOL_VAR_DEFINE_TAG = 215,           /* VAR_DEFINE_TAG  */
-  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 216,       /* VAR_LOCAL_ZONE_TAG  */
-  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 217,   /* VAR_ACCESS_CONTROL_TAG  */
-  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 218,  /* VAR_LOCAL_ZONE_OVERRIDE  */
-  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 219, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
-  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 220, /* VAR_ACCESS_CONTROL_TAG_DATA  */
-  YYSYMBOL_VAR_VIEW = 221,                 /* VAR_VIEW  */
-  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 222,  /* VAR_ACCESS_CONTROL_VIEW  */
-  YYSYMBOL_VAR_VIEW_FIRST = 223,           /* VAR_VIEW_FIRST  */
-  YYSYMBOL_VAR_SERVE_EXPIRED = 224,        /* VAR_SERVE_EXPIRED  */
-  YYSYMBOL_VAR_SERVE_EXPIRED_TTL = 225,    /* VAR_SERVE_EXPIRED_TTL  */
-  YYSYMBOL_VAR_SERVE_EXPIRED_TTL_RESET = 226, /* VAR_SERVE_EXPIRED_TTL_RESET  */
-  YYSYMBOL_VAR_SERVE_EXPIRED_REPLY_TTL = 227, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
-  YYSYMBOL_VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 228, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
-  YYSYMBOL_VAR_SERVE_ORIGINAL_TTL = 229,   /* VAR_SERVE_ORIGINAL_TTL  */
-  YYSYMBOL_VAR_FAKE_DSA = 230,             /* VAR_FAKE_DSA  */
-  YYSYMBOL_VAR_FAKE_SHA1 = 231,            /* VAR_FAKE_SHA1  */
-  YYSYMBOL_VAR_LOG_IDENTITY = 232,         /* VAR_LOG_IDENTITY  */
-  YYSYMBOL_VAR_HIDE_TRUSTANCHOR = 233,     /* VAR_HIDE_TRUSTANCHOR  */
-  YYSYMBOL_VAR_TRUST_ANCHOR_SIGNALING = 234, /* VAR_TRUST_ANCHOR_SIGNALING  */
-  YYSYMBOL_VAR_AGGRESSIVE_NSEC = 235,      /* VAR_AGGRESSIVE_NSEC  */
-  YYSYMBOL_VAR_USE_SYSTEMD = 236,          /* VAR_USE_SYSTEMD  */
-  YYSYMBOL_VAR_SHM_ENABLE = 237,           /* VAR_SHM_ENABLE  */
-  YYSYMBOL_VAR_SHM_KEY = 238,              /* VAR_SHM_KEY  */
-  YYSYMBOL_VAR_ROOT_KEY_SENTINEL = 239,    /* VAR_ROOT_KEY_SENTINEL  */
-  YYSYMBOL_VAR_DNSCRYPT = 240,             /* VAR_DNSCRYPT  */
-  YYSYMBOL_VAR_DNSCRYPT_ENABLE = 241,      /* VAR_DNSCRYPT_ENABLE  */
-  YYSYMBOL_VAR_DNSCRYPT_PORT = 242,        /* VAR_DNSCRYPT_PORT  */
-  YYSYMBOL_VAR_DNSCRYPT_PROVIDER = 243,    /* VAR_DNSCRYPT_PROVIDER  */
-  YYSYMBOL_VAR_DNSCRYPT_SECRET_KEY = 244,  /* VAR_DNSCRYPT_SECRET_KEY  */
-  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT = 245, /* VAR_DNSCRYPT_PROVIDER_CERT  */
-  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 246, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
-  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 247, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
-  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 248, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
-  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SIZE = 249, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
-  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SLABS = 250, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
-  YYSYMBOL_VAR_PAD_RESPONSES = 251,        /* VAR_PAD_RESPONSES  */
-  YYSYMBOL_VAR_PAD_RESPONSES_BLOCK_SIZE = 252, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
-  YYSYMBOL_VAR_PAD_QUERIES = 253,          /* VAR_PAD_QUERIES  */
-  YYSYMBOL_VAR_PAD_QUERIES_BLOCK_SIZE = 254, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
-  YYSYMBOL_VAR_IPSECMOD_ENABLED = 255,     /* VAR_IPSECMOD_ENABLED  */
-  YYSYMBOL_VAR_IPSECMOD_HOOK = 256,        /* VAR_IPSECMOD_HOOK  */
-  YYSYMBOL_VAR_IPSECMOD_IGNORE_BOGUS = 257, /* VAR_IPSECMOD_IGNORE_BOGUS  */
-  YYSYMBOL_VAR_IPSECMOD_MAX_TTL = 258,     /* VAR_IPSECMOD_MAX_TTL  */
-  YYSYMBOL_VAR_IPSECMOD_WHITELIST = 259,   /* VAR_IPSECMOD_WHITELIST  */
-  YYSYMBOL_VAR_IPSECMOD_STRICT = 260,      /* VAR_IPSECMOD_STRICT  */
-  YYSYMBOL_VAR_CACHEDB = 261,              /* VAR_CACHEDB  */
-  YYSYMBOL_VAR_CACHEDB_BACKEND = 262,      /* VAR_CACHEDB_BACKEND  */
-  YYSYMBOL_VAR_CACHEDB_SECRETSEED = 263,   /* VAR_CACHEDB_SECRETSEED  */
-  YYSYMBOL_VAR_CACHEDB_REDISHOST = 264,    /* VAR_CACHEDB_REDISHOST  */
-  YYSYMBOL_VAR_CACHEDB_REDISPORT = 265,    /* VAR_CACHEDB_REDISPORT  */
-  YYSYMBOL_VAR_CACHEDB_REDISTIMEOUT = 266, /* VAR_CACHEDB_REDISTIMEOUT  */
-  YYSYMBOL_VAR_CACHEDB_REDISEXPIRERECORDS = 267, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
-  YYSYMBOL_VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 268, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
-  YYSYMBOL_VAR_FOR_UPSTREAM = 269,         /* VAR_FOR_UPSTREAM  */
-  YYSYMBOL_VAR_AUTH_ZONE = 270,            /* VAR_AUTH_ZONE  */
-  YYSYMBOL_VAR_ZONEFILE = 271,             /* VAR_ZONEFILE  */
-  YYSYMBOL_VAR_MASTER = 272,               /* VAR_MASTER  */
-  YYSYMBOL_VAR_URL = 273,                  /* VAR_URL  */
-  YYSYMBOL_VAR_FOR_DOWNSTREAM = 274,       /* VAR_FOR_DOWNSTREAM  */
-  YYSYMBOL_VAR_FALLBACK_ENABLED = 275,     /* VAR_FALLBACK_ENABLED  */
-  YYSYMBOL_VAR_TLS_ADDITIONAL_PORT = 276,  /* VAR_TLS_ADDITIONAL_PORT  */
-  YYSYMBOL_VAR_LOW_RTT = 277,              /* VAR_LOW_RTT  */
-  YYSYMBOL_VAR_LOW_RTT_PERMIL = 278,       /* VAR_LOW_RTT_PERMIL  */
-  YYSYMBOL_VAR_FAST_SERVER_PERMIL = 279,   /* VAR_FAST_SERVER_PERMIL  */
-  YYSYMBOL_VAR_FAST_SERVER_NUM = 280,      /* VAR_FAST_SERVER_NUM  */
-  YYSYMBOL_VAR_ALLOW_NOTIFY = 281,         /* VAR_ALLOW_NOTIFY  */
-  YYSYMBOL_VAR_TLS_WIN_CERT = 282,         /* VAR_TLS_WIN_CERT  */
-  YYSYMBOL_VAR_TCP_CONNECTION_LIMIT = 283, /* VAR_TCP_CONNECTION_LIMIT  */
-  YYSYMBOL_VAR_FORWARD_NO_CACHE = 284,     /* VAR_FORWARD_NO_CACHE  */
-  YYSYMBOL_VAR_STUB_NO_CACHE = 285,        /* VAR_STUB_NO_CACHE  */
-  YYSYMBOL_VAR_LOG_SERVFAIL = 286,         /* VAR_LOG_SERVFAIL  */
-  YYSYMBOL_VAR_DENY_ANY = 287,             /* VAR_DENY_ANY  */
-  YYSYMBOL_VAR_UNKNOWN_SERVER_TIME_LIMIT = 288, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
-  YYSYMBOL_VAR_LOG_TAG_QUERYREPLY = 289,   /* VAR_LOG_TAG_QUERYREPLY  */
-  YYSYMBOL_VAR_STREAM_WAIT_SIZE = 290,     /* VAR_STREAM_WAIT_SIZE  */
-  YYSYMBOL_VAR_TLS_CIPHERS = 291,          /* VAR_TLS_CIPHERS  */
-  YYSYMBOL_VAR_TLS_CIPHERSUITES = 292,     /* VAR_TLS_CIPHERSUITES  */
-  YYSYMBOL_VAR_TLS_USE_SNI = 293,          /* VAR_TLS_USE_SNI  */
-  YYSYMBOL_VAR_IPSET = 294,                /* VAR_IPSET  */
-  YYSYMBOL_VAR_IPSET_NAME_V4 = 295,        /* VAR_IPSET_NAME_V4  */
-  YYSYMBOL_VAR_IPSET_NAME_V6 = 296,        /* VAR_IPSET_NAME_V6  */
-  YYSYMBOL_VAR_TLS_SESSION_TICKET_KEYS = 297, /* VAR_TLS_SESSION_TICKET_KEYS  */
-  YYSYMBOL_VAR_RPZ = 298,                  /* VAR_RPZ  */
-  YYSYMBOL_VAR_TAGS = 299,                 /* VAR_TAGS  */
-  YYSYMBOL_VAR_RPZ_ACTION_OVERRIDE = 300,  /* VAR_RPZ_ACTION_OVERRIDE  */
-  YYSYMBOL_VAR_RPZ_CNAME_OVERRIDE = 301,   /* VAR_RPZ_CNAME_OVERRIDE  */
-  YYSYMBOL_VAR_RPZ_LOG = 302,              /* VAR_RPZ_LOG  */
-  YYSYMBOL_VAR_RPZ_LOG_NAME = 303,         /* VAR_RPZ_LOG_NAME  */
-  YYSYMBOL_VAR_DYNLIB = 304,               /* VAR_DYNLIB  */
-  YYSYMBOL_VAR_DYNLIB_FILE = 305,          /* VAR_DYNLIB_FILE  */
-  YYSYMBOL_VAR_EDNS_CLIENT_STRING = 306,   /* VAR_EDNS_CLIENT_STRING  */
-  YYSYMBOL_VAR_EDNS_CLIENT_STRING_OPCODE = 307, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
-  YYSYMBOL_VAR_NSID = 308,                 /* VAR_NSID  */
-  YYSYMBOL_YYACCEPT = 309,                 /* $accept  */
-  YYSYMBOL_toplevelvars = 310,             /* toplevelvars  */
-  YYSYMBOL_toplevelvar = 311,              /* toplevelvar  */
-  YYSYMBOL_force_toplevel = 312,           /* force_toplevel  */
-  YYSYMBOL_serverstart = 313,              /* serverstart  */
-  YYSYMBOL_contents_server = 314,          /* contents_server  */
-  YYSYMBOL_content_server = 315,           /* content_server  */
-  YYSYMBOL_stubstart = 316,                /* stubstart  */
-  YYSYMBOL_contents_stub = 317,            /* contents_stub  */
-  YYSYMBOL_content_stub = 318,             /* content_stub  */
-  YYSYMBOL_forwardstart = 319,             /* forwardstart  */
-  YYSYMBOL_contents_forward = 320,         /* contents_forward  */
-  YYSYMBOL_content_forward = 321,          /* content_forward  */
-  YYSYMBOL_viewstart = 322,                /* viewstart  */
-  YYSYMBOL_contents_view = 323,            /* contents_view  */
-  YYSYMBOL_content_view = 324,             /* content_view  */
-  YYSYMBOL_authstart = 325,                /* authstart  */
-  YYSYMBOL_contents_auth = 326,            /* contents_auth  */
-  YYSYMBOL_content_auth = 327,             /* content_auth  */
-  YYSYMBOL_rpz_tag = 328,                  /* rpz_tag  */
-  YYSYMBOL_rpz_action_override = 329,      /* rpz_action_override  */
-  YYSYMBOL_rpz_cname_override = 330,       /* rpz_cname_override  */
-  YYSYMBOL_rpz_log = 331,                  /* rpz_log  */
-  YYSYMBOL_rpz_log_name = 332,             /* rpz_log_name  */
-  YYSYMBOL_rpzstart = 333,                 /* rpzstart  */
-  YYSYMBOL_contents_rpz = 334,             /* contents_rpz  */
-  YYSYMBOL_content_rpz = 335,              /* content_rpz  */
-  YYSYMBOL_server_num_threads = 336,       /* server_num_threads  */
-  YYSYMBOL_server_verbosity = 337,         /* server_verbosity  */
-  YYSYMBOL_server_statistics_interval = 338, /* server_statistics_interval  */
-  YYSYMBOL_server_statistics_cumulative = 339, /* server_statistics_cumulative  */
-  YYSYMBOL_server_extended_statistics = 340, /* server_extended_statistics  */
-  YYSYMBOL_server_shm_enable = 341,        /* server_shm_enable  */
-  YYSYMBOL_server_shm_key = 342,           /* server_shm_key  */
-  YYSYMBOL_server_port = 343,              /* server_port  */
-  YYSYMBOL_server_send_client_subnet = 344, /* server_send_client_subnet  */
-  YYSYMBOL_server_client_subnet_zone = 345, /* server_client_subnet_zone  */
-  YYSYMBOL_server_client_subnet_always_forward = 346, /* server_client_subnet_always_forward  */
-  YYSYMBOL_server_client_subnet_opcode = 347, /* server_client_subnet_opcode  */
-  YYSYMBOL_server_max_client_subnet_ipv4 = 348, /* server_max_client_subnet_ipv4  */
-  YYSYMBOL_server_max_client_subnet_ipv6 = 349, /* server_max_client_subnet_ipv6  */
-  YYSYMBOL_server_min_client_subnet_ipv4 = 350, /* server_min_client_subnet_ipv4  */
-  YYSYMBOL_server_min_client_subnet_ipv6 = 351, /* server_min_client_subnet_ipv6  */
-  YYSYMBOL_server_max_ecs_tree_size_ipv4 = 352, /* server_max_ecs_tree_size_ipv4  */
-  YYSYMBOL_server_max_ecs_tree_size_ipv6 = 353, /* server_max_ecs_tree_size_ipv6  */
-  YYSYMBOL_server_interface = 354,         /* server_interface  */
-  YYSYMBOL_server_outgoing_interface = 355, /* server_outgoing_interface  */
-  YYSYMBOL_server_outgoing_range = 356,    /* server_outgoing_range  */
-  YYSYMBOL_server_outgoing_port_permit = 357, /* server_outgoing_port_permit  */
-  YYSYMBOL_server_outgoing_port_avoid = 358, /* server_outgoing_port_avoid  */
-  YYSYMBOL_server_outgoing_num_tcp = 359,  /* server_outgoing_num_tcp  */
-  YYSYMBOL_server_incoming_num_tcp = 360,  /* server_incoming_num_tcp  */
-  YYSYMBOL_server_interface_automatic = 361, /* server_interface_automatic  */
-  YYSYMBOL_server_do_ip4 = 362,            /* server_do_ip4  */
-  YYSYMBOL_server_do_ip6 = 363,            /* server_do_ip6  */
-  YYSYMBOL_server_do_udp = 364,            /* server_do_udp  */
-  YYSYMBOL_server_do_tcp = 365,            /* server_do_tcp  */
-  YYSYMBOL_server_prefer_ip4 = 366,        /* server_prefer_ip4  */
-  YYSYMBOL_server_prefer_ip6 = 367,        /* server_prefer_ip6  */
-  YYSYMBOL_server_tcp_mss = 368,           /* server_tcp_mss  */
-  YYSYMBOL_server_outgoing_tcp_mss = 369,  /* server_outgoing_tcp_mss  */
-  YYSYMBOL_server_tcp_idle_timeout = 370,  /* server_tcp_idle_timeout  */
-  YYSYMBOL_server_tcp_keepalive = 371,     /* server_tcp_keepalive  */
-  YYSYMBOL_server_tcp_keepalive_timeout = 372, /* server_tcp_keepalive_timeout  */
-  YYSYMBOL_server_tcp_upstream = 373,      /* server_tcp_upstream  */
-  YYSYMBOL_server_udp_upstream_without_downstream = 374, /* server_udp_upstream_without_downstream  */
-  YYSYMBOL_server_ssl_upstream = 375,      /* server_ssl_upstream  */
-  YYSYMBOL_server_ssl_service_key = 376,   /* server_ssl_service_key  */
-  YYSYMBOL_server_ssl_service_pem = 377,   /* server_ssl_service_pem  */
-  YYSYMBOL_server_ssl_port = 378,          /* server_ssl_port  */
-  YYSYMBOL_server_tls_cert_bundle = 379,   /* server_tls_cert_bundle  */
-  YYSYMBOL_server_tls_win_cert = 380,      /* server_tls_win_cert  */
-  YYSYMBOL_server_tls_additional_port = 381, /* server_tls_additional_port  */
-  YYSYMBOL_server_tls_ciphers = 382,       /* server_tls_ciphers  */
-  YYSYMBOL_server_tls_ciphersuites = 383,  /* server_tls_ciphersuites  */
-  YYSYMBOL_server_tls_session_ticket_keys = 384, /* server_tls_session_ticket_keys  */
-  YYSYMBOL_server_tls_use_sni = 385,       /* server_tls_use_sni  */
-  YYSYMBOL_server_https_port = 386,        /* server_https_port  */
-  YYSYMBOL_server_http_endpoint = 387,     /* server_http_endpoint  */
-  YYSYMBOL_server_http_max_streams = 388,  /* server_http_max_streams  */
-  YYSYMBOL_server_http_query_buffer_size = 389, /* server_http_query_buffer_size  */
-  YYSYMBOL_server_http_response_buffer_size = 390, /* server_http_response_buffer_size  */
-  YYSYMBOL_server_http_nodelay = 391,      /* server_http_nodelay  */
-  YYSYMBOL_server_http_notls_downstream = 392, /* server_http_notls_downstream  */
-  YYSYMBOL_server_use_systemd = 393,       /* server_use_systemd  */
-  YYSYMBOL_server_do_daemonize = 394,      /* server_do_daemonize  */
-  YYSYMBOL_server_use_syslog = 395,        /* server_use_syslog  */
-  YYSYMBOL_server_log_time_ascii = 396,    /* server_log_time_ascii  */
-  YYSYMBOL_server_log_queries = 397,       /* server_log_queries  */
-  YYSYMBOL_server_log_replies = 398,       /* server_log_replies  */
-  YYSYMBOL_server_log_tag_queryreply = 399, /* server_log_tag_queryreply  */
-  YYSYMBOL_server_log_servfail = 400,      /* server_log_servfail  */
-  YYSYMBOL_server_log_local_actions = 401, /* server_log_local_actions  */
-  YYSYMBOL_server_chroot = 402,            /* server_chroot  */
-  YYSYMBOL_server_username = 403,          /* server_username  */
-  YYSYMBOL_server_directory = 404,         /* server_directory  */
-  YYSYMBOL_server_logfile = 405,           /* server_logfile  */
-  YYSYMBOL_server_pidfile = 406,           /* server_pidfile  */
-  YYSYMBOL_server_root_hints = 407,        /* server_root_hints  */
-  YYSYMBOL_server_dlv_anchor_file = 408,   /* server_dlv_anchor_file  */
-  YYSYMBOL_server_dlv_anchor = 409,        /* server_dlv_anchor  */
-  YYSYMBOL_server_auto_trust_anchor_file = 410, /* server_auto_trust_anchor_file  */
-  YYSYMBOL_server_trust_anchor_file = 411, /* server_trust_anchor_file  */
-  YYSYMBOL_server_trusted_keys_file = 412, /* server_trusted_keys_file  */
-  YYSYMBOL_server_trust_anchor = 413,      /* server_trust_anchor  */
-  YYSYMBOL_server_trust_anchor_signaling = 414, /* server_trust_anchor_signaling  */
-  YYSYMBOL_server_root_key_sentinel = 415, /* server_root_key_sentinel  */
-  YYSYMBOL_server_domain_insecure = 416,   /* server_domain_insecure  */
-  YYSYMBOL_server_hide_identity = 417,     /* server_hide_identity  */
-  YYSYMBOL_server_hide_version = 418,      /* server_hide_version  */
-  YYSYMBOL_server_hide_trustanchor = 419,  /* server_hide_trustanchor  */
-  YYSYMBOL_server_identity = 420,          /* server_identity  */
-  YYSYMBOL_server_version = 421,           /* server_version  */
-  YYSYMBOL_server_nsid = 422,              /* server_nsid  */
-  YYSYMBOL_server_so_rcvbuf = 423,         /* server_so_rcvbuf  */
-  YYSYMBOL_server_so_sndbuf = 424,         /* server_so_sndbuf  */
-  YYSYMBOL_server_so_reuseport = 425,      /* server_so_reuseport  */
-  YYSYMBOL_server_ip_transparent = 426,    /* server_ip_transparent  */
-  YYSYMBOL_server_ip_freebind = 427,       /* server_ip_freebind  */
-  YYSYMBOL_server_ip_dscp = 428,           /* server_ip_dscp  */
-  YYSYMBOL_server_stream_wait_size = 429,  /* server_stream_wait_size  */
-  YYSYMBOL_server_edns_buffer_size = 430,  /* server_edns_buffer_size  */
-  YYSYMBOL_server_msg_buffer_size = 431,   /* server_msg_buffer_size  */
-  YYSYMBOL_server_msg_cache_size = 432,    /* server_msg_cache_size  */
-  YYSYMBOL_server_msg_cache_slabs = 433,   /* server_msg_cache_slabs  */
-  YYSYMBOL_server_num_queries_per_thread = 434, /* server_num_queries_per_thread  */
-  YYSYMBOL_server_jostle_timeout = 435,    /* server_jostle_timeout  */
-  YYSYMBOL_server_delay_close = 436,       /* server_delay_close  */
-  YYSYMBOL_server_udp_connect = 437,       /* server_udp_connect  */
-  YYSYMBOL_server_unblock_lan_zones = 438, /* server_unblock_lan_zones  */
-  YYSYMBOL_server_insecure_lan_zones = 439, /* server_insecure_lan_zones  */
-  YYSYMBOL_server_rrset_cache_size = 440,  /* server_rrset_cache_size  */
-  YYSYMBOL_server_rrset_cache_slabs = 441, /* server_rrset_cache_slabs  */
-  YYSYMBOL_server_infra_host_ttl = 442,    /* server_infra_host_ttl  */
-  YYSYMBOL_server_infra_lame_ttl = 443,    /* server_infra_lame_ttl  */
-  YYSYMBOL_server_infra_cache_numhosts = 444, /* server_infra_cache_numhosts  */
-  YYSYMBOL_server_infra_cache_lame_size = 445, /* server_infra_cache_lame_size  */
-  YYSYMBOL_server_infra_cache_slabs = 446, /* server_infra_cache_slabs  */
-  YYSYMBOL_server_infra_cache_min_rtt = 447, /* server_infra_cache_min_rtt  */
-  YYSYMBOL_server_infra_keep_probing = 448, /* server_infra_keep_probing  */
-  YYSYMBOL_server_target_fetch_policy = 449, /* server_target_fetch_policy  */
-  YYSYMBOL_server_harden_short_bufsize = 450, /* server_harden_short_bufsize  */
-  YYSYMBOL_server_harden_large_queries = 451, /* server_harden_large_queries  */
-  YYSYMBOL_server_harden_glue = 452,       /* server_harden_glue  */
-  YYSYMBOL_server_harden_dnssec_stripped = 453, /* server_harden_dnssec_stripped  */
-  YYSYMBOL_server_harden_below_nxdomain = 454, /* server_harden_below_nxdomain  */
-  YYSYMBOL_server_harden_referral_path = 455, /* server_harden_referral_path  */
-  YYSYMBOL_server_harden_algo_downgrade = 456, /* server_harden_algo_downgrade  */
-  YYSYMBOL_server_use_caps_for_id = 457,   /* server_use_caps_for_id  */
-  YYSYMBOL_server_caps_whitelist = 458,    /* server_caps_whitelist  */
-  YYSYMBOL_server_private_address = 459,   /* server_private_address  */
-  YYSYMBOL_server_private_domain = 460,    /* server_private_domain  */
-  YYSYMBOL_server_prefetch = 461,          /* server_prefetch  */
-  YYSYMBOL_server_prefetch_key = 462,      /* server_prefetch_key  */
-  YYSYMBOL_server_deny_any = 463,          /* server_deny_any  */
-  YYSYMBOL_server_unwanted_reply_threshold = 464, /* server_unwanted_reply_threshold  */
-  YYSYMBOL_server_do_not_query_address = 465, /* server_do_not_query_address  */
-  YYSYMBOL_server_do_not_query_localhost = 466, /* server_do_not_query_localhost  */
-  YYSYMBOL_server_access_control = 467,    /* server_access_control  */
-  YYSYMBOL_server_module_conf = 468,       /* server_module_conf  */
-  YYSYMBOL_server_val_override_date = 469, /* server_val_override_date  */
-  YYSYMBOL_server_val_sig_skew_min = 470,  /* server_val_sig_skew_min  */
-  YYSYMBOL_server_val_sig_skew_max = 471,  /* server_val_sig_skew_max  */
-  YYSYMBOL_server_cache_max_ttl = 472,     /* server_cache_max_ttl  */
-  YYSYMBOL_server_cache_max_negative_ttl = 473, /* server_cache_max_negative_ttl  */
-  YYSYMBOL_server_cache_min_ttl = 474,     /* server_cache_min_ttl  */
-  YYSYMBOL_server_bogus_ttl = 475,         /* server_bogus_ttl  */
-  YYSYMBOL_server_val_clean_additional = 476, /* server_val_clean_additional  */
-  YYSYMBOL_server_val_permissive_mode = 477, /* server_val_permissive_mode  */
-  YYSYMBOL_server_aggressive_nsec = 478,   /* server_aggressive_nsec  */
-  YYSYMBOL_server_ignore_cd_flag = 479,    /* server_ignore_cd_flag  */
-  YYSYMBOL_server_serve_expired = 480,     /* server_serve_expired  */
-  YYSYMBOL_server_serve_expired_ttl = 481, /* server_serve_expired_ttl  */
-  YYSYMBOL_server_serve_expired_ttl_reset = 482, /* server_serve_expired_ttl_reset  */
-  YYSYMBOL_server_serve_expired_reply_ttl = 483, /* server_serve_expired_reply_ttl  */
-  YYSYMBOL_server_serve_expired_client_timeout = 484, /* server_serve_expired_client_timeout  */
-  YYSYMBOL_server_serve_original_ttl = 485, /* server_serve_original_ttl  */
-  YYSYMBOL_server_fake_dsa = 486,          /* server_fake_dsa  */
-  YYSYMBOL_server_fake_sha1 = 487,         /* server_fake_sha1  */
-  YYSYMBOL_server_val_log_level = 488,     /* server_val_log_level  */
-  YYSYMBOL_server_val_nsec3_keysize_iterations = 489, /* server_val_nsec3_keysize_iterations  */
-  YYSYMBOL_server_add_holddown = 490,      /* server_add_holddown  */
-  YYSYMBOL_server_del_holddown = 491,      /* server_del_holddown  */
-  YYSYMBOL_server_keep_missing = 492,      /* server_keep_missing  */
-  YYSYMBOL_server_permit_small_holddown = 493, /* server_permit_small_holddown  */
-  YYSYMBOL_server_key_cache_size = 494,    /* server_key_cache_size  */
-  YYSYMBOL_server_key_cache_slabs = 495,   /* server_key_cache_slabs  */
-  YYSYMBOL_server_neg_cache_size = 496,    /* server_neg_cache_size  */
-  YYSYMBOL_server_local_zone = 497,        /* server_local_zone  */
-  YYSYMBOL_server_local_data = 498,        /* server_local_data  */
-  YYSYMBOL_server_local_data_ptr = 499,    /* server_local_data_ptr  */
-  YYSYMBOL_server_minimal_responses = 500, /* server_minimal_responses  */
-  YYSYMBOL_server_rrset_roundrobin = 501,  /* server_rrset_roundrobin  */
-  YYSYMBOL_server_unknown_server_time_limit = 502, /* server_unknown_server_time_limit  */
-  YYSYMBOL_server_max_udp_size = 503,      /* server_max_udp_size  */
-  YYSYMBOL_server_dns64_prefix = 504,      /* server_dns64_prefix  */
-  YYSYMBOL_server_dns64_synthall = 505,    /* server_dns64_synthall  */
-  YYSYMBOL_server_dns64_ignore_aaaa = 506, /* server_dns64_ignore_aaaa  */
-  YYSYMBOL_server_define_tag = 507,        /* server_define_tag  */
-  YYSYMBOL_server_local_zone_tag = 508,    /* server_local_zone_tag  */
-  YYSYMBOL_server_access_control_tag = 509, /* server_access_control_tag  */
-  YYSYMBOL_server_access_control_tag_action = 510, /* server_access_control_tag_action  */
-  YYSYMBOL_server_access_control_tag_data = 511, /* server_access_control_tag_data  */
-  YYSYMBOL_server_local_zone_override = 512, /* server_local_zone_override  */
-  YYSYMBOL_server_access_control_view = 513, /* server_access_control_view  */
-  YYSYMBOL_server_response_ip_tag = 514,   /* server_response_ip_tag  */
-  YYSYMBOL_server_ip_ratelimit = 515,      /* server_ip_ratelimit  */
-  YYSYMBOL_server_ratelimit = 516,         /* server_ratelimit  */
-  YYSYMBOL_server_ip_ratelimit_size = 517, /* server_ip_ratelimit_size  */
-  YYSYMBOL_server_ratelimit_size = 518,    /* server_ratelimit_size  */
-  YYSYMBOL_server_ip_ratelimit_slabs = 519, /* server_ip_ratelimit_slabs  */
-  YYSYMBOL_server_ratelimit_slabs = 520,   /* server_ratelimit_slabs  */
-  YYSYMBOL_server_ratelimit_for_domain = 521, /* server_ratelimit_for_domain  */
-  YYSYMBOL_server_ratelimit_below_domain = 522, /* server_ratelimit_below_domain  */
-  YYSYMBOL_server_ip_ratelimit_factor = 523, /* server_ip_ratelimit_factor  */
-  YYSYMBOL_server_ratelimit_factor = 524,  /* server_ratelimit_factor  */
-  YYSYMBOL_server_low_rtt = 525,           /* server_low_rtt  */
-  YYSYMBOL_server_fast_server_num = 526,   /* server_fast_server_num  */
-  YYSYMBOL_server_fast_server_permil = 527, /* server_fast_server_permil  */
-  YYSYMBOL_server_qname_minimisation = 528, /* server_qname_minimisation  */
-  YYSYMBOL_server_qname_minimisation_strict = 529, /* server_qname_minimisation_strict  */
-  YYSYMBOL_server_pad_responses = 530,     /* server_pad_responses  */
-  YYSYMBOL_server_pad_responses_block_size = 531, /* server_pad_responses_block_size  */
-  YYSYMBOL_server_pad_queries = 532,       /* server_pad_queries  */
-  YYSYMBOL_server_pad_queries_block_size = 533, /* server_pad_queries_block_size  */
-  YYSYMBOL_server_ipsecmod_enabled = 534,  /* server_ipsecmod_enabled  */
-  YYSYMBOL_server_ipsecmod_ignore_bogus = 535, /* server_ipsecmod_ignore_bogus  */
-  YYSYMBOL_server_ipsecmod_hook = 536,     /* server_ipsecmod_hook  */
-  YYSYMBOL_server_ipsecmod_max_ttl = 537,  /* server_ipsecmod_max_ttl  */
-  YYSYMBOL_server_ipsecmod_whitelist = 538, /* server_ipsecmod_whitelist  */
-  YYSYMBOL_server_ipsecmod_strict = 539,   /* server_ipsecmod_strict  */
-  YYSYMBOL_server_edns_client_string = 540, /* server_edns_client_string  */
-  YYSYMBOL_server_edns_client_string_opcode = 541, /* server_edns_client_string_opcode  */
-  YYSYMBOL_stub_name = 542,                /* stub_name  */
-  YYSYMBOL_stub_host = 543,                /* stub_host  */
-  YYSYMBOL_stub_addr = 544,                /* stub_addr  */
-  YYSYMBOL_stub_first = 545,               /* stub_first  */
-  YYSYMBOL_stub_no_cache = 546,            /* stub_no_cache  */
-  YYSYMBOL_stub_ssl_upstream = 547,        /* stub_ssl_upstream  */
-  YYSYMBOL_stub_prime = 548,               /* stub_prime  */
-  YYSYMBOL_forward_name = 549,             /* forward_name  */
-  YYSYMBOL_forward_host = 550,             /* forward_host  */
-  YYSYMBOL_forward_addr = 551,             /* forward_addr  */
-  YYSYMBOL_forward_first = 552,            /* forward_first  */
-  YYSYMBOL_forward_no_cache = 553,         /* forward_no_cache  */
-  YYSYMBOL_forward_ssl_upstream = 554,     /* forward_ssl_upstream  */
-  YYSYMBOL_auth_name = 555,                /* auth_name  */
-  YYSYMBOL_auth_zonefile = 556,            /* auth_zonefile  */
-  YYSYMBOL_auth_master = 557,              /* auth_master  */
-  YYSYMBOL_auth_url = 558,                 /* auth_url  */
-  YYSYMBOL_auth_allow_notify = 559,        /* auth_allow_notify  */
-  YYSYMBOL_auth_for_downstream = 560,      /* auth_for_downstream  */
-  YYSYMBOL_auth_for_upstream = 561,        /* auth_for_upstream  */
-  YYSYMBOL_auth_fallback_enabled = 562,    /* auth_fallback_enabled  */
-  YYSYMBOL_view_name = 563,                /* view_name  */
-  YYSYMBOL_view_local_zone = 564,          /* view_local_zone  */
-  YYSYMBOL_view_response_ip = 565,         /* view_response_ip  */
-  YYSYMBOL_view_response_ip_data = 566,    /* view_response_ip_data  */
-  YYSYMBOL_view_local_data = 567,          /* view_local_data  */
-  YYSYMBOL_view_local_data_ptr = 568,      /* view_local_data_ptr  */
-  YYSYMBOL_view_first = 569,               /* view_first  */
-  YYSYMBOL_rcstart = 570,                  /* rcstart  */
-  YYSYMBOL_contents_rc = 571,              /* contents_rc  */
-  YYSYMBOL_content_rc = 572,               /* content_rc  */
-  YYSYMBOL_rc_control_enable = 573,        /* rc_control_enable  */
-  YYSYMBOL_rc_control_port = 574,          /* rc_control_port  */
-  YYSYMBOL_rc_control_interface = 575,     /* rc_control_interface  */
-  YYSYMBOL_rc_control_use_cert = 576,      /* rc_control_use_cert  */
-  YYSYMBOL_rc_server_key_file = 577,       /* rc_server_key_file  */
-  YYSYMBOL_rc_server_cert_file = 578,      /* rc_server_cert_file  */
-  YYSYMBOL_rc_control_key_file = 579,      /* rc_control_key_file  */
-  YYSYMBOL_rc_control_cert_file = 580,     /* rc_control_cert_file  */
-  YYSYMBOL_dtstart = 581,                  /* dtstart  */
-  YYSYMBOL_contents_dt = 582,              /* contents_dt  */
-  YYSYMBOL_content_dt = 583,               /* content_dt  */
-  YYSYMBOL_dt_dnstap_enable = 584,         /* dt_dnstap_enable  */
-  YYSYMBOL_dt_dnstap_bidirectional = 585,  /* dt_dnstap_bidirectional  */
-  YYSYMBOL_dt_dnstap_socket_path = 586,    /* dt_dnstap_socket_path  */
-  YYSYMBOL_dt_dnstap_ip = 587,             /* dt_dnstap_ip  */
-  YYSYMBOL_dt_dnstap_tls = 588,            /* dt_dnstap_tls  */
-  YYSYMBOL_dt_dnstap_tls_server_name = 589, /* dt_dnstap_tls_server_name  */
-  YYSYMBOL_dt_dnstap_tls_cert_bundle = 590, /* dt_dnstap_tls_cert_bundle  */
-  YYSYMBOL_dt_dnstap_tls_client_key_file = 591, /* dt_dnstap_tls_client_key_file  */
-  YYSYMBOL_dt_dnstap_tls_client_cert_file = 592, /* dt_dnstap_tls_client_cert_file  */
-  YYSYMBOL_dt_dnstap_send_identity = 593,  /* dt_dnstap_send_identity  */
-  YYSYMBOL_dt_dnstap_send_version = 594,   /* dt_dnstap_send_version  */
-  YYSYMBOL_dt_dnstap_identity = 595,       /* dt_dnstap_identity  */
-  YYSYMBOL_dt_dnstap_version = 596,        /* dt_dnstap_version  */
-  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 597, /* dt_dnstap_log_resolver_query_messages  */
-  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 598, /* dt_dnstap_log_resolver_response_messages  */
-  YYSYMBOL_dt_dnstap_log_client_query_messages = 599, /* dt_dnstap_log_client_query_messages  */
-  YYSYMBOL_dt_dnstap_log_client_response_messages = 600, /* dt_dnstap_log_client_response_messages  */
-  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 601, /* dt_dnstap_log_forwarder_query_messages  */
-  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 602, /* dt_dnstap_log_forwarder_response_messages  */
-  YYSYMBOL_pythonstart = 603,              /* pythonstart  */
-  YYSYMBOL_contents_py = 604,              /* contents_py  */
-  YYSYMBOL_content_py = 605,               /* content_py  */
-  YYSYMBOL_py_script = 606,                /* py_script  */
-  YYSYMBOL_dynlibstart = 607,              /* dynlibstart  */
-  YYSYMBOL_contents_dl = 608,              /* contents_dl  */
-  YYSYMBOL_content_dl = 609,               /* content_dl  */
-  YYSYMBOL_dl_file = 610,                  /* dl_file  */
-  YYSYMBOL_server_disable_dnssec_lame_check = 611, /* server_disable_dnssec_lame_check  */
-  YYSYMBOL_server_log_identity = 612,      /* server_log_identity  */
-  YYSYMBOL_server_response_ip = 613,       /* server_response_ip  */
-  YYSYMBOL_server_response_ip_data = 614,  /* server_response_ip_data  */
-  YYSYMBOL_dnscstart = 615,                /* dnscstart  */
-  YYSYMBOL_contents_dnsc = 616,            /* contents_dnsc  */
-  YYSYMBOL_content_dnsc = 617,             /* content_dnsc  */
-  YYSYMBOL_dnsc_dnscrypt_enable = 618,     /* dnsc_dnscrypt_enable  */
-  YYSYMBOL_dnsc_dnscrypt_port = 619,       /* dnsc_dnscrypt_port  */
-  YYSYMBOL_dnsc_dnscrypt_provider = 620,   /* dnsc_dnscrypt_provider  */
-  YYSYMBOL_dnsc_dnscrypt_provider_cert = 621, /* dnsc_dnscrypt_provider_cert  */
-  YYSYMBOL_dnsc_dnscrypt_provider_cert_rotated = 622, /* dnsc_dnscrypt_provider_cert_rotated  */
-  YYSYMBOL_dnsc_dnscrypt_secret_key = 623, /* dnsc_dnscrypt_secret_key  */
-  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_size = 624, /* dnsc_dnscrypt_shared_secret_cache_size  */
-  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_slabs = 625, /* dnsc_dnscrypt_shared_secret_cache_slabs  */
-  YYSYMBOL_dnsc_dnscrypt_nonce_cache_size = 626, /* dnsc_dnscrypt_nonce_cache_size  */
-  YYSYMBOL_dnsc_dnscrypt_nonce_cache_slabs = 627, /* dnsc_dnscrypt_nonce_cache_slabs  */
-  YYSYMBOL_cachedbstart = 628,             /* cachedbstart  */
-  YYSYMBOL_contents_cachedb = 629,         /* contents_cachedb  */
-  YYSYMBOL_content_cachedb = 630,          /* content_cachedb  */
-  YYSYMBOL_cachedb_backend_name = 631,     /* cachedb_backend_name  */
-  YYSYMBOL_cachedb_secret_seed = 632,      /* cachedb_secret_seed  */
-  YYSYMBOL_redis_server_host = 633,        /* redis_server_host  */
-  YYSYMBOL_redis_server_port = 634,        /* redis_server_port  */
-  YYSYMBOL_redis_timeout = 635,            /* redis_timeout  */
-  YYSYMBOL_redis_expire_records = 636,     /* redis_expire_records  */
-  YYSYMBOL_server_tcp_connection_limit = 637, /* server_tcp_connection_limit  */
-  YYSYMBOL_ipsetstart = 638,               /* ipsetstart  */
-  YYSYMBOL_contents_ipset = 639,           /* contents_ipset  */
-  YYSYMBOL_content_ipset = 640,            /* content_ipset  */
-  YYSYMBOL_ipset_name_v4 = 641,            /* ipset_name_v4  */
-  YYSYMBOL_ipset_name_v6 = 642             /* ipset_name_v6  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_RATE = 182,   /* VAR_DNSTAP_SAMPLE_RATE  */
+  YYSYMBOL_VAR_DNSTAP_FILTER_QTYPE = 183,  /* VAR_DNSTAP_FILTER_QTYPE  */
+  YYSYMBOL_VAR_DNSTAP_FILTER_RCODE = 184,  /* VAR_DNSTAP_FILTER_RCODE  */
+  YYSYMBOL_VAR_DNSTAP_FILTER_LOCAL_ZONE = 185, /* VAR_DNSTAP_FILTER_LOCAL_ZONE  */
+  YYSYMBOL_VAR_DNSTAP_FILTER_RESPONSE_TIME = 186, /* VAR_DNSTAP_FILTER_RESPONSE_TIME  */
+  YYSYMBOL_VAR_RESPONSE_IP_TAG = 187,      /* VAR_RESPONSE_IP_TAG  */
+  YYSYMBOL_VAR_RESPONSE_IP = 188,          /* VAR_RESPONSE_IP  */
+  YYSYMBOL_VAR_RESPONSE_IP_DATA = 189,     /* VAR_RESPONSE_IP_DATA  */
+  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 190, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+  YYSYMBOL_VAR_IP_TRANSPARENT = 191,       /* VAR_IP_TRANSPARENT  */
+  YYSYMBOL_VAR_IP_DSCP = 192,              /* VAR_IP_DSCP  */
+  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 193, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+  YYSYMBOL_VAR_IP_RATELIMIT = 194,         /* VAR_IP_RATELIMIT  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 195,   /* VAR_IP_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 196,    /* VAR_IP_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT = 197,            /* VAR_RATELIMIT  */
+  YYSYMBOL_VAR_RATELIMIT_SLABS = 198,      /* VAR_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_RATELIMIT_SIZE = 199,       /* VAR_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 200, /* VAR_RATELIMIT_FOR_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 201, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 202,  /* VAR_IP_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_RATELIMIT_FACTOR = 203,     /* VAR_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_SEND_CLIENT_SUBNET = 204,   /* VAR_SEND_CLIENT_SUBNET  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ZONE = 205,   /* VAR_CLIENT_SUBNET_ZONE  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 206, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_OPCODE = 207, /* VAR_CLIENT_SUBNET_OPCODE  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV4 = 208, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV6 = 209, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV4 = 210, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MIN_CLIENT_SUBNET_IPV6 = 211, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV4 = 212, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
+  YYSYMBOL_VAR_MAX_ECS_TREE_SIZE_IPV6 = 213, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
+  YYSYMBOL_VAR_CAPS_WHITELIST = 214,       /* VAR_CAPS_WHITELIST  */
+  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 215, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 216, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION = 217,   /* VAR_QNAME_MINIMISATION  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 218, /* VAR_QNAME_MINIMISATION_STRICT  */
+  YYSYMBOL_VAR_IP_FREEBIND = 219,          /* VAR_IP_FREEBIND  */
+  YYSYMBOL_VAR_DEFINE_TAG = 220,           /* VAR_DEFINE_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 221,       /* VAR_LOCAL_ZONE_TAG  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 222,   /* VAR_ACCESS_CONTROL_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 223,  /* VAR_LOCAL_ZONE_OVERRIDE  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 224, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 225, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+  YYSYMBOL_VAR_VIEW = 226,                 /* VAR_VIEW  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 227,  /* VAR_ACCESS_CONTROL_VIEW  */
+  YYSYMBOL_VAR_VIEW_FIRST = 228,           /* VAR_VIEW_FIRST  */
+  YYSYMBOL_VAR_SERVE_EXPIRED = 229,        /* VAR_SERVE_EXPIRED  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_TTL = 230,    /* VAR_SERVE_EXPIRED_TTL  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_TTL_RESET = 231, /* VAR_SERVE_EXPIRED_TTL_RESET  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_REPLY_TTL = 232, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
+  YYSYMBOL_VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 233, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
+  YYSYMBOL_VAR_SERVE_ORIGINAL_TTL = 234,   /* VAR_SERVE_ORIGINAL_TTL  */
+  YYSYMBOL_VAR_FAKE_DSA = 235,             /* VAR_FAKE_DSA  */
+  YYSYMBOL_VAR_FAKE_SHA1 = 236,            /* VAR_FAKE_SHA1  */
+  YYSYMBOL_VAR_LOG_IDENTITY = 237,         /* VAR_LOG_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_TRUSTANCHOR = 238,     /* VAR_HIDE_TRUSTANCHOR  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_SIGNALING = 239, /* VAR_TRUST_ANCHOR_SIGNALING  */
+  YYSYMBOL_VAR_AGGRESSIVE_NSEC = 240,      /* VAR_AGGRESSIVE_NSEC  */
+  YYSYMBOL_VAR_USE_SYSTEMD = 241,          /* VAR_USE_SYSTEMD  */
+  YYSYMBOL_VAR_SHM_ENABLE = 242,           /* VAR_SHM_ENABLE  */
+  YYSYMBOL_VAR_SHM_KEY = 243,              /* VAR_SHM_KEY  */
+  YYSYMBOL_VAR_ROOT_KEY_SENTINEL = 244,    /* VAR_ROOT_KEY_SENTINEL  */
+  YYSYMBOL_VAR_DNSCRYPT = 245,             /* VAR_DNSCRYPT  */
+  YYSYMBOL_VAR_DNSCRYPT_ENABLE = 246,      /* VAR_DNSCRYPT_ENABLE  */
+  YYSYMBOL_VAR_DNSCRYPT_PORT = 247,        /* VAR_DNSCRYPT_PORT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER = 248,    /* VAR_DNSCRYPT_PROVIDER  */
+  YYSYMBOL_VAR_DNSCRYPT_SECRET_KEY = 249,  /* VAR_DNSCRYPT_SECRET_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT = 250, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 251, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 252, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 253, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SIZE = 254, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SLABS = 255, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+  YYSYMBOL_VAR_PAD_RESPONSES = 256,        /* VAR_PAD_RESPONSES  */
+  YYSYMBOL_VAR_PAD_RESPONSES_BLOCK_SIZE = 257, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
+  YYSYMBOL_VAR_PAD_QUERIES = 258,          /* VAR_PAD_QUERIES  */
+  YYSYMBOL_VAR_PAD_QUERIES_BLOCK_SIZE = 259, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
+  YYSYMBOL_VAR_IPSECMOD_ENABLED = 260,     /* VAR_IPSECMOD_ENABLED  */
+  YYSYMBOL_VAR_IPSECMOD_HOOK = 261,        /* VAR_IPSECMOD_HOOK  */
+  YYSYMBOL_VAR_IPSECMOD_IGNORE_BOGUS = 262, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+  YYSYMBOL_VAR_IPSECMOD_MAX_TTL = 263,     /* VAR_IPSECMOD_MAX_TTL  */
+  YYSYMBOL_VAR_IPSECMOD_WHITELIST = 264,   /* VAR_IPSECMOD_WHITELIST  */
+  YYSYMBOL_VAR_IPSECMOD_STRICT = 265,      /* VAR_IPSECMOD_STRICT  */
+  YYSYMBOL_VAR_CACHEDB = 266,              /* VAR_CACHEDB  */
+  YYSYMBOL_VAR_CACHEDB_BACKEND = 267,      /* VAR_CACHEDB_BACKEND  */
+  YYSYMBOL_VAR_CACHEDB_SECRETSEED = 268,   /* VAR_CACHEDB_SECRETSEED  */
+  YYSYMBOL_VAR_CACHEDB_REDISHOST = 269,    /* VAR_CACHEDB_REDISHOST  */
+  YYSYMBOL_VAR_CACHEDB_REDISPORT = 270,    /* VAR_CACHEDB_REDISPORT  */
+  YYSYMBOL_VAR_CACHEDB_REDISTIMEOUT = 271, /* VAR_CACHEDB_REDISTIMEOUT  */
+  YYSYMBOL_VAR_CACHEDB_REDISEXPIRERECORDS = 272, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
+  YYSYMBOL_VAR_CACHEDB_WRITEBEHINDSIZE = 273, /* VAR_CACHEDB_WRITEBEHINDSIZE  */
+  YYSYMBOL_VAR_CACHEDB_WRITEBEHINDINTERVAL = 274, /* VAR_CACHEDB_WRITEBEHINDINTERVAL  */
+  YYSYMBOL_VAR_CACHEDB_MMAPFILE = 275,     /* VAR_CACHEDB_MMAPFILE  */
+  YYSYMBOL_VAR_CACHEDB_MMAPSIZE = 276,     /* VAR_CACHEDB_MMAPSIZE  */
+  YYSYMBOL_VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 277, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+  YYSYMBOL_VAR_FOR_UPSTREAM = 278,         /* VAR_FOR_UPSTREAM  */
+  YYSYMBOL_VAR_AUTH_ZONE = 279,            /* VAR_AUTH_ZONE  */
+  YYSYMBOL_VAR_ZONEFILE = 280,             /* VAR_ZONEFILE  */
+  YYSYMBOL_VAR_MASTER = 281,               /* VAR_MASTER  */
+  YYSYMBOL_VAR_URL = 282,                  /* VAR_URL  */
+  YYSYMBOL_VAR_FOR_DOWNSTREAM = 283,       /* VAR_FOR_DOWNSTREAM  */
+  YYSYMBOL_VAR_FALLBACK_ENABLED = 284,     /* VAR_FALLBACK_ENABLED  */
+  YYSYMBOL_VAR_TLS_ADDITIONAL_PORT = 285,  /* VAR_TLS_ADDITIONAL_PORT  */
+  YYSYMBOL_VAR_LOW_RTT = 286,              /* VAR_LOW_RTT  */
+  YYSYMBOL_VAR_LOW_RTT_PERMIL = 287,       /* VAR_LOW_RTT_PERMIL  */
+  YYSYMBOL_VAR_FAST_SERVER_PERMIL = 288,   /* VAR_FAST_SERVER_PERMIL  */
+  YYSYMBOL_VAR_FAST_SERVER_NUM = 289,      /* VAR_FAST_SERVER_NUM  */
+  YYSYMBOL_VAR_ALLOW_NOTIFY = 290,         /* VAR_ALLOW_NOTIFY  */
+  YYSYMBOL_VAR_TLS_WIN_CERT = 291,         /* VAR_TLS_WIN_CERT  */
+  YYSYMBOL_VAR_TCP_CONNECTION_LIMIT = 292, /* VAR_TCP_CONNECTION_LIMIT  */
+  YYSYMBOL_VAR_FORWARD_NO_CACHE = 293,     /* VAR_FORWARD_NO_CACHE  */
+  YYSYMBOL_VAR_STUB_NO_CACHE = 294,        /* VAR_STUB_NO_CACHE  */
+  YYSYMBOL_VAR_LOG_SERVFAIL = 295,         /* VAR_LOG_SERVFAIL  */
+  YYSYMBOL_VAR_DENY_ANY = 296,             /* VAR_DENY_ANY  */
+  YYSYMBOL_VAR_UNKNOWN_SERVER_TIME_LIMIT = 297, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
+  YYSYMBOL_VAR_LOG_TAG_QUERYREPLY = 298,   /* VAR_LOG_TAG_QUERYREPLY  */
+  YYSYMBOL_VAR_STREAM_WAIT_SIZE = 299,     /* VAR_STREAM_WAIT_SIZE  */
+  YYSYMBOL_VAR_TLS_CIPHERS = 300,          /* VAR_TLS_CIPHERS  */
+  YYSYMBOL_VAR_TLS_CIPHERSUITES = 301,     /* VAR_TLS_CIPHERSUITES  */
+  YYSYMBOL_VAR_TLS_USE_SNI = 302,          /* VAR_TLS_USE_SNI  */
+  YYSYMBOL_VAR_IPSET = 303,                /* VAR_IPSET  */
+  YYSYMBOL_VAR_IPSET_NAME_V4 = 304,        /* VAR_IPSET_NAME_V4  */
+  YYSYMBOL_VAR_IPSET_NAME_V6 = 305,        /* VAR_IPSET_NAME_V6  */
+  YYSYMBOL_VAR_TLS_SESSION_TICKET_KEYS = 306, /* VAR_TLS_SESSION_TICKET_KEYS  */
+  YYSYMBOL_VAR_RPZ = 307,                  /* VAR_RPZ  */
+  YYSYMBOL_VAR_TAGS = 308,                 /* VAR_TAGS  */
+  YYSYMBOL_VAR_RPZ_ACTION_OVERRIDE = 309,  /* VAR_RPZ_ACTION_OVERRIDE  */
+  YYSYMBOL_VAR_RPZ_CNAME_OVERRIDE = 310,   /* VAR_RPZ_CNAME_OVERRIDE  */
+  YYSYMBOL_VAR_RPZ_LOG = 311,              /* VAR_RPZ_LOG  */
+  YYSYMBOL_VAR_RPZ_LOG_NAME = 312,         /* VAR_RPZ_LOG_NAME  */
+  YYSYMBOL_VAR_DYNLIB = 313,               /* VAR_DYNLIB  */
+  YYSYMBOL_VAR_DYNLIB_FILE = 314,          /* VAR_DYNLIB_FILE  */
+  YYSYMBOL_VAR_EDNS_CLIENT_STRING = 315,   /* VAR_EDNS_CLIENT_STRING  */
+  YYSYMBOL_VAR_EDNS_CLIENT_STRING_OPCODE = 316, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
+  YYSYMBOL_VAR_NSID = 317,                 /* VAR_NSID  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_PRIME_ON_START = 318, /* VAR_TRUST_ANCHOR_PRIME_ON_START  */
+  YYSYMBOL_VAR_LOCAL_ZONE_FILE = 319,      /* VAR_LOCAL_ZONE_FILE  */
+  YYSYMBOL_VAR_TLS_SESSION_CACHE_SIZE = 320, /* VAR_TLS_SESSION_CACHE_SIZE  */
+  YYSYMBOL_VAR_TLS_USE_KTLS = 321,         /* VAR_TLS_USE_KTLS  */
+  YYSYMBOL_VAR_BUSY_POLL = 322,            /* VAR_BUSY_POLL  */
+  YYSYMBOL_VAR_USE_IO_URING = 323,         /* VAR_USE_IO_URING  */
+  YYSYMBOL_VAR_ANSWER_CACHE_SIZE = 324,    /* VAR_ANSWER_CACHE_SIZE  */
+  YYSYMBOL_YYACCEPT = 325,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 326,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 327,              /* toplevelvar  */
+  YYSYMBOL_force_toplevel = 328,           /* force_toplevel  */
+  YYSYMBOL_serverstart = 329,              /* serverstart  */
+  YYSYMBOL_contents_server = 330,          /* contents_server  */
+  YYSYMBOL_content_server = 331,           /* content_server  */
+  YYSYMBOL_stubstart = 332,                /* stubstart  */
+  YYSYMBOL_contents_stub = 333,            /* contents_stub  */
+  YYSYMBOL_content_stub = 334,             /* content_stub  */
+  YYSYMBOL_forwardstart = 335,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 336,         /* contents_forward  */
+  YYSYMBOL_content_forward = 337,          /* content_forward  */
+  YYSYMBOL_viewstart = 338,                /* viewstart  */
+  YYSYMBOL_contents_view = 339,            /* contents_view  */
+  YYSYMBOL_content_view = 340,             /* content_view  */
+  YYSYMBOL_authstart = 341,                /* authstart  */
+  YYSYMBOL_contents_auth = 342,            /* contents_auth  */
+  YYSYMBOL_content_auth = 343,             /* content_auth  */
+  YYSYMBOL_rpz_tag = 344,                  /* rpz_tag  */
+  YYSYMBOL_rpz_action_override = 345,      /* rpz_action_override  */
+  YYSYMBOL_rpz_cname_override = 346,       /* rpz_cname_override  */
+  YYSYMBOL_rpz_log = 347,                  /* rpz_log  */
+  YYSYMBOL_rpz_log_name = 348,             /* rpz_log_name  */
+  YYSYMBOL_rpzstart = 349,                 /* rpzstart  */
+  YYSYMBOL_contents_rpz = 350,             /* contents_rpz  */
+  YYSYMBOL_content_rpz = 351,              /* content_rpz  */
+  YYSYMBOL_server_num_threads = 352,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 353,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 354, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 355, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 356, /* server_extended_statistics  */
+  YYSYMBOL_server_shm_enable = 357,        /* server_shm_enable  */
+  YYSYMBOL_server_shm_key = 358,           /* server_shm_key  */
+  YYSYMBOL_server_port = 359,              /* server_port  */
+  YYSYMBOL_server_send_client_subnet = 360, /* server_send_client_subnet  */
+  YYSYMBOL_server_client_subnet_zone = 361, /* server_client_subnet_zone  */
+  YYSYMBOL_server_client_subnet_always_forward = 362, /* server_client_subnet_always_forward  */
+  YYSYMBOL_server_client_subnet_opcode = 363, /* server_client_subnet_opcode  */
+  YYSYMBOL_server_max_client_subnet_ipv4 = 364, /* server_max_client_subnet_ipv4  */
+  YYSYMBOL_server_max_client_subnet_ipv6 = 365, /* server_max_client_subnet_ipv6  */
+  YYSYMBOL_server_min_client_subnet_ipv4 = 366, /* server_min_client_subnet_ipv4  */
+  YYSYMBOL_server_min_client_subnet_ipv6 = 367, /* server_min_client_subnet_ipv6  */
+  YYSYMBOL_server_max_ecs_tree_size_ipv4 = 368, /* server_max_ecs_tree_size_ipv4  */
+  YYSYMBOL_server_max_ecs_tree_size_ipv6 = 369, /* server_max_ecs_tree_size_ipv6  */
+  YYSYMBOL_server_interface = 370,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 371, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 372,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 373, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 374, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 375,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 376,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_interface_automatic = 377, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 378,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 379,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 380,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 381,            /* server_do_tcp  */
+  YYSYMBOL_server_prefer_ip4 = 382,        /* server_prefer_ip4  */
+  YYSYMBOL_server_prefer_ip6 = 383,        /* server_prefer_ip6  */
+  YYSYMBOL_server_tcp_mss = 384,           /* server_tcp_mss  */
+  YYSYMBOL_server_outgoing_tcp_mss = 385,  /* server_outgoing_tcp_mss  */
+  YYSYMBOL_server_tcp_idle_timeout = 386,  /* server_tcp_idle_timeout  */
+  YYSYMBOL_server_tcp_keepalive = 387,     /* server_tcp_keepalive  */
+  YYSYMBOL_server_tcp_keepalive_timeout = 388, /* server_tcp_keepalive_timeout  */
+  YYSYMBOL_server_tcp_upstream = 389,      /* server_tcp_upstream  */
+  YYSYMBOL_server_udp_upstream_without_downstream = 390, /* server_udp_upstream_without_downstream  */
+  YYSYMBOL_server_ssl_upstream = 391,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 392,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 393,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_port = 394,          /* server_ssl_port  */
+  YYSYMBOL_server_tls_cert_bundle = 395,   /* server_tls_cert_bundle  */
+  YYSYMBOL_server_tls_win_cert = 396,      /* server_tls_win_cert  */
+  YYSYMBOL_server_tls_additional_port = 397, /* server_tls_additional_port  */
+  YYSYMBOL_server_tls_ciphers = 398,       /* server_tls_ciphers  */
+  YYSYMBOL_server_tls_ciphersuites = 399,  /* server_tls_ciphersuites  */
+  YYSYMBOL_server_tls_session_cache_size = 400, /* server_tls_session_cache_size  */
+  YYSYMBOL_server_tls_use_ktls = 401,      /* server_tls_use_ktls  */
+  YYSYMBOL_server_tls_session_ticket_keys = 402, /* server_tls_session_ticket_keys  */
+  YYSYMBOL_server_tls_use_sni = 403,       /* server_tls_use_sni  */
+  YYSYMBOL_server_https_port = 404,        /* server_https_port  */
+  YYSYMBOL_server_http_endpoint = 405,     /* server_http_endpoint  */
+  YYSYMBOL_server_http_max_streams = 406,  /* server_http_max_streams  */
+  YYSYMBOL_server_http_query_buffer_size = 407, /* server_http_query_buffer_size  */
+  YYSYMBOL_server_http_response_buffer_size = 408, /* server_http_response_buffer_size  */
+  YYSYMBOL_server_http_nodelay = 409,      /* server_http_nodelay  */
+  YYSYMBOL_server_http_notls_downstream = 410, /* server_http_notls_downstream  */
+  YYSYMBOL_server_use_systemd = 411,       /* server_use_systemd  */
+  YYSYMBOL_server_do_daemonize = 412,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 413,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 414,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 415,       /* server_log_queries  */
+  YYSYMBOL_server_log_replies = 416,       /* server_log_replies  */
+  YYSYMBOL_server_log_tag_queryreply = 417, /* server_log_tag_queryreply  */
+  YYSYMBOL_server_log_servfail = 418,      /* server_log_servfail  */
+  YYSYMBOL_server_log_local_actions = 419, /* server_log_local_actions  */
+  YYSYMBOL_server_chroot = 420,            /* server_chroot  */
+  YYSYMBOL_server_username = 421,          /* server_username  */
+  YYSYMBOL_server_directory = 422,         /* server_directory  */
+  YYSYMBOL_server_logfile = 423,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 424,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 425,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 426,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 427,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 428, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 429, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 430, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 431,      /* server_trust_anchor  */
+  YYSYMBOL_server_trust_anchor_signaling = 432, /* server_trust_anchor_signaling  */
+  YYSYMBOL_server_trust_anchor_prime_on_start = 433, /* server_trust_anchor_prime_on_start  */
+  YYSYMBOL_server_root_key_sentinel = 434, /* server_root_key_sentinel  */
+  YYSYMBOL_server_domain_insecure = 435,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 436,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 437,      /* server_hide_version  */
+  YYSYMBOL_server_hide_trustanchor = 438,  /* server_hide_trustanchor  */
+  YYSYMBOL_server_identity = 439,          /* server_identity  */
+  YYSYMBOL_server_version = 440,           /* server_version  */
+  YYSYMBOL_server_nsid = 441,              /* server_nsid  */
+  YYSYMBOL_server_so_rcvbuf = 442,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 443,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 444,      /* server_so_reuseport  */
+  YYSYMBOL_server_ip_transparent = 445,    /* server_ip_transparent  */
+  YYSYMBOL_server_ip_freebind = 446,       /* server_ip_freebind  */
+  YYSYMBOL_server_ip_dscp = 447,           /* server_ip_dscp  */
+  YYSYMBOL_server_busy_poll = 448,         /* server_busy_poll  */
+  YYSYMBOL_server_use_io_uring = 449,      /* server_use_io_uring  */
+  YYSYMBOL_server_stream_wait_size = 450,  /* server_stream_wait_size  */
+  YYSYMBOL_server_edns_buffer_size = 451,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 452,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 453,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 454,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_num_queries_per_thread = 455, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 456,    /* server_jostle_timeout  */
+  YYSYMBOL_server_delay_close = 457,       /* server_delay_close  */
+  YYSYMBOL_server_udp_connect = 458,       /* server_udp_connect  */
+  YYSYMBOL_server_unblock_lan_zones = 459, /* server_unblock_lan_zones  */
+  YYSYMBOL_server_insecure_lan_zones = 460, /* server_insecure_lan_zones  */
+  YYSYMBOL_server_rrset_cache_size = 461,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 462, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_infra_host_ttl = 463,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 464,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 465, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_lame_size = 466, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 467, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_infra_cache_min_rtt = 468, /* server_infra_cache_min_rtt  */
+  YYSYMBOL_server_infra_keep_probing = 469, /* server_infra_keep_probing  */
+  YYSYMBOL_server_target_fetch_policy = 470, /* server_target_fetch_policy  */
+  YYSYMBOL_server_harden_short_bufsize = 471, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 472, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 473,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 474, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 475, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 476, /* server_harden_referral_path  */
+  YYSYMBOL_server_harden_algo_downgrade = 477, /* server_harden_algo_downgrade  */
+  YYSYMBOL_server_use_caps_for_id = 478,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_caps_whitelist = 479,    /* server_caps_whitelist  */
+  YYSYMBOL_server_private_address = 480,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 481,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 482,          /* server_prefetch  */
+  YYSYMBOL_server_prefetch_key = 483,      /* server_prefetch_key  */
+  YYSYMBOL_server_deny_any = 484,          /* server_deny_any  */
+  YYSYMBOL_server_unwanted_reply_threshold = 485, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 486, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 487, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 488,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 489,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 490, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 491,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 492,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 493,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_max_negative_ttl = 494, /* server_cache_max_negative_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 495,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 496,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 497, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 498, /* server_val_permissive_mode  */
+  YYSYMBOL_server_aggressive_nsec = 499,   /* server_aggressive_nsec  */
+  YYSYMBOL_server_ignore_cd_flag = 500,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_serve_expired = 501,     /* server_serve_expired  */
+  YYSYMBOL_server_serve_expired_ttl = 502, /* server_serve_expired_ttl  */
+  YYSYMBOL_server_serve_expired_ttl_reset = 503, /* server_serve_expired_ttl_reset  */
+  YYSYMBOL_server_serve_expired_reply_ttl = 504, /* server_serve_expired_reply_ttl  */
+  YYSYMBOL_server_serve_expired_client_timeout = 505, /* server_serve_expired_client_timeout  */
+  YYSYMBOL_server_serve_original_ttl = 506, /* server_serve_original_ttl  */
+  YYSYMBOL_server_fake_dsa = 507,          /* server_fake_dsa  */
+  YYSYMBOL_server_fake_sha1 = 508,         /* server_fake_sha1  */
+  YYSYMBOL_server_val_log_level = 509,     /* server_val_log_level  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 510, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_add_holddown = 511,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 512,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 513,      /* server_keep_missing  */
+  YYSYMBOL_server_permit_small_holddown = 514, /* server_permit_small_holddown  */
+  YYSYMBOL_server_key_cache_size = 515,    /* server_key_cache_size  */
+  YYSYMBOL_server_key_cache_slabs = 516,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_neg_cache_size = 517,    /* server_neg_cache_size  */
+  YYSYMBOL_server_local_zone = 518,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 519,        /* server_local_data  */
+  YYSYMBOL_server_local_zone_file = 520,   /* server_local_zone_file  */
+  YYSYMBOL_server_local_data_ptr = 521,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 522, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 523,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_unknown_server_time_limit = 524, /* server_unknown_server_time_limit  */
+  YYSYMBOL_server_max_udp_size = 525,      /* server_max_udp_size  */
+  YYSYMBOL_server_dns64_prefix = 526,      /* server_dns64_prefix  */
+  YYSYMBOL_server_dns64_synthall = 527,    /* server_dns64_synthall  */
+  YYSYMBOL_server_dns64_ignore_aaaa = 528, /* server_dns64_ignore_aaaa  */
+  YYSYMBOL_server_define_tag = 529,        /* server_define_tag  */
+  YYSYMBOL_server_local_zone_tag = 530,    /* server_local_zone_tag  */
+  YYSYMBOL_server_access_control_tag = 531, /* server_access_control_tag  */
+  YYSYMBOL_server_access_control_tag_action = 532, /* server_access_control_tag_action  */
+  YYSYMBOL_server_access_control_tag_data = 533, /* server_access_control_tag_data  */
+  YYSYMBOL_server_local_zone_override = 534, /* server_local_zone_override  */
+  YYSYMBOL_server_access_control_view = 535, /* server_access_control_view  */
+  YYSYMBOL_server_response_ip_tag = 536,   /* server_response_ip_tag  */
+  YYSYMBOL_server_ip_ratelimit = 537,      /* server_ip_ratelimit  */
+  YYSYMBOL_server_ratelimit = 538,         /* server_ratelimit  */
+  YYSYMBOL_server_ip_ratelimit_size = 539, /* server_ip_ratelimit_size  */
+  YYSYMBOL_server_ratelimit_size = 540,    /* server_ratelimit_size  */
+  YYSYMBOL_server_ip_ratelimit_slabs = 541, /* server_ip_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_slabs = 542,   /* server_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_for_domain = 543, /* server_ratelimit_for_domain  */
+  YYSYMBOL_server_ratelimit_below_domain = 544, /* server_ratelimit_below_domain  */
+  YYSYMBOL_server_ip_ratelimit_factor = 545, /* server_ip_ratelimit_factor  */
+  YYSYMBOL_server_ratelimit_factor = 546,  /* server_ratelimit_factor  */
+  YYSYMBOL_server_low_rtt = 547,           /* server_low_rtt  */
+  YYSYMBOL_server_fast_server_num = 548,   /* server_fast_server_num  */
+  YYSYMBOL_server_fast_server_permil = 549, /* server_fast_server_permil  */
+  YYSYMBOL_server_qname_minimisation = 550, /* server_qname_minimisation  */
+  YYSYMBOL_server_qname_minimisation_strict = 551, /* server_qname_minimisation_strict  */
+  YYSYMBOL_server_pad_responses = 552,     /* server_pad_responses  */
+  YYSYMBOL_server_pad_responses_block_size = 553, /* server_pad_responses_block_size  */
+  YYSYMBOL_server_pad_queries = 554,       /* server_pad_queries  */
+  YYSYMBOL_server_pad_queries_block_size = 555, /* server_pad_queries_block_size  */
+  YYSYMBOL_server_ipsecmod_enabled = 556,  /* server_ipsecmod_enabled  */
+  YYSYMBOL_server_ipsecmod_ignore_bogus = 557, /* server_ipsecmod_ignore_bogus  */
+  YYSYMBOL_server_ipsecmod_hook = 558,     /* server_ipsecmod_hook  */
+  YYSYMBOL_server_ipsecmod_max_ttl = 559,  /* server_ipsecmod_max_ttl  */
+  YYSYMBOL_server_ipsecmod_whitelist = 560, /* server_ipsecmod_whitelist  */
+  YYSYMBOL_server_ipsecmod_strict = 561,   /* server_ipsecmod_strict  */
+  YYSYMBOL_server_edns_client_string = 562, /* server_edns_client_string  */
+  YYSYMBOL_server_edns_client_string_opcode = 563, /* server_edns_client_string_opcode  */
+  YYSYMBOL_stub_name = 564,                /* stub_name  */
+  YYSYMBOL_stub_host = 565,                /* stub_host  */
+  YYSYMBOL_stub_addr = 566,                /* stub_addr  */
+  YYSYMBOL_stub_first = 567,               /* stub_first  */
+  YYSYMBOL_stub_no_cache = 568,            /* stub_no_cache  */
+  YYSYMBOL_stub_ssl_upstream = 569,        /* stub_ssl_upstream  */
+  YYSYMBOL_stub_prime = 570,               /* stub_prime  */
+  YYSYMBOL_forward_name = 571,             /* forward_name  */
+  YYSYMBOL_forward_host = 572,             /* forward_host  */
+  YYSYMBOL_forward_addr = 573,             /* forward_addr  */
+  YYSYMBOL_forward_first = 574,            /* forward_first  */
+  YYSYMBOL_forward_no_cache = 575,         /* forward_no_cache  */
+  YYSYMBOL_forward_ssl_upstream = 576,     /* forward_ssl_upstream  */
+  YYSYMBOL_auth_name = 577,                /* auth_name  */
+  YYSYMBOL_auth_zonefile = 578,            /* auth_zonefile  */
+  YYSYMBOL_auth_master = 579,              /* auth_master  */
+  YYSYMBOL_auth_url = 580,                 /* auth_url  */
+  YYSYMBOL_auth_allow_notify = 581,        /* auth_allow_notify  */
+  YYSYMBOL_auth_for_downstream = 582,      /* auth_for_downstream  */
+  YYSYMBOL_auth_for_upstream = 583,        /* auth_for_upstream  */
+  YYSYMBOL_auth_fallback_enabled = 584,    /* auth_fallback_enabled  */
+  YYSYMBOL_auth_answer_cache_size = 585,   /* auth_answer_cache_size  */
+  YYSYMBOL_view_name = 586,                /* view_name  */
+  YYSYMBOL_view_local_zone = 587,          /* view_local_zone  */
+  YYSYMBOL_view_response_ip = 588,         /* view_response_ip  */
+  YYSYMBOL_view_response_ip_data = 589,    /* view_response_ip_data  */
+  YYSYMBOL_view_local_data = 590,          /* view_local_data  */
+  YYSYMBOL_view_local_data_ptr = 591,      /* view_local_data_ptr  */
+  YYSYMBOL_view_first = 592,               /* view_first  */
+  YYSYMBOL_rcstart = 593,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 594,              /* contents_rc  */
+  YYSYMBOL_content_rc = 595,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 596,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 597,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 598,     /* rc_control_interface  */
+  YYSYMBOL_rc_control_use_cert = 599,      /* rc_control_use_cert  */
+  YYSYMBOL_rc_server_key_file = 600,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 601,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 602,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 603,     /* rc_control_cert_file  */
+  YYSYMBOL_dtstart = 604,                  /* dtstart  */
+  YYSYMBOL_contents_dt = 605,              /* contents_dt  */
+  YYSYMBOL_content_dt = 606,               /* content_dt  */
+  YYSYMBOL_dt_dnstap_enable = 607,         /* dt_dnstap_enable  */
+  YYSYMBOL_dt_dnstap_bidirectional = 608,  /* dt_dnstap_bidirectional  */
+  YYSYMBOL_dt_dnstap_socket_path = 609,    /* dt_dnstap_socket_path  */
+  YYSYMBOL_dt_dnstap_ip = 610,             /* dt_dnstap_ip  */
+  YYSYMBOL_dt_dnstap_tls = 611,            /* dt_dnstap_tls  */
+  YYSYMBOL_dt_dnstap_tls_server_name = 612, /* dt_dnstap_tls_server_name  */
+  YYSYMBOL_dt_dnstap_tls_cert_bundle = 613, /* dt_dnstap_tls_cert_bundle  */
+  YYSYMBOL_dt_dnstap_tls_client_key_file = 614, /* dt_dnstap_tls_client_key_file  */
+  YYSYMBOL_dt_dnstap_tls_client_cert_file = 615, /* dt_dnstap_tls_client_cert_file  */
+  YYSYMBOL_dt_dnstap_send_identity = 616,  /* dt_dnstap_send_identity  */
+  YYSYMBOL_dt_dnstap_send_version = 617,   /* dt_dnstap_send_version  */
+  YYSYMBOL_dt_dnstap_identity = 618,       /* dt_dnstap_identity  */
+  YYSYMBOL_dt_dnstap_version = 619,        /* dt_dnstap_version  */
+  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 620, /* dt_dnstap_log_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 621, /* dt_dnstap_log_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_log_client_query_messages = 622, /* dt_dnstap_log_client_query_messages  */
+  YYSYMBOL_dt_dnstap_log_client_response_messages = 623, /* dt_dnstap_log_client_response_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 624, /* dt_dnstap_log_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 625, /* dt_dnstap_log_forwarder_response_messages  */
+  YYSYMBOL_dt_dnstap_sample_rate = 626,    /* dt_dnstap_sample_rate  */
+  YYSYMBOL_dt_dnstap_filter_qtype = 627,   /* dt_dnstap_filter_qtype  */
+  YYSYMBOL_dt_dnstap_filter_rcode = 628,   /* dt_dnstap_filter_rcode  */
+  YYSYMBOL_dt_dnstap_filter_local_zone = 629, /* dt_dnstap_filter_local_zone  */
+  YYSYMBOL_dt_dnstap_filter_response_time = 630, /* dt_dnstap_filter_response_time  */
+  YYSYMBOL_pythonstart = 631,              /* pythonstart  */
+  YYSYMBOL_contents_py = 632,              /* contents_py  */
+  YYSYMBOL_content_py = 633,               /* content_py  */
+  YYSYMBOL_py_script = 634,                /* py_script  */
+  YYSYMBOL_dynlibstart = 635,              /* dynlibstart  */
+  YYSYMBOL_contents_dl = 636,              /* contents_dl  */
+  YYSYMBOL_content_dl = 637,               /* content_dl  */
+  YYSYMBOL_dl_file = 638,                  /* dl_file  */
+  YYSYMBOL_server_disable_dnssec_lame_check = 639, /* server_disable_dnssec_lame_check  */
+  YYSYMBOL_server_log_identity = 640,      /* server_log_identity  */
+  YYSYMBOL_server_response_ip = 641,       /* server_response_ip  */
+  YYSYMBOL_server_response_ip_data = 642,  /* server_response_ip_data  */
+  YYSYMBOL_dnscstart = 643,                /* dnscstart  */
+  YYSYMBOL_contents_dnsc = 644,            /* contents_dnsc  */
+  YYSYMBOL_content_dnsc = 645,             /* content_dnsc  */
+  YYSYMBOL_dnsc_dnscrypt_enable = 646,     /* dnsc_dnscrypt_enable  */
+  YYSYMBOL_dnsc_dnscrypt_port = 647,       /* dnsc_dnscrypt_port  */
+  YYSYMBOL_dnsc_dnscrypt_provider = 648,   /* dnsc_dnscrypt_provider  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert = 649, /* dnsc_dnscrypt_provider_cert  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert_rotated = 650, /* dnsc_dnscrypt_provider_cert_rotated  */
+  YYSYMBOL_dnsc_dnscrypt_secret_key = 651, /* dnsc_dnscrypt_secret_key  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_size = 652, /* dnsc_dnscrypt_shared_secret_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_slabs = 653, /* dnsc_dnscrypt_shared_secret_cache_slabs  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_size = 654, /* dnsc_dnscrypt_nonce_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_slabs = 655, /* dnsc_dnscrypt_nonce_cache_slabs  */
+  YYSYMBOL_cachedbstart = 656,             /* cachedbstart  */
+  YYSYMBOL_contents_cachedb = 657,         /* contents_cachedb  */
+  YYSYMBOL_content_cachedb = 658,          /* content_cachedb  */
+  YYSYMBOL_cachedb_backend_name = 659,     /* cachedb_backend_name  */
+  YYSYMBOL_cachedb_secret_seed = 660,      /* cachedb_secret_seed  */
+  YYSYMBOL_cachedb_write_behind_size = 661, /* cachedb_write_behind_size  */
+  YYSYMBOL_cachedb_write_behind_interval = 662, /* cachedb_write_behind_interval  */
+  YYSYMBOL_cachedb_mmap_file = 663,        /* cachedb_mmap_file  */
+  YYSYMBOL_cachedb_mmap_size = 664,        /* cachedb_mmap_size  */
+  YYSYMBOL_redis_server_host = 665,        /* redis_server_host  */
+  YYSYMBOL_redis_server_port = 666,        /* redis_server_port  */
+  YYSYMBOL_redis_timeout = 667,            /* redis_timeout  */
+  YYSYMBOL_redis_expire_records = 668,     /* redis_expire_records  */
+  YYSYMBOL_server_tcp_connection_limit = 669, /* server_tcp_connection_limit  */
+  YYSYMBOL_ipsetstart = 670,               /* ipsetstart  */
+  YYSYMBOL_contents_ipset = 671,           /* contents_ipset  */
+  YYSYMBOL_content_ipset = 672,            /* content_ipset  */
+  YYSYMBOL_ipset_name_v4 = 673,            /* ipset_name_v4  */
+  YYSYMBOL_ipset_name_v6 = 674             /* ipset_name_v6  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -1472,6 +842,18 @@ typedef int_least16_t yytype_int16;
 typedef short yytype_int16;
 #endif
 
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
 #elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
@@ -1569,17 +951,23 @@ typedef int yy_state_fast_t;
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                            \
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
     _Pragma ("GCC diagnostic push")                                     \
     _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
 # define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
@@ -1738,18 +1126,19 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   652
+#define YYLAST   687
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  309
+#define YYNTOKENS  325
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  334
+#define YYNNTS  350
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  644
+#define YYNRULES  676
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  957
+#define YYNSTATES  1005
 
-#define YYMAXUTOK   563
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   579
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -1819,78 +1208,82 @@ static const yytype_int16 yytranslate[] =
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
      295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   324
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   187,   187,   187,   188,   188,   189,   189,   190,   190,
-     190,   191,   191,   192,   192,   193,   193,   194,   196,   202,
-     207,   208,   209,   209,   209,   210,   210,   211,   211,   211,
-     212,   212,   213,   213,   213,   214,   214,   215,   215,   215,
-     216,   216,   216,   217,   217,   218,   218,   219,   219,   220,
-     220,   221,   221,   222,   222,   223,   223,   224,   224,   225,
-     225,   225,   226,   226,   226,   227,   227,   227,   228,   228,
-     229,   229,   230,   230,   231,   231,   232,   232,   232,   233,
-     233,   234,   234,   235,   235,   235,   236,   236,   237,   237,
-     238,   238,   239,   239,   239,   240,   240,   241,   241,   242,
-     242,   243,   243,   244,   244,   245,   245,   245,   246,   246,
-     247,   247,   247,   248,   248,   248,   249,   249,   249,   250,
-     250,   250,   250,   251,   252,   252,   252,   253,   253,   253,
-     254,   254,   255,   255,   256,   256,   256,   257,   257,   257,
-     258,   258,   259,   259,   259,   260,   260,   261,   261,   261,
-     262,   262,   263,   263,   264,   264,   265,   266,   266,   267,
-     267,   268,   268,   269,   270,   270,   271,   271,   272,   272,
-     273,   273,   274,   274,   275,   275,   275,   276,   276,   277,
-     277,   278,   278,   279,   280,   280,   281,   281,   282,   283,
-     283,   284,   284,   285,   285,   286,   286,   287,   287,   287,
-     288,   288,   288,   289,   289,   290,   291,   291,   292,   292,
-     293,   293,   294,   294,   295,   295,   295,   296,   296,   296,
-     297,   297,   297,   298,   298,   299,   299,   300,   300,   301,
-     301,   302,   302,   304,   316,   317,   318,   318,   318,   318,
-     318,   319,   319,   321,   333,   334,   335,   335,   335,   335,
-     336,   336,   338,   352,   353,   354,   354,   354,   354,   355,
-     355,   355,   357,   374,   375,   376,   376,   376,   376,   377,
-     377,   377,   378,   381,   400,   417,   425,   435,   443,   460,
-     461,   462,   462,   462,   462,   462,   463,   463,   463,   464,
-     464,   466,   475,   484,   495,   504,   513,   522,   533,   542,
-     554,   568,   583,   594,   611,   628,   645,   662,   677,   692,
-     705,   720,   729,   738,   747,   756,   765,   774,   783,   792,
-     801,   810,   819,   828,   837,   846,   859,   868,   881,   890,
-     899,   908,   915,   922,   931,   938,   947,   955,   962,   969,
-     977,   986,   994,  1010,  1018,  1026,  1034,  1042,  1050,  1059,
-    1068,  1082,  1091,  1100,  1109,  1118,  1127,  1136,  1143,  1150,
-    1176,  1184,  1191,  1198,  1205,  1212,  1220,  1228,  1236,  1243,
-    1254,  1265,  1272,  1281,  1290,  1299,  1306,  1313,  1329,  1337,
-    1345,  1355,  1365,  1375,  1389,  1397,  1410,  1421,  1429,  1442,
-    1451,  1460,  1469,  1478,  1488,  1498,  1506,  1519,  1528,  1536,
-    1545,  1553,  1566,  1575,  1585,  1592,  1602,  1612,  1622,  1632,
-    1642,  1652,  1662,  1672,  1679,  1686,  1693,  1702,  1711,  1720,
-    1729,  1736,  1746,  1766,  1773,  1791,  1804,  1817,  1826,  1835,
-    1844,  1853,  1863,  1873,  1884,  1893,  1902,  1911,  1920,  1929,
-    1938,  1947,  1960,  1973,  1982,  1989,  1998,  2007,  2016,  2025,
-    2033,  2046,  2054,  2099,  2106,  2121,  2131,  2141,  2148,  2155,
-    2162,  2171,  2179,  2193,  2214,  2235,  2247,  2259,  2271,  2280,
-    2301,  2311,  2320,  2328,  2336,  2349,  2362,  2377,  2392,  2401,
-    2410,  2416,  2425,  2434,  2444,  2454,  2464,  2473,  2483,  2492,
-    2505,  2518,  2530,  2544,  2556,  2570,  2579,  2591,  2601,  2608,
-    2615,  2624,  2633,  2643,  2653,  2663,  2670,  2677,  2686,  2695,
-    2705,  2715,  2722,  2729,  2736,  2744,  2754,  2764,  2774,  2784,
-    2823,  2833,  2841,  2849,  2864,  2873,  2878,  2879,  2880,  2880,
-    2880,  2881,  2881,  2881,  2882,  2882,  2884,  2894,  2903,  2910,
-    2917,  2924,  2931,  2938,  2945,  2950,  2951,  2952,  2952,  2952,
-    2953,  2953,  2953,  2954,  2955,  2955,  2956,  2956,  2957,  2957,
-    2958,  2959,  2960,  2961,  2962,  2963,  2965,  2974,  2984,  2991,
-    2998,  3007,  3014,  3021,  3028,  3035,  3044,  3053,  3060,  3067,
-    3077,  3087,  3097,  3107,  3117,  3127,  3132,  3133,  3134,  3136,
-    3142,  3147,  3148,  3149,  3151,  3157,  3167,  3174,  3183,  3191,
-    3196,  3197,  3199,  3199,  3199,  3200,  3200,  3201,  3202,  3203,
-    3204,  3205,  3207,  3217,  3226,  3233,  3242,  3249,  3258,  3266,
-    3279,  3287,  3300,  3305,  3306,  3307,  3307,  3308,  3308,  3308,
-    3309,  3311,  3323,  3335,  3347,  3362,  3375,  3388,  3399,  3404,
-    3405,  3406,  3406,  3408,  3423
+       0,   198,   198,   198,   199,   199,   200,   200,   201,   201,
+     201,   202,   202,   203,   203,   204,   204,   205,   207,   213,
+     218,   219,   220,   220,   220,   221,   221,   222,   222,   222,
+     223,   223,   224,   224,   224,   225,   225,   226,   226,   226,
+     227,   227,   227,   228,   228,   229,   229,   230,   230,   231,
+     231,   232,   232,   233,   233,   234,   234,   235,   235,   236,
+     236,   236,   237,   237,   237,   238,   238,   238,   239,   239,
+     240,   240,   241,   241,   242,   242,   243,   243,   243,   244,
+     244,   245,   245,   246,   246,   246,   247,   247,   248,   248,
+     249,   249,   250,   250,   250,   251,   251,   252,   252,   253,
+     253,   254,   254,   255,   255,   256,   256,   256,   257,   257,
+     258,   258,   258,   259,   259,   259,   260,   260,   260,   261,
+     261,   261,   261,   262,   263,   263,   263,   264,   264,   264,
+     265,   265,   266,   266,   267,   267,   267,   268,   268,   268,
+     269,   269,   270,   270,   270,   271,   271,   272,   272,   272,
+     273,   273,   274,   274,   275,   275,   276,   277,   277,   278,
+     278,   279,   279,   280,   281,   281,   282,   282,   283,   283,
+     284,   284,   285,   285,   286,   286,   286,   287,   287,   288,
+     288,   289,   289,   290,   291,   291,   292,   292,   293,   294,
+     294,   295,   295,   296,   296,   297,   297,   298,   298,   298,
+     299,   299,   299,   300,   300,   301,   302,   302,   303,   303,
+     304,   304,   305,   305,   306,   306,   306,   307,   307,   307,
+     308,   308,   308,   309,   309,   310,   310,   311,   311,   312,
+     312,   313,   313,   314,   315,   316,   317,   318,   319,   321,
+     333,   334,   335,   335,   335,   335,   335,   336,   336,   338,
+     350,   351,   352,   352,   352,   352,   353,   353,   355,   369,
+     370,   371,   371,   371,   371,   372,   372,   372,   374,   391,
+     392,   393,   393,   393,   393,   394,   394,   394,   395,   395,
+     398,   417,   434,   442,   452,   460,   477,   478,   479,   479,
+     479,   479,   479,   480,   480,   480,   481,   481,   483,   492,
+     501,   512,   521,   530,   539,   550,   559,   571,   585,   600,
+     611,   628,   645,   662,   679,   694,   709,   722,   737,   746,
+     755,   764,   773,   782,   791,   800,   809,   818,   827,   836,
+     845,   854,   863,   876,   885,   898,   907,   916,   925,   932,
+     939,   948,   955,   964,   972,   979,   986,   995,  1004,  1012,
+    1021,  1029,  1045,  1053,  1061,  1069,  1077,  1085,  1094,  1103,
+    1117,  1126,  1135,  1144,  1153,  1162,  1171,  1178,  1185,  1211,
+    1219,  1226,  1233,  1240,  1247,  1255,  1263,  1271,  1278,  1289,
+    1298,  1309,  1316,  1325,  1334,  1343,  1350,  1357,  1373,  1381,
+    1389,  1399,  1409,  1419,  1433,  1442,  1451,  1459,  1472,  1483,
+    1491,  1504,  1513,  1522,  1531,  1540,  1550,  1560,  1568,  1581,
+    1590,  1598,  1607,  1615,  1628,  1637,  1647,  1654,  1664,  1674,
+    1684,  1694,  1704,  1714,  1724,  1734,  1741,  1748,  1755,  1764,
+    1773,  1782,  1791,  1798,  1808,  1828,  1835,  1853,  1866,  1879,
+    1888,  1897,  1906,  1915,  1925,  1935,  1946,  1955,  1964,  1973,
+    1982,  1991,  2000,  2009,  2022,  2035,  2044,  2051,  2060,  2069,
+    2078,  2087,  2095,  2108,  2116,  2161,  2168,  2175,  2190,  2200,
+    2210,  2217,  2224,  2231,  2240,  2248,  2262,  2283,  2304,  2316,
+    2328,  2340,  2349,  2370,  2380,  2389,  2397,  2405,  2418,  2431,
+    2446,  2461,  2470,  2479,  2485,  2494,  2503,  2513,  2523,  2533,
+    2542,  2552,  2561,  2574,  2587,  2599,  2613,  2625,  2639,  2648,
+    2660,  2670,  2677,  2684,  2693,  2702,  2712,  2722,  2732,  2739,
+    2746,  2755,  2764,  2774,  2784,  2791,  2798,  2805,  2813,  2823,
+    2833,  2843,  2852,  2862,  2901,  2911,  2919,  2927,  2942,  2951,
+    2956,  2957,  2958,  2958,  2958,  2959,  2959,  2959,  2960,  2960,
+    2962,  2972,  2981,  2988,  2995,  3002,  3009,  3016,  3023,  3028,
+    3029,  3030,  3030,  3030,  3031,  3031,  3031,  3032,  3033,  3033,
+    3034,  3034,  3035,  3035,  3036,  3037,  3038,  3039,  3040,  3041,
+    3042,  3042,  3043,  3043,  3044,  3046,  3055,  3065,  3072,  3079,
+    3088,  3095,  3102,  3109,  3116,  3125,  3134,  3141,  3148,  3158,
+    3168,  3178,  3188,  3198,  3208,  3219,  3226,  3233,  3243,  3254,
+    3259,  3260,  3261,  3263,  3269,  3274,  3275,  3276,  3278,  3284,
+    3294,  3301,  3310,  3318,  3323,  3324,  3326,  3326,  3326,  3327,
+    3327,  3328,  3329,  3330,  3331,  3332,  3334,  3344,  3353,  3360,
+    3369,  3376,  3385,  3393,  3406,  3414,  3427,  3432,  3433,  3434,
+    3434,  3435,  3435,  3436,  3436,  3437,  3437,  3437,  3438,  3440,
+    3452,  3464,  3477,  3490,  3502,  3514,  3526,  3541,  3554,  3567,
+    3578,  3583,  3584,  3585,  3585,  3587,  3602
 };
 #endif
 
@@ -1970,25 +1363,28 @@ static const char *const yytname[] =
   "VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES",
   "VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES",
   "VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES",
-  "VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES", "VAR_RESPONSE_IP_TAG",
-  "VAR_RESPONSE_IP", "VAR_RESPONSE_IP_DATA", "VAR_HARDEN_ALGO_DOWNGRADE",
-  "VAR_IP_TRANSPARENT", "VAR_IP_DSCP", "VAR_DISABLE_DNSSEC_LAME_CHECK",
-  "VAR_IP_RATELIMIT", "VAR_IP_RATELIMIT_SLABS", "VAR_IP_RATELIMIT_SIZE",
-  "VAR_RATELIMIT", "VAR_RATELIMIT_SLABS", "VAR_RATELIMIT_SIZE",
-  "VAR_RATELIMIT_FOR_DOMAIN", "VAR_RATELIMIT_BELOW_DOMAIN",
-  "VAR_IP_RATELIMIT_FACTOR", "VAR_RATELIMIT_FACTOR",
-  "VAR_SEND_CLIENT_SUBNET", "VAR_CLIENT_SUBNET_ZONE",
-  "VAR_CLIENT_SUBNET_ALWAYS_FORWARD", "VAR_CLIENT_SUBNET_OPCODE",
-  "VAR_MAX_CLIENT_SUBNET_IPV4", "VAR_MAX_CLIENT_SUBNET_IPV6",
-  "VAR_MIN_CLIENT_SUBNET_IPV4", "VAR_MIN_CLIENT_SUBNET_IPV6",
-  "VAR_MAX_ECS_TREE_SIZE_IPV4", "VAR_MAX_ECS_TREE_SIZE_IPV6",
-  "VAR_CAPS_WHITELIST", "VAR_CACHE_MAX_NEGATIVE_TTL",
-  "VAR_PERMIT_SMALL_HOLDDOWN", "VAR_QNAME_MINIMISATION",
-  "VAR_QNAME_MINIMISATION_STRICT", "VAR_IP_FREEBIND", "VAR_DEFINE_TAG",
-  "VAR_LOCAL_ZONE_TAG", "VAR_ACCESS_CONTROL_TAG",
-  "VAR_LOCAL_ZONE_OVERRIDE", "VAR_ACCESS_CONTROL_TAG_ACTION",
-  "VAR_ACCESS_CONTROL_TAG_DATA", "VAR_VIEW", "VAR_ACCESS_CONTROL_VIEW",
-  "VAR_VIEW_FIRST", "VAR_SERVE_EXPIRED", "VAR_SERVE_EXPIRED_TTL",
+  "VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES", "VAR_DNSTAP_SAMPLE_RATE",
+  "VAR_DNSTAP_FILTER_QTYPE", "VAR_DNSTAP_FILTER_RCODE",
+  "VAR_DNSTAP_FILTER_LOCAL_ZONE", "VAR_DNSTAP_FILTER_RESPONSE_TIME",
+  "VAR_RESPONSE_IP_TAG", "VAR_RESPONSE_IP", "VAR_RESPONSE_IP_DATA",
+  "VAR_HARDEN_ALGO_DOWNGRADE", "VAR_IP_TRANSPARENT", "VAR_IP_DSCP",
+  "VAR_DISABLE_DNSSEC_LAME_CHECK", "VAR_IP_RATELIMIT",
+  "VAR_IP_RATELIMIT_SLABS", "VAR_IP_RATELIMIT_SIZE", "VAR_RATELIMIT",
+  "VAR_RATELIMIT_SLABS", "VAR_RATELIMIT_SIZE", "VAR_RATELIMIT_FOR_DOMAIN",
+  "VAR_RATELIMIT_BELOW_DOMAIN", "VAR_IP_RATELIMIT_FACTOR",
+  "VAR_RATELIMIT_FACTOR", "VAR_SEND_CLIENT_SUBNET",
+  "VAR_CLIENT_SUBNET_ZONE", "VAR_CLIENT_SUBNET_ALWAYS_FORWARD",
+  "VAR_CLIENT_SUBNET_OPCODE", "VAR_MAX_CLIENT_SUBNET_IPV4",
+  "VAR_MAX_CLIENT_SUBNET_IPV6", "VAR_MIN_CLIENT_SUBNET_IPV4",
+  "VAR_MIN_CLIENT_SUBNET_IPV6", "VAR_MAX_ECS_TREE_SIZE_IPV4",
+  "VAR_MAX_ECS_TREE_SIZE_IPV6", "VAR_CAPS_WHITELIST",
+  "VAR_CACHE_MAX_NEGATIVE_TTL", "VAR_PERMIT_SMALL_HOLDDOWN",
+  "VAR_QNAME_MINIMISATION", "VAR_QNAME_MINIMISATION_STRICT",
+  "VAR_IP_FREEBIND", "VAR_DEFINE_TAG", "VAR_LOCAL_ZONE_TAG",
+  "VAR_ACCESS_CONTROL_TAG", "VAR_LOCAL_ZONE_OVERRIDE",
+  "VAR_ACCESS_CONTROL_TAG_ACTION", "VAR_ACCESS_CONTROL_TAG_DATA",
+  "VAR_VIEW", "VAR_ACCESS_CONTROL_VIEW", "VAR_VIEW_FIRST",
+  "VAR_SERVE_EXPIRED", "VAR_SERVE_EXPIRED_TTL",
   "VAR_SERVE_EXPIRED_TTL_RESET", "VAR_SERVE_EXPIRED_REPLY_TTL",
   "VAR_SERVE_EXPIRED_CLIENT_TIMEOUT", "VAR_SERVE_ORIGINAL_TTL",
   "VAR_FAKE_DSA", "VAR_FAKE_SHA1", "VAR_LOG_IDENTITY",
@@ -2007,7 +1403,9 @@ static const char *const yytname[] =
   "VAR_IPSECMOD_WHITELIST", "VAR_IPSECMOD_STRICT", "VAR_CACHEDB",
   "VAR_CACHEDB_BACKEND", "VAR_CACHEDB_SECRETSEED", "VAR_CACHEDB_REDISHOST",
   "VAR_CACHEDB_REDISPORT", "VAR_CACHEDB_REDISTIMEOUT",
-  "VAR_CACHEDB_REDISEXPIRERECORDS", "VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM",
+  "VAR_CACHEDB_REDISEXPIRERECORDS", "VAR_CACHEDB_WRITEBEHINDSIZE",
+  "VAR_CACHEDB_WRITEBEHINDINTERVAL", "VAR_CACHEDB_MMAPFILE",
+  "VAR_CACHEDB_MMAPSIZE", "VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM",
   "VAR_FOR_UPSTREAM", "VAR_AUTH_ZONE", "VAR_ZONEFILE", "VAR_MASTER",
   "VAR_URL", "VAR_FOR_DOWNSTREAM", "VAR_FALLBACK_ENABLED",
   "VAR_TLS_ADDITIONAL_PORT", "VAR_LOW_RTT", "VAR_LOW_RTT_PERMIL",
@@ -2021,14 +1419,16 @@ static const char *const yytname[] =
   "VAR_RPZ_ACTION_OVERRIDE", "VAR_RPZ_CNAME_OVERRIDE", "VAR_RPZ_LOG",
   "VAR_RPZ_LOG_NAME", "VAR_DYNLIB", "VAR_DYNLIB_FILE",
   "VAR_EDNS_CLIENT_STRING", "VAR_EDNS_CLIENT_STRING_OPCODE", "VAR_NSID",
-  "$accept", "toplevelvars", "toplevelvar", "force_toplevel",
-  "serverstart", "contents_server", "content_server", "stubstart",
-  "contents_stub", "content_stub", "forwardstart", "contents_forward",
-  "content_forward", "viewstart", "contents_view", "content_view",
-  "authstart", "contents_auth", "content_auth", "rpz_tag",
-  "rpz_action_override", "rpz_cname_override", "rpz_log", "rpz_log_name",
-  "rpzstart", "contents_rpz", "content_rpz", "server_num_threads",
-  "server_verbosity", "server_statistics_interval",
+  "VAR_TRUST_ANCHOR_PRIME_ON_START", "VAR_LOCAL_ZONE_FILE",
+  "VAR_TLS_SESSION_CACHE_SIZE", "VAR_TLS_USE_KTLS", "VAR_BUSY_POLL",
+  "VAR_USE_IO_URING", "VAR_ANSWER_CACHE_SIZE", "$accept", "toplevelvars",
+  "toplevelvar", "force_toplevel", "serverstart", "contents_server",
+  "content_server", "stubstart", "contents_stub", "content_stub",
+  "forwardstart", "contents_forward", "content_forward", "viewstart",
+  "contents_view", "content_view", "authstart", "contents_auth",
+  "content_auth", "rpz_tag", "rpz_action_override", "rpz_cname_override",
+  "rpz_log", "rpz_log_name", "rpzstart", "contents_rpz", "content_rpz",
+  "server_num_threads", "server_verbosity", "server_statistics_interval",
   "server_statistics_cumulative", "server_extended_statistics",
   "server_shm_enable", "server_shm_key", "server_port",
   "server_send_client_subnet", "server_client_subnet_zone",
@@ -2048,7 +1448,8 @@ static const char *const yytname[] =
   "server_ssl_service_key", "server_ssl_service_pem", "server_ssl_port",
   "server_tls_cert_bundle", "server_tls_win_cert",
   "server_tls_additional_port", "server_tls_ciphers",
-  "server_tls_ciphersuites", "server_tls_session_ticket_keys",
+  "server_tls_ciphersuites", "server_tls_session_cache_size",
+  "server_tls_use_ktls", "server_tls_session_ticket_keys",
   "server_tls_use_sni", "server_https_port", "server_http_endpoint",
   "server_http_max_streams", "server_http_query_buffer_size",
   "server_http_response_buffer_size", "server_http_nodelay",
@@ -2061,46 +1462,48 @@ static const char *const yytname[] =
   "server_dlv_anchor", "server_auto_trust_anchor_file",
   "server_trust_anchor_file", "server_trusted_keys_file",
   "server_trust_anchor", "server_trust_anchor_signaling",
-  "server_root_key_sentinel", "server_domain_insecure",
-  "server_hide_identity", "server_hide_version", "server_hide_trustanchor",
-  "server_identity", "server_version", "server_nsid", "server_so_rcvbuf",
-  "server_so_sndbuf", "server_so_reuseport", "server_ip_transparent",
-  "server_ip_freebind", "server_ip_dscp", "server_stream_wait_size",
-  "server_edns_buffer_size", "server_msg_buffer_size",
-  "server_msg_cache_size", "server_msg_cache_slabs",
-  "server_num_queries_per_thread", "server_jostle_timeout",
-  "server_delay_close", "server_udp_connect", "server_unblock_lan_zones",
-  "server_insecure_lan_zones", "server_rrset_cache_size",
-  "server_rrset_cache_slabs", "server_infra_host_ttl",
-  "server_infra_lame_ttl", "server_infra_cache_numhosts",
-  "server_infra_cache_lame_size", "server_infra_cache_slabs",
-  "server_infra_cache_min_rtt", "server_infra_keep_probing",
-  "server_target_fetch_policy", "server_harden_short_bufsize",
-  "server_harden_large_queries", "server_harden_glue",
-  "server_harden_dnssec_stripped", "server_harden_below_nxdomain",
-  "server_harden_referral_path", "server_harden_algo_downgrade",
-  "server_use_caps_for_id", "server_caps_whitelist",
-  "server_private_address", "server_private_domain", "server_prefetch",
-  "server_prefetch_key", "server_deny_any",
-  "server_unwanted_reply_threshold", "server_do_not_query_address",
-  "server_do_not_query_localhost", "server_access_control",
-  "server_module_conf", "server_val_override_date",
-  "server_val_sig_skew_min", "server_val_sig_skew_max",
-  "server_cache_max_ttl", "server_cache_max_negative_ttl",
-  "server_cache_min_ttl", "server_bogus_ttl",
-  "server_val_clean_additional", "server_val_permissive_mode",
-  "server_aggressive_nsec", "server_ignore_cd_flag",
-  "server_serve_expired", "server_serve_expired_ttl",
-  "server_serve_expired_ttl_reset", "server_serve_expired_reply_ttl",
-  "server_serve_expired_client_timeout", "server_serve_original_ttl",
-  "server_fake_dsa", "server_fake_sha1", "server_val_log_level",
-  "server_val_nsec3_keysize_iterations", "server_add_holddown",
-  "server_del_holddown", "server_keep_missing",
+  "server_trust_anchor_prime_on_start", "server_root_key_sentinel",
+  "server_domain_insecure", "server_hide_identity", "server_hide_version",
+  "server_hide_trustanchor", "server_identity", "server_version",
+  "server_nsid", "server_so_rcvbuf", "server_so_sndbuf",
+  "server_so_reuseport", "server_ip_transparent", "server_ip_freebind",
+  "server_ip_dscp", "server_busy_poll", "server_use_io_uring",
+  "server_stream_wait_size", "server_edns_buffer_size",
+  "server_msg_buffer_size", "server_msg_cache_size",
+  "server_msg_cache_slabs", "server_num_queries_per_thread",
+  "server_jostle_timeout", "server_delay_close", "server_udp_connect",
+  "server_unblock_lan_zones", "server_insecure_lan_zones",
+  "server_rrset_cache_size", "server_rrset_cache_slabs",
+  "server_infra_host_ttl", "server_infra_lame_ttl",
+  "server_infra_cache_numhosts", "server_infra_cache_lame_size",
+  "server_infra_cache_slabs", "server_infra_cache_min_rtt",
+  "server_infra_keep_probing", "server_target_fetch_policy",
+  "server_harden_short_bufsize", "server_harden_large_queries",
+  "server_harden_glue", "server_harden_dnssec_stripped",
+  "server_harden_below_nxdomain", "server_harden_referral_path",
+  "server_harden_algo_downgrade", "server_use_caps_for_id",
+  "server_caps_whitelist", "server_private_address",
+  "server_private_domain", "server_prefetch", "server_prefetch_key",
+  "server_deny_any", "server_unwanted_reply_threshold",
+  "server_do_not_query_address", "server_do_not_query_localhost",
+  "server_access_control", "server_module_conf",
+  "server_val_override_date", "server_val_sig_skew_min",
+  "server_val_sig_skew_max", "server_cache_max_ttl",
+  "server_cache_max_negative_ttl", "server_cache_min_ttl",
+  "server_bogus_ttl", "server_val_clean_additional",
+  "server_val_permissive_mode", "server_aggressive_nsec",
+  "server_ignore_cd_flag", "server_serve_expired",
+  "server_serve_expired_ttl", "server_serve_expired_ttl_reset",
+  "server_serve_expired_reply_ttl", "server_serve_expired_client_timeout",
+  "server_serve_original_ttl", "server_fake_dsa", "server_fake_sha1",
+  "server_val_log_level", "server_val_nsec3_keysize_iterations",
+  "server_add_holddown", "server_del_holddown", "server_keep_missing",
   "server_permit_small_holddown", "server_key_cache_size",
   "server_key_cache_slabs", "server_neg_cache_size", "server_local_zone",
-  "server_local_data", "server_local_data_ptr", "server_minimal_responses",
-  "server_rrset_roundrobin", "server_unknown_server_time_limit",
-  "server_max_udp_size", "server_dns64_prefix", "server_dns64_synthall",
+  "server_local_data", "server_local_zone_file", "server_local_data_ptr",
+  "server_minimal_responses", "server_rrset_roundrobin",
+  "server_unknown_server_time_limit", "server_max_udp_size",
+  "server_dns64_prefix", "server_dns64_synthall",
   "server_dns64_ignore_aaaa", "server_define_tag", "server_local_zone_tag",
   "server_access_control_tag", "server_access_control_tag_action",
   "server_access_control_tag_data", "server_local_zone_override",
@@ -2123,35 +1526,40 @@ static const char *const yytname[] =
   "forward_first", "forward_no_cache", "forward_ssl_upstream", "auth_name",
   "auth_zonefile", "auth_master", "auth_url", "auth_allow_notify",
   "auth_for_downstream", "auth_for_upstream", "auth_fallback_enabled",
-  "view_name", "view_local_zone", "view_response_ip",
-  "view_response_ip_data", "view_local_data", "view_local_data_ptr",
-  "view_first", "rcstart", "contents_rc", "content_rc",
-  "rc_control_enable", "rc_control_port", "rc_control_interface",
-  "rc_control_use_cert", "rc_server_key_file", "rc_server_cert_file",
-  "rc_control_key_file", "rc_control_cert_file", "dtstart", "contents_dt",
-  "content_dt", "dt_dnstap_enable", "dt_dnstap_bidirectional",
-  "dt_dnstap_socket_path", "dt_dnstap_ip", "dt_dnstap_tls",
-  "dt_dnstap_tls_server_name", "dt_dnstap_tls_cert_bundle",
-  "dt_dnstap_tls_client_key_file", "dt_dnstap_tls_client_cert_file",
-  "dt_dnstap_send_identity", "dt_dnstap_send_version",
-  "dt_dnstap_identity", "dt_dnstap_version",
+  "auth_answer_cache_size", "view_name", "view_local_zone",
+  "view_response_ip", "view_response_ip_data", "view_local_data",
+  "view_local_data_ptr", "view_first", "rcstart", "contents_rc",
+  "content_rc", "rc_control_enable", "rc_control_port",
+  "rc_control_interface", "rc_control_use_cert", "rc_server_key_file",
+  "rc_server_cert_file", "rc_control_key_file", "rc_control_cert_file",
+  "dtstart", "contents_dt", "content_dt", "dt_dnstap_enable",
+  "dt_dnstap_bidirectional", "dt_dnstap_socket_path", "dt_dnstap_ip",
+  "dt_dnstap_tls", "dt_dnstap_tls_server_name",
+  "dt_dnstap_tls_cert_bundle", "dt_dnstap_tls_client_key_file",
+  "dt_dnstap_tls_client_cert_file", "dt_dnstap_send_identity",
+  "dt_dnstap_send_version", "dt_dnstap_identity", "dt_dnstap_version",
   "dt_dnstap_log_resolver_query_messages",
   "dt_dnstap_log_resolver_response_messages",
   "dt_dnstap_log_client_query_messages",
   "dt_dnstap_log_client_response_messages",
   "dt_dnstap_log_forwarder_query_messages",
-  "dt_dnstap_log_forwarder_response_messages", "pythonstart",
-  "contents_py", "content_py", "py_script", "dynlibstart", "contents_dl",
-  "content_dl", "dl_file", "server_disable_dnssec_lame_check",
-  "server_log_identity", "server_response_ip", "server_response_ip_data",
-  "dnscstart", "contents_dnsc", "content_dnsc", "dnsc_dnscrypt_enable",
+  "dt_dnstap_log_forwarder_response_messages", "dt_dnstap_sample_rate",
+  "dt_dnstap_filter_qtype", "dt_dnstap_filter_rcode",
+  "dt_dnstap_filter_local_zone", "dt_dnstap_filter_response_time",
+  "pythonstart", "contents_py", "content_py", "py_script", "dynlibstart",
+  "contents_dl", "content_dl", "dl_file",
+  "server_disable_dnssec_lame_check", "server_log_identity",
+  "server_response_ip", "server_response_ip_data", "dnscstart",
+  "contents_dnsc", "content_dnsc", "dnsc_dnscrypt_enable",
   "dnsc_dnscrypt_port", "dnsc_dnscrypt_provider",
   "dnsc_dnscrypt_provider_cert", "dnsc_dnscrypt_provider_cert_rotated",
   "dnsc_dnscrypt_secret_key", "dnsc_dnscrypt_shared_secret_cache_size",
   "dnsc_dnscrypt_shared_secret_cache_slabs",
   "dnsc_dnscrypt_nonce_cache_size", "dnsc_dnscrypt_nonce_cache_slabs",
   "cachedbstart", "contents_cachedb", "content_cachedb",
-  "cachedb_backend_name", "cachedb_secret_seed", "redis_server_host",
+  "cachedb_backend_name", "cachedb_secret_seed",
+  "cachedb_write_behind_size", "cachedb_write_behind_interval",
+  "cachedb_mmap_file", "cachedb_mmap_size", "redis_server_host",
   "redis_server_port", "redis_timeout", "redis_expire_records",
   "server_tcp_connection_limit", "ipsetstart", "contents_ipset",
   "content_ipset", "ipset_name_v4", "ipset_name_v6", YY_NULLPTR
@@ -2164,46 +1572,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_int16 yytoknum[] =
-{
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   520,   521,   522,   523,   524,
-     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
-     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
-     545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   563
-};
-#endif
-
-#define YYPACT_NINF (-296)
+#define YYPACT_NINF (-302)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -2213,117 +1582,122 @@ static const yytype_int16 yytoknum[] =
 #define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -296,     0,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,   292,   -42,   -38,   -43,   -21,   -44,   -11,   -96,
-    -109,  -295,  -216,  -245,  -287,     3,     4,    13,    25,    26,
-      27,    30,    31,    32,    33,    34,    35,    37,    38,    39,
-      40,    41,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    54,    55,    84,    85,    88,    89,    91,    93,
-      94,    95,    96,    98,    99,   100,   101,   103,   104,   105,
-     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   132,   133,   134,   135,   136,   137,
-     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
-     169,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,   206,   207,   208,   209,
-     210,   212,   213,   214,   215,   216,   220,   221,   222,   223,
-     224,   225,   226,   228,   229,   231,   232,   234,   235,   237,
-     239,   252,   253,   254,   255,   256,   257,   258,   259,   261,
-     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+    -302,     0,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,   301,   -40,   -36,   -43,   -44,   -39,   -68,   -94,
+    -103,  -300,  -227,  -214,  -301,     3,     5,     6,    27,    30,
+      31,    32,    33,    34,    35,    37,    38,    39,    40,    41,
+      54,    55,    56,    57,    83,    84,    85,    87,    88,    90,
+      91,    93,    95,    96,    97,    98,   100,   101,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   176,   177,   178,
+     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   215,   217,   218,   219,
+     220,   221,   222,   223,   225,   234,   237,   238,   239,   240,
+     242,   243,   245,   246,   248,   249,   250,   251,   252,   253,
+     254,   255,   257,   258,   264,   265,   266,   267,   268,   271,
      272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
-     282,   283,   285,   286,   287,   289,   290,   291,   293,   327,
-     328,   329,   330,   334,   335,   336,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,   378,   379,
-     380,   381,   382,   383,   384,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,   385,   386,   390,   394,   395,   420,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,   421,   422,   431,   444,
-     445,   446,   447,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,   448,   449,   450,   451,   452,   453,   454,   455,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,   456,   457,
-     458,   459,   460,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,   461,   462,   463,   503,   505,   522,
-     523,   524,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,   525,   526,   527,   528,   529,   530,   531,   532,   543,
-     544,   545,   546,   547,   548,   549,   551,   552,   553,   554,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-     555,  -296,  -296,   556,  -296,  -296,   557,   560,   563,   566,
-     567,   576,   577,   578,   580,   581,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,   582,   583,   584,
-     585,   586,   587,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-     591,   592,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,   593,   594,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,   595,   596,   597,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,   598,   599,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,   600,   601,   602,   603,   604,
-     605,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,   606,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,   607,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-     608,  -296,  -296,   609,   610,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,   611,   612,   613,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296
+     282,   283,   284,   285,   286,   287,   288,   289,   290,   291,
+     292,   294,   295,   296,   298,   299,   300,   302,   336,   337,
+     338,   339,   343,   344,   345,   387,   388,   389,   390,   391,
+     392,   393,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+     394,   395,   399,   403,   404,   429,   430,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,   431,   440,   453,   454,   455,
+     456,  -302,  -302,  -302,  -302,  -302,  -302,  -302,   457,   458,
+     459,   460,   461,   462,   463,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,   464,   465,   466,   467,   468,   469,   470,
+     471,   472,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,   473,   474,   475,   476,   477,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,   517,   519,
+     536,   537,   538,   539,   540,   541,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,   542,   543,   544,   545,   546,
+     557,   558,   559,   560,   561,   562,   563,   564,   565,   566,
+     567,   569,   570,   571,   572,   573,   574,   575,   578,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,   581,  -302,  -302,   584,  -302,  -302,
+     585,   594,   595,   596,   598,   599,   600,   601,   602,   603,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,   604,   605,   615,   616,   617,   618,   619,   620,   621,
+     622,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,   623,   624,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,   625,   626,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,   627,   628,   629,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,   630,   631,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,   632,   633,   634,
+     635,   636,   637,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,   638,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,   639,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,   640,  -302,
+    -302,   641,   642,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,   643,   644,   645,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-       2,     0,     1,    18,    19,   233,   243,   525,   585,   544,
-     252,   599,   622,   262,   638,   278,   590,     3,    17,    21,
-     235,   245,   254,   264,   280,   527,   546,   587,   592,   601,
-     624,   640,     4,     5,     6,    10,    14,    15,     8,     9,
+       2,     0,     1,    18,    19,   239,   249,   539,   609,   558,
+     258,   623,   646,   268,   670,   285,   614,     3,    17,    21,
+     241,   251,   260,   270,   287,   541,   560,   611,   616,   625,
+     648,   672,     4,     5,     6,    10,    14,    15,     8,     9,
        7,    16,    11,    12,    13,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -2345,309 +1719,322 @@ static const yytype_int16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    20,    22,    23,    86,
-      89,    98,   200,   201,    24,   160,   161,   162,   163,   164,
-     165,   166,   167,   168,   169,    37,    77,    25,    90,    91,
-      48,    70,    85,    26,    27,    30,    31,    28,    29,    32,
-      33,    34,    35,    36,   121,   212,   122,   124,   125,   126,
-     214,   219,   215,   226,   227,   228,   229,   127,   128,   129,
-     130,   131,   132,   133,   196,    87,    76,   102,   119,   120,
-     224,   221,   123,    38,    39,    40,    41,    42,    78,    92,
-      93,   108,    64,    74,    65,   204,   205,   103,    58,    59,
-     203,    60,    61,   232,   112,   116,   137,   147,   174,   150,
-     225,   113,    71,    43,    44,    45,   100,   138,   139,   140,
-     141,    46,    47,    49,    50,    52,    53,    51,   145,   151,
-      54,    55,    56,    62,    81,   117,    95,   146,    88,   170,
-      96,    97,   114,   115,   222,   101,    57,    79,    82,    63,
-      66,   104,   105,    80,   171,   106,    67,    68,    69,   213,
-     118,   188,   189,   190,   191,   192,   193,   194,   202,   107,
-      75,   109,   110,   111,   172,    72,    73,    94,    83,    84,
-      99,   134,   135,   223,   136,   142,   143,   144,   175,   176,
-     178,   180,   181,   179,   182,   197,   148,   149,   154,   155,
-     152,   153,   156,   157,   159,   158,   216,   218,   217,   173,
-     183,   184,   185,   186,   187,   206,   208,   207,   209,   210,
-     211,   230,   231,   177,   195,   198,   199,   220,     0,     0,
-       0,     0,     0,     0,     0,   234,   236,   237,   238,   240,
-     241,   242,   239,     0,     0,     0,     0,     0,     0,   244,
-     246,   247,   248,   249,   250,   251,     0,     0,     0,     0,
-       0,     0,     0,   253,   255,   256,   259,   260,   257,   261,
-     258,     0,     0,     0,     0,     0,     0,     0,     0,   263,
-     265,   266,   267,   268,   272,   269,   270,   271,     0,     0,
-       0,     0,     0,   283,   287,   288,   289,   290,   279,   281,
-     282,   284,   285,   286,     0,     0,     0,     0,     0,     0,
-       0,     0,   526,   528,   530,   529,   535,   531,   532,   533,
-     534,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     545,   547,   549,   548,   550,   551,   552,   553,   554,   555,
-     556,   557,   558,   559,   560,   561,   562,   563,   564,   565,
-       0,   586,   588,     0,   591,   593,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   600,   602,   603,   604,
-     606,   607,   605,   608,   609,   610,   611,     0,     0,     0,
-       0,     0,     0,   623,   625,   626,   627,   628,   629,   630,
-       0,     0,   639,   641,   642,   292,   291,   298,   311,   309,
-     321,   317,   318,   322,   319,   320,   323,   324,   325,   326,
-     327,   357,   358,   359,   360,   361,   387,   388,   389,   395,
-     396,   314,   397,   398,   401,   399,   400,   404,   405,   406,
-     420,   372,   373,   375,   376,   407,   423,   366,   368,   424,
-     430,   431,   432,   315,   386,   449,   450,   367,   444,   350,
-     310,   362,   421,   427,   408,     0,     0,   453,   316,   293,
-     349,   412,   294,   312,   313,   363,   364,   451,   410,   414,
-     415,   295,   454,   390,   419,   351,   371,   425,   426,   429,
-     443,   365,   447,   445,   446,   378,   385,   416,   417,   379,
-     380,   409,   434,   352,   353,   356,   328,   330,   331,   332,
-     333,   334,   341,   342,   343,   344,   345,   346,   347,   455,
-     456,   458,   391,   392,   393,   394,   402,   403,   459,   460,
-     461,     0,     0,     0,   411,   381,   383,   595,   470,   474,
-     472,   471,   475,   473,     0,     0,   478,   479,   299,   300,
-     301,   302,   303,   304,   305,   306,   307,   308,   413,   428,
-     448,   483,   484,   382,   462,     0,     0,     0,     0,     0,
-       0,   435,   436,   437,   438,   439,   440,   441,   442,   596,
-     374,   369,   433,   348,   296,   297,   370,   485,   486,   487,
-     488,   489,   491,   490,   492,   493,   494,   329,   336,   480,
-     482,   481,   335,     0,   355,   418,   457,   354,   384,   337,
-     338,   340,   339,     0,   496,   377,   497,   498,   499,   503,
-     502,   500,   501,   504,   505,   506,   507,   509,   508,   518,
-       0,   522,   523,     0,     0,   524,   510,   516,   511,   512,
-     513,   515,   517,   514,   273,   274,   275,   276,   277,   536,
-     538,   537,   540,   541,   542,   543,   539,   566,   568,   569,
-     570,   571,   572,   573,   574,   575,   576,   567,   577,   578,
-     579,   580,   581,   582,   583,   584,   589,   594,   612,   613,
-     614,   617,   615,   616,   618,   619,   620,   621,   631,   632,
-     633,   634,   635,   636,   643,   644,   422,   452,   469,   597,
-     598,   476,   477,   463,   464,     0,     0,     0,   468,   637,
-     495,   519,   520,   521,   467,   465,   466
+       0,     0,    20,    22,    23,    86,    89,    98,   200,   201,
+      24,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,    37,    77,    25,    90,    91,    48,    70,    85,    26,
+      27,    30,    31,    28,    29,    32,    33,    34,    35,    36,
+     121,   212,   122,   124,   125,   126,   214,   219,   215,   226,
+     227,   235,   236,   228,   229,   127,   128,   129,   130,   131,
+     132,   133,   196,    87,    76,   102,   119,   120,   224,   221,
+     123,    38,    39,    40,    41,    42,    78,    92,    93,   108,
+      64,    74,    65,   204,   233,   205,   103,    58,    59,   203,
+      60,    61,   232,   112,   116,   137,   147,   174,   150,   237,
+     238,   225,   113,    71,    43,    44,    45,   100,   138,   139,
+     140,   141,    46,    47,    49,    50,    52,    53,    51,   145,
+     151,    54,    55,    56,    62,    81,   117,    95,   146,    88,
+     170,    96,    97,   114,   115,   222,   101,    57,    79,    82,
+      63,    66,   104,   105,    80,   171,   106,    67,    68,    69,
+     213,   118,   188,   189,   190,   191,   192,   193,   194,   202,
+     107,    75,   109,   110,   111,   172,    72,    73,    94,    83,
+      84,   234,    99,   134,   135,   223,   136,   142,   143,   144,
+     175,   176,   178,   180,   181,   179,   182,   197,   148,   149,
+     154,   155,   152,   153,   156,   157,   159,   158,   216,   218,
+     217,   173,   183,   184,   185,   186,   187,   206,   208,   207,
+     209,   210,   211,   230,   231,   177,   195,   198,   199,   220,
+       0,     0,     0,     0,     0,     0,     0,   240,   242,   243,
+     244,   246,   247,   248,   245,     0,     0,     0,     0,     0,
+       0,   250,   252,   253,   254,   255,   256,   257,     0,     0,
+       0,     0,     0,     0,     0,   259,   261,   262,   265,   266,
+     263,   267,   264,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   269,   271,   272,   273,   274,   278,   275,   276,
+     277,   279,     0,     0,     0,     0,     0,   290,   294,   295,
+     296,   297,   286,   288,   289,   291,   292,   293,     0,     0,
+       0,     0,     0,     0,     0,     0,   540,   542,   544,   543,
+     549,   545,   546,   547,   548,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   559,
+     561,   563,   562,   564,   565,   566,   567,   568,   569,   570,
+     571,   572,   573,   574,   575,   576,   577,   578,   579,   580,
+     581,   582,   583,   584,     0,   610,   612,     0,   615,   617,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     624,   626,   627,   628,   630,   631,   629,   632,   633,   634,
+     635,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   647,   649,   650,   651,   652,   653,   654,   655,   656,
+     657,   658,     0,     0,   671,   673,   674,   299,   298,   305,
+     318,   316,   328,   324,   325,   329,   326,   327,   330,   331,
+     332,   333,   334,   366,   367,   368,   369,   370,   399,   400,
+     401,   407,   408,   321,   409,   410,   413,   411,   412,   416,
+     417,   418,   432,   382,   383,   385,   386,   419,   435,   375,
+     377,   436,   442,   443,   444,   322,   398,   461,   462,   376,
+     456,   359,   317,   371,   433,   439,   420,     0,     0,   465,
+     323,   300,   358,   424,   301,   319,   320,   372,   373,   463,
+     422,   426,   427,   302,   467,   402,   431,   360,   381,   437,
+     438,   441,   455,   374,   459,   457,   458,   388,   397,   428,
+     429,   389,   390,   421,   446,   361,   362,   365,   335,   337,
+     338,   339,   340,   341,   350,   351,   352,   353,   354,   355,
+     356,   468,   469,   471,   403,   404,   405,   406,   414,   415,
+     472,   473,   474,     0,     0,     0,   423,   391,   393,   619,
+     483,   487,   485,   484,   488,   486,     0,     0,   491,   492,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     425,   440,   460,   496,   497,   392,   475,     0,     0,     0,
+       0,     0,     0,   447,   448,   449,   450,   451,   452,   453,
+     454,   620,   384,   378,   445,   357,   303,   304,   380,   498,
+     499,   500,   501,   502,   504,   503,   505,   506,   507,   336,
+     343,   493,   495,   494,   342,     0,   364,   430,   470,   363,
+     396,   344,   345,   349,   348,     0,   509,   387,   379,   466,
+     346,   347,   394,   395,   510,   511,   512,   516,   515,   513,
+     514,   517,   518,   519,   520,   522,   521,   532,     0,   536,
+     537,     0,     0,   538,   523,   529,   524,   525,   526,   528,
+     530,   527,   531,   280,   281,   282,   283,   284,   550,   552,
+     551,   554,   555,   556,   557,   553,   585,   587,   588,   589,
+     590,   591,   592,   593,   594,   595,   586,   596,   597,   598,
+     599,   600,   601,   602,   603,   604,   605,   606,   607,   608,
+     613,   618,   636,   637,   638,   641,   639,   640,   642,   643,
+     644,   645,   659,   660,   665,   666,   667,   668,   661,   662,
+     663,   664,   675,   676,   434,   464,   482,   621,   622,   489,
+     490,   476,   477,     0,     0,     0,   481,   669,   508,   533,
+     534,   535,   480,   478,   479
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,   588,   589,   590,   614,
-     615,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,  -296,
-    -296,  -296,  -296,  -296
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,   646,   647,   648,   649,   650,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,
+    -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302,  -302
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    17,    18,    19,    32,   256,    20,    33,   475,
-      21,    34,   489,    22,    35,   503,    23,    36,   519,   533,
-     534,   535,   536,   537,    24,    37,   538,   257,   258,   259,
-     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
-     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
-     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
-     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
-     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
-     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
-     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
-     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
-     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
-     350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
-     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
-     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
-     380,   381,   382,   383,   384,   385,   386,   387,   388,   389,
-     390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
-     400,   401,   402,   403,   404,   405,   406,   407,   408,   409,
-     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
-     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
-     430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
-     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
-     450,   451,   452,   453,   454,   455,   456,   457,   458,   459,
-     460,   461,   462,   476,   477,   478,   479,   480,   481,   482,
-     490,   491,   492,   493,   494,   495,   520,   521,   522,   523,
-     524,   525,   526,   527,   504,   505,   506,   507,   508,   509,
-     510,    25,    38,   552,   553,   554,   555,   556,   557,   558,
-     559,   560,    26,    39,   580,   581,   582,   583,   584,   585,
-     586,   587,   588,   589,   590,   591,   592,   593,   594,   595,
-     596,   597,   598,   599,    27,    40,   601,   602,    28,    41,
-     604,   605,   463,   464,   465,   466,    29,    42,   616,   617,
-     618,   619,   620,   621,   622,   623,   624,   625,   626,    30,
-      43,   633,   634,   635,   636,   637,   638,   639,   467,    31,
-      44,   642,   643,   644
+       0,     1,    17,    18,    19,    32,   262,    20,    33,   487,
+      21,    34,   501,    22,    35,   515,    23,    36,   532,   547,
+     548,   549,   550,   551,    24,    37,   552,   263,   264,   265,
+     266,   267,   268,   269,   270,   271,   272,   273,   274,   275,
+     276,   277,   278,   279,   280,   281,   282,   283,   284,   285,
+     286,   287,   288,   289,   290,   291,   292,   293,   294,   295,
+     296,   297,   298,   299,   300,   301,   302,   303,   304,   305,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
+     346,   347,   348,   349,   350,   351,   352,   353,   354,   355,
+     356,   357,   358,   359,   360,   361,   362,   363,   364,   365,
+     366,   367,   368,   369,   370,   371,   372,   373,   374,   375,
+     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
+     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
+     396,   397,   398,   399,   400,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,   435,
+     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   463,   464,   465,
+     466,   467,   468,   469,   470,   471,   472,   473,   474,   488,
+     489,   490,   491,   492,   493,   494,   502,   503,   504,   505,
+     506,   507,   533,   534,   535,   536,   537,   538,   539,   540,
+     541,   516,   517,   518,   519,   520,   521,   522,    25,    38,
+     566,   567,   568,   569,   570,   571,   572,   573,   574,    26,
+      39,   599,   600,   601,   602,   603,   604,   605,   606,   607,
+     608,   609,   610,   611,   612,   613,   614,   615,   616,   617,
+     618,   619,   620,   621,   622,   623,    27,    40,   625,   626,
+      28,    41,   628,   629,   475,   476,   477,   478,    29,    42,
+     640,   641,   642,   643,   644,   645,   646,   647,   648,   649,
+     650,    30,    43,   661,   662,   663,   664,   665,   666,   667,
+     668,   669,   670,   671,   479,    31,    44,   674,   675,   676
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-       2,   511,   496,   468,   600,   469,   470,   483,   640,   641,
-     603,     3,     4,   645,   646,   484,   485,   627,   628,   629,
-     630,   631,   632,   647,   511,   606,   607,   608,   609,   610,
-     611,   612,   613,   614,   615,   648,   649,   650,   497,   498,
-     651,   652,   653,   654,   655,   656,     5,   657,   658,   659,
-     660,   661,     6,   662,   663,   664,   665,   666,   667,   668,
-     669,   670,   671,   499,   672,   673,   471,   561,   562,   563,
-     564,   565,   566,   567,   568,   569,   570,   571,   572,   573,
-     574,   575,   576,   577,   578,   579,   544,   545,   546,   547,
-     548,   549,   550,   551,   674,   675,     7,   472,   676,   677,
-     486,   678,   487,   679,   680,   681,   682,   473,   683,   684,
-     685,   686,     8,   687,   688,   689,   690,   691,   692,   693,
-     694,   695,   696,   697,   698,   699,   700,   701,   702,   703,
-     704,   705,   706,   707,   708,   709,   710,   711,   712,   713,
-     500,   501,   714,   715,   716,   717,   718,   719,   720,   721,
-     722,   723,   724,   725,   726,   727,   728,   729,   730,   731,
-     732,   733,     9,   734,   735,   736,   737,   738,   739,   740,
-     741,   742,   743,   744,   745,   746,   747,   748,   749,   750,
-     502,   751,   752,   753,   754,   755,   756,   757,   758,   759,
-     760,   761,   762,   763,   764,   765,   766,   767,   768,   769,
-     770,   771,   772,   773,   774,   775,   776,   777,   778,   779,
-     780,   781,   782,   783,   784,   785,   786,   787,   788,   789,
-     790,    10,   791,   792,   793,   794,   795,   513,   514,   515,
-     796,   797,   798,   799,   800,   801,   802,   518,   803,   804,
-      11,   805,   806,   474,   807,   808,   488,   809,   512,   810,
-     513,   514,   515,   516,   517,   528,   529,   530,   531,   532,
-     518,    12,   811,   812,   813,   814,   815,   816,   817,   818,
-      13,   819,   820,   821,   822,   823,   824,   825,   826,   827,
-     828,   829,   830,   831,   832,   833,   834,   835,   836,   837,
-     838,   839,   840,   841,    14,   842,   843,   844,    15,   845,
-     846,   847,     0,   848,    16,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,   849,   850,   851,
-     852,    77,    78,    79,   853,   854,   855,    80,    81,    82,
-      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
-      93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   856,   857,
-     858,   859,   860,   861,   862,   863,   864,   121,   122,   123,
-     865,   124,   125,   126,   866,   867,   127,   128,   129,   130,
-     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
-     868,   869,   870,   151,   152,   153,   154,   155,   156,   157,
-     158,   871,   159,   160,   161,   162,   163,   164,   165,   166,
-     167,   168,   169,   170,   872,   873,   874,   875,   876,   877,
-     878,   879,   880,   881,   882,   883,   884,   885,   886,   887,
-     888,   889,   890,   891,   171,   172,   173,   174,   175,   176,
-     177,   178,   179,   180,   181,   182,   183,   184,   185,   186,
-     187,   188,   189,   190,   191,   192,   193,   194,   195,   196,
-     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
-     207,   208,   209,   892,   210,   893,   211,   212,   213,   214,
-     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
-     225,   226,   894,   895,   896,   897,   898,   899,   900,   901,
-     902,   903,   904,   227,   228,   229,   230,   231,   232,   233,
-     234,   235,   236,   905,   906,   907,   908,   909,   910,   911,
-     237,   912,   913,   914,   915,   916,   917,   918,   238,   239,
-     919,   240,   241,   920,   242,   243,   921,   922,   244,   245,
-     246,   247,   248,   249,   250,   251,   923,   924,   925,   252,
-     926,   927,   928,   929,   930,   931,   932,   933,   253,   254,
-     255,   934,   935,   936,   937,   938,   939,   940,   941,   942,
-     943,   944,   945,   946,   947,   948,   949,   950,   951,   952,
-     953,   954,   955,   956,     0,   539,   540,   541,     0,     0,
+       2,   523,   508,   672,   673,   480,   523,   481,   482,   495,
+     624,     3,     4,   677,   627,   678,   679,   496,   497,   630,
+     631,   632,   633,   634,   635,   636,   637,   638,   639,   558,
+     559,   560,   561,   562,   563,   564,   565,   680,   509,   510,
+     681,   682,   683,   684,   685,   686,     5,   687,   688,   689,
+     690,   691,     6,   651,   652,   653,   654,   655,   656,   657,
+     658,   659,   660,   511,   692,   693,   694,   695,   483,   575,
+     576,   577,   578,   579,   580,   581,   582,   583,   584,   585,
+     586,   587,   588,   589,   590,   591,   592,   593,   594,   595,
+     596,   597,   598,   696,   697,   698,     7,   699,   700,   484,
+     701,   702,   498,   703,   499,   704,   705,   706,   707,   485,
+     708,   709,     8,   710,   711,   712,   713,   714,   715,   716,
+     717,   718,   719,   720,   721,   722,   723,   724,   725,   726,
+     727,   728,   729,   730,   731,   732,   733,   734,   735,   736,
+     737,   738,   739,   740,   741,   512,   513,   742,   743,   744,
+     745,   746,   747,   748,   749,   750,   751,   752,   753,   754,
+     755,   756,     9,   757,   758,   759,   760,   761,   762,   763,
+     764,   765,   766,   767,   768,   769,   770,   771,   772,   773,
+     774,   775,   776,   777,   778,   514,   779,   780,   781,   782,
+     783,   784,   785,   786,   787,   788,   789,   790,   791,   792,
+     793,   794,   795,   796,   797,   798,   799,   800,   801,   802,
+     803,   804,   805,   806,   807,   808,   809,   810,   811,   812,
+     813,   814,   815,   816,   817,   818,    10,   819,   820,   821,
+     822,   823,   824,   825,   524,   826,   525,   526,   527,   528,
+     529,   525,   526,   527,   827,    11,   530,   828,   829,   830,
+     831,   530,   832,   833,   486,   834,   835,   500,   836,   837,
+     838,   839,   840,   841,   842,   843,    12,   844,   845,   542,
+     543,   544,   545,   546,   846,   847,   848,   849,   850,    13,
+     531,   851,   852,   853,   854,   855,   856,   857,   858,   859,
+     860,   861,   862,   863,   864,   865,   866,   867,   868,   869,
+     870,   871,   872,    14,   873,   874,   875,    15,   876,   877,
+     878,     0,   879,    16,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,   880,   881,   882,   883,
+      77,    78,    79,   884,   885,   886,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   887,   888,   889,
+     890,   891,   892,   893,   894,   895,   121,   122,   123,   896,
+     124,   125,   126,   897,   898,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   899,
+     900,   901,   151,   152,   153,   154,   155,   156,   157,   158,
+     902,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   903,   904,   905,   906,   907,   908,   909,
+     910,   911,   912,   913,   914,   915,   916,   917,   918,   919,
+     920,   921,   922,   923,   924,   925,   926,   927,   171,   172,
+     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,   209,   928,   210,   929,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,   223,   224,   225,   226,   930,   931,   932,   933,
+     934,   935,   936,   937,   938,   939,   940,   227,   228,   229,
+     230,   231,   232,   233,   234,   235,   236,   941,   942,   943,
+     944,   945,   946,   947,   948,   949,   950,   951,   237,   952,
+     953,   954,   955,   956,   957,   958,   238,   239,   959,   240,
+     241,   960,   242,   243,   961,   962,   244,   245,   246,   247,
+     248,   249,   250,   251,   963,   964,   965,   252,   966,   967,
+     968,   969,   970,   971,   972,   973,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   974,   975,   976,   977,   978,
+     979,   980,   981,   982,   983,   984,   985,   986,   987,   988,
+     989,   990,   991,   992,   993,   994,   995,   996,   997,   998,
+     999,  1000,  1001,  1002,  1003,  1004,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   542,   543
+       0,     0,     0,   553,   554,   555,   556,   557
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,    45,    45,    45,   113,    47,    48,    45,   295,   296,
-     305,    11,    12,    10,    10,    53,    54,   262,   263,   264,
-     265,   266,   267,    10,    45,   241,   242,   243,   244,   245,
-     246,   247,   248,   249,   250,    10,    10,    10,    81,    82,
+       0,    45,    45,   304,   305,    45,    45,    47,    48,    45,
+     113,    11,    12,    10,   314,    10,    10,    53,    54,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,   255,    97,
+      98,    99,   100,   101,   102,   103,   104,    10,    81,    82,
       10,    10,    10,    10,    10,    10,    46,    10,    10,    10,
-      10,    10,    52,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,   106,    10,    10,   108,   163,   164,   165,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     176,   177,   178,   179,   180,   181,    97,    98,    99,   100,
-     101,   102,   103,   104,    10,    10,    96,   139,    10,    10,
-     138,    10,   140,    10,    10,    10,    10,   149,    10,    10,
+      10,    10,    52,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   106,    10,    10,    10,    10,   108,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
+     184,   185,   186,    10,    10,    10,    96,    10,    10,   139,
+      10,    10,   138,    10,   140,    10,    10,    10,    10,   149,
       10,    10,   112,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-     183,   184,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,   188,   189,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,   162,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-     223,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,   228,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,   221,    10,    10,    10,    10,    10,   271,   272,   273,
-      10,    10,    10,    10,    10,    10,    10,   281,    10,    10,
-     240,    10,    10,   285,    10,    10,   284,    10,   269,    10,
-     271,   272,   273,   274,   275,   299,   300,   301,   302,   303,
-     281,   261,    10,    10,    10,    10,    10,    10,    10,    10,
-     270,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,   226,    10,    10,    10,
+      10,    10,    10,    10,   278,    10,   280,   281,   282,   283,
+     284,   280,   281,   282,    10,   245,   290,    10,    10,    10,
+      10,   290,    10,    10,   294,    10,    10,   293,    10,    10,
+      10,    10,    10,    10,    10,    10,   266,    10,    10,   308,
+     309,   310,   311,   312,    10,    10,    10,    10,    10,   279,
+     324,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   294,    10,    10,    10,   298,    10,
-      10,    10,    -1,    10,   304,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    10,    10,    10,
-      10,    49,    50,    51,    10,    10,    10,    55,    56,    57,
-      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
-      78,    79,    80,    81,    82,    83,    84,    85,    86,    87,
-      88,    89,    90,    91,    92,    93,    94,    95,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,   105,   106,   107,
-      10,   109,   110,   111,    10,    10,   114,   115,   116,   117,
-     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
-      10,    10,    10,   141,   142,   143,   144,   145,   146,   147,
-     148,    10,   150,   151,   152,   153,   154,   155,   156,   157,
-     158,   159,   160,   161,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,   303,    10,    10,    10,   307,    10,    10,
+      10,    -1,    10,   313,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,    44,    10,    10,    10,    10,
+      49,    50,    51,    10,    10,    10,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    81,    82,    83,    84,    85,    86,    87,    88,
+      89,    90,    91,    92,    93,    94,    95,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,   105,   106,   107,    10,
+     109,   110,   111,    10,    10,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,    10,
+      10,    10,   141,   142,   143,   144,   145,   146,   147,   148,
+      10,   150,   151,   152,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   182,   183,   184,   185,   186,   187,
-     188,   189,   190,   191,   192,   193,   194,   195,   196,   197,
-     198,   199,   200,   201,   202,   203,   204,   205,   206,   207,
-     208,   209,   210,   211,   212,   213,   214,   215,   216,   217,
-     218,   219,   220,    10,   222,    10,   224,   225,   226,   227,
-     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
-     238,   239,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,   251,   252,   253,   254,   255,   256,   257,
-     258,   259,   260,    10,    10,    10,    10,    10,    10,    10,
-     268,    10,    10,    10,    10,    10,    10,    10,   276,   277,
-      10,   279,   280,    10,   282,   283,    10,    10,   286,   287,
-     288,   289,   290,   291,   292,   293,    10,    10,    10,   297,
-      10,    10,    10,    10,    10,    10,    10,    10,   306,   307,
-     308,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,   223,   224,   225,    10,   227,    10,
+     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,   243,   244,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,   256,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,   277,    10,
+      10,    10,    10,    10,    10,    10,   285,   286,    10,   288,
+     289,    10,   291,   292,    10,    10,   295,   296,   297,   298,
+     299,   300,   301,   302,    10,    10,    10,   306,    10,    10,
+      10,    10,    10,    10,    10,    10,   315,   316,   317,   318,
+     319,   320,   321,   322,   323,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    -1,    37,    37,    37,    -1,    -1,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    37,    37
+      -1,    -1,    -1,    37,    37,    37,    37,    37
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_int16 yystos[] =
 {
-       0,   310,     0,    11,    12,    46,    52,    96,   112,   162,
-     221,   240,   261,   270,   294,   298,   304,   311,   312,   313,
-     316,   319,   322,   325,   333,   570,   581,   603,   607,   615,
-     628,   638,   314,   317,   320,   323,   326,   334,   571,   582,
-     604,   608,   616,   629,   639,    13,    14,    15,    16,    17,
+       0,   326,     0,    11,    12,    46,    52,    96,   112,   162,
+     226,   245,   266,   279,   303,   307,   313,   327,   328,   329,
+     332,   335,   338,   341,   349,   593,   604,   631,   635,   643,
+     656,   670,   330,   333,   336,   339,   342,   350,   594,   605,
+     632,   636,   644,   657,   671,    13,    14,    15,    16,    17,
       18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
       38,    39,    40,    41,    42,    43,    44,    49,    50,    51,
@@ -2660,17 +2047,16 @@ static const yytype_int16 yystos[] =
      127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
      137,   141,   142,   143,   144,   145,   146,   147,   148,   150,
      151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
-     161,   182,   183,   184,   185,   186,   187,   188,   189,   190,
-     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
-     222,   224,   225,   226,   227,   228,   229,   230,   231,   232,
-     233,   234,   235,   236,   237,   238,   239,   251,   252,   253,
-     254,   255,   256,   257,   258,   259,   260,   268,   276,   277,
-     279,   280,   282,   283,   286,   287,   288,   289,   290,   291,
-     292,   293,   297,   306,   307,   308,   315,   336,   337,   338,
-     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
-     349,   350,   351,   352,   353,   354,   355,   356,   357,   358,
+     161,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
+     227,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   256,   257,   258,
+     259,   260,   261,   262,   263,   264,   265,   277,   285,   286,
+     288,   289,   291,   292,   295,   296,   297,   298,   299,   300,
+     301,   302,   306,   315,   316,   317,   318,   319,   320,   321,
+     322,   323,   331,   352,   353,   354,   355,   356,   357,   358,
      359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
      369,   370,   371,   372,   373,   374,   375,   376,   377,   378,
      379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
@@ -2689,25 +2075,29 @@ static const yytype_int16 yystos[] =
      509,   510,   511,   512,   513,   514,   515,   516,   517,   518,
      519,   520,   521,   522,   523,   524,   525,   526,   527,   528,
      529,   530,   531,   532,   533,   534,   535,   536,   537,   538,
-     539,   540,   541,   611,   612,   613,   614,   637,    45,    47,
-      48,   108,   139,   149,   285,   318,   542,   543,   544,   545,
-     546,   547,   548,    45,    53,    54,   138,   140,   284,   321,
-     549,   550,   551,   552,   553,   554,    45,    81,    82,   106,
-     183,   184,   223,   324,   563,   564,   565,   566,   567,   568,
-     569,    45,   269,   271,   272,   273,   274,   275,   281,   327,
-     555,   556,   557,   558,   559,   560,   561,   562,   299,   300,
-     301,   302,   303,   328,   329,   330,   331,   332,   335,   555,
-     556,   557,   558,   559,    97,    98,    99,   100,   101,   102,
-     103,   104,   572,   573,   574,   575,   576,   577,   578,   579,
-     580,   163,   164,   165,   166,   167,   168,   169,   170,   171,
-     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
-     583,   584,   585,   586,   587,   588,   589,   590,   591,   592,
-     593,   594,   595,   596,   597,   598,   599,   600,   601,   602,
-     113,   605,   606,   305,   609,   610,   241,   242,   243,   244,
-     245,   246,   247,   248,   249,   250,   617,   618,   619,   620,
-     621,   622,   623,   624,   625,   626,   627,   262,   263,   264,
-     265,   266,   267,   630,   631,   632,   633,   634,   635,   636,
-     295,   296,   640,   641,   642,    10,    10,    10,    10,    10,
+     539,   540,   541,   542,   543,   544,   545,   546,   547,   548,
+     549,   550,   551,   552,   553,   554,   555,   556,   557,   558,
+     559,   560,   561,   562,   563,   639,   640,   641,   642,   669,
+      45,    47,    48,   108,   139,   149,   294,   334,   564,   565,
+     566,   567,   568,   569,   570,    45,    53,    54,   138,   140,
+     293,   337,   571,   572,   573,   574,   575,   576,    45,    81,
+      82,   106,   188,   189,   228,   340,   586,   587,   588,   589,
+     590,   591,   592,    45,   278,   280,   281,   282,   283,   284,
+     290,   324,   343,   577,   578,   579,   580,   581,   582,   583,
+     584,   585,   308,   309,   310,   311,   312,   344,   345,   346,
+     347,   348,   351,   577,   578,   579,   580,   581,    97,    98,
+      99,   100,   101,   102,   103,   104,   595,   596,   597,   598,
+     599,   600,   601,   602,   603,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,   183,   184,   185,   186,   606,
+     607,   608,   609,   610,   611,   612,   613,   614,   615,   616,
+     617,   618,   619,   620,   621,   622,   623,   624,   625,   626,
+     627,   628,   629,   630,   113,   633,   634,   314,   637,   638,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,   255,
+     645,   646,   647,   648,   649,   650,   651,   652,   653,   654,
+     655,   267,   268,   269,   270,   271,   272,   273,   274,   275,
+     276,   658,   659,   660,   661,   662,   663,   664,   665,   666,
+     667,   668,   304,   305,   672,   673,   674,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -2738,80 +2128,85 @@ static const yytype_int16 yystos[] =
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   309,   310,   310,   311,   311,   311,   311,   311,   311,
-     311,   311,   311,   311,   311,   311,   311,   311,   312,   313,
-     314,   314,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   316,   317,   317,   318,   318,   318,   318,
-     318,   318,   318,   319,   320,   320,   321,   321,   321,   321,
-     321,   321,   322,   323,   323,   324,   324,   324,   324,   324,
-     324,   324,   325,   326,   326,   327,   327,   327,   327,   327,
-     327,   327,   327,   328,   329,   330,   331,   332,   333,   334,
-     334,   335,   335,   335,   335,   335,   335,   335,   335,   335,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   516,   517,   518,   519,   520,   521,   522,   523,   524,
-     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
-     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
-     545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
-     555,   556,   557,   558,   559,   560,   561,   562,   563,   564,
-     565,   566,   567,   568,   569,   570,   571,   571,   572,   572,
-     572,   572,   572,   572,   572,   572,   573,   574,   575,   576,
-     577,   578,   579,   580,   581,   582,   582,   583,   583,   583,
-     583,   583,   583,   583,   583,   583,   583,   583,   583,   583,
-     583,   583,   583,   583,   583,   583,   584,   585,   586,   587,
-     588,   589,   590,   591,   592,   593,   594,   595,   596,   597,
-     598,   599,   600,   601,   602,   603,   604,   604,   605,   606,
-     607,   608,   608,   609,   610,   611,   612,   613,   614,   615,
-     616,   616,   617,   617,   617,   617,   617,   617,   617,   617,
-     617,   617,   618,   619,   620,   621,   622,   623,   624,   625,
-     626,   627,   628,   629,   629,   630,   630,   630,   630,   630,
-     630,   631,   632,   633,   634,   635,   636,   637,   638,   639,
-     639,   640,   640,   641,   642
+       0,   325,   326,   326,   327,   327,   327,   327,   327,   327,
+     327,   327,   327,   327,   327,   327,   327,   327,   328,   329,
+     330,   330,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   331,
+     331,   331,   331,   331,   331,   331,   331,   331,   331,   332,
+     333,   333,   334,   334,   334,   334,   334,   334,   334,   335,
+     336,   336,   337,   337,   337,   337,   337,   337,   338,   339,
+     339,   340,   340,   340,   340,   340,   340,   340,   341,   342,
+     342,   343,   343,   343,   343,   343,   343,   343,   343,   343,
+     344,   345,   346,   347,   348,   349,   350,   350,   351,   351,
+     351,   351,   351,   351,   351,   351,   351,   351,   352,   353,
+     354,   355,   356,   357,   358,   359,   360,   361,   362,   363,
+     364,   365,   366,   367,   368,   369,   370,   371,   372,   373,
+     374,   375,   376,   377,   378,   379,   380,   381,   382,   383,
+     384,   385,   386,   387,   388,   389,   390,   391,   392,   393,
+     394,   395,   396,   397,   398,   399,   400,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   459,   460,   461,   462,   463,
+     464,   465,   466,   467,   468,   469,   470,   471,   472,   473,
+     474,   475,   476,   477,   478,   479,   480,   481,   482,   483,
+     484,   485,   486,   487,   488,   489,   490,   491,   492,   493,
+     494,   495,   496,   497,   498,   499,   500,   501,   502,   503,
+     504,   505,   506,   507,   508,   509,   510,   511,   512,   513,
+     514,   515,   516,   517,   518,   519,   520,   521,   522,   523,
+     524,   525,   526,   527,   528,   529,   530,   531,   532,   533,
+     534,   535,   536,   537,   538,   539,   540,   541,   542,   543,
+     544,   545,   546,   547,   548,   549,   550,   551,   552,   553,
+     554,   555,   556,   557,   558,   559,   560,   561,   562,   563,
+     564,   565,   566,   567,   568,   569,   570,   571,   572,   573,
+     574,   575,   576,   577,   578,   579,   580,   581,   582,   583,
+     584,   585,   586,   587,   588,   589,   590,   591,   592,   593,
+     594,   594,   595,   595,   595,   595,   595,   595,   595,   595,
+     596,   597,   598,   599,   600,   601,   602,   603,   604,   605,
+     605,   606,   606,   606,   606,   606,   606,   606,   606,   606,
+     606,   606,   606,   606,   606,   606,   606,   606,   606,   606,
+     606,   606,   606,   606,   606,   607,   608,   609,   610,   611,
+     612,   613,   614,   615,   616,   617,   618,   619,   620,   621,
+     622,   623,   624,   625,   626,   627,   628,   629,   630,   631,
+     632,   632,   633,   634,   635,   636,   636,   637,   638,   639,
+     640,   641,   642,   643,   644,   644,   645,   645,   645,   645,
+     645,   645,   645,   645,   645,   645,   646,   647,   648,   649,
+     650,   651,   652,   653,   654,   655,   656,   657,   657,   658,
+     658,   658,   658,   658,   658,   658,   658,   658,   658,   659,
+     660,   661,   662,   663,   664,   665,   666,   667,   668,   669,
+     670,   671,   671,   672,   672,   673,   674
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
@@ -2837,13 +2232,13 @@ static const yytype_int8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     2,     0,     1,     1,     1,     1,
-       1,     1,     1,     1,     2,     0,     1,     1,     1,     1,
-       1,     1,     1,     2,     0,     1,     1,     1,     1,     1,
-       1,     1,     1,     2,     0,     1,     1,     1,     1,     1,
-       1,     1,     1,     2,     2,     2,     2,     2,     1,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     0,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     0,     1,     1,     1,     1,     1,     1,     1,     2,
+       0,     1,     1,     1,     1,     1,     1,     1,     1,     2,
        0,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     1,     2,     0,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -2856,29 +2251,32 @@ static const yytype_int8 yyr2[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     3,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     3,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     3,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     3,     3,     4,     4,     4,     3,     3,
-       2,     2,     2,     2,     2,     2,     3,     3,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     3,     2,     2,     2,     2,
+       2,     2,     2,     2,     3,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     3,     3,     4,     4,
+       4,     3,     3,     2,     2,     2,     2,     2,     2,     3,
+       3,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     3,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
-       3,     3,     2,     2,     2,     1,     2,     0,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
-       2,     2,     2,     2,     1,     2,     0,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     1,     2,     0,     1,     2,
-       1,     2,     0,     1,     2,     2,     2,     3,     3,     1,
+       2,     2,     2,     3,     3,     3,     2,     2,     2,     1,
        2,     0,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     1,     2,     0,     1,     1,     1,     1,     1,
-       1,     2,     2,     2,     2,     2,     2,     3,     1,     2,
-       0,     1,     1,     2,     2
+       2,     2,     2,     2,     2,     2,     2,     2,     1,     2,
+       0,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     1,
+       2,     0,     1,     2,     1,     2,     0,     1,     2,     2,
+       2,     3,     3,     1,     2,     0,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     0,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
+       1,     2,     0,     1,     1,     2,     2
 };
 
 
@@ -2890,6 +2288,7 @@ enum { YYENOMEM = -2 };
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
@@ -2930,10 +2329,7 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-# ifndef YY_LOCATION_PRINT
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
+
 
 
 # define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
@@ -2957,15 +2353,11 @@ yy_symbol_value_print (FILE *yyo,
                        yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
   FILE *yyoutput = yyo;
-  YYUSE (yyoutput);
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yykind < YYNTOKENS)
-    YYPRINT (yyo, yytoknum[yykind], *yyvaluep);
-# endif
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yykind);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
@@ -3079,18 +2471,18 @@ static void
 yydestruct (const char *yymsg,
             yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
   YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yykind);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -3108,34 +2500,30 @@ int yynerrs;
 int
 yyparse (void)
 {
-    yy_state_fast_t yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
     /* Their size.  */
-    YYPTRDIFF_T yystacksize;
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The state stack.  */
+    /* The state stack: array, bottom, top.  */
     yy_state_t yyssa[YYINITDEPTH];
-    yy_state_t *yyss;
-    yy_state_t *yyssp;
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    /* The semantic value stack.  */
+    /* The semantic value stack: array, bottom, top.  */
     YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
   /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
+  /* Lookahead symbol kind.  */
   yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
@@ -3149,18 +2537,10 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yynerrs = 0;
-  yystate = 0;
-  yyerrstatus = 0;
-
-  yystacksize = YYINITDEPTH;
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
 
@@ -3186,7 +2566,7 @@ yysetstate:
 
   if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-    goto yyexhaustedlab;
+    YYNOMEM;
 #else
     {
       /* Get the current used size of the three stacks, in elements.  */
@@ -3214,7 +2594,7 @@ yysetstate:
 # else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
@@ -3225,7 +2605,7 @@ yysetstate:
           YY_CAST (union yyalloc *,
                    YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -3247,6 +2627,7 @@ yysetstate:
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
+
   if (yystate == YYFINAL)
     YYACCEPT;
 
@@ -3358,24 +2739,24 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-  case 18:
-#line 197 "./util/configparser.y"
+  case 18: /* force_toplevel: VAR_FORCE_TOPLEVEL  */
+#line 208 "./util/configparser.y"
         {
 		OUTYY(("\nP(force-toplevel)\n"));
 	}
-#line 3367 "util/configparser.c"
+#line 2748 "util/configparser.c"
     break;
 
-  case 19:
-#line 203 "./util/configparser.y"
+  case 19: /* serverstart: VAR_SERVER  */
+#line 214 "./util/configparser.y"
         { 
 		OUTYY(("\nP(server:)\n"));
 	}
-#line 3375 "util/configparser.c"
+#line 2756 "util/configparser.c"
     break;
 
-  case 233:
-#line 305 "./util/configparser.y"
+  case 239: /* stubstart: VAR_STUB_ZONE  */
+#line 322 "./util/configparser.y"
         {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
@@ -3386,11 +2767,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3390 "util/configparser.c"
+#line 2771 "util/configparser.c"
     break;
 
-  case 243:
-#line 322 "./util/configparser.y"
+  case 249: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 339 "./util/configparser.y"
         {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
@@ -3401,11 +2782,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3405 "util/configparser.c"
+#line 2786 "util/configparser.c"
     break;
 
-  case 252:
-#line 339 "./util/configparser.y"
+  case 258: /* viewstart: VAR_VIEW  */
+#line 356 "./util/configparser.y"
         {
 		struct config_view* s;
 		OUTYY(("\nP(view:)\n")); 
@@ -3418,11 +2799,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3422 "util/configparser.c"
+#line 2803 "util/configparser.c"
     break;
 
-  case 262:
-#line 358 "./util/configparser.y"
+  case 268: /* authstart: VAR_AUTH_ZONE  */
+#line 375 "./util/configparser.y"
         {
 		struct config_auth* s;
 		OUTYY(("\nP(auth_zone:)\n")); 
@@ -3438,11 +2819,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3442 "util/configparser.c"
+#line 2823 "util/configparser.c"
     break;
 
-  case 273:
-#line 382 "./util/configparser.y"
+  case 280: /* rpz_tag: VAR_TAGS STRING_ARG  */
+#line 399 "./util/configparser.y"
         {
 		uint8_t* bitlist;
 		size_t len = 0;
@@ -3459,11 +2840,11 @@ yyreduce:
 
 		}
 	}
-#line 3463 "util/configparser.c"
+#line 2844 "util/configparser.c"
     break;
 
-  case 274:
-#line 401 "./util/configparser.y"
+  case 281: /* rpz_action_override: VAR_RPZ_ACTION_OVERRIDE STRING_ARG  */
+#line 418 "./util/configparser.y"
         {
 		OUTYY(("P(rpz_action_override:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "nxdomain")!=0 && strcmp((yyvsp[0].str), "nodata")!=0 &&
@@ -3478,21 +2859,21 @@ yyreduce:
 			cfg_parser->cfg->auths->rpz_action_override = (yyvsp[0].str);
 		}
 	}
-#line 3482 "util/configparser.c"
+#line 2863 "util/configparser.c"
     break;
 
-  case 275:
-#line 418 "./util/configparser.y"
+  case 282: /* rpz_cname_override: VAR_RPZ_CNAME_OVERRIDE STRING_ARG  */
+#line 435 "./util/configparser.y"
         {
 		OUTYY(("P(rpz_cname_override:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->rpz_cname);
 		cfg_parser->cfg->auths->rpz_cname = (yyvsp[0].str);
 	}
-#line 3492 "util/configparser.c"
+#line 2873 "util/configparser.c"
     break;
 
-  case 276:
-#line 426 "./util/configparser.y"
+  case 283: /* rpz_log: VAR_RPZ_LOG STRING_ARG  */
+#line 443 "./util/configparser.y"
         {
 		OUTYY(("P(rpz_log:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3500,21 +2881,21 @@ yyreduce:
 		else cfg_parser->cfg->auths->rpz_log = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3504 "util/configparser.c"
+#line 2885 "util/configparser.c"
     break;
 
-  case 277:
-#line 436 "./util/configparser.y"
+  case 284: /* rpz_log_name: VAR_RPZ_LOG_NAME STRING_ARG  */
+#line 453 "./util/configparser.y"
         {
 		OUTYY(("P(rpz_log_name:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->rpz_log_name);
 		cfg_parser->cfg->auths->rpz_log_name = (yyvsp[0].str);
 	}
-#line 3514 "util/configparser.c"
+#line 2895 "util/configparser.c"
     break;
 
-  case 278:
-#line 444 "./util/configparser.y"
+  case 285: /* rpzstart: VAR_RPZ  */
+#line 461 "./util/configparser.y"
         {
 		struct config_auth* s;
 		OUTYY(("\nP(rpz:)\n")); 
@@ -3530,11 +2911,11 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 3534 "util/configparser.c"
+#line 2915 "util/configparser.c"
     break;
 
-  case 291:
-#line 467 "./util/configparser.y"
+  case 298: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 484 "./util/configparser.y"
         { 
 		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3542,11 +2923,11 @@ yyreduce:
 		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3546 "util/configparser.c"
+#line 2927 "util/configparser.c"
     break;
 
-  case 292:
-#line 476 "./util/configparser.y"
+  case 299: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 493 "./util/configparser.y"
         { 
 		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3554,11 +2935,11 @@ yyreduce:
 		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3558 "util/configparser.c"
+#line 2939 "util/configparser.c"
     break;
 
-  case 293:
-#line 485 "./util/configparser.y"
+  case 300: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 502 "./util/configparser.y"
         { 
 		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
@@ -3568,11 +2949,11 @@ yyreduce:
 		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3572 "util/configparser.c"
+#line 2953 "util/configparser.c"
     break;
 
-  case 294:
-#line 496 "./util/configparser.y"
+  case 301: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 513 "./util/configparser.y"
         {
 		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3580,11 +2961,11 @@ yyreduce:
 		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3584 "util/configparser.c"
+#line 2965 "util/configparser.c"
     break;
 
-  case 295:
-#line 505 "./util/configparser.y"
+  case 302: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 522 "./util/configparser.y"
         {
 		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3592,11 +2973,11 @@ yyreduce:
 		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3596 "util/configparser.c"
+#line 2977 "util/configparser.c"
     break;
 
-  case 296:
-#line 514 "./util/configparser.y"
+  case 303: /* server_shm_enable: VAR_SHM_ENABLE STRING_ARG  */
+#line 531 "./util/configparser.y"
         {
 		OUTYY(("P(server_shm_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3604,11 +2985,11 @@ yyreduce:
 		else cfg_parser->cfg->shm_enable = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3608 "util/configparser.c"
+#line 2989 "util/configparser.c"
     break;
 
-  case 297:
-#line 523 "./util/configparser.y"
+  case 304: /* server_shm_key: VAR_SHM_KEY STRING_ARG  */
+#line 540 "./util/configparser.y"
         { 
 		OUTYY(("P(server_shm_key:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
@@ -3618,11 +2999,11 @@ yyreduce:
 		else cfg_parser->cfg->shm_key = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3622 "util/configparser.c"
+#line 3003 "util/configparser.c"
     break;
 
-  case 298:
-#line 534 "./util/configparser.y"
+  case 305: /* server_port: VAR_PORT STRING_ARG  */
+#line 551 "./util/configparser.y"
         {
 		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -3630,11 +3011,11 @@ yyreduce:
 		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3634 "util/configparser.c"
+#line 3015 "util/configparser.c"
     break;
 
-  case 299:
-#line 543 "./util/configparser.y"
+  case 306: /* server_send_client_subnet: VAR_SEND_CLIENT_SUBNET STRING_ARG  */
+#line 560 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_send_client_subnet:%s)\n", (yyvsp[0].str)));
@@ -3645,11 +3026,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 3649 "util/configparser.c"
+#line 3030 "util/configparser.c"
     break;
 
-  case 300:
-#line 555 "./util/configparser.y"
+  case 307: /* server_client_subnet_zone: VAR_CLIENT_SUBNET_ZONE STRING_ARG  */
+#line 572 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_zone:%s)\n", (yyvsp[0].str)));
@@ -3661,11 +3042,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 3665 "util/configparser.c"
+#line 3046 "util/configparser.c"
     break;
 
-  case 301:
-#line 569 "./util/configparser.y"
+  case 308: /* server_client_subnet_always_forward: VAR_CLIENT_SUBNET_ALWAYS_FORWARD STRING_ARG  */
+#line 586 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_always_forward:%s)\n", (yyvsp[0].str)));
@@ -3679,11 +3060,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3683 "util/configparser.c"
+#line 3064 "util/configparser.c"
     break;
 
-  case 302:
-#line 584 "./util/configparser.y"
+  case 309: /* server_client_subnet_opcode: VAR_CLIENT_SUBNET_OPCODE STRING_ARG  */
+#line 601 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(client_subnet_opcode:%s)\n", (yyvsp[0].str)));
@@ -3693,11 +3074,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3697 "util/configparser.c"
+#line 3078 "util/configparser.c"
     break;
 
-  case 303:
-#line 595 "./util/configparser.y"
+  case 310: /* server_max_client_subnet_ipv4: VAR_MAX_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 612 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
@@ -3713,11 +3094,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3717 "util/configparser.c"
+#line 3098 "util/configparser.c"
     break;
 
-  case 304:
-#line 612 "./util/configparser.y"
+  case 311: /* server_max_client_subnet_ipv6: VAR_MAX_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 629 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
@@ -3733,11 +3114,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3737 "util/configparser.c"
+#line 3118 "util/configparser.c"
     break;
 
-  case 305:
-#line 629 "./util/configparser.y"
+  case 312: /* server_min_client_subnet_ipv4: VAR_MIN_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 646 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(min_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
@@ -3753,11 +3134,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3757 "util/configparser.c"
+#line 3138 "util/configparser.c"
     break;
 
-  case 306:
-#line 646 "./util/configparser.y"
+  case 313: /* server_min_client_subnet_ipv6: VAR_MIN_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 663 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(min_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
@@ -3773,11 +3154,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3777 "util/configparser.c"
+#line 3158 "util/configparser.c"
     break;
 
-  case 307:
-#line 663 "./util/configparser.y"
+  case 314: /* server_max_ecs_tree_size_ipv4: VAR_MAX_ECS_TREE_SIZE_IPV4 STRING_ARG  */
+#line 680 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_ecs_tree_size_ipv4:%s)\n", (yyvsp[0].str)));
@@ -3791,11 +3172,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3795 "util/configparser.c"
+#line 3176 "util/configparser.c"
     break;
 
-  case 308:
-#line 678 "./util/configparser.y"
+  case 315: /* server_max_ecs_tree_size_ipv6: VAR_MAX_ECS_TREE_SIZE_IPV6 STRING_ARG  */
+#line 695 "./util/configparser.y"
         {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_ecs_tree_size_ipv6:%s)\n", (yyvsp[0].str)));
@@ -3809,11 +3190,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 3813 "util/configparser.c"
+#line 3194 "util/configparser.c"
     break;
 
-  case 309:
-#line 693 "./util/configparser.y"
+  case 316: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 710 "./util/configparser.y"
         {
 		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
@@ -3825,11 +3206,11 @@ yyreduce:
 		else
 			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
-#line 3829 "util/configparser.c"
+#line 3210 "util/configparser.c"
     break;
 
-  case 310:
-#line 706 "./util/configparser.y"
+  case 317: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 723 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
@@ -3843,11 +3224,11 @@ yyreduce:
 			cfg_parser->cfg->out_ifs[
 				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
-#line 3847 "util/configparser.c"
+#line 3228 "util/configparser.c"
     break;
 
-  case 311:
-#line 721 "./util/configparser.y"
+  case 318: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 738 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -3855,11 +3236,11 @@ yyreduce:
 		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3859 "util/configparser.c"
+#line 3240 "util/configparser.c"
     break;
 
-  case 312:
-#line 730 "./util/configparser.y"
+  case 319: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 747 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 1, 
@@ -3867,11 +3248,11 @@ yyreduce:
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 3871 "util/configparser.c"
+#line 3252 "util/configparser.c"
     break;
 
-  case 313:
-#line 739 "./util/configparser.y"
+  case 320: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 756 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 0, 
@@ -3879,11 +3260,11 @@ yyreduce:
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 3883 "util/configparser.c"
+#line 3264 "util/configparser.c"
     break;
 
-  case 314:
-#line 748 "./util/configparser.y"
+  case 321: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 765 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3891,11 +3272,11 @@ yyreduce:
 		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3895 "util/configparser.c"
+#line 3276 "util/configparser.c"
     break;
 
-  case 315:
-#line 757 "./util/configparser.y"
+  case 322: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 774 "./util/configparser.y"
         {
 		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3903,11 +3284,11 @@ yyreduce:
 		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3907 "util/configparser.c"
+#line 3288 "util/configparser.c"
     break;
 
-  case 316:
-#line 766 "./util/configparser.y"
+  case 323: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 783 "./util/configparser.y"
         {
 		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3915,11 +3296,11 @@ yyreduce:
 		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3919 "util/configparser.c"
+#line 3300 "util/configparser.c"
     break;
 
-  case 317:
-#line 775 "./util/configparser.y"
+  case 324: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 792 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3927,11 +3308,11 @@ yyreduce:
 		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3931 "util/configparser.c"
+#line 3312 "util/configparser.c"
     break;
 
-  case 318:
-#line 784 "./util/configparser.y"
+  case 325: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 801 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3939,11 +3320,11 @@ yyreduce:
 		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3943 "util/configparser.c"
+#line 3324 "util/configparser.c"
     break;
 
-  case 319:
-#line 793 "./util/configparser.y"
+  case 326: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 810 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3951,11 +3332,11 @@ yyreduce:
 		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3955 "util/configparser.c"
+#line 3336 "util/configparser.c"
     break;
 
-  case 320:
-#line 802 "./util/configparser.y"
+  case 327: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 819 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3963,11 +3344,11 @@ yyreduce:
 		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3967 "util/configparser.c"
+#line 3348 "util/configparser.c"
     break;
 
-  case 321:
-#line 811 "./util/configparser.y"
+  case 328: /* server_prefer_ip4: VAR_PREFER_IP4 STRING_ARG  */
+#line 828 "./util/configparser.y"
         {
 		OUTYY(("P(server_prefer_ip4:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3975,11 +3356,11 @@ yyreduce:
 		else cfg_parser->cfg->prefer_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3979 "util/configparser.c"
+#line 3360 "util/configparser.c"
     break;
 
-  case 322:
-#line 820 "./util/configparser.y"
+  case 329: /* server_prefer_ip6: VAR_PREFER_IP6 STRING_ARG  */
+#line 837 "./util/configparser.y"
         {
 		OUTYY(("P(server_prefer_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3987,11 +3368,11 @@ yyreduce:
 		else cfg_parser->cfg->prefer_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3991 "util/configparser.c"
+#line 3372 "util/configparser.c"
     break;
 
-  case 323:
-#line 829 "./util/configparser.y"
+  case 330: /* server_tcp_mss: VAR_TCP_MSS STRING_ARG  */
+#line 846 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_mss:%s)\n", (yyvsp[0].str)));
                 if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -3999,11 +3380,11 @@ yyreduce:
                 else cfg_parser->cfg->tcp_mss = atoi((yyvsp[0].str));
                 free((yyvsp[0].str));
 	}
-#line 4003 "util/configparser.c"
+#line 3384 "util/configparser.c"
     break;
 
-  case 324:
-#line 838 "./util/configparser.y"
+  case 331: /* server_outgoing_tcp_mss: VAR_OUTGOING_TCP_MSS STRING_ARG  */
+#line 855 "./util/configparser.y"
         {
 		OUTYY(("P(server_outgoing_tcp_mss:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4011,11 +3392,11 @@ yyreduce:
 		else cfg_parser->cfg->outgoing_tcp_mss = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4015 "util/configparser.c"
+#line 3396 "util/configparser.c"
     break;
 
-  case 325:
-#line 847 "./util/configparser.y"
+  case 332: /* server_tcp_idle_timeout: VAR_TCP_IDLE_TIMEOUT STRING_ARG  */
+#line 864 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_idle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4027,11 +3408,11 @@ yyreduce:
 		else cfg_parser->cfg->tcp_idle_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4031 "util/configparser.c"
+#line 3412 "util/configparser.c"
     break;
 
-  case 326:
-#line 860 "./util/configparser.y"
+  case 333: /* server_tcp_keepalive: VAR_EDNS_TCP_KEEPALIVE STRING_ARG  */
+#line 877 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_keepalive:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4039,11 +3420,11 @@ yyreduce:
 		else cfg_parser->cfg->do_tcp_keepalive = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4043 "util/configparser.c"
+#line 3424 "util/configparser.c"
     break;
 
-  case 327:
-#line 869 "./util/configparser.y"
+  case 334: /* server_tcp_keepalive_timeout: VAR_EDNS_TCP_KEEPALIVE_TIMEOUT STRING_ARG  */
+#line 886 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_keepalive_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4055,11 +3436,11 @@ yyreduce:
 		else cfg_parser->cfg->tcp_keepalive_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4059 "util/configparser.c"
+#line 3440 "util/configparser.c"
     break;
 
-  case 328:
-#line 882 "./util/configparser.y"
+  case 335: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 899 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4067,11 +3448,11 @@ yyreduce:
 		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4071 "util/configparser.c"
+#line 3452 "util/configparser.c"
     break;
 
-  case 329:
-#line 891 "./util/configparser.y"
+  case 336: /* server_udp_upstream_without_downstream: VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM STRING_ARG  */
+#line 908 "./util/configparser.y"
         {
 		OUTYY(("P(server_udp_upstream_without_downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4079,11 +3460,11 @@ yyreduce:
 		else cfg_parser->cfg->udp_upstream_without_downstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4083 "util/configparser.c"
+#line 3464 "util/configparser.c"
     break;
 
-  case 330:
-#line 900 "./util/configparser.y"
+  case 337: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 917 "./util/configparser.y"
         {
 		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4091,31 +3472,31 @@ yyreduce:
 		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4095 "util/configparser.c"
+#line 3476 "util/configparser.c"
     break;
 
-  case 331:
-#line 909 "./util/configparser.y"
+  case 338: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 926 "./util/configparser.y"
         {
 		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_key);
 		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
 	}
-#line 4105 "util/configparser.c"
+#line 3486 "util/configparser.c"
     break;
 
-  case 332:
-#line 916 "./util/configparser.y"
+  case 339: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 933 "./util/configparser.y"
         {
 		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_pem);
 		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
 	}
-#line 4115 "util/configparser.c"
+#line 3496 "util/configparser.c"
     break;
 
-  case 333:
-#line 923 "./util/configparser.y"
+  case 340: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 940 "./util/configparser.y"
         {
 		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4123,21 +3504,21 @@ yyreduce:
 		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4127 "util/configparser.c"
+#line 3508 "util/configparser.c"
     break;
 
-  case 334:
-#line 932 "./util/configparser.y"
+  case 341: /* server_tls_cert_bundle: VAR_TLS_CERT_BUNDLE STRING_ARG  */
+#line 949 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_cert_bundle:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_cert_bundle);
 		cfg_parser->cfg->tls_cert_bundle = (yyvsp[0].str);
 	}
-#line 4137 "util/configparser.c"
+#line 3518 "util/configparser.c"
     break;
 
-  case 335:
-#line 939 "./util/configparser.y"
+  case 342: /* server_tls_win_cert: VAR_TLS_WIN_CERT STRING_ARG  */
+#line 956 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_win_cert:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4145,53 +3526,77 @@ yyreduce:
 		else cfg_parser->cfg->tls_win_cert = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4149 "util/configparser.c"
+#line 3530 "util/configparser.c"
     break;
 
-  case 336:
-#line 948 "./util/configparser.y"
+  case 343: /* server_tls_additional_port: VAR_TLS_ADDITIONAL_PORT STRING_ARG  */
+#line 965 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_additional_port:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->tls_additional_port,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4160 "util/configparser.c"
+#line 3541 "util/configparser.c"
     break;
 
-  case 337:
-#line 956 "./util/configparser.y"
+  case 344: /* server_tls_ciphers: VAR_TLS_CIPHERS STRING_ARG  */
+#line 973 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_ciphers:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_ciphers);
 		cfg_parser->cfg->tls_ciphers = (yyvsp[0].str);
 	}
-#line 4170 "util/configparser.c"
+#line 3551 "util/configparser.c"
     break;
 
-  case 338:
-#line 963 "./util/configparser.y"
+  case 345: /* server_tls_ciphersuites: VAR_TLS_CIPHERSUITES STRING_ARG  */
+#line 980 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_ciphersuites:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_ciphersuites);
 		cfg_parser->cfg->tls_ciphersuites = (yyvsp[0].str);
 	}
-#line 4180 "util/configparser.c"
+#line 3561 "util/configparser.c"
+    break;
+
+  case 346: /* server_tls_session_cache_size: VAR_TLS_SESSION_CACHE_SIZE STRING_ARG  */
+#line 987 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tls_session_cache_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tls_session_cache_size = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3573 "util/configparser.c"
+    break;
+
+  case 347: /* server_tls_use_ktls: VAR_TLS_USE_KTLS STRING_ARG  */
+#line 996 "./util/configparser.y"
+        {
+		OUTYY(("P(server_tls_use_ktls:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tls_use_ktls = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3585 "util/configparser.c"
     break;
 
-  case 339:
-#line 970 "./util/configparser.y"
+  case 348: /* server_tls_session_ticket_keys: VAR_TLS_SESSION_TICKET_KEYS STRING_ARG  */
+#line 1005 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_session_ticket_keys:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append(&cfg_parser->cfg->tls_session_ticket_keys,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4191 "util/configparser.c"
+#line 3596 "util/configparser.c"
     break;
 
-  case 340:
-#line 978 "./util/configparser.y"
+  case 349: /* server_tls_use_sni: VAR_TLS_USE_SNI STRING_ARG  */
+#line 1013 "./util/configparser.y"
         {
 		OUTYY(("P(server_tls_use_sni:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4199,11 +3604,11 @@ yyreduce:
 		else cfg_parser->cfg->tls_use_sni = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4203 "util/configparser.c"
+#line 3608 "util/configparser.c"
     break;
 
-  case 341:
-#line 987 "./util/configparser.y"
+  case 350: /* server_https_port: VAR_HTTPS_PORT STRING_ARG  */
+#line 1022 "./util/configparser.y"
         {
 		OUTYY(("P(server_https_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4211,11 +3616,11 @@ yyreduce:
 		else cfg_parser->cfg->https_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4215 "util/configparser.c"
+#line 3620 "util/configparser.c"
     break;
 
-  case 342:
-#line 995 "./util/configparser.y"
+  case 351: /* server_http_endpoint: VAR_HTTP_ENDPOINT STRING_ARG  */
+#line 1030 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_endpoint:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->http_endpoint);
@@ -4231,11 +3636,11 @@ yyreduce:
 			cfg_parser->cfg->http_endpoint = (yyvsp[0].str);
 		}
 	}
-#line 4235 "util/configparser.c"
+#line 3640 "util/configparser.c"
     break;
 
-  case 343:
-#line 1011 "./util/configparser.y"
+  case 352: /* server_http_max_streams: VAR_HTTP_MAX_STREAMS STRING_ARG  */
+#line 1046 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_max_streams:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4243,11 +3648,11 @@ yyreduce:
 		else cfg_parser->cfg->http_max_streams = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4247 "util/configparser.c"
+#line 3652 "util/configparser.c"
     break;
 
-  case 344:
-#line 1019 "./util/configparser.y"
+  case 353: /* server_http_query_buffer_size: VAR_HTTP_QUERY_BUFFER_SIZE STRING_ARG  */
+#line 1054 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_query_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str),
@@ -4255,11 +3660,11 @@ yyreduce:
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4259 "util/configparser.c"
+#line 3664 "util/configparser.c"
     break;
 
-  case 345:
-#line 1027 "./util/configparser.y"
+  case 354: /* server_http_response_buffer_size: VAR_HTTP_RESPONSE_BUFFER_SIZE STRING_ARG  */
+#line 1062 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_response_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str),
@@ -4267,11 +3672,11 @@ yyreduce:
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4271 "util/configparser.c"
+#line 3676 "util/configparser.c"
     break;
 
-  case 346:
-#line 1035 "./util/configparser.y"
+  case 355: /* server_http_nodelay: VAR_HTTP_NODELAY STRING_ARG  */
+#line 1070 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_nodelay:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4279,11 +3684,11 @@ yyreduce:
 		else cfg_parser->cfg->http_nodelay = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4283 "util/configparser.c"
+#line 3688 "util/configparser.c"
     break;
 
-  case 347:
-#line 1043 "./util/configparser.y"
+  case 356: /* server_http_notls_downstream: VAR_HTTP_NOTLS_DOWNSTREAM STRING_ARG  */
+#line 1078 "./util/configparser.y"
         {
 		OUTYY(("P(server_http_notls_downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4291,11 +3696,11 @@ yyreduce:
 		else cfg_parser->cfg->http_notls_downstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4295 "util/configparser.c"
+#line 3700 "util/configparser.c"
     break;
 
-  case 348:
-#line 1051 "./util/configparser.y"
+  case 357: /* server_use_systemd: VAR_USE_SYSTEMD STRING_ARG  */
+#line 1086 "./util/configparser.y"
         {
 		OUTYY(("P(server_use_systemd:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4303,11 +3708,11 @@ yyreduce:
 		else cfg_parser->cfg->use_systemd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4307 "util/configparser.c"
+#line 3712 "util/configparser.c"
     break;
 
-  case 349:
-#line 1060 "./util/configparser.y"
+  case 358: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 1095 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4315,11 +3720,11 @@ yyreduce:
 		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4319 "util/configparser.c"
+#line 3724 "util/configparser.c"
     break;
 
-  case 350:
-#line 1069 "./util/configparser.y"
+  case 359: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 1104 "./util/configparser.y"
         {
 		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4332,11 +3737,11 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 4336 "util/configparser.c"
+#line 3741 "util/configparser.c"
     break;
 
-  case 351:
-#line 1083 "./util/configparser.y"
+  case 360: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 1118 "./util/configparser.y"
         {
 		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4344,11 +3749,11 @@ yyreduce:
 		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4348 "util/configparser.c"
+#line 3753 "util/configparser.c"
     break;
 
-  case 352:
-#line 1092 "./util/configparser.y"
+  case 361: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 1127 "./util/configparser.y"
         {
 		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4356,11 +3761,11 @@ yyreduce:
 		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4360 "util/configparser.c"
+#line 3765 "util/configparser.c"
     break;
 
-  case 353:
-#line 1101 "./util/configparser.y"
+  case 362: /* server_log_replies: VAR_LOG_REPLIES STRING_ARG  */
+#line 1136 "./util/configparser.y"
   {
   	OUTYY(("P(server_log_replies:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4368,11 +3773,11 @@ yyreduce:
   	else cfg_parser->cfg->log_replies = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 4372 "util/configparser.c"
+#line 3777 "util/configparser.c"
     break;
 
-  case 354:
-#line 1110 "./util/configparser.y"
+  case 363: /* server_log_tag_queryreply: VAR_LOG_TAG_QUERYREPLY STRING_ARG  */
+#line 1145 "./util/configparser.y"
   {
   	OUTYY(("P(server_log_tag_queryreply:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4380,11 +3785,11 @@ yyreduce:
   	else cfg_parser->cfg->log_tag_queryreply = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 4384 "util/configparser.c"
+#line 3789 "util/configparser.c"
     break;
 
-  case 355:
-#line 1119 "./util/configparser.y"
+  case 364: /* server_log_servfail: VAR_LOG_SERVFAIL STRING_ARG  */
+#line 1154 "./util/configparser.y"
         {
 		OUTYY(("P(server_log_servfail:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4392,11 +3797,11 @@ yyreduce:
 		else cfg_parser->cfg->log_servfail = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4396 "util/configparser.c"
+#line 3801 "util/configparser.c"
     break;
 
-  case 356:
-#line 1128 "./util/configparser.y"
+  case 365: /* server_log_local_actions: VAR_LOG_LOCAL_ACTIONS STRING_ARG  */
+#line 1163 "./util/configparser.y"
   {
   	OUTYY(("P(server_log_local_actions:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4404,31 +3809,31 @@ yyreduce:
   	else cfg_parser->cfg->log_local_actions = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 4408 "util/configparser.c"
+#line 3813 "util/configparser.c"
     break;
 
-  case 357:
-#line 1137 "./util/configparser.y"
+  case 366: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 1172 "./util/configparser.y"
         {
 		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->chrootdir);
 		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
 	}
-#line 4418 "util/configparser.c"
+#line 3823 "util/configparser.c"
     break;
 
-  case 358:
-#line 1144 "./util/configparser.y"
+  case 367: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 1179 "./util/configparser.y"
         {
 		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->username);
 		cfg_parser->cfg->username = (yyvsp[0].str);
 	}
-#line 4428 "util/configparser.c"
+#line 3833 "util/configparser.c"
     break;
 
-  case 359:
-#line 1151 "./util/configparser.y"
+  case 368: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 1186 "./util/configparser.y"
         {
 		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->directory);
@@ -4453,105 +3858,105 @@ yyreduce:
 			}
 		}
 	}
-#line 4457 "util/configparser.c"
+#line 3862 "util/configparser.c"
     break;
 
-  case 360:
-#line 1177 "./util/configparser.y"
+  case 369: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 1212 "./util/configparser.y"
         {
 		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
 		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
-#line 4468 "util/configparser.c"
+#line 3873 "util/configparser.c"
     break;
 
-  case 361:
-#line 1185 "./util/configparser.y"
+  case 370: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 1220 "./util/configparser.y"
         {
 		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
 		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
-#line 4478 "util/configparser.c"
+#line 3883 "util/configparser.c"
     break;
 
-  case 362:
-#line 1192 "./util/configparser.y"
+  case 371: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 1227 "./util/configparser.y"
         {
 		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4488 "util/configparser.c"
+#line 3893 "util/configparser.c"
     break;
 
-  case 363:
-#line 1199 "./util/configparser.y"
+  case 372: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 1234 "./util/configparser.y"
         {
 		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		log_warn("option dlv-anchor-file ignored: DLV is decommissioned");
 		free((yyvsp[0].str));
 	}
-#line 4498 "util/configparser.c"
+#line 3903 "util/configparser.c"
     break;
 
-  case 364:
-#line 1206 "./util/configparser.y"
+  case 373: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 1241 "./util/configparser.y"
         {
 		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
 		log_warn("option dlv-anchor ignored: DLV is decommissioned");
 		free((yyvsp[0].str));
 	}
-#line 4508 "util/configparser.c"
+#line 3913 "util/configparser.c"
     break;
 
-  case 365:
-#line 1213 "./util/configparser.y"
+  case 374: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 1248 "./util/configparser.y"
         {
 		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4519 "util/configparser.c"
+#line 3924 "util/configparser.c"
     break;
 
-  case 366:
-#line 1221 "./util/configparser.y"
+  case 375: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 1256 "./util/configparser.y"
         {
 		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4530 "util/configparser.c"
+#line 3935 "util/configparser.c"
     break;
 
-  case 367:
-#line 1229 "./util/configparser.y"
+  case 376: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 1264 "./util/configparser.y"
         {
 		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4541 "util/configparser.c"
+#line 3946 "util/configparser.c"
     break;
 
-  case 368:
-#line 1237 "./util/configparser.y"
+  case 377: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 1272 "./util/configparser.y"
         {
 		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4551 "util/configparser.c"
+#line 3956 "util/configparser.c"
     break;
 
-  case 369:
-#line 1244 "./util/configparser.y"
+  case 378: /* server_trust_anchor_signaling: VAR_TRUST_ANCHOR_SIGNALING STRING_ARG  */
+#line 1279 "./util/configparser.y"
         {
 		OUTYY(("P(server_trust_anchor_signaling:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4561,11 +3966,23 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4565 "util/configparser.c"
+#line 3970 "util/configparser.c"
+    break;
+
+  case 379: /* server_trust_anchor_prime_on_start: VAR_TRUST_ANCHOR_PRIME_ON_START STRING_ARG  */
+#line 1290 "./util/configparser.y"
+        {
+		OUTYY(("P(server_trust_anchor_prime_on_start:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->trust_anchor_prime_on_start = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3982 "util/configparser.c"
     break;
 
-  case 370:
-#line 1255 "./util/configparser.y"
+  case 380: /* server_root_key_sentinel: VAR_ROOT_KEY_SENTINEL STRING_ARG  */
+#line 1299 "./util/configparser.y"
         {
 		OUTYY(("P(server_root_key_sentinel:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4575,21 +3992,21 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4579 "util/configparser.c"
+#line 3996 "util/configparser.c"
     break;
 
-  case 371:
-#line 1266 "./util/configparser.y"
+  case 381: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 1310 "./util/configparser.y"
         {
 		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4589 "util/configparser.c"
+#line 4006 "util/configparser.c"
     break;
 
-  case 372:
-#line 1273 "./util/configparser.y"
+  case 382: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 1317 "./util/configparser.y"
         {
 		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4597,11 +4014,11 @@ yyreduce:
 		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4601 "util/configparser.c"
+#line 4018 "util/configparser.c"
     break;
 
-  case 373:
-#line 1282 "./util/configparser.y"
+  case 383: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 1326 "./util/configparser.y"
         {
 		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4609,11 +4026,11 @@ yyreduce:
 		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4613 "util/configparser.c"
+#line 4030 "util/configparser.c"
     break;
 
-  case 374:
-#line 1291 "./util/configparser.y"
+  case 384: /* server_hide_trustanchor: VAR_HIDE_TRUSTANCHOR STRING_ARG  */
+#line 1335 "./util/configparser.y"
         {
 		OUTYY(("P(server_hide_trustanchor:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4621,31 +4038,31 @@ yyreduce:
 		else cfg_parser->cfg->hide_trustanchor = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4625 "util/configparser.c"
+#line 4042 "util/configparser.c"
     break;
 
-  case 375:
-#line 1300 "./util/configparser.y"
+  case 385: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 1344 "./util/configparser.y"
         {
 		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
 		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
-#line 4635 "util/configparser.c"
+#line 4052 "util/configparser.c"
     break;
 
-  case 376:
-#line 1307 "./util/configparser.y"
+  case 386: /* server_version: VAR_VERSION STRING_ARG  */
+#line 1351 "./util/configparser.y"
         {
 		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
 		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
-#line 4645 "util/configparser.c"
+#line 4062 "util/configparser.c"
     break;
 
-  case 377:
-#line 1314 "./util/configparser.y"
+  case 387: /* server_nsid: VAR_NSID STRING_ARG  */
+#line 1358 "./util/configparser.y"
         {
 		OUTYY(("P(server_nsid:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->nsid_cfg_str);
@@ -4660,33 +4077,33 @@ yyreduce:
 			yyerror("the NSID must be either a hex string or an "
 			    "ascii character string prepended with ascii_.");
 	}
-#line 4664 "util/configparser.c"
+#line 4081 "util/configparser.c"
     break;
 
-  case 378:
-#line 1330 "./util/configparser.y"
+  case 388: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 1374 "./util/configparser.y"
         {
 		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 4675 "util/configparser.c"
+#line 4092 "util/configparser.c"
     break;
 
-  case 379:
-#line 1338 "./util/configparser.y"
+  case 389: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 1382 "./util/configparser.y"
         {
 		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 4686 "util/configparser.c"
+#line 4103 "util/configparser.c"
     break;
 
-  case 380:
-#line 1346 "./util/configparser.y"
+  case 390: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 1390 "./util/configparser.y"
     {
         OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4695,11 +4112,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 4699 "util/configparser.c"
+#line 4116 "util/configparser.c"
     break;
 
-  case 381:
-#line 1356 "./util/configparser.y"
+  case 391: /* server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG  */
+#line 1400 "./util/configparser.y"
     {
         OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4708,11 +4125,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 4712 "util/configparser.c"
+#line 4129 "util/configparser.c"
     break;
 
-  case 382:
-#line 1366 "./util/configparser.y"
+  case 392: /* server_ip_freebind: VAR_IP_FREEBIND STRING_ARG  */
+#line 1410 "./util/configparser.y"
     {
         OUTYY(("P(server_ip_freebind:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4721,11 +4138,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 4725 "util/configparser.c"
+#line 4142 "util/configparser.c"
     break;
 
-  case 383:
-#line 1376 "./util/configparser.y"
+  case 393: /* server_ip_dscp: VAR_IP_DSCP STRING_ARG  */
+#line 1420 "./util/configparser.y"
         {
 		OUTYY(("P(server_ip_dscp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4738,22 +4155,46 @@ yyreduce:
 			cfg_parser->cfg->ip_dscp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4742 "util/configparser.c"
+#line 4159 "util/configparser.c"
     break;
 
-  case 384:
-#line 1390 "./util/configparser.y"
+  case 394: /* server_busy_poll: VAR_BUSY_POLL STRING_ARG  */
+#line 1434 "./util/configparser.y"
+        {
+		OUTYY(("P(server_busy_poll:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->busy_poll = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4171 "util/configparser.c"
+    break;
+
+  case 395: /* server_use_io_uring: VAR_USE_IO_URING STRING_ARG  */
+#line 1443 "./util/configparser.y"
+        {
+		OUTYY(("P(server_use_io_uring:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->use_io_uring = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4183 "util/configparser.c"
+    break;
+
+  case 396: /* server_stream_wait_size: VAR_STREAM_WAIT_SIZE STRING_ARG  */
+#line 1452 "./util/configparser.y"
         {
 		OUTYY(("P(server_stream_wait_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->stream_wait_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4753 "util/configparser.c"
+#line 4194 "util/configparser.c"
     break;
 
-  case 385:
-#line 1398 "./util/configparser.y"
+  case 397: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 1460 "./util/configparser.y"
         {
 		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4765,11 +4206,11 @@ yyreduce:
 		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4769 "util/configparser.c"
+#line 4210 "util/configparser.c"
     break;
 
-  case 386:
-#line 1411 "./util/configparser.y"
+  case 398: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 1473 "./util/configparser.y"
         {
 		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4779,22 +4220,22 @@ yyreduce:
 		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4783 "util/configparser.c"
+#line 4224 "util/configparser.c"
     break;
 
-  case 387:
-#line 1422 "./util/configparser.y"
+  case 399: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 1484 "./util/configparser.y"
         {
 		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4794 "util/configparser.c"
+#line 4235 "util/configparser.c"
     break;
 
-  case 388:
-#line 1430 "./util/configparser.y"
+  case 400: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 1492 "./util/configparser.y"
         {
 		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4806,11 +4247,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4810 "util/configparser.c"
+#line 4251 "util/configparser.c"
     break;
 
-  case 389:
-#line 1443 "./util/configparser.y"
+  case 401: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 1505 "./util/configparser.y"
         {
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4818,11 +4259,11 @@ yyreduce:
 		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4822 "util/configparser.c"
+#line 4263 "util/configparser.c"
     break;
 
-  case 390:
-#line 1452 "./util/configparser.y"
+  case 402: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 1514 "./util/configparser.y"
         {
 		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4830,11 +4271,11 @@ yyreduce:
 		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4834 "util/configparser.c"
+#line 4275 "util/configparser.c"
     break;
 
-  case 391:
-#line 1461 "./util/configparser.y"
+  case 403: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 1523 "./util/configparser.y"
         {
 		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4842,11 +4283,11 @@ yyreduce:
 		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4846 "util/configparser.c"
+#line 4287 "util/configparser.c"
     break;
 
-  case 392:
-#line 1470 "./util/configparser.y"
+  case 404: /* server_udp_connect: VAR_UDP_CONNECT STRING_ARG  */
+#line 1532 "./util/configparser.y"
         {
 		OUTYY(("P(server_udp_connect:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4854,11 +4295,11 @@ yyreduce:
 		else cfg_parser->cfg->udp_connect = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4858 "util/configparser.c"
+#line 4299 "util/configparser.c"
     break;
 
-  case 393:
-#line 1479 "./util/configparser.y"
+  case 405: /* server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG  */
+#line 1541 "./util/configparser.y"
         {
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4867,11 +4308,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4871 "util/configparser.c"
+#line 4312 "util/configparser.c"
     break;
 
-  case 394:
-#line 1489 "./util/configparser.y"
+  case 406: /* server_insecure_lan_zones: VAR_INSECURE_LAN_ZONES STRING_ARG  */
+#line 1551 "./util/configparser.y"
         {
 		OUTYY(("P(server_insecure_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4880,22 +4321,22 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4884 "util/configparser.c"
+#line 4325 "util/configparser.c"
     break;
 
-  case 395:
-#line 1499 "./util/configparser.y"
+  case 407: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 1561 "./util/configparser.y"
         {
 		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4895 "util/configparser.c"
+#line 4336 "util/configparser.c"
     break;
 
-  case 396:
-#line 1507 "./util/configparser.y"
+  case 408: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 1569 "./util/configparser.y"
         {
 		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4907,11 +4348,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4911 "util/configparser.c"
+#line 4352 "util/configparser.c"
     break;
 
-  case 397:
-#line 1520 "./util/configparser.y"
+  case 409: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 1582 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4919,22 +4360,22 @@ yyreduce:
 		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4923 "util/configparser.c"
+#line 4364 "util/configparser.c"
     break;
 
-  case 398:
-#line 1529 "./util/configparser.y"
+  case 410: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 1591 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
 			"removed, use infra-host-ttl)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4934 "util/configparser.c"
+#line 4375 "util/configparser.c"
     break;
 
-  case 399:
-#line 1537 "./util/configparser.y"
+  case 411: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 1599 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4942,22 +4383,22 @@ yyreduce:
 		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4946 "util/configparser.c"
+#line 4387 "util/configparser.c"
     break;
 
-  case 400:
-#line 1546 "./util/configparser.y"
+  case 412: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 1608 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
 			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4957 "util/configparser.c"
+#line 4398 "util/configparser.c"
     break;
 
-  case 401:
-#line 1554 "./util/configparser.y"
+  case 413: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 1616 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -4969,11 +4410,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4973 "util/configparser.c"
+#line 4414 "util/configparser.c"
     break;
 
-  case 402:
-#line 1567 "./util/configparser.y"
+  case 414: /* server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG  */
+#line 1629 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4981,11 +4422,11 @@ yyreduce:
 		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4985 "util/configparser.c"
+#line 4426 "util/configparser.c"
     break;
 
-  case 403:
-#line 1576 "./util/configparser.y"
+  case 415: /* server_infra_keep_probing: VAR_INFRA_KEEP_PROBING STRING_ARG  */
+#line 1638 "./util/configparser.y"
         {
 		OUTYY(("P(server_infra_keep_probing:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4994,21 +4435,21 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4998 "util/configparser.c"
+#line 4439 "util/configparser.c"
     break;
 
-  case 404:
-#line 1586 "./util/configparser.y"
+  case 416: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 1648 "./util/configparser.y"
         {
 		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
 		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
-#line 5008 "util/configparser.c"
+#line 4449 "util/configparser.c"
     break;
 
-  case 405:
-#line 1593 "./util/configparser.y"
+  case 417: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 1655 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5017,11 +4458,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5021 "util/configparser.c"
+#line 4462 "util/configparser.c"
     break;
 
-  case 406:
-#line 1603 "./util/configparser.y"
+  case 418: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 1665 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5030,11 +4471,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5034 "util/configparser.c"
+#line 4475 "util/configparser.c"
     break;
 
-  case 407:
-#line 1613 "./util/configparser.y"
+  case 419: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 1675 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5043,11 +4484,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5047 "util/configparser.c"
+#line 4488 "util/configparser.c"
     break;
 
-  case 408:
-#line 1623 "./util/configparser.y"
+  case 420: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 1685 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5056,11 +4497,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5060 "util/configparser.c"
+#line 4501 "util/configparser.c"
     break;
 
-  case 409:
-#line 1633 "./util/configparser.y"
+  case 421: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 1695 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5069,11 +4510,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5073 "util/configparser.c"
+#line 4514 "util/configparser.c"
     break;
 
-  case 410:
-#line 1643 "./util/configparser.y"
+  case 422: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 1705 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5082,11 +4523,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5086 "util/configparser.c"
+#line 4527 "util/configparser.c"
     break;
 
-  case 411:
-#line 1653 "./util/configparser.y"
+  case 423: /* server_harden_algo_downgrade: VAR_HARDEN_ALGO_DOWNGRADE STRING_ARG  */
+#line 1715 "./util/configparser.y"
         {
 		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5095,11 +4536,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5099 "util/configparser.c"
+#line 4540 "util/configparser.c"
     break;
 
-  case 412:
-#line 1663 "./util/configparser.y"
+  case 424: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 1725 "./util/configparser.y"
         {
 		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5108,41 +4549,41 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5112 "util/configparser.c"
+#line 4553 "util/configparser.c"
     break;
 
-  case 413:
-#line 1673 "./util/configparser.y"
+  case 425: /* server_caps_whitelist: VAR_CAPS_WHITELIST STRING_ARG  */
+#line 1735 "./util/configparser.y"
         {
 		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5122 "util/configparser.c"
+#line 4563 "util/configparser.c"
     break;
 
-  case 414:
-#line 1680 "./util/configparser.y"
+  case 426: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 1742 "./util/configparser.y"
         {
 		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5132 "util/configparser.c"
+#line 4573 "util/configparser.c"
     break;
 
-  case 415:
-#line 1687 "./util/configparser.y"
+  case 427: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1749 "./util/configparser.y"
         {
 		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5142 "util/configparser.c"
+#line 4583 "util/configparser.c"
     break;
 
-  case 416:
-#line 1694 "./util/configparser.y"
+  case 428: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1756 "./util/configparser.y"
         {
 		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5150,11 +4591,11 @@ yyreduce:
 		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5154 "util/configparser.c"
+#line 4595 "util/configparser.c"
     break;
 
-  case 417:
-#line 1703 "./util/configparser.y"
+  case 429: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1765 "./util/configparser.y"
         {
 		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5162,11 +4603,11 @@ yyreduce:
 		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5166 "util/configparser.c"
+#line 4607 "util/configparser.c"
     break;
 
-  case 418:
-#line 1712 "./util/configparser.y"
+  case 430: /* server_deny_any: VAR_DENY_ANY STRING_ARG  */
+#line 1774 "./util/configparser.y"
         {
 		OUTYY(("P(server_deny_any:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5174,11 +4615,11 @@ yyreduce:
 		else cfg_parser->cfg->deny_any = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5178 "util/configparser.c"
+#line 4619 "util/configparser.c"
     break;
 
-  case 419:
-#line 1721 "./util/configparser.y"
+  case 431: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1783 "./util/configparser.y"
         {
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5186,21 +4627,21 @@ yyreduce:
 		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5190 "util/configparser.c"
+#line 4631 "util/configparser.c"
     break;
 
-  case 420:
-#line 1730 "./util/configparser.y"
+  case 432: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 1792 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 5200 "util/configparser.c"
+#line 4641 "util/configparser.c"
     break;
 
-  case 421:
-#line 1737 "./util/configparser.y"
+  case 433: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 1799 "./util/configparser.y"
         {
 		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5209,11 +4650,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5213 "util/configparser.c"
+#line 4654 "util/configparser.c"
     break;
 
-  case 422:
-#line 1747 "./util/configparser.y"
+  case 434: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 1809 "./util/configparser.y"
         {
 		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
@@ -5232,21 +4673,21 @@ yyreduce:
 				fatal_exit("out of memory adding acl");
 		}
 	}
-#line 5236 "util/configparser.c"
+#line 4677 "util/configparser.c"
     break;
 
-  case 423:
-#line 1767 "./util/configparser.y"
+  case 435: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 1829 "./util/configparser.y"
         {
 		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
 		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
-#line 5246 "util/configparser.c"
+#line 4687 "util/configparser.c"
     break;
 
-  case 424:
-#line 1774 "./util/configparser.y"
+  case 436: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 1836 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
@@ -5263,11 +4704,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5267 "util/configparser.c"
+#line 4708 "util/configparser.c"
     break;
 
-  case 425:
-#line 1792 "./util/configparser.y"
+  case 437: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 1854 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
@@ -5279,11 +4720,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5283 "util/configparser.c"
+#line 4724 "util/configparser.c"
     break;
 
-  case 426:
-#line 1805 "./util/configparser.y"
+  case 438: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 1867 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
@@ -5295,11 +4736,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5299 "util/configparser.c"
+#line 4740 "util/configparser.c"
     break;
 
-  case 427:
-#line 1818 "./util/configparser.y"
+  case 439: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 1880 "./util/configparser.y"
         {
 		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5307,11 +4748,11 @@ yyreduce:
 		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5311 "util/configparser.c"
+#line 4752 "util/configparser.c"
     break;
 
-  case 428:
-#line 1827 "./util/configparser.y"
+  case 440: /* server_cache_max_negative_ttl: VAR_CACHE_MAX_NEGATIVE_TTL STRING_ARG  */
+#line 1889 "./util/configparser.y"
         {
 		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5319,11 +4760,11 @@ yyreduce:
 		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5323 "util/configparser.c"
+#line 4764 "util/configparser.c"
     break;
 
-  case 429:
-#line 1836 "./util/configparser.y"
+  case 441: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 1898 "./util/configparser.y"
         {
 		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5331,11 +4772,11 @@ yyreduce:
 		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5335 "util/configparser.c"
+#line 4776 "util/configparser.c"
     break;
 
-  case 430:
-#line 1845 "./util/configparser.y"
+  case 442: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 1907 "./util/configparser.y"
         {
 		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5343,11 +4784,11 @@ yyreduce:
 		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5347 "util/configparser.c"
+#line 4788 "util/configparser.c"
     break;
 
-  case 431:
-#line 1854 "./util/configparser.y"
+  case 443: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 1916 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5356,11 +4797,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5360 "util/configparser.c"
+#line 4801 "util/configparser.c"
     break;
 
-  case 432:
-#line 1864 "./util/configparser.y"
+  case 444: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 1926 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5369,11 +4810,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5373 "util/configparser.c"
+#line 4814 "util/configparser.c"
     break;
 
-  case 433:
-#line 1874 "./util/configparser.y"
+  case 445: /* server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG  */
+#line 1936 "./util/configparser.y"
         {
 		OUTYY(("P(server_aggressive_nsec:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5383,11 +4824,11 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5387 "util/configparser.c"
+#line 4828 "util/configparser.c"
     break;
 
-  case 434:
-#line 1885 "./util/configparser.y"
+  case 446: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 1947 "./util/configparser.y"
         {
 		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5395,11 +4836,11 @@ yyreduce:
 		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5399 "util/configparser.c"
+#line 4840 "util/configparser.c"
     break;
 
-  case 435:
-#line 1894 "./util/configparser.y"
+  case 447: /* server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG  */
+#line 1956 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5407,11 +4848,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5411 "util/configparser.c"
+#line 4852 "util/configparser.c"
     break;
 
-  case 436:
-#line 1903 "./util/configparser.y"
+  case 448: /* server_serve_expired_ttl: VAR_SERVE_EXPIRED_TTL STRING_ARG  */
+#line 1965 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5419,11 +4860,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5423 "util/configparser.c"
+#line 4864 "util/configparser.c"
     break;
 
-  case 437:
-#line 1912 "./util/configparser.y"
+  case 449: /* server_serve_expired_ttl_reset: VAR_SERVE_EXPIRED_TTL_RESET STRING_ARG  */
+#line 1974 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired_ttl_reset:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5431,11 +4872,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired_ttl_reset = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5435 "util/configparser.c"
+#line 4876 "util/configparser.c"
     break;
 
-  case 438:
-#line 1921 "./util/configparser.y"
+  case 450: /* server_serve_expired_reply_ttl: VAR_SERVE_EXPIRED_REPLY_TTL STRING_ARG  */
+#line 1983 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired_reply_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5443,11 +4884,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired_reply_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5447 "util/configparser.c"
+#line 4888 "util/configparser.c"
     break;
 
-  case 439:
-#line 1930 "./util/configparser.y"
+  case 451: /* server_serve_expired_client_timeout: VAR_SERVE_EXPIRED_CLIENT_TIMEOUT STRING_ARG  */
+#line 1992 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_expired_client_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5455,11 +4896,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_expired_client_timeout = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5459 "util/configparser.c"
+#line 4900 "util/configparser.c"
     break;
 
-  case 440:
-#line 1939 "./util/configparser.y"
+  case 452: /* server_serve_original_ttl: VAR_SERVE_ORIGINAL_TTL STRING_ARG  */
+#line 2001 "./util/configparser.y"
         {
 		OUTYY(("P(server_serve_original_ttl:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5467,11 +4908,11 @@ yyreduce:
 		else cfg_parser->cfg->serve_original_ttl = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5471 "util/configparser.c"
+#line 4912 "util/configparser.c"
     break;
 
-  case 441:
-#line 1948 "./util/configparser.y"
+  case 453: /* server_fake_dsa: VAR_FAKE_DSA STRING_ARG  */
+#line 2010 "./util/configparser.y"
         {
 		OUTYY(("P(server_fake_dsa:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5483,11 +4924,11 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 5487 "util/configparser.c"
+#line 4928 "util/configparser.c"
     break;
 
-  case 442:
-#line 1961 "./util/configparser.y"
+  case 454: /* server_fake_sha1: VAR_FAKE_SHA1 STRING_ARG  */
+#line 2023 "./util/configparser.y"
         {
 		OUTYY(("P(server_fake_sha1:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5499,11 +4940,11 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 5503 "util/configparser.c"
+#line 4944 "util/configparser.c"
     break;
 
-  case 443:
-#line 1974 "./util/configparser.y"
+  case 455: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 2036 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5511,21 +4952,21 @@ yyreduce:
 		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5515 "util/configparser.c"
+#line 4956 "util/configparser.c"
     break;
 
-  case 444:
-#line 1983 "./util/configparser.y"
+  case 456: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 2045 "./util/configparser.y"
         {
 		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
 		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
-#line 5525 "util/configparser.c"
+#line 4966 "util/configparser.c"
     break;
 
-  case 445:
-#line 1990 "./util/configparser.y"
+  case 457: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 2052 "./util/configparser.y"
         {
 		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5533,11 +4974,11 @@ yyreduce:
 		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5537 "util/configparser.c"
+#line 4978 "util/configparser.c"
     break;
 
-  case 446:
-#line 1999 "./util/configparser.y"
+  case 458: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 2061 "./util/configparser.y"
         {
 		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5545,11 +4986,11 @@ yyreduce:
 		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5549 "util/configparser.c"
+#line 4990 "util/configparser.c"
     break;
 
-  case 447:
-#line 2008 "./util/configparser.y"
+  case 459: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 2070 "./util/configparser.y"
         {
 		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5557,11 +4998,11 @@ yyreduce:
 		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5561 "util/configparser.c"
+#line 5002 "util/configparser.c"
     break;
 
-  case 448:
-#line 2017 "./util/configparser.y"
+  case 460: /* server_permit_small_holddown: VAR_PERMIT_SMALL_HOLDDOWN STRING_ARG  */
+#line 2079 "./util/configparser.y"
         {
 		OUTYY(("P(server_permit_small_holddown:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5570,22 +5011,22 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5574 "util/configparser.c"
+#line 5015 "util/configparser.c"
     break;
 
-  case 449:
-#line 2026 "./util/configparser.y"
+  case 461: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 2088 "./util/configparser.y"
         {
 		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 5585 "util/configparser.c"
+#line 5026 "util/configparser.c"
     break;
 
-  case 450:
-#line 2034 "./util/configparser.y"
+  case 462: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 2096 "./util/configparser.y"
         {
 		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5597,22 +5038,22 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5601 "util/configparser.c"
+#line 5042 "util/configparser.c"
     break;
 
-  case 451:
-#line 2047 "./util/configparser.y"
+  case 463: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 2109 "./util/configparser.y"
         {
 		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 5612 "util/configparser.c"
+#line 5053 "util/configparser.c"
     break;
 
-  case 452:
-#line 2055 "./util/configparser.y"
+  case 464: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 2117 "./util/configparser.y"
         {
 		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
@@ -5656,21 +5097,31 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 5660 "util/configparser.c"
+#line 5101 "util/configparser.c"
     break;
 
-  case 453:
-#line 2100 "./util/configparser.y"
+  case 465: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 2162 "./util/configparser.y"
         {
 		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
-#line 5670 "util/configparser.c"
+#line 5111 "util/configparser.c"
+    break;
+
+  case 466: /* server_local_zone_file: VAR_LOCAL_ZONE_FILE STRING_ARG  */
+#line 2169 "./util/configparser.y"
+        {
+		OUTYY(("P(server_local_zone_file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->local_zone_file);
+		cfg_parser->cfg->local_zone_file = (yyvsp[0].str);
+	}
+#line 5121 "util/configparser.c"
     break;
 
-  case 454:
-#line 2107 "./util/configparser.y"
+  case 467: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 2176 "./util/configparser.y"
         {
 		char* ptr;
 		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
@@ -5684,11 +5135,11 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 5688 "util/configparser.c"
+#line 5139 "util/configparser.c"
     break;
 
-  case 455:
-#line 2122 "./util/configparser.y"
+  case 468: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 2191 "./util/configparser.y"
         {
 		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5697,11 +5148,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5701 "util/configparser.c"
+#line 5152 "util/configparser.c"
     break;
 
-  case 456:
-#line 2132 "./util/configparser.y"
+  case 469: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 2201 "./util/configparser.y"
         {
 		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5710,41 +5161,41 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5714 "util/configparser.c"
+#line 5165 "util/configparser.c"
     break;
 
-  case 457:
-#line 2142 "./util/configparser.y"
+  case 470: /* server_unknown_server_time_limit: VAR_UNKNOWN_SERVER_TIME_LIMIT STRING_ARG  */
+#line 2211 "./util/configparser.y"
         {
 		OUTYY(("P(server_unknown_server_time_limit:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->unknown_server_time_limit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5724 "util/configparser.c"
+#line 5175 "util/configparser.c"
     break;
 
-  case 458:
-#line 2149 "./util/configparser.y"
+  case 471: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 2218 "./util/configparser.y"
         {
 		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5734 "util/configparser.c"
+#line 5185 "util/configparser.c"
     break;
 
-  case 459:
-#line 2156 "./util/configparser.y"
+  case 472: /* server_dns64_prefix: VAR_DNS64_PREFIX STRING_ARG  */
+#line 2225 "./util/configparser.y"
         {
 		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dns64_prefix);
 		cfg_parser->cfg->dns64_prefix = (yyvsp[0].str);
 	}
-#line 5744 "util/configparser.c"
+#line 5195 "util/configparser.c"
     break;
 
-  case 460:
-#line 2163 "./util/configparser.y"
+  case 473: /* server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG  */
+#line 2232 "./util/configparser.y"
         {
 		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -5752,22 +5203,22 @@ yyreduce:
 		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5756 "util/configparser.c"
+#line 5207 "util/configparser.c"
     break;
 
-  case 461:
-#line 2172 "./util/configparser.y"
+  case 474: /* server_dns64_ignore_aaaa: VAR_DNS64_IGNORE_AAAA STRING_ARG  */
+#line 2241 "./util/configparser.y"
         {
 		OUTYY(("P(dns64_ignore_aaaa:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dns64_ignore_aaaa,
 			(yyvsp[0].str)))
 			fatal_exit("out of memory adding dns64-ignore-aaaa");
 	}
-#line 5767 "util/configparser.c"
+#line 5218 "util/configparser.c"
     break;
 
-  case 462:
-#line 2180 "./util/configparser.y"
+  case 475: /* server_define_tag: VAR_DEFINE_TAG STRING_ARG  */
+#line 2249 "./util/configparser.y"
         {
 		char* p, *s = (yyvsp[0].str);
 		OUTYY(("P(server_define_tag:%s)\n", (yyvsp[0].str)));
@@ -5780,11 +5231,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5784 "util/configparser.c"
+#line 5235 "util/configparser.c"
     break;
 
-  case 463:
-#line 2194 "./util/configparser.y"
+  case 476: /* server_local_zone_tag: VAR_LOCAL_ZONE_TAG STRING_ARG STRING_ARG  */
+#line 2263 "./util/configparser.y"
         {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
@@ -5804,11 +5255,11 @@ yyreduce:
 			}
 		}
 	}
-#line 5808 "util/configparser.c"
+#line 5259 "util/configparser.c"
     break;
 
-  case 464:
-#line 2215 "./util/configparser.y"
+  case 477: /* server_access_control_tag: VAR_ACCESS_CONTROL_TAG STRING_ARG STRING_ARG  */
+#line 2284 "./util/configparser.y"
         {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
@@ -5828,11 +5279,11 @@ yyreduce:
 			}
 		}
 	}
-#line 5832 "util/configparser.c"
+#line 5283 "util/configparser.c"
     break;
 
-  case 465:
-#line 2236 "./util/configparser.y"
+  case 478: /* server_access_control_tag_action: VAR_ACCESS_CONTROL_TAG_ACTION STRING_ARG STRING_ARG STRING_ARG  */
+#line 2305 "./util/configparser.y"
         {
 		OUTYY(("P(server_access_control_tag_action:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_actions,
@@ -5843,11 +5294,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 5847 "util/configparser.c"
+#line 5298 "util/configparser.c"
     break;
 
-  case 466:
-#line 2248 "./util/configparser.y"
+  case 479: /* server_access_control_tag_data: VAR_ACCESS_CONTROL_TAG_DATA STRING_ARG STRING_ARG STRING_ARG  */
+#line 2317 "./util/configparser.y"
         {
 		OUTYY(("P(server_access_control_tag_data:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_datas,
@@ -5858,11 +5309,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 5862 "util/configparser.c"
+#line 5313 "util/configparser.c"
     break;
 
-  case 467:
-#line 2260 "./util/configparser.y"
+  case 480: /* server_local_zone_override: VAR_LOCAL_ZONE_OVERRIDE STRING_ARG STRING_ARG STRING_ARG  */
+#line 2329 "./util/configparser.y"
         {
 		OUTYY(("P(server_local_zone_override:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->local_zone_overrides,
@@ -5873,11 +5324,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 5877 "util/configparser.c"
+#line 5328 "util/configparser.c"
     break;
 
-  case 468:
-#line 2272 "./util/configparser.y"
+  case 481: /* server_access_control_view: VAR_ACCESS_CONTROL_VIEW STRING_ARG STRING_ARG  */
+#line 2341 "./util/configparser.y"
         {
 		OUTYY(("P(server_access_control_view:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_view,
@@ -5885,11 +5336,11 @@ yyreduce:
 			yyerror("out of memory");
 		}
 	}
-#line 5889 "util/configparser.c"
+#line 5340 "util/configparser.c"
     break;
 
-  case 469:
-#line 2281 "./util/configparser.y"
+  case 482: /* server_response_ip_tag: VAR_RESPONSE_IP_TAG STRING_ARG STRING_ARG  */
+#line 2350 "./util/configparser.y"
         {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
@@ -5909,11 +5360,11 @@ yyreduce:
 			}
 		}
 	}
-#line 5913 "util/configparser.c"
+#line 5364 "util/configparser.c"
     break;
 
-  case 470:
-#line 2302 "./util/configparser.y"
+  case 483: /* server_ip_ratelimit: VAR_IP_RATELIMIT STRING_ARG  */
+#line 2371 "./util/configparser.y"
         { 
 		OUTYY(("P(server_ip_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5921,11 +5372,11 @@ yyreduce:
 		else cfg_parser->cfg->ip_ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5925 "util/configparser.c"
+#line 5376 "util/configparser.c"
     break;
 
-  case 471:
-#line 2312 "./util/configparser.y"
+  case 484: /* server_ratelimit: VAR_RATELIMIT STRING_ARG  */
+#line 2381 "./util/configparser.y"
         { 
 		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -5933,33 +5384,33 @@ yyreduce:
 		else cfg_parser->cfg->ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5937 "util/configparser.c"
+#line 5388 "util/configparser.c"
     break;
 
-  case 472:
-#line 2321 "./util/configparser.y"
+  case 485: /* server_ip_ratelimit_size: VAR_IP_RATELIMIT_SIZE STRING_ARG  */
+#line 2390 "./util/configparser.y"
   {
   	OUTYY(("P(server_ip_ratelimit_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ip_ratelimit_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 5948 "util/configparser.c"
+#line 5399 "util/configparser.c"
     break;
 
-  case 473:
-#line 2329 "./util/configparser.y"
+  case 486: /* server_ratelimit_size: VAR_RATELIMIT_SIZE STRING_ARG  */
+#line 2398 "./util/configparser.y"
         {
 		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ratelimit_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 5959 "util/configparser.c"
+#line 5410 "util/configparser.c"
     break;
 
-  case 474:
-#line 2337 "./util/configparser.y"
+  case 487: /* server_ip_ratelimit_slabs: VAR_IP_RATELIMIT_SLABS STRING_ARG  */
+#line 2406 "./util/configparser.y"
   {
   	OUTYY(("P(server_ip_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
@@ -5971,11 +5422,11 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 5975 "util/configparser.c"
+#line 5426 "util/configparser.c"
     break;
 
-  case 475:
-#line 2350 "./util/configparser.y"
+  case 488: /* server_ratelimit_slabs: VAR_RATELIMIT_SLABS STRING_ARG  */
+#line 2419 "./util/configparser.y"
         {
 		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5987,11 +5438,11 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 5991 "util/configparser.c"
+#line 5442 "util/configparser.c"
     break;
 
-  case 476:
-#line 2363 "./util/configparser.y"
+  case 489: /* server_ratelimit_for_domain: VAR_RATELIMIT_FOR_DOMAIN STRING_ARG STRING_ARG  */
+#line 2432 "./util/configparser.y"
         {
 		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
@@ -6005,11 +5456,11 @@ yyreduce:
 					"ratelimit-for-domain");
 		}
 	}
-#line 6009 "util/configparser.c"
+#line 5460 "util/configparser.c"
     break;
 
-  case 477:
-#line 2378 "./util/configparser.y"
+  case 490: /* server_ratelimit_below_domain: VAR_RATELIMIT_BELOW_DOMAIN STRING_ARG STRING_ARG  */
+#line 2447 "./util/configparser.y"
         {
 		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
@@ -6023,11 +5474,11 @@ yyreduce:
 					"ratelimit-below-domain");
 		}
 	}
-#line 6027 "util/configparser.c"
+#line 5478 "util/configparser.c"
     break;
 
-  case 478:
-#line 2393 "./util/configparser.y"
+  case 491: /* server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG  */
+#line 2462 "./util/configparser.y"
   { 
   	OUTYY(("P(server_ip_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
   	if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6035,11 +5486,11 @@ yyreduce:
   	else cfg_parser->cfg->ip_ratelimit_factor = atoi((yyvsp[0].str));
   	free((yyvsp[0].str));
 	}
-#line 6039 "util/configparser.c"
+#line 5490 "util/configparser.c"
     break;
 
-  case 479:
-#line 2402 "./util/configparser.y"
+  case 492: /* server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG  */
+#line 2471 "./util/configparser.y"
         { 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6047,20 +5498,20 @@ yyreduce:
 		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6051 "util/configparser.c"
+#line 5502 "util/configparser.c"
     break;
 
-  case 480:
-#line 2411 "./util/configparser.y"
+  case 493: /* server_low_rtt: VAR_LOW_RTT STRING_ARG  */
+#line 2480 "./util/configparser.y"
         { 
 		OUTYY(("P(low-rtt option is deprecated, use fast-server-num instead)\n"));
 		free((yyvsp[0].str));
 	}
-#line 6060 "util/configparser.c"
+#line 5511 "util/configparser.c"
     break;
 
-  case 481:
-#line 2417 "./util/configparser.y"
+  case 494: /* server_fast_server_num: VAR_FAST_SERVER_NUM STRING_ARG  */
+#line 2486 "./util/configparser.y"
         { 
 		OUTYY(("P(server_fast_server_num:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) <= 0)
@@ -6068,11 +5519,11 @@ yyreduce:
 		else cfg_parser->cfg->fast_server_num = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6072 "util/configparser.c"
+#line 5523 "util/configparser.c"
     break;
 
-  case 482:
-#line 2426 "./util/configparser.y"
+  case 495: /* server_fast_server_permil: VAR_FAST_SERVER_PERMIL STRING_ARG  */
+#line 2495 "./util/configparser.y"
         { 
 		OUTYY(("P(server_fast_server_permil:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6080,11 +5531,11 @@ yyreduce:
 		else cfg_parser->cfg->fast_server_permil = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6084 "util/configparser.c"
+#line 5535 "util/configparser.c"
     break;
 
-  case 483:
-#line 2435 "./util/configparser.y"
+  case 496: /* server_qname_minimisation: VAR_QNAME_MINIMISATION STRING_ARG  */
+#line 2504 "./util/configparser.y"
         {
 		OUTYY(("P(server_qname_minimisation:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6093,11 +5544,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6097 "util/configparser.c"
+#line 5548 "util/configparser.c"
     break;
 
-  case 484:
-#line 2445 "./util/configparser.y"
+  case 497: /* server_qname_minimisation_strict: VAR_QNAME_MINIMISATION_STRICT STRING_ARG  */
+#line 2514 "./util/configparser.y"
         {
 		OUTYY(("P(server_qname_minimisation_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6106,11 +5557,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6110 "util/configparser.c"
+#line 5561 "util/configparser.c"
     break;
 
-  case 485:
-#line 2455 "./util/configparser.y"
+  case 498: /* server_pad_responses: VAR_PAD_RESPONSES STRING_ARG  */
+#line 2524 "./util/configparser.y"
         {
 		OUTYY(("P(server_pad_responses:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6119,11 +5570,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6123 "util/configparser.c"
+#line 5574 "util/configparser.c"
     break;
 
-  case 486:
-#line 2465 "./util/configparser.y"
+  case 499: /* server_pad_responses_block_size: VAR_PAD_RESPONSES_BLOCK_SIZE STRING_ARG  */
+#line 2534 "./util/configparser.y"
         {
 		OUTYY(("P(server_pad_responses_block_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -6131,11 +5582,11 @@ yyreduce:
 		else cfg_parser->cfg->pad_responses_block_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6135 "util/configparser.c"
+#line 5586 "util/configparser.c"
     break;
 
-  case 487:
-#line 2474 "./util/configparser.y"
+  case 500: /* server_pad_queries: VAR_PAD_QUERIES STRING_ARG  */
+#line 2543 "./util/configparser.y"
         {
 		OUTYY(("P(server_pad_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6144,11 +5595,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6148 "util/configparser.c"
+#line 5599 "util/configparser.c"
     break;
 
-  case 488:
-#line 2484 "./util/configparser.y"
+  case 501: /* server_pad_queries_block_size: VAR_PAD_QUERIES_BLOCK_SIZE STRING_ARG  */
+#line 2553 "./util/configparser.y"
         {
 		OUTYY(("P(server_pad_queries_block_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -6156,11 +5607,11 @@ yyreduce:
 		else cfg_parser->cfg->pad_queries_block_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6160 "util/configparser.c"
+#line 5611 "util/configparser.c"
     break;
 
-  case 489:
-#line 2493 "./util/configparser.y"
+  case 502: /* server_ipsecmod_enabled: VAR_IPSECMOD_ENABLED STRING_ARG  */
+#line 2562 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_enabled:%s)\n", (yyvsp[0].str)));
@@ -6172,11 +5623,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 6176 "util/configparser.c"
+#line 5627 "util/configparser.c"
     break;
 
-  case 490:
-#line 2506 "./util/configparser.y"
+  case 503: /* server_ipsecmod_ignore_bogus: VAR_IPSECMOD_IGNORE_BOGUS STRING_ARG  */
+#line 2575 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_ignore_bogus:%s)\n", (yyvsp[0].str)));
@@ -6188,11 +5639,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 6192 "util/configparser.c"
+#line 5643 "util/configparser.c"
     break;
 
-  case 491:
-#line 2519 "./util/configparser.y"
+  case 504: /* server_ipsecmod_hook: VAR_IPSECMOD_HOOK STRING_ARG  */
+#line 2588 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_hook:%s)\n", (yyvsp[0].str)));
@@ -6203,11 +5654,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 6207 "util/configparser.c"
+#line 5658 "util/configparser.c"
     break;
 
-  case 492:
-#line 2531 "./util/configparser.y"
+  case 505: /* server_ipsecmod_max_ttl: VAR_IPSECMOD_MAX_TTL STRING_ARG  */
+#line 2600 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_max_ttl:%s)\n", (yyvsp[0].str)));
@@ -6220,11 +5671,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 6224 "util/configparser.c"
+#line 5675 "util/configparser.c"
     break;
 
-  case 493:
-#line 2545 "./util/configparser.y"
+  case 506: /* server_ipsecmod_whitelist: VAR_IPSECMOD_WHITELIST STRING_ARG  */
+#line 2614 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_whitelist:%s)\n", (yyvsp[0].str)));
@@ -6235,11 +5686,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 6239 "util/configparser.c"
+#line 5690 "util/configparser.c"
     break;
 
-  case 494:
-#line 2557 "./util/configparser.y"
+  case 507: /* server_ipsecmod_strict: VAR_IPSECMOD_STRICT STRING_ARG  */
+#line 2626 "./util/configparser.y"
         {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_strict:%s)\n", (yyvsp[0].str)));
@@ -6252,11 +5703,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 6256 "util/configparser.c"
+#line 5707 "util/configparser.c"
     break;
 
-  case 495:
-#line 2571 "./util/configparser.y"
+  case 508: /* server_edns_client_string: VAR_EDNS_CLIENT_STRING STRING_ARG STRING_ARG  */
+#line 2640 "./util/configparser.y"
         {
 		OUTYY(("P(server_edns_client_string:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(
@@ -6264,11 +5715,11 @@ yyreduce:
 			fatal_exit("out of memory adding "
 				"edns-client-string");
 	}
-#line 6268 "util/configparser.c"
+#line 5719 "util/configparser.c"
     break;
 
-  case 496:
-#line 2580 "./util/configparser.y"
+  case 509: /* server_edns_client_string_opcode: VAR_EDNS_CLIENT_STRING_OPCODE STRING_ARG  */
+#line 2649 "./util/configparser.y"
         {
 		OUTYY(("P(edns_client_string_opcode:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -6279,11 +5730,11 @@ yyreduce:
 		free((yyvsp[0].str));
 
 	}
-#line 6283 "util/configparser.c"
+#line 5734 "util/configparser.c"
     break;
 
-  case 497:
-#line 2592 "./util/configparser.y"
+  case 510: /* stub_name: VAR_NAME STRING_ARG  */
+#line 2661 "./util/configparser.y"
         {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
@@ -6292,31 +5743,31 @@ yyreduce:
 		free(cfg_parser->cfg->stubs->name);
 		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
-#line 6296 "util/configparser.c"
+#line 5747 "util/configparser.c"
     break;
 
-  case 498:
-#line 2602 "./util/configparser.y"
+  case 511: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 2671 "./util/configparser.y"
         {
 		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6306 "util/configparser.c"
+#line 5757 "util/configparser.c"
     break;
 
-  case 499:
-#line 2609 "./util/configparser.y"
+  case 512: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 2678 "./util/configparser.y"
         {
 		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6316 "util/configparser.c"
+#line 5767 "util/configparser.c"
     break;
 
-  case 500:
-#line 2616 "./util/configparser.y"
+  case 513: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 2685 "./util/configparser.y"
         {
 		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6324,11 +5775,11 @@ yyreduce:
 		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6328 "util/configparser.c"
+#line 5779 "util/configparser.c"
     break;
 
-  case 501:
-#line 2625 "./util/configparser.y"
+  case 514: /* stub_no_cache: VAR_STUB_NO_CACHE STRING_ARG  */
+#line 2694 "./util/configparser.y"
         {
 		OUTYY(("P(stub-no-cache:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6336,11 +5787,11 @@ yyreduce:
 		else cfg_parser->cfg->stubs->no_cache=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6340 "util/configparser.c"
+#line 5791 "util/configparser.c"
     break;
 
-  case 502:
-#line 2634 "./util/configparser.y"
+  case 515: /* stub_ssl_upstream: VAR_STUB_SSL_UPSTREAM STRING_ARG  */
+#line 2703 "./util/configparser.y"
         {
 		OUTYY(("P(stub-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6349,11 +5800,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6353 "util/configparser.c"
+#line 5804 "util/configparser.c"
     break;
 
-  case 503:
-#line 2644 "./util/configparser.y"
+  case 516: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 2713 "./util/configparser.y"
         {
 		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6362,11 +5813,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6366 "util/configparser.c"
+#line 5817 "util/configparser.c"
     break;
 
-  case 504:
-#line 2654 "./util/configparser.y"
+  case 517: /* forward_name: VAR_NAME STRING_ARG  */
+#line 2723 "./util/configparser.y"
         {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
@@ -6375,31 +5826,31 @@ yyreduce:
 		free(cfg_parser->cfg->forwards->name);
 		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
-#line 6379 "util/configparser.c"
+#line 5830 "util/configparser.c"
     break;
 
-  case 505:
-#line 2664 "./util/configparser.y"
+  case 518: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 2733 "./util/configparser.y"
         {
 		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6389 "util/configparser.c"
+#line 5840 "util/configparser.c"
     break;
 
-  case 506:
-#line 2671 "./util/configparser.y"
+  case 519: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 2740 "./util/configparser.y"
         {
 		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6399 "util/configparser.c"
+#line 5850 "util/configparser.c"
     break;
 
-  case 507:
-#line 2678 "./util/configparser.y"
+  case 520: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 2747 "./util/configparser.y"
         {
 		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6407,11 +5858,11 @@ yyreduce:
 		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6411 "util/configparser.c"
+#line 5862 "util/configparser.c"
     break;
 
-  case 508:
-#line 2687 "./util/configparser.y"
+  case 521: /* forward_no_cache: VAR_FORWARD_NO_CACHE STRING_ARG  */
+#line 2756 "./util/configparser.y"
         {
 		OUTYY(("P(forward-no-cache:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6419,11 +5870,11 @@ yyreduce:
 		else cfg_parser->cfg->forwards->no_cache=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6423 "util/configparser.c"
+#line 5874 "util/configparser.c"
     break;
 
-  case 509:
-#line 2696 "./util/configparser.y"
+  case 522: /* forward_ssl_upstream: VAR_FORWARD_SSL_UPSTREAM STRING_ARG  */
+#line 2765 "./util/configparser.y"
         {
 		OUTYY(("P(forward-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6432,11 +5883,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6436 "util/configparser.c"
+#line 5887 "util/configparser.c"
     break;
 
-  case 510:
-#line 2706 "./util/configparser.y"
+  case 523: /* auth_name: VAR_NAME STRING_ARG  */
+#line 2775 "./util/configparser.y"
         {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->auths->name)
@@ -6445,52 +5896,52 @@ yyreduce:
 		free(cfg_parser->cfg->auths->name);
 		cfg_parser->cfg->auths->name = (yyvsp[0].str);
 	}
-#line 6449 "util/configparser.c"
+#line 5900 "util/configparser.c"
     break;
 
-  case 511:
-#line 2716 "./util/configparser.y"
+  case 524: /* auth_zonefile: VAR_ZONEFILE STRING_ARG  */
+#line 2785 "./util/configparser.y"
         {
 		OUTYY(("P(zonefile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->zonefile);
 		cfg_parser->cfg->auths->zonefile = (yyvsp[0].str);
 	}
-#line 6459 "util/configparser.c"
+#line 5910 "util/configparser.c"
     break;
 
-  case 512:
-#line 2723 "./util/configparser.y"
+  case 525: /* auth_master: VAR_MASTER STRING_ARG  */
+#line 2792 "./util/configparser.y"
         {
 		OUTYY(("P(master:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->masters, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6469 "util/configparser.c"
+#line 5920 "util/configparser.c"
     break;
 
-  case 513:
-#line 2730 "./util/configparser.y"
+  case 526: /* auth_url: VAR_URL STRING_ARG  */
+#line 2799 "./util/configparser.y"
         {
 		OUTYY(("P(url:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->urls, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6479 "util/configparser.c"
+#line 5930 "util/configparser.c"
     break;
 
-  case 514:
-#line 2737 "./util/configparser.y"
+  case 527: /* auth_allow_notify: VAR_ALLOW_NOTIFY STRING_ARG  */
+#line 2806 "./util/configparser.y"
         {
 		OUTYY(("P(allow-notify:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->allow_notify,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6490 "util/configparser.c"
+#line 5941 "util/configparser.c"
     break;
 
-  case 515:
-#line 2745 "./util/configparser.y"
+  case 528: /* auth_for_downstream: VAR_FOR_DOWNSTREAM STRING_ARG  */
+#line 2814 "./util/configparser.y"
         {
 		OUTYY(("P(for-downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6499,11 +5950,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6503 "util/configparser.c"
+#line 5954 "util/configparser.c"
     break;
 
-  case 516:
-#line 2755 "./util/configparser.y"
+  case 529: /* auth_for_upstream: VAR_FOR_UPSTREAM STRING_ARG  */
+#line 2824 "./util/configparser.y"
         {
 		OUTYY(("P(for-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6512,11 +5963,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6516 "util/configparser.c"
+#line 5967 "util/configparser.c"
     break;
 
-  case 517:
-#line 2765 "./util/configparser.y"
+  case 530: /* auth_fallback_enabled: VAR_FALLBACK_ENABLED STRING_ARG  */
+#line 2834 "./util/configparser.y"
         {
 		OUTYY(("P(fallback-enabled:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6525,11 +5976,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6529 "util/configparser.c"
+#line 5980 "util/configparser.c"
     break;
 
-  case 518:
-#line 2775 "./util/configparser.y"
+  case 531: /* auth_answer_cache_size: VAR_ANSWER_CACHE_SIZE STRING_ARG  */
+#line 2844 "./util/configparser.y"
+        {
+		OUTYY(("P(answer-cache-size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str),
+			&cfg_parser->cfg->auths->answer_cache_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 5992 "util/configparser.c"
+    break;
+
+  case 532: /* view_name: VAR_NAME STRING_ARG  */
+#line 2853 "./util/configparser.y"
         {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->views->name)
@@ -6538,11 +6001,11 @@ yyreduce:
 		free(cfg_parser->cfg->views->name);
 		cfg_parser->cfg->views->name = (yyvsp[0].str);
 	}
-#line 6542 "util/configparser.c"
+#line 6005 "util/configparser.c"
     break;
 
-  case 519:
-#line 2785 "./util/configparser.y"
+  case 533: /* view_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 2863 "./util/configparser.y"
         {
 		OUTYY(("P(view_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
@@ -6580,11 +6043,11 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 6584 "util/configparser.c"
+#line 6047 "util/configparser.c"
     break;
 
-  case 520:
-#line 2824 "./util/configparser.y"
+  case 534: /* view_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2902 "./util/configparser.y"
         {
 		OUTYY(("P(view_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
@@ -6593,33 +6056,33 @@ yyreduce:
 			fatal_exit("out of memory adding per-view "
 				"response-ip action");
 	}
-#line 6597 "util/configparser.c"
+#line 6060 "util/configparser.c"
     break;
 
-  case 521:
-#line 2834 "./util/configparser.y"
+  case 535: /* view_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 2912 "./util/configparser.y"
         {
 		OUTYY(("P(view_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(
 			&cfg_parser->cfg->views->respip_data, (yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 6608 "util/configparser.c"
+#line 6071 "util/configparser.c"
     break;
 
-  case 522:
-#line 2842 "./util/configparser.y"
+  case 536: /* view_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 2920 "./util/configparser.y"
         {
 		OUTYY(("P(view_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->views->local_data, (yyvsp[0].str))) {
 			fatal_exit("out of memory adding local-data");
 		}
 	}
-#line 6619 "util/configparser.c"
+#line 6082 "util/configparser.c"
     break;
 
-  case 523:
-#line 2850 "./util/configparser.y"
+  case 537: /* view_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 2928 "./util/configparser.y"
         {
 		char* ptr;
 		OUTYY(("P(view_local_data_ptr:%s)\n", (yyvsp[0].str)));
@@ -6633,11 +6096,11 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 6637 "util/configparser.c"
+#line 6100 "util/configparser.c"
     break;
 
-  case 524:
-#line 2865 "./util/configparser.y"
+  case 538: /* view_first: VAR_VIEW_FIRST STRING_ARG  */
+#line 2943 "./util/configparser.y"
         {
 		OUTYY(("P(view-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6645,19 +6108,19 @@ yyreduce:
 		else cfg_parser->cfg->views->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6649 "util/configparser.c"
+#line 6112 "util/configparser.c"
     break;
 
-  case 525:
-#line 2874 "./util/configparser.y"
+  case 539: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 2952 "./util/configparser.y"
         { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
-#line 6657 "util/configparser.c"
+#line 6120 "util/configparser.c"
     break;
 
-  case 536:
-#line 2885 "./util/configparser.y"
+  case 550: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 2963 "./util/configparser.y"
         {
 		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6666,11 +6129,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6670 "util/configparser.c"
+#line 6133 "util/configparser.c"
     break;
 
-  case 537:
-#line 2895 "./util/configparser.y"
+  case 551: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 2973 "./util/configparser.y"
         {
 		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -6678,79 +6141,79 @@ yyreduce:
 		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 6682 "util/configparser.c"
+#line 6145 "util/configparser.c"
     break;
 
-  case 538:
-#line 2904 "./util/configparser.y"
+  case 552: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 2982 "./util/configparser.y"
         {
 		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6692 "util/configparser.c"
+#line 6155 "util/configparser.c"
     break;
 
-  case 539:
-#line 2911 "./util/configparser.y"
+  case 553: /* rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG  */
+#line 2989 "./util/configparser.y"
         {
 		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->control_use_cert = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6702 "util/configparser.c"
+#line 6165 "util/configparser.c"
     break;
 
-  case 540:
-#line 2918 "./util/configparser.y"
+  case 554: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 2996 "./util/configparser.y"
         {
 		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
 		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
-#line 6712 "util/configparser.c"
+#line 6175 "util/configparser.c"
     break;
 
-  case 541:
-#line 2925 "./util/configparser.y"
+  case 555: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 3003 "./util/configparser.y"
         {
 		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
 		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
-#line 6722 "util/configparser.c"
+#line 6185 "util/configparser.c"
     break;
 
-  case 542:
-#line 2932 "./util/configparser.y"
+  case 556: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 3010 "./util/configparser.y"
         {
 		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
 		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
-#line 6732 "util/configparser.c"
+#line 6195 "util/configparser.c"
     break;
 
-  case 543:
-#line 2939 "./util/configparser.y"
+  case 557: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 3017 "./util/configparser.y"
         {
 		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
 		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
-#line 6742 "util/configparser.c"
+#line 6205 "util/configparser.c"
     break;
 
-  case 544:
-#line 2946 "./util/configparser.y"
+  case 558: /* dtstart: VAR_DNSTAP  */
+#line 3024 "./util/configparser.y"
         {
 		OUTYY(("\nP(dnstap:)\n"));
 	}
-#line 6750 "util/configparser.c"
+#line 6213 "util/configparser.c"
     break;
 
-  case 566:
-#line 2966 "./util/configparser.y"
+  case 585: /* dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG  */
+#line 3047 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6758,11 +6221,11 @@ yyreduce:
 		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6762 "util/configparser.c"
+#line 6225 "util/configparser.c"
     break;
 
-  case 567:
-#line 2975 "./util/configparser.y"
+  case 586: /* dt_dnstap_bidirectional: VAR_DNSTAP_BIDIRECTIONAL STRING_ARG  */
+#line 3056 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_bidirectional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6771,31 +6234,31 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6775 "util/configparser.c"
+#line 6238 "util/configparser.c"
     break;
 
-  case 568:
-#line 2985 "./util/configparser.y"
+  case 587: /* dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG  */
+#line 3066 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_socket_path);
 		cfg_parser->cfg->dnstap_socket_path = (yyvsp[0].str);
 	}
-#line 6785 "util/configparser.c"
+#line 6248 "util/configparser.c"
     break;
 
-  case 569:
-#line 2992 "./util/configparser.y"
+  case 588: /* dt_dnstap_ip: VAR_DNSTAP_IP STRING_ARG  */
+#line 3073 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_ip:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_ip);
 		cfg_parser->cfg->dnstap_ip = (yyvsp[0].str);
 	}
-#line 6795 "util/configparser.c"
+#line 6258 "util/configparser.c"
     break;
 
-  case 570:
-#line 2999 "./util/configparser.y"
+  case 589: /* dt_dnstap_tls: VAR_DNSTAP_TLS STRING_ARG  */
+#line 3080 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6803,51 +6266,51 @@ yyreduce:
 		else cfg_parser->cfg->dnstap_tls = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6807 "util/configparser.c"
+#line 6270 "util/configparser.c"
     break;
 
-  case 571:
-#line 3008 "./util/configparser.y"
+  case 590: /* dt_dnstap_tls_server_name: VAR_DNSTAP_TLS_SERVER_NAME STRING_ARG  */
+#line 3089 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls_server_name:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_tls_server_name);
 		cfg_parser->cfg->dnstap_tls_server_name = (yyvsp[0].str);
 	}
-#line 6817 "util/configparser.c"
+#line 6280 "util/configparser.c"
     break;
 
-  case 572:
-#line 3015 "./util/configparser.y"
+  case 591: /* dt_dnstap_tls_cert_bundle: VAR_DNSTAP_TLS_CERT_BUNDLE STRING_ARG  */
+#line 3096 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls_cert_bundle:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_tls_cert_bundle);
 		cfg_parser->cfg->dnstap_tls_cert_bundle = (yyvsp[0].str);
 	}
-#line 6827 "util/configparser.c"
+#line 6290 "util/configparser.c"
     break;
 
-  case 573:
-#line 3022 "./util/configparser.y"
+  case 592: /* dt_dnstap_tls_client_key_file: VAR_DNSTAP_TLS_CLIENT_KEY_FILE STRING_ARG  */
+#line 3103 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls_client_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_tls_client_key_file);
 		cfg_parser->cfg->dnstap_tls_client_key_file = (yyvsp[0].str);
 	}
-#line 6837 "util/configparser.c"
+#line 6300 "util/configparser.c"
     break;
 
-  case 574:
-#line 3029 "./util/configparser.y"
+  case 593: /* dt_dnstap_tls_client_cert_file: VAR_DNSTAP_TLS_CLIENT_CERT_FILE STRING_ARG  */
+#line 3110 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_tls_client_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_tls_client_cert_file);
 		cfg_parser->cfg->dnstap_tls_client_cert_file = (yyvsp[0].str);
 	}
-#line 6847 "util/configparser.c"
+#line 6310 "util/configparser.c"
     break;
 
-  case 575:
-#line 3036 "./util/configparser.y"
+  case 594: /* dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG  */
+#line 3117 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6855,11 +6318,11 @@ yyreduce:
 		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6859 "util/configparser.c"
+#line 6322 "util/configparser.c"
     break;
 
-  case 576:
-#line 3045 "./util/configparser.y"
+  case 595: /* dt_dnstap_send_version: VAR_DNSTAP_SEND_VERSION STRING_ARG  */
+#line 3126 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6867,31 +6330,31 @@ yyreduce:
 		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6871 "util/configparser.c"
+#line 6334 "util/configparser.c"
     break;
 
-  case 577:
-#line 3054 "./util/configparser.y"
+  case 596: /* dt_dnstap_identity: VAR_DNSTAP_IDENTITY STRING_ARG  */
+#line 3135 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_identity);
 		cfg_parser->cfg->dnstap_identity = (yyvsp[0].str);
 	}
-#line 6881 "util/configparser.c"
+#line 6344 "util/configparser.c"
     break;
 
-  case 578:
-#line 3061 "./util/configparser.y"
+  case 597: /* dt_dnstap_version: VAR_DNSTAP_VERSION STRING_ARG  */
+#line 3142 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_version);
 		cfg_parser->cfg->dnstap_version = (yyvsp[0].str);
 	}
-#line 6891 "util/configparser.c"
+#line 6354 "util/configparser.c"
     break;
 
-  case 579:
-#line 3068 "./util/configparser.y"
+  case 598: /* dt_dnstap_log_resolver_query_messages: VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 3149 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6900,11 +6363,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6904 "util/configparser.c"
+#line 6367 "util/configparser.c"
     break;
 
-  case 580:
-#line 3078 "./util/configparser.y"
+  case 599: /* dt_dnstap_log_resolver_response_messages: VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 3159 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6913,11 +6376,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6917 "util/configparser.c"
+#line 6380 "util/configparser.c"
     break;
 
-  case 581:
-#line 3088 "./util/configparser.y"
+  case 600: /* dt_dnstap_log_client_query_messages: VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 3169 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6926,11 +6389,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6930 "util/configparser.c"
+#line 6393 "util/configparser.c"
     break;
 
-  case 582:
-#line 3098 "./util/configparser.y"
+  case 601: /* dt_dnstap_log_client_response_messages: VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 3179 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6939,11 +6402,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6943 "util/configparser.c"
+#line 6406 "util/configparser.c"
     break;
 
-  case 583:
-#line 3108 "./util/configparser.y"
+  case 602: /* dt_dnstap_log_forwarder_query_messages: VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 3189 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6952,11 +6415,11 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6956 "util/configparser.c"
+#line 6419 "util/configparser.c"
     break;
 
-  case 584:
-#line 3118 "./util/configparser.y"
+  case 603: /* dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 3199 "./util/configparser.y"
         {
 		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -6965,47 +6428,108 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 6969 "util/configparser.c"
+#line 6432 "util/configparser.c"
+    break;
+
+  case 604: /* dt_dnstap_sample_rate: VAR_DNSTAP_SAMPLE_RATE STRING_ARG  */
+#line 3209 "./util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_rate:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("dnstap-sample-rate cannot be negative");
+		else cfg_parser->cfg->dnstap_sample_rate = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 6446 "util/configparser.c"
+    break;
+
+  case 605: /* dt_dnstap_filter_qtype: VAR_DNSTAP_FILTER_QTYPE STRING_ARG  */
+#line 3220 "./util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_filter_qtype:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->dnstap_filter_qtype);
+		cfg_parser->cfg->dnstap_filter_qtype = (yyvsp[0].str);
+	}
+#line 6456 "util/configparser.c"
+    break;
+
+  case 606: /* dt_dnstap_filter_rcode: VAR_DNSTAP_FILTER_RCODE STRING_ARG  */
+#line 3227 "./util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_filter_rcode:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->dnstap_filter_rcode);
+		cfg_parser->cfg->dnstap_filter_rcode = (yyvsp[0].str);
+	}
+#line 6466 "util/configparser.c"
+    break;
+
+  case 607: /* dt_dnstap_filter_local_zone: VAR_DNSTAP_FILTER_LOCAL_ZONE STRING_ARG  */
+#line 3234 "./util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_filter_local_zone:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->dnstap_filter_local_zone =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 6479 "util/configparser.c"
+    break;
+
+  case 608: /* dt_dnstap_filter_response_time: VAR_DNSTAP_FILTER_RESPONSE_TIME STRING_ARG  */
+#line 3244 "./util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_filter_response_time:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0)
+			yyerror("dnstap-filter-response-time cannot be negative");
+		else cfg_parser->cfg->dnstap_filter_response_time = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 6493 "util/configparser.c"
     break;
 
-  case 585:
-#line 3128 "./util/configparser.y"
+  case 609: /* pythonstart: VAR_PYTHON  */
+#line 3255 "./util/configparser.y"
         { 
 		OUTYY(("\nP(python:)\n")); 
 	}
-#line 6977 "util/configparser.c"
+#line 6501 "util/configparser.c"
     break;
 
-  case 589:
-#line 3137 "./util/configparser.y"
+  case 613: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 3264 "./util/configparser.y"
         {
 		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append_ex(&cfg_parser->cfg->python_script, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 6987 "util/configparser.c"
+#line 6511 "util/configparser.c"
     break;
 
-  case 590:
-#line 3143 "./util/configparser.y"
+  case 614: /* dynlibstart: VAR_DYNLIB  */
+#line 3270 "./util/configparser.y"
         { 
 		OUTYY(("\nP(dynlib:)\n")); 
 	}
-#line 6995 "util/configparser.c"
+#line 6519 "util/configparser.c"
     break;
 
-  case 594:
-#line 3152 "./util/configparser.y"
+  case 618: /* dl_file: VAR_DYNLIB_FILE STRING_ARG  */
+#line 3279 "./util/configparser.y"
         {
 		OUTYY(("P(dynlib-file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_append_ex(&cfg_parser->cfg->dynlib_file, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 7005 "util/configparser.c"
+#line 6529 "util/configparser.c"
     break;
 
-  case 595:
-#line 3158 "./util/configparser.y"
+  case 619: /* server_disable_dnssec_lame_check: VAR_DISABLE_DNSSEC_LAME_CHECK STRING_ARG  */
+#line 3285 "./util/configparser.y"
         {
 		OUTYY(("P(disable_dnssec_lame_check:%s)\n", (yyvsp[0].str)));
 		if (strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7014,21 +6538,21 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7018 "util/configparser.c"
+#line 6542 "util/configparser.c"
     break;
 
-  case 596:
-#line 3168 "./util/configparser.y"
+  case 620: /* server_log_identity: VAR_LOG_IDENTITY STRING_ARG  */
+#line 3295 "./util/configparser.y"
         {
 		OUTYY(("P(server_log_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->log_identity);
 		cfg_parser->cfg->log_identity = (yyvsp[0].str);
 	}
-#line 7028 "util/configparser.c"
+#line 6552 "util/configparser.c"
     break;
 
-  case 597:
-#line 3175 "./util/configparser.y"
+  case 621: /* server_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 3302 "./util/configparser.y"
         {
 		OUTYY(("P(server_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
@@ -7036,30 +6560,30 @@ yyreduce:
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip");
 	}
-#line 7040 "util/configparser.c"
+#line 6564 "util/configparser.c"
     break;
 
-  case 598:
-#line 3184 "./util/configparser.y"
+  case 622: /* server_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 3311 "./util/configparser.y"
         {
 		OUTYY(("P(server_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->respip_data,
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 7051 "util/configparser.c"
+#line 6575 "util/configparser.c"
     break;
 
-  case 599:
-#line 3192 "./util/configparser.y"
+  case 623: /* dnscstart: VAR_DNSCRYPT  */
+#line 3319 "./util/configparser.y"
         {
 		OUTYY(("\nP(dnscrypt:)\n"));
 	}
-#line 7059 "util/configparser.c"
+#line 6583 "util/configparser.c"
     break;
 
-  case 612:
-#line 3208 "./util/configparser.y"
+  case 636: /* dnsc_dnscrypt_enable: VAR_DNSCRYPT_ENABLE STRING_ARG  */
+#line 3335 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -7067,11 +6591,11 @@ yyreduce:
 		else cfg_parser->cfg->dnscrypt = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 7071 "util/configparser.c"
+#line 6595 "util/configparser.c"
     break;
 
-  case 613:
-#line 3218 "./util/configparser.y"
+  case 637: /* dnsc_dnscrypt_port: VAR_DNSCRYPT_PORT STRING_ARG  */
+#line 3345 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -7079,21 +6603,21 @@ yyreduce:
 		else cfg_parser->cfg->dnscrypt_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 7083 "util/configparser.c"
+#line 6607 "util/configparser.c"
     break;
 
-  case 614:
-#line 3227 "./util/configparser.y"
+  case 638: /* dnsc_dnscrypt_provider: VAR_DNSCRYPT_PROVIDER STRING_ARG  */
+#line 3354 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_provider:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnscrypt_provider);
 		cfg_parser->cfg->dnscrypt_provider = (yyvsp[0].str);
 	}
-#line 7093 "util/configparser.c"
+#line 6617 "util/configparser.c"
     break;
 
-  case 615:
-#line 3234 "./util/configparser.y"
+  case 639: /* dnsc_dnscrypt_provider_cert: VAR_DNSCRYPT_PROVIDER_CERT STRING_ARG  */
+#line 3361 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
@@ -7101,21 +6625,21 @@ yyreduce:
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert");
 	}
-#line 7105 "util/configparser.c"
+#line 6629 "util/configparser.c"
     break;
 
-  case 616:
-#line 3243 "./util/configparser.y"
+  case 640: /* dnsc_dnscrypt_provider_cert_rotated: VAR_DNSCRYPT_PROVIDER_CERT_ROTATED STRING_ARG  */
+#line 3370 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert_rotated:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert_rotated, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert-rotated");
 	}
-#line 7115 "util/configparser.c"
+#line 6639 "util/configparser.c"
     break;
 
-  case 617:
-#line 3250 "./util/configparser.y"
+  case 641: /* dnsc_dnscrypt_secret_key: VAR_DNSCRYPT_SECRET_KEY STRING_ARG  */
+#line 3377 "./util/configparser.y"
         {
 		OUTYY(("P(dnsc_dnscrypt_secret_key:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
@@ -7123,22 +6647,22 @@ yyreduce:
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-secret-key");
 	}
-#line 7127 "util/configparser.c"
+#line 6651 "util/configparser.c"
     break;
 
-  case 618:
-#line 3259 "./util/configparser.y"
+  case 642: /* dnsc_dnscrypt_shared_secret_cache_size: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE STRING_ARG  */
+#line 3386 "./util/configparser.y"
   {
   	OUTYY(("P(dnscrypt_shared_secret_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_shared_secret_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 7138 "util/configparser.c"
+#line 6662 "util/configparser.c"
     break;
 
-  case 619:
-#line 3267 "./util/configparser.y"
+  case 643: /* dnsc_dnscrypt_shared_secret_cache_slabs: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS STRING_ARG  */
+#line 3394 "./util/configparser.y"
   {
   	OUTYY(("P(dnscrypt_shared_secret_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
@@ -7150,22 +6674,22 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 7154 "util/configparser.c"
+#line 6678 "util/configparser.c"
     break;
 
-  case 620:
-#line 3280 "./util/configparser.y"
+  case 644: /* dnsc_dnscrypt_nonce_cache_size: VAR_DNSCRYPT_NONCE_CACHE_SIZE STRING_ARG  */
+#line 3407 "./util/configparser.y"
   {
   	OUTYY(("P(dnscrypt_nonce_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_nonce_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 7165 "util/configparser.c"
+#line 6689 "util/configparser.c"
     break;
 
-  case 621:
-#line 3288 "./util/configparser.y"
+  case 645: /* dnsc_dnscrypt_nonce_cache_slabs: VAR_DNSCRYPT_NONCE_CACHE_SLABS STRING_ARG  */
+#line 3415 "./util/configparser.y"
   {
   	OUTYY(("P(dnscrypt_nonce_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
@@ -7177,19 +6701,19 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 7181 "util/configparser.c"
+#line 6705 "util/configparser.c"
     break;
 
-  case 622:
-#line 3301 "./util/configparser.y"
+  case 646: /* cachedbstart: VAR_CACHEDB  */
+#line 3428 "./util/configparser.y"
         {
 		OUTYY(("\nP(cachedb:)\n"));
 	}
-#line 7189 "util/configparser.c"
+#line 6713 "util/configparser.c"
     break;
 
-  case 631:
-#line 3312 "./util/configparser.y"
+  case 659: /* cachedb_backend_name: VAR_CACHEDB_BACKEND STRING_ARG  */
+#line 3441 "./util/configparser.y"
         {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(backend:%s)\n", (yyvsp[0].str)));
@@ -7200,11 +6724,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 7204 "util/configparser.c"
+#line 6728 "util/configparser.c"
     break;
 
-  case 632:
-#line 3324 "./util/configparser.y"
+  case 660: /* cachedb_secret_seed: VAR_CACHEDB_SECRETSEED STRING_ARG  */
+#line 3453 "./util/configparser.y"
         {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(secret-seed:%s)\n", (yyvsp[0].str)));
@@ -7215,11 +6739,73 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 7219 "util/configparser.c"
+#line 6743 "util/configparser.c"
+    break;
+
+  case 661: /* cachedb_write_behind_size: VAR_CACHEDB_WRITEBEHINDSIZE STRING_ARG  */
+#line 3465 "./util/configparser.y"
+        {
+	#ifdef USE_CACHEDB
+		OUTYY(("P(write-behind-size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cachedb_write_behind_size = atoi((yyvsp[0].str));
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+	#endif
+		free((yyvsp[0].str));
+	}
+#line 6759 "util/configparser.c"
+    break;
+
+  case 662: /* cachedb_write_behind_interval: VAR_CACHEDB_WRITEBEHINDINTERVAL STRING_ARG  */
+#line 3478 "./util/configparser.y"
+        {
+	#ifdef USE_CACHEDB
+		OUTYY(("P(write-behind-interval:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("write-behind interval value expected");
+		else cfg_parser->cfg->cachedb_write_behind_interval = atoi((yyvsp[0].str));
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+	#endif
+		free((yyvsp[0].str));
+	}
+#line 6775 "util/configparser.c"
+    break;
+
+  case 663: /* cachedb_mmap_file: VAR_CACHEDB_MMAPFILE STRING_ARG  */
+#line 3491 "./util/configparser.y"
+        {
+	#ifdef USE_CACHEDB
+		OUTYY(("P(mmap-file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->cachedb_mmap_file);
+		cfg_parser->cfg->cachedb_mmap_file = (yyvsp[0].str);
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+		free((yyvsp[0].str));
+	#endif
+	}
+#line 6790 "util/configparser.c"
+    break;
+
+  case 664: /* cachedb_mmap_size: VAR_CACHEDB_MMAPSIZE STRING_ARG  */
+#line 3503 "./util/configparser.y"
+        {
+	#ifdef USE_CACHEDB
+		OUTYY(("P(mmap-size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->cachedb_mmap_size))
+			yyerror("memory size expected");
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+	#endif
+		free((yyvsp[0].str));
+	}
+#line 6805 "util/configparser.c"
     break;
 
-  case 633:
-#line 3336 "./util/configparser.y"
+  case 665: /* redis_server_host: VAR_CACHEDB_REDISHOST STRING_ARG  */
+#line 3515 "./util/configparser.y"
         {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_server_host:%s)\n", (yyvsp[0].str)));
@@ -7230,11 +6816,11 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 7234 "util/configparser.c"
+#line 6820 "util/configparser.c"
     break;
 
-  case 634:
-#line 3348 "./util/configparser.y"
+  case 666: /* redis_server_port: VAR_CACHEDB_REDISPORT STRING_ARG  */
+#line 3527 "./util/configparser.y"
         {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		int port;
@@ -7248,11 +6834,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 7252 "util/configparser.c"
+#line 6838 "util/configparser.c"
     break;
 
-  case 635:
-#line 3363 "./util/configparser.y"
+  case 667: /* redis_timeout: VAR_CACHEDB_REDISTIMEOUT STRING_ARG  */
+#line 3542 "./util/configparser.y"
         {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_timeout:%s)\n", (yyvsp[0].str)));
@@ -7264,11 +6850,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 7268 "util/configparser.c"
+#line 6854 "util/configparser.c"
     break;
 
-  case 636:
-#line 3376 "./util/configparser.y"
+  case 668: /* redis_expire_records: VAR_CACHEDB_REDISEXPIRERECORDS STRING_ARG  */
+#line 3555 "./util/configparser.y"
         {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_expire_records:%s)\n", (yyvsp[0].str)));
@@ -7280,11 +6866,11 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 7284 "util/configparser.c"
+#line 6870 "util/configparser.c"
     break;
 
-  case 637:
-#line 3389 "./util/configparser.y"
+  case 669: /* server_tcp_connection_limit: VAR_TCP_CONNECTION_LIMIT STRING_ARG STRING_ARG  */
+#line 3568 "./util/configparser.y"
         {
 		OUTYY(("P(server_tcp_connection_limit:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if (atoi((yyvsp[0].str)) < 0)
@@ -7294,19 +6880,19 @@ yyreduce:
 				fatal_exit("out of memory adding tcp connection limit");
 		}
 	}
-#line 7298 "util/configparser.c"
+#line 6884 "util/configparser.c"
     break;
 
-  case 638:
-#line 3400 "./util/configparser.y"
+  case 670: /* ipsetstart: VAR_IPSET  */
+#line 3579 "./util/configparser.y"
                 {
 			OUTYY(("\nP(ipset:)\n"));
 		}
-#line 7306 "util/configparser.c"
+#line 6892 "util/configparser.c"
     break;
 
-  case 643:
-#line 3409 "./util/configparser.y"
+  case 675: /* ipset_name_v4: VAR_IPSET_NAME_V4 STRING_ARG  */
+#line 3588 "./util/configparser.y"
                 {
 		#ifdef USE_IPSET
 			OUTYY(("P(name-v4:%s)\n", (yyvsp[0].str)));
@@ -7320,11 +6906,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		#endif
 		}
-#line 7324 "util/configparser.c"
+#line 6910 "util/configparser.c"
     break;
 
-  case 644:
-#line 3424 "./util/configparser.y"
+  case 676: /* ipset_name_v6: VAR_IPSET_NAME_V6 STRING_ARG  */
+#line 3603 "./util/configparser.y"
         {
 		#ifdef USE_IPSET
 			OUTYY(("P(name-v6:%s)\n", (yyvsp[0].str)));
@@ -7338,11 +6924,11 @@ yyreduce:
 			free((yyvsp[0].str));
 		#endif
 		}
-#line 7342 "util/configparser.c"
+#line 6928 "util/configparser.c"
     break;
 
 
-#line 7346 "util/configparser.c"
+#line 6932 "util/configparser.c"
 
       default: break;
     }
@@ -7424,6 +7010,7 @@ yyerrorlab:
      label yyerrorlab therefore never appears in user code.  */
   if (0)
     YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -7484,7 +7071,7 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
 /*-----------------------------------.
@@ -7492,24 +7079,22 @@ yyacceptlab:
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
 
-#if !defined yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
 
-/*-----------------------------------------------------.
-| yyreturn -- parsing is finished, return the result.  |
-`-----------------------------------------------------*/
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -7536,7 +7121,7 @@ yyreturn:
   return yyresult;
 }
 
-#line 3438 "./util/configparser.y"
+#line 3617 "./util/configparser.y"
 
 
 /* parse helper routines could be here */
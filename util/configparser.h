@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.6.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -233,137 +233,154 @@ extern int yydebug;
     VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 434, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
     VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 435, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
     VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 436, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
-    VAR_RESPONSE_IP_TAG = 437,     /* VAR_RESPONSE_IP_TAG  */
-    VAR_RESPONSE_IP = 438,         /* VAR_RESPONSE_IP  */
-    VAR_RESPONSE_IP_DATA = 439,    /* VAR_RESPONSE_IP_DATA  */
-    VAR_HARDEN_ALGO_DOWNGRADE = 440, /* VAR_HARDEN_ALGO_DOWNGRADE  */
-    VAR_IP_TRANSPARENT = 441,      /* VAR_IP_TRANSPARENT  */
-    VAR_IP_DSCP = 442,             /* VAR_IP_DSCP  */
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 443, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
-    VAR_IP_RATELIMIT = 444,        /* VAR_IP_RATELIMIT  */
-    VAR_IP_RATELIMIT_SLABS = 445,  /* VAR_IP_RATELIMIT_SLABS  */
-    VAR_IP_RATELIMIT_SIZE = 446,   /* VAR_IP_RATELIMIT_SIZE  */
-    VAR_RATELIMIT = 447,           /* VAR_RATELIMIT  */
-    VAR_RATELIMIT_SLABS = 448,     /* VAR_RATELIMIT_SLABS  */
-    VAR_RATELIMIT_SIZE = 449,      /* VAR_RATELIMIT_SIZE  */
-    VAR_RATELIMIT_FOR_DOMAIN = 450, /* VAR_RATELIMIT_FOR_DOMAIN  */
-    VAR_RATELIMIT_BELOW_DOMAIN = 451, /* VAR_RATELIMIT_BELOW_DOMAIN  */
-    VAR_IP_RATELIMIT_FACTOR = 452, /* VAR_IP_RATELIMIT_FACTOR  */
-    VAR_RATELIMIT_FACTOR = 453,    /* VAR_RATELIMIT_FACTOR  */
-    VAR_SEND_CLIENT_SUBNET = 454,  /* VAR_SEND_CLIENT_SUBNET  */
-    VAR_CLIENT_SUBNET_ZONE = 455,  /* VAR_CLIENT_SUBNET_ZONE  */
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 456, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
-    VAR_CLIENT_SUBNET_OPCODE = 457, /* VAR_CLIENT_SUBNET_OPCODE  */
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 458, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 459, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
-    VAR_MIN_CLIENT_SUBNET_IPV4 = 460, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
-    VAR_MIN_CLIENT_SUBNET_IPV6 = 461, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
-    VAR_MAX_ECS_TREE_SIZE_IPV4 = 462, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
-    VAR_MAX_ECS_TREE_SIZE_IPV6 = 463, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
-    VAR_CAPS_WHITELIST = 464,      /* VAR_CAPS_WHITELIST  */
-    VAR_CACHE_MAX_NEGATIVE_TTL = 465, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
-    VAR_PERMIT_SMALL_HOLDDOWN = 466, /* VAR_PERMIT_SMALL_HOLDDOWN  */
-    VAR_QNAME_MINIMISATION = 467,  /* VAR_QNAME_MINIMISATION  */
-    VAR_QNAME_MINIMISATION_STRICT = 468, /* VAR_QNAME_MINIMISATION_STRICT  */
-    VAR_IP_FREEBIND = 469,         /* VAR_IP_FREEBIND  */
-    VAR_DEFINE_TAG = 470,          /* VAR_DEFINE_TAG  */
-    VAR_LOCAL_ZONE_TAG = 471,      /* VAR_LOCAL_ZONE_TAG  */
-    VAR_ACCESS_CONTROL_TAG = 472,  /* VAR_ACCESS_CONTROL_TAG  */
-    VAR_LOCAL_ZONE_OVERRIDE = 473, /* VAR_LOCAL_ZONE_OVERRIDE  */
-    VAR_ACCESS_CONTROL_TAG_ACTION = 474, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
-    VAR_ACCESS_CONTROL_TAG_DATA = 475, /* VAR_ACCESS_CONTROL_TAG_DATA  */
-    VAR_VIEW = 476,                /* VAR_VIEW  */
-    VAR_ACCESS_CONTROL_VIEW = 477, /* VAR_ACCESS_CONTROL_VIEW  */
-    VAR_VIEW_FIRST = 478,          /* VAR_VIEW_FIRST  */
-    VAR_SERVE_EXPIRED = 479,       /* VAR_SERVE_EXPIRED  */
-    VAR_SERVE_EXPIRED_TTL = 480,   /* VAR_SERVE_EXPIRED_TTL  */
-    VAR_SERVE_EXPIRED_TTL_RESET = 481, /* VAR_SERVE_EXPIRED_TTL_RESET  */
-    VAR_SERVE_EXPIRED_REPLY_TTL = 482, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
-    VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 483, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
-    VAR_SERVE_ORIGINAL_TTL = 484,  /* VAR_SERVE_ORIGINAL_TTL  */
-    VAR_FAKE_DSA = 485,            /* VAR_FAKE_DSA  */
-    VAR_FAKE_SHA1 = 486,           /* VAR_FAKE_SHA1  */
-    VAR_LOG_IDENTITY = 487,        /* VAR_LOG_IDENTITY  */
-    VAR_HIDE_TRUSTANCHOR = 488,    /* VAR_HIDE_TRUSTANCHOR  */
-    VAR_TRUST_ANCHOR_SIGNALING = 489, /* VAR_TRUST_ANCHOR_SIGNALING  */
-    VAR_AGGRESSIVE_NSEC = 490,     /* VAR_AGGRESSIVE_NSEC  */
-    VAR_USE_SYSTEMD = 491,         /* VAR_USE_SYSTEMD  */
-    VAR_SHM_ENABLE = 492,          /* VAR_SHM_ENABLE  */
-    VAR_SHM_KEY = 493,             /* VAR_SHM_KEY  */
-    VAR_ROOT_KEY_SENTINEL = 494,   /* VAR_ROOT_KEY_SENTINEL  */
-    VAR_DNSCRYPT = 495,            /* VAR_DNSCRYPT  */
-    VAR_DNSCRYPT_ENABLE = 496,     /* VAR_DNSCRYPT_ENABLE  */
-    VAR_DNSCRYPT_PORT = 497,       /* VAR_DNSCRYPT_PORT  */
-    VAR_DNSCRYPT_PROVIDER = 498,   /* VAR_DNSCRYPT_PROVIDER  */
-    VAR_DNSCRYPT_SECRET_KEY = 499, /* VAR_DNSCRYPT_SECRET_KEY  */
-    VAR_DNSCRYPT_PROVIDER_CERT = 500, /* VAR_DNSCRYPT_PROVIDER_CERT  */
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 501, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 502, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 503, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 504, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 505, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
-    VAR_PAD_RESPONSES = 506,       /* VAR_PAD_RESPONSES  */
-    VAR_PAD_RESPONSES_BLOCK_SIZE = 507, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
-    VAR_PAD_QUERIES = 508,         /* VAR_PAD_QUERIES  */
-    VAR_PAD_QUERIES_BLOCK_SIZE = 509, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
-    VAR_IPSECMOD_ENABLED = 510,    /* VAR_IPSECMOD_ENABLED  */
-    VAR_IPSECMOD_HOOK = 511,       /* VAR_IPSECMOD_HOOK  */
-    VAR_IPSECMOD_IGNORE_BOGUS = 512, /* VAR_IPSECMOD_IGNORE_BOGUS  */
-    VAR_IPSECMOD_MAX_TTL = 513,    /* VAR_IPSECMOD_MAX_TTL  */
-    VAR_IPSECMOD_WHITELIST = 514,  /* VAR_IPSECMOD_WHITELIST  */
-    VAR_IPSECMOD_STRICT = 515,     /* VAR_IPSECMOD_STRICT  */
-    VAR_CACHEDB = 516,             /* VAR_CACHEDB  */
-    VAR_CACHEDB_BACKEND = 517,     /* VAR_CACHEDB_BACKEND  */
-    VAR_CACHEDB_SECRETSEED = 518,  /* VAR_CACHEDB_SECRETSEED  */
-    VAR_CACHEDB_REDISHOST = 519,   /* VAR_CACHEDB_REDISHOST  */
-    VAR_CACHEDB_REDISPORT = 520,   /* VAR_CACHEDB_REDISPORT  */
-    VAR_CACHEDB_REDISTIMEOUT = 521, /* VAR_CACHEDB_REDISTIMEOUT  */
-    VAR_CACHEDB_REDISEXPIRERECORDS = 522, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 523, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
-    VAR_FOR_UPSTREAM = 524,        /* VAR_FOR_UPSTREAM  */
-    VAR_AUTH_ZONE = 525,           /* VAR_AUTH_ZONE  */
-    VAR_ZONEFILE = 526,            /* VAR_ZONEFILE  */
-    VAR_MASTER = 527,              /* VAR_MASTER  */
-    VAR_URL = 528,                 /* VAR_URL  */
-    VAR_FOR_DOWNSTREAM = 529,      /* VAR_FOR_DOWNSTREAM  */
-    VAR_FALLBACK_ENABLED = 530,    /* VAR_FALLBACK_ENABLED  */
-    VAR_TLS_ADDITIONAL_PORT = 531, /* VAR_TLS_ADDITIONAL_PORT  */
-    VAR_LOW_RTT = 532,             /* VAR_LOW_RTT  */
-    VAR_LOW_RTT_PERMIL = 533,      /* VAR_LOW_RTT_PERMIL  */
-    VAR_FAST_SERVER_PERMIL = 534,  /* VAR_FAST_SERVER_PERMIL  */
-    VAR_FAST_SERVER_NUM = 535,     /* VAR_FAST_SERVER_NUM  */
-    VAR_ALLOW_NOTIFY = 536,        /* VAR_ALLOW_NOTIFY  */
-    VAR_TLS_WIN_CERT = 537,        /* VAR_TLS_WIN_CERT  */
-    VAR_TCP_CONNECTION_LIMIT = 538, /* VAR_TCP_CONNECTION_LIMIT  */
-    VAR_FORWARD_NO_CACHE = 539,    /* VAR_FORWARD_NO_CACHE  */
-    VAR_STUB_NO_CACHE = 540,       /* VAR_STUB_NO_CACHE  */
-    VAR_LOG_SERVFAIL = 541,        /* VAR_LOG_SERVFAIL  */
-    VAR_DENY_ANY = 542,            /* VAR_DENY_ANY  */
-    VAR_UNKNOWN_SERVER_TIME_LIMIT = 543, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
-    VAR_LOG_TAG_QUERYREPLY = 544,  /* VAR_LOG_TAG_QUERYREPLY  */
-    VAR_STREAM_WAIT_SIZE = 545,    /* VAR_STREAM_WAIT_SIZE  */
-    VAR_TLS_CIPHERS = 546,         /* VAR_TLS_CIPHERS  */
-    VAR_TLS_CIPHERSUITES = 547,    /* VAR_TLS_CIPHERSUITES  */
-    VAR_TLS_USE_SNI = 548,         /* VAR_TLS_USE_SNI  */
-    VAR_IPSET = 549,               /* VAR_IPSET  */
-    VAR_IPSET_NAME_V4 = 550,       /* VAR_IPSET_NAME_V4  */
-    VAR_IPSET_NAME_V6 = 551,       /* VAR_IPSET_NAME_V6  */
-    VAR_TLS_SESSION_TICKET_KEYS = 552, /* VAR_TLS_SESSION_TICKET_KEYS  */
-    VAR_RPZ = 553,                 /* VAR_RPZ  */
-    VAR_TAGS = 554,                /* VAR_TAGS  */
-    VAR_RPZ_ACTION_OVERRIDE = 555, /* VAR_RPZ_ACTION_OVERRIDE  */
-    VAR_RPZ_CNAME_OVERRIDE = 556,  /* VAR_RPZ_CNAME_OVERRIDE  */
-    VAR_RPZ_LOG = 557,             /* VAR_RPZ_LOG  */
-    VAR_RPZ_LOG_NAME = 558,        /* VAR_RPZ_LOG_NAME  */
-    VAR_DYNLIB = 559,              /* VAR_DYNLIB  */
-    VAR_DYNLIB_FILE = 560,         /* VAR_DYNLIB_FILE  */
-    VAR_EDNS_CLIENT_STRING = 561,  /* VAR_EDNS_CLIENT_STRING  */
-    VAR_EDNS_CLIENT_STRING_OPCODE = 562, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
-    VAR_NSID = 563                 /* VAR_NSID  */
+    VAR_DNSTAP_SAMPLE_RATE = 437,  /* VAR_DNSTAP_SAMPLE_RATE  */
+    VAR_DNSTAP_FILTER_QTYPE = 438, /* VAR_DNSTAP_FILTER_QTYPE  */
+    VAR_DNSTAP_FILTER_RCODE = 439, /* VAR_DNSTAP_FILTER_RCODE  */
+    VAR_DNSTAP_FILTER_LOCAL_ZONE = 440, /* VAR_DNSTAP_FILTER_LOCAL_ZONE  */
+    VAR_DNSTAP_FILTER_RESPONSE_TIME = 441, /* VAR_DNSTAP_FILTER_RESPONSE_TIME  */
+    VAR_RESPONSE_IP_TAG = 442,     /* VAR_RESPONSE_IP_TAG  */
+    VAR_RESPONSE_IP = 443,         /* VAR_RESPONSE_IP  */
+    VAR_RESPONSE_IP_DATA = 444,    /* VAR_RESPONSE_IP_DATA  */
+    VAR_HARDEN_ALGO_DOWNGRADE = 445, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+    VAR_IP_TRANSPARENT = 446,      /* VAR_IP_TRANSPARENT  */
+    VAR_IP_DSCP = 447,             /* VAR_IP_DSCP  */
+    VAR_DISABLE_DNSSEC_LAME_CHECK = 448, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+    VAR_IP_RATELIMIT = 449,        /* VAR_IP_RATELIMIT  */
+    VAR_IP_RATELIMIT_SLABS = 450,  /* VAR_IP_RATELIMIT_SLABS  */
+    VAR_IP_RATELIMIT_SIZE = 451,   /* VAR_IP_RATELIMIT_SIZE  */
+    VAR_RATELIMIT = 452,           /* VAR_RATELIMIT  */
+    VAR_RATELIMIT_SLABS = 453,     /* VAR_RATELIMIT_SLABS  */
+    VAR_RATELIMIT_SIZE = 454,      /* VAR_RATELIMIT_SIZE  */
+    VAR_RATELIMIT_FOR_DOMAIN = 455, /* VAR_RATELIMIT_FOR_DOMAIN  */
+    VAR_RATELIMIT_BELOW_DOMAIN = 456, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+    VAR_IP_RATELIMIT_FACTOR = 457, /* VAR_IP_RATELIMIT_FACTOR  */
+    VAR_RATELIMIT_FACTOR = 458,    /* VAR_RATELIMIT_FACTOR  */
+    VAR_SEND_CLIENT_SUBNET = 459,  /* VAR_SEND_CLIENT_SUBNET  */
+    VAR_CLIENT_SUBNET_ZONE = 460,  /* VAR_CLIENT_SUBNET_ZONE  */
+    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 461, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+    VAR_CLIENT_SUBNET_OPCODE = 462, /* VAR_CLIENT_SUBNET_OPCODE  */
+    VAR_MAX_CLIENT_SUBNET_IPV4 = 463, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+    VAR_MAX_CLIENT_SUBNET_IPV6 = 464, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+    VAR_MIN_CLIENT_SUBNET_IPV4 = 465, /* VAR_MIN_CLIENT_SUBNET_IPV4  */
+    VAR_MIN_CLIENT_SUBNET_IPV6 = 466, /* VAR_MIN_CLIENT_SUBNET_IPV6  */
+    VAR_MAX_ECS_TREE_SIZE_IPV4 = 467, /* VAR_MAX_ECS_TREE_SIZE_IPV4  */
+    VAR_MAX_ECS_TREE_SIZE_IPV6 = 468, /* VAR_MAX_ECS_TREE_SIZE_IPV6  */
+    VAR_CAPS_WHITELIST = 469,      /* VAR_CAPS_WHITELIST  */
+    VAR_CACHE_MAX_NEGATIVE_TTL = 470, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+    VAR_PERMIT_SMALL_HOLDDOWN = 471, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+    VAR_QNAME_MINIMISATION = 472,  /* VAR_QNAME_MINIMISATION  */
+    VAR_QNAME_MINIMISATION_STRICT = 473, /* VAR_QNAME_MINIMISATION_STRICT  */
+    VAR_IP_FREEBIND = 474,         /* VAR_IP_FREEBIND  */
+    VAR_DEFINE_TAG = 475,          /* VAR_DEFINE_TAG  */
+    VAR_LOCAL_ZONE_TAG = 476,      /* VAR_LOCAL_ZONE_TAG  */
+    VAR_ACCESS_CONTROL_TAG = 477,  /* VAR_ACCESS_CONTROL_TAG  */
+    VAR_LOCAL_ZONE_OVERRIDE = 478, /* VAR_LOCAL_ZONE_OVERRIDE  */
+    VAR_ACCESS_CONTROL_TAG_ACTION = 479, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+    VAR_ACCESS_CONTROL_TAG_DATA = 480, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+    VAR_VIEW = 481,                /* VAR_VIEW  */
+    VAR_ACCESS_CONTROL_VIEW = 482, /* VAR_ACCESS_CONTROL_VIEW  */
+    VAR_VIEW_FIRST = 483,          /* VAR_VIEW_FIRST  */
+    VAR_SERVE_EXPIRED = 484,       /* VAR_SERVE_EXPIRED  */
+    VAR_SERVE_EXPIRED_TTL = 485,   /* VAR_SERVE_EXPIRED_TTL  */
+    VAR_SERVE_EXPIRED_TTL_RESET = 486, /* VAR_SERVE_EXPIRED_TTL_RESET  */
+    VAR_SERVE_EXPIRED_REPLY_TTL = 487, /* VAR_SERVE_EXPIRED_REPLY_TTL  */
+    VAR_SERVE_EXPIRED_CLIENT_TIMEOUT = 488, /* VAR_SERVE_EXPIRED_CLIENT_TIMEOUT  */
+    VAR_SERVE_ORIGINAL_TTL = 489,  /* VAR_SERVE_ORIGINAL_TTL  */
+    VAR_FAKE_DSA = 490,            /* VAR_FAKE_DSA  */
+    VAR_FAKE_SHA1 = 491,           /* VAR_FAKE_SHA1  */
+    VAR_LOG_IDENTITY = 492,        /* VAR_LOG_IDENTITY  */
+    VAR_HIDE_TRUSTANCHOR = 493,    /* VAR_HIDE_TRUSTANCHOR  */
+    VAR_TRUST_ANCHOR_SIGNALING = 494, /* VAR_TRUST_ANCHOR_SIGNALING  */
+    VAR_AGGRESSIVE_NSEC = 495,     /* VAR_AGGRESSIVE_NSEC  */
+    VAR_USE_SYSTEMD = 496,         /* VAR_USE_SYSTEMD  */
+    VAR_SHM_ENABLE = 497,          /* VAR_SHM_ENABLE  */
+    VAR_SHM_KEY = 498,             /* VAR_SHM_KEY  */
+    VAR_ROOT_KEY_SENTINEL = 499,   /* VAR_ROOT_KEY_SENTINEL  */
+    VAR_DNSCRYPT = 500,            /* VAR_DNSCRYPT  */
+    VAR_DNSCRYPT_ENABLE = 501,     /* VAR_DNSCRYPT_ENABLE  */
+    VAR_DNSCRYPT_PORT = 502,       /* VAR_DNSCRYPT_PORT  */
+    VAR_DNSCRYPT_PROVIDER = 503,   /* VAR_DNSCRYPT_PROVIDER  */
+    VAR_DNSCRYPT_SECRET_KEY = 504, /* VAR_DNSCRYPT_SECRET_KEY  */
+    VAR_DNSCRYPT_PROVIDER_CERT = 505, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 506, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 507, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 508, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 509, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 510, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+    VAR_PAD_RESPONSES = 511,       /* VAR_PAD_RESPONSES  */
+    VAR_PAD_RESPONSES_BLOCK_SIZE = 512, /* VAR_PAD_RESPONSES_BLOCK_SIZE  */
+    VAR_PAD_QUERIES = 513,         /* VAR_PAD_QUERIES  */
+    VAR_PAD_QUERIES_BLOCK_SIZE = 514, /* VAR_PAD_QUERIES_BLOCK_SIZE  */
+    VAR_IPSECMOD_ENABLED = 515,    /* VAR_IPSECMOD_ENABLED  */
+    VAR_IPSECMOD_HOOK = 516,       /* VAR_IPSECMOD_HOOK  */
+    VAR_IPSECMOD_IGNORE_BOGUS = 517, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+    VAR_IPSECMOD_MAX_TTL = 518,    /* VAR_IPSECMOD_MAX_TTL  */
+    VAR_IPSECMOD_WHITELIST = 519,  /* VAR_IPSECMOD_WHITELIST  */
+    VAR_IPSECMOD_STRICT = 520,     /* VAR_IPSECMOD_STRICT  */
+    VAR_CACHEDB = 521,             /* VAR_CACHEDB  */
+    VAR_CACHEDB_BACKEND = 522,     /* VAR_CACHEDB_BACKEND  */
+    VAR_CACHEDB_SECRETSEED = 523,  /* VAR_CACHEDB_SECRETSEED  */
+    VAR_CACHEDB_REDISHOST = 524,   /* VAR_CACHEDB_REDISHOST  */
+    VAR_CACHEDB_REDISPORT = 525,   /* VAR_CACHEDB_REDISPORT  */
+    VAR_CACHEDB_REDISTIMEOUT = 526, /* VAR_CACHEDB_REDISTIMEOUT  */
+    VAR_CACHEDB_REDISEXPIRERECORDS = 527, /* VAR_CACHEDB_REDISEXPIRERECORDS  */
+    VAR_CACHEDB_WRITEBEHINDSIZE = 528, /* VAR_CACHEDB_WRITEBEHINDSIZE  */
+    VAR_CACHEDB_WRITEBEHINDINTERVAL = 529, /* VAR_CACHEDB_WRITEBEHINDINTERVAL  */
+    VAR_CACHEDB_MMAPFILE = 530,    /* VAR_CACHEDB_MMAPFILE  */
+    VAR_CACHEDB_MMAPSIZE = 531,    /* VAR_CACHEDB_MMAPSIZE  */
+    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 532, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+    VAR_FOR_UPSTREAM = 533,        /* VAR_FOR_UPSTREAM  */
+    VAR_AUTH_ZONE = 534,           /* VAR_AUTH_ZONE  */
+    VAR_ZONEFILE = 535,            /* VAR_ZONEFILE  */
+    VAR_MASTER = 536,              /* VAR_MASTER  */
+    VAR_URL = 537,                 /* VAR_URL  */
+    VAR_FOR_DOWNSTREAM = 538,      /* VAR_FOR_DOWNSTREAM  */
+    VAR_FALLBACK_ENABLED = 539,    /* VAR_FALLBACK_ENABLED  */
+    VAR_TLS_ADDITIONAL_PORT = 540, /* VAR_TLS_ADDITIONAL_PORT  */
+    VAR_LOW_RTT = 541,             /* VAR_LOW_RTT  */
+    VAR_LOW_RTT_PERMIL = 542,      /* VAR_LOW_RTT_PERMIL  */
+    VAR_FAST_SERVER_PERMIL = 543,  /* VAR_FAST_SERVER_PERMIL  */
+    VAR_FAST_SERVER_NUM = 544,     /* VAR_FAST_SERVER_NUM  */
+    VAR_ALLOW_NOTIFY = 545,        /* VAR_ALLOW_NOTIFY  */
+    VAR_TLS_WIN_CERT = 546,        /* VAR_TLS_WIN_CERT  */
+    VAR_TCP_CONNECTION_LIMIT = 547, /* VAR_TCP_CONNECTION_LIMIT  */
+    VAR_FORWARD_NO_CACHE = 548,    /* VAR_FORWARD_NO_CACHE  */
+    VAR_STUB_NO_CACHE = 549,       /* VAR_STUB_NO_CACHE  */
+    VAR_LOG_SERVFAIL = 550,        /* VAR_LOG_SERVFAIL  */
+    VAR_DENY_ANY = 551,            /* VAR_DENY_ANY  */
+    VAR_UNKNOWN_SERVER_TIME_LIMIT = 552, /* VAR_UNKNOWN_SERVER_TIME_LIMIT  */
+    VAR_LOG_TAG_QUERYREPLY = 553,  /* VAR_LOG_TAG_QUERYREPLY  */
+    VAR_STREAM_WAIT_SIZE = 554,    /* VAR_STREAM_WAIT_SIZE  */
+    VAR_TLS_CIPHERS = 555,         /* VAR_TLS_CIPHERS  */
+    VAR_TLS_CIPHERSUITES = 556,    /* VAR_TLS_CIPHERSUITES  */
+    VAR_TLS_USE_SNI = 557,         /* VAR_TLS_USE_SNI  */
+    VAR_IPSET = 558,               /* VAR_IPSET  */
+    VAR_IPSET_NAME_V4 = 559,       /* VAR_IPSET_NAME_V4  */
+    VAR_IPSET_NAME_V6 = 560,       /* VAR_IPSET_NAME_V6  */
+    VAR_TLS_SESSION_TICKET_KEYS = 561, /* VAR_TLS_SESSION_TICKET_KEYS  */
+    VAR_RPZ = 562,                 /* VAR_RPZ  */
+    VAR_TAGS = 563,                /* VAR_TAGS  */
+    VAR_RPZ_ACTION_OVERRIDE = 564, /* VAR_RPZ_ACTION_OVERRIDE  */
+    VAR_RPZ_CNAME_OVERRIDE = 565,  /* VAR_RPZ_CNAME_OVERRIDE  */
+    VAR_RPZ_LOG = 566,             /* VAR_RPZ_LOG  */
+    VAR_RPZ_LOG_NAME = 567,        /* VAR_RPZ_LOG_NAME  */
+    VAR_DYNLIB = 568,              /* VAR_DYNLIB  */
+    VAR_DYNLIB_FILE = 569,         /* VAR_DYNLIB_FILE  */
+    VAR_EDNS_CLIENT_STRING = 570,  /* VAR_EDNS_CLIENT_STRING  */
+    VAR_EDNS_CLIENT_STRING_OPCODE = 571, /* VAR_EDNS_CLIENT_STRING_OPCODE  */
+    VAR_NSID = 572,                /* VAR_NSID  */
+    VAR_TRUST_ANCHOR_PRIME_ON_START = 573, /* VAR_TRUST_ANCHOR_PRIME_ON_START  */
+    VAR_LOCAL_ZONE_FILE = 574,     /* VAR_LOCAL_ZONE_FILE  */
+    VAR_TLS_SESSION_CACHE_SIZE = 575, /* VAR_TLS_SESSION_CACHE_SIZE  */
+    VAR_TLS_USE_KTLS = 576,        /* VAR_TLS_USE_KTLS  */
+    VAR_BUSY_POLL = 577,           /* VAR_BUSY_POLL  */
+    VAR_USE_IO_URING = 578,        /* VAR_USE_IO_URING  */
+    VAR_ANSWER_CACHE_SIZE = 579    /* VAR_ANSWER_CACHE_SIZE  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
 /* Token kinds.  */
+#define YYEMPTY -2
 #define YYEOF 0
 #define YYerror 256
 #define YYUNDEF 257
@@ -546,133 +563,149 @@ extern int yydebug;
 #define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 434
 #define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 435
 #define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 436
-#define VAR_RESPONSE_IP_TAG 437
-#define VAR_RESPONSE_IP 438
-#define VAR_RESPONSE_IP_DATA 439
-#define VAR_HARDEN_ALGO_DOWNGRADE 440
-#define VAR_IP_TRANSPARENT 441
-#define VAR_IP_DSCP 442
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 443
-#define VAR_IP_RATELIMIT 444
-#define VAR_IP_RATELIMIT_SLABS 445
-#define VAR_IP_RATELIMIT_SIZE 446
-#define VAR_RATELIMIT 447
-#define VAR_RATELIMIT_SLABS 448
-#define VAR_RATELIMIT_SIZE 449
-#define VAR_RATELIMIT_FOR_DOMAIN 450
-#define VAR_RATELIMIT_BELOW_DOMAIN 451
-#define VAR_IP_RATELIMIT_FACTOR 452
-#define VAR_RATELIMIT_FACTOR 453
-#define VAR_SEND_CLIENT_SUBNET 454
-#define VAR_CLIENT_SUBNET_ZONE 455
-#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 456
-#define VAR_CLIENT_SUBNET_OPCODE 457
-#define VAR_MAX_CLIENT_SUBNET_IPV4 458
-#define VAR_MAX_CLIENT_SUBNET_IPV6 459
-#define VAR_MIN_CLIENT_SUBNET_IPV4 460
-#define VAR_MIN_CLIENT_SUBNET_IPV6 461
-#define VAR_MAX_ECS_TREE_SIZE_IPV4 462
-#define VAR_MAX_ECS_TREE_SIZE_IPV6 463
-#define VAR_CAPS_WHITELIST 464
-#define VAR_CACHE_MAX_NEGATIVE_TTL 465
-#define VAR_PERMIT_SMALL_HOLDDOWN 466
-#define VAR_QNAME_MINIMISATION 467
-#define VAR_QNAME_MINIMISATION_STRICT 468
-#define VAR_IP_FREEBIND 469
-#define VAR_DEFINE_TAG 470
-#define VAR_LOCAL_ZONE_TAG 471
-#define VAR_ACCESS_CONTROL_TAG 472
-#define VAR_LOCAL_ZONE_OVERRIDE 473
-#define VAR_ACCESS_CONTROL_TAG_ACTION 474
-#define VAR_ACCESS_CONTROL_TAG_DATA 475
-#define VAR_VIEW 476
-#define VAR_ACCESS_CONTROL_VIEW 477
-#define VAR_VIEW_FIRST 478
-#define VAR_SERVE_EXPIRED 479
-#define VAR_SERVE_EXPIRED_TTL 480
-#define VAR_SERVE_EXPIRED_TTL_RESET 481
-#define VAR_SERVE_EXPIRED_REPLY_TTL 482
-#define VAR_SERVE_EXPIRED_CLIENT_TIMEOUT 483
-#define VAR_SERVE_ORIGINAL_TTL 484
-#define VAR_FAKE_DSA 485
-#define VAR_FAKE_SHA1 486
-#define VAR_LOG_IDENTITY 487
-#define VAR_HIDE_TRUSTANCHOR 488
-#define VAR_TRUST_ANCHOR_SIGNALING 489
-#define VAR_AGGRESSIVE_NSEC 490
-#define VAR_USE_SYSTEMD 491
-#define VAR_SHM_ENABLE 492
-#define VAR_SHM_KEY 493
-#define VAR_ROOT_KEY_SENTINEL 494
-#define VAR_DNSCRYPT 495
-#define VAR_DNSCRYPT_ENABLE 496
-#define VAR_DNSCRYPT_PORT 497
-#define VAR_DNSCRYPT_PROVIDER 498
-#define VAR_DNSCRYPT_SECRET_KEY 499
-#define VAR_DNSCRYPT_PROVIDER_CERT 500
-#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 501
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 502
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 503
-#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 504
-#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 505
-#define VAR_PAD_RESPONSES 506
-#define VAR_PAD_RESPONSES_BLOCK_SIZE 507
-#define VAR_PAD_QUERIES 508
-#define VAR_PAD_QUERIES_BLOCK_SIZE 509
-#define VAR_IPSECMOD_ENABLED 510
-#define VAR_IPSECMOD_HOOK 511
-#define VAR_IPSECMOD_IGNORE_BOGUS 512
-#define VAR_IPSECMOD_MAX_TTL 513
-#define VAR_IPSECMOD_WHITELIST 514
-#define VAR_IPSECMOD_STRICT 515
-#define VAR_CACHEDB 516
-#define VAR_CACHEDB_BACKEND 517
-#define VAR_CACHEDB_SECRETSEED 518
-#define VAR_CACHEDB_REDISHOST 519
-#define VAR_CACHEDB_REDISPORT 520
-#define VAR_CACHEDB_REDISTIMEOUT 521
-#define VAR_CACHEDB_REDISEXPIRERECORDS 522
-#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 523
-#define VAR_FOR_UPSTREAM 524
-#define VAR_AUTH_ZONE 525
-#define VAR_ZONEFILE 526
-#define VAR_MASTER 527
-#define VAR_URL 528
-#define VAR_FOR_DOWNSTREAM 529
-#define VAR_FALLBACK_ENABLED 530
-#define VAR_TLS_ADDITIONAL_PORT 531
-#define VAR_LOW_RTT 532
-#define VAR_LOW_RTT_PERMIL 533
-#define VAR_FAST_SERVER_PERMIL 534
-#define VAR_FAST_SERVER_NUM 535
-#define VAR_ALLOW_NOTIFY 536
-#define VAR_TLS_WIN_CERT 537
-#define VAR_TCP_CONNECTION_LIMIT 538
-#define VAR_FORWARD_NO_CACHE 539
-#define VAR_STUB_NO_CACHE 540
-#define VAR_LOG_SERVFAIL 541
-#define VAR_DENY_ANY 542
-#define VAR_UNKNOWN_SERVER_TIME_LIMIT 543
-#define VAR_LOG_TAG_QUERYREPLY 544
-#define VAR_STREAM_WAIT_SIZE 545
-#define VAR_TLS_CIPHERS 546
-#define VAR_TLS_CIPHERSUITES 547
-#define VAR_TLS_USE_SNI 548
-#define VAR_IPSET 549
-#define VAR_IPSET_NAME_V4 550
-#define VAR_IPSET_NAME_V6 551
-#define VAR_TLS_SESSION_TICKET_KEYS 552
-#define VAR_RPZ 553
-#define VAR_TAGS 554
-#define VAR_RPZ_ACTION_OVERRIDE 555
-#define VAR_RPZ_CNAME_OVERRIDE 556
-#define VAR_RPZ_LOG 557
-#define VAR_RPZ_LOG_NAME 558
-#define VAR_DYNLIB 559
-#define VAR_DYNLIB_FILE 560
-#define VAR_EDNS_CLIENT_STRING 561
-#define VAR_EDNS_CLIENT_STRING_OPCODE 562
-#define VAR_NSID 563
+#define VAR_DNSTAP_SAMPLE_RATE 437
+#define VAR_DNSTAP_FILTER_QTYPE 438
+#define VAR_DNSTAP_FILTER_RCODE 439
+#define VAR_DNSTAP_FILTER_LOCAL_ZONE 440
+#define VAR_DNSTAP_FILTER_RESPONSE_TIME 441
+#define VAR_RESPONSE_IP_TAG 442
+#define VAR_RESPONSE_IP 443
+#define VAR_RESPONSE_IP_DATA 444
+#define VAR_HARDEN_ALGO_DOWNGRADE 445
+#define VAR_IP_TRANSPARENT 446
+#define VAR_IP_DSCP 447
+#define VAR_DISABLE_DNSSEC_LAME_CHECK 448
+#define VAR_IP_RATELIMIT 449
+#define VAR_IP_RATELIMIT_SLABS 450
+#define VAR_IP_RATELIMIT_SIZE 451
+#define VAR_RATELIMIT 452
+#define VAR_RATELIMIT_SLABS 453
+#define VAR_RATELIMIT_SIZE 454
+#define VAR_RATELIMIT_FOR_DOMAIN 455
+#define VAR_RATELIMIT_BELOW_DOMAIN 456
+#define VAR_IP_RATELIMIT_FACTOR 457
+#define VAR_RATELIMIT_FACTOR 458
+#define VAR_SEND_CLIENT_SUBNET 459
+#define VAR_CLIENT_SUBNET_ZONE 460
+#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 461
+#define VAR_CLIENT_SUBNET_OPCODE 462
+#define VAR_MAX_CLIENT_SUBNET_IPV4 463
+#define VAR_MAX_CLIENT_SUBNET_IPV6 464
+#define VAR_MIN_CLIENT_SUBNET_IPV4 465
+#define VAR_MIN_CLIENT_SUBNET_IPV6 466
+#define VAR_MAX_ECS_TREE_SIZE_IPV4 467
+#define VAR_MAX_ECS_TREE_SIZE_IPV6 468
+#define VAR_CAPS_WHITELIST 469
+#define VAR_CACHE_MAX_NEGATIVE_TTL 470
+#define VAR_PERMIT_SMALL_HOLDDOWN 471
+#define VAR_QNAME_MINIMISATION 472
+#define VAR_QNAME_MINIMISATION_STRICT 473
+#define VAR_IP_FREEBIND 474
+#define VAR_DEFINE_TAG 475
+#define VAR_LOCAL_ZONE_TAG 476
+#define VAR_ACCESS_CONTROL_TAG 477
+#define VAR_LOCAL_ZONE_OVERRIDE 478
+#define VAR_ACCESS_CONTROL_TAG_ACTION 479
+#define VAR_ACCESS_CONTROL_TAG_DATA 480
+#define VAR_VIEW 481
+#define VAR_ACCESS_CONTROL_VIEW 482
+#define VAR_VIEW_FIRST 483
+#define VAR_SERVE_EXPIRED 484
+#define VAR_SERVE_EXPIRED_TTL 485
+#define VAR_SERVE_EXPIRED_TTL_RESET 486
+#define VAR_SERVE_EXPIRED_REPLY_TTL 487
+#define VAR_SERVE_EXPIRED_CLIENT_TIMEOUT 488
+#define VAR_SERVE_ORIGINAL_TTL 489
+#define VAR_FAKE_DSA 490
+#define VAR_FAKE_SHA1 491
+#define VAR_LOG_IDENTITY 492
+#define VAR_HIDE_TRUSTANCHOR 493
+#define VAR_TRUST_ANCHOR_SIGNALING 494
+#define VAR_AGGRESSIVE_NSEC 495
+#define VAR_USE_SYSTEMD 496
+#define VAR_SHM_ENABLE 497
+#define VAR_SHM_KEY 498
+#define VAR_ROOT_KEY_SENTINEL 499
+#define VAR_DNSCRYPT 500
+#define VAR_DNSCRYPT_ENABLE 501
+#define VAR_DNSCRYPT_PORT 502
+#define VAR_DNSCRYPT_PROVIDER 503
+#define VAR_DNSCRYPT_SECRET_KEY 504
+#define VAR_DNSCRYPT_PROVIDER_CERT 505
+#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 506
+#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 507
+#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 508
+#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 509
+#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 510
+#define VAR_PAD_RESPONSES 511
+#define VAR_PAD_RESPONSES_BLOCK_SIZE 512
+#define VAR_PAD_QUERIES 513
+#define VAR_PAD_QUERIES_BLOCK_SIZE 514
+#define VAR_IPSECMOD_ENABLED 515
+#define VAR_IPSECMOD_HOOK 516
+#define VAR_IPSECMOD_IGNORE_BOGUS 517
+#define VAR_IPSECMOD_MAX_TTL 518
+#define VAR_IPSECMOD_WHITELIST 519
+#define VAR_IPSECMOD_STRICT 520
+#define VAR_CACHEDB 521
+#define VAR_CACHEDB_BACKEND 522
+#define VAR_CACHEDB_SECRETSEED 523
+#define VAR_CACHEDB_REDISHOST 524
+#define VAR_CACHEDB_REDISPORT 525
+#define VAR_CACHEDB_REDISTIMEOUT 526
+#define VAR_CACHEDB_REDISEXPIRERECORDS 527
+#define VAR_CACHEDB_WRITEBEHINDSIZE 528
+#define VAR_CACHEDB_WRITEBEHINDINTERVAL 529
+#define VAR_CACHEDB_MMAPFILE 530
+#define VAR_CACHEDB_MMAPSIZE 531
+#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 532
+#define VAR_FOR_UPSTREAM 533
+#define VAR_AUTH_ZONE 534
+#define VAR_ZONEFILE 535
+#define VAR_MASTER 536
+#define VAR_URL 537
+#define VAR_FOR_DOWNSTREAM 538
+#define VAR_FALLBACK_ENABLED 539
+#define VAR_TLS_ADDITIONAL_PORT 540
+#define VAR_LOW_RTT 541
+#define VAR_LOW_RTT_PERMIL 542
+#define VAR_FAST_SERVER_PERMIL 543
+#define VAR_FAST_SERVER_NUM 544
+#define VAR_ALLOW_NOTIFY 545
+#define VAR_TLS_WIN_CERT 546
+#define VAR_TCP_CONNECTION_LIMIT 547
+#define VAR_FORWARD_NO_CACHE 548
+#define VAR_STUB_NO_CACHE 549
+#define VAR_LOG_SERVFAIL 550
+#define VAR_DENY_ANY 551
+#define VAR_UNKNOWN_SERVER_TIME_LIMIT 552
+#define VAR_LOG_TAG_QUERYREPLY 553
+#define VAR_STREAM_WAIT_SIZE 554
+#define VAR_TLS_CIPHERS 555
+#define VAR_TLS_CIPHERSUITES 556
+#define VAR_TLS_USE_SNI 557
+#define VAR_IPSET 558
+#define VAR_IPSET_NAME_V4 559
+#define VAR_IPSET_NAME_V6 560
+#define VAR_TLS_SESSION_TICKET_KEYS 561
+#define VAR_RPZ 562
+#define VAR_TAGS 563
+#define VAR_RPZ_ACTION_OVERRIDE 564
+#define VAR_RPZ_CNAME_OVERRIDE 565
+#define VAR_RPZ_LOG 566
+#define VAR_RPZ_LOG_NAME 567
+#define VAR_DYNLIB 568
+#define VAR_DYNLIB_FILE 569
+#define VAR_EDNS_CLIENT_STRING 570
+#define VAR_EDNS_CLIENT_STRING_OPCODE 571
+#define VAR_NSID 572
+#define VAR_TRUST_ANCHOR_PRIME_ON_START 573
+#define VAR_LOCAL_ZONE_FILE 574
+#define VAR_TLS_SESSION_CACHE_SIZE 575
+#define VAR_TLS_USE_KTLS 576
+#define VAR_BUSY_POLL 577
+#define VAR_USE_IO_URING 578
+#define VAR_ANSWER_CACHE_SIZE 579
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
@@ -682,7 +715,7 @@ union YYSTYPE
 
 	char*	str;
 
-#line 686 "util/configparser.h"
+#line 719 "util/configparser.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -693,6 +726,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
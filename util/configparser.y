@@ -131,6 +131,8 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES
 %token VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES
 %token VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES
+%token VAR_DNSTAP_SAMPLE_RATE VAR_DNSTAP_FILTER_QTYPE VAR_DNSTAP_FILTER_RCODE
+%token VAR_DNSTAP_FILTER_LOCAL_ZONE VAR_DNSTAP_FILTER_RESPONSE_TIME
 %token VAR_RESPONSE_IP_TAG VAR_RESPONSE_IP VAR_RESPONSE_IP_DATA
 %token VAR_HARDEN_ALGO_DOWNGRADE VAR_IP_TRANSPARENT
 %token VAR_IP_DSCP
@@ -169,6 +171,8 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_CACHEDB VAR_CACHEDB_BACKEND VAR_CACHEDB_SECRETSEED
 %token VAR_CACHEDB_REDISHOST VAR_CACHEDB_REDISPORT VAR_CACHEDB_REDISTIMEOUT
 %token VAR_CACHEDB_REDISEXPIRERECORDS
+%token VAR_CACHEDB_WRITEBEHINDSIZE VAR_CACHEDB_WRITEBEHINDINTERVAL
+%token VAR_CACHEDB_MMAPFILE VAR_CACHEDB_MMAPSIZE
 %token VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM VAR_FOR_UPSTREAM
 %token VAR_AUTH_ZONE VAR_ZONEFILE VAR_MASTER VAR_URL VAR_FOR_DOWNSTREAM
 %token VAR_FALLBACK_ENABLED VAR_TLS_ADDITIONAL_PORT VAR_LOW_RTT VAR_LOW_RTT_PERMIL
@@ -182,6 +186,13 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_RPZ_CNAME_OVERRIDE VAR_RPZ_LOG VAR_RPZ_LOG_NAME
 %token VAR_DYNLIB VAR_DYNLIB_FILE VAR_EDNS_CLIENT_STRING
 %token VAR_EDNS_CLIENT_STRING_OPCODE VAR_NSID
+%token VAR_TRUST_ANCHOR_PRIME_ON_START
+%token VAR_LOCAL_ZONE_FILE
+%token VAR_TLS_SESSION_CACHE_SIZE
+%token VAR_TLS_USE_KTLS
+%token VAR_BUSY_POLL
+%token VAR_USE_IO_URING
+%token VAR_ANSWER_CACHE_SIZE
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -299,7 +310,13 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_stream_wait_size | server_tls_ciphers |
 	server_tls_ciphersuites | server_tls_session_ticket_keys |
 	server_tls_use_sni | server_edns_client_string |
-	server_edns_client_string_opcode | server_nsid
+	server_edns_client_string_opcode | server_nsid |
+	server_trust_anchor_prime_on_start |
+	server_local_zone_file |
+	server_tls_session_cache_size |
+	server_tls_use_ktls |
+	server_busy_poll |
+	server_use_io_uring
 	;
 stubstart: VAR_STUB_ZONE
 	{
@@ -375,7 +392,7 @@ contents_auth: contents_auth content_auth
 	| ;
 content_auth: auth_name | auth_zonefile | auth_master | auth_url |
 	auth_for_downstream | auth_for_upstream | auth_fallback_enabled |
-	auth_allow_notify
+	auth_allow_notify | auth_answer_cache_size
 	;
 
 rpz_tag: VAR_TAGS STRING_ARG
@@ -966,6 +983,24 @@ server_tls_ciphersuites: VAR_TLS_CIPHERSUITES STRING_ARG
 		cfg_parser->cfg->tls_ciphersuites = $2;
 	}
 	;
+server_tls_session_cache_size: VAR_TLS_SESSION_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_tls_session_cache_size:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->tls_session_cache_size = atoi($2);
+		free($2);
+	}
+	;
+server_tls_use_ktls: VAR_TLS_USE_KTLS STRING_ARG
+	{
+		OUTYY(("P(server_tls_use_ktls:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->tls_use_ktls = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_tls_session_ticket_keys: VAR_TLS_SESSION_TICKET_KEYS STRING_ARG
 	{
 		OUTYY(("P(server_tls_session_ticket_keys:%s)\n", $2));
@@ -1251,6 +1286,15 @@ server_trust_anchor_signaling: VAR_TRUST_ANCHOR_SIGNALING STRING_ARG
 		free($2);
 	}
 	;
+server_trust_anchor_prime_on_start: VAR_TRUST_ANCHOR_PRIME_ON_START STRING_ARG
+	{
+		OUTYY(("P(server_trust_anchor_prime_on_start:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->trust_anchor_prime_on_start = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_root_key_sentinel: VAR_ROOT_KEY_SENTINEL STRING_ARG
 	{
 		OUTYY(("P(server_root_key_sentinel:%s)\n", $2));
@@ -1386,6 +1430,24 @@ server_ip_dscp: VAR_IP_DSCP STRING_ARG
 		free($2);
 	}
 	;
+server_busy_poll: VAR_BUSY_POLL STRING_ARG
+	{
+		OUTYY(("P(server_busy_poll:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->busy_poll = atoi($2);
+		free($2);
+	}
+	;
+server_use_io_uring: VAR_USE_IO_URING STRING_ARG
+	{
+		OUTYY(("P(server_use_io_uring:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->use_io_uring = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_stream_wait_size: VAR_STREAM_WAIT_SIZE STRING_ARG
 	{
 		OUTYY(("P(server_stream_wait_size:%s)\n", $2));
@@ -2103,6 +2165,13 @@ server_local_data: VAR_LOCAL_DATA STRING_ARG
 			fatal_exit("out of memory adding local-data");
 	}
 	;
+server_local_zone_file: VAR_LOCAL_ZONE_FILE STRING_ARG
+	{
+		OUTYY(("P(server_local_zone_file:%s)\n", $2));
+		free(cfg_parser->cfg->local_zone_file);
+		cfg_parser->cfg->local_zone_file = $2;
+	}
+	;
 server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG
 	{
 		char* ptr;
@@ -2771,6 +2840,15 @@ auth_fallback_enabled: VAR_FALLBACK_ENABLED STRING_ARG
 		free($2);
 	}
 	;
+auth_answer_cache_size: VAR_ANSWER_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(answer-cache-size:%s)\n", $2));
+		if(!cfg_parse_memsize($2,
+			&cfg_parser->cfg->auths->answer_cache_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
 view_name: VAR_NAME STRING_ARG
 	{
 		OUTYY(("P(name:%s)\n", $2));
@@ -2960,7 +3038,10 @@ content_dt: dt_dnstap_enable | dt_dnstap_socket_path | dt_dnstap_bidirectional |
 	dt_dnstap_log_client_query_messages |
 	dt_dnstap_log_client_response_messages |
 	dt_dnstap_log_forwarder_query_messages |
-	dt_dnstap_log_forwarder_response_messages
+	dt_dnstap_log_forwarder_response_messages |
+	dt_dnstap_sample_rate | dt_dnstap_filter_qtype |
+	dt_dnstap_filter_rcode | dt_dnstap_filter_local_zone |
+	dt_dnstap_filter_response_time
 	;
 dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG
 	{
@@ -3124,6 +3205,52 @@ dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MES
 		free($2);
 	}
 	;
+dt_dnstap_sample_rate: VAR_DNSTAP_SAMPLE_RATE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_rate:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("dnstap-sample-rate cannot be negative");
+		else cfg_parser->cfg->dnstap_sample_rate = atoi($2);
+		free($2);
+	}
+	;
+dt_dnstap_filter_qtype: VAR_DNSTAP_FILTER_QTYPE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_filter_qtype:%s)\n", $2));
+		free(cfg_parser->cfg->dnstap_filter_qtype);
+		cfg_parser->cfg->dnstap_filter_qtype = $2;
+	}
+	;
+dt_dnstap_filter_rcode: VAR_DNSTAP_FILTER_RCODE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_filter_rcode:%s)\n", $2));
+		free(cfg_parser->cfg->dnstap_filter_rcode);
+		cfg_parser->cfg->dnstap_filter_rcode = $2;
+	}
+	;
+dt_dnstap_filter_local_zone: VAR_DNSTAP_FILTER_LOCAL_ZONE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_filter_local_zone:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->dnstap_filter_local_zone =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+dt_dnstap_filter_response_time: VAR_DNSTAP_FILTER_RESPONSE_TIME STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_filter_response_time:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0)
+			yyerror("dnstap-filter-response-time cannot be negative");
+		else cfg_parser->cfg->dnstap_filter_response_time = atoi($2);
+		free($2);
+	}
+	;
 pythonstart: VAR_PYTHON
 	{ 
 		OUTYY(("\nP(python:)\n")); 
@@ -3305,6 +3432,8 @@ cachedbstart: VAR_CACHEDB
 contents_cachedb: contents_cachedb content_cachedb
 	| ;
 content_cachedb: cachedb_backend_name | cachedb_secret_seed |
+	cachedb_write_behind_size | cachedb_write_behind_interval |
+	cachedb_mmap_file | cachedb_mmap_size |
 	redis_server_host | redis_server_port | redis_timeout |
 	redis_expire_records
 	;
@@ -3332,6 +3461,56 @@ cachedb_secret_seed: VAR_CACHEDB_SECRETSEED STRING_ARG
 	#endif
 	}
 	;
+cachedb_write_behind_size: VAR_CACHEDB_WRITEBEHINDSIZE STRING_ARG
+	{
+	#ifdef USE_CACHEDB
+		OUTYY(("P(write-behind-size:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->cachedb_write_behind_size = atoi($2);
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+	#endif
+		free($2);
+	}
+	;
+cachedb_write_behind_interval: VAR_CACHEDB_WRITEBEHINDINTERVAL STRING_ARG
+	{
+	#ifdef USE_CACHEDB
+		OUTYY(("P(write-behind-interval:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("write-behind interval value expected");
+		else cfg_parser->cfg->cachedb_write_behind_interval = atoi($2);
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+	#endif
+		free($2);
+	}
+	;
+cachedb_mmap_file: VAR_CACHEDB_MMAPFILE STRING_ARG
+	{
+	#ifdef USE_CACHEDB
+		OUTYY(("P(mmap-file:%s)\n", $2));
+		free(cfg_parser->cfg->cachedb_mmap_file);
+		cfg_parser->cfg->cachedb_mmap_file = $2;
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+		free($2);
+	#endif
+	}
+	;
+cachedb_mmap_size: VAR_CACHEDB_MMAPSIZE STRING_ARG
+	{
+	#ifdef USE_CACHEDB
+		OUTYY(("P(mmap-size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->cachedb_mmap_size))
+			yyerror("memory size expected");
+	#else
+		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
+	#endif
+		free($2);
+	}
+	;
 redis_server_host: VAR_CACHEDB_REDISHOST STRING_ARG
 	{
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
@@ -789,6 +789,37 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	return 1;
 }
 
+int
+reply_info_encoded_complete(struct query_info* qinfo, struct reply_info* rep,
+	sldns_buffer* buffer, int dnssec)
+{
+	size_t i;
+	uint16_t arcount = 0;
+	struct packed_rrset_data* d;
+	if(sldns_buffer_limit(buffer) < LDNS_HEADER_SIZE ||
+		LDNS_TC_WIRE(sldns_buffer_begin(buffer)))
+		return 0;
+	/* the additional section is cut without the TC bit, count what
+	 * reply_info_encode would have put there */
+	if(!(MINIMAL_RESPONSES && (positive_answer(rep, qinfo->qtype) ||
+		negative_answer(rep)))) {
+		for(i=rep->an_numrrsets + rep->ns_numrrsets;
+			i<rep->an_numrrsets + rep->ns_numrrsets +
+			rep->ar_numrrsets; i++) {
+			if(!rrset_belongs_in_reply(LDNS_SECTION_ADDITIONAL,
+				ntohs(rep->rrsets[i]->rk.type), qinfo->qtype,
+				dnssec))
+				continue;
+			d = (struct packed_rrset_data*)rep->rrsets[i]->
+				entry.data;
+			arcount += d->count;
+			if(dnssec)
+				arcount += d->rrsig_count;
+		}
+	}
+	return LDNS_ARCOUNT(sldns_buffer_begin(buffer)) == arcount;
+}
+
 uint16_t
 calc_edns_field_size(struct edns_data* edns)
 {
@@ -94,6 +94,18 @@ int reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	uint16_t id, uint16_t flags, struct sldns_buffer* buffer, time_t timenow, 
 	struct regional* region, uint16_t udpsize, int dnssec, int minimise);
 
+/**
+ * See if an encoded reply holds all of the reply, the TC bit is not set
+ * and no rrsets are left out of the additional section.
+ * @param qinfo: query info the reply was encoded for.
+ * @param rep: reply that was encoded.
+ * @param buffer: the encoded packet, without the EDNS record.
+ * @param dnssec: if 0 DNSSEC records were omitted from the answer.
+ * @return true if complete.
+ */
+int reply_info_encoded_complete(struct query_info* qinfo,
+	struct reply_info* rep, struct sldns_buffer* buffer, int dnssec);
+
 /**
  * Encode query packet. Assumes the buffer is large enough.
  * @param pkt: where to store the packet.
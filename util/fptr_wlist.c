@@ -86,6 +86,7 @@
 #endif
 #ifdef USE_CACHEDB
 #include "cachedb/cachedb.h"
+#include "cachedb/redis.h"
 #endif
 #ifdef USE_IPSECMOD
 #include "ipsecmod/ipsecmod.h"
@@ -140,6 +141,13 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 	else if(fptr == &mesh_serve_expired_callback) return 1;
 #ifdef USE_DNSTAP
 	else if(fptr == &mq_wakeup_cb) return 1;
+#endif
+#ifdef USE_CACHEDB
+	else if(fptr == &testframe_async_timer_cb) return 1;
+	else if(fptr == &cachedb_wb_timer_cb) return 1;
+#ifdef USE_REDIS
+	else if(fptr == &redis_async_timeout_cb) return 1;
+#endif
 #endif
 	return 0;
 }
@@ -176,6 +184,10 @@ fptr_whitelist_event(void (*fptr)(int, short, void *))
 	else if(fptr == &comm_point_raw_handle_callback) return 1;
 	else if(fptr == &tube_handle_signal) return 1;
 	else if(fptr == &comm_base_handle_slow_accept) return 1;
+	else if(fptr == &comm_base_handle_uring) return 1;
+#if defined(USE_CACHEDB) && defined(USE_REDIS)
+	else if(fptr == &redis_async_event_cb) return 1;
+#endif
 	else if(fptr == &comm_point_http_handle_callback) return 1;
 #ifdef USE_DNSTAP
 	else if(fptr == &dtio_output_cb) return 1;
@@ -247,6 +259,9 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 	else if(fptr == &auth_zone_cmp) return 1;
 	else if(fptr == &auth_data_cmp) return 1;
 	else if(fptr == &auth_xfer_cmp) return 1;
+#ifdef USE_CACHEDB
+	else if(fptr == &cachedb_wb_cmp) return 1;
+#endif
 	return 0;
 }
 
@@ -260,6 +275,7 @@ fptr_whitelist_hash_sizefunc(lruhash_sizefunc_type fptr)
 	else if(fptr == &rate_sizefunc) return 1;
 	else if(fptr == &ip_rate_sizefunc) return 1;
 	else if(fptr == &test_slabhash_sizefunc) return 1;
+	else if(fptr == &auth_answer_sizefunc) return 1;
 #ifdef CLIENT_SUBNET
 	else if(fptr == &msg_cache_sizefunc) return 1;
 #endif
@@ -280,6 +296,7 @@ fptr_whitelist_hash_compfunc(lruhash_compfunc_type fptr)
 	else if(fptr == &rate_compfunc) return 1;
 	else if(fptr == &ip_rate_compfunc) return 1;
 	else if(fptr == &test_slabhash_compfunc) return 1;
+	else if(fptr == &auth_answer_compfunc) return 1;
 #ifdef USE_DNSCRYPT
 	else if(fptr == &dnsc_shared_secrets_compfunc) return 1;
 	else if(fptr == &dnsc_nonces_compfunc) return 1;
@@ -297,6 +314,7 @@ fptr_whitelist_hash_delkeyfunc(lruhash_delkeyfunc_type fptr)
 	else if(fptr == &rate_delkeyfunc) return 1;
 	else if(fptr == &ip_rate_delkeyfunc) return 1;
 	else if(fptr == &test_slabhash_delkey) return 1;
+	else if(fptr == &auth_answer_delkeyfunc) return 1;
 #ifdef USE_DNSCRYPT
 	else if(fptr == &dnsc_shared_secrets_delkeyfunc) return 1;
 	else if(fptr == &dnsc_nonces_delkeyfunc) return 1;
@@ -313,6 +331,7 @@ fptr_whitelist_hash_deldatafunc(lruhash_deldatafunc_type fptr)
 	else if(fptr == &key_entry_deldatafunc) return 1;
 	else if(fptr == &rate_deldatafunc) return 1;
 	else if(fptr == &test_slabhash_deldata) return 1;
+	else if(fptr == &auth_answer_deldatafunc) return 1;
 #ifdef CLIENT_SUBNET
 	else if(fptr == &subnet_data_delete) return 1;
 #endif
@@ -581,6 +600,7 @@ int fptr_whitelist_mesh_cb(mesh_cb_func_type fptr)
 	else if(fptr == &libworker_bg_done_cb) return 1;
 	else if(fptr == &libworker_event_done_cb) return 1;
 	else if(fptr == &probe_answer_cb) return 1;
+	else if(fptr == &worker_anchor_prime_cb) return 1;
 	else if(fptr == &auth_xfer_probe_lookup_callback) return 1;
 	else if(fptr == &auth_xfer_transfer_lookup_callback) return 1;
 	return 0;
@@ -37,7 +37,7 @@
 /**
  * \file
  * fake libevent implementation. Less broad in functionality, and only
- * supports select(2).
+ * supports select(2), or epoll(7) on Linux.
  */
 
 #include "config.h"
@@ -50,6 +50,20 @@
 #if defined(USE_MINI_EVENT) && !defined(USE_WINSOCK)
 #include <signal.h>
 #include "util/fptr_wlist.h"
+#ifdef USE_EPOLL_EVENT
+#include <sys/epoll.h>
+#include "util/log.h"
+
+/** number of events to get from the kernel per wait */
+#define EPOLL_EVENTS_PER_WAIT 64
+/** regs flag, the fd is registered with EPOLLEXCLUSIVE */
+#define EV_EXCL		0x20
+/** regs flag, the fd is in the changes list */
+#define EV_CHANGED	0x40
+/** regs flag, the fd was deleted, and may have been closed and reopened,
+ * and the registration must be renewed if it is added again */
+#define EV_DELETED	0x80
+#endif /* USE_EPOLL_EVENT */
 
 /** compare events in tree, based on timevalue, ptr for uniqueness */
 int mini_ev_cmp(const void* a, const void* b)
@@ -92,6 +106,9 @@ void *event_init(time_t* time_secs, struct timeval* time_tv)
 	if(!base)
 		return NULL;
 	memset(base, 0, sizeof(*base));
+#ifdef USE_EPOLL_EVENT
+	base->epfd = -1;
+#endif
 	base->time_secs = time_secs;
 	base->time_tv = time_tv;
 	if(settime(base) < 0) {
@@ -104,7 +121,22 @@ void *event_init(time_t* time_secs, struct timeval* time_tv)
 		return NULL;
 	}
 	base->capfd = MAX_FDS;
-#ifdef FD_SETSIZE
+#ifdef USE_EPOLL_EVENT
+	base->epfd = epoll_create1(EPOLL_CLOEXEC);
+	if(base->epfd == -1) {
+		log_err("epoll_create1: %s", strerror(errno));
+		event_base_free(base);
+		return NULL;
+	}
+	base->regs = (short*)calloc((size_t)base->capfd, sizeof(short));
+	base->gens = (unsigned int*)calloc((size_t)base->capfd,
+		sizeof(unsigned int));
+	base->changes = (int*)calloc((size_t)base->capfd, sizeof(int));
+	if(!base->regs || !base->gens || !base->changes) {
+		event_base_free(base);
+		return NULL;
+	}
+#elif defined(FD_SETSIZE)
 	if((int)FD_SETSIZE < base->capfd)
 		base->capfd = (int)FD_SETSIZE;
 #endif
@@ -119,7 +151,7 @@ void *event_init(time_t* time_secs, struct timeval* time_tv)
 		event_base_free(base);
 		return NULL;
 	}
-#ifndef S_SPLINT_S
+#if !defined(S_SPLINT_S) && !defined(USE_EPOLL_EVENT)
 	FD_ZERO(&base->reads);
 	FD_ZERO(&base->writes);
 #endif
@@ -135,7 +167,11 @@ const char *event_get_version(void)
 /** get polling method, select */
 const char *event_get_method(void)
 {
+#ifdef USE_EPOLL_EVENT
+	return "epoll";
+#else
 	return "select";
+#endif
 }
 
 /** call timeouts handlers, and return how long to wait for next one or -1 */
@@ -174,6 +210,187 @@ static void handle_timeouts(struct event_base* base, struct timeval* now,
 	}
 }
 
+#ifdef USE_EPOLL_EVENT
+/** grow the fd arrays so that fd fits */
+static int grow_fds(struct event_base* base, int fd)
+{
+	int cap = base->capfd;
+	struct event** fds;
+	short* regs;
+	unsigned int* gens;
+	int* changes;
+	while(fd >= cap)
+		cap *= 2;
+	fds = (struct event**)realloc(base->fds, sizeof(*fds)*(size_t)cap);
+	if(!fds) return 0;
+	base->fds = fds;
+	regs = (short*)realloc(base->regs, sizeof(*regs)*(size_t)cap);
+	if(!regs) return 0;
+	base->regs = regs;
+	gens = (unsigned int*)realloc(base->gens, sizeof(*gens)*(size_t)cap);
+	if(!gens) return 0;
+	base->gens = gens;
+	changes = (int*)realloc(base->changes, sizeof(*changes)*(size_t)cap);
+	if(!changes) return 0;
+	base->changes = changes;
+	memset(base->fds+base->capfd, 0, sizeof(*fds)*(size_t)(cap-base->capfd));
+	memset(base->regs+base->capfd, 0,
+		sizeof(*regs)*(size_t)(cap-base->capfd));
+	memset(base->gens+base->capfd, 0,
+		sizeof(*gens)*(size_t)(cap-base->capfd));
+	base->capfd = cap;
+	return 1;
+}
+
+/** note the fd has changed, to apply before the next wait */
+static void note_change(struct event_base* base, int fd)
+{
+	if((base->regs[fd]&EV_CHANGED))
+		return;
+	base->regs[fd] |= EV_CHANGED;
+	base->changes[base->num_changes++] = fd;
+}
+
+/** call epoll_ctl for the fd, returns errno or 0 */
+static int epoll_ctl_fd(struct event_base* base, int op, int fd, short bits)
+{
+	struct epoll_event e;
+	memset(&e, 0, sizeof(e));
+	if((bits&EV_READ))
+		e.events |= EPOLLIN;
+	if((bits&EV_WRITE))
+		e.events |= EPOLLOUT;
+#ifdef EPOLLEXCLUSIVE
+	if((bits&EV_EXCL))
+		e.events |= EPOLLEXCLUSIVE;
+#endif
+	e.data.fd = fd;
+	if(epoll_ctl(base->epfd, op, fd, &e) == -1)
+		return errno;
+	return 0;
+}
+
+/** apply the change of one fd to the epoll registration */
+static void apply_change(struct event_base* base, int fd)
+{
+	struct event* ev = base->fds[fd];
+	short cur = base->regs[fd]&(EV_READ|EV_WRITE|EV_EXCL);
+	short want = 0;
+	int err = 0;
+	if(ev) {
+		want = ev->ev_events&(EV_READ|EV_WRITE);
+		if(ev->ev_exclusive)
+			want |= EV_EXCL;
+	}
+	if(!want) {
+		/* the fd may be closed already, that removed it */
+		if(cur)
+			(void)epoll_ctl_fd(base, EPOLL_CTL_DEL, fd, 0);
+	} else if(!cur) {
+		err = epoll_ctl_fd(base, EPOLL_CTL_ADD, fd, want);
+		if(err == EEXIST)
+			err = epoll_ctl_fd(base, EPOLL_CTL_MOD, fd, want);
+	} else if(want == cur && !(base->regs[fd]&EV_DELETED)) {
+		/* no change */
+	} else if(((cur|want)&EV_EXCL)) {
+		/* exclusive registrations cannot be modified */
+		(void)epoll_ctl_fd(base, EPOLL_CTL_DEL, fd, 0);
+		err = epoll_ctl_fd(base, EPOLL_CTL_ADD, fd, want);
+	} else {
+		/* if the fd was closed, the registration is gone */
+		err = epoll_ctl_fd(base, EPOLL_CTL_MOD, fd, want);
+		if(err == ENOENT)
+			err = epoll_ctl_fd(base, EPOLL_CTL_ADD, fd, want);
+	}
+	if(err) {
+		log_err("epoll_ctl fd %d: %s", fd, strerror(err));
+		want = 0;
+	}
+	base->regs[fd] = want;
+}
+
+/** poll for events, without sleeping, for the busy poll time or the
+ * timeout, whichever is shorter. Returns number of events or -1 */
+static int busy_poll_wait(struct event_base* base, struct epoll_event* evs,
+	int timeout)
+{
+	struct timeval start, now;
+	long spent, limit = (long)base->busy_poll;
+	int ret;
+	if(timeout >= 0 && (long)timeout*1000 < limit)
+		limit = (long)timeout*1000;
+	if(gettimeofday(&start, NULL) < 0)
+		return 0;
+	while(!base->need_to_exit) {
+		ret = epoll_wait(base->epfd, evs, EPOLL_EVENTS_PER_WAIT, 0);
+		if(ret != 0)
+			return ret;
+		if(gettimeofday(&now, NULL) < 0)
+			return 0;
+		spent = (long)(now.tv_sec - start.tv_sec)*1000000 +
+			(long)(now.tv_usec - start.tv_usec);
+		if(spent >= limit)
+			break;
+	}
+	return 0;
+}
+
+/** call epoll and callbacks for that */
+static int handle_select(struct event_base* base, struct timeval* wait)
+{
+	struct epoll_event evs[EPOLL_EVENTS_PER_WAIT];
+	int ret, i, timeout = -1;
+
+	for(i=0; i<base->num_changes; i++)
+		apply_change(base, base->changes[i]);
+	base->num_changes = 0;
+#ifndef S_SPLINT_S
+	if(wait->tv_sec!=(time_t)-1)
+		timeout = (int)wait->tv_sec*1000 + (int)(wait->tv_usec+999)/1000;
+#endif
+	/* events for fds added after this are stale for them */
+	base->gen++;
+	ret = 0;
+	if(base->busy_poll > 0 && timeout != 0)
+		ret = busy_poll_wait(base, evs, timeout);
+	if(ret == 0 && !base->need_to_exit)
+		ret = epoll_wait(base->epfd, evs, EPOLL_EVENTS_PER_WAIT,
+			timeout);
+	if(ret == -1) {
+		ret = errno;
+		if(settime(base) < 0)
+			return -1;
+		errno = ret;
+		if(ret == EAGAIN || ret == EINTR)
+			return 0;
+		return -1;
+	}
+	if(settime(base) < 0)
+		return -1;
+	if(ret > 0)
+		base->num_wakeup++;
+
+	for(i=0; i<ret; i++) {
+		int fd = evs[i].data.fd;
+		struct event* ev;
+		short bits = 0;
+		if(fd < 0 || fd >= base->capfd || !(ev=base->fds[fd]) ||
+			base->gens[fd] == base->gen)
+			continue;
+		if((evs[i].events&(EPOLLIN|EPOLLHUP|EPOLLERR)))
+			bits |= EV_READ;
+		if((evs[i].events&(EPOLLOUT|EPOLLHUP|EPOLLERR)))
+			bits |= EV_WRITE;
+		bits &= ev->ev_events;
+		if(bits) {
+			base->num_handled++;
+			fptr_ok(fptr_whitelist_event(ev->ev_callback));
+			(*ev->ev_callback)(ev->ev_fd, bits, ev->ev_arg);
+		}
+	}
+	return 0;
+}
+#else /* USE_EPOLL_EVENT */
 /** call select and callbacks for that */
 static int handle_select(struct event_base* base, struct timeval* wait)
 {
@@ -199,6 +416,8 @@ static int handle_select(struct event_base* base, struct timeval* wait)
 	}
 	if(settime(base) < 0)
 		return -1;
+	if(ret > 0)
+		base->num_wakeup++;
 	
 	for(i=0; i<base->maxfd+1; i++) {
 		short bits = 0;
@@ -215,6 +434,7 @@ static int handle_select(struct event_base* base, struct timeval* wait)
 		}
 		bits &= base->fds[i]->ev_events;
 		if(bits) {
+			base->num_handled++;
 			fptr_ok(fptr_whitelist_event(
 				base->fds[i]->ev_callback));
 			(*base->fds[i]->ev_callback)(base->fds[i]->ev_fd, 
@@ -225,6 +445,7 @@ static int handle_select(struct event_base* base, struct timeval* wait)
 	}
 	return 0;
 }
+#endif /* USE_EPOLL_EVENT */
 
 /** run select in a loop */
 int event_base_dispatch(struct event_base* base)
@@ -261,6 +482,13 @@ void event_base_free(struct event_base* base)
 {
 	if(!base)
 		return;
+#ifdef USE_EPOLL_EVENT
+	if(base->epfd != -1)
+		close(base->epfd);
+	free(base->regs);
+	free(base->gens);
+	free(base->changes);
+#endif
 	free(base->times);
 	free(base->fds);
 	free(base->signals);
@@ -293,10 +521,18 @@ int event_add(struct event* ev, struct timeval* tv)
 {
 	if(ev->added)
 		event_del(ev);
-	if(ev->ev_fd != -1 && ev->ev_fd >= ev->ev_base->capfd)
+	if(ev->ev_fd != -1 && ev->ev_fd >= ev->ev_base->capfd) {
+#ifdef USE_EPOLL_EVENT
+		if(!grow_fds(ev->ev_base, ev->ev_fd))
+#endif
 		return -1;
+	}
 	if( (ev->ev_events&(EV_READ|EV_WRITE)) && ev->ev_fd != -1) {
 		ev->ev_base->fds[ev->ev_fd] = ev;
+#ifdef USE_EPOLL_EVENT
+		ev->ev_base->gens[ev->ev_fd] = ev->ev_base->gen;
+		note_change(ev->ev_base, ev->ev_fd);
+#else
 		if(ev->ev_events&EV_READ) {
 			FD_SET(FD_SET_T ev->ev_fd, &ev->ev_base->reads);
 		}
@@ -307,6 +543,7 @@ int event_add(struct event* ev, struct timeval* tv)
 		FD_CLR(FD_SET_T ev->ev_fd, &ev->ev_base->ready);
 		if(ev->ev_fd > ev->ev_base->maxfd)
 			ev->ev_base->maxfd = ev->ev_fd;
+#endif /* USE_EPOLL_EVENT */
 	}
 	if(tv && (ev->ev_events&EV_TIMEOUT)) {
 #ifndef S_SPLINT_S
@@ -333,10 +570,15 @@ int event_del(struct event* ev)
 		(void)rbtree_delete(ev->ev_base->times, &ev->node);
 	if((ev->ev_events&(EV_READ|EV_WRITE)) && ev->ev_fd != -1) {
 		ev->ev_base->fds[ev->ev_fd] = NULL;
+#ifdef USE_EPOLL_EVENT
+		ev->ev_base->regs[ev->ev_fd] |= EV_DELETED;
+		note_change(ev->ev_base, ev->ev_fd);
+#else
 		FD_CLR(FD_SET_T ev->ev_fd, &ev->ev_base->reads);
 		FD_CLR(FD_SET_T ev->ev_fd, &ev->ev_base->writes);
 		FD_CLR(FD_SET_T ev->ev_fd, &ev->ev_base->ready);
 		FD_CLR(FD_SET_T ev->ev_fd, &ev->ev_base->content);
+#endif /* USE_EPOLL_EVENT */
 	}
 	ev->added = 0;
 	return 0;
@@ -381,6 +623,41 @@ int signal_del(struct event* ev)
 	return 0;
 }
 
+/** set the busy poll time */
+void minievent_set_busy_poll(struct event_base* base, int usec)
+{
+#ifdef USE_EPOLL_EVENT
+	base->busy_poll = usec;
+#else
+	(void)base;
+	(void)usec;
+#endif
+}
+
+/** set the event for exclusive wakeup */
+void minievent_set_exclusive(struct event* ev)
+{
+	ev->ev_exclusive = 1;
+#ifdef USE_EPOLL_EVENT
+	/* renew the registration if it is in use */
+	if(ev->added && ev->ev_fd != -1 && (ev->ev_events&(EV_READ|EV_WRITE))
+		&& ev->ev_base->fds[ev->ev_fd] == ev)
+		note_change(ev->ev_base, ev->ev_fd);
+#endif
+}
+
+/** get the wakeup and event counts */
+void minievent_get_counts(struct event_base* base, size_t* wakeup,
+	size_t* handled, int reset)
+{
+	*wakeup = base->num_wakeup;
+	*handled = base->num_handled;
+	if(reset) {
+		base->num_wakeup = 0;
+		base->num_handled = 0;
+	}
+}
+
 #else /* USE_MINI_EVENT */
 #ifndef USE_WINSOCK
 int mini_ev_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
@@ -47,6 +47,14 @@
  * o timeouts are stored in a redblack tree, sorted, so take log(n).
  * Timeouts are only accurate to the second (no subsecond accuracy).
  * To avoid cpu hogging, fractional timeouts are rounded up to a whole second.
+ *
+ * With USE_EPOLL_EVENT, epoll(7) is used instead of select, on Linux.
+ * The number of fds is then not limited, the arrays grow as needed.
+ * Changes to the fds are applied before the next wait, so that a delete
+ * and add in the same loop, for a read/write toggle, is one epoll_ctl.
+ * Events set with minievent_set_exclusive, for the listening sockets, are
+ * added with EPOLLEXCLUSIVE, so that a query on a socket shared by the
+ * threads does not wake up all of them.
  */
 
 #ifndef MINI_EVENT_H
@@ -93,7 +101,7 @@
 /* needs our redblack tree */
 #include "rbtree.h"
 
-/** max number of file descriptors to support */
+/** max number of file descriptors to support, for epoll the start size */
 #define MAX_FDS 1024
 /** max number of signals to support */
 #define MAX_SIG 32
@@ -109,6 +117,24 @@ struct event_base
 	int maxfd;
 	/** capacity - size of the fds array */
 	int capfd;
+#ifdef USE_EPOLL_EVENT
+	/** the epoll file descriptor */
+	int epfd;
+	/** array of 0 - capfd, the bits registered with epoll for the fd,
+	 * and flags for pending changes */
+	short* regs;
+	/** array of 0 - capfd, the wait number when the fd was added,
+	 * events from that wait are stale for the fd */
+	unsigned int* gens;
+	/** the number of the current wait */
+	unsigned int gen;
+	/** list of fds with changes to apply before the next wait */
+	int* changes;
+	/** number of fds in the changes list */
+	int num_changes;
+	/** microseconds to poll for events before the wait sleeps */
+	int busy_poll;
+#else
 	/* fdset for read write, for fds ready, and added */
 	fd_set 
 		/** fds for reading */
@@ -119,6 +145,7 @@ struct event_base
 		ready, 
 		/** ready plus newly added events. */
 		content;
+#endif /* USE_EPOLL_EVENT */
 	/** array of 0 - maxsig of ptr to event for it */
 	struct event** signals;
 	/** if we need to exit */
@@ -127,6 +154,10 @@ struct event_base
 	time_t* time_secs;
 	/** where to store time in microseconds */
 	struct timeval* time_tv;
+	/** number of times the wait returned with events */
+	size_t num_wakeup;
+	/** number of fd events handled */
+	size_t num_handled;
 };
 
 /**
@@ -151,6 +182,9 @@ struct event {
 	void (*ev_callback)(int, short, void *arg);
 	/** callback user arg */
 	void *ev_arg;
+	/** if the fd is a listening socket, shared by the threads, that
+	 * wakes up only one of them, with epoll */
+	int ev_exclusive;
 };
 
 /* function prototypes (some are as they appear in event.h) */
@@ -190,6 +224,14 @@ int signal_add(struct event *, struct timeval *);
 /** remove signal handler */
 int signal_del(struct event *);
 
+/** set the microseconds to poll before the wait sleeps, for epoll */
+void minievent_set_busy_poll(struct event_base *, int);
+/** set the event for exclusive wakeup, the fd is shared by the threads */
+void minievent_set_exclusive(struct event *);
+/** get the number of wakeups and fd events handled, and clear them if
+ * reset is true */
+void minievent_get_counts(struct event_base *, size_t *, size_t *, int);
+
 #endif /* USE_MINI_EVENT and not USE_WINSOCK */
 
 /** compare events in tree, based on timevalue, ptr for uniqueness */
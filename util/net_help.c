@@ -1458,6 +1458,57 @@ int listen_sslctx_setup_ticket_keys(void* sslctx, struct config_strlist* tls_ses
 
 }
 
+int listen_sslctx_setup_session_cache(void* sslctx, int cache_size,
+	int have_ticket_keys)
+{
+#ifdef HAVE_SSL
+	SSL_CTX* ctx = (SSL_CTX*)sslctx;
+	if(cache_size <= 0) {
+		/* not configured, keep the defaults of the TLS library */
+		return 1;
+	}
+	/* the SSL_CTX is shared by the threads, and so is the cache,
+	 * a client can resume on another thread than it connected to */
+	SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+	(void)SSL_CTX_sess_set_cache_size(ctx, (long)cache_size);
+	if(!SSL_CTX_set_session_id_context(ctx,
+		(const unsigned char*)"unbound", 7)) {
+		log_crypto_err("could not SSL_CTX_set_session_id_context");
+		return 0;
+	}
+#ifdef SSL_OP_NO_TICKET
+	if(!have_ticket_keys) {
+		/* the cache is configured, and without configured keys the
+		 * tickets are encrypted with a random key, resume from the
+		 * session cache instead */
+		(void)SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+	}
+#else
+	(void)have_ticket_keys;
+#endif
+	return 1;
+#else
+	(void)sslctx;
+	(void)cache_size;
+	(void)have_ticket_keys;
+	return 0;
+#endif
+}
+
+int listen_sslctx_setup_ktls(void* sslctx)
+{
+#if defined(HAVE_SSL) && defined(SSL_OP_ENABLE_KTLS)
+	/* the record layer moves to the kernel after the handshake, if the
+	 * kernel supports it and the cipher, SSL_read and SSL_write then
+	 * become plain socket reads and writes */
+	(void)SSL_CTX_set_options((SSL_CTX*)sslctx, SSL_OP_ENABLE_KTLS);
+	return 1;
+#else
+	(void)sslctx;
+	return 0;
+#endif
+}
+
 #ifdef HAVE_SSL
 int tls_session_ticket_key_cb(SSL *ATTR_UNUSED(sslctx), unsigned char* key_name,
 	unsigned char* iv, EVP_CIPHER_CTX *evp_sctx,
@@ -478,6 +478,25 @@ void ub_openssl_lock_delete(void);
 int listen_sslctx_setup_ticket_keys(void* sslctx,
 	struct config_strlist* tls_session_ticket_keys);
 
+/**
+ * setup the TLS session cache, that is shared by the threads.
+ * @param sslctx: the SSL_CTX to use (from listen_sslctx_create())
+ * @param cache_size: max number of sessions in the cache, 0 keeps the
+ *	defaults of the TLS library, for the cache and for tickets.
+ * @param have_ticket_keys: if tls-session-ticket-keys are configured,
+ *	otherwise session tickets are turned off for the session cache.
+ * @return false on failure.
+ */
+int listen_sslctx_setup_session_cache(void* sslctx, int cache_size,
+	int have_ticket_keys);
+
+/**
+ * enable kernel TLS offload for the connections after the handshake.
+ * @param sslctx: the SSL_CTX to use (from listen_sslctx_create())
+ * @return false if not supported by the TLS library.
+ */
+int listen_sslctx_setup_ktls(void* sslctx);
+
 /** Free memory used for TLS session ticket keys */
 void listen_sslctx_delete_ticket_keys(void);
 
@@ -51,6 +51,16 @@
 #include "dnstap/dnstap.h"
 #include "dnscrypt/dnscrypt.h"
 #include "services/listen_dnsport.h"
+#ifdef HAVE_LINUX_IO_URING_H
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <poll.h>
+#include <sys/syscall.h>
+#if defined(IORING_RECV_MULTISHOT) && defined(__NR_io_uring_setup)
+/** the io_uring engine is compiled in, multishot recv needs linux 6.0 */
+#define USE_IO_URING 1
+#endif
+#endif
 #ifdef HAVE_OPENSSL_SSL_H
 #include <openssl/ssl.h>
 #endif
@@ -122,6 +132,8 @@ struct internal_base {
 	struct ub_event* slow_accept;
 	/** true if slow_accept is enabled */
 	int slow_accept_enabled;
+	/** the io_uring, or NULL if not in use */
+	struct comm_uring* uring;
 };
 
 /**
@@ -154,6 +166,28 @@ static struct comm_point* comm_point_create_tcp_handler(
 	struct sldns_buffer* spoolbuf, comm_point_callback_type* callback,
 	void* callback_arg);
 
+/** delete the io_uring of the comm base */
+static void comm_base_delete_uring(struct comm_base* b);
+/** stop receiving with the io_uring for the comm point that closes */
+static void comm_point_close_uring(struct comm_point* c);
+/** start the I/O of the comm point with the io_uring, false if it
+ * uses its events */
+static int comm_point_start_uring(struct comm_point* c);
+/** stop listening with the io_uring for the comm point */
+static void comm_point_stop_uring(struct comm_point* c);
+/** listen for read and write with the io_uring for the TCP stream */
+static void comm_point_listen_uring(struct comm_point* c, int rd, int wr);
+/** get the free handler of the accept comm point ready for a connection */
+static struct comm_point* tcp_accept_handler(struct comm_point* c);
+/** check the connection limit for the accepted connection, -1 if closed */
+static int tcp_accept_conn_limit(struct comm_point* c, int new_fd,
+	struct sockaddr_storage* addr, socklen_t addrlen);
+/** setup the handler for the accepted connection */
+static void tcp_accept_setup(struct comm_point* c, struct comm_point* c_hdl,
+	int new_fd);
+/** stop accepting for a while, out of file descriptors */
+static void tcp_accept_slow(struct comm_point* c);
+
 /* -------- End of local definitions -------- */
 
 struct comm_base* 
@@ -210,6 +244,7 @@ comm_base_delete(struct comm_base* b)
 		}
 		ub_event_free(b->eb->slow_accept);
 	}
+	comm_base_delete_uring(b);
 	ub_event_base_free(b->eb->base);
 	b->eb->base = NULL;
 	free(b->eb);
@@ -227,6 +262,7 @@ comm_base_delete_no_base(struct comm_base* b)
 		}
 		ub_event_free(b->eb->slow_accept);
 	}
+	comm_base_delete_uring(b);
 	b->eb->base = NULL;
 	free(b->eb);
 	free(b);
@@ -782,6 +818,1330 @@ comm_point_udp_callback(int fd, short event, void* arg)
 	}
 }
 
+#ifdef USE_IO_URING
+/** number of submission queue entries of the io_uring */
+#define URING_SQ_ENTRIES 256
+/** number of completion queue entries, multishot receives fill it fast */
+#define URING_CQ_ENTRIES 4096
+/** number of provided receive buffers, power of two */
+#define URING_NUM_BUFS 256
+/** size of a provided receive buffer, with the recvmsg header and name */
+#define URING_BUF_SIZE (sizeof(struct io_uring_recvmsg_out) + \
+	sizeof(struct sockaddr_storage) + COMM_URING_UDP_SIZE)
+/** the buffer group id of the provided receive buffers */
+#define URING_BGID 0
+/** number of UDP replies that can be in flight on the io_uring */
+#define URING_NUM_SEND 256
+/** size of the DNS message of a UDP reply on the io_uring, larger
+ * replies are sent with sendto */
+#define URING_SEND_SIZE 4096
+/** user_data kind for a multishot receive, index in the low bits */
+#define URING_UD_RECV 1
+/** user_data kind for a send, index in the low bits */
+#define URING_UD_SEND 2
+/** user_data kind for a cancel request */
+#define URING_UD_CANCEL 3
+/** user_data kind for an accept, index in the low bits */
+#define URING_UD_ACCEPT 4
+/** user_data kind for a receive on a TCP stream */
+#define URING_UD_TCP_RECV 5
+/** user_data kind for a send on a TCP stream */
+#define URING_UD_TCP_SEND 6
+/** user_data kind for a poll for writable on a TCP stream */
+#define URING_UD_TCP_POLL 7
+/** user_data kind for a nop, the TCP stream is handled again when it
+ * completes */
+#define URING_UD_TCP_NOP 8
+/** size of the receive buffer of a TCP stream on the io_uring */
+#define URING_TCP_IN 16384
+/** size of the send buffer of a TCP stream on the io_uring */
+#define URING_TCP_OUT 16384
+/** number of times a TCP stream is handled from its buffers in a row,
+ * before the other completions get a turn */
+#define URING_TCP_MAX_HANDLE 64
+/** make user_data from kind and index */
+#define URING_UD(kind, idx) ((((uint64_t)(kind))<<32) | (uint64_t)(idx))
+
+/**
+ * A multishot receive on the io_uring for a UDP comm point.
+ * It is freed when the kernel is done with it, that is when the last
+ * completion for it (without IORING_CQE_F_MORE) has arrived.
+ */
+struct uring_recv {
+	/** the comm point, or NULL if it is closed and a cancel is pending */
+	struct comm_point* c;
+	/** index in the receive array, for the user_data */
+	size_t idx;
+	/** message header for recvmsg, with the name length to reserve
+	 * in the provided buffers */
+	struct msghdr msg;
+	/** if the receive is armed in the kernel */
+	int armed;
+	/** if the receive has to be armed again */
+	int rearm;
+};
+
+/**
+ * A UDP reply in flight on the io_uring.
+ */
+struct uring_send {
+	/** next in free list */
+	struct uring_send* next;
+	/** message header for sendmsg */
+	struct msghdr msg;
+	/** the iovec for the data */
+	struct iovec iov;
+	/** the destination address */
+	struct sockaddr_storage addr;
+	/** the reply */
+	uint8_t data[URING_SEND_SIZE];
+};
+
+/**
+ * A TCP accept socket or a TCP stream on the io_uring.  For a stream, the
+ * receive fills the receive buffer, and the TCP read routines take the
+ * bytes from there, like from the socket.  The TCP write routines copy
+ * bytes into the send buffer, like into the socket, and a send request
+ * sends them.  The comm point is then handled like for its events.
+ * It is freed when it is closed and no requests are in flight.
+ */
+struct uring_tcp {
+	/** the comm point, or NULL if it is closed and requests are in
+	 * flight */
+	struct comm_point* c;
+	/** index in the tcp array, for the user_data */
+	size_t idx;
+	/** if this is an accept socket, and not a stream */
+	int accept;
+	/** number of requests in flight, and callbacks that run */
+	int inflight;
+	/** if the comm point listens for read, or for accept */
+	int want_read;
+	/** if the comm point listens for write */
+	int want_write;
+	/** if the receive, or the accept, is in flight */
+	int recv_armed;
+	/** if the send is in flight */
+	int send_armed;
+	/** if the poll for writable is in flight */
+	int poll_armed;
+	/** if the nop is in flight */
+	int nop_armed;
+	/** if the stream is connected and has no send in flight */
+	int writable;
+	/** the address from the accept */
+	struct sockaddr_storage addr;
+	/** length of the address from the accept */
+	socklen_t addrlen;
+	/** the receive buffer, with the bytes that are not read yet
+	 * between in_pos and in_len */
+	uint8_t* in;
+	/** position of the next byte to read in the receive buffer */
+	size_t in_pos;
+	/** number of bytes in the receive buffer */
+	size_t in_len;
+	/** if the stream is closed by the other side */
+	int in_eof;
+	/** errno of the receive, to return at the next read, or 0 */
+	int in_err;
+	/** the send buffer, with the bytes to send up to out_len */
+	uint8_t* out;
+	/** number of bytes of the send buffer that are sent */
+	size_t out_pos;
+	/** number of bytes in the send buffer */
+	size_t out_len;
+	/** errno of the send, to return at the next write, or 0 */
+	int out_err;
+};
+
+/**
+ * The io_uring of a comm base.  The completion queue is read when the
+ * event base signals the ring fd readable, and submissions are flushed
+ * with one io_uring_enter after a batch of completions is handled.
+ */
+struct comm_uring {
+	/** the io_uring fd */
+	int fd;
+	/** the read event for the ring fd */
+	struct ub_event* ev;
+	/** mmapped submission queue ring */
+	void* sq_ptr;
+	/** length of the sq_ptr mmap */
+	size_t sq_len;
+	/** mmapped completion queue ring, if separate from sq_ptr */
+	void* cq_ptr;
+	/** length of the cq_ptr mmap */
+	size_t cq_len;
+	/** mmapped submission queue entries */
+	struct io_uring_sqe* sqes;
+	/** length of the sqes mmap */
+	size_t sqes_len;
+	/** submission queue head, tail, mask, flags and index array */
+	unsigned* sq_khead, *sq_ktail, *sq_kflags, *sq_array;
+	/** mask for the submission queue */
+	unsigned sq_mask;
+	/** number of entries in the submission queue */
+	unsigned sq_entries;
+	/** tail of the submission queue that is not yet published */
+	unsigned sq_tail;
+	/** number of entries to submit */
+	unsigned to_submit;
+	/** completion queue head and tail */
+	unsigned* cq_khead, *cq_ktail;
+	/** mask for the completion queue */
+	unsigned cq_mask;
+	/** number of entries in the completion queue */
+	unsigned cq_entries;
+	/** completion queue entries */
+	struct io_uring_cqe* cqes;
+	/** the provided buffer ring, mmapped */
+	struct io_uring_buf_ring* br;
+	/** length of the br mmap */
+	size_t br_len;
+	/** if the buffer ring is registered */
+	int br_registered;
+	/** the provided buffer ring tail */
+	uint16_t br_tail;
+	/** the provided buffers */
+	uint8_t* bufs;
+	/** the multishot receives, by index, NULL for unused */
+	struct uring_recv** recvs;
+	/** size of the recvs array */
+	size_t num_recvs;
+	/** the send slots */
+	struct uring_send* sends;
+	/** free list of send slots */
+	struct uring_send* send_free;
+	/** the TCP accept sockets and streams, by index, NULL for unused */
+	struct uring_tcp** tcps;
+	/** size of the tcps array */
+	size_t num_tcps;
+	/** where to start looking for a free index in the tcps array */
+	size_t tcp_hint;
+	/** the stream whose callbacks run from its buffers, the nop is not
+	 * needed for it to be handled again */
+	struct uring_tcp* handling;
+	/** if the completions are handled, the submissions are done at the
+	 * end of the batch */
+	int in_handler;
+};
+
+/** io_uring_setup system call */
+static int
+uring_sys_setup(unsigned entries, struct io_uring_params* p)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+/** io_uring_enter system call */
+static int
+uring_sys_enter(int fd, unsigned to_submit, unsigned min_complete,
+	unsigned flags)
+{
+	return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+		flags, NULL, 0);
+}
+
+/** io_uring_register system call */
+static int
+uring_sys_register(int fd, unsigned opcode, void* arg, unsigned nr_args)
+{
+	return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/** submit the queued submission entries */
+static void
+uring_submit(struct comm_uring* u)
+{
+	int r;
+	if(u->to_submit == 0)
+		return;
+	__atomic_store_n(u->sq_ktail, u->sq_tail, __ATOMIC_RELEASE);
+	r = uring_sys_enter(u->fd, u->to_submit, 0, 0);
+	if(r < 0) {
+		if(errno != EAGAIN && errno != EBUSY && errno != EINTR)
+			log_err("io_uring_enter failed: %s", strerror(errno));
+		return;
+	}
+	if((unsigned)r >= u->to_submit)
+		u->to_submit = 0;
+	else	u->to_submit -= (unsigned)r;
+}
+
+/** submit the queued entries now, unless the completions are handled,
+ * then they are submitted at the end of the batch */
+static void
+uring_flush(struct comm_uring* u)
+{
+	if(!u->in_handler)
+		uring_submit(u);
+}
+
+/** get a cleared submission entry, or NULL if the queue is full */
+static struct io_uring_sqe*
+uring_get_sqe(struct comm_uring* u)
+{
+	struct io_uring_sqe* sqe;
+	unsigned head = __atomic_load_n(u->sq_khead, __ATOMIC_ACQUIRE);
+	if(u->sq_tail - head >= u->sq_entries) {
+		uring_submit(u);
+		head = __atomic_load_n(u->sq_khead, __ATOMIC_ACQUIRE);
+		if(u->sq_tail - head >= u->sq_entries)
+			return NULL;
+	}
+	sqe = &u->sqes[u->sq_tail & u->sq_mask];
+	memset(sqe, 0, sizeof(*sqe));
+	u->sq_array[u->sq_tail & u->sq_mask] = u->sq_tail & u->sq_mask;
+	u->sq_tail++;
+	u->to_submit++;
+	return sqe;
+}
+
+/** queue a cancel for the request with the user_data */
+static void
+uring_cancel(struct comm_uring* u, uint64_t ud)
+{
+	struct io_uring_sqe* sqe = uring_get_sqe(u);
+	if(!sqe) {
+		log_err("io_uring: could not cancel request");
+		return;
+	}
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->fd = -1;
+	sqe->addr = ud;
+	sqe->user_data = URING_UD(URING_UD_CANCEL, 0);
+}
+
+/** give a provided buffer back to the kernel */
+static void
+uring_buf_return(struct comm_uring* u, uint16_t bid)
+{
+	struct io_uring_buf* buf = &u->br->bufs[u->br_tail &
+		(URING_NUM_BUFS-1)];
+	buf->addr = (uint64_t)(uintptr_t)(u->bufs + (size_t)bid*URING_BUF_SIZE);
+	buf->len = (uint32_t)URING_BUF_SIZE;
+	buf->bid = bid;
+	u->br_tail++;
+	__atomic_store_n(&u->br->tail, u->br_tail, __ATOMIC_RELEASE);
+}
+
+/** arm the multishot receive, false if the queue is full */
+static int
+uring_recv_arm(struct comm_uring* u, struct uring_recv* r)
+{
+	struct io_uring_sqe* sqe = uring_get_sqe(u);
+	if(!sqe)
+		return 0;
+	sqe->opcode = IORING_OP_RECVMSG;
+	sqe->fd = r->c->fd;
+	sqe->addr = (uint64_t)(uintptr_t)&r->msg;
+	sqe->len = 1;
+	sqe->ioprio = IORING_RECV_MULTISHOT;
+	sqe->flags = IOSQE_BUFFER_SELECT;
+	sqe->buf_group = URING_BGID;
+	sqe->user_data = URING_UD(URING_UD_RECV, r->idx);
+	r->armed = 1;
+	r->rearm = 0;
+	return 1;
+}
+
+/** stop receiving with the io_uring for the comm point */
+static void
+uring_recv_stop(struct comm_uring* u, struct comm_point* c)
+{
+	struct uring_recv* r = c->uring_recv;
+	c->uring_recv = NULL;
+	r->c = NULL;
+	if(r->armed) {
+		/* the kernel holds a reference to the socket until the
+		 * receive is cancelled, it frees at the last completion */
+		uring_cancel(u, URING_UD(URING_UD_RECV, r->idx));
+		uring_submit(u);
+		return;
+	}
+	u->recvs[r->idx] = NULL;
+	free(r);
+}
+
+/** receive on the comm point with its read event again */
+static void
+uring_recv_fallback(struct comm_uring* u, struct comm_point* c)
+{
+	uring_recv_stop(u, c);
+	if(!c->event_added) {
+		if(ub_event_add(c->ev->ev, c->timeout) != 0) {
+			log_err("could not add udp event");
+			return;
+		}
+		c->event_added = 1;
+	}
+}
+
+/** send the reply to the UDP query with the io_uring, if possible */
+static void
+uring_send_udp(struct comm_uring* u, struct comm_point* c,
+	sldns_buffer* packet, struct sockaddr* addr, socklen_t addrlen)
+{
+	struct uring_send* s = u->send_free;
+	struct io_uring_sqe* sqe;
+	if(!s || sldns_buffer_remaining(packet) > URING_SEND_SIZE ||
+		addrlen > (socklen_t)sizeof(s->addr) ||
+		(sqe = uring_get_sqe(u)) == NULL) {
+		(void)comm_point_send_udp_msg(c, packet, addr, addrlen, 0);
+		return;
+	}
+	u->send_free = s->next;
+	s->next = NULL;
+	memmove(s->data, sldns_buffer_begin(packet),
+		sldns_buffer_remaining(packet));
+	memmove(&s->addr, addr, addrlen);
+	s->iov.iov_base = s->data;
+	s->iov.iov_len = sldns_buffer_remaining(packet);
+	memset(&s->msg, 0, sizeof(s->msg));
+	s->msg.msg_name = &s->addr;
+	s->msg.msg_namelen = addrlen;
+	s->msg.msg_iov = &s->iov;
+	s->msg.msg_iovlen = 1;
+	sqe->opcode = IORING_OP_SENDMSG;
+	sqe->fd = c->fd;
+	sqe->addr = (uint64_t)(uintptr_t)&s->msg;
+	sqe->len = 1;
+	sqe->user_data = URING_UD(URING_UD_SEND, (size_t)(s - u->sends));
+}
+
+/** handle a UDP packet received in a provided buffer, like
+ * comm_point_udp_callback does for a packet from recvfrom */
+static void
+uring_udp_packet(struct comm_uring* u, struct comm_point* c, uint8_t* buf,
+	size_t len)
+{
+	struct comm_reply rep;
+	struct io_uring_recvmsg_out* o = (struct io_uring_recvmsg_out*)buf;
+	uint8_t* payload;
+	struct sldns_buffer *buffer;
+	if(len < sizeof(*o))
+		return;
+	payload = buf + sizeof(*o) + c->uring_recv->msg.msg_namelen +
+		o->controllen;
+	if((o->flags & MSG_TRUNC) || o->namelen > sizeof(rep.addr) ||
+		(size_t)(payload - buf) + o->payloadlen > len) {
+		verbose(VERB_ALGO, "io_uring: drop truncated udp packet");
+		return;
+	}
+	rep.c = c;
+	sldns_buffer_clear(c->buffer);
+	if(o->payloadlen > sldns_buffer_remaining(c->buffer))
+		return;
+	sldns_buffer_write(c->buffer, payload, o->payloadlen);
+	sldns_buffer_flip(c->buffer);
+	rep.addrlen = (socklen_t)o->namelen;
+	memmove(&rep.addr, buf + sizeof(*o), o->namelen);
+	rep.srctype = 0;
+	fptr_ok(fptr_whitelist_comm_point(c->callback));
+	if((*c->callback)(c, c->cb_arg, NETEVENT_NOERROR, &rep)) {
+		/* send back immediate reply */
+#ifdef USE_DNSCRYPT
+		buffer = c->dnscrypt_buffer;
+#else
+		buffer = c->buffer;
+#endif
+		uring_send_udp(u, c, buffer, (struct sockaddr*)&rep.addr,
+			rep.addrlen);
+	}
+}
+
+/** handle a completion for a multishot receive */
+static void
+uring_handle_recv(struct comm_uring* u, size_t idx, int res, uint32_t flags)
+{
+	struct uring_recv* r;
+	if(idx >= u->num_recvs || (r = u->recvs[idx]) == NULL)
+		return;
+	if((flags & IORING_CQE_F_BUFFER)) {
+		uint16_t bid = (uint16_t)(flags >> IORING_CQE_BUFFER_SHIFT);
+		if(r->c && res > 0)
+			uring_udp_packet(u, r->c, u->bufs +
+				(size_t)bid*URING_BUF_SIZE, (size_t)res);
+		uring_buf_return(u, bid);
+	}
+	/* the callback may have closed the comm point */
+	if((flags & IORING_CQE_F_MORE))
+		return;
+	r->armed = 0;
+	if(!r->c) {
+		u->recvs[idx] = NULL;
+		free(r);
+	} else if(res < 0 && res != -ENOBUFS && res != -EINTR &&
+		res != -EAGAIN && udp_recv_needs_log(-res)) {
+		log_warn("io_uring receive on fd %d failed: %s, using "
+			"events for it", r->c->fd, strerror(-res));
+		uring_recv_fallback(u, r->c);
+	} else {
+		/* multishot stopped, out of buffers or overflowed CQ,
+		 * or an ICMP error from the connected socket */
+		r->rearm = 1;
+	}
+}
+
+/** handle a completion for a send */
+static void
+uring_handle_send(struct comm_uring* u, size_t idx, int res)
+{
+	struct uring_send* s;
+	if(idx >= URING_NUM_SEND)
+		return;
+	s = &u->sends[idx];
+	if(res < 0) {
+		errno = -res;
+		if(udp_send_errno_needs_log((struct sockaddr*)&s->addr,
+			s->msg.msg_namelen)) {
+			verbose(VERB_OPS, "sendmsg failed: %s",
+				sock_strerror(errno));
+			log_addr(VERB_OPS, "remote address is", &s->addr,
+				s->msg.msg_namelen);
+		}
+	} else if((size_t)res != s->iov.iov_len) {
+		log_err("sent %d in place of %d bytes", res,
+			(int)s->iov.iov_len);
+	}
+	s->next = u->send_free;
+	u->send_free = s;
+}
+
+/** register the TCP accept socket or stream of the comm point, with the
+ * buffers for a stream, NULL on malloc failure */
+static struct uring_tcp*
+uring_tcp_create(struct comm_uring* u, struct comm_point* c, int accept)
+{
+	struct uring_tcp* t;
+	size_t i, idx = u->num_tcps;
+	for(i=0; i<u->num_tcps; i++) {
+		size_t j = (u->tcp_hint + i) % u->num_tcps;
+		if(!u->tcps[j]) {
+			idx = j;
+			break;
+		}
+	}
+	if(idx == u->num_tcps) {
+		size_t newnum = u->num_tcps?u->num_tcps*2:16;
+		struct uring_tcp** n = (struct uring_tcp**)reallocarray(
+			u->tcps, newnum, sizeof(*n));
+		if(!n) {
+			log_err("io_uring: out of memory");
+			return NULL;
+		}
+		memset(n+u->num_tcps, 0, (newnum-u->num_tcps)*sizeof(*n));
+		u->tcps = n;
+		u->num_tcps = newnum;
+	}
+	t = (struct uring_tcp*)calloc(1, sizeof(*t) +
+		(accept?0:URING_TCP_IN+URING_TCP_OUT));
+	if(!t) {
+		log_err("io_uring: out of memory");
+		return NULL;
+	}
+	t->c = c;
+	t->idx = idx;
+	t->accept = accept;
+	if(!accept) {
+		t->in = (uint8_t*)(t+1);
+		t->out = t->in + URING_TCP_IN;
+		/* a connect in progress is polled for writable first */
+		t->writable = !c->tcp_check_nb_connect;
+	}
+	u->tcps[idx] = t;
+	u->tcp_hint = idx+1;
+	c->uring_tcp = t;
+	return t;
+}
+
+/** free the registration, when it is closed and nothing is in flight */
+static void
+uring_tcp_free(struct comm_uring* u, struct uring_tcp* t)
+{
+	u->tcps[t->idx] = NULL;
+	free(t);
+}
+
+/** get a submission entry for a request of the TCP registration */
+static struct io_uring_sqe*
+uring_tcp_sqe(struct comm_uring* u, struct uring_tcp* t, int kind)
+{
+	struct io_uring_sqe* sqe = uring_get_sqe(u);
+	if(!sqe) {
+		log_err("io_uring: submission queue full, for fd %d",
+			t->c->fd);
+		return NULL;
+	}
+	sqe->fd = t->c->fd;
+	sqe->user_data = URING_UD(kind, t->idx);
+	t->inflight++;
+	return sqe;
+}
+
+/** accept on the socket, if the comm point listens and has a free handler */
+static void
+uring_accept_arm(struct comm_uring* u, struct uring_tcp* t)
+{
+	struct io_uring_sqe* sqe;
+	if(t->recv_armed || !t->want_read || !t->c->tcp_free)
+		return;
+	if(!(sqe = uring_tcp_sqe(u, t, URING_UD_ACCEPT)))
+		return;
+	t->addrlen = (socklen_t)sizeof(t->addr);
+	sqe->opcode = IORING_OP_ACCEPT;
+	sqe->addr = (uint64_t)(uintptr_t)&t->addr;
+	sqe->addr2 = (uint64_t)(uintptr_t)&t->addrlen;
+	sqe->accept_flags = SOCK_NONBLOCK;
+	t->recv_armed = 1;
+}
+
+/** handle the new connection from the accept, like
+ * comm_point_tcp_accept_callback does for a connection from accept() */
+static void
+uring_accept_done(struct uring_tcp* t, int res)
+{
+	struct comm_point* c = t->c, *c_hdl;
+	ub_comm_base_now(c->ev->base);
+	if(res < 0) {
+		/* the others are signal interrupt, closed connection,
+		 * or the stop of listening */
+		if(res == -EMFILE || res == -ENFILE)
+			tcp_accept_slow(c);
+		else if(res != -EINTR && res != -EAGAIN &&
+			res != -ECONNABORTED && res != -EPROTO &&
+			res != -ECANCELED)
+			log_err("accept failed: %s", strerror(-res));
+		return;
+	}
+	if(t->addrlen > (socklen_t)sizeof(t->addr) ||
+		(c_hdl = tcp_accept_handler(c)) == NULL) {
+		sock_close(res);
+		return;
+	}
+	memmove(&c_hdl->repinfo.addr, &t->addr, t->addrlen);
+	c_hdl->repinfo.addrlen = t->addrlen;
+	if(tcp_accept_conn_limit(c, res, &c_hdl->repinfo.addr,
+		c_hdl->repinfo.addrlen) == -1)
+		return;
+	tcp_accept_setup(c, c_hdl, res);
+}
+
+/** if the stream has bytes, the end or an error for the read routine */
+static int
+uring_tcp_readable(struct uring_tcp* t)
+{
+	return t->in_pos < t->in_len || t->in_eof || t->in_err;
+}
+
+/** if the stream can take bytes, or has an error, for the write routine */
+static int
+uring_tcp_writable(struct uring_tcp* t)
+{
+	return !t->send_armed && (t->writable || t->out_err);
+}
+
+/** submit the requests that the stream needs for what it listens for */
+static void
+uring_tcp_arm(struct comm_uring* u, struct uring_tcp* t)
+{
+	struct io_uring_sqe* sqe;
+	int ready = 0;
+	if(t->want_read) {
+		if(uring_tcp_readable(t))
+			ready = 1;
+		else if(!t->recv_armed && (sqe = uring_tcp_sqe(u, t,
+			URING_UD_TCP_RECV)) != NULL) {
+			sqe->opcode = IORING_OP_RECV;
+			sqe->addr = (uint64_t)(uintptr_t)t->in;
+			sqe->len = URING_TCP_IN;
+			t->recv_armed = 1;
+		}
+	}
+	if(t->want_write) {
+		if(uring_tcp_writable(t))
+			ready = 1;
+		else if(!t->send_armed && !t->poll_armed && (sqe =
+			uring_tcp_sqe(u, t, URING_UD_TCP_POLL)) != NULL) {
+			sqe->opcode = IORING_OP_POLL_ADD;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			/* the kernel reads the 16 bit mask in the high half */
+			sqe->poll32_events = ((uint32_t)POLLOUT)<<16;
+#else
+			sqe->poll32_events = POLLOUT;
+#endif
+			t->poll_armed = 1;
+		}
+	}
+	/* it is ready without a completion from the socket, the nop
+	 * completes to handle it, like an event that fires right away */
+	if(ready && t != u->handling && !t->nop_armed &&
+		(sqe = uring_tcp_sqe(u, t, URING_UD_TCP_NOP)) != NULL) {
+		sqe->opcode = IORING_OP_NOP;
+		sqe->fd = -1;
+		t->nop_armed = 1;
+	}
+}
+
+/** submit the send of the bytes in the send buffer that are not sent */
+static void
+uring_tcp_send_rest(struct comm_uring* u, struct uring_tcp* t)
+{
+	struct io_uring_sqe* sqe = uring_tcp_sqe(u, t, URING_UD_TCP_SEND);
+	if(!sqe) {
+		t->out_err = ENOBUFS;
+		t->send_armed = 0;
+		return;
+	}
+	sqe->opcode = IORING_OP_SEND;
+	sqe->addr = (uint64_t)(uintptr_t)(t->out + t->out_pos);
+	sqe->len = (uint32_t)(t->out_len - t->out_pos);
+	sqe->msg_flags = MSG_NOSIGNAL;
+	t->send_armed = 1;
+}
+
+/** read from the receive buffer of the stream, like recv() */
+static ssize_t
+uring_tcp_recv(struct uring_tcp* t, void* buf, size_t len)
+{
+	if(t->in_pos < t->in_len) {
+		if(len > t->in_len - t->in_pos)
+			len = t->in_len - t->in_pos;
+		memmove(buf, t->in + t->in_pos, len);
+		t->in_pos += len;
+		return (ssize_t)len;
+	}
+	if(t->in_err) {
+		errno = t->in_err;
+		t->in_err = 0;
+		t->in_eof = 1;
+		return -1;
+	}
+	if(t->in_eof)
+		return 0;
+	errno = EAGAIN;
+	return -1;
+}
+
+/** write into the send buffer of the stream and send it, like writev(),
+ * the bytes that fit are taken, like the socket buffer takes them */
+static ssize_t
+uring_tcp_writev(struct uring_tcp* t, struct iovec* iov, int iovcnt)
+{
+	struct comm_uring* u = t->c->ev->base->eb->uring;
+	size_t len = 0, n;
+	int i;
+	if(t->out_err) {
+		errno = t->out_err;
+		t->out_err = 0;
+		return -1;
+	}
+	if(t->send_armed) {
+		errno = EAGAIN;
+		return -1;
+	}
+	for(i=0; i<iovcnt && len < URING_TCP_OUT; i++) {
+		n = iov[i].iov_len;
+		if(n > URING_TCP_OUT - len)
+			n = URING_TCP_OUT - len;
+		memmove(t->out + len, iov[i].iov_base, n);
+		len += n;
+	}
+	t->out_pos = 0;
+	t->out_len = len;
+	uring_tcp_send_rest(u, t);
+	uring_flush(u);
+	return (ssize_t)len;
+}
+
+/** run the callbacks of the stream, like for its events, while it has
+ * bytes to read or can write */
+static void
+uring_tcp_handle(struct comm_uring* u, struct uring_tcp* t)
+{
+	struct comm_point* c = t->c;
+	int n = 0;
+	/* hold it, the callbacks can close the comm point */
+	t->inflight++;
+	u->handling = t;
+	while(t->c == c && n++ < URING_TCP_MAX_HANDLE) {
+		if(t->want_read && uring_tcp_readable(t))
+			comm_point_tcp_handle_callback(c->fd, UB_EV_READ, c);
+		else if(t->want_write && uring_tcp_writable(t))
+			comm_point_tcp_handle_callback(c->fd, UB_EV_WRITE, c);
+		else	break;
+	}
+	if(u->handling == t)
+		u->handling = NULL;
+	t->inflight--;
+	if(!t->c) {
+		if(t->inflight == 0)
+			uring_tcp_free(u, t);
+		return;
+	}
+	uring_tcp_arm(u, t);
+}
+
+/** handle a completion for a TCP accept socket or stream */
+static void
+uring_handle_tcp(struct comm_uring* u, int kind, size_t idx, int res)
+{
+	struct uring_tcp* t;
+	if(idx >= u->num_tcps || (t = u->tcps[idx]) == NULL)
+		return;
+	t->inflight--;
+	switch(kind) {
+	case URING_UD_ACCEPT:
+		t->recv_armed = 0;
+		if(t->c)
+			uring_accept_done(t, res);
+		else if(res >= 0)
+			sock_close(res);
+		break;
+	case URING_UD_TCP_RECV:
+		t->recv_armed = 0;
+		if(res > 0) {
+			t->in_pos = 0;
+			t->in_len = (size_t)res;
+		} else if(res == 0) {
+			t->in_eof = 1;
+		} else if(res != -EINTR && res != -EAGAIN &&
+			res != -ECANCELED) {
+			t->in_err = -res;
+		}
+		break;
+	case URING_UD_TCP_SEND:
+		if(res == -EINTR || res == -EAGAIN)
+			res = 0;
+		if(res < 0) {
+			t->out_err = -res;
+			t->send_armed = 0;
+			break;
+		}
+		t->out_pos += (size_t)res;
+		if(t->out_pos < t->out_len && t->c) {
+			/* a short send, send the rest */
+			uring_tcp_send_rest(u, t);
+			return;
+		}
+		t->send_armed = 0;
+		t->writable = 1;
+		break;
+	case URING_UD_TCP_POLL:
+		t->poll_armed = 0;
+		/* also for an error or hangup, the write routine picks
+		 * up the socket error */
+		if(res > 0)
+			t->writable = 1;
+		break;
+	case URING_UD_TCP_NOP:
+		t->nop_armed = 0;
+		break;
+	default:
+		break;
+	}
+	if(!t->c) {
+		if(t->inflight == 0)
+			uring_tcp_free(u, t);
+		return;
+	}
+	if(t->accept)
+		uring_accept_arm(u, t);
+	else	uring_tcp_handle(u, t);
+}
+
+/** stop the io_uring requests of the comm point that closes */
+static void
+uring_tcp_stop(struct comm_uring* u, struct comm_point* c)
+{
+	struct uring_tcp* t = c->uring_tcp;
+	c->uring_tcp = NULL;
+	t->c = NULL;
+	if(u->handling == t)
+		u->handling = NULL;
+	/* the kernel holds a reference to the socket until the requests
+	 * complete.  A send in flight completes, like the bytes in the
+	 * socket buffer are sent after the close. */
+	if(t->recv_armed)
+		uring_cancel(u, URING_UD(t->accept?URING_UD_ACCEPT:
+			URING_UD_TCP_RECV, t->idx));
+	if(t->poll_armed)
+		uring_cancel(u, URING_UD(URING_UD_TCP_POLL, t->idx));
+	/* the queued requests name the fd, submit them before it is
+	 * closed and the number is used again */
+	uring_submit(u);
+	if(t->inflight == 0)
+		uring_tcp_free(u, t);
+}
+
+void
+comm_base_handle_uring(int ATTR_UNUSED(fd), short event, void* arg)
+{
+	struct comm_base* b = (struct comm_base*)arg;
+	struct comm_uring* u = b->eb->uring;
+	unsigned head, tail, n = 0;
+	size_t i;
+	if(!(event&UB_EV_READ) || !u)
+		return;
+	ub_comm_base_now(b);
+	u->in_handler = 1;
+	head = *u->cq_khead;
+	tail = __atomic_load_n(u->cq_ktail, __ATOMIC_ACQUIRE);
+	while(head != tail && n < u->cq_entries) {
+		struct io_uring_cqe* cqe = &u->cqes[head & u->cq_mask];
+		uint64_t ud = cqe->user_data;
+		int res = cqe->res;
+		uint32_t flags = cqe->flags;
+		head++;
+		n++;
+		/* consume the entry before the callback, it can submit */
+		__atomic_store_n(u->cq_khead, head, __ATOMIC_RELEASE);
+		switch((int)(ud>>32)) {
+		case URING_UD_RECV:
+			uring_handle_recv(u, (size_t)(ud&0xffffffff), res,
+				flags);
+			break;
+		case URING_UD_SEND:
+			uring_handle_send(u, (size_t)(ud&0xffffffff), res);
+			break;
+		case URING_UD_ACCEPT:
+		case URING_UD_TCP_RECV:
+		case URING_UD_TCP_SEND:
+		case URING_UD_TCP_POLL:
+		case URING_UD_TCP_NOP:
+			uring_handle_tcp(u, (int)(ud>>32),
+				(size_t)(ud&0xffffffff), res);
+			break;
+		default:
+			break;
+		}
+		if(head == tail)
+			tail = __atomic_load_n(u->cq_ktail, __ATOMIC_ACQUIRE);
+	}
+	for(i=0; i<u->num_recvs; i++) {
+		if(u->recvs[i] && u->recvs[i]->rearm && u->recvs[i]->c)
+			(void)uring_recv_arm(u, u->recvs[i]);
+	}
+	u->in_handler = 0;
+	uring_submit(u);
+	if((__atomic_load_n(u->sq_kflags, __ATOMIC_RELAXED) &
+		IORING_SQ_CQ_OVERFLOW)) {
+		/* flush the overflowed completions into the ring, they are
+		 * picked up when the event fires again */
+		if(uring_sys_enter(u->fd, 0, 0, IORING_ENTER_GETEVENTS) < 0
+			&& errno != EINTR && errno != EAGAIN && errno != EBUSY)
+			log_err("io_uring_enter failed: %s", strerror(errno));
+	}
+}
+
+/** delete the io_uring, also when partially setup */
+static void
+comm_uring_delete(struct comm_uring* u)
+{
+	size_t i;
+	if(!u)
+		return;
+	if(u->ev) {
+		(void)ub_event_del(u->ev);
+		ub_event_free(u->ev);
+	}
+	for(i=0; i<u->num_recvs; i++) {
+		if(!u->recvs[i])
+			continue;
+		if(u->recvs[i]->c)
+			u->recvs[i]->c->uring_recv = NULL;
+		free(u->recvs[i]);
+	}
+	free(u->recvs);
+	for(i=0; i<u->num_tcps; i++) {
+		if(!u->tcps[i])
+			continue;
+		if(u->tcps[i]->c)
+			u->tcps[i]->c->uring_tcp = NULL;
+		free(u->tcps[i]);
+	}
+	free(u->tcps);
+	/* closing the ring cancels the requests that are in flight */
+	if(u->fd != -1)
+		close(u->fd);
+	if(u->sqes)
+		munmap(u->sqes, u->sqes_len);
+	if(u->cq_ptr)
+		munmap(u->cq_ptr, u->cq_len);
+	if(u->sq_ptr)
+		munmap(u->sq_ptr, u->sq_len);
+	if(u->br)
+		munmap(u->br, u->br_len);
+	free(u->bufs);
+	free(u->sends);
+	free(u);
+}
+
+/** mmap part of the io_uring, or NULL */
+static void*
+uring_mmap(int fd, size_t len, off_t off)
+{
+	void* p = mmap(NULL, len, PROT_READ|PROT_WRITE,
+		MAP_SHARED|MAP_POPULATE, fd, off);
+	if(p == MAP_FAILED) {
+		log_err("io_uring mmap failed: %s", strerror(errno));
+		return NULL;
+	}
+	return p;
+}
+
+int
+comm_base_setup_uring(struct comm_base* b)
+{
+	struct io_uring_params p;
+	struct io_uring_buf_reg reg;
+	struct comm_uring* u;
+	uint8_t* sq;
+	uint8_t* cq;
+	uint16_t i;
+	if(b->eb->uring)
+		return 1;
+	u = (struct comm_uring*)calloc(1, sizeof(*u));
+	if(!u) {
+		log_err("io_uring: out of memory");
+		return 0;
+	}
+	memset(&p, 0, sizeof(p));
+	p.flags = IORING_SETUP_CQSIZE;
+	p.cq_entries = URING_CQ_ENTRIES;
+	/* no IORING_SETUP_DEFER_TASKRUN, with it the completions are not
+	 * signalled on the ring fd, that the event loop polls */
+	u->fd = uring_sys_setup(URING_SQ_ENTRIES, &p);
+	if(u->fd == -1) {
+		log_err("io_uring_setup failed: %s", strerror(errno));
+		free(u);
+		return 0;
+	}
+	fd_set_nonblock(u->fd);
+	u->sq_len = p.sq_off.array + p.sq_entries*sizeof(unsigned);
+	u->cq_len = p.cq_off.cqes + p.cq_entries*sizeof(struct io_uring_cqe);
+	if((p.features & IORING_FEAT_SINGLE_MMAP)) {
+		if(u->cq_len > u->sq_len)
+			u->sq_len = u->cq_len;
+		u->cq_len = 0;
+	}
+	if(!(u->sq_ptr = uring_mmap(u->fd, u->sq_len, IORING_OFF_SQ_RING))) {
+		comm_uring_delete(u);
+		return 0;
+	}
+	if(u->cq_len && !(u->cq_ptr = uring_mmap(u->fd, u->cq_len,
+		IORING_OFF_CQ_RING))) {
+		comm_uring_delete(u);
+		return 0;
+	}
+	u->sqes_len = p.sq_entries*sizeof(struct io_uring_sqe);
+	if(!(u->sqes = (struct io_uring_sqe*)uring_mmap(u->fd, u->sqes_len,
+		IORING_OFF_SQES))) {
+		comm_uring_delete(u);
+		return 0;
+	}
+	sq = (uint8_t*)u->sq_ptr;
+	cq = u->cq_ptr?(uint8_t*)u->cq_ptr:sq;
+	u->sq_khead = (unsigned*)(sq + p.sq_off.head);
+	u->sq_ktail = (unsigned*)(sq + p.sq_off.tail);
+	u->sq_kflags = (unsigned*)(sq + p.sq_off.flags);
+	u->sq_array = (unsigned*)(sq + p.sq_off.array);
+	u->sq_mask = *(unsigned*)(sq + p.sq_off.ring_mask);
+	u->sq_entries = p.sq_entries;
+	u->sq_tail = *u->sq_ktail;
+	u->cq_khead = (unsigned*)(cq + p.cq_off.head);
+	u->cq_ktail = (unsigned*)(cq + p.cq_off.tail);
+	u->cq_mask = *(unsigned*)(cq + p.cq_off.ring_mask);
+	u->cq_entries = p.cq_entries;
+	u->cqes = (struct io_uring_cqe*)(cq + p.cq_off.cqes);
+
+	/* the provided buffer ring for the multishot receives */
+	u->br_len = URING_NUM_BUFS*sizeof(struct io_uring_buf);
+	u->br = (struct io_uring_buf_ring*)mmap(NULL, u->br_len,
+		PROT_READ|PROT_WRITE, MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
+	if(u->br == MAP_FAILED) {
+		log_err("io_uring mmap failed: %s", strerror(errno));
+		u->br = NULL;
+		comm_uring_delete(u);
+		return 0;
+	}
+	u->bufs = (uint8_t*)malloc((size_t)URING_NUM_BUFS*URING_BUF_SIZE);
+	u->sends = (struct uring_send*)calloc(URING_NUM_SEND,
+		sizeof(struct uring_send));
+	if(!u->bufs || !u->sends) {
+		log_err("io_uring: out of memory");
+		comm_uring_delete(u);
+		return 0;
+	}
+	memset(&reg, 0, sizeof(reg));
+	reg.ring_addr = (uint64_t)(uintptr_t)u->br;
+	reg.ring_entries = URING_NUM_BUFS;
+	reg.bgid = URING_BGID;
+	if(uring_sys_register(u->fd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+		log_err("io_uring register buffer ring failed: %s",
+			strerror(errno));
+		comm_uring_delete(u);
+		return 0;
+	}
+	for(i=0; i<URING_NUM_BUFS; i++)
+		uring_buf_return(u, i);
+	for(i=URING_NUM_SEND; i>0; i--) {
+		u->sends[i-1].next = u->send_free;
+		u->send_free = &u->sends[i-1];
+	}
+
+	u->ev = ub_event_new(b->eb->base, u->fd, UB_EV_READ | UB_EV_PERSIST,
+		comm_base_handle_uring, b);
+	if(!u->ev) {
+		log_err("io_uring: could not create event");
+		comm_uring_delete(u);
+		return 0;
+	}
+	if(ub_event_add(u->ev, NULL) != 0) {
+		log_err("io_uring: could not add event");
+		ub_event_free(u->ev);
+		u->ev = NULL;
+		comm_uring_delete(u);
+		return 0;
+	}
+	b->eb->uring = u;
+	verbose(VERB_ALGO, "io_uring setup on fd %d", u->fd);
+	return 1;
+}
+
+/** receive on the UDP comm point with a multishot receive */
+static int
+uring_recv_start(struct comm_uring* u, struct comm_point* c)
+{
+	struct uring_recv* r;
+	size_t idx;
+	for(idx=0; idx<u->num_recvs; idx++)
+		if(!u->recvs[idx])
+			break;
+	if(idx == u->num_recvs) {
+		size_t newnum = u->num_recvs?u->num_recvs*2:8;
+		struct uring_recv** n = (struct uring_recv**)reallocarray(
+			u->recvs, newnum, sizeof(*n));
+		if(!n) {
+			log_err("io_uring: out of memory");
+			return 0;
+		}
+		memset(n+u->num_recvs, 0, (newnum-u->num_recvs)*sizeof(*n));
+		u->recvs = n;
+		u->num_recvs = newnum;
+	}
+	r = (struct uring_recv*)calloc(1, sizeof(*r));
+	if(!r) {
+		log_err("io_uring: out of memory");
+		return 0;
+	}
+	r->c = c;
+	r->idx = idx;
+	r->msg.msg_namelen = (socklen_t)sizeof(struct sockaddr_storage);
+	if(!uring_recv_arm(u, r)) {
+		free(r);
+		return 0;
+	}
+	u->recvs[idx] = r;
+	c->uring_recv = r;
+	uring_flush(u);
+	return 1;
+}
+
+static int
+comm_point_start_uring(struct comm_point* c)
+{
+	struct comm_uring* u = c->ev->base->eb->uring;
+	struct uring_tcp* t;
+	if(!u || c->fd == -1)
+		return 0;
+	switch(c->type) {
+	case comm_udp:
+		if(!c->uring_recv && !uring_recv_start(u, c))
+			return 0;
+		return 1;
+	case comm_tcp_accept:
+		if(!(t = c->uring_tcp) && !(t = uring_tcp_create(u, c, 1)))
+			return 0;
+		t->want_read = 1;
+		uring_accept_arm(u, t);
+		uring_flush(u);
+		return 1;
+	case comm_tcp:
+		/* the TLS stream reads and writes with SSL on the socket */
+		if(c->ssl)
+			return 0;
+		if(!(t = c->uring_tcp) && !(t = uring_tcp_create(u, c, 0)))
+			return 0;
+		t->want_read = c->tcp_write_and_read || c->tcp_is_reading;
+		t->want_write = c->tcp_write_and_read || !c->tcp_is_reading;
+		uring_tcp_arm(u, t);
+		uring_flush(u);
+		return 1;
+	default:
+		break;
+	}
+	return 0;
+}
+
+static void
+comm_point_stop_uring(struct comm_point* c)
+{
+	struct comm_uring* u = c->ev->base->eb->uring;
+	struct uring_tcp* t = c->uring_tcp;
+	if(c->uring_recv) {
+		uring_recv_stop(u, c);
+		return;
+	}
+	t->want_read = 0;
+	t->want_write = 0;
+	if(t->accept && t->recv_armed) {
+		/* stop accepting, a connection that is accepted before the
+		 * cancel is handled if there is a free handler */
+		uring_cancel(u, URING_UD(URING_UD_ACCEPT, t->idx));
+		uring_flush(u);
+	}
+}
+
+static void
+comm_point_listen_uring(struct comm_point* c, int rd, int wr)
+{
+	struct comm_uring* u = c->ev->base->eb->uring;
+	c->uring_tcp->want_read = rd;
+	c->uring_tcp->want_write = wr;
+	uring_tcp_arm(u, c->uring_tcp);
+	uring_flush(u);
+}
+
+int
+comm_point_use_uring(struct comm_point* c)
+{
+	int i;
+	if(!c->ev->base->eb->uring)
+		return 0;
+	c->use_uring = 1;
+	for(i=0; i<c->max_tcp_count; i++)
+		c->tcp_handlers[i]->use_uring = 1;
+	if(c->event_added && (c->type == comm_udp ||
+		c->type == comm_tcp_accept) && comm_point_start_uring(c)) {
+		/* the listening socket moves from its event to the io_uring */
+		if(ub_event_del(c->ev->ev) != 0)
+			log_err("could not event_del for io_uring");
+		c->event_added = 0;
+	}
+	return 1;
+}
+
+static void
+comm_base_delete_uring(struct comm_base* b)
+{
+	comm_uring_delete(b->eb->uring);
+	b->eb->uring = NULL;
+}
+
+static void
+comm_point_close_uring(struct comm_point* c)
+{
+	if(c->uring_recv)
+		uring_recv_stop(c->ev->base->eb->uring, c);
+	if(c->uring_tcp)
+		uring_tcp_stop(c->ev->base->eb->uring, c);
+}
+#else /* USE_IO_URING */
+void
+comm_base_handle_uring(int ATTR_UNUSED(fd), short ATTR_UNUSED(event),
+	void* ATTR_UNUSED(arg))
+{
+}
+
+int
+comm_base_setup_uring(struct comm_base* ATTR_UNUSED(b))
+{
+	log_err("io_uring is not compiled in or not supported by the "
+		"kernel headers");
+	return 0;
+}
+
+static int
+comm_point_start_uring(struct comm_point* ATTR_UNUSED(c))
+{
+	return 0;
+}
+
+static void
+comm_point_stop_uring(struct comm_point* ATTR_UNUSED(c))
+{
+}
+
+static void
+comm_point_listen_uring(struct comm_point* ATTR_UNUSED(c),
+	int ATTR_UNUSED(rd), int ATTR_UNUSED(wr))
+{
+}
+
+int
+comm_point_use_uring(struct comm_point* ATTR_UNUSED(c))
+{
+	return 0;
+}
+
+static void
+comm_base_delete_uring(struct comm_base* ATTR_UNUSED(b))
+{
+}
+
+static void
+comm_point_close_uring(struct comm_point* ATTR_UNUSED(c))
+{
+}
+#endif /* USE_IO_URING */
+
+/** recv on the TCP stream, from its io_uring receive buffer if it has one */
+static ssize_t
+tcp_stream_recv(struct comm_point* c, int fd, void* buf, size_t len)
+{
+#ifdef USE_IO_URING
+	if(c->uring_tcp)
+		return uring_tcp_recv(c->uring_tcp, buf, len);
+#endif
+	return recv(fd, buf, len, 0);
+}
+
+#ifdef HAVE_WRITEV
+/** writev on the TCP stream, into its io_uring send buffer if it has one */
+static ssize_t
+tcp_stream_writev(struct comm_point* c, int fd, struct iovec* iov,
+	int iovcnt)
+{
+#ifdef USE_IO_URING
+	if(c->uring_tcp)
+		return uring_tcp_writev(c->uring_tcp, iov, iovcnt);
+#endif
+	return writev(fd, iov, iovcnt);
+}
+#endif /* HAVE_WRITEV */
+
+/** send on the TCP stream, into its io_uring send buffer if it has one */
+static ssize_t
+tcp_stream_send(struct comm_point* c, int fd, void* buf, size_t len)
+{
+#ifdef USE_IO_URING
+	if(c->uring_tcp) {
+		struct iovec iov;
+		iov.iov_base = buf;
+		iov.iov_len = len;
+		return uring_tcp_writev(c->uring_tcp, &iov, 1);
+	}
+#endif
+	return send(fd, buf, len, 0);
+}
+
+void
+comm_point_set_exclusive(struct comm_point* c)
+{
+	ub_event_set_exclusive(c->ev->ev);
+}
+
 int adjusted_tcp_timeout(struct comm_point* c)
 {
 	if(c->tcp_timeout_msec < TCP_QUERY_TIMEOUT_MINIMUM)
@@ -803,6 +2163,7 @@ setup_tcp_handler(struct comm_point* c, int fd, int cur, int max)
 #endif
 	c->tcp_is_reading = 1;
 	c->tcp_byte_count = 0;
+	c->tcp_write_prefixed = 0;
 	/* if more than half the tcp handlers are in use, use a shorter
 	 * timeout for this TCP connection, we need to make space for
 	 * other connections to be able to get attention */
@@ -838,6 +2199,52 @@ void comm_base_handle_slow_accept(int ATTR_UNUSED(fd),
 	}
 }
 
+static void
+tcp_accept_slow(struct comm_point* c)
+{
+	/* out of file descriptors, likely outside of our
+	 * control. stop accept() calls for some time */
+	if(c->ev->base->stop_accept) {
+		struct comm_base* b = c->ev->base;
+		struct timeval tv;
+		verbose(VERB_ALGO, "out of file descriptors: slow accept");
+		b->eb->slow_accept_enabled = 1;
+		fptr_ok(fptr_whitelist_stop_accept(b->stop_accept));
+		(*b->stop_accept)(b->cb_arg);
+		/* set timeout, no mallocs */
+		tv.tv_sec = NETEVENT_SLOW_ACCEPT_TIME/1000;
+		tv.tv_usec = (NETEVENT_SLOW_ACCEPT_TIME%1000)*1000;
+		b->eb->slow_accept = ub_event_new(b->eb->base, -1,
+			UB_EV_TIMEOUT, comm_base_handle_slow_accept, b);
+		if(b->eb->slow_accept == NULL) {
+			/* we do not want to log here, because
+			 * that would spam the logfiles.
+			 * error: "event_base_set failed." */
+		}
+		else if(ub_event_add(b->eb->slow_accept, &tv) != 0) {
+			/* we do not want to log here,
+			 * error: "event_add failed." */
+		}
+	}
+}
+
+static int
+tcp_accept_conn_limit(struct comm_point* c, int new_fd,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	if(c->tcp_conn_limit && c->type == comm_tcp_accept) {
+		c->tcl_addr = tcl_addr_lookup(c->tcp_conn_limit, addr, addrlen);
+		if(!tcl_new_connection(c->tcl_addr)) {
+			if(verbosity >= 3)
+				log_err_addr("accept rejected",
+				"connection limit exceeded", addr, addrlen);
+			close(new_fd);
+			return -1;
+		}
+	}
+	return new_fd;
+}
+
 int comm_point_perform_accept(struct comm_point* c,
 	struct sockaddr_storage* addr, socklen_t* addrlen)
 {
@@ -866,34 +2273,7 @@ int comm_point_perform_accept(struct comm_point* c,
 			return -1;
 #if defined(ENFILE) && defined(EMFILE)
 		if(errno == ENFILE || errno == EMFILE) {
-			/* out of file descriptors, likely outside of our
-			 * control. stop accept() calls for some time */
-			if(c->ev->base->stop_accept) {
-				struct comm_base* b = c->ev->base;
-				struct timeval tv;
-				verbose(VERB_ALGO, "out of file descriptors: "
-					"slow accept");
-				b->eb->slow_accept_enabled = 1;
-				fptr_ok(fptr_whitelist_stop_accept(
-					b->stop_accept));
-				(*b->stop_accept)(b->cb_arg);
-				/* set timeout, no mallocs */
-				tv.tv_sec = NETEVENT_SLOW_ACCEPT_TIME/1000;
-				tv.tv_usec = (NETEVENT_SLOW_ACCEPT_TIME%1000)*1000;
-				b->eb->slow_accept = ub_event_new(b->eb->base,
-					-1, UB_EV_TIMEOUT,
-					comm_base_handle_slow_accept, b);
-				if(b->eb->slow_accept == NULL) {
-					/* we do not want to log here, because
-					 * that would spam the logfiles.
-					 * error: "event_base_set failed." */
-				}
-				else if(ub_event_add(b->eb->slow_accept, &tv)
-					!= 0) {
-					/* we do not want to log here,
-					 * error: "event_add failed." */
-				}
-			}
+			tcp_accept_slow(c);
 			return -1;
 		}
 #endif
@@ -910,16 +2290,8 @@ int comm_point_perform_accept(struct comm_point* c,
 			*addrlen);
 		return -1;
 	}
-	if(c->tcp_conn_limit && c->type == comm_tcp_accept) {
-		c->tcl_addr = tcl_addr_lookup(c->tcp_conn_limit, addr, *addrlen);
-		if(!tcl_new_connection(c->tcl_addr)) {
-			if(verbosity >= 3)
-				log_err_addr("accept rejected",
-				"connection limit exceeded", addr, *addrlen);
-			close(new_fd);
-			return -1;
-		}
-	}
+	if(tcp_accept_conn_limit(c, new_fd, addr, *addrlen) == -1)
+		return -1;
 #ifndef HAVE_ACCEPT4
 	fd_set_nonblock(new_fd);
 #endif
@@ -1001,21 +2373,14 @@ static int http2_submit_settings(struct http2_session* h2_session)
 #endif /* HAVE_NGHTTP2 */
 
 
-void 
-comm_point_tcp_accept_callback(int fd, short event, void* arg)
+static struct comm_point*
+tcp_accept_handler(struct comm_point* c)
 {
-	struct comm_point* c = (struct comm_point*)arg, *c_hdl;
-	int new_fd;
-	log_assert(c->type == comm_tcp_accept);
-	if(!(event & UB_EV_READ)) {
-		log_info("ignoring tcp accept event %d", (int)event);
-		return;
-	}
-	ub_comm_base_now(c->ev->base);
+	struct comm_point* c_hdl;
 	/* find free tcp handler. */
 	if(!c->tcp_free) {
 		log_warn("accepted too many tcp, connections full");
-		return;
+		return NULL;
 	}
 	/* accept incoming connection. */
 	c_hdl = c->tcp_free;
@@ -1032,12 +2397,12 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 		if(!c_hdl->h2_session ||
 			!http2_session_server_create(c_hdl->h2_session)) {
 			log_warn("failed to create nghttp2");
-			return;
+			return NULL;
 		}
 		if(!c_hdl->h2_session ||
 			!http2_submit_settings(c_hdl->h2_session)) {
 			log_warn("failed to submit http2 settings");
-			return;
+			return NULL;
 		}
 		if(!c->ssl) {
 			c_hdl->tcp_do_toggle_rw = 0;
@@ -1054,14 +2419,14 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 	}
 	if(!c_hdl->ev->ev) {
 		log_warn("could not ub_event_new, dropped tcp");
-		return;
+		return NULL;
 	}
-	log_assert(fd != -1);
-	(void)fd;
-	new_fd = comm_point_perform_accept(c, &c_hdl->repinfo.addr,
-		&c_hdl->repinfo.addrlen);
-	if(new_fd == -1)
-		return;
+	return c_hdl;
+}
+
+static void
+tcp_accept_setup(struct comm_point* c, struct comm_point* c_hdl, int new_fd)
+{
 	if(c->ssl) {
 		c_hdl->ssl = incoming_ssl_fd(c->ssl, new_fd);
 		if(!c_hdl->ssl) {
@@ -1085,6 +2450,28 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 	setup_tcp_handler(c_hdl, new_fd, c->cur_tcp_count, c->max_tcp_count);
 }
 
+void 
+comm_point_tcp_accept_callback(int fd, short event, void* arg)
+{
+	struct comm_point* c = (struct comm_point*)arg, *c_hdl;
+	int new_fd;
+	log_assert(c->type == comm_tcp_accept);
+	if(!(event & UB_EV_READ)) {
+		log_info("ignoring tcp accept event %d", (int)event);
+		return;
+	}
+	ub_comm_base_now(c->ev->base);
+	if(!(c_hdl = tcp_accept_handler(c)))
+		return;
+	log_assert(fd != -1);
+	(void)fd;
+	new_fd = comm_point_perform_accept(c, &c_hdl->repinfo.addr,
+		&c_hdl->repinfo.addrlen);
+	if(new_fd == -1)
+		return;
+	tcp_accept_setup(c, c_hdl, new_fd);
+}
+
 /** Make tcp handler free for next assignment */
 static void
 reclaim_tcp_handler(struct comm_point* c)
@@ -1120,6 +2507,7 @@ tcp_callback_writer(struct comm_point* c)
 		sldns_buffer_clear(c->buffer);
 		c->tcp_byte_count = 0;
 	}
+	c->tcp_write_prefixed = 0;
 	if(c->tcp_do_toggle_rw)
 		c->tcp_is_reading = 1;
 	/* switch from listening(write) to listening(read) */
@@ -1300,6 +2688,18 @@ ssl_handshake(struct comm_point* c)
 			c->repinfo.addrlen);
 	}
 
+	/* count the downstream handshakes on the accept socket */
+	if(c->tcp_parent) {
+		c->tcp_parent->tls_handshake++;
+		if(SSL_session_reused(c->ssl))
+			c->tcp_parent->tls_handshake_resumed++;
+#ifdef BIO_get_ktls_send
+		/* some TLS versions only offload the send side */
+		if(BIO_get_ktls_send(SSL_get_wbio(c->ssl)))
+			c->tcp_parent->tls_ktls++;
+#endif
+	}
+
 	/* check if http2 use is negotiated */
 	if(c->type == comm_http && c->h2_session) {
 		const unsigned char *alpn;
@@ -1349,6 +2749,9 @@ ssl_handle_read(struct comm_point* c)
 				return 0; /* shutdown, closed */
 			} else if(want == SSL_ERROR_WANT_READ) {
 				ub_winsock_tcp_wouldblock(c->ev->ev, UB_EV_READ);
+				if(c->tcp_req_info && c->tcp_byte_count == 0)
+					tcp_req_info_handle_read_wait(
+						c->tcp_req_info);
 				return 1; /* read more later */
 			} else if(want == SSL_ERROR_WANT_WRITE) {
 				c->ssl_shake_state = comm_ssl_shake_hs_write;
@@ -1441,6 +2844,10 @@ ssl_handle_write(struct comm_point* c)
 	}
 	/* ignore return, if fails we may simply block */
 	(void)SSL_set_mode(c->ssl, (long)SSL_MODE_ENABLE_PARTIAL_WRITE);
+	if(c->tcp_write_prefixed && c->tcp_byte_count == 0) {
+		/* the lengths are in the buffer, skip the length write */
+		c->tcp_byte_count = sizeof(uint16_t);
+	}
 	if((c->tcp_write_and_read?c->tcp_write_byte_count:c->tcp_byte_count) < sizeof(uint16_t)) {
 		uint16_t len = htons(c->tcp_write_and_read?c->tcp_write_pkt_len:sldns_buffer_limit(c->buffer));
 		ERR_clear_error();
@@ -1606,16 +3013,21 @@ comm_point_tcp_handle_read(int fd, struct comm_point* c, int short_ok)
 	log_assert(fd != -1);
 	if(c->tcp_byte_count < sizeof(uint16_t)) {
 		/* read length bytes */
-		r = recv(fd,(void*)sldns_buffer_at(c->buffer,c->tcp_byte_count),
-			sizeof(uint16_t)-c->tcp_byte_count, 0);
+		r = tcp_stream_recv(c, fd,
+			(void*)sldns_buffer_at(c->buffer,c->tcp_byte_count),
+			sizeof(uint16_t)-c->tcp_byte_count);
 		if(r == 0) {
 			if(c->tcp_req_info)
 				return tcp_req_info_handle_read_close(c->tcp_req_info);
 			return 0;
 		} else if(r == -1) {
 #ifndef USE_WINSOCK
-			if(errno == EINTR || errno == EAGAIN)
+			if(errno == EINTR || errno == EAGAIN) {
+				if(c->tcp_req_info && c->tcp_byte_count == 0)
+					tcp_req_info_handle_read_wait(
+						c->tcp_req_info);
 				return 1;
+			}
 #ifdef ECONNRESET
 			if(errno == ECONNRESET && verbosity < 2)
 				return 0; /* silence reset by peer */
@@ -1655,6 +3067,9 @@ comm_point_tcp_handle_read(int fd, struct comm_point* c, int short_ok)
 			if(WSAGetLastError() == WSAEWOULDBLOCK) {
 				ub_winsock_tcp_wouldblock(c->ev->ev,
 					UB_EV_READ);
+				if(c->tcp_req_info && c->tcp_byte_count == 0)
+					tcp_req_info_handle_read_wait(
+						c->tcp_req_info);
 				return 1;
 			}
 #endif
@@ -1682,8 +3097,8 @@ comm_point_tcp_handle_read(int fd, struct comm_point* c, int short_ok)
 	}
 
 	log_assert(sldns_buffer_remaining(c->buffer) > 0);
-	r = recv(fd, (void*)sldns_buffer_current(c->buffer), 
-		sldns_buffer_remaining(c->buffer), 0);
+	r = tcp_stream_recv(c, fd, (void*)sldns_buffer_current(c->buffer), 
+		sldns_buffer_remaining(c->buffer));
 	if(r == 0) {
 		if(c->tcp_req_info)
 			return tcp_req_info_handle_read_close(c->tcp_req_info);
@@ -1863,6 +3278,10 @@ comm_point_tcp_handle_write(int fd, struct comm_point* c)
 	}
 #endif /* USE_MSG_FASTOPEN */
 
+	if(c->tcp_write_prefixed && c->tcp_byte_count == 0) {
+		/* the lengths are in the buffer, skip the length write */
+		c->tcp_byte_count = sizeof(uint16_t);
+	}
 	if((c->tcp_write_and_read?c->tcp_write_byte_count:c->tcp_byte_count) < sizeof(uint16_t)) {
 		uint16_t len = htons(c->tcp_write_and_read?c->tcp_write_pkt_len:sldns_buffer_limit(buffer));
 #ifdef HAVE_WRITEV
@@ -1879,14 +3298,14 @@ comm_point_tcp_handle_write(int fd, struct comm_point* c)
 			iov[1].iov_len = sldns_buffer_limit(buffer);
 		}
 		log_assert(iov[0].iov_len > 0);
-		r = writev(fd, iov, 2);
+		r = tcp_stream_writev(c, fd, iov, 2);
 #else /* HAVE_WRITEV */
 		if(c->tcp_write_and_read) {
-			r = send(fd, (void*)(((uint8_t*)&len)+c->tcp_write_byte_count),
-				sizeof(uint16_t)-c->tcp_write_byte_count, 0);
+			r = tcp_stream_send(c, fd, (void*)(((uint8_t*)&len)+c->tcp_write_byte_count),
+				sizeof(uint16_t)-c->tcp_write_byte_count);
 		} else {
-			r = send(fd, (void*)(((uint8_t*)&len)+c->tcp_byte_count),
-				sizeof(uint16_t)-c->tcp_byte_count, 0);
+			r = tcp_stream_send(c, fd, (void*)(((uint8_t*)&len)+c->tcp_byte_count),
+				sizeof(uint16_t)-c->tcp_byte_count);
 		}
 #endif /* HAVE_WRITEV */
 		if(r == -1) {
@@ -1945,11 +3364,11 @@ comm_point_tcp_handle_write(int fd, struct comm_point* c)
 	log_assert(c->tcp_write_and_read || sldns_buffer_remaining(buffer) > 0);
 	log_assert(!c->tcp_write_and_read || c->tcp_write_byte_count < c->tcp_write_pkt_len + 2);
 	if(c->tcp_write_and_read) {
-		r = send(fd, (void*)(c->tcp_write_pkt + c->tcp_write_byte_count - 2),
-			c->tcp_write_pkt_len + 2 - c->tcp_write_byte_count, 0);
+		r = tcp_stream_send(c, fd, (void*)(c->tcp_write_pkt + c->tcp_write_byte_count - 2),
+			c->tcp_write_pkt_len + 2 - c->tcp_write_byte_count);
 	} else {
-		r = send(fd, (void*)sldns_buffer_current(buffer),
-			sldns_buffer_remaining(buffer), 0);
+		r = tcp_stream_send(c, fd, (void*)sldns_buffer_current(buffer),
+			sldns_buffer_remaining(buffer));
 	}
 	if(r == -1) {
 #ifndef USE_WINSOCK
@@ -3546,6 +4965,9 @@ comm_point_create_tcp(struct comm_base *base, int fd, int num,
 	c->tcp_parent = NULL;
 	c->max_tcp_count = num;
 	c->cur_tcp_count = 0;
+	c->tls_handshake = 0;
+	c->tls_handshake_resumed = 0;
+	c->tls_ktls = 0;
 	c->tcp_handlers = (struct comm_point**)calloc((size_t)num,
 		sizeof(struct comm_point*));
 	if(!c->tcp_handlers) {
@@ -3887,6 +5309,8 @@ comm_point_close(struct comm_point* c)
 			c->event_added = 0;
 		}
 	}
+	if(c->uring_recv || c->uring_tcp)
+		comm_point_close_uring(c);
 	tcl_close_connection(c->tcl_addr);
 	if(c->tcp_req_info)
 		tcp_req_info_clear(c->tcp_req_info);
@@ -3973,7 +5397,8 @@ comm_point_send_reply(struct comm_reply *repinfo)
 		if(repinfo->c->dtenv != NULL &&
 		   repinfo->c->dtenv->log_client_response_messages)
 			dt_msg_send_client_response(repinfo->c->dtenv,
-			&repinfo->addr, repinfo->c->type, repinfo->c->buffer);
+			&repinfo->addr, repinfo->c->type, repinfo->c->buffer,
+			0);
 #endif
 	} else {
 #ifdef USE_DNSTAP
@@ -3983,7 +5408,7 @@ comm_point_send_reply(struct comm_reply *repinfo)
 			&repinfo->addr, repinfo->c->type,
 			( repinfo->c->tcp_req_info
 			? repinfo->c->tcp_req_info->spool_buffer
-			: repinfo->c->buffer ));
+			: repinfo->c->buffer ), 0);
 #endif
 		if(repinfo->c->tcp_req_info) {
 			tcp_req_info_send_reply(repinfo->c->tcp_req_info);
@@ -4039,6 +5464,8 @@ comm_point_stop_listening(struct comm_point* c)
 		}
 		c->event_added = 0;
 	}
+	if(c->uring_recv || c->uring_tcp)
+		comm_point_stop_uring(c);
 }
 
 void 
@@ -4087,11 +5514,20 @@ comm_point_start_listening(struct comm_point* c, int newfd, int msec)
 	if(newfd != -1) {
 		if(c->fd != -1 && c->fd != newfd) {
 			verbose(5, "cpsl close of fd %d for %d", c->fd, newfd);
+			if(c->uring_recv || c->uring_tcp)
+				comm_point_close_uring(c);
 			sock_close(c->fd);
 		}
 		c->fd = newfd;
 		ub_event_set_fd(c->ev->ev, c->fd);
 	}
+	if(c->use_uring && comm_point_start_uring(c)) {
+		/* the io_uring reads and writes, the event is only for the
+		 * timeout of the TCP stream */
+		if(c->type != comm_tcp || msec == 0 || !c->timeout)
+			return;
+		ub_event_del_bits(c->ev->ev, UB_EV_READ|UB_EV_WRITE);
+	}
 	if(ub_event_add(c->ev->ev, msec==0?NULL:c->timeout) != 0) {
 		log_err("event_add failed. in cpsl.");
 	}
@@ -4108,8 +5544,16 @@ void comm_point_listen_for_rw(struct comm_point* c, int rd, int wr)
 		c->event_added = 0;
 	}
 	ub_event_del_bits(c->ev->ev, UB_EV_READ|UB_EV_WRITE);
-	if(rd) ub_event_add_bits(c->ev->ev, UB_EV_READ);
-	if(wr) ub_event_add_bits(c->ev->ev, UB_EV_WRITE);
+	if(c->uring_tcp) {
+		/* the io_uring reads and writes, the event is for the
+		 * timeout */
+		comm_point_listen_uring(c, rd, wr);
+		if(!c->timeout)
+			return;
+	} else {
+		if(rd) ub_event_add_bits(c->ev->ev, UB_EV_READ);
+		if(wr) ub_event_add_bits(c->ev->ev, UB_EV_WRITE);
+	}
 	if(ub_event_add(c->ev->ev, c->timeout) != 0) {
 		log_err("event_add failed. in cplf.");
 	}
@@ -67,6 +67,8 @@
 
 struct sldns_buffer;
 struct comm_point;
+struct uring_recv;
+struct uring_tcp;
 struct comm_reply;
 struct tcl_list;
 struct ub_event_base;
@@ -175,6 +177,18 @@ struct comm_point {
 	/** timeout (NULL if it does not). Malloced. */
 	struct timeval* timeout;
 
+	/** if the comm point does its I/O with the io_uring of the comm
+	 * base, when the base has one, see comm_point_use_uring. */
+	int use_uring;
+
+	/** io_uring receive registration, if the UDP socket receives with
+	 * the io_uring of the comm base, or NULL. */
+	struct uring_recv* uring_recv;
+
+	/** io_uring registration of the TCP accept socket, or of the
+	 * stream of a TCP comm point, or NULL. */
+	struct uring_tcp* uring_tcp;
+
 	/** buffer pointer. Either to perthread, or own buffer or NULL */
 	struct sldns_buffer* buffer;
 
@@ -193,6 +207,12 @@ struct comm_point {
 	int max_tcp_count;
 	/** current number of tcp handler in-use for this accept socket */
 	int cur_tcp_count;
+	/** number of TLS handshakes completed by the tcp handlers */
+	size_t tls_handshake;
+	/** number of those TLS handshakes that resumed a session */
+	size_t tls_handshake_resumed;
+	/** number of those TLS connections that send with kernel TLS */
+	size_t tls_ktls;
 	/** malloced array of tcp handlers for a tcp-accept, 
 	    of size max_tcp_count. */
 	struct comm_point** tcp_handlers;
@@ -284,6 +304,12 @@ struct comm_point {
 	/** flag that indicates the stream is both written and read from. */
 	int tcp_write_and_read;
 
+	/** the buffer to write has one or more packets, each with its
+	 * two byte length in front, so no length is written in front of
+	 * the buffer.  For replies to pipelined queries that are written
+	 * together. */
+	int tcp_write_prefixed;
+
 	/** byte count for written length over write channel, for when
 	 * tcp_write_and_read is enabled.  When tcp_write_and_read is enabled,
 	 * this is the counter for writing, the one for reading is in the
@@ -487,6 +513,18 @@ void comm_base_set_slow_accept_handlers(struct comm_base* b,
  */
 struct ub_event_base* comm_base_internal(struct comm_base* b);
 
+/**
+ * Setup an io_uring for the comm base.  UDP comm points can then
+ * receive with a multishot receive into a ring of provided buffers, and
+ * the replies made during the callbacks are sent in a batch.  TCP comm
+ * points accept, read and write with it.  The ring is
+ * polled with the event base, the completions are handled from there.
+ * @param b: comm base.
+ * @return false if io_uring is not compiled in or not supported by the
+ *	kernel, the comm base uses its events as usual.
+ */
+int comm_base_setup_uring(struct comm_base* b);
+
 /**
  * Create an UDP comm point. Calls malloc.
  * setups the structure with the parameters you provide.
@@ -502,6 +540,32 @@ struct comm_point* comm_point_create_udp(struct comm_base* base,
 	int fd, struct sldns_buffer* buffer, 
 	comm_point_callback_type* callback, void* callback_arg);
 
+/** the largest UDP message that is received with the io_uring, a larger
+ * one is truncated and dropped */
+#define COMM_URING_UDP_SIZE 4096
+
+/**
+ * Do the I/O of the comm point with the io_uring of the comm base, in
+ * place of its events.  A UDP comm point receives with a multishot
+ * receive.  A TCP accept comm point accepts with the io_uring, and its
+ * TCP handlers read and write with it.  A TCP comm point reads and writes
+ * its stream with it, from when it starts listening on a new socket.
+ * Comm points with TLS, HTTP and the other types keep using events.
+ * The callback contract is the same as for the comm point with events.
+ * @param c: the comm point.
+ * @return false if the comm base has no io_uring, the comm point keeps
+ *	using its events.
+ */
+int comm_point_use_uring(struct comm_point* c);
+
+/**
+ * Mark the comm point as a listening socket that is shared by the
+ * threads, so that the event loop wakes up one of them for its events,
+ * if the event loop supports that.
+ * @param c: the UDP comm point or the TCP accept comm point.
+ */
+void comm_point_set_exclusive(struct comm_point* c);
+
 /**
  * Create an UDP with ancillary data comm point. Calls malloc.
  * Uses recvmsg instead of recv to get udp message.
@@ -969,6 +1033,16 @@ void comm_point_raw_handle_callback(int fd, short event, void* arg);
  */
 void comm_base_handle_slow_accept(int fd, short event, void* arg);
 
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * libevent callback for completions on the io_uring of the comm base.
+ * @param fd: file descriptor of the io_uring.
+ * @param event: event bits from libevent: 
+ *	EV_READ, EV_WRITE, EV_SIGNAL, EV_TIMEOUT.
+ * @param arg: the comm_base structure.
+ */
+void comm_base_handle_uring(int fd, short event, void* arg);
+
 #ifdef USE_WINSOCK
 /**
  * Callback for openssl BIO to on windows detect WSAEWOULDBLOCK and notify
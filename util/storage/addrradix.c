@@ -0,0 +1,332 @@
+/*
+ * util/storage/addrradix.c - radix tree index for address lookups.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a compressed binary radix tree that indexes the
+ * elements of an addr tree for longest prefix match lookups.
+ */
+#include "config.h"
+#include "util/storage/addrradix.h"
+#include "util/net_help.h"
+#include "util/log.h"
+
+void
+addr_radix_init(struct addr_radix* radix, rbtree_type* tree)
+{
+	memset(radix, 0, sizeof(*radix));
+	radix->tree = tree;
+}
+
+/** get the address bits and the trie root for the address family,
+ * returns number of bits in the address */
+static int
+radix_key(struct addr_radix* radix, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t** key, struct addr_radix_node*** root)
+{
+	if(addr_is_ip6(addr, addrlen)) {
+		*key = (uint8_t*)&((struct sockaddr_in6*)addr)->sin6_addr;
+		*root = &radix->root6;
+		return 128;
+	}
+	*key = (uint8_t*)&((struct sockaddr_in*)addr)->sin_addr;
+	*root = &radix->root4;
+	return 32;
+}
+
+/** get bit i of the key */
+static int
+radix_bit(const uint8_t* key, int i)
+{
+	return (key[i>>3] >> (7-(i&7))) & 1;
+}
+
+/** see if the first len bits of a are equal to the (masked) key */
+static int
+radix_match(const uint8_t* a, const uint8_t* key, int len)
+{
+	int bytes = len>>3, bits = len&7;
+	if(bytes && memcmp(a, key, (size_t)bytes) != 0)
+		return 0;
+	if(bits) {
+		uint8_t mask = (uint8_t)(0xff << (8-bits));
+		if((a[bytes]&mask) != key[bytes])
+			return 0;
+	}
+	return 1;
+}
+
+/** number of leading bits in common, at most max */
+static int
+radix_common(const uint8_t* a, const uint8_t* b, int max)
+{
+	int i, match = 0;
+	for(i=0; match < max; i++) {
+		uint8_t z = a[i]^b[i];
+		if(z == 0) {
+			match += 8;
+			continue;
+		}
+		while(!(z&0x80)) {
+			match++;
+			z<<=1;
+		}
+		break;
+	}
+	return (match<max)?match:max;
+}
+
+/** allocate a node, from the block if there is room */
+static struct addr_radix_node*
+radix_node_new(struct addr_radix* radix, const uint8_t* key, int len,
+	struct addr_tree_node* elem)
+{
+	struct addr_radix_node* n;
+	if(radix->block_used < radix->block_size) {
+		n = &radix->block[radix->block_used++];
+	} else {
+		n = (struct addr_radix_node*)malloc(sizeof(*n));
+		if(!n)
+			return NULL;
+		radix->num_alloc++;
+	}
+	n->child[0] = NULL;
+	n->child[1] = NULL;
+	n->elem = elem;
+	n->len = (uint8_t)len;
+	memset(n->key, 0, sizeof(n->key));
+	memcpy(n->key, key, (size_t)((len+7)/8));
+	if(len&7)
+		n->key[len>>3] &= (uint8_t)(0xff << (8-(len&7)));
+	return n;
+}
+
+/** free a node, unless it is part of the block */
+static void
+radix_node_free(struct addr_radix* radix, struct addr_radix_node* n)
+{
+	if(radix->block && n >= radix->block &&
+		n < radix->block + radix->block_size)
+		return;
+	free(n);
+	radix->num_alloc--;
+}
+
+/** free a trie */
+static void
+radix_free_trie(struct addr_radix* radix, struct addr_radix_node* n)
+{
+	if(!n)
+		return;
+	radix_free_trie(radix, n->child[0]);
+	radix_free_trie(radix, n->child[1]);
+	radix_node_free(radix, n);
+}
+
+void
+addr_radix_clear(struct addr_radix* radix)
+{
+	radix_free_trie(radix, radix->root4);
+	radix_free_trie(radix, radix->root6);
+	free(radix->block);
+	radix->root4 = NULL;
+	radix->root6 = NULL;
+	radix->block = NULL;
+	radix->block_size = 0;
+	radix->block_used = 0;
+	radix->num_alloc = 0;
+	radix->built = 0;
+}
+
+/** add element to the trie, false on malloc failure */
+static int
+radix_add(struct addr_radix* radix, struct addr_tree_node* elem)
+{
+	struct addr_radix_node** pp, *n, *b, *leaf;
+	uint8_t* key;
+	int max = radix_key(radix, &elem->addr, elem->addrlen, &key, &pp);
+	int len = (elem->net < max)?elem->net:max;
+	int c;
+	if(len < 0)
+		len = 0;
+	while(*pp) {
+		n = *pp;
+		c = radix_common(key, n->key, (len<n->len)?len:n->len);
+		if(c == n->len) {
+			if(c == len) {
+				/* the same prefix, keep the one that is there */
+				if(!n->elem)
+					n->elem = elem;
+				return 1;
+			}
+			/* n encloses the prefix, go down */
+			pp = &n->child[radix_bit(key, n->len)];
+			continue;
+		}
+		if(c == len) {
+			/* the prefix encloses n, put it above n */
+			if(!(b = radix_node_new(radix, key, len, elem)))
+				return 0;
+			b->child[radix_bit(n->key, len)] = n;
+			*pp = b;
+			return 1;
+		}
+		/* the prefixes diverge at bit c, branch there */
+		if(!(b = radix_node_new(radix, key, c, NULL)))
+			return 0;
+		if(!(leaf = radix_node_new(radix, key, len, elem))) {
+			radix_node_free(radix, b);
+			return 0;
+		}
+		b->child[radix_bit(key, c)] = leaf;
+		b->child[radix_bit(n->key, c)] = n;
+		*pp = b;
+		return 1;
+	}
+	if(!(*pp = radix_node_new(radix, key, len, elem)))
+		return 0;
+	return 1;
+}
+
+int
+addr_radix_build(struct addr_radix* radix)
+{
+	struct addr_tree_node* n;
+	addr_radix_clear(radix);
+	if(!radix->tree)
+		return 0;
+	if(radix->tree->count != 0) {
+		/* a trie with k elements has at most 2k-1 nodes */
+		radix->block_size = radix->tree->count*2;
+		radix->block = (struct addr_radix_node*)reallocarray(NULL,
+			radix->block_size, sizeof(*radix->block));
+		if(!radix->block) {
+			radix->block_size = 0;
+			log_err("out of memory building address index");
+			return 0;
+		}
+	}
+	RBTREE_FOR(n, struct addr_tree_node*, radix->tree) {
+		if(!radix_add(radix, n)) {
+			addr_radix_clear(radix);
+			log_err("out of memory building address index");
+			return 0;
+		}
+	}
+	radix->built = 1;
+	return 1;
+}
+
+void
+addr_radix_insert(struct addr_radix* radix, struct addr_tree_node* node)
+{
+	if(!radix->built)
+		return;
+	if(!radix_add(radix, node)) {
+		log_err("out of memory in address index, using the tree");
+		addr_radix_clear(radix);
+	}
+}
+
+void
+addr_radix_remove(struct addr_radix* radix, struct addr_tree_node* node)
+{
+	struct addr_radix_node** pp, **parentp = NULL, *n = NULL, *p;
+	uint8_t* key;
+	int max, len;
+	if(!radix->built)
+		return;
+	max = radix_key(radix, &node->addr, node->addrlen, &key, &pp);
+	len = (node->net < max)?node->net:max;
+	while(*pp) {
+		n = *pp;
+		if(n->len > len || !radix_match(key, n->key, n->len))
+			return;
+		if(n->len == len)
+			break;
+		parentp = pp;
+		pp = &n->child[radix_bit(key, n->len)];
+	}
+	if(!*pp || n->elem != node)
+		return;
+	n->elem = NULL;
+	if(n->child[0] && n->child[1])
+		return; /* stays as a branch */
+	*pp = n->child[0]?n->child[0]:n->child[1];
+	radix_node_free(radix, n);
+	if(!*pp && parentp) {
+		/* the parent lost a child, remove it if it is a branch */
+		p = *parentp;
+		if(!p->elem) {
+			*parentp = p->child[0]?p->child[0]:p->child[1];
+			radix_node_free(radix, p);
+		}
+	}
+}
+
+struct addr_tree_node*
+addr_radix_lookup(struct addr_radix* radix, struct sockaddr_storage* addr,
+	socklen_t addrlen)
+{
+	struct addr_radix_node** root, *n;
+	struct addr_tree_node* result = NULL;
+	uint8_t* key;
+	int max;
+	if(!radix->built) {
+		if(!radix->tree)
+			return NULL;
+		return addr_tree_lookup(radix->tree, addr, addrlen);
+	}
+	max = radix_key(radix, addr, addrlen, &key, &root);
+	n = *root;
+	while(n) {
+		if(!radix_match(key, n->key, n->len))
+			break;
+		if(n->elem)
+			result = n->elem;
+		if(n->len >= max)
+			break;
+		n = n->child[radix_bit(key, n->len)];
+	}
+	return result;
+}
+
+size_t
+addr_radix_get_mem(struct addr_radix* radix)
+{
+	return (radix->block_size + radix->num_alloc) *
+		sizeof(struct addr_radix_node);
+}
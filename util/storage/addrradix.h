@@ -0,0 +1,149 @@
+/*
+ * util/storage/addrradix.h - radix tree index for address lookups.
+ *
+ * Copyright (c) 2021, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a compressed binary radix tree (a patricia trie) that
+ * indexes the elements of an addr tree for longest prefix match lookups.
+ * The addr tree stays the owner of the elements and keeps the sorted order
+ * for find, insert and delete; the radix tree gives lookups a walk of at
+ * most one node per prefix bit, without the parent pointer chase of
+ * addr_tree_lookup.
+ */
+
+#ifndef UTIL_STORAGE_ADDRRADIX_H
+#define UTIL_STORAGE_ADDRRADIX_H
+#include "util/storage/dnstree.h"
+
+/**
+ * Node in the radix tree.  The node covers the prefix of len bits in key,
+ * bits after the prefix are zero.  Nodes without an element are branch
+ * nodes where the prefixes of the children diverge.
+ */
+struct addr_radix_node {
+	/** children, indexed by the bit after the prefix */
+	struct addr_radix_node* child[2];
+	/** the addr tree element for this prefix, or NULL for branches */
+	struct addr_tree_node* elem;
+	/** prefix length in bits */
+	uint8_t len;
+	/** prefix bits, network byte order */
+	uint8_t key[16];
+};
+
+/**
+ * Radix tree index on an addr tree.  IPv4 and IPv6 prefixes are kept in
+ * separate tries.
+ */
+struct addr_radix {
+	/** the addr tree that is indexed */
+	rbtree_type* tree;
+	/** root of the IPv4 trie */
+	struct addr_radix_node* root4;
+	/** root of the IPv6 trie */
+	struct addr_radix_node* root6;
+	/** nodes allocated in one block by the bulk build */
+	struct addr_radix_node* block;
+	/** number of nodes in the block */
+	size_t block_size;
+	/** number of nodes handed out from the block */
+	size_t block_used;
+	/** number of nodes allocated one by one */
+	size_t num_alloc;
+	/** if the index is built and in sync with the tree.  If not,
+	 * lookups use the addr tree itself. */
+	int built;
+};
+
+/**
+ * Init an empty radix index for an addr tree.
+ * @param radix: to init.
+ * @param tree: the addr tree that it indexes.
+ */
+void addr_radix_init(struct addr_radix* radix, rbtree_type* tree);
+
+/**
+ * Delete the nodes of the radix index, the index is no longer built.
+ * The addr tree is not changed.
+ * @param radix: the index.
+ */
+void addr_radix_clear(struct addr_radix* radix);
+
+/**
+ * Build the radix index from all elements in the addr tree, after the
+ * insertions are done, and the parents have been set up.  The nodes are
+ * allocated in one block.  Any previous index is deleted.
+ * @param radix: the index.
+ * @return false on malloc failure, the index is then not built and lookups
+ *	use the addr tree.
+ */
+int addr_radix_build(struct addr_radix* radix);
+
+/**
+ * Add an element that was inserted in the addr tree to the radix index.
+ * Does nothing if the index is not built.  On malloc failure the index is
+ * deleted and lookups use the addr tree.
+ * @param radix: the index.
+ * @param node: the element, inserted in the addr tree.
+ */
+void addr_radix_insert(struct addr_radix* radix, struct addr_tree_node* node);
+
+/**
+ * Remove an element from the radix index, before it is deleted from the
+ * addr tree.  Does nothing if the index is not built.
+ * @param radix: the index.
+ * @param node: the element.
+ */
+void addr_radix_remove(struct addr_radix* radix, struct addr_tree_node* node);
+
+/**
+ * Lookup closest encloser, like addr_tree_lookup.
+ * @param radix: the index.
+ * @param addr: to lookup.
+ * @param addrlen: length of addr
+ * @return closest enclosing element (could be equal) or NULL if not found.
+ */
+struct addr_tree_node* addr_radix_lookup(struct addr_radix* radix,
+	struct sockaddr_storage* addr, socklen_t addrlen);
+
+/**
+ * Get memory used by the radix index.
+ * @param radix: the index.
+ * @return bytes in use, not counting the struct itself.
+ */
+size_t addr_radix_get_mem(struct addr_radix* radix);
+
+#endif /* UTIL_STORAGE_ADDRRADIX_H */
@@ -54,6 +54,7 @@ tcl_list_create(void)
 		sizeof(struct tcl_list));
 	if(!tcl)
 		return NULL;
+	addr_radix_init(&tcl->radix, &tcl->tree);
 	tcl->region = regional_create();
 	if(!tcl->region) {
 		tcl_list_delete(tcl);
@@ -78,6 +79,7 @@ tcl_list_delete(struct tcl_list* tcl)
 	if(!tcl)
 		return;
 	traverse_postorder(&tcl->tree, tcl_list_free_node, NULL);
+	addr_radix_clear(&tcl->radix);
 	regional_destroy(tcl->region);
 	free(tcl);
 }
@@ -143,11 +145,13 @@ read_tcl_list(struct tcl_list* tcl, struct config_file* cfg)
 int
 tcl_list_apply_cfg(struct tcl_list* tcl, struct config_file* cfg)
 {
+	addr_radix_clear(&tcl->radix);
 	regional_free_all(tcl->region);
 	addr_tree_init(&tcl->tree);
 	if(!read_tcl_list(tcl, cfg))
 		return 0;
 	addr_tree_init_parents(&tcl->tree);
+	(void)addr_radix_build(&tcl->radix);
 	return 1;
 }
 
@@ -182,7 +186,7 @@ struct tcl_addr*
 tcl_addr_lookup(struct tcl_list* tcl, struct sockaddr_storage* addr,
         socklen_t addrlen)
 {
-	return (struct tcl_addr*)addr_tree_lookup(&tcl->tree,
+	return (struct tcl_addr*)addr_radix_lookup(&tcl->radix,
 		addr, addrlen);
 }
 
@@ -190,5 +194,6 @@ size_t
 tcl_list_get_mem(struct tcl_list* tcl)
 {
 	if(!tcl) return 0;
-	return sizeof(*tcl) + regional_get_mem(tcl->region);
+	return sizeof(*tcl) + regional_get_mem(tcl->region) +
+		addr_radix_get_mem(&tcl->radix);
 }
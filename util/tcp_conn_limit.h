@@ -43,6 +43,7 @@
 #ifndef DAEMON_TCP_CONN_LIMIT_H
 #define DAEMON_TCP_CONN_LIMIT_H
 #include "util/storage/dnstree.h"
+#include "util/storage/addrradix.h"
 #include "util/locks.h"
 struct config_file;
 struct regional;
@@ -58,6 +59,8 @@ struct tcl_list {
 	 * contents of type tcl_addr.
 	 */
 	rbtree_type tree;
+	/** lookup index on the tree */
+	struct addr_radix radix;
 };
 
 /**
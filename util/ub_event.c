@@ -176,7 +176,7 @@ ub_get_event_sys(struct ub_event_base* base, const char** n, const char** s,
 	(void)base;
 	*n = "mini-event";
 	*s = "internal";
-	*m = "select";
+	*m = event_get_method();
 #else
 	struct event_base* b = AS_EVENT_BASE(base);
 	*s = event_get_version();
@@ -286,6 +286,31 @@ ub_event_base_loopexit(struct ub_event_base* base)
 	return event_base_loopexit(AS_EVENT_BASE(base), NULL);
 }
 
+void
+ub_event_base_set_busy_poll(struct ub_event_base* base, int usec)
+{
+#if defined(USE_MINI_EVENT) && !defined(USE_WINSOCK)
+	minievent_set_busy_poll(AS_EVENT_BASE(base), usec);
+#else
+	(void)base;
+	(void)usec;
+#endif
+}
+
+void
+ub_event_base_get_counts(struct ub_event_base* base, size_t* wakeup,
+	size_t* handled, int reset)
+{
+#if defined(USE_MINI_EVENT) && !defined(USE_WINSOCK)
+	minievent_get_counts(AS_EVENT_BASE(base), wakeup, handled, reset);
+#else
+	(void)base;
+	(void)reset;
+	*wakeup = 0;
+	*handled = 0;
+#endif
+}
+
 struct ub_event*
 ub_event_new(struct ub_event_base* base, int fd, short bits,
 	void (*cb)(int, short, void*), void* arg)
@@ -376,6 +401,16 @@ ub_event_set_fd(struct ub_event* ev, int fd)
 	AS_EVENT(ev)->ev_fd = fd;
 }
 
+void
+ub_event_set_exclusive(struct ub_event* ev)
+{
+#if defined(USE_MINI_EVENT) && !defined(USE_WINSOCK)
+	minievent_set_exclusive(AS_EVENT(ev));
+#else
+	(void)ev;
+#endif
+}
+
 void
 ub_event_free(struct ub_event* ev)
 {
@@ -83,6 +83,14 @@ void ub_event_base_free(struct ub_event_base*);
 int ub_event_base_dispatch(struct ub_event_base*);
 /** exit that loop */
 int ub_event_base_loopexit(struct ub_event_base*);
+/** Set the microseconds to poll for events before the event loop sleeps.
+ * Only the internal epoll event loop supports it. */
+void ub_event_base_set_busy_poll(struct ub_event_base*, int usec);
+/** Get the number of event loop wakeups and fd events handled, and clear
+ * them if reset is true. They are zero if the event base does not count
+ * them, only the internal event loop does. */
+void ub_event_base_get_counts(struct ub_event_base*, size_t* wakeup,
+	size_t* handled, int reset);
 
 /** Create a new ub_event for the event base */
 struct ub_event* ub_event_new(struct ub_event_base*,
@@ -100,6 +108,10 @@ void ub_event_add_bits(struct ub_event*, short bits);
 void ub_event_del_bits(struct ub_event*, short bits);
 /** Change or set the file descriptor on the event */
 void ub_event_set_fd(struct ub_event*, int fd);
+/** Mark the event for exclusive wakeup, for a listening socket that is
+ * shared by the threads, so that an event wakes up only one of them.
+ * Only the internal epoll event loop supports it, others ignore it. */
+void ub_event_set_exclusive(struct ub_event*);
 /** free the event */
 void ub_event_free(struct ub_event*);
 /** Activate the event.  The given timeval is an timeout value. */
@@ -48,6 +48,9 @@
 #include "util/netevent.h"
 #include "util/log.h"
 #include "util/fptr_wlist.h"
+#if defined(USE_CACHEDB) && defined(USE_REDIS)
+#include "cachedb/redis.h"
+#endif
 
 /* We define libevent structures here to hide the libevent stuff. */
 
@@ -99,6 +102,10 @@ UB_EV_BITS_CB(comm_point_local_handle_callback)
 UB_EV_BITS_CB(comm_point_raw_handle_callback)
 UB_EV_BITS_CB(tube_handle_signal)
 UB_EV_BITS_CB(comm_base_handle_slow_accept)
+UB_EV_BITS_CB(comm_base_handle_uring)
+#if defined(USE_CACHEDB) && defined(USE_REDIS)
+UB_EV_BITS_CB(redis_async_event_cb)
+#endif
 
 static void (*NATIVE_BITS_CB(void (*cb)(int, short, void*)))(int, short, void*)
 {
@@ -122,6 +129,12 @@ static void (*NATIVE_BITS_CB(void (*cb)(int, short, void*)))(int, short, void*)
 		return my_tube_handle_signal;
 	else if(cb == comm_base_handle_slow_accept)
 		return my_comm_base_handle_slow_accept;
+	else if(cb == comm_base_handle_uring)
+		return my_comm_base_handle_uring;
+#if defined(USE_CACHEDB) && defined(USE_REDIS)
+	else if(cb == redis_async_event_cb)
+		return my_redis_async_event_cb;
+#endif
 	else
 		return NULL;
 }
@@ -446,7 +459,7 @@ ub_get_event_sys(struct ub_event_base* ub_base, const char** n, const char** s,
 	(void)ub_base;
 	*n = "pluggable-event";
 	*s = "internal";
-	*m = "select";
+	*m = event_get_method();
 #else
 	struct event_base* b = ub_libevent_get_event_base(ub_base);
 	/* This function is only called from comm_base_create, so
@@ -504,6 +517,40 @@ ub_event_base_loopexit(struct ub_event_base* base)
 	return -1;
 }
 
+void
+ub_event_base_set_busy_poll(struct ub_event_base* base, int usec)
+{
+#if defined(USE_MINI_EVENT) && !defined(USE_WINSOCK)
+	if (base->magic == UB_EVENT_MAGIC &&
+		base->vmt == &default_event_base_vmt) {
+		minievent_set_busy_poll(AS_MY_EVENT_BASE(base)->base, usec);
+		return;
+	}
+#endif
+	/* pluggable event bases do not support it */
+	(void)base;
+	(void)usec;
+}
+
+void
+ub_event_base_get_counts(struct ub_event_base* base, size_t* wakeup,
+	size_t* handled, int reset)
+{
+#if defined(USE_MINI_EVENT) && !defined(USE_WINSOCK)
+	if (base->magic == UB_EVENT_MAGIC &&
+		base->vmt == &default_event_base_vmt) {
+		minievent_get_counts(AS_MY_EVENT_BASE(base)->base, wakeup,
+			handled, reset);
+		return;
+	}
+#endif
+	/* pluggable event bases do not count them */
+	(void)base;
+	(void)reset;
+	*wakeup = 0;
+	*handled = 0;
+}
+
 struct ub_event*
 ub_event_new(struct ub_event_base* base, int fd, short bits,
 	void (*cb)(int, short, void*), void* arg)
@@ -571,6 +618,19 @@ ub_event_set_fd(struct ub_event* ev, int fd)
 	}
 }
 
+void
+ub_event_set_exclusive(struct ub_event* ev)
+{
+#if defined(USE_MINI_EVENT) && !defined(USE_WINSOCK)
+	if (ev->magic == UB_EVENT_MAGIC && ev->vmt == &default_event_vmt) {
+		minievent_set_exclusive(&AS_MY_EVENT(ev)->ev);
+		return;
+	}
+#endif
+	/* pluggable events do not support it */
+	(void)ev;
+}
+
 void
 ub_event_free(struct ub_event* ev)
 {
@@ -153,6 +153,41 @@ key_cache_obtain(struct key_cache* kcache, uint8_t* name, size_t namelen,
 	return NULL;
 }
 
+int
+key_cache_prefetch_claim(struct key_cache* kcache, uint8_t* name,
+	size_t namelen, uint16_t key_class, time_t now)
+{
+	int claimed = 0;
+	struct key_entry_data* d;
+	struct key_entry_key* k = key_cache_search(kcache, name, namelen,
+		key_class, 1);
+	if(!k)
+		return 0;
+	d = (struct key_entry_data*)k->entry.data;
+	if(now >= d->prefetch_ttl && now < d->ttl) {
+		d->prefetch_hits++;
+		claimed = (d->prefetch_hits == KEY_CACHE_PREFETCH_HITS);
+	}
+	lock_rw_unlock(&k->entry.lock);
+	return claimed;
+}
+
+void
+key_cache_prefetch_release(struct key_cache* kcache, uint8_t* name,
+	size_t namelen, uint16_t key_class, time_t now)
+{
+	struct key_entry_data* d;
+	struct key_entry_key* k = key_cache_search(kcache, name, namelen,
+		key_class, 1);
+	if(!k)
+		return;
+	d = (struct key_entry_data*)k->entry.data;
+	/* a refreshed entry is not in its prefetch window yet */
+	if(now >= d->prefetch_ttl)
+		d->prefetch_hits = 0;
+	lock_rw_unlock(&k->entry.lock);
+}
+
 size_t 
 key_cache_get_mem(struct key_cache* kcache)
 {
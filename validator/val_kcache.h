@@ -48,6 +48,13 @@ struct config_file;
 struct regional;
 struct module_qstate;
 
+/**
+ * Number of lookups of a key entry, after its prefetch TTL has passed,
+ * before the entry is refreshed ahead of its expiry. Entries looked up
+ * less often than this are simply fetched again when they expire.
+ */
+#define KEY_CACHE_PREFETCH_HITS 3
+
 /**
  * Key cache
  */
@@ -108,6 +115,38 @@ struct key_entry_key* key_cache_obtain(struct key_cache* kcache,
 	uint8_t* name, size_t namelen, uint16_t key_class, 
 	struct regional* region, time_t now);
 
+/**
+ * Count a lookup of a key entry that is past its prefetch TTL, and see
+ * if the caller should start the refresh of the entry. The refresh is
+ * claimed only once for an entry, by one caller over all the threads,
+ * when the entry has been looked up KEY_CACHE_PREFETCH_HITS times.
+ * Other callers continue to use the cached entry until the refreshed
+ * entry is inserted, and that insert resets the count.  If the refresh
+ * fails, key_cache_prefetch_release resets the count.
+ * @param kcache: the key cache.
+ * @param name: name of the key entry; uncompressed wireformat
+ * @param namelen: length of the name.
+ * @param key_class: class of the key.
+ * @param now: current time.
+ * @return true if the caller has claimed the refresh of the entry.
+ */
+int key_cache_prefetch_claim(struct key_cache* kcache, uint8_t* name,
+	size_t namelen, uint16_t key_class, time_t now);
+
+/**
+ * Release the claim on the refresh of a key entry, when the refresh has
+ * ended.  If the entry was not replaced by a refreshed entry, because the
+ * fetch failed, its count starts over, so that a later lookup can claim
+ * the refresh again.
+ * @param kcache: the key cache.
+ * @param name: name of the key entry; uncompressed wireformat
+ * @param namelen: length of the name.
+ * @param key_class: class of the key.
+ * @param now: current time.
+ */
+void key_cache_prefetch_release(struct key_cache* kcache, uint8_t* name,
+	size_t namelen, uint16_t key_class, time_t now);
+
 /**
  * Get memory in use by the key cache.
  * @param kcache: the key cache.
@@ -41,6 +41,7 @@
 #include "config.h"
 #include "validator/val_kentry.h"
 #include "util/data/packed_rrset.h"
+#include "util/data/msgreply.h"
 #include "util/data/dname.h"
 #include "util/storage/lookup3.h"
 #include "util/regional.h"
@@ -284,6 +285,8 @@ key_entry_create_null(struct regional* region,
 	if(!key_entry_setup(region, name, namelen, dclass, &k, &d))
 		return NULL;
 	d->ttl = now + ttl;
+	d->prefetch_ttl = now + PREFETCH_TTL_CALC(ttl);
+	d->prefetch_hits = 0;
 	d->isbad = 0;
 	d->reason = NULL;
 	d->rrset_type = LDNS_RR_TYPE_DNSKEY;
@@ -304,6 +307,8 @@ key_entry_create_rrset(struct regional* region,
 	if(!key_entry_setup(region, name, namelen, dclass, &k, &d))
 		return NULL;
 	d->ttl = rd->ttl + now;
+	d->prefetch_ttl = PREFETCH_TTL_CALC(rd->ttl) + now;
+	d->prefetch_hits = 0;
 	d->isbad = 0;
 	d->reason = NULL;
 	d->rrset_type = ntohs(rrset->rk.type);
@@ -330,6 +335,8 @@ key_entry_create_bad(struct regional* region,
 	if(!key_entry_setup(region, name, namelen, dclass, &k, &d))
 		return NULL;
 	d->ttl = now + ttl;
+	d->prefetch_ttl = now + PREFETCH_TTL_CALC(ttl);
+	d->prefetch_hits = 0;
 	d->isbad = 1;
 	d->reason = NULL;
 	d->rrset_type = LDNS_RR_TYPE_DNSKEY;
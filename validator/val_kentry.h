@@ -76,6 +76,11 @@ struct key_entry_key {
 struct key_entry_data {
 	/** the TTL of this entry (absolute time) */
 	time_t ttl;
+	/** the time after which lookups count towards a refresh of the
+	 * entry ahead of its expiry (absolute time) */
+	time_t prefetch_ttl;
+	/** number of lookups of this entry after the prefetch_ttl */
+	size_t prefetch_hits;
 	/** the key rrdata. can be NULL to signal keyless name. */
 	struct packed_rrset_data* rrset_data;
 	/** not NULL sometimes to give reason why bogus */
@@ -490,6 +490,55 @@ generate_keytag_query(struct module_qstate* qstate, int id,
 	return 1;
 }
 
+/**
+ * Generate, send and detach a refresh query for a key entry that is
+ * looked up often and that is about to expire. The DNSKEY query is
+ * validated like any other query, and that inserts the refreshed key
+ * entry in the key cache, before the old entry expires.  When the query
+ * ends, val_clear releases the claim on the refresh.
+ *
+ * @param qstate: query state.
+ * @param ve: validator shared global environment.
+ * @param kkey: the key entry to refresh.
+ */
+static void
+generate_key_prefetch(struct module_qstate* qstate, struct val_env* ve,
+	struct key_entry_key* kkey)
+{
+	struct key_entry_data* d = (struct key_entry_data*)kkey->entry.data;
+	struct module_qstate* newq = NULL;
+	struct mesh_state* sub = NULL;
+	struct query_info ask;
+	ask.qname = kkey->name;
+	ask.qname_len = kkey->namelen;
+	ask.qtype = LDNS_RR_TYPE_DNSKEY;
+	ask.qclass = kkey->key_class;
+	ask.local_alias = NULL;
+	log_nametypeclass(VERB_ALGO, "schedule key prefetch", kkey->name,
+		LDNS_RR_TYPE_DNSKEY, kkey->key_class);
+	/* not valrec, the answer has to be validated to refresh the entry */
+	fptr_ok(fptr_whitelist_modenv_add_sub(qstate->env->add_sub));
+	if(!(*qstate->env->add_sub)(qstate, &ask, (uint16_t)BIT_RD, 0, 0,
+		&newq, &sub)) {
+		verbose(VERB_ALGO, "could not generate key prefetch");
+		key_cache_prefetch_release(ve->kcache, kkey->name,
+			kkey->namelen, kkey->key_class, *qstate->env->now);
+		return;
+	}
+	if(!newq) {
+		/* the DNSKEY query is already running, for a client or as
+		 * a prefetch, and it may not refresh the entry; a later
+		 * lookup can claim the refresh again */
+		key_cache_prefetch_release(ve->kcache, kkey->name,
+			kkey->namelen, kkey->key_class, *qstate->env->now);
+		return;
+	}
+	/* make it ignore the cache, like a prefetch from the worker */
+	sock_list_insert(&newq->blacklist, NULL, 0, newq->region);
+	newq->prefetch_leeway = d->ttl - *qstate->env->now +
+		KEY_PREFETCH_EXPIRY_ADD;
+}
+
 /**
  * Get keytag as uint16_t from string
  *
@@ -1582,6 +1631,17 @@ processInit(struct module_qstate* qstate, struct val_qstate* vq,
 
 	vq->key_entry = key_cache_obtain(ve->kcache, lookup_name, lookup_len,
 		vq->qchase.qclass, qstate->region, *qstate->env->now);
+	/* refresh popular keys before they expire, so that queries do not
+	 * have to wait for the DNSKEY lookup and its validation */
+	if(vq->key_entry && qstate->env->cfg->prefetch_key &&
+		key_entry_isgood(vq->key_entry) &&
+		*qstate->env->now >= ((struct key_entry_data*)vq->key_entry->
+		entry.data)->prefetch_ttl &&
+		key_cache_prefetch_claim(ve->kcache, vq->key_entry->name,
+		vq->key_entry->namelen, vq->key_entry->key_class,
+		*qstate->env->now)) {
+		generate_key_prefetch(qstate, ve, vq->key_entry);
+	}
 
 	/* there is no key and no trust anchor */
 	if(vq->key_entry == NULL && anchor == NULL) {
@@ -2873,8 +2933,18 @@ val_inform_super(struct module_qstate* qstate, int id,
 void
 val_clear(struct module_qstate* qstate, int id)
 {
+	struct val_env* ve;
 	if(!qstate)
 		return;
+	ve = (struct val_env*)qstate->env->modinfo[id];
+	/* a key refresh from generate_key_prefetch has ended; if it failed,
+	 * the key entry is not refreshed and it can be claimed again */
+	if(qstate->qinfo.qtype == LDNS_RR_TYPE_DNSKEY &&
+		qstate->prefetch_leeway && !qstate->is_valrec &&
+		ve && ve->kcache)
+		key_cache_prefetch_release(ve->kcache, qstate->qinfo.qname,
+			qstate->qinfo.qname_len, qstate->qinfo.qclass,
+			*qstate->env->now);
 	/* everything is allocated in the region, so assign NULL */
 	qstate->minfo[id] = NULL;
 }
@@ -64,6 +64,14 @@ struct config_strlist;
  */
 #define BOGUS_KEY_TTL	60 /* seconds */
 
+/**
+ * Seconds added to the prefetch leeway of a key refresh, like the worker
+ * does for message prefetch.  The cached DNSKEY rrset expires with the key
+ * entry, and it has to be expired by the leeway to be replaced, and at
+ * least one second is needed to break the tie.
+ */
+#define KEY_PREFETCH_EXPIRY_ADD	60 /* seconds */
+
 /** max number of query restarts, number of IPs to probe */
 #define VAL_MAX_RESTART_COUNT 5
 
@@ -362,6 +362,9 @@ service_init(int r, struct daemon** d, struct config_file** c)
 		if(!(daemon->listen_sslctx = listen_sslctx_create(
 			cfg->ssl_service_key, cfg->ssl_service_pem, NULL)))
 			fatal_exit("could not set up listen SSL_CTX");
+		if(!listen_sslctx_setup_session_cache(daemon->listen_sslctx,
+			cfg->tls_session_cache_size, 0))
+			fatal_exit("could not set session cache SSL_CTX");
 	}
 	if(!(daemon->connect_sslctx = connect_sslctx_create(NULL, NULL,
 		cfg->tls_cert_bundle, cfg->tls_win_cert)))